@@ -65,6 +65,12 @@ newoption
     description = "Split target folders based on platforms"
 }
 
+newoption
+{
+    trigger = "headless",
+    description = "Embed the software display plugin instead of GLFW & OpenAL (Linux only)"
+}
+
 if os.is ("macosx") then
     osname = "mac"
 else
@@ -396,6 +402,11 @@ project "orxLIB"
             "AL_LIBTYPE_STATIC"
         }
 
+    if _OPTIONS["headless"] then
+        configuration {"not *Core*"}
+            defines {"__orxHEADLESS__"}
+    end
+
     -- Work around for codelite "default" configuration
     configuration {"codelite"}
         kind ("StaticLib")
@@ -440,21 +451,33 @@ project "orxLIB"
     configuration {"linux"}
         defines {"_GNU_SOURCE"}
 
-    configuration {"linux", "not *Core*"}
-        links
-        {
-            "glfw3",
-            "openal",
-            "sndfile",
-            "GL",
-            "X11",
-            "Xrandr",
-            "dl",
-            "m",
-            "rt",
-            "pthread",
-            "gcc"
-        }
+    if _OPTIONS["headless"] then
+        configuration {"linux", "not *Core*"}
+            links
+            {
+                "dl",
+                "m",
+                "rt",
+                "pthread",
+                "gcc"
+            }
+    else
+        configuration {"linux", "not *Core*"}
+            links
+            {
+                "glfw3",
+                "openal",
+                "sndfile",
+                "GL",
+                "X11",
+                "Xrandr",
+                "dl",
+                "m",
+                "rt",
+                "pthread",
+                "gcc"
+            }
+    end
 
     configuration {"linux", "*Core*"}
         buildoptions {"-fPIC"}
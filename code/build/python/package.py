@@ -185,6 +185,7 @@ devfolderinfolist = [
     {'src': 'include',                                                  'dst': None},
     {'src': '../tools/orxCrypt/bin',                                    'dst': 'tools/orxCrypt/bin'},
     {'src': '../tools/orxFontGen/bin',                                  'dst': 'tools/orxFontGen/bin'},
+    {'src': '../tools/orxPack/bin',                                     'dst': 'tools/orxPack/bin'},
 ]
 
 tutorialfolderinfolist = [
@@ -32,6 +32,12 @@ else
   cd $TRAVIS_BUILD_DIR/tools/orxFontGen/build/linux/gmake ;
 fi
 make config=release64
+if [[ "$TRAVIS_OS_NAME" == "osx" ]]; then
+  cd $TRAVIS_BUILD_DIR/tools/orxPack/build/mac/gmake ;
+else
+  cd $TRAVIS_BUILD_DIR/tools/orxPack/build/linux/gmake ;
+fi
+make config=release64
 cd $TRAVIS_BUILD_DIR/code/build/python
 if [[ "$TRAVIS_OS_NAME" == "osx" ]]; then
   python package.py -p mac &&
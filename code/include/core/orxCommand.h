@@ -217,6 +217,21 @@ extern orxDLLAPI orxCOMMAND_VAR *orxFASTCALL          orxCommand_Evaluate(const
 */
 extern orxDLLAPI orxCOMMAND_VAR *orxFASTCALL          orxCommand_EvaluateWithGUID(const orxSTRING _zCommandLine, orxU64 _u64GUID, orxCOMMAND_VAR *_pstResult);
 
+/** Evaluates a command using its compiled form: the command line is compiled on first use (commands & aliases resolved, literal arguments parsed) and cached by ID till a command or an alias gets (un)registered
+* @param[in]   _zCommandLine  Command name + arguments
+* @param[out]  _pstResult     Variable that will contain the result
+* @return      Command result if found, orxNULL otherwise
+*/
+extern orxDLLAPI orxCOMMAND_VAR *orxFASTCALL          orxCommand_EvaluateCompiled(const orxSTRING _zCommandLine, orxCOMMAND_VAR *_pstResult);
+
+/** Evaluates a command with a specific GUID using its compiled form, see orxCommand_EvaluateCompiled()
+* @param[in]   _zCommandLine  Command name + arguments
+* @param[in]   _u64GUID       GUID to use in place of the GUID markers in the command
+* @param[out]  _pstResult     Variable that will contain the result
+* @return      Command result if found, orxNULL otherwise
+*/
+extern orxDLLAPI orxCOMMAND_VAR *orxFASTCALL          orxCommand_EvaluateCompiledWithGUID(const orxSTRING _zCommandLine, orxU64 _u64GUID, orxCOMMAND_VAR *_pstResult);
+
 /** Executes a command
 * @param[in]   _zCommand      Command name
 * @param[in]   _u32ArgNumber  Number of arguments sent to the command
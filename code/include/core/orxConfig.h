@@ -148,6 +148,21 @@ extern orxDLLAPI orxSTATUS orxFASTCALL        orxConfig_ReloadHistory();
  */
 extern orxDLLAPI orxSTATUS orxFASTCALL        orxConfig_Save(const orxSTRING _zFileName, orxBOOL _bUseEncryption, const orxCONFIG_SAVE_FUNCTION _pfnSaveCallback);
 
+/** Writes a binary snapshot of the whole config to given file, that can be loaded later on with orxConfig_LoadSnapshot() without any text parsing.
+ * The snapshot holds all sections, entries and their pre-parsed values, it's only meant to be loaded by the same build of orx on the same platform.
+ * @param[in] _zFileName        File name
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL        orxConfig_SaveSnapshot(const orxSTRING _zFileName);
+
+/** Loads a binary config snapshot written by orxConfig_SaveSnapshot(), on top of the current config content.
+ * Entries keep their original file as origin: text files can still be (re)loaded on top of it, for hot-patching.
+ * The whole image is validated before being applied: a truncated, corrupted or incompatible snapshot is rejected and the text config should then be loaded instead.
+ * @param[in] _zFileName        File name
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL        orxConfig_LoadSnapshot(const orxSTRING _zFileName);
+
 /** Copies a file with optional encryption
  * @param[in] _zDstFileName     Name of the destination file
  * @param[in] _zSrcFileName     Name of the source file
@@ -65,6 +65,14 @@ do                                                                  \
   orxEvent_Send(&stEvent);                                          \
 } while(orxFALSE)
 
+#define orxEVENT_POST(TYPE, ID, SENDER, RECIPIENT, PAYLOAD, PAYLOAD_SIZE, COALESCE) \
+do                                                                  \
+{                                                                   \
+  orxEVENT stEvent;                                                 \
+  orxEVENT_INIT(stEvent, TYPE, ID, SENDER, RECIPIENT, PAYLOAD);     \
+  orxEvent_Post(&stEvent, PAYLOAD_SIZE, COALESCE);                  \
+} while(orxFALSE)
+
 #define orxEVENT_GET_FLAG(ID)                         ((orxU32)(1U << (orxU32)(ID)))
 #define orxEVENT_KU32_FLAG_ID_NONE                    0x00000000
 #define orxEVENT_KU32_MASK_ID_ALL                     0xFFFFFFFF
@@ -124,6 +132,11 @@ typedef struct __orxEVENT_t
  */
 typedef orxSTATUS (orxFASTCALL *orxEVENT_HANDLER)(const orxEVENT *_pstEvent);
 
+/**
+ * Event batch handler type / return orxSTATUS_FAILURE if the batch shouldn't be sent to any further batch handlers, orxSTATUS_SUCCESS otherwise
+ */
+typedef orxSTATUS (orxFASTCALL *orxEVENT_BATCH_HANDLER)(const orxEVENT *_astEventList, orxU32 _u32EventNumber);
+
 
 /** Event module setup
  */
@@ -178,6 +191,23 @@ extern orxDLLAPI orxSTATUS orxFASTCALL  orxEvent_RemoveHandlerWithContext(orxEVE
  */
 extern orxDLLAPI orxSTATUS orxFASTCALL  orxEvent_SetHandlerIDFlags(orxEVENT_HANDLER _pfnEventHandler, orxEVENT_TYPE _eEventType, void *_pContext, orxU32 _u32AddIDFlags, orxU32 _u32RemoveIDFlags);
 
+/** Adds a batch handler: posted events of its type will be delivered to it as a single array per dispatch, sent events as an array of one
+ * Batch handlers receive all the IDs of their event type and are called after all the regular handlers for posted events
+ * @param[in] _eEventType           Concerned type of event
+ * @param[in] _pfnBatchHandler      Batch handler to add
+ * @param[in] _pContext             Context that will be stored in events sent to this handler
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL  orxEvent_AddBatchHandler(orxEVENT_TYPE _eEventType, orxEVENT_BATCH_HANDLER _pfnBatchHandler, void *_pContext);
+
+/** Removes a batch handler which matches given context
+ * @param[in] _eEventType           Concerned type of event
+ * @param[in] _pfnBatchHandler      Batch handler to remove
+ * @param[in] _pContext             Context of the handler to remove, orxNULL for removing all occurrences regardless of their context
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL  orxEvent_RemoveBatchHandler(orxEVENT_TYPE _eEventType, orxEVENT_BATCH_HANDLER _pfnBatchHandler, void *_pContext);
+
 /** Sends an event
  * @param[in] _pstEvent             Event to send
  * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
@@ -191,6 +221,22 @@ extern orxDLLAPI orxSTATUS orxFASTCALL  orxEvent_Send(orxEVENT *_pstEvent);
  */
 extern orxDLLAPI orxSTATUS orxFASTCALL  orxEvent_SendShort(orxEVENT_TYPE _eEventType, orxENUM _eEventID);
 
+/** Posts an event: it will be copied (along with its payload) and dispatched later on, from the main thread, during orxEvent_Dispatch()
+ * Can be called from any thread created with orxThread_Start(), without locking
+ * @param[in] _pstEvent             Event to post
+ * @param[in] _u32PayloadSize       Size of the payload to copy, 0 to keep the payload pointer as-is (it then needs to remain valid till dispatch)
+ * @param[in] _bCoalesce            If true, the event will be dropped if an identical coalescable event (type, ID, sender, recipient & payload) is dispatched at the same time
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL  orxEvent_Post(const orxEVENT *_pstEvent, orxU32 _u32PayloadSize, orxBOOL _bCoalesce);
+
+/** Dispatches all posted events, main thread only; called by orxClock_Update() once all the clocks have been updated
+ * Events posted from the main thread are dispatched in order, before those of each other thread (in thread ID order)
+ * Events posted while dispatching will be dispatched next time
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL  orxEvent_Dispatch();
+
 /** Is currently sending an event?
  * @return orxTRUE / orxFALSE
  */
@@ -50,6 +50,55 @@
 
 #define orxRESOURCE_KZ_DEFAULT_STORAGE                    "."
 #define orxRESOURCE_KZ_TYPE_TAG_FILE                      "file"
+#define orxRESOURCE_KZ_TYPE_TAG_PACK                      "pack"
+
+
+/** Pack format
+ * A pack is made of a header, followed by the table of contents (slot list, entry list and name list) and the entries' data.
+ * The slot list is an open addressing hash table (linear probing) of entry indices + 1 (0: empty slot), indexed by the CRC of the entry names.
+ * Compressed entries are made of consecutive blocks of header's block size (except for the last one), each being prefixed by its stored size (orxU32).
+ * Blocks are stored using the LZ4 block format, or raw if they're flagged as such.
+ * Entry name CRCs are string IDs: a pack can only be mounted by a library using the same ID format version (see orxString_GetIDVersion()).
+ */
+#define orxRESOURCE_KC_PACK_SEPARATOR                     '|'
+
+#define orxRESOURCE_KU32_PACK_MAGIC                       0x4B41504F  /**< 'OPAK' */
+#define orxRESOURCE_KU32_PACK_VERSION                     2
+
+#define orxRESOURCE_KU32_PACK_ENTRY_FLAG_NONE             0x00000000  /**< No flag */
+#define orxRESOURCE_KU32_PACK_ENTRY_FLAG_COMPRESSED       0x00000001  /**< Compressed entry flag */
+
+#define orxRESOURCE_KU32_PACK_BLOCK_FLAG_RAW              0x80000000  /**< Raw (uncompressed) block flag */
+#define orxRESOURCE_KU32_PACK_BLOCK_MASK_SIZE             0x7FFFFFFF  /**< Block size mask */
+
+/** Pack header
+ */
+typedef struct __orxRESOURCE_PACK_HEADER_t
+{
+  orxU32                        u32Magic;                 /**< Magic number : 4 */
+  orxU32                        u32Version;               /**< Format version : 8 */
+  orxU32                        u32EntryCount;            /**< Number of entries : 12 */
+  orxU32                        u32SlotCount;             /**< Number of hash slots (power of two) : 16 */
+  orxU32                        u32NameSize;              /**< Size of the name list, in bytes : 20 */
+  orxU32                        u32BlockSize;             /**< Uncompressed size of compressed entries' blocks : 24 */
+  orxU32                        u32IDVersion;             /**< String ID format version used for the entry name CRCs : 28 */
+
+} orxRESOURCE_PACK_HEADER;
+
+/** Pack entry
+ */
+typedef struct __orxRESOURCE_PACK_ENTRY_t
+{
+  orxS64                        s64Offset;                /**< Offset of the entry's data in the pack : 8 */
+  orxS64                        s64Size;                  /**< Uncompressed size : 16 */
+  orxS64                        s64StoredSize;            /**< Stored size : 24 */
+  orxS64                        s64Time;                  /**< Modification time of the source file : 32 */
+  orxU32                        u32NameCRC;               /**< CRC of the entry's name : 36 */
+  orxU32                        u32NameOffset;            /**< Offset of the entry's name in the name list : 40 */
+  orxU32                        u32Flags;                 /**< Flags : 44 */
+  orxU32                        u32Padding;               /**< Padding : 48 */
+
+} orxRESOURCE_PACK_ENTRY;
 
 
 /** Resource asynchronous operation callback function
@@ -69,6 +118,8 @@ typedef orxS64          (orxFASTCALL *orxRESOURCE_FUNCTION_TELL)(orxHANDLE _hRes
 typedef orxS64          (orxFASTCALL *orxRESOURCE_FUNCTION_READ)(orxHANDLE _hResource, orxS64 _s64Size, void *_pBuffer);
 typedef orxS64          (orxFASTCALL *orxRESOURCE_FUNCTION_WRITE)(orxHANDLE _hResource, orxS64 _s64Size, const void *_pBuffer);
 typedef orxSTATUS       (orxFASTCALL *orxRESOURCE_FUNCTION_DELETE)(const orxSTRING _zLocation);
+typedef const void *    (orxFASTCALL *orxRESOURCE_FUNCTION_MAP)(orxHANDLE _hResource, orxS64 *_ps64Size);
+typedef void            (orxFASTCALL *orxRESOURCE_FUNCTION_UNMAP)(orxHANDLE _hResource, const void *_pData, orxS64 _s64Size);
 
 /** Resource type info
  */
@@ -85,6 +136,8 @@ typedef struct __orxRESOURCE_TYPE_INFO_t
   orxRESOURCE_FUNCTION_READ     pfnRead;                  /**< Read function, mandatory */
   orxRESOURCE_FUNCTION_WRITE    pfnWrite;                 /**< Write function, optional, for write support */
   orxRESOURCE_FUNCTION_DELETE   pfnDelete;                /**< Delete function, optional, for deletion support */
+  orxRESOURCE_FUNCTION_MAP      pfnMap;                   /**< Map function, optional, for zero-copy read support: returns orxNULL when a resource can't be mapped */
+  orxRESOURCE_FUNCTION_UNMAP    pfnUnmap;                 /**< Unmap function, mandatory if Map is defined */
 
 } orxRESOURCE_TYPE_INFO;
 
@@ -114,6 +167,35 @@ typedef struct __orxRESOURCE_EVENT_PAYLOAD_t
 
 } orxRESOURCE_EVENT_PAYLOAD;
 
+/** Request priority enum
+ */
+typedef enum __orxRESOURCE_PRIORITY_t
+{
+  orxRESOURCE_PRIORITY_CRITICAL = 0,
+  orxRESOURCE_PRIORITY_INTERACTIVE,
+  orxRESOURCE_PRIORITY_BACKGROUND,
+
+  orxRESOURCE_PRIORITY_NUMBER,
+
+  orxRESOURCE_PRIORITY_NONE = orxENUM_NONE
+
+} orxRESOURCE_PRIORITY;
+
+/** Asynchronous operation stats
+ */
+typedef struct __orxRESOURCE_STATS_t
+{
+  orxU64                        u64ReadSize;              /**< Total read size, in bytes : 8 */
+  orxU64                        u64WriteSize;             /**< Total written size, in bytes : 16 */
+  orxDOUBLE                     dReadTime;                /**< Time spent reading, in seconds : 24 */
+  orxDOUBLE                     dWriteTime;               /**< Time spent writing, in seconds : 32 */
+  orxDOUBLE                     dWaitTime;                /**< Time spent by requests waiting in queue, in seconds : 40 */
+  orxU32                        u32ReadCount;             /**< Number of serviced reads : 44 */
+  orxU32                        u32WriteCount;            /**< Number of serviced writes : 48 */
+  orxU32                        u32CancelCount;           /**< Number of cancelled reads : 52 */
+
+} orxRESOURCE_STATS;
+
 
 /** Resource module setup
  */
@@ -216,7 +298,7 @@ extern orxDLLAPI orxS64 orxFASTCALL                       orxResource_GetTime(co
  */
 extern orxDLLAPI orxHANDLE orxFASTCALL                    orxResource_Open(const orxSTRING _zLocation, orxBOOL _bEraseMode);
 
-/** Closes a resource
+/** Closes a resource, its pending asynchronous reads get cancelled and will be notified with a size of 0
  * @param[in] _hResource        Concerned resource
  */
 extern orxDLLAPI void orxFASTCALL                         orxResource_Close(orxHANDLE _hResource);
@@ -267,6 +349,21 @@ extern orxDLLAPI orxS64 orxFASTCALL                       orxResource_Read(orxHA
  */
 extern orxDLLAPI orxS64 orxFASTCALL                       orxResource_Write(orxHANDLE _hResource, orxS64 _s64Size, const void *_pBuffer, orxRESOURCE_OP_FUNCTION _pfnCallback, void *_pContext);
 
+/** Maps the whole content of a resource in memory, read-only, without copying it when its type supports it (ie. file and uncompressed pack entries)
+ * A resource can only be mapped once at a time and no asynchronous operation should be pending on it. The resource cursor isn't modified.
+ * @param[in] _hResource        Concerned resource
+ * @param[in] _bAllowCopy       If the resource can't be mapped, its content will be read into a buffer instead; if orxFALSE, orxNULL will be returned in this case
+ * @param[out] _ps64Size        Size of the mapped data, in bytes
+ * @return Mapped data, valid till orxResource_Unmap or orxResource_Close is called, orxNULL on failure
+ */
+extern orxDLLAPI const void *orxFASTCALL                  orxResource_Map(orxHANDLE _hResource, orxBOOL _bAllowCopy, orxS64 *_ps64Size);
+
+/** Unmaps the content of a resource, this is also done automatically when the resource gets closed
+ * Unlike orxResource_Close, this function can be called from any thread.
+ * @param[in] _hResource        Concerned resource
+ */
+extern orxDLLAPI void orxFASTCALL                         orxResource_Unmap(orxHANDLE _hResource);
+
 /** Deletes a resource, given its location
  * @param[in] _zLocation        Location of the resource to delete
  * @return orxSTATUS_SUCCESS upon success, orxSTATUS_FAILURE otherwise
@@ -274,6 +371,13 @@ extern orxDLLAPI orxS64 orxFASTCALL                       orxResource_Write(orxH
 extern orxDLLAPI orxSTATUS orxFASTCALL                    orxResource_Delete(const orxSTRING _zLocation);
 
 
+/** Sets the priority of the upcoming asynchronous operations on a resource, operations on a same resource are always serviced in order
+ * @param[in] _hResource        Concerned resource
+ * @param[in] _ePriority        Priority of the upcoming asynchronous operations, defaults to orxRESOURCE_PRIORITY_INTERACTIVE
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL                    orxResource_SetPriority(orxHANDLE _hResource, orxRESOURCE_PRIORITY _ePriority);
+
 /** Gets pending operation count for a given resource
  * @param[in] _hResource        Concerned resource
  * @return Number of pending asynchronous operations for that resource
@@ -286,6 +390,13 @@ extern orxDLLAPI orxU32 orxFASTCALL                       orxResource_GetPending
 extern orxDLLAPI orxU32 orxFASTCALL                       orxResource_GetTotalPendingOpCount();
 
 
+/** Gets asynchronous operation stats for a given group
+ * @param[in] _zGroup           Concerned resource group, orxNULL for stats accumulated over all resources
+ * @param[out] _pstStats        Stats of the group
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL                    orxResource_GetStats(const orxSTRING _zGroup, orxRESOURCE_STATS *_pstStats);
+
 /** Registers a new resource type
  * @param[in] _pstInfo          Info describing the new resource type and how to handle it
  * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
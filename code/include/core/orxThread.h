@@ -63,10 +63,16 @@
 /** Semaphore structure */
 typedef struct __orxTHREAD_SEMAPHORE_t                orxTHREAD_SEMAPHORE;
 
+/** Job structure */
+typedef struct __orxTHREAD_JOB_t                      orxTHREAD_JOB;
+
 
 /** Thread run function type */
 typedef orxSTATUS (orxFASTCALL *orxTHREAD_FUNCTION)(void *_pContext);
 
+/** Parallel range function type, processes indices in [_u32Start, _u32End[ */
+typedef void (orxFASTCALL *orxTHREAD_RANGE_FUNCTION)(orxU32 _u32Start, orxU32 _u32End, void *_pContext);
+
 
 /** Thread module setup
  */
@@ -150,7 +156,7 @@ extern orxDLLAPI orxSTATUS orxFASTCALL                orxThread_SignalSemaphore(
 
 
 /** Runs an asynchronous task and optional follow-ups
- * @param[in]   _pfnRun                               Asynchronous task to run, executed on a different thread dedicated to tasks, if orxNULL defaults to an empty task that always succeed
+ * @param[in]   _pfnRun                               Asynchronous task to run, executed on one of the task worker threads (tasks sharing the same context are run in submission order), if orxNULL defaults to an empty task that always succeed
  * @param[in]   _pfnThen                              Executed (on the main thread) if Run does *not* return orxSTATUS_FAILURE, can be orxNULL
  * @param[in]   _pfnElse                              Executed (on the main thread) if Run returns orxSTATUS_FAILURE, can be orxNULL
  * @param[in]   _pContext                             Context that will be transmitted to all the task functions
@@ -163,6 +169,54 @@ extern orxDLLAPI orxSTATUS orxFASTCALL                orxThread_RunTask(const or
  */
 extern orxDLLAPI orxU32 orxFASTCALL                   orxThread_GetTaskCount();
 
+
+/** Creates a job, ie. a task that can depend on other jobs and be waited for, without any main thread notification
+ * @param[in]   _pfnRun                               Function to run on a task worker thread, if orxNULL defaults to an empty job that always succeeds
+ * @param[in]   _pContext                             Context that will be transmitted to the function
+ * @return      orxTHREAD_JOB / orxNULL
+ */
+extern orxDLLAPI orxTHREAD_JOB *orxFASTCALL           orxThread_CreateJob(const orxTHREAD_FUNCTION _pfnRun, void *_pContext);
+
+/** Deletes a job, it must either never have been run or be completed
+ * @param[in]   _pstJob                               Concerned job
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL                orxThread_DeleteJob(orxTHREAD_JOB *_pstJob);
+
+/** Adds a dependency between two jobs: a job will only start once all its predecessors have completed; both jobs must not have been run yet
+ * @param[in]   _pstJob                               Concerned job
+ * @param[in]   _pstPredecessor                       Job that needs to complete before the concerned one can start
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL                orxThread_AddJobDependency(orxTHREAD_JOB *_pstJob, orxTHREAD_JOB *_pstPredecessor);
+
+/** Runs a job: it'll be executed on a task worker thread as soon as all its predecessors have completed
+ * @param[in]   _pstJob                               Concerned job
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL                orxThread_RunJob(orxTHREAD_JOB *_pstJob);
+
+/** Is a job done?
+ * @param[in]   _pstJob                               Concerned job
+ * @return      orxTRUE if the job has completed, orxFALSE otherwise
+ */
+extern orxDLLAPI orxBOOL orxFASTCALL                  orxThread_IsJobDone(const orxTHREAD_JOB *_pstJob);
+
+/** Waits for a job to complete (when called from a task worker thread, other tasks will be processed while waiting)
+ * @param[in]   _pstJob                               Concerned job
+ * @return      Status returned by the job's function
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL                orxThread_WaitJob(const orxTHREAD_JOB *_pstJob);
+
+/** Runs a function over a range of indices, split in batches processed in parallel by the calling thread and the task worker threads; returns once all batches have been processed
+ * @param[in]   _u32Count                             Number of indices to process, [0, _u32Count[
+ * @param[in]   _u32Grain                             Maximum number of indices per batch (0 will default to 1)
+ * @param[in]   _pfnRun                               Function to run on each batch, can be called concurrently from different threads
+ * @param[in]   _pContext                             Context that will be transmitted to the function
+ */
+extern orxDLLAPI void orxFASTCALL                     orxThread_ParallelFor(orxU32 _u32Count, orxU32 _u32Grain, const orxTHREAD_RANGE_FUNCTION _pfnRun, void *_pContext);
+
+
 /** Sets callbacks to run when starting and stopping new threads
  * @param[in]   _pfnStart                             Function to run whenever a new thread is started
  * @param[in]   _pfnStop                              Function to run whenever a thread is stopped
@@ -281,6 +281,8 @@ typedef struct __orxDISPLAY_EVENT_PAYLOAD_t
       const orxSTRING zLocation;                            /**< File location : 40 */
       orxSTRINGID     stFilenameID;                         /**< File name ID : 44 */
       orxU32          u32ID;                                /**< Bitmap (hardware texture) ID : 48 */
+      const orxU8    *au8Data;                              /**< Decoded pixels (RGBA), only valid during the event, orxNULL if not available : 52 */
+      orxU32          u32LineSize;                          /**< Size of a line of decoded pixels, in bytes : 56 */
 
     } stBitmap;
   };
@@ -288,6 +290,11 @@ typedef struct __orxDISPLAY_EVENT_PAYLOAD_t
 } orxDISPLAY_EVENT_PAYLOAD;
 
 
+/** Bitmap data asynchronous read callback function, _u32ByteNumber is 0 upon failure
+ */
+typedef void (orxFASTCALL *orxDISPLAY_READ_FUNCTION)(const orxBITMAP *_pstBitmap, orxU32 _u32ByteNumber, orxU8 *_au8Data, void *_pContext);
+
+
 /***************************************************************************
  * Functions directly implemented by orx core
  ***************************************************************************/
@@ -967,6 +974,17 @@ extern orxDLLAPI orxSTATUS orxFASTCALL                orxDisplay_SetBitmapClippi
  */
 extern orxDLLAPI orxSTATUS orxFASTCALL                orxDisplay_SetBitmapData(orxBITMAP *_pstBitmap, const orxU8 *_au8Data, orxU32 _u32ByteNumber);
 
+/** Sets the data of a region of a bitmap (RGBA memory format)
+ * @param[in]   _pstBitmap                            Concerned bitmap
+ * @param[in]   _au8Data                              Data (4 channels, RGBA), _u32Width * _u32Height pixels
+ * @param[in]   _u32X                                 Left coord of the region, in pixels
+ * @param[in]   _u32Y                                 Top coord of the region, in pixels
+ * @param[in]   _u32Width                             Width of the region, in pixels
+ * @param[in]   _u32Height                            Height of the region, in pixels
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL                orxDisplay_SetPartialBitmapData(orxBITMAP *_pstBitmap, const orxU8 *_au8Data, orxU32 _u32X, orxU32 _u32Y, orxU32 _u32Width, orxU32 _u32Height);
+
 /** Gets a bitmap data (RGBA memory format)
  * @param[in]   _pstBitmap                            Concerned bitmap
  * @param[in]   _au8Data                              Output buffer (4 channels, RGBA)
@@ -975,6 +993,16 @@ extern orxDLLAPI orxSTATUS orxFASTCALL                orxDisplay_SetBitmapData(o
  */
 extern orxDLLAPI orxSTATUS orxFASTCALL                orxDisplay_GetBitmapData(const orxBITMAP *_pstBitmap, orxU8 *_au8Data, orxU32 _u32ByteNumber);
 
+/** Requests a bitmap data (RGBA memory format) without stalling the rendering pipeline: the content is captured at call time and retrieved when available
+ * @param[in]   _pstBitmap                            Concerned bitmap
+ * @param[in]   _au8Data                              Output buffer (4 channels, RGBA), has to remain valid till the callback is called
+ * @param[in]   _u32ByteNumber                        Number of bytes of the buffer
+ * @param[in]   _pfnCallback                          Function called on the main thread once the data has been retrieved (or upon failure), never called from within this function
+ * @param[in]   _pContext                             Context that will be transmitted to the callback when called
+ * @return orxSTATUS_SUCCESS if the request has been issued (the callback will then be called exactly once) / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL                orxDisplay_RequestBitmapData(const orxBITMAP *_pstBitmap, orxU8 *_au8Data, orxU32 _u32ByteNumber, orxDISPLAY_READ_FUNCTION _pfnCallback, void *_pContext);
+
 /** Gets a bitmap size
  * @param[in]   _pstBitmap                            Concerned bitmap
  * @param[out]  _pfWidth                              Bitmap width
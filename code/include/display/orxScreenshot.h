@@ -91,6 +91,16 @@ extern orxDLLAPI void orxFASTCALL       orxScreenshot_Exit();
  */
 extern orxDLLAPI orxSTATUS orxFASTCALL  orxScreenshot_Capture();
 
+/** Captures a sequence of screenshots, one per rendered frame, without stalling rendering when supported by the display plugin
+ * @param[in]   _u32FrameNumber Number of consecutive frames to capture, starting with the current one, 0 to stop any ongoing sequence
+ */
+extern orxDLLAPI void orxFASTCALL       orxScreenshot_CaptureSequence(orxU32 _u32FrameNumber);
+
+/** Gets the number of frames left to capture in the ongoing sequence
+ * @return Number of remaining frames, 0 if no sequence is being captured
+ */
+extern orxDLLAPI orxU32 orxFASTCALL     orxScreenshot_GetSequenceCount();
+
 #endif /* _orxSCREENSHOT_H_ */
 
 /** @} */
@@ -57,6 +57,12 @@
 
 #define orxTEXTURE_KZ_PIXEL               "pixel"
 
+#define orxTEXTURE_KZ_CONFIG_SECTION          "Texture"
+#define orxTEXTURE_KZ_CONFIG_ATLAS_SIZE       "AtlasSize"
+#define orxTEXTURE_KZ_CONFIG_ATLAS_THRESHOLD  "AtlasThreshold"
+#define orxTEXTURE_KZ_CONFIG_ATLAS_GROUP_LIST "AtlasGroupList"
+#define orxTEXTURE_KZ_CONFIG_TEXTURE_LIST     "TextureList"
+
 
 /** Event enum
  */
@@ -73,6 +79,20 @@ typedef enum __orxTEXTURE_EVENT_t
 } orxTEXTURE_EVENT;
 
 
+/** Atlas stats
+ */
+typedef struct __orxTEXTURE_ATLAS_STATS_t
+{
+  orxU64  u64UsedTexelCount;                    /**< Texels used by packed textures (padding included) : 8 */
+  orxU64  u64TotalTexelCount;                   /**< Texels allocated for all atlas pages : 16 */
+  orxU32  u32PageCount;                         /**< Atlas page count : 20 */
+  orxU32  u32TextureCount;                      /**< Packed texture count : 24 */
+  orxU32  u32RepackCount;                       /**< Number of page repacks since init : 28 */
+  orxU32  u32SavedBindCount;                    /**< Bitmap switches avoided during last frame : 32 */
+
+} orxTEXTURE_ATLAS_STATS;
+
+
 /** Internal texture structure */
 typedef struct __orxTEXTURE_t             orxTEXTURE;
 
@@ -160,6 +180,26 @@ extern orxDLLAPI orxTEXTURE *orxFASTCALL  orxTexture_GetScreenTexture();
  */
 extern orxDLLAPI orxU32 orxFASTCALL       orxTexture_GetLoadCount();
 
+
+/** Gets texture origin inside its atlas bitmap, ie. the offset to apply to texture coordinates when drawing with orxTexture_GetBitmap()
+ * @param[in]   _pstTexture     Concerned texture
+ * @param[out]  _pvOrigin       Texture's origin inside its atlas, orxVECTOR_0 if not packed
+ * @return      orxVECTOR
+ */
+extern orxDLLAPI orxVECTOR *orxFASTCALL   orxTexture_GetAtlasOrigin(const orxTEXTURE *_pstTexture, orxVECTOR *_pvOrigin);
+
+/** Unpacks a texture from its atlas (if any) and prevents it from being packed again, needed for textures used as render targets, fonts or shader parameters
+ * @param[in]   _pstTexture     Concerned texture
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL    orxTexture_Unpack(orxTEXTURE *_pstTexture);
+
+/** Gets atlas stats
+ * @param[out]  _pstStats       Atlas stats
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL    orxTexture_GetAtlasStats(orxTEXTURE_ATLAS_STATS *_pstStats);
+
 #endif /* _orxTEXTURE_H_ */
 
 /** @} */
@@ -200,6 +200,19 @@ extern orxDLLAPI orxS64 orxFASTCALL         orxFile_GetSize(const orxFILE *_pstF
  */
 extern orxDLLAPI orxS64 orxFASTCALL         orxFile_GetTime(const orxFILE *_pstFile);
 
+/** Maps a whole file in memory, read-only, the mapping remains valid after the file has been closed
+ * @param[in] _pstFile              Concerned file
+ * @param[out] _ps64Size            Size of the mapped data
+ * @return Mapped data if successful, orxNULL if the file is empty or the platform/file doesn't support mapping
+ */
+extern orxDLLAPI const void *orxFASTCALL    orxFile_Map(orxFILE *_pstFile, orxS64 *_ps64Size);
+
+/** Unmaps data previously mapped with orxFile_Map
+ * @param[in] _pData                Mapped data
+ * @param[in] _s64Size              Size of the mapped data, as retrieved by orxFile_Map
+ */
+extern orxDLLAPI void orxFASTCALL           orxFile_Unmap(const void *_pData, orxS64 _s64Size);
+
 /** Prints a formatted string to a file
  * @param[in] _pstFile             Pointer to the file descriptor
  * @param[in] _zString             Formatted string
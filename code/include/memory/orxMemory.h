@@ -73,6 +73,46 @@
   #warning !!WARNING!! This compiler does not have any builtin hardware memory barrier.
 #endif
 
+/** Atomic operation macros (full barrier semantics, except for loads that have acquire semantics) */
+#if defined(__orxGCC__) || defined(__orxLLVM__)
+  #define orxMEMORY_ATOMIC_ADD_U32(PTR, VALUE)            __sync_fetch_and_add((PTR), (orxU32)(VALUE))
+  #define orxMEMORY_ATOMIC_CAS_U32(PTR, OLD, NEW)         ((__sync_bool_compare_and_swap((PTR), (OLD), (NEW)) != 0) ? orxTRUE : orxFALSE)
+  #define orxMEMORY_ATOMIC_CAS_POINTER(PTR, OLD, NEW)     ((__sync_bool_compare_and_swap((PTR), (OLD), (NEW)) != 0) ? orxTRUE : orxFALSE)
+  #define orxMEMORY_ATOMIC_EXCHANGE_POINTER(PTR, NEW)     ((void *)__atomic_exchange_n((PTR), (NEW), __ATOMIC_SEQ_CST))
+  #define orxMEMORY_ATOMIC_LOAD_POINTER(PTR)              ((void *)__atomic_load_n((PTR), __ATOMIC_ACQUIRE))
+  #define orxHAS_MEMORY_ATOMIC
+#elif defined(__orxMSVC__)
+  #define orxMEMORY_ATOMIC_ADD_U32(PTR, VALUE)            ((orxU32)_InterlockedExchangeAdd((volatile long *)(PTR), (long)(VALUE)))
+  #define orxMEMORY_ATOMIC_CAS_U32(PTR, OLD, NEW)         ((_InterlockedCompareExchange((volatile long *)(PTR), (long)(NEW), (long)(OLD)) == (long)(OLD)) ? orxTRUE : orxFALSE)
+  #define orxMEMORY_ATOMIC_CAS_POINTER(PTR, OLD, NEW)     ((_InterlockedCompareExchangePointer((void * volatile *)(PTR), (void *)(NEW), (void *)(OLD)) == (void *)(OLD)) ? orxTRUE : orxFALSE)
+  #define orxMEMORY_ATOMIC_EXCHANGE_POINTER(PTR, NEW)     _InterlockedExchangePointer((void * volatile *)(PTR), (void *)(NEW))
+  #define orxMEMORY_ATOMIC_LOAD_POINTER(PTR)              orxMemory_LoadPointer((void * volatile *)(PTR))
+  #define orxHAS_MEMORY_ATOMIC
+
+static orxINLINE void *orxMemory_LoadPointer(void * volatile *_ppSource)
+{
+  void *pResult = *_ppSource;
+  orxMEMORY_BARRIER();
+  return pResult;
+}
+#else
+  #define orxMEMORY_ATOMIC_ADD_U32(PTR, VALUE)            ((*(PTR) += (orxU32)(VALUE)) - (orxU32)(VALUE))
+  #define orxMEMORY_ATOMIC_CAS_U32(PTR, OLD, NEW)         ((*(PTR) == (OLD)) ? (*(PTR) = (NEW), orxTRUE) : orxFALSE)
+  #define orxMEMORY_ATOMIC_CAS_POINTER(PTR, OLD, NEW)     ((*(PTR) == (OLD)) ? (*(PTR) = (NEW), orxTRUE) : orxFALSE)
+  #define orxMEMORY_ATOMIC_EXCHANGE_POINTER(PTR, NEW)     orxMemory_ExchangePointer((void **)(PTR), (void *)(NEW))
+  #define orxMEMORY_ATOMIC_LOAD_POINTER(PTR)              ((void *)*(PTR))
+  #undef orxHAS_MEMORY_ATOMIC
+
+  #warning !!WARNING!! This compiler does not have any builtin atomic operation.
+
+static orxINLINE void *orxMemory_ExchangePointer(void **_ppDest, void *_pValue)
+{
+  void *pResult = *_ppDest;
+  *_ppDest = _pValue;
+  return pResult;
+}
+#endif
+
 
 /** Memory tracking macros */
 #ifdef __orxPROFILER__
@@ -95,6 +135,8 @@ typedef enum __orxMEMORY_TYPE_t
   orxMEMORY_TYPE_TEMP,                                    /**< Temporary / scratch memory */
   orxMEMORY_TYPE_TEXT,                                    /**< Text memory */
   orxMEMORY_TYPE_VIDEO,                                   /**< Video memory type */
+  orxMEMORY_TYPE_STRING,                                  /**< Interned string memory (orxString_GetID() / orxString_Store()) */
+  orxMEMORY_TYPE_FRAME,                                   /**< Frame memory: bump-allocated per thread, only valid till the end of the current frame (orxClock_Update()), freeing it is optional */
 
   orxMEMORY_TYPE_NUMBER,                                  /**< Number of memory type */
 
@@ -137,6 +179,16 @@ extern orxDLLAPI void *orxFASTCALL                        orxMemory_Reallocate(v
  */
 extern orxDLLAPI void orxFASTCALL                         orxMemory_Free(void *_pMem);
 
+/** Releases the memory cache of the calling thread: small blocks freed by this thread are given back to the system allocator
+ * @note Called automatically when threads created with orxThread_Start() stop, only needed for other threads that allocated memory with orx
+ */
+extern orxDLLAPI void orxFASTCALL                         orxMemory_ReleaseCache();
+
+/** Resets frame memory (orxMEMORY_TYPE_FRAME) of all threads: all frame allocations become invalid
+ * @note Called automatically at the end of orxClock_Update(), each thread's arena is then rewound upon its next frame allocation
+ */
+extern orxDLLAPI void orxFASTCALL                         orxMemory_ResetFrame();
+
 
 /** Copies a part of memory into another one
  * @param[out] _pDest    Destination pointer
@@ -109,6 +109,10 @@ typedef enum __orxFRAME_SPACE_t
  */
 typedef struct __orxFRAME_t                   orxFRAME;
 
+/** Frame update callback
+ */
+typedef void (orxFASTCALL *orxFRAME_UPDATE_FUNCTION)(orxFRAME *_pstFrame, void *_pContext);
+
 
 /** Get ignore flags
  * @param[in]   _zFlags         Literal ignore flags
@@ -245,6 +249,14 @@ extern orxDLLAPI orxFLOAT orxFASTCALL         orxFrame_TransformRotation(orxFRAM
  */
 extern orxDLLAPI orxVECTOR *orxFASTCALL       orxFrame_TransformScale(orxFRAME *_pstFrame, orxFRAME_SPACE _eSpace, orxVECTOR *_pvScale);
 
+
+/** Flushes the list of frames whose global data has been updated since the previous flush
+ * @param[in]   _pfnCallback    Function called once for every updated frame, must not modify any frame
+ * @param[in]   _pContext       Context sent to the callback
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE if some updated frames couldn't be tracked (all frames should then be considered as updated)
+ */
+extern orxDLLAPI orxSTATUS orxFASTCALL        orxFrame_FlushUpdateList(const orxFRAME_UPDATE_FUNCTION _pfnCallback, void *_pContext);
+
 #endif /* _orxFRAME_H_ */
 
 /** @} */
@@ -52,6 +52,7 @@
 #include "display/orxDisplay.h"
 #include "display/orxGraphic.h"
 #include "display/orxTexture.h"
+#include "math/orxAABox.h"
 #include "math/orxOBox.h"
 #include "memory/orxBank.h"
 #include "object/orxStructure.h"
@@ -1155,6 +1156,18 @@ extern orxDLLAPI orxOBJECT *orxFASTCALL     orxObject_Pick(const orxVECTOR *_pvP
  * @return      orxOBJECT / orxNULL
  */
 extern orxDLLAPI orxOBJECT *orxFASTCALL     orxObject_BoxPick(const orxOBOX *_pstBox, orxSTRINGID _stGroupID);
+
+/** Gets candidate objects for a 2D box query, using the spatial index. Objects are indexed by group in a uniform grid
+ * (cell size defined by Object.IndexCellSize, defaults to 256) that is kept up-to-date as their frames get updated.
+ * Candidates are a superset of the objects touching the box and still need to be tested by the caller. When they all fit
+ * in the list, they're sorted in group order (see orxObject_GetNext()).
+ * @param[in]   _pstBox         Box to check (only X & Y are considered)
+ * @param[in]   _stGroupID      Group ID to consider, orxSTRINGID_UNDEFINED for all
+ * @param[out]  _apstObjectList List that will receive candidates, can be orxNULL if _u32Size is 0
+ * @param[in]   _u32Size        Size of the list
+ * @return      Number of candidates, if greater than _u32Size, only _u32Size have been stored (unsorted) and the call should be repeated with a larger list
+ */
+extern orxDLLAPI orxU32 orxFASTCALL         orxObject_GetBoxCandidateList(const orxAABOX *_pstBox, orxSTRINGID _stGroupID, orxOBJECT **_apstObjectList, orxU32 _u32Size);
 /** @} */
 
 #endif /* _orxOBJECT_H_ */
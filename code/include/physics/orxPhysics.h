@@ -323,6 +323,7 @@ typedef struct __orxPHYSICS_BODY_JOINT_t              orxPHYSICS_BODY_JOINT;
 #define orxPHYSICS_KZ_CONFIG_SHOW_DEBUG               "ShowDebug"
 #define orxPHYSICS_KZ_CONFIG_COLLISION_FLAG_LIST      "CollisionFlagList"
 #define orxPHYSICS_KZ_CONFIG_INTERPOLATE              "Interpolate"
+#define orxPHYSICS_KZ_CONFIG_ASYNCHRONOUS             "Asynchronous"
 
 
 /***************************************************************************
@@ -91,6 +91,8 @@ typedef enum __orxPLUGIN_FUNCTION_BASE_ID_DISPLAY_t
   orxPLUGIN_FUNCTION_BASE_ID_DISPLAY_GET_VIDEO_MODE,
   orxPLUGIN_FUNCTION_BASE_ID_DISPLAY_SET_VIDEO_MODE,
   orxPLUGIN_FUNCTION_BASE_ID_DISPLAY_IS_VIDEO_MODE_AVAILABLE,
+  orxPLUGIN_FUNCTION_BASE_ID_DISPLAY_REQUEST_BITMAP_DATA,
+  orxPLUGIN_FUNCTION_BASE_ID_DISPLAY_SET_PARTIAL_BITMAP_DATA,
 
   orxPLUGIN_FUNCTION_BASE_ID_DISPLAY_NUMBER,
 
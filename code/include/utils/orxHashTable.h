@@ -57,7 +57,7 @@ typedef struct __orxHASHTABLE_t orxHASHTABLE;
 /** @name HashTable creation/destruction.
  * @{ */
 /** Create a new hash table and return it.
- * @param[in] _u32NbKey    Number of keys that will be inserted.
+ * @param[in] _u32NbKey    Number of keys that will be inserted (the table grows past it, unless created with orxHASHTABLE_KU32_FLAG_NOT_EXPANDABLE).
  * @param[in] _u32Flags    Flags used by the hash table
  * @param[in] _eMemType    Memory type to use
  * @return Returns the hashtable pointer or orxNULL if failed.
@@ -93,6 +93,7 @@ extern orxDLLAPI orxU32 orxFASTCALL             orxHashTable_GetCount(const orxH
 extern orxDLLAPI void *orxFASTCALL              orxHashTable_Get(const orxHASHTABLE *_pstHashTable, orxU64 _u64Key);
 
 /** Retrieves the bucket of an item in a hash table, if the item wasn't present, a new bucket will be created.
+ * The bucket is only valid until the next insertion or removal in the same hash table.
  * @param[in] _pstHashTable   Concerned hashtable
  * @param[in] _u64Key         Key to find
  * @return The bucket associated to the given key if success, orxNULL otherwise
@@ -129,6 +130,7 @@ extern orxDLLAPI orxSTATUS orxFASTCALL          orxHashTable_Remove(orxHASHTABLE
  * Used to iterate on all elements of the hashtable.
  * @{ */
 /** Gets the next item in the hashtable and returns an iterator for next search
+ * Removing the current item while iterating is safe, inserting new items isn't.
  * @param[in]   _pstHashTable   Concerned HashTable
  * @param[in]   _hIterator      Iterator from previous search or orxHANDLE_UNDEFINED/orxNULL for a new search
  * @param[out]  _pu64Key        Current element key
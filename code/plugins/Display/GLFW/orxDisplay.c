@@ -124,6 +124,9 @@
 #define orxDISPLAY_KU32_STATIC_FLAG_FULLSCREEN  0x00002000  /**< Full screen flag */
 #define orxDISPLAY_KU32_STATIC_FLAG_CUSTOM_IBO  0x00004000  /**< Custom IBO flag */
 #define orxDISPLAY_KU32_STATIC_FLAG_CONTROL_TEAR 0x00008000 /**< Swap control tear support flag */
+#define orxDISPLAY_KU32_STATIC_FLAG_MAP_VBO     0x00010000  /**< Mappable VBO support flag */
+#define orxDISPLAY_KU32_STATIC_FLAG_PERSISTENT_VBO 0x00020000 /**< Persistent VBO support flag */
+#define orxDISPLAY_KU32_STATIC_FLAG_ASYNC_READ  0x00040000  /**< Asynchronous pixel readback support flag */
 #define orxDISPLAY_KU32_STATIC_FLAG_VSYNC_FIX   0x10000000  /**< VSync fix flag */
 
 #define orxDISPLAY_KU32_STATIC_MASK_ALL         0xFFFFFFFF  /**< All mask */
@@ -142,6 +145,12 @@
 
 #define orxDISPLAY_KU32_VERTEX_BUFFER_SIZE      (4 * 16384) /**< 16384 items batch capacity */
 #define orxDISPLAY_KU32_INDEX_BUFFER_SIZE       (6 * 16384) /**< 16384 items batch capacity */
+#define orxDISPLAY_KU32_STREAM_SEGMENT_NUMBER   3           /**< Streaming VBO segment number, each segment holds a full batch */
+#define orxDISPLAY_KU32_STREAM_BUFFER_SIZE      (orxDISPLAY_KU32_STREAM_SEGMENT_NUMBER * orxDISPLAY_KU32_VERTEX_BUFFER_SIZE) /**< Streaming VBO capacity */
+#define orxDISPLAY_KU64_STREAM_FENCE_TIMEOUT    1000000000  /**< Streaming VBO fence timeout (ns) */
+#define orxDISPLAY_KU32_STREAM_FENCE_RETRY_NUMBER 4         /**< Streaming VBO fence wait retry number, before stalling the whole pipeline */
+#define orxDISPLAY_KU32_READBACK_NUMBER         8           /**< Maximum number of in-flight pixel readbacks */
+#define orxDISPLAY_KU64_READBACK_FENCE_TIMEOUT  1000000000  /**< Pixel readback fence timeout upon exit (ns) */
 #define orxDISPLAY_KU32_SHADER_BUFFER_SIZE      131072
 
 #define orxDISPLAY_KF_BORDER_FIX                0.1f
@@ -277,9 +286,40 @@ typedef struct __orxDISPLAY_SAVE_INFO_t
   orxU32  u32Width;
   orxU32  u32Height;
   orxSTRINGID stFilenameID;
+  orxSTRINGID stLocationID;
 
 } orxDISPLAY_SAVE_INFO;
 
+/** Internal bitmap read info structure
+ */
+typedef struct __orxDISPLAY_READ_INFO_t
+{
+  orxDISPLAY_READ_FUNCTION  pfnCallback;
+  void                     *pContext;
+  const orxBITMAP          *pstBitmap;
+  orxU8                    *au8Data;
+  orxU32                    u32ByteNumber;
+  orxSTRINGID               stLocationID;
+
+} orxDISPLAY_READ_INFO;
+
+/** Internal pixel readback structure
+ */
+typedef struct __orxDISPLAY_READBACK_t
+{
+  orxDISPLAY_READ_INFO     *pstInfo;
+#ifndef __orxMAC__
+  GLsync                    stFence;
+#endif /* __orxMAC__ */
+  GLuint                    uiBuffer;
+  orxU32                    u32Width;
+  orxU32                    u32Height;
+  orxU32                    u32RealWidth;
+  orxU32                    u32RealHeight;
+  orxBOOL                   bScreen;
+
+} orxDISPLAY_READBACK;
+
 /** Internal bitmap load info structure
  */
 typedef struct __orxDISPLAY_LOAD_INFO_t
@@ -288,6 +328,7 @@ typedef struct __orxDISPLAY_LOAD_INFO_t
   orxU8      *pu8ImageSource;
   orxS64      s64Size;
   orxBITMAP  *pstBitmap;
+  orxHANDLE   hResource;
   GLuint      uiWidth;
   GLuint      uiHeight;
   GLuint      uiRealWidth;
@@ -365,6 +406,11 @@ typedef struct __orxDISPLAY_STATIC_t
   GLuint                    uiVertexBuffer;
   GLuint                    uiIndexBuffer;
   orxS32                    s32BufferIndex;
+  orxS32                    s32StreamOffset;
+  orxS32                    s32StreamBase;
+  orxS32                    s32StreamSegment;
+  orxU32                    u32StreamFenceMask;
+  orxDISPLAY_GLFW_VERTEX   *astStreamBuffer;
   orxS32                    s32ElementNumber;
   orxU32                    u32Flags;
   orxU32                    u32Depth;
@@ -379,6 +425,10 @@ typedef struct __orxDISPLAY_STATIC_t
   orxBITMAP                *apstDestinationBitmapList[orxDISPLAY_KU32_MAX_TEXTURE_UNIT_NUMBER];
   const orxBITMAP          *apstBoundBitmapList[orxDISPLAY_KU32_MAX_TEXTURE_UNIT_NUMBER];
   orxDOUBLE                 adMRUBitmapList[orxDISPLAY_KU32_MAX_TEXTURE_UNIT_NUMBER];
+#ifndef __orxMAC__
+  GLsync                    astStreamFenceList[orxDISPLAY_KU32_STREAM_SEGMENT_NUMBER];
+#endif /* __orxMAC__ */
+  orxDISPLAY_READBACK       astReadbackList[orxDISPLAY_KU32_READBACK_NUMBER];
   orxDISPLAY_GLFW_VERTEX    astVertexList[orxDISPLAY_KU32_VERTEX_BUFFER_SIZE];
   GLushort                  au16IndexList[orxDISPLAY_KU32_INDEX_BUFFER_SIZE];
   orxCHAR                   acShaderCodeBuffer[orxDISPLAY_KU32_SHADER_BUFFER_SIZE];
@@ -419,6 +469,12 @@ PFNGLDELETEBUFFERSARBPROC           glDeleteBuffersARB          = NULL;
 PFNGLBINDBUFFERARBPROC              glBindBufferARB             = NULL;
 PFNGLBUFFERDATAARBPROC              glBufferDataARB             = NULL;
 PFNGLBUFFERSUBDATAARBPROC           glBufferSubDataARB          = NULL;
+PFNGLUNMAPBUFFERARBPROC             glUnmapBufferARB            = NULL;
+PFNGLMAPBUFFERRANGEPROC             glMapBufferRange            = NULL;
+PFNGLBUFFERSTORAGEPROC              glBufferStorage             = NULL;
+PFNGLFENCESYNCPROC                  glFenceSync                 = NULL;
+PFNGLCLIENTWAITSYNCPROC             glClientWaitSync            = NULL;
+PFNGLDELETESYNCPROC                 glDeleteSync                = NULL;
 
 PFNGLGENFRAMEBUFFERSEXTPROC         glGenFramebuffersEXT        = NULL;
 PFNGLDELETEFRAMEBUFFERSEXTPROC      glDeleteFramebuffersEXT     = NULL;
@@ -1101,6 +1157,65 @@ static orxINLINE void orxDisplay_GLFW_InitExtensions()
       orxFLAG_SET(sstDisplay.u32Flags, orxDISPLAY_KU32_STATIC_FLAG_NONE, orxDISPLAY_KU32_STATIC_FLAG_VBO);
     }
 
+#ifndef __orxMAC__
+
+    /* Can support mappable vertex buffer objects? */
+    if((orxFLAG_TEST(sstDisplay.u32Flags, orxDISPLAY_KU32_STATIC_FLAG_VBO))
+    && (glfwExtensionSupported("GL_ARB_map_buffer_range") != GLFW_FALSE))
+    {
+      /* Loads map buffer extension functions */
+      orxDISPLAY_LOAD_EXTENSION_FUNCTION(PFNGLMAPBUFFERRANGEPROC, glMapBufferRange);
+      orxDISPLAY_LOAD_EXTENSION_FUNCTION(PFNGLUNMAPBUFFERARBPROC, glUnmapBufferARB);
+
+      /* Updates status flags */
+      orxFLAG_SET(sstDisplay.u32Flags, orxDISPLAY_KU32_STATIC_FLAG_MAP_VBO, orxDISPLAY_KU32_STATIC_FLAG_NONE);
+
+      /* Can support persistent vertex buffer objects? */
+      if((glfwExtensionSupported("GL_ARB_buffer_storage") != GLFW_FALSE)
+      && (glfwExtensionSupported("GL_ARB_sync") != GLFW_FALSE))
+      {
+        /* Loads buffer storage & sync extension functions */
+        orxDISPLAY_LOAD_EXTENSION_FUNCTION(PFNGLBUFFERSTORAGEPROC, glBufferStorage);
+        orxDISPLAY_LOAD_EXTENSION_FUNCTION(PFNGLFENCESYNCPROC, glFenceSync);
+        orxDISPLAY_LOAD_EXTENSION_FUNCTION(PFNGLCLIENTWAITSYNCPROC, glClientWaitSync);
+        orxDISPLAY_LOAD_EXTENSION_FUNCTION(PFNGLDELETESYNCPROC, glDeleteSync);
+
+        /* Updates status flags */
+        orxFLAG_SET(sstDisplay.u32Flags, orxDISPLAY_KU32_STATIC_FLAG_PERSISTENT_VBO, orxDISPLAY_KU32_STATIC_FLAG_NONE);
+      }
+      else
+      {
+        /* Updates status flags */
+        orxFLAG_SET(sstDisplay.u32Flags, orxDISPLAY_KU32_STATIC_FLAG_NONE, orxDISPLAY_KU32_STATIC_FLAG_PERSISTENT_VBO);
+      }
+
+      /* Can support asynchronous pixel readback? */
+      if((glfwExtensionSupported("GL_ARB_pixel_buffer_object") != GLFW_FALSE)
+      && (glfwExtensionSupported("GL_ARB_sync") != GLFW_FALSE))
+      {
+        /* Loads sync extension functions */
+        orxDISPLAY_LOAD_EXTENSION_FUNCTION(PFNGLFENCESYNCPROC, glFenceSync);
+        orxDISPLAY_LOAD_EXTENSION_FUNCTION(PFNGLCLIENTWAITSYNCPROC, glClientWaitSync);
+        orxDISPLAY_LOAD_EXTENSION_FUNCTION(PFNGLDELETESYNCPROC, glDeleteSync);
+
+        /* Updates status flags */
+        orxFLAG_SET(sstDisplay.u32Flags, orxDISPLAY_KU32_STATIC_FLAG_ASYNC_READ, orxDISPLAY_KU32_STATIC_FLAG_NONE);
+      }
+      else
+      {
+        /* Updates status flags */
+        orxFLAG_SET(sstDisplay.u32Flags, orxDISPLAY_KU32_STATIC_FLAG_NONE, orxDISPLAY_KU32_STATIC_FLAG_ASYNC_READ);
+      }
+    }
+    else
+
+#endif /* __orxMAC__ */
+
+    {
+      /* Updates status flags */
+      orxFLAG_SET(sstDisplay.u32Flags, orxDISPLAY_KU32_STATIC_FLAG_NONE, orxDISPLAY_KU32_STATIC_FLAG_MAP_VBO | orxDISPLAY_KU32_STATIC_FLAG_PERSISTENT_VBO | orxDISPLAY_KU32_STATIC_FLAG_ASYNC_READ);
+    }
+
     /* Can support shader? */
     if((glfwExtensionSupported("GL_ARB_shader_objects") != GLFW_FALSE)
     && (glfwExtensionSupported("GL_ARB_shading_language_100") != GLFW_FALSE)
@@ -1396,6 +1511,8 @@ static orxSTATUS orxFASTCALL orxDisplay_GLFW_DecompressBitmapCallback(void *_pCo
       stPayload.stBitmap.zLocation      = pstInfo->pstBitmap->zLocation;
       stPayload.stBitmap.stFilenameID   = pstInfo->pstBitmap->stFilenameID;
       stPayload.stBitmap.u32ID          = (pstInfo->pu8ImageBuffer != orxNULL) ? (orxU32)pstInfo->pstBitmap->uiTexture : orxU32_UNDEFINED;
+      stPayload.stBitmap.au8Data        = pstInfo->pu8ImageBuffer;
+      stPayload.stBitmap.u32LineSize    = (orxU32)pstInfo->uiRealWidth * 4 * sizeof(orxU8);
 
       /* Sends event */
       orxEVENT_SEND(orxEVENT_TYPE_DISPLAY, orxDISPLAY_EVENT_LOAD_BITMAP, pstInfo->pstBitmap, orxNULL, &stPayload);
@@ -1443,6 +1560,13 @@ static orxSTATUS orxFASTCALL orxDisplay_GLFW_DecompressBitmapCallback(void *_pCo
     }
   }
 
+  /* Was mapped? */
+  if(pstInfo->hResource != orxHANDLE_UNDEFINED)
+  {
+    /* Closes resource */
+    orxResource_Close(pstInfo->hResource);
+  }
+
   /* Frees load info */
   orxMemory_Free(pstInfo);
 
@@ -1450,6 +1574,19 @@ static orxSTATUS orxFASTCALL orxDisplay_GLFW_DecompressBitmapCallback(void *_pCo
   return eResult;
 }
 
+static void orxFASTCALL orxDisplay_GLFW_ReleaseBitmapSource(orxDISPLAY_LOAD_INFO *_pstInfo)
+{
+  /* Not mapped? */
+  if(_pstInfo->hResource == orxHANDLE_UNDEFINED)
+  {
+    /* Frees it */
+    orxMemory_Free(_pstInfo->pu8ImageSource);
+  }
+
+  /* Done! */
+  return;
+}
+
 static orxSTATUS orxFASTCALL orxDisplay_GLFW_DecompressBitmap(void *_pContext)
 {
   orxDISPLAY_LOAD_INFO *pstInfo;
@@ -1518,8 +1655,8 @@ static orxSTATUS orxFASTCALL orxDisplay_GLFW_DecompressBitmap(void *_pContext)
         }
       }
 
-      /* Frees original source from resource */
-      orxMemory_Free(pstInfo->pu8ImageSource);
+      /* Releases original source from resource */
+      orxDisplay_GLFW_ReleaseBitmapSource(pstInfo);
 
       /* Stores uncompressed data as new source */
       pstInfo->pu8ImageSource = pu8ImageData;
@@ -1532,8 +1669,8 @@ static orxSTATUS orxFASTCALL orxDisplay_GLFW_DecompressBitmap(void *_pContext)
       pstInfo->uiRealWidth  =
       pstInfo->uiRealHeight = 1;
 
-      /* Frees original source from resource */
-      orxMemory_Free(pstInfo->pu8ImageSource);
+      /* Releases original source from resource */
+      orxDisplay_GLFW_ReleaseBitmapSource(pstInfo);
       pstInfo->pu8ImageSource = orxNULL;
     }
 
@@ -1542,12 +1679,16 @@ static orxSTATUS orxFASTCALL orxDisplay_GLFW_DecompressBitmap(void *_pContext)
   }
   else
   {
-    /* Frees original source from resource */
-    orxMemory_Free(pstInfo->pu8ImageSource);
+    /* Releases original source from resource */
+    orxDisplay_GLFW_ReleaseBitmapSource(pstInfo);
     pstInfo->pu8ImageSource = orxNULL;
 
-    /* Frees load info */
-    orxMemory_Free(pstInfo);
+    /* Was mapped? */
+    if(pstInfo->hResource != orxHANDLE_UNDEFINED)
+    {
+      /* Unmaps it, the resource will get closed from the main thread */
+      orxResource_Unmap(pstInfo->hResource);
+    }
 
     /* Updates result */
     eResult = orxSTATUS_FAILURE;
@@ -1560,7 +1701,28 @@ static orxSTATUS orxFASTCALL orxDisplay_GLFW_DecompressBitmap(void *_pContext)
   return eResult;
 }
 
-static void orxFASTCALL orxDisplay_GLFW_ReadResourceCallback(orxHANDLE _hResource, orxS64 _s64Size, void *_pBuffer, void *_pContext)
+static orxSTATUS orxFASTCALL orxDisplay_GLFW_DiscardBitmapCallback(void *_pContext)
+{
+  orxDISPLAY_LOAD_INFO *pstInfo;
+
+  /* Gets load info */
+  pstInfo = (orxDISPLAY_LOAD_INFO *)_pContext;
+
+  /* Was mapped? */
+  if(pstInfo->hResource != orxHANDLE_UNDEFINED)
+  {
+    /* Closes resource */
+    orxResource_Close(pstInfo->hResource);
+  }
+
+  /* Frees load info */
+  orxMemory_Free(pstInfo);
+
+  /* Done! */
+  return orxSTATUS_SUCCESS;
+}
+
+static void orxFASTCALL orxDisplay_GLFW_ProcessBitmapSource(orxHANDLE _hResource, orxS64 _s64Size, const orxU8 *_pu8Source, orxBITMAP *_pstBitmap, orxBOOL _bMapped)
 {
   orxDISPLAY_LOAD_INFO *pstInfo;
 
@@ -1572,18 +1734,22 @@ static void orxFASTCALL orxDisplay_GLFW_ReadResourceCallback(orxHANDLE _hResourc
 
   /* Inits it */
   orxMemory_Zero(pstInfo, sizeof(orxDISPLAY_LOAD_INFO));
-  pstInfo->pu8ImageSource = (orxU8 *)_pBuffer;
+  pstInfo->pu8ImageSource = (orxU8 *)_pu8Source;
   pstInfo->s64Size        = _s64Size;
-  pstInfo->pstBitmap      = (orxBITMAP *)_pContext;
+  pstInfo->pstBitmap      = _pstBitmap;
+  pstInfo->hResource      = (_bMapped != orxFALSE) ? _hResource : orxHANDLE_UNDEFINED;
 
   /* Asynchronous? */
   if(orxFLAG_TEST(pstInfo->pstBitmap->u32Flags, orxDISPLAY_KU32_BITMAP_FLAG_LOADING))
   {
     /* Runs asynchronous task */
-    if(orxThread_RunTask(&orxDisplay_GLFW_DecompressBitmap, orxDisplay_GLFW_DecompressBitmapCallback, orxNULL, (void *)pstInfo) == orxSTATUS_FAILURE)
+    if(orxThread_RunTask(&orxDisplay_GLFW_DecompressBitmap, orxDisplay_GLFW_DecompressBitmapCallback, orxDisplay_GLFW_DiscardBitmapCallback, (void *)pstInfo) == orxSTATUS_FAILURE)
     {
       /* Frees load info */
       orxMemory_Free(pstInfo);
+
+      /* Closes resource right away */
+      _bMapped = orxFALSE;
     }
   }
   else
@@ -1594,10 +1760,25 @@ static void orxFASTCALL orxDisplay_GLFW_ReadResourceCallback(orxHANDLE _hResourc
       /* Upload texture */
       orxDisplay_GLFW_DecompressBitmapCallback(pstInfo);
     }
+    else
+    {
+      /* Discards it */
+      orxDisplay_GLFW_DiscardBitmapCallback(pstInfo);
+    }
   }
 
-  /* Closes resource */
-  orxResource_Close(_hResource);
+  /* Not mapped? */
+  if(_bMapped == orxFALSE)
+  {
+    /* Closes resource, mapped ones get closed once decompressed */
+    orxResource_Close(_hResource);
+  }
+}
+
+static void orxFASTCALL orxDisplay_GLFW_ReadResourceCallback(orxHANDLE _hResource, orxS64 _s64Size, void *_pBuffer, void *_pContext)
+{
+  /* Processes read data */
+  orxDisplay_GLFW_ProcessBitmapSource(_hResource, _s64Size, (const orxU8 *)_pBuffer, (orxBITMAP *)_pContext, orxFALSE);
 }
 
 
@@ -1650,6 +1831,273 @@ static orxSTATUS orxFASTCALL orxDisplay_GLFW_SaveBitmapData(void *_pContext)
   return eResult;
 }
 
+static orxSTATUS orxFASTCALL orxDisplay_GLFW_NotifyBitmapData(void *_pContext)
+{
+  orxDISPLAY_READ_INFO *pstInfo;
+
+  /* Gets read info */
+  pstInfo = (orxDISPLAY_READ_INFO *)_pContext;
+
+  /* Calls callback */
+  pstInfo->pfnCallback(pstInfo->pstBitmap, pstInfo->u32ByteNumber, pstInfo->au8Data, pstInfo->pContext);
+
+  /* Deletes read info */
+  orxMemory_Free(pstInfo);
+
+  /* Done! */
+  return orxSTATUS_SUCCESS;
+}
+
+static void orxFASTCALL orxDisplay_GLFW_DispatchBitmapData(orxDISPLAY_READ_INFO *_pstInfo, orxBOOL _bDefer)
+{
+  /* Should defer or couldn't run notification task? */
+  if((_bDefer == orxFALSE)
+  || (orxThread_RunTask(orxNULL, &orxDisplay_GLFW_NotifyBitmapData, orxNULL, (void *)_pstInfo) == orxSTATUS_FAILURE))
+  {
+    /* Notifies right away */
+    orxDisplay_GLFW_NotifyBitmapData(_pstInfo);
+  }
+
+  /* Done! */
+  return;
+}
+
+#ifndef __orxMAC__
+
+static void orxFASTCALL orxDisplay_GLFW_CompleteReadback(orxDISPLAY_READBACK *_pstReadback, orxBOOL _bDefer)
+{
+  orxDISPLAY_READ_INFO *pstInfo;
+  const orxU8          *pu8Source;
+  orxU32                u32LineSize, u32RealLineSize, u32BufferSize;
+
+  /* Gets read info */
+  pstInfo = _pstReadback->pstInfo;
+
+  /* Gets line sizes */
+  u32LineSize     = _pstReadback->u32Width * 4 * sizeof(orxU8);
+  u32RealLineSize = _pstReadback->u32RealWidth * 4 * sizeof(orxU8);
+  u32BufferSize   = u32RealLineSize * _pstReadback->u32RealHeight;
+
+  /* Deletes fence */
+  glDeleteSync(_pstReadback->stFence);
+  glASSERT();
+  _pstReadback->stFence = NULL;
+
+  /* Maps pixel buffer */
+  glBindBufferARB(GL_PIXEL_PACK_BUFFER_ARB, _pstReadback->uiBuffer);
+  glASSERT();
+  pu8Source = (const orxU8 *)glMapBufferRange(GL_PIXEL_PACK_BUFFER_ARB, 0, u32BufferSize, GL_MAP_READ_BIT);
+  glASSERT();
+
+  /* Success? */
+  if(pu8Source != NULL)
+  {
+    orxU32 i, u32SrcOffset, u32DstOffset;
+
+    /* Screen? */
+    if(_pstReadback->bScreen != orxFALSE)
+    {
+      orxRGBA stOpaque;
+
+      /* Sets opaque pixel */
+      stOpaque = orx2RGBA(0x00, 0x00, 0x00, 0xFF);
+
+      /* For all lines, bottom-up */
+      for(i = 0, u32SrcOffset = 0, u32DstOffset = u32LineSize * (_pstReadback->u32Height - 1);
+          i < _pstReadback->u32Height;
+          i++, u32SrcOffset += u32RealLineSize, u32DstOffset -= u32LineSize)
+      {
+        orxU32 j;
+
+        /* For all columns */
+        for(j = 0; j < _pstReadback->u32Width; j++)
+        {
+          orxRGBA stPixel;
+
+          /* Gets opaque pixel */
+          stPixel.u32RGBA = ((const orxRGBA *)(pu8Source + u32SrcOffset))[j].u32RGBA | stOpaque.u32RGBA;
+
+          /* Stores it */
+          ((orxRGBA *)(pstInfo->au8Data + u32DstOffset))[j] = stPixel;
+        }
+      }
+    }
+    else
+    {
+      /* For all lines */
+      for(i = 0, u32SrcOffset = 0, u32DstOffset = 0;
+          i < _pstReadback->u32Height;
+          i++, u32SrcOffset += u32RealLineSize, u32DstOffset += u32LineSize)
+      {
+        /* Copies data */
+        orxMemory_Copy(pstInfo->au8Data + u32DstOffset, pu8Source + u32SrcOffset, u32LineSize);
+      }
+    }
+
+    /* Unmaps pixel buffer */
+    glUnmapBufferARB(GL_PIXEL_PACK_BUFFER_ARB);
+    glASSERT();
+  }
+  else
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "Can't get bitmap data for [%s]: couldn't map pixel buffer.", orxString_GetFromID(pstInfo->stLocationID));
+
+    /* Reports failure */
+    pstInfo->u32ByteNumber = 0;
+  }
+
+  /* Unbinds pixel buffer */
+  glBindBufferARB(GL_PIXEL_PACK_BUFFER_ARB, 0);
+  glASSERT();
+
+  /* Frees readback */
+  _pstReadback->pstInfo = orxNULL;
+
+  /* Dispatches result */
+  orxDisplay_GLFW_DispatchBitmapData(pstInfo, _bDefer);
+
+  /* Done! */
+  return;
+}
+
+#endif /* __orxMAC__ */
+
+static void orxFASTCALL orxDisplay_GLFW_SaveBitmapCallback(const orxBITMAP *_pstBitmap, orxU32 _u32ByteNumber, orxU8 *_au8Data, void *_pContext)
+{
+  orxDISPLAY_SAVE_INFO *pstInfo;
+
+  /* Gets save info */
+  pstInfo = (orxDISPLAY_SAVE_INFO *)_pContext;
+
+  /* Failure or couldn't run asynchronous encoding task? */
+  if((_u32ByteNumber == 0)
+  || (orxThread_RunTask(&orxDisplay_GLFW_SaveBitmapData, orxNULL, orxNULL, (void *)pstInfo) == orxSTATUS_FAILURE))
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "Can't save bitmap [%s] to <%s>.", orxString_GetFromID(pstInfo->stLocationID), orxString_GetFromID(pstInfo->stFilenameID));
+
+    /* Deletes data */
+    orxMemory_Free(_au8Data);
+
+    /* Deletes save info */
+    orxMemory_Free(pstInfo);
+  }
+
+  /* Done! */
+  return;
+}
+
+static void orxFASTCALL orxDisplay_GLFW_UpdateReadbacks(orxBOOL _bFlush)
+{
+#ifndef __orxMAC__
+
+  /* Has asynchronous readback support? */
+  if(orxFLAG_TEST(sstDisplay.u32Flags, orxDISPLAY_KU32_STATIC_FLAG_ASYNC_READ))
+  {
+    orxU32 i;
+
+    /* For all readbacks */
+    for(i = 0; i < orxDISPLAY_KU32_READBACK_NUMBER; i++)
+    {
+      orxDISPLAY_READBACK *pstReadback;
+
+      /* Gets it */
+      pstReadback = &(sstDisplay.astReadbackList[i]);
+
+      /* In flight? */
+      if(pstReadback->pstInfo != orxNULL)
+      {
+        GLenum eStatus;
+
+        /* Polls its fence, waiting for it when flushing */
+        eStatus = (_bFlush != orxFALSE) ? glClientWaitSync(pstReadback->stFence, GL_SYNC_FLUSH_COMMANDS_BIT, orxDISPLAY_KU64_READBACK_FENCE_TIMEOUT) : glClientWaitSync(pstReadback->stFence, 0, 0);
+        glASSERT();
+
+        /* Done or flushing? */
+        if((eStatus == GL_ALREADY_SIGNALED) || (eStatus == GL_CONDITION_SATISFIED) || (_bFlush != orxFALSE))
+        {
+          /* Completes it, notifying right away when flushing */
+          orxDisplay_GLFW_CompleteReadback(pstReadback, (_bFlush != orxFALSE) ? orxFALSE : orxTRUE);
+        }
+      }
+
+      /* Flushing and has buffer? */
+      if((_bFlush != orxFALSE) && (pstReadback->uiBuffer != 0))
+      {
+        /* Deletes it */
+        glDeleteBuffersARB(1, &(pstReadback->uiBuffer));
+        glASSERT();
+        pstReadback->uiBuffer = 0;
+      }
+    }
+  }
+
+#endif /* __orxMAC__ */
+
+  /* Done! */
+  return;
+}
+
+static void orxFASTCALL orxDisplay_GLFW_FlushBitmapReadbacks(const orxBITMAP *_pstBitmap)
+{
+#ifndef __orxMAC__
+
+  /* Has asynchronous readback support? */
+  if(orxFLAG_TEST(sstDisplay.u32Flags, orxDISPLAY_KU32_STATIC_FLAG_ASYNC_READ))
+  {
+    orxU32 i;
+
+    /* For all readbacks */
+    for(i = 0; i < orxDISPLAY_KU32_READBACK_NUMBER; i++)
+    {
+      orxDISPLAY_READBACK *pstReadback;
+
+      /* Gets it */
+      pstReadback = &(sstDisplay.astReadbackList[i]);
+
+      /* In flight for this bitmap? */
+      if((pstReadback->pstInfo != orxNULL)
+      && (pstReadback->pstInfo->pstBitmap == _pstBitmap))
+      {
+        /* Waits for its fence */
+        glClientWaitSync(pstReadback->stFence, GL_SYNC_FLUSH_COMMANDS_BIT, orxDISPLAY_KU64_READBACK_FENCE_TIMEOUT);
+        glASSERT();
+
+        /* Completes it, notifying right away while the bitmap is still valid */
+        orxDisplay_GLFW_CompleteReadback(pstReadback, orxFALSE);
+      }
+    }
+  }
+
+#endif /* __orxMAC__ */
+
+  /* Done! */
+  return;
+}
+
+static void orxFASTCALL orxDisplay_GLFW_InitLoadingBitmap(orxBITMAP *_pstBitmap, int _iWidth, int _iHeight)
+{
+  /* Not a cursor nor an icon? */
+  if(!orxFLAG_TEST(_pstBitmap->u32Flags, orxDISPLAY_KU32_BITMAP_FLAG_CURSOR | orxDISPLAY_KU32_BITMAP_FLAG_ICON))
+  {
+    /* Inits bitmap info using temp */
+    _pstBitmap->uiTexture       = sstDisplay.pstTempBitmap->uiTexture;
+    _pstBitmap->fWidth          = orxS2F(_iWidth);
+    _pstBitmap->fHeight         = orxS2F(_iHeight);
+    _pstBitmap->u32RealWidth    = sstDisplay.pstTempBitmap->u32RealWidth;
+    _pstBitmap->u32RealHeight   = sstDisplay.pstTempBitmap->u32RealHeight;
+    _pstBitmap->u32Depth        = sstDisplay.pstTempBitmap->u32Depth;
+    _pstBitmap->fRecRealWidth   = sstDisplay.pstTempBitmap->fRecRealWidth;
+    _pstBitmap->fRecRealHeight  = sstDisplay.pstTempBitmap->fRecRealHeight;
+    _pstBitmap->u32DataSize     = sstDisplay.pstTempBitmap->u32DataSize;
+    orxVector_Copy(&(_pstBitmap->stClip.vTL), &(sstDisplay.pstTempBitmap->stClip.vTL));
+    orxVector_Copy(&(_pstBitmap->stClip.vBR), &(sstDisplay.pstTempBitmap->stClip.vBR));
+  }
+
+  /* Done! */
+  return;
+}
 
 static orxSTATUS orxFASTCALL orxDisplay_GLFW_LoadBitmapData(orxBITMAP *_pstBitmap)
 {
@@ -1662,26 +2110,72 @@ static orxSTATUS orxFASTCALL orxDisplay_GLFW_LoadBitmapData(orxBITMAP *_pstBitma
   /* Success? */
   if(hResource != orxHANDLE_UNDEFINED)
   {
-    orxS64  s64Size;
-    orxU8  *pu8Buffer;
+    const orxU8  *pu8Source;
+    orxS64        s64Size;
 
-    /* Gets its size */
-    s64Size = orxResource_GetSize(hResource);
-
-    /* Checks */
-    orxASSERT((s64Size > 0) && (s64Size < 0xFFFFFFFF));
-
-    /* Allocates buffer */
-    pu8Buffer = (orxU8 *)orxMemory_Allocate((orxU32)s64Size, orxMEMORY_TYPE_MAIN);
+    /* Maps it: when loading synchronously, its content gets copied if it can't be mapped */
+    pu8Source = (const orxU8 *)orxResource_Map(hResource, (sstDisplay.pstTempBitmap == orxNULL) ? orxTRUE : orxFALSE, &s64Size);
 
     /* Success? */
-    if(pu8Buffer != orxNULL)
+    if(pu8Source != orxNULL)
     {
+      /* Checks */
+      orxASSERT((s64Size > 0) && (s64Size < 0x7FFFFFFF));
+
       /* Asynchronous? */
       if(sstDisplay.pstTempBitmap != orxNULL)
       {
         int iWidth, iHeight, iComp;
 
+        /* Gets its info */
+        if(stbi_info_from_memory((const unsigned char *)pu8Source, (int)s64Size, &iWidth, &iHeight, &iComp) != 0)
+        {
+          /* Updates asynchronous loading flag */
+          orxFLAG_SET(_pstBitmap->u32Flags, orxDISPLAY_KU32_BITMAP_FLAG_LOADING, orxDISPLAY_KU32_BITMAP_FLAG_NONE);
+
+          /* Decompresses it straight from the mapped data */
+          orxDisplay_GLFW_ProcessBitmapSource(hResource, s64Size, pu8Source, _pstBitmap, orxTRUE);
+
+          /* Inits bitmap info */
+          orxDisplay_GLFW_InitLoadingBitmap(_pstBitmap, iWidth, iHeight);
+
+          /* Updates result */
+          eResult = orxSTATUS_SUCCESS;
+        }
+        else
+        {
+          /* Closes resource */
+          orxResource_Close(hResource);
+        }
+      }
+      else
+      {
+        /* Processes data */
+        orxDisplay_GLFW_ProcessBitmapSource(hResource, s64Size, pu8Source, _pstBitmap, orxTRUE);
+
+        /* Updates result */
+        eResult = orxSTATUS_SUCCESS;
+      }
+    }
+    /* Asynchronous? */
+    else if(sstDisplay.pstTempBitmap != orxNULL)
+    {
+      orxU8 *pu8Buffer;
+
+      /* Gets its size */
+      s64Size = orxResource_GetSize(hResource);
+
+      /* Checks */
+      orxASSERT((s64Size > 0) && (s64Size < 0xFFFFFFFF));
+
+      /* Allocates buffer */
+      pu8Buffer = (orxU8 *)orxMemory_Allocate((orxU32)s64Size, orxMEMORY_TYPE_MAIN);
+
+      /* Success? */
+      if(pu8Buffer != orxNULL)
+      {
+        int iWidth, iHeight, iComp;
+
         /* Gets its info */
         if(stbi_info_from_callbacks(&(sstDisplay.stSTBICallbacks), (void *)hResource, &iWidth, &iHeight, &iComp) != 0)
         {
@@ -1697,22 +2191,8 @@ static orxSTATUS orxFASTCALL orxDisplay_GLFW_LoadBitmapData(orxBITMAP *_pstBitma
           /* Successful asynchronous call? */
           if(s64Size < 0)
           {
-            /* Not a cursor nor an icon? */
-            if(!orxFLAG_TEST(_pstBitmap->u32Flags, orxDISPLAY_KU32_BITMAP_FLAG_CURSOR | orxDISPLAY_KU32_BITMAP_FLAG_ICON))
-            {
-              /* Inits bitmap info using temp */
-              _pstBitmap->uiTexture       = sstDisplay.pstTempBitmap->uiTexture;
-              _pstBitmap->fWidth          = orxS2F(iWidth);
-              _pstBitmap->fHeight         = orxS2F(iHeight);
-              _pstBitmap->u32RealWidth    = sstDisplay.pstTempBitmap->u32RealWidth;
-              _pstBitmap->u32RealHeight   = sstDisplay.pstTempBitmap->u32RealHeight;
-              _pstBitmap->u32Depth        = sstDisplay.pstTempBitmap->u32Depth;
-              _pstBitmap->fRecRealWidth   = sstDisplay.pstTempBitmap->fRecRealWidth;
-              _pstBitmap->fRecRealHeight  = sstDisplay.pstTempBitmap->fRecRealHeight;
-              _pstBitmap->u32DataSize     = sstDisplay.pstTempBitmap->u32DataSize;
-              orxVector_Copy(&(_pstBitmap->stClip.vTL), &(sstDisplay.pstTempBitmap->stClip.vTL));
-              orxVector_Copy(&(_pstBitmap->stClip.vBR), &(sstDisplay.pstTempBitmap->stClip.vBR));
-            }
+            /* Inits bitmap info */
+            orxDisplay_GLFW_InitLoadingBitmap(_pstBitmap, iWidth, iHeight);
 
             /* Updates result */
             eResult = orxSTATUS_SUCCESS;
@@ -1737,26 +2217,8 @@ static orxSTATUS orxFASTCALL orxDisplay_GLFW_LoadBitmapData(orxBITMAP *_pstBitma
       }
       else
       {
-        /* Loads data from resource */
-        s64Size = orxResource_Read(hResource, s64Size, pu8Buffer, orxNULL, orxNULL);
-
-        /* Success? */
-        if(s64Size != 0)
-        {
-          /* Processes data */
-          orxDisplay_GLFW_ReadResourceCallback(hResource, s64Size, (void *)pu8Buffer, (void *)_pstBitmap);
-
-          /* Updates result */
-          eResult = orxSTATUS_SUCCESS;
-        }
-        else
-        {
-          /* Frees buffer */
-          orxMemory_Free(pu8Buffer);
-
-          /* Closes resource */
-          orxResource_Close(hResource);
-        }
+        /* Closes resource */
+        orxResource_Close(hResource);
       }
     }
     else
@@ -1876,92 +2338,347 @@ static orxSTATUS orxFASTCALL orxDisplay_GLFW_CompileShader(orxDISPLAY_SHADER *_p
         _pstShader->hProgram      = hProgram;
         _pstShader->iTextureCount = 0;
 
-        /* Updates result */
-        eResult = orxSTATUS_SUCCESS;
-      }
-      else
-      {
-        orxCHAR acBuffer[1024];
+        /* Updates result */
+        eResult = orxSTATUS_SUCCESS;
+      }
+      else
+      {
+        orxCHAR acBuffer[1024];
+
+        /* Gets log */
+        glGetInfoLogARB(hProgram, sizeof(acBuffer) - 1, NULL, (GLcharARB *)acBuffer);
+        glASSERT();
+        acBuffer[sizeof(acBuffer) - 1] = orxCHAR_NULL;
+
+        /* Outputs log */
+        orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "Couldn't link shader program:%s%s%s", orxSTRING_EOL, acBuffer, orxSTRING_EOL);
+
+        /* Deletes program */
+        glDeleteObjectARB(hProgram);
+        glASSERT();
+      }
+    }
+    else
+    {
+      orxCHAR acBuffer[1024];
+
+      /* Gets log */
+      glGetInfoLogARB(hFragmentShader, sizeof(acBuffer) - 1, NULL, (GLcharARB *)acBuffer);
+      glASSERT();
+      acBuffer[sizeof(acBuffer) - 1] = orxCHAR_NULL;
+
+      /* Outputs log */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "Couldn't compile fragment shader:%s%s%s", orxSTRING_EOL, acBuffer, orxSTRING_EOL);
+
+      /* Deletes shader objects & program */
+      glDeleteObjectARB(hVertexShader);
+      glASSERT();
+      glDeleteObjectARB(hFragmentShader);
+      glASSERT();
+      glDeleteObjectARB(hProgram);
+      glASSERT();
+    }
+  }
+  else
+  {
+    orxCHAR acBuffer[1024];
+
+    /* Gets log */
+    glGetInfoLogARB(hVertexShader, sizeof(acBuffer) - 1, NULL, (GLcharARB *)acBuffer);
+    glASSERT();
+    acBuffer[sizeof(acBuffer) - 1] = orxCHAR_NULL;
+
+    /* Outputs log */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "Couldn't compile vertex shader:%s%s%s", orxSTRING_EOL, acBuffer, orxSTRING_EOL);
+
+    /* Deletes shader objects & program */
+    glDeleteObjectARB(hVertexShader);
+    glASSERT();
+    glDeleteObjectARB(hFragmentShader);
+    glASSERT();
+    glDeleteObjectARB(hProgram);
+    glASSERT();
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+static void orxFASTCALL orxDisplay_GLFW_InitShader(orxDISPLAY_SHADER *_pstShader)
+{
+  /* Uses its program */
+  glUseProgramObjectARB(_pstShader->hProgram);
+  glASSERT();
+
+  /* Has custom textures? */
+  if(_pstShader->iTextureCount > 0)
+  {
+    GLint i;
+
+    /* For all defined textures */
+    for(i = 0; i < _pstShader->iTextureCount; i++)
+    {
+      /* Binds bitmap */
+      orxDisplay_GLFW_BindBitmap(_pstShader->astTextureInfoList[i].pstBitmap);
+
+      /* Updates shader uniform */
+      glUNIFORM(1iARB, _pstShader->astTextureInfoList[i].iLocation, sstDisplay.s32ActiveTextureUnit);
+    }
+  }
+
+  /* Done! */
+  return;
+}
+
+static void orxFASTCALL orxDisplay_GLFW_InitStreamBuffer()
+{
+  /* Clears streaming status */
+  sstDisplay.s32StreamOffset    = 0;
+  sstDisplay.s32StreamBase      = 0;
+  sstDisplay.s32StreamSegment   = 0;
+  sstDisplay.u32StreamFenceMask = 0;
+  sstDisplay.astStreamBuffer    = orxNULL;
+
+#ifndef __orxMAC__
+
+  /* Has persistent VBO support? */
+  if(orxFLAG_TEST(sstDisplay.u32Flags, orxDISPLAY_KU32_STATIC_FLAG_PERSISTENT_VBO))
+  {
+    /* Inits immutable storage */
+    glBufferStorage(GL_ARRAY_BUFFER_ARB, orxDISPLAY_KU32_STREAM_BUFFER_SIZE * sizeof(orxDISPLAY_GLFW_VERTEX), NULL, GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT);
+    glASSERT();
+
+    /* Maps it once for all */
+    sstDisplay.astStreamBuffer = (orxDISPLAY_GLFW_VERTEX *)glMapBufferRange(GL_ARRAY_BUFFER_ARB, 0, orxDISPLAY_KU32_STREAM_BUFFER_SIZE * sizeof(orxDISPLAY_GLFW_VERTEX), GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT);
+    glASSERT();
+
+    /* Failure? */
+    if(sstDisplay.astStreamBuffer == orxNULL)
+    {
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "Couldn't map persistent vertex buffer, falling back to regular streaming.");
+
+      /* Updates status flags */
+      orxFLAG_SET(sstDisplay.u32Flags, orxDISPLAY_KU32_STATIC_FLAG_NONE, orxDISPLAY_KU32_STATIC_FLAG_PERSISTENT_VBO);
+
+      /* Re-creates VBO as its storage is immutable */
+      glDeleteBuffersARB(1, &(sstDisplay.uiVertexBuffer));
+      glASSERT();
+      glGenBuffersARB(1, &(sstDisplay.uiVertexBuffer));
+      glASSERT();
+      glBindBufferARB(GL_ARRAY_BUFFER_ARB, sstDisplay.uiVertexBuffer);
+      glASSERT();
+    }
+  }
+
+  /* No persistent VBO? */
+  if(!orxFLAG_TEST(sstDisplay.u32Flags, orxDISPLAY_KU32_STATIC_FLAG_PERSISTENT_VBO))
+
+#endif /* __orxMAC__ */
+
+  {
+    /* Inits VBO */
+    glBufferDataARB(GL_ARRAY_BUFFER_ARB, orxDISPLAY_KU32_STREAM_BUFFER_SIZE * sizeof(orxDISPLAY_GLFW_VERTEX), NULL, GL_STREAM_DRAW_ARB);
+    glASSERT();
+  }
+
+  /* Done! */
+  return;
+}
+
+static void orxFASTCALL orxDisplay_GLFW_ExitStreamBuffer()
+{
+#ifndef __orxMAC__
+
+  orxU32 i;
+
+  /* For all segments */
+  for(i = 0; i < orxDISPLAY_KU32_STREAM_SEGMENT_NUMBER; i++)
+  {
+    /* Has fence? */
+    if(sstDisplay.astStreamFenceList[i] != NULL)
+    {
+      /* Deletes it */
+      glDeleteSync(sstDisplay.astStreamFenceList[i]);
+      glASSERT();
+      sstDisplay.astStreamFenceList[i] = NULL;
+    }
+  }
+
+  /* Is persistently mapped? */
+  if(sstDisplay.astStreamBuffer != orxNULL)
+  {
+    /* Unmaps it */
+    glBindBufferARB(GL_ARRAY_BUFFER_ARB, sstDisplay.uiVertexBuffer);
+    glASSERT();
+    glUnmapBufferARB(GL_ARRAY_BUFFER_ARB);
+    glASSERT();
+    sstDisplay.astStreamBuffer = orxNULL;
+  }
+
+#endif /* __orxMAC__ */
+
+  /* Clears streaming status */
+  sstDisplay.u32StreamFenceMask = 0;
+
+  /* Done! */
+  return;
+}
+
+#ifndef __orxMAC__
+
+static void orxFASTCALL orxDisplay_GLFW_WaitStreamFence(orxS32 _s32Segment)
+{
+  GLenum  eStatus;
+  orxU32  i;
+
+  /* Waits for the GPU to be done with the segment, usually frames ago, retrying upon timeout */
+  for(i = 0, eStatus = GL_TIMEOUT_EXPIRED;
+      (i < orxDISPLAY_KU32_STREAM_FENCE_RETRY_NUMBER) && (eStatus == GL_TIMEOUT_EXPIRED);
+      i++)
+  {
+    eStatus = glClientWaitSync(sstDisplay.astStreamFenceList[_s32Segment], (i == 0) ? GL_SYNC_FLUSH_COMMANDS_BIT : 0, orxDISPLAY_KU64_STREAM_FENCE_TIMEOUT);
+    glASSERT();
+  }
+
+  /* Failed or timed out? */
+  if((eStatus != GL_ALREADY_SIGNALED) && (eStatus != GL_CONDITION_SATISFIED))
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "Couldn't wait for streaming vertex buffer segment #%d (%s), stalling the pipeline.", _s32Segment, (eStatus == GL_WAIT_FAILED) ? "wait failed" : "timeout");
+
+    /* Waits for all commands to be completed before overwriting it */
+    glFinish();
+    glASSERT();
+  }
+
+  /* Deletes fence */
+  glDeleteSync(sstDisplay.astStreamFenceList[_s32Segment]);
+  glASSERT();
+  sstDisplay.astStreamFenceList[_s32Segment] = NULL;
+
+  /* Done! */
+  return;
+}
+
+#endif /* __orxMAC__ */
+
+static void orxFASTCALL orxDisplay_GLFW_StreamVertices(const orxDISPLAY_GLFW_VERTEX *_astVertexList, orxS32 _s32VertexNumber)
+{
+  orxS32 s32Offset;
 
-        /* Gets log */
-        glGetInfoLogARB(hProgram, sizeof(acBuffer) - 1, NULL, (GLcharARB *)acBuffer);
-        glASSERT();
-        acBuffer[sizeof(acBuffer) - 1] = orxCHAR_NULL;
+  /* Checks */
+  orxASSERT(orxFLAG_TEST(sstDisplay.u32Flags, orxDISPLAY_KU32_STATIC_FLAG_VBO));
+  orxASSERT((_s32VertexNumber > 0) && (_s32VertexNumber <= orxDISPLAY_KU32_VERTEX_BUFFER_SIZE));
 
-        /* Outputs log */
-        orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "Couldn't link shader program:%s%s%s", orxSTRING_EOL, acBuffer, orxSTRING_EOL);
+  /* Gets write offset, wrapping around when there isn't enough room left */
+  s32Offset = (sstDisplay.s32StreamOffset + _s32VertexNumber <= orxDISPLAY_KU32_STREAM_BUFFER_SIZE) ? sstDisplay.s32StreamOffset : 0;
 
-        /* Deletes program */
-        glDeleteObjectARB(hProgram);
+#ifndef __orxMAC__
+
+  /* Persistent? */
+  if(orxFLAG_TEST(sstDisplay.u32Flags, orxDISPLAY_KU32_STATIC_FLAG_PERSISTENT_VBO))
+  {
+    orxS32 s32Segment, s32LastSegment;
+
+    /* For all segments left by the previous batch, whose draw has now been issued */
+    for(s32Segment = 0; sstDisplay.u32StreamFenceMask != 0; s32Segment++, sstDisplay.u32StreamFenceMask >>= 1)
+    {
+      /* Left and not fenced yet? */
+      if((sstDisplay.u32StreamFenceMask & 1)
+      && (sstDisplay.astStreamFenceList[s32Segment] == NULL))
+      {
+        /* Fences all the draws issued from it */
+        sstDisplay.astStreamFenceList[s32Segment] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
         glASSERT();
       }
     }
-    else
+
+    /* For all segments touched by this batch */
+    for(s32Segment = s32Offset / orxDISPLAY_KU32_VERTEX_BUFFER_SIZE, s32LastSegment = (s32Offset + _s32VertexNumber - 1) / orxDISPLAY_KU32_VERTEX_BUFFER_SIZE;
+        s32Segment <= s32LastSegment;
+        s32Segment++)
     {
-      orxCHAR acBuffer[1024];
+      /* Entering it? */
+      if(s32Segment != sstDisplay.s32StreamSegment)
+      {
+        /* Fences the segment we're leaving once this batch's draw has been issued, as it might still read from it */
+        sstDisplay.u32StreamFenceMask |= 1 << sstDisplay.s32StreamSegment;
 
-      /* Gets log */
-      glGetInfoLogARB(hFragmentShader, sizeof(acBuffer) - 1, NULL, (GLcharARB *)acBuffer);
-      glASSERT();
-      acBuffer[sizeof(acBuffer) - 1] = orxCHAR_NULL;
+        /* Was it still in flight? */
+        if(sstDisplay.astStreamFenceList[s32Segment] != NULL)
+        {
+          /* Waits for it */
+          orxDisplay_GLFW_WaitStreamFence(s32Segment);
+        }
 
-      /* Outputs log */
-      orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "Couldn't compile fragment shader:%s%s%s", orxSTRING_EOL, acBuffer, orxSTRING_EOL);
+        /* Updates current segment */
+        sstDisplay.s32StreamSegment = s32Segment;
+      }
+    }
 
-      /* Deletes shader objects & program */
-      glDeleteObjectARB(hVertexShader);
-      glASSERT();
-      glDeleteObjectARB(hFragmentShader);
-      glASSERT();
-      glDeleteObjectARB(hProgram);
+    /* Copies vertices */
+    orxMemory_Copy(sstDisplay.astStreamBuffer + s32Offset, _astVertexList, _s32VertexNumber * sizeof(orxDISPLAY_GLFW_VERTEX));
+  }
+  /* Mappable? */
+  else if(orxFLAG_TEST(sstDisplay.u32Flags, orxDISPLAY_KU32_STATIC_FLAG_MAP_VBO))
+  {
+    GLvoid *pBuffer;
+
+    /* Maps range, orphaning the whole buffer when starting over, without synchronizing when appending */
+    pBuffer = glMapBufferRange(GL_ARRAY_BUFFER_ARB, s32Offset * sizeof(orxDISPLAY_GLFW_VERTEX), _s32VertexNumber * sizeof(orxDISPLAY_GLFW_VERTEX), GL_MAP_WRITE_BIT | GL_MAP_UNSYNCHRONIZED_BIT | ((s32Offset == 0) ? GL_MAP_INVALIDATE_BUFFER_BIT : GL_MAP_INVALIDATE_RANGE_BIT));
+    glASSERT();
+
+    /* Success? */
+    if(pBuffer != NULL)
+    {
+      /* Copies vertices */
+      orxMemory_Copy(pBuffer, _astVertexList, _s32VertexNumber * sizeof(orxDISPLAY_GLFW_VERTEX));
+
+      /* Unmaps it */
+      glUnmapBufferARB(GL_ARRAY_BUFFER_ARB);
       glASSERT();
     }
   }
   else
-  {
-    orxCHAR acBuffer[1024];
 
-    /* Gets log */
-    glGetInfoLogARB(hVertexShader, sizeof(acBuffer) - 1, NULL, (GLcharARB *)acBuffer);
-    glASSERT();
-    acBuffer[sizeof(acBuffer) - 1] = orxCHAR_NULL;
+#endif /* __orxMAC__ */
 
-    /* Outputs log */
-    orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "Couldn't compile vertex shader:%s%s%s", orxSTRING_EOL, acBuffer, orxSTRING_EOL);
+  {
+    /* Starting over? */
+    if(s32Offset == 0)
+    {
+      /* Orphans buffer */
+      glBufferDataARB(GL_ARRAY_BUFFER_ARB, orxDISPLAY_KU32_STREAM_BUFFER_SIZE * sizeof(orxDISPLAY_GLFW_VERTEX), NULL, GL_STREAM_DRAW_ARB);
+      glASSERT();
+    }
 
-    /* Deletes shader objects & program */
-    glDeleteObjectARB(hVertexShader);
-    glASSERT();
-    glDeleteObjectARB(hFragmentShader);
-    glASSERT();
-    glDeleteObjectARB(hProgram);
+    /* Copies vertices */
+    glBufferSubDataARB(GL_ARRAY_BUFFER_ARB, s32Offset * sizeof(orxDISPLAY_GLFW_VERTEX), _s32VertexNumber * sizeof(orxDISPLAY_GLFW_VERTEX), _astVertexList);
     glASSERT();
   }
 
-  /* Done! */
-  return eResult;
-}
-
-static void orxFASTCALL orxDisplay_GLFW_InitShader(orxDISPLAY_SHADER *_pstShader)
-{
-  /* Uses its program */
-  glUseProgramObjectARB(_pstShader->hProgram);
-  glASSERT();
+  /* Updates write offset */
+  sstDisplay.s32StreamOffset = s32Offset + _s32VertexNumber;
 
-  /* Has custom textures? */
-  if(_pstShader->iTextureCount > 0)
+  /* New base? */
+  if(s32Offset != sstDisplay.s32StreamBase)
   {
-    GLint i;
+    size_t sBase;
 
-    /* For all defined textures */
-    for(i = 0; i < _pstShader->iTextureCount; i++)
-    {
-      /* Binds bitmap */
-      orxDisplay_GLFW_BindBitmap(_pstShader->astTextureInfoList[i].pstBitmap);
+    /* Gets its byte offset */
+    sBase = (size_t)s32Offset * sizeof(orxDISPLAY_GLFW_VERTEX);
 
-      /* Updates shader uniform */
-      glUNIFORM(1iARB, _pstShader->astTextureInfoList[i].iLocation, sstDisplay.s32ActiveTextureUnit);
-    }
+    /* Selects arrays at this base, indices remain relative to the batch */
+    glVertexPointer(2, GL_FLOAT, sizeof(orxDISPLAY_VERTEX), (GLvoid *)(sBase + offsetof(orxDISPLAY_GLFW_VERTEX, fX)));
+    glASSERT();
+    glTexCoordPointer(2, GL_FLOAT, sizeof(orxDISPLAY_VERTEX), (GLvoid *)(sBase + offsetof(orxDISPLAY_GLFW_VERTEX, fU)));
+    glASSERT();
+    glColorPointer(4, GL_UNSIGNED_BYTE, sizeof(orxDISPLAY_VERTEX), (GLvoid *)(sBase + offsetof(orxDISPLAY_GLFW_VERTEX, stRGBA)));
+    glASSERT();
+
+    /* Stores it */
+    sstDisplay.s32StreamBase = s32Offset;
   }
 
   /* Done! */
@@ -1987,9 +2704,8 @@ static void orxFASTCALL orxDisplay_GLFW_DrawArrays()
       /* Indirect mode? */
       if(sstDisplay.eLastBufferMode == orxDISPLAY_BUFFER_MODE_INDIRECT)
       {
-        /* Copies vertex buffer */
-        glBufferSubDataARB(GL_ARRAY_BUFFER_ARB, 0, sstDisplay.s32BufferIndex * sizeof(orxDISPLAY_GLFW_VERTEX), sstDisplay.astVertexList);
-        glASSERT();
+        /* Streams vertex buffer */
+        orxDisplay_GLFW_StreamVertices(sstDisplay.astVertexList, sstDisplay.s32BufferIndex);
       }
     }
     else
@@ -2081,10 +2797,6 @@ static void orxFASTCALL orxDisplay_GLFW_SetBufferMode(orxDISPLAY_BUFFER_MODE _eB
       /* Has VBO support? */
       if(orxFLAG_TEST(sstDisplay.u32Flags, orxDISPLAY_KU32_STATIC_FLAG_VBO))
       {
-        /* Inits VBO */
-        glBufferDataARB(GL_ARRAY_BUFFER_ARB, orxDISPLAY_KU32_VERTEX_BUFFER_SIZE * sizeof(orxDISPLAY_GLFW_VERTEX), NULL, GL_DYNAMIC_DRAW_ARB);
-        glASSERT();
-
         /* Was using custom IBO? */
         if(orxFLAG_TEST(sstDisplay.u32Flags, orxDISPLAY_KU32_STATIC_FLAG_CUSTOM_IBO))
         {
@@ -2312,9 +3024,8 @@ static void orxFASTCALL orxDisplay_GLFW_DrawPrimitive(orxU32 _u32VertexNumber, o
   /* Has VBO support? */
   if(orxFLAG_TEST(sstDisplay.u32Flags, orxDISPLAY_KU32_STATIC_FLAG_VBO))
   {
-    /* Copies vertex buffer */
-    glBufferSubDataARB(GL_ARRAY_BUFFER_ARB, 0, _u32VertexNumber * sizeof(orxDISPLAY_GLFW_VERTEX), sstDisplay.astVertexList);
-    glASSERT();
+    /* Streams vertex buffer */
+    orxDisplay_GLFW_StreamVertices(sstDisplay.astVertexList, (orxS32)_u32VertexNumber);
   }
 
   /* Only 2 vertices? */
@@ -3008,9 +3719,11 @@ orxSTATUS orxFASTCALL orxDisplay_GLFW_DrawMesh(const orxDISPLAY_MESH *_pstMesh,
   /* Has VBO support? */
   if(orxFLAG_TEST(sstDisplay.u32Flags, orxDISPLAY_KU32_STATIC_FLAG_VBO))
   {
-    /* Fills VBO */
-    glBufferDataARB(GL_ARRAY_BUFFER_ARB, _pstMesh->u32VertexNumber * sizeof(orxDISPLAY_GLFW_VERTEX), _pstMesh->astVertexList, GL_STREAM_DRAW_ARB);
-    glASSERT();
+    /* Checks */
+    orxASSERT(_pstMesh->u32VertexNumber <= orxDISPLAY_KU32_VERTEX_BUFFER_SIZE);
+
+    /* Streams mesh vertices */
+    orxDisplay_GLFW_StreamVertices((const orxDISPLAY_GLFW_VERTEX *)_pstMesh->astVertexList, (orxS32)_pstMesh->u32VertexNumber);
 
     /* Has index buffer? */
     if((_pstMesh->au16IndexList != orxNULL)
@@ -3077,6 +3790,9 @@ void orxFASTCALL orxDisplay_GLFW_DeleteBitmap(orxBITMAP *_pstBitmap)
     }
     else
     {
+      /* Completes its pending readbacks */
+      orxDisplay_GLFW_FlushBitmapReadbacks(_pstBitmap);
+
       /* Deletes its data */
       orxDisplay_GLFW_DeleteBitmapData(_pstBitmap);
 
@@ -3341,6 +4057,9 @@ orxSTATUS orxFASTCALL orxDisplay_GLFW_Swap()
     /* Swap buffers */
     glfwSwapBuffers(sstDisplay.pstWindow);
 
+    /* Polls pending pixel readbacks */
+    orxDisplay_GLFW_UpdateReadbacks(orxFALSE);
+
     /* Is fullscreen & VSync? */
     if(orxFLAG_TEST_ALL(sstDisplay.u32Flags, orxDISPLAY_KU32_STATIC_FLAG_FULLSCREEN | orxDISPLAY_KU32_STATIC_FLAG_VSYNC))
     {
@@ -3463,6 +4182,71 @@ orxSTATUS orxFASTCALL orxDisplay_GLFW_SetBitmapData(orxBITMAP *_pstBitmap, const
   return eResult;
 }
 
+orxSTATUS orxFASTCALL orxDisplay_GLFW_SetPartialBitmapData(orxBITMAP *_pstBitmap, const orxU8 *_au8Data, orxU32 _u32X, orxU32 _u32Y, orxU32 _u32Width, orxU32 _u32Height)
+{
+  orxSTATUS eResult;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstBitmap != orxNULL);
+  orxASSERT(_au8Data != orxNULL);
+
+  /* Not loading? */
+  if(!orxFLAG_TEST(_pstBitmap->u32Flags, orxDISPLAY_KU32_BITMAP_FLAG_LOADING))
+  {
+    /* Valid? */
+    if((_pstBitmap != sstDisplay.pstScreen)
+    && (_u32Width > 0)
+    && (_u32Height > 0)
+    && (_u32X + _u32Width <= orxF2U(_pstBitmap->fWidth))
+    && (_u32Y + _u32Height <= orxF2U(_pstBitmap->fHeight)))
+    {
+      /* Binds texture */
+      glBindTexture(GL_TEXTURE_2D, _pstBitmap->uiTexture);
+      glASSERT();
+
+      /* Updates its region */
+      glTexSubImage2D(GL_TEXTURE_2D, 0, (GLint)_u32X, (GLint)_u32Y, (GLsizei)_u32Width, (GLsizei)_u32Height, GL_RGBA, GL_UNSIGNED_BYTE, _au8Data);
+      glASSERT();
+
+      /* Restores previous texture */
+      glBindTexture(GL_TEXTURE_2D, (sstDisplay.apstBoundBitmapList[sstDisplay.s32ActiveTextureUnit] != orxNULL) ? sstDisplay.apstBoundBitmapList[sstDisplay.s32ActiveTextureUnit]->uiTexture : 0);
+      glASSERT();
+
+      /* Updates result */
+      eResult = orxSTATUS_SUCCESS;
+    }
+    else
+    {
+      /* Screen? */
+      if(_pstBitmap == sstDisplay.pstScreen)
+      {
+        /* Logs message */
+        orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "Can't set bitmap data: can't use screen as destination bitmap.");
+      }
+      else
+      {
+        /* Logs message */
+        orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "Can't set partial bitmap data for [%s]: region (%u, %u) [%u x %u] is out of bounds.", _pstBitmap->zLocation, _u32X, _u32Y, _u32Width, _u32Height);
+      }
+
+      /* Updates result */
+      eResult = orxSTATUS_FAILURE;
+    }
+  }
+  else
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "Can't set bitmap data for [%s]: bitmap is not done loading.", _pstBitmap->zLocation);
+
+    /* Updates result */
+    eResult = orxSTATUS_FAILURE;
+  }
+
+  /* Done! */
+  return eResult;
+}
+
 orxSTATUS orxFASTCALL orxDisplay_GLFW_GetBitmapData(const orxBITMAP *_pstBitmap, orxU8 *_au8Data, orxU32 _u32ByteNumber)
 {
   orxSTATUS eResult;
@@ -3627,6 +4411,141 @@ orxSTATUS orxFASTCALL orxDisplay_GLFW_GetBitmapData(const orxBITMAP *_pstBitmap,
   return eResult;
 }
 
+orxSTATUS orxFASTCALL orxDisplay_GLFW_RequestBitmapData(const orxBITMAP *_pstBitmap, orxU8 *_au8Data, orxU32 _u32ByteNumber, orxDISPLAY_READ_FUNCTION _pfnCallback, void *_pContext)
+{
+  orxDISPLAY_READ_INFO *pstInfo;
+  orxSTATUS             eResult = orxSTATUS_FAILURE;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstBitmap != orxNULL);
+  orxASSERT(_au8Data != orxNULL);
+  orxASSERT(_pfnCallback != orxNULL);
+
+  /* Allocates read info */
+  pstInfo = (orxDISPLAY_READ_INFO *)orxMemory_Allocate(sizeof(orxDISPLAY_READ_INFO), orxMEMORY_TYPE_TEMP);
+
+  /* Valid? */
+  if(pstInfo != orxNULL)
+  {
+#ifndef __orxMAC__
+    orxDISPLAY_READBACK *pstReadback = orxNULL;
+#endif /* __orxMAC__ */
+
+    /* Inits it */
+    pstInfo->pfnCallback    = _pfnCallback;
+    pstInfo->pContext       = _pContext;
+    pstInfo->pstBitmap      = _pstBitmap;
+    pstInfo->au8Data        = _au8Data;
+    pstInfo->u32ByteNumber  = _u32ByteNumber;
+    pstInfo->stLocationID   = orxString_GetID(_pstBitmap->zLocation);
+
+#ifndef __orxMAC__
+
+    /* Has asynchronous readback support, is done loading and is size matching? */
+    if((orxFLAG_TEST(sstDisplay.u32Flags, orxDISPLAY_KU32_STATIC_FLAG_ASYNC_READ))
+    && (!orxFLAG_TEST(_pstBitmap->u32Flags, orxDISPLAY_KU32_BITMAP_FLAG_LOADING))
+    && (_u32ByteNumber == orxF2U(_pstBitmap->fWidth * _pstBitmap->fHeight) * 4 * sizeof(orxU8)))
+    {
+      orxU32 i;
+
+      /* Finds a free readback */
+      for(i = 0; i < orxDISPLAY_KU32_READBACK_NUMBER; i++)
+      {
+        if(sstDisplay.astReadbackList[i].pstInfo == orxNULL)
+        {
+          pstReadback = &(sstDisplay.astReadbackList[i]);
+          break;
+        }
+      }
+    }
+
+    /* Found? */
+    if(pstReadback != orxNULL)
+    {
+      /* Draws remaining items */
+      orxDisplay_GLFW_DrawArrays();
+
+      /* Inits readback */
+      pstReadback->bScreen      = (_pstBitmap == sstDisplay.pstScreen) ? orxTRUE : orxFALSE;
+      pstReadback->u32Width       = orxF2U(_pstBitmap->fWidth);
+      pstReadback->u32Height      = orxF2U(_pstBitmap->fHeight);
+      pstReadback->u32RealWidth   = (pstReadback->bScreen != orxFALSE) ? pstReadback->u32Width : _pstBitmap->u32RealWidth;
+      pstReadback->u32RealHeight  = (pstReadback->bScreen != orxFALSE) ? pstReadback->u32Height : _pstBitmap->u32RealHeight;
+
+      /* Needs a pixel buffer? */
+      if(pstReadback->uiBuffer == 0)
+      {
+        /* Creates it */
+        glGenBuffersARB(1, &(pstReadback->uiBuffer));
+        glASSERT();
+      }
+
+      /* Binds and (re)allocates it */
+      glBindBufferARB(GL_PIXEL_PACK_BUFFER_ARB, pstReadback->uiBuffer);
+      glASSERT();
+      glBufferDataARB(GL_PIXEL_PACK_BUFFER_ARB, pstReadback->u32RealWidth * pstReadback->u32RealHeight * 4 * sizeof(orxU8), NULL, GL_STREAM_READ_ARB);
+      glASSERT();
+
+      /* Screen? */
+      if(pstReadback->bScreen != orxFALSE)
+      {
+        /* Queues screen copy */
+        glReadPixels(0, 0, (GLsizei)pstReadback->u32Width, (GLsizei)pstReadback->u32Height, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+        glASSERT();
+      }
+      else
+      {
+        /* Queues texture copy */
+        glBindTexture(GL_TEXTURE_2D, _pstBitmap->uiTexture);
+        glASSERT();
+        glGetTexImage(GL_TEXTURE_2D, 0, GL_RGBA, GL_UNSIGNED_BYTE, NULL);
+        glASSERT();
+
+        /* Restores previous texture */
+        glBindTexture(GL_TEXTURE_2D, (sstDisplay.apstBoundBitmapList[sstDisplay.s32ActiveTextureUnit] != orxNULL) ? sstDisplay.apstBoundBitmapList[sstDisplay.s32ActiveTextureUnit]->uiTexture : 0);
+        glASSERT();
+      }
+
+      /* Fences the copy, it'll get polled upon swap */
+      pstReadback->stFence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+      glASSERT();
+
+      /* Unbinds pixel buffer */
+      glBindBufferARB(GL_PIXEL_PACK_BUFFER_ARB, 0);
+      glASSERT();
+
+      /* Stores read info */
+      pstReadback->pstInfo = pstInfo;
+
+      /* Updates result */
+      eResult = orxSTATUS_SUCCESS;
+    }
+    else
+
+#endif /* __orxMAC__ */
+
+    {
+      /* Gets bitmap data synchronously */
+      if(orxDisplay_GLFW_GetBitmapData(_pstBitmap, _au8Data, _u32ByteNumber) != orxSTATUS_FAILURE)
+      {
+        /* Defers notification to the main thread */
+        eResult = orxThread_RunTask(orxNULL, &orxDisplay_GLFW_NotifyBitmapData, orxNULL, (void *)pstInfo);
+      }
+    }
+
+    /* Failure? */
+    if(eResult == orxSTATUS_FAILURE)
+    {
+      /* Deletes read info */
+      orxMemory_Free(pstInfo);
+    }
+  }
+
+  /* Done! */
+  return eResult;
+}
+
 orxSTATUS orxFASTCALL orxDisplay_GLFW_SetDestinationBitmaps(orxBITMAP **_apstBitmapList, orxU32 _u32Number)
 {
   orxSTATUS eResult = orxSTATUS_SUCCESS;
@@ -4154,37 +5073,35 @@ orxSTATUS orxFASTCALL orxDisplay_GLFW_SaveBitmap(const orxBITMAP *_pstBitmap, co
   /* Valid? */
   if(pu8ImageData != orxNULL)
   {
-    orxDISPLAY_SAVE_INFO *pstInfo = orxNULL;
+    orxDISPLAY_SAVE_INFO *pstInfo;
+
+    /* Allocates save info */
+    pstInfo = (orxDISPLAY_SAVE_INFO *)orxMemory_Allocate(sizeof(orxDISPLAY_SAVE_INFO), orxMEMORY_TYPE_TEMP);
 
-    /* Gets bitmap data */
-    if(orxDisplay_GLFW_GetBitmapData(_pstBitmap, pu8ImageData, u32BufferSize) != orxSTATUS_FAILURE)
+    /* Valid? */
+    if(pstInfo != orxNULL)
     {
-      /* Allocates save info */
-      pstInfo = (orxDISPLAY_SAVE_INFO *)orxMemory_Allocate(sizeof(orxDISPLAY_SAVE_INFO), orxMEMORY_TYPE_TEMP);
+      /* Inits it */
+      pstInfo->pu8ImageData   = pu8ImageData;
+      pstInfo->stFilenameID   = orxString_GetID(_zFilename);
+      pstInfo->stLocationID   = orxString_GetID(_pstBitmap->zLocation);
+      pstInfo->u32Width       = orxF2U(_pstBitmap->fWidth);
+      pstInfo->u32Height      = orxF2U(_pstBitmap->fHeight);
 
-      /* Valid? */
-      if(pstInfo != orxNULL)
+      /* Requests bitmap data, it'll get encoded on a worker thread once available */
+      eResult = orxDisplay_GLFW_RequestBitmapData(_pstBitmap, pu8ImageData, u32BufferSize, &orxDisplay_GLFW_SaveBitmapCallback, (void *)pstInfo);
+
+      /* Failure? */
+      if(eResult == orxSTATUS_FAILURE)
       {
-        /* Inits it */
-        pstInfo->pu8ImageData   = pu8ImageData;
-        pstInfo->stFilenameID   = orxString_GetID(_zFilename);
-        pstInfo->u32Width       = orxF2U(_pstBitmap->fWidth);
-        pstInfo->u32Height      = orxF2U(_pstBitmap->fHeight);
-
-        /* Runs asynchronous task */
-        eResult = orxThread_RunTask(&orxDisplay_GLFW_SaveBitmapData, orxNULL, orxNULL, (void *)pstInfo);
+        /* Frees save info */
+        orxMemory_Free(pstInfo);
       }
     }
 
     /* Failure? */
     if(eResult == orxSTATUS_FAILURE)
     {
-      /* Frees save info */
-      if(pstInfo != orxNULL)
-      {
-        orxMemory_Free(pstInfo);
-      }
-
       /* Frees buffer */
       orxMemory_Free(pu8ImageData);
     }
@@ -4808,9 +5725,8 @@ orxSTATUS orxFASTCALL orxDisplay_GLFW_SetVideoMode(const orxDISPLAY_VIDEO_MODE *
           glBindBufferARB(GL_ELEMENT_ARRAY_BUFFER_ARB, sstDisplay.uiIndexBuffer);
           glASSERT();
 
-          /* Inits VBO */
-          glBufferDataARB(GL_ARRAY_BUFFER_ARB, orxDISPLAY_KU32_VERTEX_BUFFER_SIZE * sizeof(orxDISPLAY_GLFW_VERTEX), NULL, GL_DYNAMIC_DRAW_ARB);
-          glASSERT();
+          /* Inits streaming VBO */
+          orxDisplay_GLFW_InitStreamBuffer();
 
           /* Fills IBO */
           glBufferDataARB(GL_ELEMENT_ARRAY_BUFFER_ARB, orxDISPLAY_KU32_INDEX_BUFFER_SIZE * sizeof(GLushort), sstDisplay.au16IndexList, GL_STATIC_DRAW_ARB);
@@ -5077,6 +5993,7 @@ orxSTATUS orxFASTCALL orxDisplay_GLFW_SetVideoMode(const orxDISPLAY_VIDEO_MODE *
     glASSERT();
 
     /* Selects arrays */
+    sstDisplay.s32StreamBase = 0;
     glVertexPointer(2, GL_FLOAT, sizeof(orxDISPLAY_VERTEX), orxFLAG_TEST(sstDisplay.u32Flags, orxDISPLAY_KU32_STATIC_FLAG_VBO) ? (GLvoid *)offsetof(orxDISPLAY_GLFW_VERTEX, fX) : &(sstDisplay.astVertexList[0].fX));
     glASSERT();
     glTexCoordPointer(2, GL_FLOAT, sizeof(orxDISPLAY_VERTEX), orxFLAG_TEST(sstDisplay.u32Flags, orxDISPLAY_KU32_STATIC_FLAG_VBO) ? (GLvoid *)offsetof(orxDISPLAY_GLFW_VERTEX, fU) : &(sstDisplay.astVertexList[0].fU));
@@ -5444,6 +6361,16 @@ void orxFASTCALL orxDisplay_GLFW_Exit()
       orxDisplay_DeleteShader(sstDisplay.pstNoTextureShader);
     }
 
+    /* Completes pending pixel readbacks */
+    orxDisplay_GLFW_UpdateReadbacks(orxTRUE);
+
+    /* Has VBO support? */
+    if(orxFLAG_TEST(sstDisplay.u32Flags, orxDISPLAY_KU32_STATIC_FLAG_VBO))
+    {
+      /* Exits from streaming VBO */
+      orxDisplay_GLFW_ExitStreamBuffer();
+    }
+
     /* Has cursor? */
     if(sstDisplay.pstCursor != NULL)
     {
@@ -6175,6 +7102,8 @@ orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_GLFW_SetBlendMode, DISPLAY, SET_BLEN
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_GLFW_SetBitmapClipping, DISPLAY, SET_BITMAP_CLIPPING);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_GLFW_SetBitmapData, DISPLAY, SET_BITMAP_DATA);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_GLFW_GetBitmapData, DISPLAY, GET_BITMAP_DATA);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_GLFW_RequestBitmapData, DISPLAY, REQUEST_BITMAP_DATA);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_GLFW_SetPartialBitmapData, DISPLAY, SET_PARTIAL_BITMAP_DATA);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_GLFW_GetBitmapSize, DISPLAY, GET_BITMAP_SIZE);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_GLFW_GetBitmapID, DISPLAY, GET_BITMAP_ID);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_GLFW_TransformBitmap, DISPLAY, TRANSFORM_BITMAP);
@@ -0,0 +1,3130 @@
+/* Orx - Portable Game Engine
+ *
+ * Copyright (c) 2008-2019 Orx-Project
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ *    1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ *
+ *    2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ *
+ *    3. This notice may not be removed or altered from any source
+ *    distribution.
+ */
+
+/**
+ * @file orxDisplay.c
+ *
+ * Software (headless) display plugin implementation
+ *
+ * All bitmaps, including the screen, are RGBA buffers in main memory.
+ * Draw calls are batched as triangles that get rasterized when the batch is flushed: the destination clipping area
+ * is split in tiles processed in parallel, each tile rendering all the batched triangles in submission order.
+ * Coverage is computed with exact edge functions on snapped vertices, which makes the output independent from
+ * the number of threads and deterministic from one run to the next.
+ *
+ */
+
+
+#include "orxPluginAPI.h"
+
+#ifdef __orxGCC__
+  #pragma GCC diagnostic push
+  #pragma GCC diagnostic ignored "-Wpragmas"
+  #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+  #pragma GCC diagnostic ignored "-Wmisleading-indentation"
+#endif /* __orxGCC__ */
+
+#ifdef __orxMSVC__
+  #pragma warning(disable : 4312)
+#endif /* __orxMSVC__ */
+#define STBI_NO_STDIO
+#define STB_IMAGE_IMPLEMENTATION
+#define STBI_NO_PSD
+#define STBI_NO_GIF
+#define STBI_NO_HDR
+#define STBI_NO_PIC
+#define STBI_NO_PNM
+#define STBI_MALLOC(sz)         orxMemory_Allocate((orxU32)sz, orxMEMORY_TYPE_VIDEO)
+#define STBI_REALLOC(p, newsz)  orxMemory_Reallocate(p, newsz)
+#define STBI_FREE(p)            orxMemory_Free(p)
+#include "stb_image.h"
+#undef STBI_FREE
+#undef STBI_REALLOC
+#undef STBI_MALLOC
+#undef STBI_NO_PNM
+#undef STBI_NO_PIC
+#undef STBI_NO_HDR
+#undef STBI_NO_GIF
+#undef STBI_NO_PSD
+#undef STB_IMAGE_IMPLEMENTATION
+#undef STBI_NO_STDIO
+#ifdef __orxMSVC__
+  #pragma warning(default : 4312)
+#endif /* __orxMSVC__ */
+
+#define STB_IMAGE_WRITE_IMPLEMENTATION
+#define STBIW_MALLOC(sz)        orxMemory_Allocate(sz, orxMEMORY_TYPE_VIDEO)
+#define STBIW_REALLOC(p, newsz) orxMemory_Reallocate(p, newsz)
+#define STBIW_FREE(p)           orxMemory_Free(p)
+#define STBIW_MEMMOVE(a, b, sz) orxMemory_Move(a, b, sz)
+#include "stb_image_write.h"
+#undef STBIW_MEMMOVE
+#undef STBIW_FREE
+#undef STBIW_REALLOC
+#undef STBIW_MALLOC
+#undef STB_IMAGE_WRITE_IMPLEMENTATION
+
+
+/** Module flags
+ */
+#define orxDISPLAY_KU32_STATIC_FLAG_NONE        0x00000000  /**< No flags */
+
+#define orxDISPLAY_KU32_STATIC_FLAG_READY       0x00000001  /**< Ready flag */
+#define orxDISPLAY_KU32_STATIC_FLAG_VSYNC       0x00000002  /**< VSync flag */
+#define orxDISPLAY_KU32_STATIC_FLAG_FULLSCREEN  0x00000004  /**< Full screen flag */
+
+#define orxDISPLAY_KU32_STATIC_MASK_ALL         0xFFFFFFFF  /**< All mask */
+
+#define orxDISPLAY_KU32_BITMAP_FLAG_NONE        0x00000000  /** No flags */
+
+#define orxDISPLAY_KU32_BITMAP_FLAG_LOADING     0x00000001  /**< Loading flag */
+#define orxDISPLAY_KU32_BITMAP_FLAG_DELETE      0x00000002  /**< Delete flag */
+
+#define orxDISPLAY_KU32_BITMAP_MASK_ALL         0xFFFFFFFF  /**< All mask */
+
+#define orxDISPLAY_KU32_TRIANGLE_FLAG_NONE      0x00000000  /**< No flags */
+
+#define orxDISPLAY_KU32_TRIANGLE_FLAG_EDGE_0    0x00000001  /**< Edge 0 includes its pixel centers */
+#define orxDISPLAY_KU32_TRIANGLE_FLAG_EDGE_1    0x00000002  /**< Edge 1 includes its pixel centers */
+#define orxDISPLAY_KU32_TRIANGLE_FLAG_EDGE_2    0x00000004  /**< Edge 2 includes its pixel centers */
+#define orxDISPLAY_KU32_TRIANGLE_FLAG_SMOOTHING 0x00000008  /**< Bilinear filtering flag */
+#define orxDISPLAY_KU32_TRIANGLE_FLAG_FLAT      0x00000010  /**< Flat color flag */
+
+#define orxDISPLAY_KU32_TRIANGLE_MASK_ALL       0xFFFFFFFF  /**< All mask */
+
+#define orxDISPLAY_KU32_BITMAP_BANK_SIZE        256
+
+#define orxDISPLAY_KU32_TRIANGLE_BUFFER_SIZE    8192        /**< Triangle batch capacity */
+#define orxDISPLAY_KU32_TILE_SIZE               64          /**< Tile size, in pixels */
+#define orxDISPLAY_KU32_TILE_GRAIN              2           /**< Number of tiles per parallel batch */
+#define orxDISPLAY_KU32_MAX_DESTINATION_NUMBER  8
+
+#define orxDISPLAY_KF_SUBPIXEL_PRECISION        orx2F(16.0f)
+#define orxDISPLAY_KF_LINE_HALF_WIDTH           orx2F(0.5f)
+
+#define orxDISPLAY_KU32_CIRCLE_LINE_NUMBER      32
+
+#define orxDISPLAY_KU32_DEFAULT_WIDTH           800
+#define orxDISPLAY_KU32_DEFAULT_HEIGHT          600
+#define orxDISPLAY_KU32_DEFAULT_DEPTH           32
+#define orxDISPLAY_KU32_DEFAULT_REFRESH_RATE    60
+
+
+/***************************************************************************
+ * Structure declaration                                                   *
+ ***************************************************************************/
+
+/** Internal matrix structure
+ */
+typedef struct __orxDISPLAY_MATRIX_t
+{
+  orxVECTOR vX;
+  orxVECTOR vY;
+
+} orxDISPLAY_MATRIX;
+
+/** Internal bitmap structure
+ */
+struct __orxBITMAP_t
+{
+  orxRGBA                  *astData;
+  orxBOOL                   bSmoothing;
+  orxFLOAT                  fWidth, fHeight;
+  orxAABOX                  stClip;
+  orxU32                    u32RealWidth, u32RealHeight, u32Depth;
+  orxFLOAT                  fRecRealWidth, fRecRealHeight;
+  orxU32                    u32DataSize;
+  orxU32                    u32ID;
+  const orxSTRING           zLocation;
+  orxSTRINGID               stFilenameID;
+  orxU32                    u32Flags;
+};
+
+/** Internal triangle structure
+ */
+typedef struct __orxDISPLAY_TRIANGLE_t
+{
+  orxDOUBLE                 adEdgeX[3], adEdgeY[3];           /**< Edge origins, snapped */
+  orxDOUBLE                 adEdgeDX[3], adEdgeDY[3];         /**< Edge deltas, oriented so that inner points have positive edge function values */
+  orxFLOAT                  fRecArea;
+  orxFLOAT                  afU[3], afV[3];                   /**< Texel coordinates */
+  orxFLOAT                  afR[3], afG[3], afB[3], afA[3];   /**< Normalized colors */
+  const orxBITMAP          *pstBitmap;
+  orxS32                    s32MinX, s32MinY, s32MaxX, s32MaxY;
+  orxDISPLAY_BLEND_MODE     eBlendMode;
+  orxU32                    u32Flags;
+
+} orxDISPLAY_TRIANGLE;
+
+/** Internal bitmap save info structure
+ */
+typedef struct __orxDISPLAY_SAVE_INFO_t
+{
+  orxU8  *pu8ImageData;
+  orxU32  u32Width;
+  orxU32  u32Height;
+  orxSTRINGID stFilenameID;
+
+} orxDISPLAY_SAVE_INFO;
+
+/** Internal bitmap read info structure
+ */
+typedef struct __orxDISPLAY_READ_INFO_t
+{
+  orxDISPLAY_READ_FUNCTION  pfnCallback;
+  void                     *pContext;
+  const orxBITMAP          *pstBitmap;
+  orxU8                    *au8Data;
+  orxU32                    u32ByteNumber;
+
+} orxDISPLAY_READ_INFO;
+
+/** Internal bitmap load info structure
+ */
+typedef struct __orxDISPLAY_LOAD_INFO_t
+{
+  orxU8      *pu8ImageBuffer;
+  const orxU8*pu8ImageSource;
+  orxS64      s64Size;
+  orxBITMAP  *pstBitmap;
+  orxHANDLE   hResource;
+  orxU32      u32Width;
+  orxU32      u32Height;
+
+} orxDISPLAY_LOAD_INFO;
+
+/** Static structure
+ */
+typedef struct __orxDISPLAY_STATIC_t
+{
+  orxBANK                  *pstBitmapBank;
+  orxBOOL                   bDefaultSmoothing;
+  orxBITMAP                *pstScreen;
+  const orxBITMAP          *pstTempBitmap;
+  const orxBITMAP          *pstLastBitmap;
+  orxRGBA                   stLastColor;
+  orxDISPLAY_BLEND_MODE     eLastBlendMode;
+  orxDISPLAY_TRIANGLE      *astTriangleList;
+  orxU32                    u32TriangleCount;
+  orxS32                    s32ClipMinX, s32ClipMinY, s32ClipMaxX, s32ClipMaxY;
+  orxU32                    u32TileCountX;
+  orxU32                    u32DestinationBitmapCount;
+  orxU32                    u32BitmapCounter;
+  orxU32                    u32RefreshRate;
+  orxDISPLAY_VIDEO_MODE     stDefaultVideoMode;
+  orxU32                    u32Flags;
+  orxBITMAP                *apstDestinationBitmapList[orxDISPLAY_KU32_MAX_DESTINATION_NUMBER];
+
+} orxDISPLAY_STATIC;
+
+
+/***************************************************************************
+ * Static variables                                                        *
+ ***************************************************************************/
+
+/** Static data
+ */
+static orxDISPLAY_STATIC sstDisplay;
+
+
+/***************************************************************************
+ * Private functions                                                       *
+ ***************************************************************************/
+
+/** Prototypes
+ */
+orxSTATUS orxFASTCALL orxDisplay_Software_SetDestinationBitmaps(orxBITMAP **_apstBitmapList, orxU32 _u32Number);
+orxSTATUS orxFASTCALL orxDisplay_Software_SetVideoMode(const orxDISPLAY_VIDEO_MODE *_pstVideoMode);
+
+
+static orxINLINE orxDISPLAY_MATRIX *orxDisplay_Software_InitMatrix(orxDISPLAY_MATRIX *_pmMatrix, orxFLOAT _fPosX, orxFLOAT _fPosY, orxFLOAT _fScaleX, orxFLOAT _fScaleY, orxFLOAT _fRotation, orxFLOAT _fPivotX, orxFLOAT _fPivotY)
+{
+  orxFLOAT fCos, fSin, fSCosX, fSCosY, fSSinX, fSSinY, fTX, fTY;
+
+  /* Has rotation? */
+  if(_fRotation != orxFLOAT_0)
+  {
+    /* Gets its cos/sin */
+    fCos = orxMath_Cos(_fRotation);
+    fSin = orxMath_Sin(_fRotation);
+  }
+  else
+  {
+    /* Inits cos/sin */
+    fCos = orxFLOAT_1;
+    fSin = orxFLOAT_0;
+  }
+
+  /* Computes values */
+  fSCosX = _fScaleX * fCos;
+  fSCosY = _fScaleY * fCos;
+  fSSinX = _fScaleX * fSin;
+  fSSinY = _fScaleY * fSin;
+  fTX    = _fPosX - (_fPivotX * fSCosX) + (_fPivotY * fSSinY);
+  fTY    = _fPosY - (_fPivotX * fSSinX) - (_fPivotY * fSCosY);
+
+  /* Updates matrix */
+  orxVector_Set(&(_pmMatrix->vX), fSCosX, -fSSinY, fTX);
+  orxVector_Set(&(_pmMatrix->vY), fSSinX, fSCosY, fTY);
+
+  /* Done! */
+  return _pmMatrix;
+}
+
+static orxINLINE orxBOOL orxDisplay_Software_GetSmoothing(orxDISPLAY_SMOOTHING _eSmoothing)
+{
+  orxBOOL bResult;
+
+  /* Depending on smoothing type */
+  switch(_eSmoothing)
+  {
+    case orxDISPLAY_SMOOTHING_ON:
+    {
+      /* Applies smoothing */
+      bResult = orxTRUE;
+
+      break;
+    }
+
+    case orxDISPLAY_SMOOTHING_OFF:
+    {
+      /* Applies no smoothing */
+      bResult = orxFALSE;
+
+      break;
+    }
+
+    default:
+    case orxDISPLAY_SMOOTHING_DEFAULT:
+    {
+      /* Applies default smoothing */
+      bResult = sstDisplay.bDefaultSmoothing;
+
+      break;
+    }
+  }
+
+  /* Done! */
+  return bResult;
+}
+
+static orxINLINE orxFLOAT orxDisplay_Software_Saturate(orxFLOAT _fValue)
+{
+  /* Done! */
+  return (_fValue < orxFLOAT_0) ? orxFLOAT_0 : (_fValue > orxFLOAT_1) ? orxFLOAT_1 : _fValue;
+}
+
+static orxINLINE orxU8 orxDisplay_Software_ToU8(orxFLOAT _fValue)
+{
+  /* Done! */
+  return (orxU8)orxF2U(orxDisplay_Software_Saturate(_fValue) * orx2F(255.0f) + orx2F(0.5f));
+}
+
+static orxINLINE void orxDisplay_Software_SampleBitmap(const orxBITMAP *_pstBitmap, orxFLOAT _fU, orxFLOAT _fV, orxBOOL _bSmoothing, orxFLOAT *_pfR, orxFLOAT *_pfG, orxFLOAT *_pfB, orxFLOAT *_pfA)
+{
+  orxS32 s32MaxX, s32MaxY;
+
+  /* Gets limits */
+  s32MaxX = (orxS32)_pstBitmap->u32RealWidth - 1;
+  s32MaxY = (orxS32)_pstBitmap->u32RealHeight - 1;
+
+  /* Smoothing? */
+  if(_bSmoothing != orxFALSE)
+  {
+    const orxRGBA  *pstTL, *pstTR, *pstBL, *pstBR;
+    orxFLOAT        fX, fY, fFracX, fFracY, fTL, fTR, fBL, fBR;
+    orxS32          s32X0, s32Y0, s32X1, s32Y1;
+
+    /* Gets texel-centered coordinates */
+    fX      = _fU - orx2F(0.5f);
+    fY      = _fV - orx2F(0.5f);
+    s32X0   = (orxS32)orxMath_Floor(fX);
+    s32Y0   = (orxS32)orxMath_Floor(fY);
+    fFracX  = fX - orxS2F(s32X0);
+    fFracY  = fY - orxS2F(s32Y0);
+    s32X1   = orxCLAMP(s32X0 + 1, 0, s32MaxX);
+    s32Y1   = orxCLAMP(s32Y0 + 1, 0, s32MaxY);
+    s32X0   = orxCLAMP(s32X0, 0, s32MaxX);
+    s32Y0   = orxCLAMP(s32Y0, 0, s32MaxY);
+
+    /* Gets texels */
+    pstTL   = &(_pstBitmap->astData[s32Y0 * (s32MaxX + 1) + s32X0]);
+    pstTR   = &(_pstBitmap->astData[s32Y0 * (s32MaxX + 1) + s32X1]);
+    pstBL   = &(_pstBitmap->astData[s32Y1 * (s32MaxX + 1) + s32X0]);
+    pstBR   = &(_pstBitmap->astData[s32Y1 * (s32MaxX + 1) + s32X1]);
+
+    /* Gets weights */
+    fTL     = (orxFLOAT_1 - fFracX) * (orxFLOAT_1 - fFracY) * orxCOLOR_NORMALIZER;
+    fTR     = fFracX * (orxFLOAT_1 - fFracY) * orxCOLOR_NORMALIZER;
+    fBL     = (orxFLOAT_1 - fFracX) * fFracY * orxCOLOR_NORMALIZER;
+    fBR     = fFracX * fFracY * orxCOLOR_NORMALIZER;
+
+    /* Filters them */
+    *_pfR   = fTL * orxU2F(pstTL->u8R) + fTR * orxU2F(pstTR->u8R) + fBL * orxU2F(pstBL->u8R) + fBR * orxU2F(pstBR->u8R);
+    *_pfG   = fTL * orxU2F(pstTL->u8G) + fTR * orxU2F(pstTR->u8G) + fBL * orxU2F(pstBL->u8G) + fBR * orxU2F(pstBR->u8G);
+    *_pfB   = fTL * orxU2F(pstTL->u8B) + fTR * orxU2F(pstTR->u8B) + fBL * orxU2F(pstBL->u8B) + fBR * orxU2F(pstBR->u8B);
+    *_pfA   = fTL * orxU2F(pstTL->u8A) + fTR * orxU2F(pstTR->u8A) + fBL * orxU2F(pstBL->u8A) + fBR * orxU2F(pstBR->u8A);
+  }
+  else
+  {
+    const orxRGBA  *pstTexel;
+    orxS32          s32X, s32Y;
+
+    /* Gets nearest texel */
+    s32X      = orxCLAMP((orxS32)orxMath_Floor(_fU), 0, s32MaxX);
+    s32Y      = orxCLAMP((orxS32)orxMath_Floor(_fV), 0, s32MaxY);
+    pstTexel  = &(_pstBitmap->astData[s32Y * (s32MaxX + 1) + s32X]);
+
+    /* Stores it */
+    *_pfR     = orxCOLOR_NORMALIZER * orxU2F(pstTexel->u8R);
+    *_pfG     = orxCOLOR_NORMALIZER * orxU2F(pstTexel->u8G);
+    *_pfB     = orxCOLOR_NORMALIZER * orxU2F(pstTexel->u8B);
+    *_pfA     = orxCOLOR_NORMALIZER * orxU2F(pstTexel->u8A);
+  }
+
+  /* Done! */
+  return;
+}
+
+static void orxFASTCALL orxDisplay_Software_ShadeSpan(const orxDISPLAY_TRIANGLE *_pstTriangle, orxS32 _s32X, orxS32 _s32Y, orxS32 _s32Count, const orxFLOAT *_afL, const orxFLOAT *_afDL)
+{
+  orxFLOAT  afR[orxDISPLAY_KU32_TILE_SIZE], afG[orxDISPLAY_KU32_TILE_SIZE], afB[orxDISPLAY_KU32_TILE_SIZE], afA[orxDISPLAY_KU32_TILE_SIZE];
+  orxU32    u32Destination;
+  orxS32    i;
+
+  /* Checks */
+  orxASSERT((_s32Count > 0) && (_s32Count <= orxDISPLAY_KU32_TILE_SIZE));
+
+  /* Flat? */
+  if(orxFLAG_TEST(_pstTriangle->u32Flags, orxDISPLAY_KU32_TRIANGLE_FLAG_FLAT))
+  {
+    /* For all pixels */
+    for(i = 0; i < _s32Count; i++)
+    {
+      /* Stores color */
+      afR[i] = _pstTriangle->afR[0];
+      afG[i] = _pstTriangle->afG[0];
+      afB[i] = _pstTriangle->afB[0];
+      afA[i] = _pstTriangle->afA[0];
+    }
+  }
+  else
+  {
+    /* For all pixels */
+    for(i = 0; i < _s32Count; i++)
+    {
+      orxFLOAT fL0, fL1, fL2;
+
+      /* Gets barycentric coordinates */
+      fL0 = _afL[0] + orxS2F(i) * _afDL[0];
+      fL1 = _afL[1] + orxS2F(i) * _afDL[1];
+      fL2 = _afL[2] + orxS2F(i) * _afDL[2];
+
+      /* Interpolates color */
+      afR[i] = fL0 * _pstTriangle->afR[0] + fL1 * _pstTriangle->afR[1] + fL2 * _pstTriangle->afR[2];
+      afG[i] = fL0 * _pstTriangle->afG[0] + fL1 * _pstTriangle->afG[1] + fL2 * _pstTriangle->afG[2];
+      afB[i] = fL0 * _pstTriangle->afB[0] + fL1 * _pstTriangle->afB[1] + fL2 * _pstTriangle->afB[2];
+      afA[i] = fL0 * _pstTriangle->afA[0] + fL1 * _pstTriangle->afA[1] + fL2 * _pstTriangle->afA[2];
+    }
+  }
+
+  /* Textured? */
+  if(_pstTriangle->pstBitmap != orxNULL)
+  {
+    orxBOOL bSmoothing;
+
+    /* Gets smoothing */
+    bSmoothing = orxFLAG_TEST(_pstTriangle->u32Flags, orxDISPLAY_KU32_TRIANGLE_FLAG_SMOOTHING) ? orxTRUE : orxFALSE;
+
+    /* For all pixels */
+    for(i = 0; i < _s32Count; i++)
+    {
+      orxFLOAT fL0, fL1, fL2, fR, fG, fB, fA;
+
+      /* Gets barycentric coordinates */
+      fL0 = _afL[0] + orxS2F(i) * _afDL[0];
+      fL1 = _afL[1] + orxS2F(i) * _afDL[1];
+      fL2 = _afL[2] + orxS2F(i) * _afDL[2];
+
+      /* Samples bitmap */
+      orxDisplay_Software_SampleBitmap(_pstTriangle->pstBitmap,
+                                       fL0 * _pstTriangle->afU[0] + fL1 * _pstTriangle->afU[1] + fL2 * _pstTriangle->afU[2],
+                                       fL0 * _pstTriangle->afV[0] + fL1 * _pstTriangle->afV[1] + fL2 * _pstTriangle->afV[2],
+                                       bSmoothing, &fR, &fG, &fB, &fA);
+
+      /* Modulates color */
+      afR[i] *= fR;
+      afG[i] *= fG;
+      afB[i] *= fB;
+      afA[i] *= fA;
+    }
+  }
+
+  /* For all destinations */
+  for(u32Destination = 0; u32Destination < sstDisplay.u32DestinationBitmapCount; u32Destination++)
+  {
+    orxRGBA *astDst;
+
+    /* Gets destination pixels */
+    astDst = &(sstDisplay.apstDestinationBitmapList[u32Destination]->astData[(orxU32)_s32Y * sstDisplay.apstDestinationBitmapList[u32Destination]->u32RealWidth + (orxU32)_s32X]);
+
+    /* Depending on blend mode */
+    switch(_pstTriangle->eBlendMode)
+    {
+      case orxDISPLAY_BLEND_MODE_ALPHA:
+      {
+        /* For all pixels */
+        for(i = 0; i < _s32Count; i++)
+        {
+          orxFLOAT fInvA;
+
+          /* Blends it: src * srcA + dst * (1 - srcA) */
+          fInvA         = orxFLOAT_1 - afA[i];
+          astDst[i].u8R = orxDisplay_Software_ToU8(afR[i] * afA[i] + orxCOLOR_NORMALIZER * orxU2F(astDst[i].u8R) * fInvA);
+          astDst[i].u8G = orxDisplay_Software_ToU8(afG[i] * afA[i] + orxCOLOR_NORMALIZER * orxU2F(astDst[i].u8G) * fInvA);
+          astDst[i].u8B = orxDisplay_Software_ToU8(afB[i] * afA[i] + orxCOLOR_NORMALIZER * orxU2F(astDst[i].u8B) * fInvA);
+          astDst[i].u8A = orxDisplay_Software_ToU8(afA[i] * afA[i] + orxCOLOR_NORMALIZER * orxU2F(astDst[i].u8A) * fInvA);
+        }
+
+        break;
+      }
+
+      case orxDISPLAY_BLEND_MODE_MULTIPLY:
+      {
+        /* For all pixels */
+        for(i = 0; i < _s32Count; i++)
+        {
+          /* Blends it: src * dst */
+          astDst[i].u8R = orxDisplay_Software_ToU8(afR[i] * orxCOLOR_NORMALIZER * orxU2F(astDst[i].u8R));
+          astDst[i].u8G = orxDisplay_Software_ToU8(afG[i] * orxCOLOR_NORMALIZER * orxU2F(astDst[i].u8G));
+          astDst[i].u8B = orxDisplay_Software_ToU8(afB[i] * orxCOLOR_NORMALIZER * orxU2F(astDst[i].u8B));
+          astDst[i].u8A = orxDisplay_Software_ToU8(afA[i] * orxCOLOR_NORMALIZER * orxU2F(astDst[i].u8A));
+        }
+
+        break;
+      }
+
+      case orxDISPLAY_BLEND_MODE_ADD:
+      {
+        /* For all pixels */
+        for(i = 0; i < _s32Count; i++)
+        {
+          /* Blends it: src * srcA + dst */
+          astDst[i].u8R = orxDisplay_Software_ToU8(afR[i] * afA[i] + orxCOLOR_NORMALIZER * orxU2F(astDst[i].u8R));
+          astDst[i].u8G = orxDisplay_Software_ToU8(afG[i] * afA[i] + orxCOLOR_NORMALIZER * orxU2F(astDst[i].u8G));
+          astDst[i].u8B = orxDisplay_Software_ToU8(afB[i] * afA[i] + orxCOLOR_NORMALIZER * orxU2F(astDst[i].u8B));
+          astDst[i].u8A = orxDisplay_Software_ToU8(afA[i] * afA[i] + orxCOLOR_NORMALIZER * orxU2F(astDst[i].u8A));
+        }
+
+        break;
+      }
+
+      case orxDISPLAY_BLEND_MODE_PREMUL:
+      {
+        /* For all pixels */
+        for(i = 0; i < _s32Count; i++)
+        {
+          orxFLOAT fInvA;
+
+          /* Blends it: src + dst * (1 - srcA) */
+          fInvA         = orxFLOAT_1 - afA[i];
+          astDst[i].u8R = orxDisplay_Software_ToU8(afR[i] + orxCOLOR_NORMALIZER * orxU2F(astDst[i].u8R) * fInvA);
+          astDst[i].u8G = orxDisplay_Software_ToU8(afG[i] + orxCOLOR_NORMALIZER * orxU2F(astDst[i].u8G) * fInvA);
+          astDst[i].u8B = orxDisplay_Software_ToU8(afB[i] + orxCOLOR_NORMALIZER * orxU2F(astDst[i].u8B) * fInvA);
+          astDst[i].u8A = orxDisplay_Software_ToU8(afA[i] + orxCOLOR_NORMALIZER * orxU2F(astDst[i].u8A) * fInvA);
+        }
+
+        break;
+      }
+
+      default:
+      {
+        /* For all pixels */
+        for(i = 0; i < _s32Count; i++)
+        {
+          /* Overwrites it */
+          astDst[i].u8R = orxDisplay_Software_ToU8(afR[i]);
+          astDst[i].u8G = orxDisplay_Software_ToU8(afG[i]);
+          astDst[i].u8B = orxDisplay_Software_ToU8(afB[i]);
+          astDst[i].u8A = orxDisplay_Software_ToU8(afA[i]);
+        }
+
+        break;
+      }
+    }
+  }
+
+  /* Done! */
+  return;
+}
+
+static orxINLINE orxBOOL orxDisplay_Software_IsInside(const orxDOUBLE *_adE, orxU32 _u32Flags)
+{
+  /* Done! */
+  return (((_adE[0] > 0.0) || ((_adE[0] == 0.0) && orxFLAG_TEST(_u32Flags, orxDISPLAY_KU32_TRIANGLE_FLAG_EDGE_0)))
+       && ((_adE[1] > 0.0) || ((_adE[1] == 0.0) && orxFLAG_TEST(_u32Flags, orxDISPLAY_KU32_TRIANGLE_FLAG_EDGE_1)))
+       && ((_adE[2] > 0.0) || ((_adE[2] == 0.0) && orxFLAG_TEST(_u32Flags, orxDISPLAY_KU32_TRIANGLE_FLAG_EDGE_2)))) ? orxTRUE : orxFALSE;
+}
+
+static void orxFASTCALL orxDisplay_Software_RasterizeTriangle(const orxDISPLAY_TRIANGLE *_pstTriangle, orxS32 _s32MinX, orxS32 _s32MinY, orxS32 _s32MaxX, orxS32 _s32MaxY)
+{
+  orxFLOAT  afDL[3];
+  orxDOUBLE dX;
+  orxS32    s32Y, i;
+
+  /* Gets barycentric steps along X */
+  for(i = 0; i < 3; i++)
+  {
+    afDL[i] = (orxFLOAT)_pstTriangle->adEdgeDY[i] * _pstTriangle->fRecArea;
+  }
+
+  /* Gets first pixel center */
+  dX = (orxDOUBLE)_s32MinX + 0.5;
+
+  /* For all rows */
+  for(s32Y = _s32MinY; s32Y < _s32MaxY; s32Y++)
+  {
+    orxDOUBLE adE[3], dY;
+    orxS32    s32X, s32Start;
+
+    /* Gets pixel center */
+    dY = (orxDOUBLE)s32Y + 0.5;
+
+    /* Gets edge function values at row start */
+    for(i = 0; i < 3; i++)
+    {
+      adE[i] = (dX - _pstTriangle->adEdgeX[i]) * _pstTriangle->adEdgeDY[i] - (dY - _pstTriangle->adEdgeY[i]) * _pstTriangle->adEdgeDX[i];
+    }
+
+    /* Finds span start */
+    for(s32X = _s32MinX; (s32X < _s32MaxX) && (orxDisplay_Software_IsInside(adE, _pstTriangle->u32Flags) == orxFALSE); s32X++)
+    {
+      adE[0] += _pstTriangle->adEdgeDY[0];
+      adE[1] += _pstTriangle->adEdgeDY[1];
+      adE[2] += _pstTriangle->adEdgeDY[2];
+    }
+
+    /* Found? */
+    if(s32X < _s32MaxX)
+    {
+      orxFLOAT afL[3];
+
+      /* Stores span start & its barycentric coordinates */
+      s32Start  = s32X;
+      afL[0]    = (orxFLOAT)adE[0] * _pstTriangle->fRecArea;
+      afL[1]    = (orxFLOAT)adE[1] * _pstTriangle->fRecArea;
+      afL[2]    = (orxFLOAT)adE[2] * _pstTriangle->fRecArea;
+
+      /* Finds span end (triangles are convex) */
+      for(; (s32X < _s32MaxX) && (orxDisplay_Software_IsInside(adE, _pstTriangle->u32Flags) != orxFALSE); s32X++)
+      {
+        adE[0] += _pstTriangle->adEdgeDY[0];
+        adE[1] += _pstTriangle->adEdgeDY[1];
+        adE[2] += _pstTriangle->adEdgeDY[2];
+      }
+
+      /* Shades span */
+      orxDisplay_Software_ShadeSpan(_pstTriangle, s32Start, s32Y, s32X - s32Start, afL, afDL);
+    }
+  }
+
+  /* Done! */
+  return;
+}
+
+static void orxFASTCALL orxDisplay_Software_RasterizeTiles(orxU32 _u32Start, orxU32 _u32End, void *_pContext)
+{
+  orxU32 u32Tile;
+
+  /* For all tiles */
+  for(u32Tile = _u32Start; u32Tile < _u32End; u32Tile++)
+  {
+    orxS32 s32TileMinX, s32TileMinY, s32TileMaxX, s32TileMaxY;
+    orxU32 i;
+
+    /* Gets tile area */
+    s32TileMinX = sstDisplay.s32ClipMinX + (orxS32)((u32Tile % sstDisplay.u32TileCountX) * orxDISPLAY_KU32_TILE_SIZE);
+    s32TileMinY = sstDisplay.s32ClipMinY + (orxS32)((u32Tile / sstDisplay.u32TileCountX) * orxDISPLAY_KU32_TILE_SIZE);
+    s32TileMaxX = orxMIN(s32TileMinX + (orxS32)orxDISPLAY_KU32_TILE_SIZE, sstDisplay.s32ClipMaxX);
+    s32TileMaxY = orxMIN(s32TileMinY + (orxS32)orxDISPLAY_KU32_TILE_SIZE, sstDisplay.s32ClipMaxY);
+
+    /* For all triangles, in submission order */
+    for(i = 0; i < sstDisplay.u32TriangleCount; i++)
+    {
+      const orxDISPLAY_TRIANGLE  *pstTriangle;
+      orxS32                      s32MinX, s32MinY, s32MaxX, s32MaxY;
+
+      /* Gets it */
+      pstTriangle = &(sstDisplay.astTriangleList[i]);
+
+      /* Gets its overlap with the tile */
+      s32MinX = orxMAX(pstTriangle->s32MinX, s32TileMinX);
+      s32MinY = orxMAX(pstTriangle->s32MinY, s32TileMinY);
+      s32MaxX = orxMIN(pstTriangle->s32MaxX, s32TileMaxX);
+      s32MaxY = orxMIN(pstTriangle->s32MaxY, s32TileMaxY);
+
+      /* Overlaps? */
+      if((s32MinX < s32MaxX) && (s32MinY < s32MaxY))
+      {
+        /* Rasterizes it */
+        orxDisplay_Software_RasterizeTriangle(pstTriangle, s32MinX, s32MinY, s32MaxX, s32MaxY);
+      }
+    }
+  }
+
+  /* Done! */
+  return;
+}
+
+static void orxFASTCALL orxDisplay_Software_DrawTriangles()
+{
+  /* Has triangles? */
+  if(sstDisplay.u32TriangleCount != 0)
+  {
+    orxU32 u32TileCountY;
+
+    /* Profiles */
+    orxPROFILER_PUSH_MARKER("orxDisplay_DrawTriangles");
+
+    /* Gets tile grid */
+    sstDisplay.u32TileCountX  = ((orxU32)(sstDisplay.s32ClipMaxX - sstDisplay.s32ClipMinX) + orxDISPLAY_KU32_TILE_SIZE - 1) / orxDISPLAY_KU32_TILE_SIZE;
+    u32TileCountY             = ((orxU32)(sstDisplay.s32ClipMaxY - sstDisplay.s32ClipMinY) + orxDISPLAY_KU32_TILE_SIZE - 1) / orxDISPLAY_KU32_TILE_SIZE;
+
+    /* Rasterizes all tiles */
+    orxThread_ParallelFor(sstDisplay.u32TileCountX * u32TileCountY, orxDISPLAY_KU32_TILE_GRAIN, orxDisplay_Software_RasterizeTiles, orxNULL);
+
+    /* Clears batch */
+    sstDisplay.u32TriangleCount = 0;
+
+    /* Profiles */
+    orxPROFILER_POP_MARKER();
+  }
+
+  /* Done! */
+  return;
+}
+
+static void orxFASTCALL orxDisplay_Software_UpdateClipping()
+{
+  const orxBITMAP *pstDestination;
+
+  /* Draws remaining items */
+  orxDisplay_Software_DrawTriangles();
+
+  /* Gets first destination */
+  pstDestination = sstDisplay.apstDestinationBitmapList[0];
+
+  /* Valid? */
+  if(pstDestination != orxNULL)
+  {
+    /* Stores its clipping, limited to its size */
+    sstDisplay.s32ClipMinX = orxCLAMP(orxF2S(pstDestination->stClip.vTL.fX), 0, (orxS32)pstDestination->u32RealWidth);
+    sstDisplay.s32ClipMinY = orxCLAMP(orxF2S(pstDestination->stClip.vTL.fY), 0, (orxS32)pstDestination->u32RealHeight);
+    sstDisplay.s32ClipMaxX = orxCLAMP(orxF2S(pstDestination->stClip.vBR.fX), sstDisplay.s32ClipMinX, (orxS32)pstDestination->u32RealWidth);
+    sstDisplay.s32ClipMaxY = orxCLAMP(orxF2S(pstDestination->stClip.vBR.fY), sstDisplay.s32ClipMinY, (orxS32)pstDestination->u32RealHeight);
+  }
+  else
+  {
+    /* Clears clipping */
+    sstDisplay.s32ClipMinX =
+    sstDisplay.s32ClipMinY =
+    sstDisplay.s32ClipMaxX =
+    sstDisplay.s32ClipMaxY = 0;
+  }
+
+  /* Done! */
+  return;
+}
+
+static orxINLINE orxDOUBLE orxDisplay_Software_Snap(orxFLOAT _fValue)
+{
+  /* Done! */
+  return (orxDOUBLE)orxMath_Floor(_fValue * orxDISPLAY_KF_SUBPIXEL_PRECISION + orx2F(0.5f)) / (orxDOUBLE)orxDISPLAY_KF_SUBPIXEL_PRECISION;
+}
+
+static void orxFASTCALL orxDisplay_Software_AddTriangle(const orxDISPLAY_VERTEX *_pstVertex0, const orxDISPLAY_VERTEX *_pstVertex1, const orxDISPLAY_VERTEX *_pstVertex2, const orxBITMAP *_pstBitmap, orxBOOL _bSmoothing, orxDISPLAY_BLEND_MODE _eBlendMode)
+{
+  const orxDISPLAY_VERTEX  *apstVertexList[3];
+  orxDOUBLE                 adX[3], adY[3], dArea, dSign;
+  orxFLOAT                  fMinX, fMinY, fMaxX, fMaxY;
+  orxS32                    s32MinX, s32MinY, s32MaxX, s32MaxY;
+  orxU32                    i;
+
+  /* Gets vertices */
+  apstVertexList[0] = _pstVertex0;
+  apstVertexList[1] = _pstVertex1;
+  apstVertexList[2] = _pstVertex2;
+
+  /* Snaps positions & gets bounding box */
+  fMinX = fMaxX = _pstVertex0->fX;
+  fMinY = fMaxY = _pstVertex0->fY;
+  for(i = 0; i < 3; i++)
+  {
+    adX[i] = orxDisplay_Software_Snap(apstVertexList[i]->fX);
+    adY[i] = orxDisplay_Software_Snap(apstVertexList[i]->fY);
+    fMinX  = orxMIN(fMinX, apstVertexList[i]->fX);
+    fMinY  = orxMIN(fMinY, apstVertexList[i]->fY);
+    fMaxX  = orxMAX(fMaxX, apstVertexList[i]->fX);
+    fMaxY  = orxMAX(fMaxY, apstVertexList[i]->fY);
+  }
+
+  /* Gets covered pixels, limited to clipping area */
+  s32MinX = (orxS32)orxMath_Floor(orxCLAMP(fMinX, orxS2F(sstDisplay.s32ClipMinX), orxS2F(sstDisplay.s32ClipMaxX)));
+  s32MinY = (orxS32)orxMath_Floor(orxCLAMP(fMinY, orxS2F(sstDisplay.s32ClipMinY), orxS2F(sstDisplay.s32ClipMaxY)));
+  s32MaxX = (orxS32)orxMath_Ceil(orxCLAMP(fMaxX + orxFLOAT_1, orxS2F(sstDisplay.s32ClipMinX), orxS2F(sstDisplay.s32ClipMaxX)));
+  s32MaxY = (orxS32)orxMath_Ceil(orxCLAMP(fMaxY + orxFLOAT_1, orxS2F(sstDisplay.s32ClipMinY), orxS2F(sstDisplay.s32ClipMaxY)));
+
+  /* Gets signed area */
+  dArea = (adX[0] - adX[1]) * (adY[2] - adY[1]) - (adY[0] - adY[1]) * (adX[2] - adX[1]);
+
+  /* Visible and not degenerate? */
+  if((s32MinX < s32MaxX) && (s32MinY < s32MaxY) && (dArea != 0.0))
+  {
+    orxDISPLAY_TRIANGLE *pstTriangle;
+
+    /* Batch full? */
+    if(sstDisplay.u32TriangleCount == orxDISPLAY_KU32_TRIANGLE_BUFFER_SIZE)
+    {
+      /* Draws remaining items */
+      orxDisplay_Software_DrawTriangles();
+    }
+
+    /* Gets new triangle */
+    pstTriangle = &(sstDisplay.astTriangleList[sstDisplay.u32TriangleCount++]);
+
+    /* Gets orientation */
+    dSign = (dArea > 0.0) ? 1.0 : -1.0;
+
+    /* Inits it */
+    pstTriangle->fRecArea   = (orxFLOAT)(1.0 / (dArea * dSign));
+    pstTriangle->pstBitmap  = _pstBitmap;
+    pstTriangle->s32MinX    = s32MinX;
+    pstTriangle->s32MinY    = s32MinY;
+    pstTriangle->s32MaxX    = s32MaxX;
+    pstTriangle->s32MaxY    = s32MaxY;
+    pstTriangle->eBlendMode = _eBlendMode;
+    pstTriangle->u32Flags   = (_bSmoothing != orxFALSE) ? orxDISPLAY_KU32_TRIANGLE_FLAG_SMOOTHING : orxDISPLAY_KU32_TRIANGLE_FLAG_NONE;
+
+    /* For all vertices */
+    for(i = 0; i < 3; i++)
+    {
+      orxU32 u32Next, u32Last;
+
+      /* Gets opposite edge's vertices */
+      u32Next = (i + 1) % 3;
+      u32Last = (i + 2) % 3;
+
+      /* Stores edge */
+      pstTriangle->adEdgeX[i]   = adX[u32Next];
+      pstTriangle->adEdgeY[i]   = adY[u32Next];
+      pstTriangle->adEdgeDX[i]  = (adX[u32Last] - adX[u32Next]) * dSign;
+      pstTriangle->adEdgeDY[i]  = (adY[u32Last] - adY[u32Next]) * dSign;
+
+      /* Does edge own the pixel centers lying on it? (shared edges are owned by exactly one of their triangles) */
+      if((pstTriangle->adEdgeDY[i] > 0.0) || ((pstTriangle->adEdgeDY[i] == 0.0) && (pstTriangle->adEdgeDX[i] < 0.0)))
+      {
+        /* Updates flags */
+        pstTriangle->u32Flags |= orxDISPLAY_KU32_TRIANGLE_FLAG_EDGE_0 << i;
+      }
+
+      /* Stores color */
+      pstTriangle->afR[i] = orxCOLOR_NORMALIZER * orxU2F(apstVertexList[i]->stRGBA.u8R);
+      pstTriangle->afG[i] = orxCOLOR_NORMALIZER * orxU2F(apstVertexList[i]->stRGBA.u8G);
+      pstTriangle->afB[i] = orxCOLOR_NORMALIZER * orxU2F(apstVertexList[i]->stRGBA.u8B);
+      pstTriangle->afA[i] = orxCOLOR_NORMALIZER * orxU2F(apstVertexList[i]->stRGBA.u8A);
+
+      /* Textured? */
+      if(_pstBitmap != orxNULL)
+      {
+        /* Stores texel coordinates */
+        pstTriangle->afU[i] = apstVertexList[i]->fU * orxU2F(_pstBitmap->u32RealWidth);
+        pstTriangle->afV[i] = apstVertexList[i]->fV * orxU2F(_pstBitmap->u32RealHeight);
+      }
+    }
+
+    /* Flat color? */
+    if((_pstVertex0->stRGBA.u32RGBA == _pstVertex1->stRGBA.u32RGBA)
+    && (_pstVertex0->stRGBA.u32RGBA == _pstVertex2->stRGBA.u32RGBA))
+    {
+      /* Updates flags */
+      pstTriangle->u32Flags |= orxDISPLAY_KU32_TRIANGLE_FLAG_FLAT;
+    }
+  }
+
+  /* Done! */
+  return;
+}
+
+static orxINLINE void orxDisplay_Software_AddQuad(const orxDISPLAY_VERTEX *_astVertexList, const orxBITMAP *_pstBitmap, orxBOOL _bSmoothing, orxDISPLAY_BLEND_MODE _eBlendMode)
+{
+  /* Adds both triangles, with the same layout as the strip used by other display plugins */
+  orxDisplay_Software_AddTriangle(&(_astVertexList[0]), &(_astVertexList[1]), &(_astVertexList[2]), _pstBitmap, _bSmoothing, _eBlendMode);
+  orxDisplay_Software_AddTriangle(&(_astVertexList[2]), &(_astVertexList[1]), &(_astVertexList[3]), _pstBitmap, _bSmoothing, _eBlendMode);
+
+  /* Done! */
+  return;
+}
+
+static void orxFASTCALL orxDisplay_Software_AddLine(const orxDISPLAY_VERTEX *_pstStart, const orxDISPLAY_VERTEX *_pstEnd, const orxBITMAP *_pstBitmap, orxBOOL _bSmoothing, orxDISPLAY_BLEND_MODE _eBlendMode)
+{
+  orxDISPLAY_VERTEX astVertexList[4];
+  orxFLOAT          fDX, fDY, fLength;
+
+  /* Gets direction */
+  fDX     = _pstEnd->fX - _pstStart->fX;
+  fDY     = _pstEnd->fY - _pstStart->fY;
+  fLength = orxMath_Sqrt(fDX * fDX + fDY * fDY);
+
+  /* Gets half-width normal */
+  if(fLength > orxMATH_KF_EPSILON)
+  {
+    fDX = fDX * orxDISPLAY_KF_LINE_HALF_WIDTH / fLength;
+    fDY = fDY * orxDISPLAY_KF_LINE_HALF_WIDTH / fLength;
+  }
+  else
+  {
+    /* Draws a single pixel */
+    fDX = orxDISPLAY_KF_LINE_HALF_WIDTH;
+    fDY = orxFLOAT_0;
+  }
+
+  /* Builds line quad, extended by half a pixel on both ends */
+  astVertexList[0]    = *_pstStart;
+  astVertexList[1]    = *_pstStart;
+  astVertexList[2]    = *_pstEnd;
+  astVertexList[3]    = *_pstEnd;
+  astVertexList[0].fX = _pstStart->fX - fDX + fDY;
+  astVertexList[0].fY = _pstStart->fY - fDY - fDX;
+  astVertexList[1].fX = _pstStart->fX - fDX - fDY;
+  astVertexList[1].fY = _pstStart->fY - fDY + fDX;
+  astVertexList[2].fX = _pstEnd->fX + fDX + fDY;
+  astVertexList[2].fY = _pstEnd->fY + fDY - fDX;
+  astVertexList[3].fX = _pstEnd->fX + fDX - fDY;
+  astVertexList[3].fY = _pstEnd->fY + fDY + fDX;
+
+  /* Adds it */
+  orxDisplay_Software_AddQuad(astVertexList, _pstBitmap, _bSmoothing, _eBlendMode);
+
+  /* Done! */
+  return;
+}
+
+static void orxFASTCALL orxDisplay_Software_DrawPrimitive(const orxVECTOR *_avVertexList, orxU32 _u32VertexNumber, orxRGBA _stColor, orxBOOL _bFill, orxBOOL _bOpen)
+{
+  orxDISPLAY_VERTEX     astVertexList[orxDISPLAY_KU32_CIRCLE_LINE_NUMBER];
+  orxDISPLAY_BLEND_MODE eBlendMode;
+  orxU32                i;
+
+  /* Checks */
+  orxASSERT(_u32VertexNumber > 0);
+
+  /* Gets blend mode */
+  eBlendMode = (orxRGBA_A(_stColor) != 0xFF) ? orxDISPLAY_BLEND_MODE_ALPHA : orxDISPLAY_BLEND_MODE_NONE;
+
+  /* Inits vertices */
+  orxMemory_Zero(astVertexList, sizeof(astVertexList));
+  for(i = 0; i < orxDISPLAY_KU32_CIRCLE_LINE_NUMBER; i++)
+  {
+    astVertexList[i].stRGBA = _stColor;
+  }
+
+  /* Should fill? */
+  if((_bFill != orxFALSE) && (_u32VertexNumber > 2))
+  {
+    /* Stores fan center */
+    astVertexList[0].fX = _avVertexList[0].fX;
+    astVertexList[0].fY = _avVertexList[0].fY;
+
+    /* For all triangles */
+    for(i = 2; i < _u32VertexNumber; i++)
+    {
+      /* Stores its vertices */
+      astVertexList[1].fX = _avVertexList[i - 1].fX;
+      astVertexList[1].fY = _avVertexList[i - 1].fY;
+      astVertexList[2].fX = _avVertexList[i].fX;
+      astVertexList[2].fY = _avVertexList[i].fY;
+
+      /* Adds it */
+      orxDisplay_Software_AddTriangle(&(astVertexList[0]), &(astVertexList[1]), &(astVertexList[2]), orxNULL, orxFALSE, eBlendMode);
+    }
+  }
+  else
+  {
+    orxU32 u32LineNumber;
+
+    /* Gets line number */
+    u32LineNumber = ((_bOpen != orxFALSE) || (_u32VertexNumber <= 2)) ? orxMAX(_u32VertexNumber, 2) - 1 : _u32VertexNumber;
+
+    /* For all lines */
+    for(i = 0; i < u32LineNumber; i++)
+    {
+      /* Stores its vertices */
+      astVertexList[0].fX = _avVertexList[i].fX;
+      astVertexList[0].fY = _avVertexList[i].fY;
+      astVertexList[1].fX = _avVertexList[(i + 1) % _u32VertexNumber].fX;
+      astVertexList[1].fY = _avVertexList[(i + 1) % _u32VertexNumber].fY;
+
+      /* Adds it */
+      orxDisplay_Software_AddLine(&(astVertexList[0]), &(astVertexList[1]), orxNULL, orxFALSE, eBlendMode);
+    }
+  }
+
+  /* Done! */
+  return;
+}
+
+static orxINLINE orxU32 orxDisplay_Software_GetMeshIndex(const orxDISPLAY_MESH *_pstMesh, orxU32 _u32Element)
+{
+  orxU32 u32Result;
+
+  /* Has index list? */
+  if((_pstMesh->au16IndexList != orxNULL) && (_pstMesh->u32IndexNumber != 0))
+  {
+    /* Gets index */
+    u32Result = (orxU32)_pstMesh->au16IndexList[_u32Element];
+  }
+  else
+  {
+    static const orxU32 sau32QuadIndexList[6] = {0, 0, 1, 2, 3, 3};
+
+    /* Gets default index, as a list of quads linked by degenerate triangles */
+    u32Result = 4 * (_u32Element / 6) + sau32QuadIndexList[_u32Element % 6];
+  }
+
+  /* Done! */
+  return u32Result;
+}
+
+static orxSTATUS orxFASTCALL orxDisplay_Software_SaveBitmapData(void *_pContext)
+{
+  orxDISPLAY_SAVE_INFO *pstInfo;
+  const orxCHAR        *zExtension;
+  const orxSTRING       zFilename;
+  orxU32                u32Length;
+  orxSTATUS             eResult = orxSTATUS_FAILURE;
+
+  /* Gets save info */
+  pstInfo = (orxDISPLAY_SAVE_INFO *)_pContext;
+
+  /* Gets filename */
+  zFilename = orxString_GetFromID(pstInfo->stFilenameID);
+
+  /* Gets file name's length */
+  u32Length = orxString_GetLength(zFilename);
+
+  /* Gets extension */
+  zExtension = (u32Length > 3) ? zFilename + u32Length - 3 : orxSTRING_EMPTY;
+
+  /* PNG? */
+  if(orxString_ICompare(zExtension, "png") == 0)
+  {
+    /* Saves image to disk */
+    eResult = stbi_write_png(zFilename, pstInfo->u32Width, pstInfo->u32Height, 4, pstInfo->pu8ImageData, 0) != 0 ? orxSTATUS_SUCCESS : orxSTATUS_FAILURE;
+  }
+  /* BMP? */
+  else if(orxString_ICompare(zExtension, "bmp") == 0)
+  {
+    /* Saves image to disk */
+    eResult = stbi_write_bmp(zFilename, pstInfo->u32Width, pstInfo->u32Height, 4, pstInfo->pu8ImageData) != 0 ? orxSTATUS_SUCCESS : orxSTATUS_FAILURE;
+  }
+  /* TGA */
+  else
+  {
+    /* Saves image to disk */
+    eResult = stbi_write_tga(zFilename, pstInfo->u32Width, pstInfo->u32Height, 4, pstInfo->pu8ImageData) != 0 ? orxSTATUS_SUCCESS : orxSTATUS_FAILURE;
+  }
+
+  /* Deletes data */
+  orxMemory_Free(pstInfo->pu8ImageData);
+
+  /* Deletes save info */
+  orxMemory_Free(pstInfo);
+
+  /* Done! */
+  return eResult;
+}
+
+static orxSTATUS orxFASTCALL orxDisplay_Software_NotifyBitmapData(void *_pContext)
+{
+  orxDISPLAY_READ_INFO *pstInfo;
+
+  /* Gets read info */
+  pstInfo = (orxDISPLAY_READ_INFO *)_pContext;
+
+  /* Calls callback */
+  pstInfo->pfnCallback(pstInfo->pstBitmap, pstInfo->u32ByteNumber, pstInfo->au8Data, pstInfo->pContext);
+
+  /* Deletes read info */
+  orxMemory_Free(pstInfo);
+
+  /* Done! */
+  return orxSTATUS_SUCCESS;
+}
+
+static orxSTATUS orxFASTCALL orxDisplay_Software_DecompressBitmapCallback(void *_pContext)
+{
+  orxDISPLAY_LOAD_INFO *pstInfo;
+  orxSTATUS             eResult = orxSTATUS_SUCCESS;
+
+  /* Gets load info */
+  pstInfo = (orxDISPLAY_LOAD_INFO *)_pContext;
+
+  /* Hasn't exited yet? */
+  if(sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY)
+  {
+    orxDISPLAY_EVENT_PAYLOAD  stPayload;
+    orxBITMAP                *pstBitmap;
+
+    /* Gets bitmap */
+    pstBitmap = pstInfo->pstBitmap;
+
+    /* Draws remaining items, as they might still refer to the placeholder data */
+    orxDisplay_Software_DrawTriangles();
+
+    /* Failed decompression? */
+    if(pstInfo->pu8ImageBuffer == orxNULL)
+    {
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "Couldn't process data for bitmap <%s>: an empty texture will be used instead.", pstBitmap->zLocation);
+
+      /* Uses an empty pixel instead */
+      pstInfo->u32Width       =
+      pstInfo->u32Height      = 1;
+      pstInfo->pu8ImageBuffer = (orxU8 *)orxMemory_Allocate(sizeof(orxRGBA), orxMEMORY_TYPE_VIDEO);
+      orxMemory_Zero(pstInfo->pu8ImageBuffer, sizeof(orxRGBA));
+    }
+
+    /* Inits bitmap, taking ownership of the decompressed data */
+    pstBitmap->astData        = (orxRGBA *)pstInfo->pu8ImageBuffer;
+    pstBitmap->fWidth         = orxU2F(pstInfo->u32Width);
+    pstBitmap->fHeight        = orxU2F(pstInfo->u32Height);
+    pstBitmap->u32RealWidth   = pstInfo->u32Width;
+    pstBitmap->u32RealHeight  = pstInfo->u32Height;
+    pstBitmap->u32Depth       = 32;
+    pstBitmap->fRecRealWidth  = orxFLOAT_1 / pstBitmap->fWidth;
+    pstBitmap->fRecRealHeight = orxFLOAT_1 / pstBitmap->fHeight;
+    pstBitmap->u32DataSize    = pstInfo->u32Width * pstInfo->u32Height * sizeof(orxRGBA);
+    pstBitmap->u32ID          = ++sstDisplay.u32BitmapCounter;
+    orxVector_Copy(&(pstBitmap->stClip.vTL), &orxVECTOR_0);
+    orxVector_Set(&(pstBitmap->stClip.vBR), pstBitmap->fWidth, pstBitmap->fHeight, orxFLOAT_0);
+
+    /* Inits payload */
+    stPayload.stBitmap.zLocation    = pstBitmap->zLocation;
+    stPayload.stBitmap.stFilenameID = pstBitmap->stFilenameID;
+    stPayload.stBitmap.u32ID        = (pstInfo->pu8ImageSource != orxNULL) ? pstBitmap->u32ID : orxU32_UNDEFINED;
+    stPayload.stBitmap.au8Data      = (pstInfo->pu8ImageSource != orxNULL) ? pstInfo->pu8ImageBuffer : orxNULL;
+    stPayload.stBitmap.u32LineSize  = pstInfo->u32Width * sizeof(orxRGBA);
+
+    /* Sends event */
+    orxEVENT_SEND(orxEVENT_TYPE_DISPLAY, orxDISPLAY_EVENT_LOAD_BITMAP, pstBitmap, orxNULL, &stPayload);
+
+    /* Clears loading flag */
+    orxFLAG_SET(pstBitmap->u32Flags, orxDISPLAY_KU32_BITMAP_FLAG_NONE, orxDISPLAY_KU32_BITMAP_FLAG_LOADING);
+    orxMEMORY_BARRIER();
+
+    /* Asked for deletion? */
+    if(orxFLAG_TEST(pstBitmap->u32Flags, orxDISPLAY_KU32_BITMAP_FLAG_DELETE))
+    {
+      /* Deletes it */
+      orxDisplay_DeleteBitmap(pstBitmap);
+    }
+  }
+  else
+  {
+    /* Frees image buffer */
+    if(pstInfo->pu8ImageBuffer != orxNULL)
+    {
+      orxMemory_Free(pstInfo->pu8ImageBuffer);
+    }
+  }
+
+  /* Closes resource */
+  orxResource_Close(pstInfo->hResource);
+
+  /* Frees load info */
+  orxMemory_Free(pstInfo);
+
+  /* Done! */
+  return eResult;
+}
+
+static orxSTATUS orxFASTCALL orxDisplay_Software_DecompressBitmap(void *_pContext)
+{
+  orxDISPLAY_LOAD_INFO *pstInfo;
+  orxSTATUS             eResult;
+
+  /* Profiles */
+  orxPROFILER_PUSH_MARKER("orxDisplay_DecompressBitmap");
+
+  /* Gets load info */
+  pstInfo = (orxDISPLAY_LOAD_INFO *)_pContext;
+
+  /* Hasn't exited yet? */
+  if(sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY)
+  {
+    int iWidth, iHeight, iBytesPerPixel;
+
+    /* Loads image, straight in its final format */
+    pstInfo->pu8ImageBuffer = (orxU8 *)stbi_load_from_memory((const unsigned char *)pstInfo->pu8ImageSource, (int)pstInfo->s64Size, &iWidth, &iHeight, &iBytesPerPixel, STBI_rgb_alpha);
+
+    /* Valid? */
+    if(pstInfo->pu8ImageBuffer != orxNULL)
+    {
+      /* Stores its size */
+      pstInfo->u32Width   = (orxU32)iWidth;
+      pstInfo->u32Height  = (orxU32)iHeight;
+    }
+    else
+    {
+      /* Clears source */
+      pstInfo->pu8ImageSource = orxNULL;
+    }
+
+    /* Releases source data, the resource will get closed from the main thread */
+    orxResource_Unmap(pstInfo->hResource);
+
+    /* Updates result */
+    eResult = orxSTATUS_SUCCESS;
+  }
+  else
+  {
+    /* Unmaps source, as the resource can't be closed from this thread */
+    orxResource_Unmap(pstInfo->hResource);
+
+    /* Frees load info */
+    orxMemory_Free(pstInfo);
+
+    /* Updates result */
+    eResult = orxSTATUS_FAILURE;
+  }
+
+  /* Profiles */
+  orxPROFILER_POP_MARKER();
+
+  /* Done! */
+  return eResult;
+}
+
+static orxSTATUS orxFASTCALL orxDisplay_Software_LoadBitmapData(orxBITMAP *_pstBitmap)
+{
+  orxHANDLE hResource;
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  /* Opens resource */
+  hResource = orxResource_Open(_pstBitmap->zLocation, orxFALSE);
+
+  /* Success? */
+  if(hResource != orxHANDLE_UNDEFINED)
+  {
+    const orxU8  *pu8Source;
+    orxS64        s64Size;
+
+    /* Maps it */
+    pu8Source = (const orxU8 *)orxResource_Map(hResource, orxTRUE, &s64Size);
+
+    /* Success? */
+    if(pu8Source != orxNULL)
+    {
+      orxDISPLAY_LOAD_INFO *pstInfo;
+
+      /* Checks */
+      orxASSERT((s64Size > 0) && (s64Size < 0x7FFFFFFF));
+
+      /* Allocates load info */
+      pstInfo = (orxDISPLAY_LOAD_INFO *)orxMemory_Allocate(sizeof(orxDISPLAY_LOAD_INFO), orxMEMORY_TYPE_TEMP);
+
+      /* Checks */
+      orxASSERT(pstInfo != orxNULL);
+
+      /* Inits it */
+      orxMemory_Zero(pstInfo, sizeof(orxDISPLAY_LOAD_INFO));
+      pstInfo->pu8ImageSource = pu8Source;
+      pstInfo->s64Size        = s64Size;
+      pstInfo->pstBitmap      = _pstBitmap;
+      pstInfo->hResource      = hResource;
+
+      /* Asynchronous? */
+      if(sstDisplay.pstTempBitmap != orxNULL)
+      {
+        int iWidth, iHeight, iComp;
+
+        /* Gets its info */
+        if(stbi_info_from_memory((const unsigned char *)pu8Source, (int)s64Size, &iWidth, &iHeight, &iComp) != 0)
+        {
+          /* Updates asynchronous loading flag */
+          orxFLAG_SET(_pstBitmap->u32Flags, orxDISPLAY_KU32_BITMAP_FLAG_LOADING, orxDISPLAY_KU32_BITMAP_FLAG_NONE);
+
+          /* Inits bitmap info using temp, whose content will be displayed till loading is over */
+          _pstBitmap->astData         = sstDisplay.pstTempBitmap->astData;
+          _pstBitmap->fWidth          = orxS2F(iWidth);
+          _pstBitmap->fHeight         = orxS2F(iHeight);
+          _pstBitmap->u32RealWidth    = sstDisplay.pstTempBitmap->u32RealWidth;
+          _pstBitmap->u32RealHeight   = sstDisplay.pstTempBitmap->u32RealHeight;
+          _pstBitmap->u32Depth        = sstDisplay.pstTempBitmap->u32Depth;
+          _pstBitmap->fRecRealWidth   = sstDisplay.pstTempBitmap->fRecRealWidth;
+          _pstBitmap->fRecRealHeight  = sstDisplay.pstTempBitmap->fRecRealHeight;
+          _pstBitmap->u32DataSize     = sstDisplay.pstTempBitmap->u32DataSize;
+          orxVector_Copy(&(_pstBitmap->stClip.vTL), &(sstDisplay.pstTempBitmap->stClip.vTL));
+          orxVector_Copy(&(_pstBitmap->stClip.vBR), &(sstDisplay.pstTempBitmap->stClip.vBR));
+
+          /* Runs asynchronous task */
+          if(orxThread_RunTask(&orxDisplay_Software_DecompressBitmap, orxDisplay_Software_DecompressBitmapCallback, orxNULL, (void *)pstInfo) != orxSTATUS_FAILURE)
+          {
+            /* Updates result */
+            eResult = orxSTATUS_SUCCESS;
+          }
+          else
+          {
+            /* Clears asynchronous loading flag */
+            orxFLAG_SET(_pstBitmap->u32Flags, orxDISPLAY_KU32_BITMAP_FLAG_NONE, orxDISPLAY_KU32_BITMAP_FLAG_LOADING);
+
+            /* Frees load info */
+            orxMemory_Free(pstInfo);
+
+            /* Closes resource */
+            orxResource_Close(hResource);
+          }
+        }
+        else
+        {
+          /* Frees load info */
+          orxMemory_Free(pstInfo);
+
+          /* Closes resource */
+          orxResource_Close(hResource);
+        }
+      }
+      else
+      {
+        /* Decompresses bitmap */
+        orxDisplay_Software_DecompressBitmap(pstInfo);
+
+        /* Inits bitmap with its data */
+        orxDisplay_Software_DecompressBitmapCallback(pstInfo);
+
+        /* Updates result */
+        eResult = orxSTATUS_SUCCESS;
+      }
+    }
+    else
+    {
+      /* Closes resource */
+      orxResource_Close(hResource);
+    }
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+static void orxFASTCALL orxDisplay_Software_DeleteBitmapData(orxBITMAP *_pstBitmap)
+{
+  /* Is last bitmap? */
+  if(_pstBitmap == sstDisplay.pstLastBitmap)
+  {
+    /* Clears it */
+    sstDisplay.pstLastBitmap = orxNULL;
+  }
+
+  /* Has data? */
+  if(_pstBitmap->astData != orxNULL)
+  {
+    /* Frees it */
+    orxMemory_Free(_pstBitmap->astData);
+    _pstBitmap->astData = orxNULL;
+  }
+
+  /* Done! */
+  return;
+}
+
+static void orxFASTCALL orxDisplay_Software_FillBitmap(orxBITMAP *_pstBitmap, orxRGBA _stColor, orxBOOL _bClip)
+{
+  orxU32 u32MinX, u32MinY, u32MaxX, u32MaxY, i, j;
+
+  /* Should clip? */
+  if(_bClip != orxFALSE)
+  {
+    /* Uses current clipping */
+    u32MinX = (orxU32)sstDisplay.s32ClipMinX;
+    u32MinY = (orxU32)sstDisplay.s32ClipMinY;
+    u32MaxX = (orxU32)sstDisplay.s32ClipMaxX;
+    u32MaxY = (orxU32)sstDisplay.s32ClipMaxY;
+  }
+  else
+  {
+    /* Uses full bitmap */
+    u32MinX = 0;
+    u32MinY = 0;
+    u32MaxX = _pstBitmap->u32RealWidth;
+    u32MaxY = _pstBitmap->u32RealHeight;
+  }
+
+  /* For all lines */
+  for(j = u32MinY; j < u32MaxY; j++)
+  {
+    orxRGBA *astLine;
+
+    /* Gets line */
+    astLine = &(_pstBitmap->astData[j * _pstBitmap->u32RealWidth]);
+
+    /* For all columns */
+    for(i = u32MinX; i < u32MaxX; i++)
+    {
+      /* Sets pixel */
+      astLine[i] = _stColor;
+    }
+  }
+
+  /* Done! */
+  return;
+}
+
+
+/***************************************************************************
+ * Public functions                                                        *
+ ***************************************************************************/
+
+orxBITMAP *orxFASTCALL orxDisplay_Software_GetScreenBitmap()
+{
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+
+  /* Done! */
+  return sstDisplay.pstScreen;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Software_TransformText(const orxSTRING _zString, const orxBITMAP *_pstFont, const orxCHARACTER_MAP *_pstMap, const orxDISPLAY_TRANSFORM *_pstTransform, orxRGBA _stColor, orxDISPLAY_SMOOTHING _eSmoothing, orxDISPLAY_BLEND_MODE _eBlendMode)
+{
+  orxDISPLAY_MATRIX mTransform;
+  orxDISPLAY_VERTEX astVertexList[4];
+  const orxCHAR    *pc;
+  orxU32            u32CharacterCodePoint;
+  orxFLOAT          fX, fY, fHeight;
+  orxBOOL           bSmoothing;
+  orxSTATUS         eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_zString != orxNULL);
+  orxASSERT(_pstFont != orxNULL);
+  orxASSERT(_pstMap != orxNULL);
+  orxASSERT(_pstTransform != orxNULL);
+
+  /* Inits matrix */
+  orxDisplay_Software_InitMatrix(&mTransform, _pstTransform->fDstX, _pstTransform->fDstY, _pstTransform->fScaleX, _pstTransform->fScaleY, _pstTransform->fRotation, _pstTransform->fSrcX, _pstTransform->fSrcY);
+
+  /* Gets character's height */
+  fHeight = _pstMap->fCharacterHeight;
+
+  /* Gets smoothing */
+  bSmoothing = orxDisplay_Software_GetSmoothing(_eSmoothing);
+
+  /* Stores font */
+  sstDisplay.pstLastBitmap = _pstFont;
+
+  /* Fills the color list */
+  astVertexList[0].stRGBA =
+  astVertexList[1].stRGBA =
+  astVertexList[2].stRGBA =
+  astVertexList[3].stRGBA = _stColor;
+
+  /* For all characters */
+  for(u32CharacterCodePoint = orxString_GetFirstCharacterCodePoint(_zString, &pc), fX = orxFLOAT_0, fY = orxFLOAT_0;
+      u32CharacterCodePoint != orxCHAR_NULL;
+      u32CharacterCodePoint = orxString_GetFirstCharacterCodePoint(pc, &pc))
+  {
+    /* Depending on character */
+    switch(u32CharacterCodePoint)
+    {
+      case orxCHAR_CR:
+      {
+        /* Half EOL? */
+        if(*pc == orxCHAR_LF)
+        {
+          /* Updates pointer */
+          pc++;
+        }
+
+        /* Fall through */
+      }
+
+      case orxCHAR_LF:
+      {
+        /* Updates Y position */
+        fY += fHeight;
+
+        /* Resets X position */
+        fX = orxFLOAT_0;
+
+        break;
+      }
+
+      default:
+      {
+        const orxCHARACTER_GLYPH *pstGlyph;
+        orxFLOAT                  fWidth;
+
+        /* Gets glyph from UTF-8 table */
+        pstGlyph = (orxCHARACTER_GLYPH *)orxHashTable_Get(_pstMap->pstCharacterTable, u32CharacterCodePoint);
+
+        /* Valid? */
+        if(pstGlyph != orxNULL)
+        {
+          /* Gets character width */
+          fWidth = pstGlyph->fWidth;
+
+          /* Outputs vertices and texture coordinates */
+          astVertexList[0].fX = (mTransform.vX.fX * fX) + (mTransform.vX.fY * (fY + fHeight)) + mTransform.vX.fZ;
+          astVertexList[0].fY = (mTransform.vY.fX * fX) + (mTransform.vY.fY * (fY + fHeight)) + mTransform.vY.fZ;
+          astVertexList[1].fX = (mTransform.vX.fX * fX) + (mTransform.vX.fY * fY) + mTransform.vX.fZ;
+          astVertexList[1].fY = (mTransform.vY.fX * fX) + (mTransform.vY.fY * fY) + mTransform.vY.fZ;
+          astVertexList[2].fX = (mTransform.vX.fX * (fX + fWidth)) + (mTransform.vX.fY * (fY + fHeight)) + mTransform.vX.fZ;
+          astVertexList[2].fY = (mTransform.vY.fX * (fX + fWidth)) + (mTransform.vY.fY * (fY + fHeight)) + mTransform.vY.fZ;
+          astVertexList[3].fX = (mTransform.vX.fX * (fX + fWidth)) + (mTransform.vX.fY * fY) + mTransform.vX.fZ;
+          astVertexList[3].fY = (mTransform.vY.fX * (fX + fWidth)) + (mTransform.vY.fY * fY) + mTransform.vY.fZ;
+
+          astVertexList[0].fU =
+          astVertexList[1].fU = _pstFont->fRecRealWidth * pstGlyph->fX;
+          astVertexList[2].fU =
+          astVertexList[3].fU = _pstFont->fRecRealWidth * (pstGlyph->fX + fWidth);
+          astVertexList[1].fV =
+          astVertexList[3].fV = _pstFont->fRecRealHeight * pstGlyph->fY;
+          astVertexList[0].fV =
+          astVertexList[2].fV = _pstFont->fRecRealHeight * (pstGlyph->fY + fHeight);
+
+          /* Adds it */
+          orxDisplay_Software_AddQuad(astVertexList, _pstFont, bSmoothing, _eBlendMode);
+        }
+        else
+        {
+          /* Gets default width */
+          fWidth = fHeight;
+        }
+
+        /* Updates X position */
+        fX += fWidth;
+
+        break;
+      }
+    }
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Software_DrawLine(const orxVECTOR *_pvStart, const orxVECTOR *_pvEnd, orxRGBA _stColor)
+{
+  orxVECTOR avVertexList[2];
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pvStart != orxNULL);
+  orxASSERT(_pvEnd != orxNULL);
+
+  /* Copies vertices */
+  orxVector_Copy(&(avVertexList[0]), _pvStart);
+  orxVector_Copy(&(avVertexList[1]), _pvEnd);
+
+  /* Draws it */
+  orxDisplay_Software_DrawPrimitive(avVertexList, 2, _stColor, orxFALSE, orxTRUE);
+
+  /* Done! */
+  return eResult;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Software_DrawPolyline(const orxVECTOR *_avVertexList, orxU32 _u32VertexNumber, orxRGBA _stColor)
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_avVertexList != orxNULL);
+  orxASSERT(_u32VertexNumber > 0);
+
+  /* Draws it */
+  orxDisplay_Software_DrawPrimitive(_avVertexList, _u32VertexNumber, _stColor, orxFALSE, orxTRUE);
+
+  /* Done! */
+  return eResult;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Software_DrawPolygon(const orxVECTOR *_avVertexList, orxU32 _u32VertexNumber, orxRGBA _stColor, orxBOOL _bFill)
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_avVertexList != orxNULL);
+  orxASSERT(_u32VertexNumber > 0);
+
+  /* Draws it */
+  orxDisplay_Software_DrawPrimitive(_avVertexList, _u32VertexNumber, _stColor, _bFill, orxFALSE);
+
+  /* Done! */
+  return eResult;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Software_DrawCircle(const orxVECTOR *_pvCenter, orxFLOAT _fRadius, orxRGBA _stColor, orxBOOL _bFill)
+{
+  orxVECTOR avVertexList[orxDISPLAY_KU32_CIRCLE_LINE_NUMBER];
+  orxU32    i;
+  orxFLOAT  fAngle;
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pvCenter != orxNULL);
+  orxASSERT(_fRadius >= orxFLOAT_0);
+
+  /* For all vertices */
+  for(i = 0, fAngle = orxFLOAT_0; i < orxDISPLAY_KU32_CIRCLE_LINE_NUMBER; i++, fAngle += orxMATH_KF_2_PI / orxDISPLAY_KU32_CIRCLE_LINE_NUMBER)
+  {
+    /* Computes its coords */
+    orxVector_Set(&(avVertexList[i]), _fRadius * orxMath_Cos(fAngle) + _pvCenter->fX, _fRadius * orxMath_Sin(fAngle) + _pvCenter->fY, orxFLOAT_0);
+  }
+
+  /* Draws it */
+  orxDisplay_Software_DrawPrimitive(avVertexList, orxDISPLAY_KU32_CIRCLE_LINE_NUMBER, _stColor, _bFill, orxFALSE);
+
+  /* Done! */
+  return eResult;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Software_DrawOBox(const orxOBOX *_pstBox, orxRGBA _stColor, orxBOOL _bFill)
+{
+  orxVECTOR avVertexList[4], vOrigin;
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstBox != orxNULL);
+
+  /* Gets origin */
+  orxVector_Sub(&vOrigin, &(_pstBox->vPosition), &(_pstBox->vPivot));
+
+  /* Sets vertices */
+  orxVector_Copy(&(avVertexList[0]), &vOrigin);
+  orxVector_Add(&(avVertexList[1]), &vOrigin, &(_pstBox->vX));
+  orxVector_Add(&(avVertexList[2]), &(avVertexList[1]), &(_pstBox->vY));
+  orxVector_Add(&(avVertexList[3]), &vOrigin, &(_pstBox->vY));
+
+  /* Draws it */
+  orxDisplay_Software_DrawPrimitive(avVertexList, 4, _stColor, _bFill, orxFALSE);
+
+  /* Done! */
+  return eResult;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Software_DrawMesh(const orxDISPLAY_MESH *_pstMesh, const orxBITMAP *_pstBitmap, orxDISPLAY_SMOOTHING _eSmoothing, orxDISPLAY_BLEND_MODE _eBlendMode)
+{
+  const orxBITMAP      *pstBitmap;
+  orxDISPLAY_PRIMITIVE  ePrimitive;
+  orxU32                u32ElementNumber, i;
+  orxBOOL               bSmoothing;
+  orxSTATUS             eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstMesh != orxNULL);
+  orxASSERT(_pstMesh->u32VertexNumber > 1);
+  orxASSERT((_pstMesh->au16IndexList == orxNULL) || (_pstMesh->u32IndexNumber > 1));
+  orxASSERT((_pstMesh->ePrimitive < orxDISPLAY_PRIMITIVE_NUMBER) || ((_pstMesh->ePrimitive == orxDISPLAY_PRIMITIVE_NONE) && (_pstMesh->au16IndexList == orxNULL)));
+
+  /* Gets bitmap to use */
+  pstBitmap = (_pstBitmap != orxNULL) ? _pstBitmap : sstDisplay.pstLastBitmap;
+
+  /* Stores it */
+  sstDisplay.pstLastBitmap = pstBitmap;
+
+  /* Gets smoothing */
+  bSmoothing = orxDisplay_Software_GetSmoothing(_eSmoothing);
+
+  /* Gets primitive */
+  ePrimitive = (_pstMesh->ePrimitive < orxDISPLAY_PRIMITIVE_NUMBER) ? _pstMesh->ePrimitive : orxDISPLAY_PRIMITIVE_TRIANGLE_STRIP;
+
+  /* Gets element number */
+  u32ElementNumber = ((_pstMesh->u32IndexNumber != 0) && (_pstMesh->au16IndexList != orxNULL)) ? _pstMesh->u32IndexNumber : _pstMesh->u32VertexNumber + (_pstMesh->u32VertexNumber >> 1);
+
+  /* Depending on primitive */
+  switch(ePrimitive)
+  {
+    case orxDISPLAY_PRIMITIVE_POINTS:
+    {
+      /* For all points */
+      for(i = 0; i < u32ElementNumber; i++)
+      {
+        const orxDISPLAY_VERTEX  *pstVertex;
+        orxDISPLAY_VERTEX         astVertexList[4];
+
+        /* Gets it */
+        pstVertex = &(_pstMesh->astVertexList[orxDisplay_Software_GetMeshIndex(_pstMesh, i)]);
+
+        /* Builds its pixel quad */
+        astVertexList[0]    =
+        astVertexList[1]    =
+        astVertexList[2]    =
+        astVertexList[3]    = *pstVertex;
+        astVertexList[0].fX =
+        astVertexList[1].fX = pstVertex->fX - orxDISPLAY_KF_LINE_HALF_WIDTH;
+        astVertexList[2].fX =
+        astVertexList[3].fX = pstVertex->fX + orxDISPLAY_KF_LINE_HALF_WIDTH;
+        astVertexList[1].fY =
+        astVertexList[3].fY = pstVertex->fY - orxDISPLAY_KF_LINE_HALF_WIDTH;
+        astVertexList[0].fY =
+        astVertexList[2].fY = pstVertex->fY + orxDISPLAY_KF_LINE_HALF_WIDTH;
+
+        /* Adds it */
+        orxDisplay_Software_AddQuad(astVertexList, pstBitmap, bSmoothing, _eBlendMode);
+      }
+
+      break;
+    }
+
+    case orxDISPLAY_PRIMITIVE_LINES:
+    case orxDISPLAY_PRIMITIVE_LINE_STRIP:
+    case orxDISPLAY_PRIMITIVE_LINE_LOOP:
+    {
+      orxU32 u32Step, u32LineNumber;
+
+      /* Gets line layout */
+      u32Step       = (ePrimitive == orxDISPLAY_PRIMITIVE_LINES) ? 2 : 1;
+      u32LineNumber = (ePrimitive == orxDISPLAY_PRIMITIVE_LINES) ? u32ElementNumber >> 1 : (ePrimitive == orxDISPLAY_PRIMITIVE_LINE_STRIP) ? u32ElementNumber - 1 : u32ElementNumber;
+
+      /* For all lines */
+      for(i = 0; i < u32LineNumber; i++)
+      {
+        /* Adds it */
+        orxDisplay_Software_AddLine(&(_pstMesh->astVertexList[orxDisplay_Software_GetMeshIndex(_pstMesh, i * u32Step)]),
+                                    &(_pstMesh->astVertexList[orxDisplay_Software_GetMeshIndex(_pstMesh, (i * u32Step + 1) % u32ElementNumber)]),
+                                    pstBitmap, bSmoothing, _eBlendMode);
+      }
+
+      break;
+    }
+
+    case orxDISPLAY_PRIMITIVE_TRIANGLES:
+    {
+      /* For all triangles */
+      for(i = 0; i + 2 < u32ElementNumber; i += 3)
+      {
+        /* Adds it */
+        orxDisplay_Software_AddTriangle(&(_pstMesh->astVertexList[orxDisplay_Software_GetMeshIndex(_pstMesh, i)]),
+                                        &(_pstMesh->astVertexList[orxDisplay_Software_GetMeshIndex(_pstMesh, i + 1)]),
+                                        &(_pstMesh->astVertexList[orxDisplay_Software_GetMeshIndex(_pstMesh, i + 2)]),
+                                        pstBitmap, bSmoothing, _eBlendMode);
+      }
+
+      break;
+    }
+
+    case orxDISPLAY_PRIMITIVE_TRIANGLE_FAN:
+    {
+      /* For all triangles */
+      for(i = 2; i < u32ElementNumber; i++)
+      {
+        /* Adds it */
+        orxDisplay_Software_AddTriangle(&(_pstMesh->astVertexList[orxDisplay_Software_GetMeshIndex(_pstMesh, 0)]),
+                                        &(_pstMesh->astVertexList[orxDisplay_Software_GetMeshIndex(_pstMesh, i - 1)]),
+                                        &(_pstMesh->astVertexList[orxDisplay_Software_GetMeshIndex(_pstMesh, i)]),
+                                        pstBitmap, bSmoothing, _eBlendMode);
+      }
+
+      break;
+    }
+
+    default:
+    case orxDISPLAY_PRIMITIVE_TRIANGLE_STRIP:
+    {
+      /* For all triangles (degenerate ones get discarded) */
+      for(i = 2; i < u32ElementNumber; i++)
+      {
+        /* Adds it */
+        orxDisplay_Software_AddTriangle(&(_pstMesh->astVertexList[orxDisplay_Software_GetMeshIndex(_pstMesh, i - 2)]),
+                                        &(_pstMesh->astVertexList[orxDisplay_Software_GetMeshIndex(_pstMesh, i - 1)]),
+                                        &(_pstMesh->astVertexList[orxDisplay_Software_GetMeshIndex(_pstMesh, i)]),
+                                        pstBitmap, bSmoothing, _eBlendMode);
+      }
+
+      break;
+    }
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+void orxFASTCALL orxDisplay_Software_DeleteBitmap(orxBITMAP *_pstBitmap)
+{
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstBitmap != orxNULL);
+
+  /* Not screen? */
+  if(_pstBitmap != sstDisplay.pstScreen)
+  {
+    /* Loading? */
+    if(orxFLAG_TEST(_pstBitmap->u32Flags, orxDISPLAY_KU32_BITMAP_FLAG_LOADING))
+    {
+      /* Asks for deletion */
+      orxFLAG_SET(_pstBitmap->u32Flags, orxDISPLAY_KU32_BITMAP_FLAG_DELETE, orxDISPLAY_KU32_BITMAP_FLAG_NONE);
+    }
+    else
+    {
+      orxU32 i;
+
+      /* Draws remaining items, as they might refer to it */
+      orxDisplay_Software_DrawTriangles();
+
+      /* For all destinations */
+      for(i = 0; i < sstDisplay.u32DestinationBitmapCount; i++)
+      {
+        /* Is deleted bitmap? */
+        if(sstDisplay.apstDestinationBitmapList[i] == _pstBitmap)
+        {
+          /* Falls back to screen */
+          orxDisplay_Software_SetDestinationBitmaps(&(sstDisplay.pstScreen), 1);
+
+          break;
+        }
+      }
+
+      /* Deletes its data */
+      orxDisplay_Software_DeleteBitmapData(_pstBitmap);
+
+      /* Is temp bitmap? */
+      if(_pstBitmap == sstDisplay.pstTempBitmap)
+      {
+        /* Clears temp bitmap */
+        sstDisplay.pstTempBitmap = orxNULL;
+      }
+
+      /* Deletes it */
+      orxBank_Free(sstDisplay.pstBitmapBank, _pstBitmap);
+    }
+  }
+
+  /* Done! */
+  return;
+}
+
+orxBITMAP *orxFASTCALL orxDisplay_Software_CreateBitmap(orxU32 _u32Width, orxU32 _u32Height)
+{
+  orxBITMAP *pstBitmap;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+
+  /* Allocates it */
+  pstBitmap = (orxBITMAP *)orxBank_Allocate(sstDisplay.pstBitmapBank);
+
+  /* Valid? */
+  if(pstBitmap != orxNULL)
+  {
+    /* Inits it */
+    pstBitmap->bSmoothing     = sstDisplay.bDefaultSmoothing;
+    pstBitmap->fWidth         = orxU2F(_u32Width);
+    pstBitmap->fHeight        = orxU2F(_u32Height);
+    pstBitmap->u32RealWidth   = _u32Width;
+    pstBitmap->u32RealHeight  = _u32Height;
+    pstBitmap->u32Depth       = 32;
+    pstBitmap->fRecRealWidth  = orxFLOAT_1 / orxU2F(pstBitmap->u32RealWidth);
+    pstBitmap->fRecRealHeight = orxFLOAT_1 / orxU2F(pstBitmap->u32RealHeight);
+    pstBitmap->u32DataSize    = pstBitmap->u32RealWidth * pstBitmap->u32RealHeight * sizeof(orxRGBA);
+    pstBitmap->u32ID          = ++sstDisplay.u32BitmapCounter;
+    pstBitmap->zLocation      = orxSTRING_EMPTY;
+    pstBitmap->stFilenameID   = orxSTRINGID_UNDEFINED;
+    pstBitmap->u32Flags       = orxDISPLAY_KU32_BITMAP_FLAG_NONE;
+    orxVector_Copy(&(pstBitmap->stClip.vTL), &orxVECTOR_0);
+    orxVector_Set(&(pstBitmap->stClip.vBR), pstBitmap->fWidth, pstBitmap->fHeight, orxFLOAT_0);
+
+    /* Allocates its data */
+    pstBitmap->astData        = (orxRGBA *)orxMemory_Allocate(pstBitmap->u32DataSize, orxMEMORY_TYPE_VIDEO);
+
+    /* Success? */
+    if(pstBitmap->astData != orxNULL)
+    {
+      /* Clears it */
+      orxMemory_Zero(pstBitmap->astData, pstBitmap->u32DataSize);
+    }
+    else
+    {
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "Can't allocate data for a bitmap of size (%u, %u).", _u32Width, _u32Height);
+
+      /* Deletes it */
+      orxBank_Free(sstDisplay.pstBitmapBank, pstBitmap);
+
+      /* Updates result */
+      pstBitmap = orxNULL;
+    }
+  }
+
+  /* Done! */
+  return pstBitmap;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Software_ClearBitmap(orxBITMAP *_pstBitmap, orxRGBA _stColor)
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+
+  /* Draws remaining items */
+  orxDisplay_Software_DrawTriangles();
+
+  /* Stores color */
+  sstDisplay.stLastColor = _stColor;
+
+  /* No bitmap? */
+  if(_pstBitmap == orxNULL)
+  {
+    orxU32 i;
+
+    /* For all destinations */
+    for(i = 0; i < sstDisplay.u32DestinationBitmapCount; i++)
+    {
+      /* Clears its clipping area */
+      orxDisplay_Software_FillBitmap(sstDisplay.apstDestinationBitmapList[i], _stColor, orxTRUE);
+    }
+  }
+  /* Loading? */
+  else if(orxFLAG_TEST(_pstBitmap->u32Flags, orxDISPLAY_KU32_BITMAP_FLAG_LOADING))
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "Can't clear bitmap <%s> as it's not done loading.", _pstBitmap->zLocation);
+
+    /* Updates result */
+    eResult = orxSTATUS_FAILURE;
+  }
+  else
+  {
+    /* Clears it, limited to the clipping area if it's the current destination, as with other display plugins */
+    orxDisplay_Software_FillBitmap(_pstBitmap, _stColor, (_pstBitmap == sstDisplay.apstDestinationBitmapList[0]) ? orxTRUE : orxFALSE);
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Software_SetBlendMode(orxDISPLAY_BLEND_MODE _eBlendMode)
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Stores it */
+  sstDisplay.eLastBlendMode = _eBlendMode;
+
+  /* Done! */
+  return eResult;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Software_Swap()
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+
+  /* Draws remaining items: the screen bitmap is now complete and can be read back */
+  orxDisplay_Software_DrawTriangles();
+
+  /* Done! */
+  return eResult;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Software_SetBitmapData(orxBITMAP *_pstBitmap, const orxU8 *_au8Data, orxU32 _u32ByteNumber)
+{
+  orxSTATUS eResult;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstBitmap != orxNULL);
+  orxASSERT(_au8Data != orxNULL);
+
+  /* Not loading? */
+  if(!orxFLAG_TEST(_pstBitmap->u32Flags, orxDISPLAY_KU32_BITMAP_FLAG_LOADING))
+  {
+    /* Valid? */
+    if((_pstBitmap != sstDisplay.pstScreen) && (_u32ByteNumber == _pstBitmap->u32DataSize))
+    {
+      /* Draws remaining items, as they might refer to it */
+      orxDisplay_Software_DrawTriangles();
+
+      /* Updates its content */
+      orxMemory_Copy(_pstBitmap->astData, _au8Data, _u32ByteNumber);
+
+      /* Updates result */
+      eResult = orxSTATUS_SUCCESS;
+    }
+    else
+    {
+      /* Screen? */
+      if(_pstBitmap == sstDisplay.pstScreen)
+      {
+        /* Logs message */
+        orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "Can't set bitmap data: can't use screen as destination bitmap.");
+      }
+      else
+      {
+        /* Logs message */
+        orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "Can't set bitmap data for [%s]: format needs to be RGBA.", _pstBitmap->zLocation);
+      }
+
+      /* Updates result */
+      eResult = orxSTATUS_FAILURE;
+    }
+  }
+  else
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "Can't set bitmap data for [%s]: bitmap is not done loading.", _pstBitmap->zLocation);
+
+    /* Updates result */
+    eResult = orxSTATUS_FAILURE;
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Software_SetPartialBitmapData(orxBITMAP *_pstBitmap, const orxU8 *_au8Data, orxU32 _u32X, orxU32 _u32Y, orxU32 _u32Width, orxU32 _u32Height)
+{
+  orxSTATUS eResult;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstBitmap != orxNULL);
+  orxASSERT(_au8Data != orxNULL);
+
+  /* Not loading? */
+  if(!orxFLAG_TEST(_pstBitmap->u32Flags, orxDISPLAY_KU32_BITMAP_FLAG_LOADING))
+  {
+    /* Valid? */
+    if((_pstBitmap != sstDisplay.pstScreen)
+    && (_u32Width > 0)
+    && (_u32Height > 0)
+    && (_u32X + _u32Width <= orxF2U(_pstBitmap->fWidth))
+    && (_u32Y + _u32Height <= orxF2U(_pstBitmap->fHeight)))
+    {
+      orxU32 i;
+
+      /* Draws remaining items, as they might refer to it */
+      orxDisplay_Software_DrawTriangles();
+
+      /* For all lines */
+      for(i = 0; i < _u32Height; i++)
+      {
+        /* Updates its content */
+        orxMemory_Copy(_pstBitmap->astData + (_u32Y + i) * _pstBitmap->u32RealWidth + _u32X, _au8Data + i * _u32Width * sizeof(orxRGBA), _u32Width * sizeof(orxRGBA));
+      }
+
+      /* Updates result */
+      eResult = orxSTATUS_SUCCESS;
+    }
+    else
+    {
+      /* Screen? */
+      if(_pstBitmap == sstDisplay.pstScreen)
+      {
+        /* Logs message */
+        orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "Can't set bitmap data: can't use screen as destination bitmap.");
+      }
+      else
+      {
+        /* Logs message */
+        orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "Can't set partial bitmap data for [%s]: region (%u, %u) [%u x %u] is out of bounds.", _pstBitmap->zLocation, _u32X, _u32Y, _u32Width, _u32Height);
+      }
+
+      /* Updates result */
+      eResult = orxSTATUS_FAILURE;
+    }
+  }
+  else
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "Can't set bitmap data for [%s]: bitmap is not done loading.", _pstBitmap->zLocation);
+
+    /* Updates result */
+    eResult = orxSTATUS_FAILURE;
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Software_GetBitmapData(const orxBITMAP *_pstBitmap, orxU8 *_au8Data, orxU32 _u32ByteNumber)
+{
+  orxSTATUS eResult;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstBitmap != orxNULL);
+  orxASSERT(_au8Data != orxNULL);
+
+  /* Not loading? */
+  if(!orxFLAG_TEST(_pstBitmap->u32Flags, orxDISPLAY_KU32_BITMAP_FLAG_LOADING))
+  {
+    /* Is size matching? */
+    if(_u32ByteNumber == _pstBitmap->u32DataSize)
+    {
+      /* Draws remaining items */
+      orxDisplay_Software_DrawTriangles();
+
+      /* Copies its content */
+      orxMemory_Copy(_au8Data, _pstBitmap->astData, _u32ByteNumber);
+
+      /* Screen? */
+      if(_pstBitmap == sstDisplay.pstScreen)
+      {
+        orxRGBA *pstPixel;
+
+        /* For all pixels */
+        for(pstPixel = (orxRGBA *)_au8Data; pstPixel < (orxRGBA *)(_au8Data + _u32ByteNumber); pstPixel++)
+        {
+          /* Makes it opaque */
+          pstPixel->u8A = 0xFF;
+        }
+      }
+
+      /* Updates result */
+      eResult = orxSTATUS_SUCCESS;
+    }
+    else
+    {
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "Can't get bitmap data for [%s] as the buffer size is <%u> when it should be <%u>.", _pstBitmap->zLocation, _u32ByteNumber, _pstBitmap->u32DataSize);
+
+      /* Updates result */
+      eResult = orxSTATUS_FAILURE;
+    }
+  }
+  else
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "Can't get bitmap data for [%s] as it's not done loading.", _pstBitmap->zLocation);
+
+    /* Updates result */
+    eResult = orxSTATUS_FAILURE;
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Software_RequestBitmapData(const orxBITMAP *_pstBitmap, orxU8 *_au8Data, orxU32 _u32ByteNumber, orxDISPLAY_READ_FUNCTION _pfnCallback, void *_pContext)
+{
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstBitmap != orxNULL);
+  orxASSERT(_au8Data != orxNULL);
+  orxASSERT(_pfnCallback != orxNULL);
+
+  /* Gets bitmap data synchronously */
+  if(orxDisplay_Software_GetBitmapData(_pstBitmap, _au8Data, _u32ByteNumber) != orxSTATUS_FAILURE)
+  {
+    orxDISPLAY_READ_INFO *pstInfo;
+
+    /* Allocates read info */
+    pstInfo = (orxDISPLAY_READ_INFO *)orxMemory_Allocate(sizeof(orxDISPLAY_READ_INFO), orxMEMORY_TYPE_TEMP);
+
+    /* Valid? */
+    if(pstInfo != orxNULL)
+    {
+      /* Inits it */
+      pstInfo->pfnCallback    = _pfnCallback;
+      pstInfo->pContext       = _pContext;
+      pstInfo->pstBitmap      = _pstBitmap;
+      pstInfo->au8Data        = _au8Data;
+      pstInfo->u32ByteNumber  = _u32ByteNumber;
+
+      /* Defers notification to the main thread */
+      eResult = orxThread_RunTask(orxNULL, &orxDisplay_Software_NotifyBitmapData, orxNULL, (void *)pstInfo);
+
+      /* Failure? */
+      if(eResult == orxSTATUS_FAILURE)
+      {
+        /* Deletes read info */
+        orxMemory_Free(pstInfo);
+      }
+    }
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Software_SetDestinationBitmaps(orxBITMAP **_apstBitmapList, orxU32 _u32Number)
+{
+  orxU32    u32Number, i;
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_apstBitmapList != orxNULL);
+
+  /* Too many destinations? */
+  if(_u32Number > orxDISPLAY_KU32_MAX_DESTINATION_NUMBER)
+  {
+    /* Outputs logs */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "Can only attach the first <%u> bitmaps as destinations, out of the <%u> requested.", orxDISPLAY_KU32_MAX_DESTINATION_NUMBER, _u32Number);
+
+    /* Updates bitmap count */
+    u32Number = orxDISPLAY_KU32_MAX_DESTINATION_NUMBER;
+  }
+  else
+  {
+    /* Gets bitmap count */
+    u32Number = _u32Number;
+  }
+
+  /* For all destinations */
+  for(i = 0; i < u32Number; i++)
+  {
+    /* Invalid? */
+    if(_apstBitmapList[i] == orxNULL)
+    {
+      /* Updates result */
+      eResult = orxSTATUS_FAILURE;
+
+      break;
+    }
+    /* Screen among others? */
+    else if((_apstBitmapList[i] == sstDisplay.pstScreen) && (u32Number != 1))
+    {
+      /* Checks */
+      orxASSERT(orxFALSE && "Can only use screen as bitmap destination by itself.");
+
+      /* Updates result */
+      eResult = orxSTATUS_FAILURE;
+
+      break;
+    }
+    /* Different size? */
+    else if((_apstBitmapList[i]->u32RealWidth != _apstBitmapList[0]->u32RealWidth) || (_apstBitmapList[i]->u32RealHeight != _apstBitmapList[0]->u32RealHeight))
+    {
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "Can't set bitmap destinations as they have different dimensions: (%f, %f) != (%f, %f).", _apstBitmapList[i]->fWidth, _apstBitmapList[i]->fHeight, _apstBitmapList[0]->fWidth, _apstBitmapList[0]->fHeight);
+
+      /* Updates result */
+      eResult = orxSTATUS_FAILURE;
+
+      break;
+    }
+  }
+
+  /* Valid? */
+  if((eResult != orxSTATUS_FAILURE) && (u32Number != 0))
+  {
+    /* Different destinations? */
+    if((u32Number != sstDisplay.u32DestinationBitmapCount)
+    || (orxMemory_Compare(_apstBitmapList, sstDisplay.apstDestinationBitmapList, u32Number * sizeof(orxBITMAP *)) != 0))
+    {
+      /* Draws remaining items */
+      orxDisplay_Software_DrawTriangles();
+
+      /* Stores them */
+      orxMemory_Copy(sstDisplay.apstDestinationBitmapList, _apstBitmapList, u32Number * sizeof(orxBITMAP *));
+      orxMemory_Zero(&(sstDisplay.apstDestinationBitmapList[u32Number]), (orxDISPLAY_KU32_MAX_DESTINATION_NUMBER - u32Number) * sizeof(orxBITMAP *));
+      sstDisplay.u32DestinationBitmapCount = u32Number;
+
+      /* Updates clipping */
+      orxDisplay_Software_UpdateClipping();
+    }
+  }
+  else if(_u32Number != 0)
+  {
+    /* Updates result */
+    eResult = orxSTATUS_FAILURE;
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+orxU32 orxFASTCALL orxDisplay_Software_GetBitmapID(const orxBITMAP *_pstBitmap)
+{
+  orxU32 u32Result;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT((_pstBitmap != orxNULL) && (_pstBitmap != sstDisplay.pstScreen));
+
+  /* Updates result */
+  u32Result = _pstBitmap->u32ID;
+
+  /* Done! */
+  return u32Result;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Software_TransformBitmap(const orxBITMAP *_pstSrc, const orxDISPLAY_TRANSFORM *_pstTransform, orxRGBA _stColor, orxDISPLAY_SMOOTHING _eSmoothing, orxDISPLAY_BLEND_MODE _eBlendMode)
+{
+  orxDISPLAY_VERTEX astVertexList[4];
+  orxSTATUS         eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstSrc != sstDisplay.pstScreen);
+  orxASSERT((_pstSrc == orxNULL) || (_pstTransform != orxNULL));
+
+  /* No bitmap? */
+  if(_pstSrc == orxNULL)
+  {
+    /* Defines the vertex list, covering the whole destination clipping area */
+    astVertexList[0].fX =
+    astVertexList[1].fX = orxS2F(sstDisplay.s32ClipMinX);
+    astVertexList[2].fX =
+    astVertexList[3].fX = orxS2F(sstDisplay.s32ClipMaxX);
+    astVertexList[1].fY =
+    astVertexList[3].fY = orxS2F(sstDisplay.s32ClipMinY);
+    astVertexList[0].fY =
+    astVertexList[2].fY = orxS2F(sstDisplay.s32ClipMaxY);
+
+    /* Defines the texture coord list */
+    astVertexList[0].fU =
+    astVertexList[1].fU = orxFLOAT_0;
+    astVertexList[2].fU =
+    astVertexList[3].fU = orxFLOAT_1;
+    astVertexList[1].fV =
+    astVertexList[3].fV = orxFLOAT_0;
+    astVertexList[0].fV =
+    astVertexList[2].fV = orxFLOAT_1;
+
+    /* Fills the color list */
+    astVertexList[0].stRGBA =
+    astVertexList[1].stRGBA =
+    astVertexList[2].stRGBA =
+    astVertexList[3].stRGBA = sstDisplay.stLastColor;
+
+    /* Adds it, using last bitmap & blend mode */
+    orxDisplay_Software_AddQuad(astVertexList, sstDisplay.pstLastBitmap, sstDisplay.bDefaultSmoothing, sstDisplay.eLastBlendMode);
+  }
+  else
+  {
+    orxDISPLAY_MATRIX mTransform;
+    orxFLOAT          i, j, fX, fY, fWidth, fHeight, fTop, fBottom, fLeft, fRight, fRecRepeatX;
+    orxBOOL           bSmoothing;
+
+    /* Inits matrix */
+    orxDisplay_Software_InitMatrix(&mTransform, _pstTransform->fDstX, _pstTransform->fDstY, _pstTransform->fScaleX, _pstTransform->fScaleY, _pstTransform->fRotation, _pstTransform->fSrcX, _pstTransform->fSrcY);
+
+    /* Gets smoothing */
+    bSmoothing = orxDisplay_Software_GetSmoothing(_eSmoothing);
+
+    /* Stores bitmap */
+    sstDisplay.pstLastBitmap = _pstSrc;
+
+    /* Fills the color list */
+    astVertexList[0].stRGBA =
+    astVertexList[1].stRGBA =
+    astVertexList[2].stRGBA =
+    astVertexList[3].stRGBA = _stColor;
+
+    /* Inits bitmap height */
+    fHeight = (_pstSrc->stClip.vBR.fY - _pstSrc->stClip.vTL.fY) / _pstTransform->fRepeatY;
+
+    /* Inits texture coords */
+    fLeft   = _pstSrc->fRecRealWidth * _pstSrc->stClip.vTL.fX;
+    fTop    = _pstSrc->fRecRealHeight * _pstSrc->stClip.vTL.fY;
+
+    /* For all lines */
+    for(fY = orxFLOAT_0, i = _pstTransform->fRepeatY, fRecRepeatX = orxFLOAT_1 / _pstTransform->fRepeatX; i > orxFLOAT_0; i -= orxFLOAT_1, fY += fHeight)
+    {
+      /* Partial line? */
+      if(i < orxFLOAT_1)
+      {
+        /* Updates height */
+        fHeight *= i;
+
+        /* Resets texture coords */
+        fRight  = _pstSrc->fRecRealWidth * _pstSrc->stClip.vBR.fX;
+        fBottom = _pstSrc->fRecRealHeight * (_pstSrc->stClip.vTL.fY + (i * (_pstSrc->stClip.vBR.fY - _pstSrc->stClip.vTL.fY)));
+      }
+      else
+      {
+        /* Resets texture coords */
+        fRight  = _pstSrc->fRecRealWidth * _pstSrc->stClip.vBR.fX;
+        fBottom = _pstSrc->fRecRealHeight * _pstSrc->stClip.vBR.fY;
+      }
+
+      /* Resets bitmap width */
+      fWidth = (_pstSrc->stClip.vBR.fX - _pstSrc->stClip.vTL.fX) * fRecRepeatX;
+
+      /* For all columns */
+      for(fX = orxFLOAT_0, j = _pstTransform->fRepeatX; j > orxFLOAT_0; j -= orxFLOAT_1, fX += fWidth)
+      {
+        /* Partial column? */
+        if(j < orxFLOAT_1)
+        {
+          /* Updates width */
+          fWidth *= j;
+
+          /* Updates texture right coord */
+          fRight = _pstSrc->fRecRealWidth * (_pstSrc->stClip.vTL.fX + (j * (_pstSrc->stClip.vBR.fX - _pstSrc->stClip.vTL.fX)));
+        }
+
+        /* Outputs vertices and texture coordinates */
+        astVertexList[0].fX = (mTransform.vX.fX * fX) + (mTransform.vX.fY * (fY + fHeight)) + mTransform.vX.fZ;
+        astVertexList[0].fY = (mTransform.vY.fX * fX) + (mTransform.vY.fY * (fY + fHeight)) + mTransform.vY.fZ;
+        astVertexList[1].fX = (mTransform.vX.fX * fX) + (mTransform.vX.fY * fY) + mTransform.vX.fZ;
+        astVertexList[1].fY = (mTransform.vY.fX * fX) + (mTransform.vY.fY * fY) + mTransform.vY.fZ;
+        astVertexList[2].fX = (mTransform.vX.fX * (fX + fWidth)) + (mTransform.vX.fY * (fY + fHeight)) + mTransform.vX.fZ;
+        astVertexList[2].fY = (mTransform.vY.fX * (fX + fWidth)) + (mTransform.vY.fY * (fY + fHeight)) + mTransform.vY.fZ;
+        astVertexList[3].fX = (mTransform.vX.fX * (fX + fWidth)) + (mTransform.vX.fY * fY) + mTransform.vX.fZ;
+        astVertexList[3].fY = (mTransform.vY.fX * (fX + fWidth)) + (mTransform.vY.fY * fY) + mTransform.vY.fZ;
+
+        astVertexList[0].fU =
+        astVertexList[1].fU = fLeft;
+        astVertexList[2].fU =
+        astVertexList[3].fU = fRight;
+        astVertexList[1].fV =
+        astVertexList[3].fV = fTop;
+        astVertexList[0].fV =
+        astVertexList[2].fV = fBottom;
+
+        /* Adds it */
+        orxDisplay_Software_AddQuad(astVertexList, _pstSrc, bSmoothing, _eBlendMode);
+      }
+    }
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Software_SaveBitmap(const orxBITMAP *_pstBitmap, const orxSTRING _zFilename)
+{
+  orxU8    *pu8ImageData;
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstBitmap != orxNULL);
+  orxASSERT(_zFilename != orxNULL);
+
+  /* Allocates buffer */
+  pu8ImageData = (orxU8 *)orxMemory_Allocate(_pstBitmap->u32DataSize, orxMEMORY_TYPE_MAIN);
+
+  /* Valid? */
+  if(pu8ImageData != orxNULL)
+  {
+    orxDISPLAY_SAVE_INFO *pstInfo = orxNULL;
+
+    /* Gets bitmap data */
+    if(orxDisplay_Software_GetBitmapData(_pstBitmap, pu8ImageData, _pstBitmap->u32DataSize) != orxSTATUS_FAILURE)
+    {
+      /* Allocates save info */
+      pstInfo = (orxDISPLAY_SAVE_INFO *)orxMemory_Allocate(sizeof(orxDISPLAY_SAVE_INFO), orxMEMORY_TYPE_TEMP);
+
+      /* Valid? */
+      if(pstInfo != orxNULL)
+      {
+        /* Inits it */
+        pstInfo->pu8ImageData   = pu8ImageData;
+        pstInfo->stFilenameID   = orxString_GetID(_zFilename);
+        pstInfo->u32Width       = _pstBitmap->u32RealWidth;
+        pstInfo->u32Height      = _pstBitmap->u32RealHeight;
+
+        /* Runs asynchronous task */
+        eResult = orxThread_RunTask(&orxDisplay_Software_SaveBitmapData, orxNULL, orxNULL, (void *)pstInfo);
+      }
+    }
+
+    /* Failure? */
+    if(eResult == orxSTATUS_FAILURE)
+    {
+      /* Frees save info */
+      if(pstInfo != orxNULL)
+      {
+        orxMemory_Free(pstInfo);
+      }
+
+      /* Frees buffer */
+      orxMemory_Free(pu8ImageData);
+    }
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Software_SetTempBitmap(const orxBITMAP *_pstBitmap)
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+
+  /* Stores it */
+  sstDisplay.pstTempBitmap = _pstBitmap;
+
+  /* Done! */
+  return eResult;
+}
+
+const orxBITMAP *orxFASTCALL orxDisplay_Software_GetTempBitmap()
+{
+  const orxBITMAP *pstResult;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+
+  /* Updates result */
+  pstResult = sstDisplay.pstTempBitmap;
+
+  /* Done! */
+  return pstResult;
+}
+
+orxBITMAP *orxFASTCALL orxDisplay_Software_LoadBitmap(const orxSTRING _zFilename)
+{
+  const orxSTRING zResourceLocation;
+  orxBITMAP      *pstResult = orxNULL;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+
+  /* Locates resource */
+  zResourceLocation = orxResource_Locate(orxTEXTURE_KZ_RESOURCE_GROUP, _zFilename);
+
+  /* Success? */
+  if(zResourceLocation != orxNULL)
+  {
+    /* Allocates bitmap */
+    pstResult = (orxBITMAP *)orxBank_Allocate(sstDisplay.pstBitmapBank);
+
+    /* Valid? */
+    if(pstResult != orxNULL)
+    {
+      /* Inits it */
+      orxMemory_Zero(pstResult, sizeof(orxBITMAP));
+      pstResult->bSmoothing     = sstDisplay.bDefaultSmoothing;
+      pstResult->zLocation      = zResourceLocation;
+      pstResult->stFilenameID   = orxString_GetID(_zFilename);
+      pstResult->u32Flags       = orxDISPLAY_KU32_BITMAP_FLAG_NONE;
+
+      /* Loads its data */
+      if(orxDisplay_Software_LoadBitmapData(pstResult) == orxSTATUS_FAILURE)
+      {
+        /* Deletes it */
+        orxBank_Free(sstDisplay.pstBitmapBank, pstResult);
+
+        /* Updates result */
+        pstResult = orxNULL;
+      }
+    }
+  }
+
+  /* Done! */
+  return pstResult;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Software_GetBitmapSize(const orxBITMAP *_pstBitmap, orxFLOAT *_pfWidth, orxFLOAT *_pfHeight)
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstBitmap != orxNULL);
+  orxASSERT(_pfWidth != orxNULL);
+  orxASSERT(_pfHeight != orxNULL);
+
+  /* Gets size */
+  *_pfWidth   = _pstBitmap->fWidth;
+  *_pfHeight  = _pstBitmap->fHeight;
+
+  /* Done! */
+  return eResult;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Software_GetScreenSize(orxFLOAT *_pfWidth, orxFLOAT *_pfHeight)
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pfWidth != orxNULL);
+  orxASSERT(_pfHeight != orxNULL);
+
+  /* Gets size */
+  *_pfWidth   = sstDisplay.pstScreen->fWidth;
+  *_pfHeight  = sstDisplay.pstScreen->fHeight;
+
+  /* Done! */
+  return eResult;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Software_SetBitmapClipping(orxBITMAP *_pstBitmap, orxU32 _u32TLX, orxU32 _u32TLY, orxU32 _u32BRX, orxU32 _u32BRY)
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+
+  /* No destination bitmap? */
+  if(_pstBitmap == orxNULL)
+  {
+    /* Defaults to first destination */
+    _pstBitmap = sstDisplay.apstDestinationBitmapList[0];
+  }
+
+  /* Stores clip coords */
+  orxVector_Set(&(_pstBitmap->stClip.vTL), orxU2F(_u32TLX), orxU2F(_u32TLY), orxFLOAT_0);
+  orxVector_Set(&(_pstBitmap->stClip.vBR), orxU2F(_u32BRX), orxU2F(_u32BRY), orxFLOAT_0);
+
+  /* Destination bitmap? */
+  if(_pstBitmap == sstDisplay.apstDestinationBitmapList[0])
+  {
+    /* Updates clipping */
+    orxDisplay_Software_UpdateClipping();
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+orxU32 orxFASTCALL orxDisplay_Software_GetVideoModeCount()
+{
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+
+  /* Done! */
+  return 1;
+}
+
+orxDISPLAY_VIDEO_MODE *orxFASTCALL orxDisplay_Software_GetVideoMode(orxU32 _u32Index, orxDISPLAY_VIDEO_MODE *_pstVideoMode)
+{
+  orxDISPLAY_VIDEO_MODE *pstResult;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstVideoMode != orxNULL);
+
+  /* Request the default or the only mode? */
+  if((_u32Index == orxU32_UNDEFINED) || (_u32Index == 0))
+  {
+    /* Stores info */
+    orxMemory_Copy(_pstVideoMode, &(sstDisplay.stDefaultVideoMode), sizeof(orxDISPLAY_VIDEO_MODE));
+  }
+  /* Gets current mode */
+  else
+  {
+    /* Stores info */
+    _pstVideoMode->u32Width       = sstDisplay.pstScreen->u32RealWidth;
+    _pstVideoMode->u32Height      = sstDisplay.pstScreen->u32RealHeight;
+    _pstVideoMode->u32Depth       = sstDisplay.pstScreen->u32Depth;
+    _pstVideoMode->u32RefreshRate = sstDisplay.u32RefreshRate;
+  }
+
+  /* Updates full screen status */
+  _pstVideoMode->bFullScreen = orxFLAG_TEST(sstDisplay.u32Flags, orxDISPLAY_KU32_STATIC_FLAG_FULLSCREEN) ? orxTRUE : orxFALSE;
+
+  /* Updates result */
+  pstResult = _pstVideoMode;
+
+  /* Done! */
+  return pstResult;
+}
+
+orxBOOL orxFASTCALL orxDisplay_Software_IsVideoModeAvailable(const orxDISPLAY_VIDEO_MODE *_pstVideoMode)
+{
+  orxBOOL bResult;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstVideoMode != orxNULL);
+
+  /* Updates result: any 32-bit size can be rendered */
+  bResult = ((_pstVideoMode->u32Width != 0)
+          && (_pstVideoMode->u32Height != 0)
+          && ((_pstVideoMode->u32Depth == 32) || (_pstVideoMode->u32Depth == 24) || (_pstVideoMode->u32Depth == 0))) ? orxTRUE : orxFALSE;
+
+  /* Done! */
+  return bResult;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Software_EnableVSync(orxBOOL _bEnable)
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+
+  /* Updates status, there's no display to synchronize with */
+  if(_bEnable != orxFALSE)
+  {
+    orxFLAG_SET(sstDisplay.u32Flags, orxDISPLAY_KU32_STATIC_FLAG_VSYNC, orxDISPLAY_KU32_STATIC_FLAG_NONE);
+  }
+  else
+  {
+    orxFLAG_SET(sstDisplay.u32Flags, orxDISPLAY_KU32_STATIC_FLAG_NONE, orxDISPLAY_KU32_STATIC_FLAG_VSYNC);
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+orxBOOL orxFASTCALL orxDisplay_Software_IsVSyncEnabled()
+{
+  orxBOOL bResult;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+
+  /* Updates result */
+  bResult = orxFLAG_TEST(sstDisplay.u32Flags, orxDISPLAY_KU32_STATIC_FLAG_VSYNC) ? orxTRUE : orxFALSE;
+
+  /* Done! */
+  return bResult;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Software_SetVideoMode(const orxDISPLAY_VIDEO_MODE *_pstVideoMode)
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+
+  /* Draws remaining items */
+  orxDisplay_Software_DrawTriangles();
+
+  /* Has specified video mode? */
+  if(_pstVideoMode != orxNULL)
+  {
+    /* Is available? */
+    if(orxDisplay_Software_IsVideoModeAvailable(_pstVideoMode) != orxFALSE)
+    {
+      orxDISPLAY_EVENT_PAYLOAD  stPayload;
+      orxRGBA                  *astData;
+      orxU32                    u32DataSize;
+
+      /* Gets new data size */
+      u32DataSize = _pstVideoMode->u32Width * _pstVideoMode->u32Height * sizeof(orxRGBA);
+
+      /* Allocates new screen content */
+      astData = (orxRGBA *)orxMemory_Allocate(u32DataSize, orxMEMORY_TYPE_VIDEO);
+
+      /* Success? */
+      if(astData != orxNULL)
+      {
+        orxVECTOR vFramebufferSize;
+
+        /* Clears it */
+        orxMemory_Zero(astData, u32DataSize);
+
+        /* Inits event payload */
+        orxMemory_Zero(&stPayload, sizeof(orxDISPLAY_EVENT_PAYLOAD));
+        stPayload.stVideoMode.u32Width                = _pstVideoMode->u32Width;
+        stPayload.stVideoMode.u32Height               = _pstVideoMode->u32Height;
+        stPayload.stVideoMode.u32Depth                = 32;
+        stPayload.stVideoMode.u32RefreshRate          = (_pstVideoMode->u32RefreshRate != 0) ? _pstVideoMode->u32RefreshRate : orxDISPLAY_KU32_DEFAULT_REFRESH_RATE;
+        stPayload.stVideoMode.u32PreviousWidth        = sstDisplay.pstScreen->u32RealWidth;
+        stPayload.stVideoMode.u32PreviousHeight       = sstDisplay.pstScreen->u32RealHeight;
+        stPayload.stVideoMode.u32PreviousDepth        = sstDisplay.pstScreen->u32Depth;
+        stPayload.stVideoMode.u32PreviousRefreshRate  = sstDisplay.u32RefreshRate;
+        stPayload.stVideoMode.bFullScreen             = _pstVideoMode->bFullScreen;
+
+        /* Deletes previous content */
+        if(sstDisplay.pstScreen->astData != orxNULL)
+        {
+          orxMemory_Free(sstDisplay.pstScreen->astData);
+        }
+
+        /* Updates screen */
+        sstDisplay.pstScreen->astData         = astData;
+        sstDisplay.pstScreen->fWidth          = orxU2F(_pstVideoMode->u32Width);
+        sstDisplay.pstScreen->fHeight         = orxU2F(_pstVideoMode->u32Height);
+        sstDisplay.pstScreen->u32RealWidth    = _pstVideoMode->u32Width;
+        sstDisplay.pstScreen->u32RealHeight   = _pstVideoMode->u32Height;
+        sstDisplay.pstScreen->u32Depth        = 32;
+        sstDisplay.pstScreen->fRecRealWidth   = orxFLOAT_1 / sstDisplay.pstScreen->fWidth;
+        sstDisplay.pstScreen->fRecRealHeight  = orxFLOAT_1 / sstDisplay.pstScreen->fHeight;
+        sstDisplay.pstScreen->u32DataSize     = u32DataSize;
+        orxVector_Copy(&(sstDisplay.pstScreen->stClip.vTL), &orxVECTOR_0);
+        orxVector_Set(&(sstDisplay.pstScreen->stClip.vBR), sstDisplay.pstScreen->fWidth, sstDisplay.pstScreen->fHeight, orxFLOAT_0);
+        sstDisplay.u32RefreshRate             = stPayload.stVideoMode.u32RefreshRate;
+
+        /* Updates full screen status */
+        orxFLAG_SET(sstDisplay.u32Flags, (_pstVideoMode->bFullScreen != orxFALSE) ? orxDISPLAY_KU32_STATIC_FLAG_FULLSCREEN : orxDISPLAY_KU32_STATIC_FLAG_NONE, orxDISPLAY_KU32_STATIC_FLAG_FULLSCREEN);
+
+        /* Uses screen as destination */
+        sstDisplay.u32DestinationBitmapCount = 0;
+        orxDisplay_Software_SetDestinationBitmaps(&(sstDisplay.pstScreen), 1);
+
+        /* Stores config values */
+        orxConfig_PushSection(orxDISPLAY_KZ_CONFIG_SECTION);
+        orxConfig_SetFloat(orxDISPLAY_KZ_CONFIG_WIDTH, sstDisplay.pstScreen->fWidth);
+        orxConfig_SetFloat(orxDISPLAY_KZ_CONFIG_HEIGHT, sstDisplay.pstScreen->fHeight);
+        orxConfig_SetU32(orxDISPLAY_KZ_CONFIG_DEPTH, sstDisplay.pstScreen->u32Depth);
+        orxConfig_SetVector(orxDISPLAY_KZ_CONFIG_FRAMEBUFFER_SIZE, orxVector_Set(&vFramebufferSize, sstDisplay.pstScreen->fWidth, sstDisplay.pstScreen->fHeight, orxFLOAT_0));
+        orxConfig_PopSection();
+
+        /* Sends event */
+        orxEVENT_SEND(orxEVENT_TYPE_DISPLAY, orxDISPLAY_EVENT_SET_VIDEO_MODE, orxNULL, orxNULL, &stPayload);
+      }
+      else
+      {
+        /* Logs message */
+        orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "Can't allocate screen of size (%u, %u).", _pstVideoMode->u32Width, _pstVideoMode->u32Height);
+
+        /* Updates result */
+        eResult = orxSTATUS_FAILURE;
+      }
+    }
+    else
+    {
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "Can't set video mode (%u, %u, %u): unsupported.", _pstVideoMode->u32Width, _pstVideoMode->u32Height, _pstVideoMode->u32Depth);
+
+      /* Updates result */
+      eResult = orxSTATUS_FAILURE;
+    }
+  }
+
+  /* Clears last bitmap & blend mode */
+  sstDisplay.pstLastBitmap  = orxNULL;
+  sstDisplay.eLastBlendMode = orxDISPLAY_BLEND_MODE_ALPHA;
+
+  /* Done! */
+  return eResult;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Software_SetFullScreen(orxBOOL _bFullScreen)
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+
+  /* Different status? */
+  if((_bFullScreen != orxFALSE) != (orxFLAG_TEST(sstDisplay.u32Flags, orxDISPLAY_KU32_STATIC_FLAG_FULLSCREEN) != orxFALSE))
+  {
+    orxDISPLAY_VIDEO_MODE stVideoMode;
+
+    /* Inits video mode */
+    stVideoMode.u32Width        = sstDisplay.pstScreen->u32RealWidth;
+    stVideoMode.u32Height       = sstDisplay.pstScreen->u32RealHeight;
+    stVideoMode.u32Depth        = sstDisplay.pstScreen->u32Depth;
+    stVideoMode.u32RefreshRate  = sstDisplay.u32RefreshRate;
+    stVideoMode.bFullScreen     = _bFullScreen;
+
+    /* Updates video mode */
+    eResult = orxDisplay_Software_SetVideoMode(&stVideoMode);
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+orxBOOL orxFASTCALL orxDisplay_Software_IsFullScreen()
+{
+  orxBOOL bResult;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+
+  /* Updates result */
+  bResult = orxFLAG_TEST(sstDisplay.u32Flags, orxDISPLAY_KU32_STATIC_FLAG_FULLSCREEN) ? orxTRUE : orxFALSE;
+
+  /* Done! */
+  return bResult;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Software_Init()
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Was not already initialized? */
+  if(!(sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY))
+  {
+    /* Cleans static controller */
+    orxMemory_Zero(&sstDisplay, sizeof(orxDISPLAY_STATIC));
+
+    /* Creates bitmap bank */
+    sstDisplay.pstBitmapBank = orxBank_Create(orxDISPLAY_KU32_BITMAP_BANK_SIZE, sizeof(orxBITMAP), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+
+    /* Allocates triangle batch */
+    sstDisplay.astTriangleList = (orxDISPLAY_TRIANGLE *)orxMemory_Allocate(orxDISPLAY_KU32_TRIANGLE_BUFFER_SIZE * sizeof(orxDISPLAY_TRIANGLE), orxMEMORY_TYPE_MAIN);
+
+    /* Valid? */
+    if((sstDisplay.pstBitmapBank != orxNULL)
+    && (sstDisplay.astTriangleList != orxNULL))
+    {
+      /* Pushes display section */
+      orxConfig_PushSection(orxDISPLAY_KZ_CONFIG_SECTION);
+
+      /* Gets video mode from config */
+      sstDisplay.stDefaultVideoMode.u32Width        = orxConfig_HasValue(orxDISPLAY_KZ_CONFIG_WIDTH) ? orxConfig_GetU32(orxDISPLAY_KZ_CONFIG_WIDTH) : orxDISPLAY_KU32_DEFAULT_WIDTH;
+      sstDisplay.stDefaultVideoMode.u32Height       = orxConfig_HasValue(orxDISPLAY_KZ_CONFIG_HEIGHT) ? orxConfig_GetU32(orxDISPLAY_KZ_CONFIG_HEIGHT) : orxDISPLAY_KU32_DEFAULT_HEIGHT;
+      sstDisplay.stDefaultVideoMode.u32Depth        = orxDISPLAY_KU32_DEFAULT_DEPTH;
+      sstDisplay.stDefaultVideoMode.u32RefreshRate  = orxConfig_HasValue(orxDISPLAY_KZ_CONFIG_REFRESH_RATE) ? orxConfig_GetU32(orxDISPLAY_KZ_CONFIG_REFRESH_RATE) : orxDISPLAY_KU32_DEFAULT_REFRESH_RATE;
+      sstDisplay.stDefaultVideoMode.bFullScreen     = orxConfig_GetBool(orxDISPLAY_KZ_CONFIG_FULLSCREEN);
+
+      /* Inits info */
+      sstDisplay.bDefaultSmoothing  = orxConfig_GetBool(orxDISPLAY_KZ_CONFIG_SMOOTH);
+      sstDisplay.eLastBlendMode     = orxDISPLAY_BLEND_MODE_ALPHA;
+
+      /* Sets module as ready */
+      sstDisplay.u32Flags = orxDISPLAY_KU32_STATIC_FLAG_READY;
+
+      /* Allocates screen bitmap */
+      sstDisplay.pstScreen = (orxBITMAP *)orxBank_Allocate(sstDisplay.pstBitmapBank);
+      orxMemory_Zero(sstDisplay.pstScreen, sizeof(orxBITMAP));
+      sstDisplay.pstScreen->zLocation = orxSTRING_EMPTY;
+
+      /* Sets video mode */
+      if((eResult = orxDisplay_Software_SetVideoMode(&(sstDisplay.stDefaultVideoMode))) != orxSTATUS_FAILURE)
+      {
+        /* Updates vertical sync */
+        orxDisplay_Software_EnableVSync((orxConfig_HasValue(orxDISPLAY_KZ_CONFIG_VSYNC) != orxFALSE) ? orxConfig_GetBool(orxDISPLAY_KZ_CONFIG_VSYNC) : orxTRUE);
+      }
+      else
+      {
+        /* Frees screen bitmap */
+        orxBank_Free(sstDisplay.pstBitmapBank, sstDisplay.pstScreen);
+
+        /* Deletes bank */
+        orxBank_Delete(sstDisplay.pstBitmapBank);
+        sstDisplay.pstBitmapBank = orxNULL;
+
+        /* Frees triangle batch */
+        orxMemory_Free(sstDisplay.astTriangleList);
+        sstDisplay.astTriangleList = orxNULL;
+
+        /* Updates status */
+        orxFLAG_SET(sstDisplay.u32Flags, orxDISPLAY_KU32_STATIC_FLAG_NONE, orxDISPLAY_KU32_STATIC_FLAG_READY);
+
+        /* Logs message */
+        orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "Failed to init software display video mode.");
+      }
+
+      /* Pops config section */
+      orxConfig_PopSection();
+    }
+    else
+    {
+      /* Deletes bank */
+      if(sstDisplay.pstBitmapBank != orxNULL)
+      {
+        orxBank_Delete(sstDisplay.pstBitmapBank);
+        sstDisplay.pstBitmapBank = orxNULL;
+      }
+
+      /* Frees triangle batch */
+      if(sstDisplay.astTriangleList != orxNULL)
+      {
+        orxMemory_Free(sstDisplay.astTriangleList);
+        sstDisplay.astTriangleList = orxNULL;
+      }
+
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "Failed to create bitmap bank/triangle batch.");
+
+      /* Updates result */
+      eResult = orxSTATUS_FAILURE;
+    }
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+void orxFASTCALL orxDisplay_Software_Exit()
+{
+  /* Was initialized? */
+  if(sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY)
+  {
+    orxBITMAP *pstBitmap;
+
+    /* For all remaining bitmaps */
+    for(pstBitmap = (orxBITMAP *)orxBank_GetNext(sstDisplay.pstBitmapBank, orxNULL);
+        pstBitmap != orxNULL;
+        pstBitmap = (orxBITMAP *)orxBank_GetNext(sstDisplay.pstBitmapBank, pstBitmap))
+    {
+      /* Not loading? */
+      if(!orxFLAG_TEST(pstBitmap->u32Flags, orxDISPLAY_KU32_BITMAP_FLAG_LOADING))
+      {
+        /* Deletes its data */
+        orxDisplay_Software_DeleteBitmapData(pstBitmap);
+      }
+    }
+
+    /* Deletes bank */
+    orxBank_Delete(sstDisplay.pstBitmapBank);
+
+    /* Frees triangle batch */
+    orxMemory_Free(sstDisplay.astTriangleList);
+
+    /* Cleans static controller */
+    orxMemory_Zero(&sstDisplay, sizeof(orxDISPLAY_STATIC));
+  }
+
+  return;
+}
+
+orxBOOL orxFASTCALL orxDisplay_Software_HasShaderSupport()
+{
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+
+  /* Done! */
+  return orxFALSE;
+}
+
+orxHANDLE orxFASTCALL orxDisplay_Software_CreateShader(const orxSTRING *_azCodeList, orxU32 _u32Size, const orxLINKLIST *_pstParamList, orxBOOL _bUseCustomParam)
+{
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+
+  /* Logs message */
+  orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "Can't create shader: not supported by the software display.");
+
+  /* Done! */
+  return orxHANDLE_UNDEFINED;
+}
+
+void orxFASTCALL orxDisplay_Software_DeleteShader(orxHANDLE _hShader)
+{
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+
+  /* Done! */
+  return;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Software_StartShader(orxHANDLE _hShader)
+{
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+
+  /* Done! */
+  return orxSTATUS_FAILURE;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Software_StopShader(orxHANDLE _hShader)
+{
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+
+  /* Done! */
+  return orxSTATUS_FAILURE;
+}
+
+orxS32 orxFASTCALL orxDisplay_Software_GetParameterID(const orxHANDLE _hShader, const orxSTRING _zParam, orxS32 _s32Index, orxBOOL _bIsTexture)
+{
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+
+  /* Done! */
+  return -1;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Software_SetShaderBitmap(orxHANDLE _hShader, orxS32 _s32ID, const orxBITMAP *_pstValue)
+{
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+
+  /* Done! */
+  return orxSTATUS_FAILURE;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Software_SetShaderFloat(orxHANDLE _hShader, orxS32 _s32ID, orxFLOAT _fValue)
+{
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+
+  /* Done! */
+  return orxSTATUS_FAILURE;
+}
+
+orxSTATUS orxFASTCALL orxDisplay_Software_SetShaderVector(orxHANDLE _hShader, orxS32 _s32ID, const orxVECTOR *_pvValue)
+{
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+
+  /* Done! */
+  return orxSTATUS_FAILURE;
+}
+
+
+/***************************************************************************
+ * Plugin Related                                                          *
+ ***************************************************************************/
+
+orxPLUGIN_USER_CORE_FUNCTION_START(DISPLAY);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Software_Init, DISPLAY, INIT);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Software_Exit, DISPLAY, EXIT);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Software_Swap, DISPLAY, SWAP);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Software_GetScreenBitmap, DISPLAY, GET_SCREEN_BITMAP);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Software_GetScreenSize, DISPLAY, GET_SCREEN_SIZE);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Software_CreateBitmap, DISPLAY, CREATE_BITMAP);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Software_DeleteBitmap, DISPLAY, DELETE_BITMAP);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Software_LoadBitmap, DISPLAY, LOAD_BITMAP);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Software_SaveBitmap, DISPLAY, SAVE_BITMAP);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Software_SetTempBitmap, DISPLAY, SET_TEMP_BITMAP);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Software_GetTempBitmap, DISPLAY, GET_TEMP_BITMAP);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Software_SetDestinationBitmaps, DISPLAY, SET_DESTINATION_BITMAPS);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Software_ClearBitmap, DISPLAY, CLEAR_BITMAP);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Software_SetBlendMode, DISPLAY, SET_BLEND_MODE);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Software_SetBitmapClipping, DISPLAY, SET_BITMAP_CLIPPING);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Software_SetBitmapData, DISPLAY, SET_BITMAP_DATA);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Software_GetBitmapData, DISPLAY, GET_BITMAP_DATA);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Software_RequestBitmapData, DISPLAY, REQUEST_BITMAP_DATA);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Software_SetPartialBitmapData, DISPLAY, SET_PARTIAL_BITMAP_DATA);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Software_GetBitmapSize, DISPLAY, GET_BITMAP_SIZE);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Software_GetBitmapID, DISPLAY, GET_BITMAP_ID);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Software_TransformBitmap, DISPLAY, TRANSFORM_BITMAP);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Software_TransformText, DISPLAY, TRANSFORM_TEXT);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Software_DrawLine, DISPLAY, DRAW_LINE);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Software_DrawPolyline, DISPLAY, DRAW_POLYLINE);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Software_DrawPolygon, DISPLAY, DRAW_POLYGON);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Software_DrawCircle, DISPLAY, DRAW_CIRCLE);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Software_DrawOBox, DISPLAY, DRAW_OBOX);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Software_DrawMesh, DISPLAY, DRAW_MESH);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Software_HasShaderSupport, DISPLAY, HAS_SHADER_SUPPORT);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Software_CreateShader, DISPLAY, CREATE_SHADER);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Software_DeleteShader, DISPLAY, DELETE_SHADER);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Software_StartShader, DISPLAY, START_SHADER);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Software_StopShader, DISPLAY, STOP_SHADER);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Software_GetParameterID, DISPLAY, GET_PARAMETER_ID);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Software_SetShaderBitmap, DISPLAY, SET_SHADER_BITMAP);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Software_SetShaderFloat, DISPLAY, SET_SHADER_FLOAT);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Software_SetShaderVector, DISPLAY, SET_SHADER_VECTOR);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Software_EnableVSync, DISPLAY, ENABLE_VSYNC);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Software_IsVSyncEnabled, DISPLAY, IS_VSYNC_ENABLED);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Software_SetFullScreen, DISPLAY, SET_FULL_SCREEN);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Software_IsFullScreen, DISPLAY, IS_FULL_SCREEN);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Software_GetVideoModeCount, DISPLAY, GET_VIDEO_MODE_COUNT);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Software_GetVideoMode, DISPLAY, GET_VIDEO_MODE);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Software_SetVideoMode, DISPLAY, SET_VIDEO_MODE);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Software_IsVideoModeAvailable, DISPLAY, IS_VIDEO_MODE_AVAILABLE);
+orxPLUGIN_USER_CORE_FUNCTION_END();
+
+#ifdef __orxGCC__
+  #pragma GCC diagnostic pop
+#endif /* __orxGCC__ */
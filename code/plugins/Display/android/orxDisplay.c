@@ -228,6 +228,18 @@ typedef struct __orxDISPLAY_SAVE_INFO_t
 
 } orxDISPLAY_SAVE_INFO;
 
+/** Internal bitmap read info structure
+ */
+typedef struct __orxDISPLAY_READ_INFO_t
+{
+  orxDISPLAY_READ_FUNCTION  pfnCallback;
+  void                     *pContext;
+  const orxBITMAP          *pstBitmap;
+  orxU8                    *au8Data;
+  orxU32                    u32ByteNumber;
+
+} orxDISPLAY_READ_INFO;
+
 /** Internal bitmap load info structure
  */
 typedef struct __orxDISPLAY_LOAD_INFO_t
@@ -774,6 +786,8 @@ static void orxFASTCALL orxDisplay_Android_ReadKTXResourceCallback(orxHANDLE _hR
   stPayload.stBitmap.zLocation      = pstBitmap->zLocation;
   stPayload.stBitmap.stFilenameID   = pstBitmap->stFilenameID;
   stPayload.stBitmap.u32ID          = orxU32_UNDEFINED;
+  stPayload.stBitmap.au8Data        = orxNULL;
+  stPayload.stBitmap.u32LineSize    = 0;
 
   if(_s64Size >= sizeof(KTX_header))
   {
@@ -1064,6 +1078,8 @@ static orxSTATUS orxFASTCALL orxDisplay_Android_DecompressBitmapCallback(void *_
     stPayload.stBitmap.zLocation      = pstInfo->pstBitmap->zLocation;
     stPayload.stBitmap.stFilenameID   = pstInfo->pstBitmap->stFilenameID;
     stPayload.stBitmap.u32ID          = (pstInfo->pu8ImageBuffer != orxNULL) ? (orxU32)pstInfo->pstBitmap->uiTexture : orxU32_UNDEFINED;
+    stPayload.stBitmap.au8Data        = pstInfo->pu8ImageBuffer;
+    stPayload.stBitmap.u32LineSize    = (orxU32)pstInfo->uiRealWidth * 4 * sizeof(orxU8);
 
     /* Sends event */
     orxEVENT_SEND(orxEVENT_TYPE_DISPLAY, orxDISPLAY_EVENT_LOAD_BITMAP, pstInfo->pstBitmap, orxNULL, &stPayload);
@@ -1536,6 +1552,23 @@ static orxSTATUS orxFASTCALL orxDisplay_Android_SaveBitmapData(void *_pContext)
   return eResult;
 }
 
+static orxSTATUS orxFASTCALL orxDisplay_Android_NotifyBitmapData(void *_pContext)
+{
+  orxDISPLAY_READ_INFO *pstInfo;
+
+  /* Gets read info */
+  pstInfo = (orxDISPLAY_READ_INFO *)_pContext;
+
+  /* Calls callback */
+  pstInfo->pfnCallback(pstInfo->pstBitmap, pstInfo->u32ByteNumber, pstInfo->au8Data, pstInfo->pContext);
+
+  /* Deletes read info */
+  orxMemory_Free(pstInfo);
+
+  /* Done! */
+  return orxSTATUS_SUCCESS;
+}
+
 static orxINLINE orxDISPLAY_MATRIX *orxDisplay_Android_InitMatrix(orxDISPLAY_MATRIX *_pmMatrix, orxFLOAT _fPosX, orxFLOAT _fPosY, orxFLOAT _fScaleX, orxFLOAT _fScaleY, orxFLOAT _fRotation, orxFLOAT _fPivotX, orxFLOAT _fPivotY)
 {
   orxFLOAT fCos, fSin, fSCosX, fSCosY, fSSinX, fSSinY, fTX, fTY;
@@ -2836,6 +2869,71 @@ orxSTATUS orxFASTCALL orxDisplay_Android_SetBitmapData(orxBITMAP *_pstBitmap, co
   return eResult;
 }
 
+orxSTATUS orxFASTCALL orxDisplay_Android_SetPartialBitmapData(orxBITMAP *_pstBitmap, const orxU8 *_au8Data, orxU32 _u32X, orxU32 _u32Y, orxU32 _u32Width, orxU32 _u32Height)
+{
+  orxSTATUS eResult;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstBitmap != orxNULL);
+  orxASSERT(_au8Data != orxNULL);
+
+  /* Not loading? */
+  if(!orxFLAG_TEST(_pstBitmap->u32Flags, orxDISPLAY_KU32_BITMAP_FLAG_LOADING))
+  {
+    /* Valid? */
+    if((_pstBitmap != sstDisplay.pstScreen)
+    && (_u32Width > 0)
+    && (_u32Height > 0)
+    && (_u32X + _u32Width <= orxF2U(_pstBitmap->fWidth))
+    && (_u32Y + _u32Height <= orxF2U(_pstBitmap->fHeight)))
+    {
+      /* Binds texture */
+      glBindTexture(GL_TEXTURE_2D, _pstBitmap->uiTexture);
+      glASSERT();
+
+      /* Updates its region */
+      glTexSubImage2D(GL_TEXTURE_2D, 0, (GLint)_u32X, (GLint)_u32Y, (GLsizei)_u32Width, (GLsizei)_u32Height, GL_RGBA, GL_UNSIGNED_BYTE, _au8Data);
+      glASSERT();
+
+      /* Restores previous texture */
+      glBindTexture(GL_TEXTURE_2D, (sstDisplay.apstBoundBitmapList[sstDisplay.s32ActiveTextureUnit] != orxNULL) ? sstDisplay.apstBoundBitmapList[sstDisplay.s32ActiveTextureUnit]->uiTexture : 0);
+      glASSERT();
+
+      /* Updates result */
+      eResult = orxSTATUS_SUCCESS;
+    }
+    else
+    {
+      /* Screen? */
+      if(_pstBitmap == sstDisplay.pstScreen)
+      {
+        /* Logs message */
+        orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "Can't set bitmap data: can't use screen as destination bitmap.");
+      }
+      else
+      {
+        /* Logs message */
+        orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "Can't set partial bitmap data for [%s]: region (%u, %u) [%u x %u] is out of bounds.", _pstBitmap->zLocation, _u32X, _u32Y, _u32Width, _u32Height);
+      }
+
+      /* Updates result */
+      eResult = orxSTATUS_FAILURE;
+    }
+  }
+  else
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "Can't set bitmap data for [%s]: bitmap is not done loading.", _pstBitmap->zLocation);
+
+    /* Updates result */
+    eResult = orxSTATUS_FAILURE;
+  }
+
+  /* Done! */
+  return eResult;
+}
+
 orxSTATUS orxFASTCALL orxDisplay_Android_GetBitmapData(const orxBITMAP *_pstBitmap, orxU8 *_au8Data, orxU32 _u32ByteNumber)
 {
   orxSTATUS eResult;
@@ -2940,6 +3038,50 @@ orxSTATUS orxFASTCALL orxDisplay_Android_GetBitmapData(const orxBITMAP *_pstBitm
   return eResult;
 }
 
+orxSTATUS orxFASTCALL orxDisplay_Android_RequestBitmapData(const orxBITMAP *_pstBitmap, orxU8 *_au8Data, orxU32 _u32ByteNumber, orxDISPLAY_READ_FUNCTION _pfnCallback, void *_pContext)
+{
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstBitmap != orxNULL);
+  orxASSERT(_au8Data != orxNULL);
+  orxASSERT(_pfnCallback != orxNULL);
+
+  /* Gets bitmap data synchronously */
+  if(orxDisplay_Android_GetBitmapData(_pstBitmap, _au8Data, _u32ByteNumber) != orxSTATUS_FAILURE)
+  {
+    orxDISPLAY_READ_INFO *pstInfo;
+
+    /* Allocates read info */
+    pstInfo = (orxDISPLAY_READ_INFO *)orxMemory_Allocate(sizeof(orxDISPLAY_READ_INFO), orxMEMORY_TYPE_TEMP);
+
+    /* Valid? */
+    if(pstInfo != orxNULL)
+    {
+      /* Inits it */
+      pstInfo->pfnCallback    = _pfnCallback;
+      pstInfo->pContext       = _pContext;
+      pstInfo->pstBitmap      = _pstBitmap;
+      pstInfo->au8Data        = _au8Data;
+      pstInfo->u32ByteNumber  = _u32ByteNumber;
+
+      /* Defers notification to the main thread */
+      eResult = orxThread_RunTask(orxNULL, &orxDisplay_Android_NotifyBitmapData, orxNULL, (void *)pstInfo);
+
+      /* Failure? */
+      if(eResult == orxSTATUS_FAILURE)
+      {
+        /* Deletes read info */
+        orxMemory_Free(pstInfo);
+      }
+    }
+  }
+
+  /* Done! */
+  return eResult;
+}
+
 orxSTATUS orxFASTCALL orxDisplay_Android_SetDestinationBitmaps(orxBITMAP **_apstBitmapList, orxU32 _u32Number)
 {
   orxU32    i, u32Number;
@@ -4955,6 +5097,8 @@ orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Android_SetBitmapClipping, DISPLAY,
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Android_GetBitmapID, DISPLAY, GET_BITMAP_ID);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Android_SetBitmapData, DISPLAY, SET_BITMAP_DATA);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Android_GetBitmapData, DISPLAY, GET_BITMAP_DATA);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Android_RequestBitmapData, DISPLAY, REQUEST_BITMAP_DATA);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Android_SetPartialBitmapData, DISPLAY, SET_PARTIAL_BITMAP_DATA);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Android_DrawLine, DISPLAY, DRAW_LINE);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Android_DrawPolyline, DISPLAY, DRAW_POLYLINE);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_Android_DrawPolygon, DISPLAY, DRAW_POLYGON);
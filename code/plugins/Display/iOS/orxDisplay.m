@@ -249,6 +249,18 @@ typedef struct __orxDISPLAY_SAVE_INFO_t
 
 } orxDISPLAY_SAVE_INFO;
 
+/** Internal bitmap read info structure
+ */
+typedef struct __orxDISPLAY_READ_INFO_t
+{
+  orxDISPLAY_READ_FUNCTION  pfnCallback;
+  void                     *pContext;
+  const orxBITMAP          *pstBitmap;
+  orxU8                    *au8Data;
+  orxU32                    u32ByteNumber;
+
+} orxDISPLAY_READ_INFO;
+
 /** Internal bitmap load info structure
  */
 typedef struct __orxDISPLAY_LOAD_INFO_t
@@ -1496,6 +1508,8 @@ static orxSTATUS orxFASTCALL orxDisplay_iOS_DecompressBitmapCallback(void *_pCon
     stPayload.stBitmap.zLocation      = pstInfo->pstBitmap->zLocation;
     stPayload.stBitmap.stFilenameID   = pstInfo->pstBitmap->stFilenameID;
     stPayload.stBitmap.u32ID          = (pstInfo->pu8ImageBuffer != orxNULL) ? (orxU32)pstInfo->pstBitmap->uiTexture : orxU32_UNDEFINED;
+    stPayload.stBitmap.au8Data        = ((pstInfo->bCompressed == orxFALSE) && (pstInfo->eInternalFormat == GL_RGBA) && (pstInfo->eTextureType == GL_UNSIGNED_BYTE)) ? pstInfo->pu8ImageBuffer : orxNULL;
+    stPayload.stBitmap.u32LineSize    = (orxU32)pstInfo->uiRealWidth * 4 * sizeof(orxU8);
 
     /* Sends event */
     orxEVENT_SEND(orxEVENT_TYPE_DISPLAY, orxDISPLAY_EVENT_LOAD_BITMAP, pstInfo->pstBitmap, orxNULL, &stPayload);
@@ -1874,6 +1888,23 @@ static orxSTATUS orxFASTCALL orxDisplay_iOS_SaveBitmapData(void *_pContext)
   return eResult;
 }
 
+static orxSTATUS orxFASTCALL orxDisplay_iOS_NotifyBitmapData(void *_pContext)
+{
+  orxDISPLAY_READ_INFO *pstInfo;
+
+  /* Gets read info */
+  pstInfo = (orxDISPLAY_READ_INFO *)_pContext;
+
+  /* Calls callback */
+  pstInfo->pfnCallback(pstInfo->pstBitmap, pstInfo->u32ByteNumber, pstInfo->au8Data, pstInfo->pContext);
+
+  /* Deletes read info */
+  orxMemory_Free(pstInfo);
+
+  /* Done! */
+  return orxSTATUS_SUCCESS;
+}
+
 static orxSTATUS orxFASTCALL orxDisplay_iOS_LoadBitmapData(orxBITMAP *_pstBitmap)
 {
   orxHANDLE hResource;
@@ -3282,6 +3313,71 @@ orxSTATUS orxFASTCALL orxDisplay_iOS_SetBitmapData(orxBITMAP *_pstBitmap, const
   return eResult;
 }
 
+orxSTATUS orxFASTCALL orxDisplay_iOS_SetPartialBitmapData(orxBITMAP *_pstBitmap, const orxU8 *_au8Data, orxU32 _u32X, orxU32 _u32Y, orxU32 _u32Width, orxU32 _u32Height)
+{
+  orxSTATUS eResult;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstBitmap != orxNULL);
+  orxASSERT(_au8Data != orxNULL);
+
+  /* Not loading? */
+  if(!orxFLAG_TEST(_pstBitmap->u32Flags, orxDISPLAY_KU32_BITMAP_FLAG_LOADING))
+  {
+    /* Valid? */
+    if((_pstBitmap != sstDisplay.pstScreen)
+    && (_u32Width > 0)
+    && (_u32Height > 0)
+    && (_u32X + _u32Width <= orxF2U(_pstBitmap->fWidth))
+    && (_u32Y + _u32Height <= orxF2U(_pstBitmap->fHeight)))
+    {
+      /* Binds texture */
+      glBindTexture(GL_TEXTURE_2D, _pstBitmap->uiTexture);
+      glASSERT();
+
+      /* Updates its region */
+      glTexSubImage2D(GL_TEXTURE_2D, 0, (GLint)_u32X, (GLint)_u32Y, (GLsizei)_u32Width, (GLsizei)_u32Height, GL_RGBA, GL_UNSIGNED_BYTE, _au8Data);
+      glASSERT();
+
+      /* Restores previous texture */
+      glBindTexture(GL_TEXTURE_2D, (sstDisplay.apstBoundBitmapList[sstDisplay.s32ActiveTextureUnit] != orxNULL) ? sstDisplay.apstBoundBitmapList[sstDisplay.s32ActiveTextureUnit]->uiTexture : 0);
+      glASSERT();
+
+      /* Updates result */
+      eResult = orxSTATUS_SUCCESS;
+    }
+    else
+    {
+      /* Screen? */
+      if(_pstBitmap == sstDisplay.pstScreen)
+      {
+        /* Logs message */
+        orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "Can't set bitmap data: can't use screen as destination bitmap.");
+      }
+      else
+      {
+        /* Logs message */
+        orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "Can't set partial bitmap data for [%s]: region (%u, %u) [%u x %u] is out of bounds.", _pstBitmap->zLocation, _u32X, _u32Y, _u32Width, _u32Height);
+      }
+
+      /* Updates result */
+      eResult = orxSTATUS_FAILURE;
+    }
+  }
+  else
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "Can't set bitmap data for [%s]: bitmap is not done loading.", _pstBitmap->zLocation);
+
+    /* Updates result */
+    eResult = orxSTATUS_FAILURE;
+  }
+
+  /* Done! */
+  return eResult;
+}
+
 orxSTATUS orxFASTCALL orxDisplay_iOS_GetBitmapData(const orxBITMAP *_pstBitmap, orxU8 *_au8Data, orxU32 _u32ByteNumber)
 {
   orxSTATUS eResult;
@@ -3385,6 +3481,50 @@ orxSTATUS orxFASTCALL orxDisplay_iOS_GetBitmapData(const orxBITMAP *_pstBitmap,
   return eResult;
 }
 
+orxSTATUS orxFASTCALL orxDisplay_iOS_RequestBitmapData(const orxBITMAP *_pstBitmap, orxU8 *_au8Data, orxU32 _u32ByteNumber, orxDISPLAY_READ_FUNCTION _pfnCallback, void *_pContext)
+{
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  /* Checks */
+  orxASSERT((sstDisplay.u32Flags & orxDISPLAY_KU32_STATIC_FLAG_READY) == orxDISPLAY_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstBitmap != orxNULL);
+  orxASSERT(_au8Data != orxNULL);
+  orxASSERT(_pfnCallback != orxNULL);
+
+  /* Gets bitmap data synchronously */
+  if(orxDisplay_iOS_GetBitmapData(_pstBitmap, _au8Data, _u32ByteNumber) != orxSTATUS_FAILURE)
+  {
+    orxDISPLAY_READ_INFO *pstInfo;
+
+    /* Allocates read info */
+    pstInfo = (orxDISPLAY_READ_INFO *)orxMemory_Allocate(sizeof(orxDISPLAY_READ_INFO), orxMEMORY_TYPE_TEMP);
+
+    /* Valid? */
+    if(pstInfo != orxNULL)
+    {
+      /* Inits it */
+      pstInfo->pfnCallback    = _pfnCallback;
+      pstInfo->pContext       = _pContext;
+      pstInfo->pstBitmap      = _pstBitmap;
+      pstInfo->au8Data        = _au8Data;
+      pstInfo->u32ByteNumber  = _u32ByteNumber;
+
+      /* Defers notification to the main thread */
+      eResult = orxThread_RunTask(orxNULL, &orxDisplay_iOS_NotifyBitmapData, orxNULL, (void *)pstInfo);
+
+      /* Failure? */
+      if(eResult == orxSTATUS_FAILURE)
+      {
+        /* Deletes read info */
+        orxMemory_Free(pstInfo);
+      }
+    }
+  }
+
+  /* Done! */
+  return eResult;
+}
+
 orxSTATUS orxFASTCALL orxDisplay_iOS_SetDestinationBitmaps(orxBITMAP **_apstBitmapList, orxU32 _u32Number)
 {
   orxFLOAT  fOrthoRight, fOrthoBottom;
@@ -4964,6 +5104,8 @@ orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_iOS_SetBlendMode, DISPLAY, SET_BLEND
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_iOS_SetBitmapClipping, DISPLAY, SET_BITMAP_CLIPPING);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_iOS_SetBitmapData, DISPLAY, SET_BITMAP_DATA);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_iOS_GetBitmapData, DISPLAY, GET_BITMAP_DATA);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_iOS_RequestBitmapData, DISPLAY, REQUEST_BITMAP_DATA);
+orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_iOS_SetPartialBitmapData, DISPLAY, SET_PARTIAL_BITMAP_DATA);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_iOS_GetBitmapSize, DISPLAY, GET_BITMAP_SIZE);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_iOS_GetBitmapID, DISPLAY, GET_BITMAP_ID);
 orxPLUGIN_USER_CORE_FUNCTION_ADD(orxDisplay_iOS_TransformBitmap, DISPLAY, TRANSFORM_BITMAP);
@@ -76,6 +76,9 @@
 #define orxPHYSICS_KU32_STATIC_FLAG_ENABLED     0x00000002 /**< Enabled flag */
 #define orxPHYSICS_KU32_STATIC_FLAG_FIXED_DT    0x00000004 /**< Fixed DT flag */
 #define orxPHYSICS_KU32_STATIC_FLAG_INTERPOLATE 0x00000008 /**< Smoothed flag */
+#define orxPHYSICS_KU32_STATIC_FLAG_ASYNC       0x00000010 /**< Asynchronous step flag */
+#define orxPHYSICS_KU32_STATIC_FLAG_STEP_PENDING 0x00000020 /**< Step pending flag */
+#define orxPHYSICS_KU32_STATIC_FLAG_STEP_DONE   0x00000040 /**< Step done flag */
 
 #define orxPHYSICS_KU32_STATIC_MASK_ALL         0xFFFFFFFF /**< All mask */
 
@@ -178,6 +181,10 @@ typedef struct __orxPHYSICS_STATIC_t
   orxPhysicsContactListener  *poContactListener;      /**< Contact listener */
   orxFLOAT                    fFixedDT;               /**< Fixed DT */
   orxFLOAT                    fDTAccumulator;         /**< DT accumulator */
+  orxFLOAT                    fStepDT;                /**< Variable step DT */
+  orxU32                      u32StepNumber;          /**< Fixed step number */
+  orxTHREAD_JOB              *pstStepJob;             /**< Asynchronous step job */
+  orxU32                      u32StepThread;          /**< Thread currently running the step */
 
   orxFLOAT                    fFixedTimestepAccumulatorRatio;
   orxFLOAT                    fOneMinusRatio;
@@ -217,6 +224,38 @@ void orxPhysics_LiquidFun_Free(void *_pMem, void* callbackData)
   orxMemory_Free(_pMem);
 }
 
+/** Waits for the asynchronous step, if any, to complete: the world can't be accessed from the main thread while it's running
+ */
+static orxINLINE void orxPhysics_LiquidFun_WaitStep()
+{
+  /* Is step running and not called from the step itself? */
+  if((sstPhysics.pstStepJob != orxNULL)
+  && (orxThread_GetCurrent() != sstPhysics.u32StepThread))
+  {
+    /* Checks */
+    orxASSERT(orxThread_GetCurrent() == orxTHREAD_KU32_MAIN_THREAD_ID);
+
+    /* Profiles */
+    orxPROFILER_PUSH_MARKER("orxPhysics_WaitStep");
+
+    /* Waits for it */
+    orxThread_WaitJob(sstPhysics.pstStepJob);
+
+    /* Deletes it */
+    orxThread_DeleteJob(sstPhysics.pstStepJob);
+    sstPhysics.pstStepJob = orxNULL;
+
+    /* Updates status */
+    orxFLAG_SET(sstPhysics.u32Flags, orxPHYSICS_KU32_STATIC_FLAG_STEP_DONE, orxPHYSICS_KU32_STATIC_FLAG_NONE);
+
+    /* Profiles */
+    orxPROFILER_POP_MARKER();
+  }
+
+  /* Done! */
+  return;
+}
+
 class RayCastCallback : public b2RayCastCallback
 {
 public:
@@ -788,6 +827,9 @@ static orxSTATUS orxFASTCALL orxPhysics_LiquidFun_EventHandler(const orxEVENT *_
     {
       orxPHYSICS_DEBUG_RAY *pstRay;
 
+      /* Waits for any in-flight step */
+      orxPhysics_LiquidFun_WaitStep();
+
       /* Draws debug */
       sstPhysics.poWorld->DrawDebugData();
 
@@ -965,6 +1007,183 @@ static void orxFASTCALL orxPhysics_LiquidFun_ResetSmoothedStates()
   }
 }
 
+/** Steps the world simulation, can be run on a task worker thread
+ * @param[in]   _pContext       Unused
+ * @return      orxSTATUS_SUCCESS
+ */
+static orxSTATUS orxFASTCALL orxPhysics_LiquidFun_Step(void *_pContext)
+{
+  orxU32 i;
+
+  /* Stores running thread, callbacks triggered by the step can then access the world without waiting for it */
+  sstPhysics.u32StepThread = orxThread_GetCurrent();
+
+  /* For all steps */
+  for(i = 0; i < sstPhysics.u32StepNumber; i++)
+  {
+    /* Last step and smoothed? */
+    if((i == sstPhysics.u32StepNumber - 1) && orxFLAG_TEST(sstPhysics.u32Flags, orxPHYSICS_KU32_STATIC_FLAG_INTERPOLATE))
+    {
+      /* Reset smoothed states */
+      orxPhysics_LiquidFun_ResetSmoothedStates();
+    }
+
+    /* Updates world simulation */
+    sstPhysics.poWorld->Step(sstPhysics.fFixedDT, sstPhysics.u32Iterations, sstPhysics.u32Iterations >> 1, sstPhysics.u32ParticleIterations);
+  }
+
+  /* Not absolute fixed DT? */
+  if(!orxFLAG_TEST(sstPhysics.u32Flags, orxPHYSICS_KU32_STATIC_FLAG_FIXED_DT))
+  {
+    /* Updates last step of world simulation */
+    sstPhysics.poWorld->Step(sstPhysics.fStepDT, sstPhysics.u32Iterations, sstPhysics.u32Iterations >> 1, sstPhysics.u32ParticleIterations);
+  }
+
+  /* Clears forces */
+  sstPhysics.poWorld->ClearForces();
+
+  /* Clears running thread */
+  sstPhysics.u32StepThread = orxU32_UNDEFINED;
+
+  /* Done! */
+  return orxSTATUS_SUCCESS;
+}
+
+/** Applies the last step results to all bodies and sends stored contact events
+ */
+static void orxFASTCALL orxPhysics_LiquidFun_ApplyStep()
+{
+  orxPHYSICS_BODY          *pstPhysicBody;
+  orxPHYSICS_EVENT_STORAGE *pstEventStorage;
+
+  /* For all physical bodies */
+  for(pstPhysicBody = (orxPHYSICS_BODY*)orxLinkList_GetFirst(&(sstPhysics.stBodyList));
+      pstPhysicBody != orxNULL;
+      pstPhysicBody = (orxPHYSICS_BODY*)orxLinkList_GetNext(&(pstPhysicBody->stNode)))
+  {
+    b2Body *poBody;
+
+    poBody = pstPhysicBody->poBody;
+
+    /* Non-static and awake? */
+    if((poBody->GetType() != b2_staticBody)
+    && (poBody->IsAwake() != false))
+    {
+      /* Applies simulation result */
+      orxPhysics_ApplySimulationResult(pstPhysicBody);
+    }
+  }
+
+  /* For all stored events */
+  for(pstEventStorage = (orxPHYSICS_EVENT_STORAGE *)orxLinkList_GetFirst(&(sstPhysics.stEventList));
+      pstEventStorage != orxNULL;
+      pstEventStorage = (orxPHYSICS_EVENT_STORAGE *)orxLinkList_GetNext(&(pstEventStorage->stNode)))
+  {
+    /* Depending on type */
+    switch(pstEventStorage->eID)
+    {
+      case orxPHYSICS_EVENT_CONTACT_ADD:
+      case orxPHYSICS_EVENT_CONTACT_REMOVE:
+      {
+        /* Sends event */
+        orxEVENT_SEND(orxEVENT_TYPE_PHYSICS, pstEventStorage->eID, orxStructure_GetOwner(orxBODY(pstEventStorage->poSource->GetUserData())), orxStructure_GetOwner(orxBODY(pstEventStorage->poDestination->GetUserData())), &(pstEventStorage->stPayload));
+
+        break;
+      }
+
+      default:
+      {
+        break;
+      }
+    }
+  }
+
+  /* Clears stored events */
+  orxLinkList_Clean(&(sstPhysics.stEventList));
+  orxBank_Clear(sstPhysics.pstEventBank);
+
+  /* Done! */
+  return;
+}
+
+/** Resolves the pending step, if any: completes it (waiting for it or running it right away) and applies its results
+ */
+static void orxFASTCALL orxPhysics_LiquidFun_ResolveStep()
+{
+  /* Waits for any in-flight step */
+  orxPhysics_LiquidFun_WaitStep();
+
+  /* Step not started yet? */
+  if(orxFLAG_TEST(sstPhysics.u32Flags, orxPHYSICS_KU32_STATIC_FLAG_STEP_PENDING))
+  {
+    /* Steps now */
+    orxPhysics_LiquidFun_Step(orxNULL);
+
+    /* Updates status */
+    orxFLAG_SET(sstPhysics.u32Flags, orxPHYSICS_KU32_STATIC_FLAG_STEP_DONE, orxPHYSICS_KU32_STATIC_FLAG_STEP_PENDING);
+  }
+
+  /* Has results? */
+  if(orxFLAG_TEST(sstPhysics.u32Flags, orxPHYSICS_KU32_STATIC_FLAG_STEP_DONE))
+  {
+    /* Updates status */
+    orxFLAG_SET(sstPhysics.u32Flags, orxPHYSICS_KU32_STATIC_FLAG_NONE, orxPHYSICS_KU32_STATIC_FLAG_STEP_DONE);
+
+    /* Applies them */
+    orxPhysics_LiquidFun_ApplyStep();
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Render event handler, overlaps the pending step with rendering
+ * @param[in]   _pstEvent                     Sent event
+ * @return      orxSTATUS_SUCCESS if handled / orxSTATUS_FAILURE otherwise
+ */
+static orxSTATUS orxFASTCALL orxPhysics_LiquidFun_StepEventHandler(const orxEVENT *_pstEvent)
+{
+  /* Checks */
+  orxASSERT(_pstEvent->eType == orxEVENT_TYPE_RENDER);
+
+  /* Start of rendering? */
+  if(_pstEvent->eID == orxRENDER_EVENT_START)
+  {
+    /* Has pending step? */
+    if(orxFLAG_TEST(sstPhysics.u32Flags, orxPHYSICS_KU32_STATIC_FLAG_STEP_PENDING))
+    {
+      /* Creates step job */
+      sstPhysics.pstStepJob = orxThread_CreateJob(&orxPhysics_LiquidFun_Step, orxNULL);
+
+      /* Valid? */
+      if(sstPhysics.pstStepJob != orxNULL)
+      {
+        /* Runs it */
+        if(orxThread_RunJob(sstPhysics.pstStepJob) != orxSTATUS_FAILURE)
+        {
+          /* Updates status */
+          orxFLAG_SET(sstPhysics.u32Flags, orxPHYSICS_KU32_STATIC_FLAG_NONE, orxPHYSICS_KU32_STATIC_FLAG_STEP_PENDING);
+        }
+        else
+        {
+          /* Deletes it, the step will run synchronously at the end of rendering */
+          orxThread_DeleteJob(sstPhysics.pstStepJob);
+          sstPhysics.pstStepJob = orxNULL;
+        }
+      }
+    }
+  }
+  /* End of rendering */
+  else
+  {
+    /* Resolves pending step */
+    orxPhysics_LiquidFun_ResolveStep();
+  }
+
+  /* Done! */
+  return orxSTATUS_SUCCESS;
+}
+
 /** Update (callback to register on a clock)
  * @param[in]   _pstClockInfo   Clock info of the clock used upon registration
  * @param[in]   _pContext       Context sent when registering callback to the clock
@@ -981,6 +1200,9 @@ static void orxFASTCALL orxPhysics_LiquidFun_Update(const orxCLOCK_INFO *_pstClo
   orxASSERT(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstClockInfo != orxNULL);
 
+  /* Resolves any step left from the previous frame */
+  orxPhysics_LiquidFun_ResolveStep();
+
   /* For all physical bodies */
   for(pstPhysicBody = (orxPHYSICS_BODY*)orxLinkList_GetFirst(&(sstPhysics.stBodyList));
       pstPhysicBody != orxNULL;
@@ -1079,8 +1301,7 @@ static void orxFASTCALL orxPhysics_LiquidFun_Update(const orxCLOCK_INFO *_pstClo
   /* Is simulation enabled? */
   if(orxFLAG_TEST(sstPhysics.u32Flags, orxPHYSICS_KU32_STATIC_FLAG_ENABLED))
   {
-    orxPHYSICS_EVENT_STORAGE *pstEventStorage;
-    orxU32                    u32Steps, i;
+    orxU32 u32Steps;
 
     /* Stores DT */
     sstPhysics.fLastDT = _pstClockInfo->fDT;
@@ -1094,33 +1315,19 @@ static void orxFASTCALL orxPhysics_LiquidFun_Update(const orxCLOCK_INFO *_pstClo
     /* Updates accumulator */
     sstPhysics.fDTAccumulator = orxMAX(orxFLOAT_0, sstPhysics.fDTAccumulator - (orxU2F(u32Steps) * sstPhysics.fFixedDT));
 
-    /* For all steps */
-    for(i = 0; i < u32Steps; i++)
-    {
-      /* Last step and smoothed? */
-      if((i == u32Steps - 1) && orxFLAG_TEST(sstPhysics.u32Flags, orxPHYSICS_KU32_STATIC_FLAG_INTERPOLATE))
-      {
-        /* Reset smoothed states */
-        orxPhysics_LiquidFun_ResetSmoothedStates();
-      }
-
-      /* Updates world simulation */
-      sstPhysics.poWorld->Step(sstPhysics.fFixedDT, sstPhysics.u32Iterations, sstPhysics.u32Iterations >> 1, sstPhysics.u32ParticleIterations);
-    }
+    /* Stores fixed step number */
+    sstPhysics.u32StepNumber = u32Steps;
 
     /* Not absolute fixed DT? */
     if(!orxFLAG_TEST(sstPhysics.u32Flags, orxPHYSICS_KU32_STATIC_FLAG_FIXED_DT))
     {
-      /* Updates last step of world simulation */
-      sstPhysics.poWorld->Step(sstPhysics.fDTAccumulator, sstPhysics.u32Iterations, sstPhysics.u32Iterations >> 1, sstPhysics.u32ParticleIterations);
+      /* Stores last step DT */
+      sstPhysics.fStepDT = sstPhysics.fDTAccumulator;
 
       /* Clears accumulator */
       sstPhysics.fDTAccumulator = orxFLOAT_0;
     }
 
-    /* Clears forces */
-    sstPhysics.poWorld->ClearForces();
-
     if(orxFLAG_TEST(sstPhysics.u32Flags, orxPHYSICS_KU32_STATIC_FLAG_INTERPOLATE))
     {
       /* Updates accumulator ratio */
@@ -1128,49 +1335,15 @@ static void orxFASTCALL orxPhysics_LiquidFun_Update(const orxCLOCK_INFO *_pstClo
       sstPhysics.fOneMinusRatio = orxFLOAT_1 - sstPhysics.fFixedTimestepAccumulatorRatio;
     }
 
-    /* For all physical bodies */
-    for(pstPhysicBody = (orxPHYSICS_BODY*)orxLinkList_GetFirst(&(sstPhysics.stBodyList));
-        pstPhysicBody != orxNULL;
-        pstPhysicBody = (orxPHYSICS_BODY*)orxLinkList_GetNext(&(pstPhysicBody->stNode)))
-    {
-      poBody = pstPhysicBody->poBody;
-
-      /* Non-static and awake? */
-      if((poBody->GetType() != b2_staticBody)
-      && (poBody->IsAwake() != false))
-      {
-        /* Applies simulation result */
-        orxPhysics_ApplySimulationResult(pstPhysicBody);
-      }
-    }
+    /* Updates status */
+    orxFLAG_SET(sstPhysics.u32Flags, orxPHYSICS_KU32_STATIC_FLAG_STEP_PENDING, orxPHYSICS_KU32_STATIC_FLAG_NONE);
 
-    /* For all stored events */
-    for(pstEventStorage = (orxPHYSICS_EVENT_STORAGE *)orxLinkList_GetFirst(&(sstPhysics.stEventList));
-        pstEventStorage != orxNULL;
-        pstEventStorage = (orxPHYSICS_EVENT_STORAGE *)orxLinkList_GetNext(&(pstEventStorage->stNode)))
+    /* Synchronous? */
+    if(!orxFLAG_TEST(sstPhysics.u32Flags, orxPHYSICS_KU32_STATIC_FLAG_ASYNC))
     {
-      /* Depending on type */
-      switch(pstEventStorage->eID)
-      {
-        case orxPHYSICS_EVENT_CONTACT_ADD:
-        case orxPHYSICS_EVENT_CONTACT_REMOVE:
-        {
-          /* Sends event */
-          orxEVENT_SEND(orxEVENT_TYPE_PHYSICS, pstEventStorage->eID, orxStructure_GetOwner(orxBODY(pstEventStorage->poSource->GetUserData())), orxStructure_GetOwner(orxBODY(pstEventStorage->poDestination->GetUserData())), &(pstEventStorage->stPayload));
-
-          break;
-        }
-
-        default:
-        {
-          break;
-        }
-      }
+      /* Steps & applies results right away */
+      orxPhysics_LiquidFun_ResolveStep();
     }
-
-    /* Clears stored events */
-    orxLinkList_Clean(&(sstPhysics.stEventList));
-    orxBank_Clear(sstPhysics.pstEventBank);
   }
 
   /* Profiles */
@@ -1190,6 +1363,9 @@ extern "C" orxPHYSICS_BODY *orxFASTCALL orxPhysics_LiquidFun_CreateBody(const or
   orxASSERT(_hUserData != orxHANDLE_UNDEFINED);
   orxASSERT(_pstBodyDef != orxNULL);
 
+  /* Waits for any in-flight step */
+  orxPhysics_LiquidFun_WaitStep();
+
   /* 2D? */
   if(orxFLAG_TEST(_pstBodyDef->u32Flags, orxBODY_DEF_KU32_FLAG_2D))
   {
@@ -1284,6 +1460,9 @@ extern "C" void orxFASTCALL orxPhysics_LiquidFun_DeleteBody(orxPHYSICS_BODY *_ps
   orxASSERT(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstBody != orxNULL);
 
+  /* Waits for any in-flight step */
+  orxPhysics_LiquidFun_WaitStep();
+
   /* For all stored events */
   for(pstEventStorage = (orxPHYSICS_EVENT_STORAGE *)orxLinkList_GetFirst(&(sstPhysics.stEventList));
       pstEventStorage != orxNULL;
@@ -1332,6 +1511,9 @@ extern "C" orxPHYSICS_BODY_PART *orxFASTCALL orxPhysics_LiquidFun_CreatePart(orx
   orxASSERT(_pstBodyPartDef != orxNULL);
   orxASSERT(orxFLAG_TEST(_pstBodyPartDef->u32Flags, orxBODY_PART_DEF_KU32_MASK_TYPE));
 
+  /* Waits for any in-flight step */
+  orxPhysics_LiquidFun_WaitStep();
+
   /* Gets body */
   poBody = (b2Body *)_pstBody->poBody;
 
@@ -1521,6 +1703,9 @@ extern "C" void orxFASTCALL orxPhysics_LiquidFun_DeletePart(orxPHYSICS_BODY_PART
   orxASSERT(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstBodyPart != orxNULL);
 
+  /* Waits for any in-flight step */
+  orxPhysics_LiquidFun_WaitStep();
+
   /* Gets Fixture */
   poFixture = (b2Fixture *)_pstBodyPart;
 
@@ -1556,6 +1741,9 @@ extern "C" orxPHYSICS_BODY_JOINT *orxFASTCALL orxPhysics_LiquidFun_CreateJoint(o
   orxASSERT(_pstBodyJointDef != orxNULL);
   orxASSERT(orxFLAG_TEST(_pstBodyJointDef->u32Flags, orxBODY_JOINT_DEF_KU32_MASK_TYPE));
 
+  /* Waits for any in-flight step */
+  orxPhysics_LiquidFun_WaitStep();
+
   /* Depending on joint type */
   switch(orxFLAG_GET(_pstBodyJointDef->u32Flags, orxBODY_JOINT_DEF_KU32_MASK_TYPE))
   {
@@ -1892,6 +2080,9 @@ extern "C" void orxFASTCALL orxPhysics_LiquidFun_DeleteJoint(orxPHYSICS_BODY_JOI
   orxASSERT(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstBodyJoint != orxNULL);
 
+  /* Waits for any in-flight step */
+  orxPhysics_LiquidFun_WaitStep();
+
   /* Deletes it */
   sstPhysics.poWorld->DestroyJoint((b2Joint *)_pstBodyJoint);
 
@@ -1906,6 +2097,9 @@ extern "C" void orxFASTCALL orxPhysics_LiquidFun_EnableMotor(orxPHYSICS_BODY_JOI
   orxASSERT(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstBodyJoint != orxNULL);
 
+  /* Waits for any in-flight step */
+  orxPhysics_LiquidFun_WaitStep();
+
   /* Gets joint */
   poJoint = (b2Joint *)_pstBodyJoint;
 
@@ -1933,6 +2127,9 @@ extern "C" void orxFASTCALL orxPhysics_LiquidFun_SetJointMotorSpeed(orxPHYSICS_B
   orxASSERT(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstBodyJoint != orxNULL);
 
+  /* Waits for any in-flight step */
+  orxPhysics_LiquidFun_WaitStep();
+
   /* Gets joint */
   poJoint = (b2Joint *)_pstBodyJoint;
 
@@ -1960,6 +2157,9 @@ extern "C" void orxFASTCALL orxPhysics_LiquidFun_SetJointMaxMotorTorque(orxPHYSI
   orxASSERT(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstBodyJoint != orxNULL);
 
+  /* Waits for any in-flight step */
+  orxPhysics_LiquidFun_WaitStep();
+
   /* Gets joint */
   poJoint = (b2Joint *)_pstBodyJoint;
 
@@ -1989,6 +2189,9 @@ extern "C" orxVECTOR *orxFASTCALL orxPhysics_LiquidFun_GetJointReactionForce(con
   orxASSERT(_pstBodyJoint != orxNULL);
   orxASSERT(_pvForce != orxNULL);
 
+  /* Waits for any in-flight step */
+  orxPhysics_LiquidFun_WaitStep();
+
   /* Gets joint */
   poJoint = (const b2Joint *)_pstBodyJoint;
 
@@ -2011,6 +2214,9 @@ extern "C" orxFLOAT orxFASTCALL orxPhysics_LiquidFun_GetJointReactionTorque(cons
   orxASSERT(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstBodyJoint != orxNULL);
 
+  /* Waits for any in-flight step */
+  orxPhysics_LiquidFun_WaitStep();
+
   /* Gets joint */
   poJoint = (const b2Joint *)_pstBodyJoint;
 
@@ -2032,6 +2238,9 @@ extern "C" orxSTATUS orxFASTCALL orxPhysics_LiquidFun_SetPosition(orxPHYSICS_BOD
   orxASSERT(_pstBody != orxNULL);
   orxASSERT(_pvPosition != orxNULL);
 
+  /* Waits for any in-flight step */
+  orxPhysics_LiquidFun_WaitStep();
+
   /* Gets body */
   poBody = (b2Body *)_pstBody->poBody;
 
@@ -2086,6 +2295,9 @@ extern "C" orxSTATUS orxFASTCALL orxPhysics_LiquidFun_SetRotation(orxPHYSICS_BOD
   orxASSERT(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstBody != orxNULL);
 
+  /* Waits for any in-flight step */
+  orxPhysics_LiquidFun_WaitStep();
+
   /* Gets body */
   poBody = (b2Body *)_pstBody->poBody;
 
@@ -2135,6 +2347,9 @@ extern "C" orxSTATUS orxFASTCALL orxPhysics_LiquidFun_SetSpeed(orxPHYSICS_BODY *
   orxASSERT(_pstBody != orxNULL);
   orxASSERT(_pvSpeed != orxNULL);
 
+  /* Waits for any in-flight step */
+  orxPhysics_LiquidFun_WaitStep();
+
   /* Gets body */
   poBody = (b2Body *)_pstBody->poBody;
 
@@ -2168,6 +2383,9 @@ extern "C" orxSTATUS orxFASTCALL orxPhysics_LiquidFun_SetAngularVelocity(orxPHYS
   orxASSERT(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstBody != orxNULL);
 
+  /* Waits for any in-flight step */
+  orxPhysics_LiquidFun_WaitStep();
+
   /* Gets body */
   poBody = (b2Body *)_pstBody->poBody;
 
@@ -2198,6 +2416,9 @@ extern "C" orxSTATUS orxFASTCALL orxPhysics_LiquidFun_SetCustomGravity(orxPHYSIC
   orxASSERT(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstBody != orxNULL);
 
+  /* Waits for any in-flight step */
+  orxPhysics_LiquidFun_WaitStep();
+
   /* Gets body */
   poBody = (b2Body *)_pstBody->poBody;
 
@@ -2248,6 +2469,9 @@ extern "C" orxSTATUS orxFASTCALL orxPhysics_LiquidFun_SetFixedRotation(orxPHYSIC
   orxASSERT(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstBody != orxNULL);
 
+  /* Waits for any in-flight step */
+  orxPhysics_LiquidFun_WaitStep();
+
   /* Gets body */
   poBody = (b2Body *)_pstBody->poBody;
 
@@ -2267,6 +2491,9 @@ extern "C" orxSTATUS orxFASTCALL orxPhysics_LiquidFun_SetDynamic(orxPHYSICS_BODY
   orxASSERT(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstBody != orxNULL);
 
+  /* Waits for any in-flight step */
+  orxPhysics_LiquidFun_WaitStep();
+
   /* Gets body */
   poBody = (b2Body *)_pstBody->poBody;
 
@@ -2300,6 +2527,9 @@ extern "C" orxSTATUS orxFASTCALL orxPhysics_LiquidFun_SetAllowMoving(orxPHYSICS_
   orxASSERT(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstBody != orxNULL);
 
+  /* Waits for any in-flight step */
+  orxPhysics_LiquidFun_WaitStep();
+
   /* Gets body */
   poBody = (b2Body *)_pstBody->poBody;
 
@@ -2325,6 +2555,9 @@ extern "C" orxVECTOR *orxFASTCALL orxPhysics_LiquidFun_GetPosition(const orxPHYS
   orxASSERT(_pstBody != orxNULL);
   orxASSERT(_pvPosition != orxNULL);
 
+  /* Waits for any in-flight step */
+  orxPhysics_LiquidFun_WaitStep();
+
   /* Gets body */
   poBody = (b2Body *)_pstBody->poBody;
 
@@ -2349,6 +2582,9 @@ extern "C" orxFLOAT orxFASTCALL orxPhysics_LiquidFun_GetRotation(const orxPHYSIC
   orxASSERT(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstBody != orxNULL);
 
+  /* Waits for any in-flight step */
+  orxPhysics_LiquidFun_WaitStep();
+
   /* Gets body */
   poBody = (b2Body *)_pstBody->poBody;
 
@@ -2370,6 +2606,9 @@ extern "C" orxVECTOR *orxFASTCALL orxPhysics_LiquidFun_GetSpeed(const orxPHYSICS
   orxASSERT(_pstBody != orxNULL);
   orxASSERT(_pvSpeed != orxNULL);
 
+  /* Waits for any in-flight step */
+  orxPhysics_LiquidFun_WaitStep();
+
   /* Gets body */
   poBody = (b2Body *)_pstBody->poBody;
 
@@ -2398,6 +2637,9 @@ extern "C" orxVECTOR *orxFASTCALL orxPhysics_LiquidFun_GetSpeedAtWorldPosition(c
   orxASSERT(_pvPosition != orxNULL);
   orxASSERT(_pvSpeed != orxNULL);
 
+  /* Waits for any in-flight step */
+  orxPhysics_LiquidFun_WaitStep();
+
   /* Gets body */
   poBody = (b2Body *)_pstBody->poBody;
 
@@ -2423,6 +2665,9 @@ extern "C" orxFLOAT orxFASTCALL orxPhysics_LiquidFun_GetAngularVelocity(const or
   orxASSERT(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstBody != orxNULL);
 
+  /* Waits for any in-flight step */
+  orxPhysics_LiquidFun_WaitStep();
+
   /* Gets body */
   poBody = (b2Body *)_pstBody->poBody;
 
@@ -2444,6 +2689,9 @@ extern "C" orxVECTOR *orxFASTCALL orxPhysics_LiquidFun_GetCustomGravity(const or
   orxASSERT(_pstBody != orxNULL);
   orxASSERT(_pvCustomGravity != orxNULL);
 
+  /* Waits for any in-flight step */
+  orxPhysics_LiquidFun_WaitStep();
+
   /* Gets body */
   poBody = (b2Body *)_pstBody->poBody;
 
@@ -2476,6 +2724,9 @@ extern "C" orxBOOL orxFASTCALL orxPhysics_LiquidFun_IsFixedRotation(const orxPHY
   orxASSERT(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstBody != orxNULL);
 
+  /* Waits for any in-flight step */
+  orxPhysics_LiquidFun_WaitStep();
+
   /* Gets body */
   poBody = (b2Body *)_pstBody->poBody;
 
@@ -2495,6 +2746,9 @@ extern "C" orxFLOAT orxFASTCALL orxPhysics_LiquidFun_GetMass(const orxPHYSICS_BO
   orxASSERT(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstBody != orxNULL);
 
+  /* Waits for any in-flight step */
+  orxPhysics_LiquidFun_WaitStep();
+
   /* Gets body */
   poBody = (b2Body *)_pstBody->poBody;
 
@@ -2516,6 +2770,9 @@ extern "C" orxVECTOR *orxFASTCALL orxPhysics_LiquidFun_GetMassCenter(const orxPH
   orxASSERT(_pstBody != orxNULL);
   orxASSERT(_pvMassCenter != orxNULL);
 
+  /* Waits for any in-flight step */
+  orxPhysics_LiquidFun_WaitStep();
+
   /* Gets body */
   poBody = (b2Body *)_pstBody->poBody;
 
@@ -2543,6 +2800,9 @@ extern "C" orxSTATUS orxFASTCALL orxPhysics_LiquidFun_SetLinearDamping(orxPHYSIC
   orxASSERT(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstBody != orxNULL);
 
+  /* Waits for any in-flight step */
+  orxPhysics_LiquidFun_WaitStep();
+
   /* Gets body */
   poBody = (b2Body *)_pstBody->poBody;
 
@@ -2562,6 +2822,9 @@ extern "C" orxSTATUS orxFASTCALL orxPhysics_LiquidFun_SetAngularDamping(orxPHYSI
   orxASSERT(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstBody != orxNULL);
 
+  /* Waits for any in-flight step */
+  orxPhysics_LiquidFun_WaitStep();
+
   /* Gets body */
   poBody = (b2Body *)_pstBody->poBody;
 
@@ -2581,6 +2844,9 @@ extern "C" orxFLOAT orxFASTCALL orxPhysics_LiquidFun_GetLinearDamping(const orxP
   orxASSERT(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstBody != orxNULL);
 
+  /* Waits for any in-flight step */
+  orxPhysics_LiquidFun_WaitStep();
+
   /* Gets body */
   poBody = (b2Body *)_pstBody->poBody;
 
@@ -2600,6 +2866,9 @@ extern "C" orxFLOAT orxFASTCALL orxPhysics_LiquidFun_GetAngularDamping(const orx
   orxASSERT(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstBody != orxNULL);
 
+  /* Waits for any in-flight step */
+  orxPhysics_LiquidFun_WaitStep();
+
   /* Gets body */
   poBody = (b2Body *)_pstBody->poBody;
 
@@ -2621,6 +2890,9 @@ extern "C" orxSTATUS orxFASTCALL orxPhysics_LiquidFun_ApplyTorque(orxPHYSICS_BOD
   orxASSERT(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstBody != orxNULL);
 
+  /* Waits for any in-flight step */
+  orxPhysics_LiquidFun_WaitStep();
+
   /* Gets body */
   poBody = (b2Body *)_pstBody->poBody;
 
@@ -2671,6 +2943,9 @@ extern "C" orxSTATUS orxFASTCALL orxPhysics_LiquidFun_ApplyForce(orxPHYSICS_BODY
   orxASSERT(_pstBody != orxNULL);
   orxASSERT(_pvForce != orxNULL);
 
+  /* Waits for any in-flight step */
+  orxPhysics_LiquidFun_WaitStep();
+
   /* Sets force */
   vForce.Set(_pvForce->fX, _pvForce->fY);
 
@@ -2736,6 +3011,9 @@ extern "C" orxSTATUS orxFASTCALL orxPhysics_LiquidFun_ApplyImpulse(orxPHYSICS_BO
   orxASSERT(_pstBody != orxNULL);
   orxASSERT(_pvImpulse != orxNULL);
 
+  /* Waits for any in-flight step */
+  orxPhysics_LiquidFun_WaitStep();
+
   /* Sets impulse */
   vImpulse.Set(sstPhysics.fDimensionRatio * _pvImpulse->fX, sstPhysics.fDimensionRatio * _pvImpulse->fY);
 
@@ -2799,6 +3077,9 @@ extern "C" orxSTATUS orxFASTCALL orxPhysics_LiquidFun_SetPartSelfFlags(orxPHYSIC
   orxASSERT(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstBodyPart != orxNULL);
 
+  /* Waits for any in-flight step */
+  orxPhysics_LiquidFun_WaitStep();
+
   /* Gets fixture */
   poFixture = (b2Fixture *)_pstBodyPart;
 
@@ -2825,6 +3106,9 @@ extern "C" orxSTATUS orxFASTCALL orxPhysics_LiquidFun_SetPartCheckMask(orxPHYSIC
   orxASSERT(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstBodyPart != orxNULL);
 
+  /* Waits for any in-flight step */
+  orxPhysics_LiquidFun_WaitStep();
+
   /* Gets fixture */
   poFixture = (b2Fixture *)_pstBodyPart;
 
@@ -2850,6 +3134,9 @@ extern "C" orxU16 orxFASTCALL orxPhysics_LiquidFun_GetPartSelfFlags(const orxPHY
   orxASSERT(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstBodyPart != orxNULL);
 
+  /* Waits for any in-flight step */
+  orxPhysics_LiquidFun_WaitStep();
+
   /* Gets fixture */
   poFixture = (b2Fixture *)_pstBodyPart;
 
@@ -2869,6 +3156,9 @@ extern "C" orxU16 orxFASTCALL orxPhysics_LiquidFun_GetPartCheckMask(const orxPHY
   orxASSERT(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstBodyPart != orxNULL);
 
+  /* Waits for any in-flight step */
+  orxPhysics_LiquidFun_WaitStep();
+
   /* Gets fixture */
   poFixture = (b2Fixture *)_pstBodyPart;
 
@@ -2888,6 +3178,9 @@ extern "C" orxSTATUS orxFASTCALL orxPhysics_LiquidFun_SetPartSolid(orxPHYSICS_BO
   orxASSERT(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstBodyPart != orxNULL);
 
+  /* Waits for any in-flight step */
+  orxPhysics_LiquidFun_WaitStep();
+
   /* Gets fixture */
   poFixture = (b2Fixture *)_pstBodyPart;
 
@@ -2907,6 +3200,9 @@ extern "C" orxBOOL orxFASTCALL orxPhysics_LiquidFun_IsPartSolid(const orxPHYSICS
   orxASSERT(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstBodyPart != orxNULL);
 
+  /* Waits for any in-flight step */
+  orxPhysics_LiquidFun_WaitStep();
+
   /* Gets fixture */
   poFixture = (b2Fixture *)_pstBodyPart;
 
@@ -2926,6 +3222,9 @@ extern "C" orxSTATUS orxFASTCALL orxPhysics_LiquidFun_SetPartFriction(orxPHYSICS
   orxASSERT(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstBodyPart != orxNULL);
 
+  /* Waits for any in-flight step */
+  orxPhysics_LiquidFun_WaitStep();
+
   /* Gets fixture */
   poFixture = (b2Fixture *)_pstBodyPart;
 
@@ -2945,6 +3244,9 @@ extern "C" orxFLOAT orxFASTCALL orxPhysics_LiquidFun_GetPartFriction(const orxPH
   orxASSERT(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstBodyPart != orxNULL);
 
+  /* Waits for any in-flight step */
+  orxPhysics_LiquidFun_WaitStep();
+
   /* Gets fixture */
   poFixture = (b2Fixture *)_pstBodyPart;
 
@@ -2964,6 +3266,9 @@ extern "C" orxSTATUS orxFASTCALL orxPhysics_LiquidFun_SetPartRestitution(orxPHYS
   orxASSERT(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstBodyPart != orxNULL);
 
+  /* Waits for any in-flight step */
+  orxPhysics_LiquidFun_WaitStep();
+
   /* Gets fixture */
   poFixture = (b2Fixture *)_pstBodyPart;
 
@@ -2983,6 +3288,9 @@ extern "C" orxFLOAT orxFASTCALL orxPhysics_LiquidFun_GetPartRestitution(const or
   orxASSERT(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstBodyPart != orxNULL);
 
+  /* Waits for any in-flight step */
+  orxPhysics_LiquidFun_WaitStep();
+
   /* Gets fixture */
   poFixture = (b2Fixture *)_pstBodyPart;
 
@@ -3002,6 +3310,9 @@ extern "C" orxSTATUS orxFASTCALL orxPhysics_LiquidFun_SetPartDensity(orxPHYSICS_
   orxASSERT(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstBodyPart != orxNULL);
 
+  /* Waits for any in-flight step */
+  orxPhysics_LiquidFun_WaitStep();
+
   /* Gets fixture */
   poFixture = (b2Fixture *)_pstBodyPart;
 
@@ -3021,6 +3332,9 @@ extern "C" orxFLOAT orxFASTCALL orxPhysics_LiquidFun_GetPartDensity(const orxPHY
   orxASSERT(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstBodyPart != orxNULL);
 
+  /* Waits for any in-flight step */
+  orxPhysics_LiquidFun_WaitStep();
+
   /* Gets fixture */
   poFixture = (b2Fixture *)_pstBodyPart;
 
@@ -3042,6 +3356,9 @@ extern "C" orxHANDLE orxFASTCALL orxPhysics_LiquidFun_Raycast(const orxVECTOR *_
   orxASSERT(_pvBegin != orxNULL);
   orxASSERT(_pvEnd != orxNULL);
 
+  /* Waits for any in-flight step */
+  orxPhysics_LiquidFun_WaitStep();
+
   /* Gets extremities */
   vBegin.Set(sstPhysics.fDimensionRatio * _pvBegin->fX, sstPhysics.fDimensionRatio * _pvBegin->fY);
   vEnd.Set(sstPhysics.fDimensionRatio * _pvEnd->fX, sstPhysics.fDimensionRatio * _pvEnd->fY);
@@ -3123,6 +3440,9 @@ extern "C" void orxFASTCALL orxPhysics_LiquidFun_EnableSimulation(orxBOOL _bEnab
   /* Checks */
   orxASSERT(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY);
 
+  /* Waits for any in-flight step */
+  orxPhysics_LiquidFun_WaitStep();
+
   /* Enabled? */
   if(_bEnable != orxFALSE)
   {
@@ -3148,6 +3468,9 @@ extern "C" orxSTATUS orxFASTCALL orxPhysics_LiquidFun_SetGravity(const orxVECTOR
   orxASSERT(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY);
   orxASSERT(_pvGravity != orxNULL);
 
+  /* Waits for any in-flight step */
+  orxPhysics_LiquidFun_WaitStep();
+
   /* Sets gravity vector */
   vGravity.Set(sstPhysics.fDimensionRatio * _pvGravity->fX, sstPhysics.fDimensionRatio * _pvGravity->fY);
 
@@ -3167,6 +3490,9 @@ extern "C" orxVECTOR *orxFASTCALL orxPhysics_LiquidFun_GetGravity(orxVECTOR *_pv
   orxASSERT(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY);
   orxASSERT(_pvGravity != orxNULL);
 
+  /* Waits for any in-flight step */
+  orxPhysics_LiquidFun_WaitStep();
+
   /* Gets gravity vector */
   vGravity = sstPhysics.poWorld->GetGravity();
   orxVector_Set(_pvGravity, sstPhysics.fRecDimensionRatio * vGravity.x, sstPhysics.fRecDimensionRatio * vGravity.y, orxFLOAT_0);
@@ -3188,6 +3514,7 @@ extern "C" orxSTATUS orxFASTCALL orxPhysics_LiquidFun_Init()
 
     /* Cleans static controller */
     orxMemory_Zero(&sstPhysics, sizeof(orxPHYSICS_STATIC));
+    sstPhysics.u32StepThread = orxU32_UNDEFINED;
 
     /* Pushes config section */
     orxConfig_PushSection(orxPHYSICS_KZ_CONFIG_SECTION);
@@ -3226,6 +3553,13 @@ extern "C" orxSTATUS orxFASTCALL orxPhysics_LiquidFun_Init()
       }
     }
 
+    /* Asynchronous step? */
+    if(orxConfig_GetBool(orxPHYSICS_KZ_CONFIG_ASYNCHRONOUS) != orxFALSE)
+    {
+      /* Updates status */
+      orxFLAG_SET(sstPhysics.u32Flags, orxPHYSICS_KU32_STATIC_FLAG_ASYNC, orxPHYSICS_KU32_STATIC_FLAG_NONE);
+    }
+
     /* Gets dimension ratio */
     fRatio = orxConfig_GetFloat(orxPHYSICS_KZ_CONFIG_RATIO);
 
@@ -3330,6 +3664,14 @@ extern "C" orxSTATUS orxFASTCALL orxPhysics_LiquidFun_Init()
 
 #endif /* orxPHYSICS_ENABLE_DEBUG_DRAW */
 
+            /* Asynchronous? */
+            if(orxFLAG_TEST(sstPhysics.u32Flags, orxPHYSICS_KU32_STATIC_FLAG_ASYNC))
+            {
+              /* Adds step event handler */
+              orxEvent_AddHandler(orxEVENT_TYPE_RENDER, orxPhysics_LiquidFun_StepEventHandler);
+              orxEvent_SetHandlerIDFlags(orxPhysics_LiquidFun_StepEventHandler, orxEVENT_TYPE_RENDER, orxNULL, orxEVENT_GET_FLAG(orxRENDER_EVENT_START) | orxEVENT_GET_FLAG(orxRENDER_EVENT_STOP), orxEVENT_KU32_MASK_ID_ALL);
+            }
+
             /* Updates status */
             sstPhysics.u32Flags |= orxPHYSICS_KU32_STATIC_FLAG_READY | orxPHYSICS_KU32_STATIC_FLAG_ENABLED;
           }
@@ -3398,6 +3740,16 @@ extern "C" void orxFASTCALL orxPhysics_LiquidFun_Exit()
   /* Was initialized? */
   if(sstPhysics.u32Flags & orxPHYSICS_KU32_STATIC_FLAG_READY)
   {
+    /* Waits for any in-flight step */
+    orxPhysics_LiquidFun_WaitStep();
+
+    /* Asynchronous? */
+    if(orxFLAG_TEST(sstPhysics.u32Flags, orxPHYSICS_KU32_STATIC_FLAG_ASYNC))
+    {
+      /* Removes step event handler */
+      orxEvent_RemoveHandler(orxEVENT_TYPE_RENDER, orxPhysics_LiquidFun_StepEventHandler);
+    }
+
     /* Deletes body bank */
     orxBank_Delete(sstPhysics.pstBodyBank);
 
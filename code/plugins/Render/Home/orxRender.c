@@ -62,7 +62,13 @@
 /** Defines
  */
 #define orxRENDER_KF_TICK_SIZE                      orx2F(1.0f / 10.0f)
-#define orxRENDER_KU32_ORDER_BANK_SIZE              1024
+#define orxRENDER_KU32_QUEUE_SIZE                   1024
+#define orxRENDER_KU32_CULL_GRAIN                   256
+
+#define orxRENDER_KU32_SORT_KEY_TEXTURE_BITS        19
+#define orxRENDER_KU32_SORT_KEY_SHADER_BITS         8
+#define orxRENDER_KU32_SORT_KEY_BLEND_BITS          3
+#define orxRENDER_KU32_SORT_KEY_SMOOTHING_BITS      2
 #define orxRENDER_KST_DEFAULT_COLOR                 orx2RGBA(255, 0, 0, 255)
 #define orxRENDER_KZ_FPS_FORMAT                     "FPS: %d"
 #define orxRENDER_KF_CONSOLE_BLINK_DELAY            orx2F(0.5f)
@@ -118,17 +124,38 @@
 
 typedef struct __orxRENDER_RENDER_NODE_t
 {
-  orxLINKLIST_NODE      stNode;                     /**< Linklist node : 12 */
-  orxTEXTURE           *pstTexture;                 /**< Texture pointer : 16 */
-  const orxSHADER      *pstShader;                  /**< Shader pointer : 20 */
-  orxOBJECT            *pstObject;                  /**< Object pointer : 24 */
-  orxFLOAT              fZ;                         /**< Z coordinate : 28 */
-  orxDISPLAY_BLEND_MODE eBlendMode;                 /**< Blend mode : 32 */
-  orxDISPLAY_SMOOTHING  eSmoothing;                 /**< Smoothing : 36 */
-  orxFLOAT              fDepthCoef;                 /**< Depth coef : 40 */
+  const orxBITMAP      *pstBitmap;                  /**< Bitmap pointer (shared by textures packed in the same atlas) : 4 */
+  const orxSHADER      *pstShader;                  /**< Shader pointer : 8 */
+  orxOBJECT            *pstObject;                  /**< Object pointer : 12 */
+  orxFLOAT              fZ;                         /**< Z coordinate : 16 */
+  orxDISPLAY_BLEND_MODE eBlendMode;                 /**< Blend mode : 20 */
+  orxDISPLAY_SMOOTHING  eSmoothing;                 /**< Smoothing : 24 */
+  orxFLOAT              fDepthCoef;                 /**< Depth coef : 28 */
 
 } orxRENDER_NODE;
 
+/** Render queue item
+ */
+typedef struct __orxRENDER_QUEUE_ITEM_t
+{
+  orxU64                u64Key;                     /**< Sort key : 8 */
+  const orxRENDER_NODE *pstNode;                    /**< Render node : 12 */
+
+} orxRENDER_QUEUE_ITEM;
+
+/** Culling context
+ */
+typedef struct __orxRENDER_CULL_CONTEXT_t
+{
+  const orxCAMERA      *pstCamera;                  /**< Camera */
+  orxAABOX              stFrustum;                  /**< Camera frustum */
+  orxVECTOR             vCameraPosition;            /**< Camera position */
+  orxVECTOR             vCameraCenter;              /**< Camera center */
+  orxFLOAT              fCameraDepth;               /**< Camera depth */
+  orxFLOAT              fCameraBoundingRadius;      /**< Camera bounding radius */
+
+} orxRENDER_CULL_CONTEXT;
+
 /** Static structure
  */
 typedef struct __orxRENDER_STATIC_t
@@ -136,8 +163,11 @@ typedef struct __orxRENDER_STATIC_t
   orxU32        u32Flags;                           /**< Control flags */
   orxCLOCK     *pstClock;                           /**< Rendering clock pointer */
   orxFRAME     *pstFrame;                           /**< Conversion frame */
-  orxBANK      *pstRenderBank;                      /**< Rendering bank */
-  orxLINKLIST   stRenderList;                       /**< Rendering list */
+  orxOBJECT   **apstCullObjectList;                 /**< Culling object list */
+  orxRENDER_NODE *astCullNodeList;                  /**< Culling result list */
+  orxRENDER_QUEUE_ITEM *astQueue;                   /**< Render queue */
+  orxRENDER_QUEUE_ITEM *astSortBuffer;              /**< Render queue sort buffer */
+  orxU32        u32QueueCapacity;                   /**< Render queue capacity */
   orxFLOAT      fDefaultConsoleOffset;              /**< Default console offset */
   orxFLOAT      fConsoleOffset;                     /**< Console offset */
   orxU32        u32SelectedFrame;                   /**< Selected frame */
@@ -1460,7 +1490,7 @@ static orxSTATUS orxFASTCALL orxRender_Home_RenderObject(const orxRENDER_NODE *_
     /* Is 2D? */
     if(bIs2D != orxFALSE)
     {
-      orxVECTOR vClipTL, vClipBR, vSize;
+      orxVECTOR vClipTL, vClipBR, vSize, vAtlasOrigin;
 
       /* Profiles */
       orxPROFILER_PUSH_MARKER("RenderObject <2D>");
@@ -1474,6 +1504,9 @@ static orxSTATUS orxFASTCALL orxRender_Home_RenderObject(const orxRENDER_NODE *_
       /* Gets its clipping corners */
       orxGraphic_GetOrigin(pstGraphic, &vClipTL);
       orxGraphic_GetSize(pstGraphic, &vSize);
+
+      /* Moves them inside the texture's atlas, if packed */
+      orxVector_Add(&vClipTL, &vClipTL, orxTexture_GetAtlasOrigin(pstTexture, &vAtlasOrigin));
       orxVector_Add(&vClipBR, &vClipTL, &vSize);
 
       /* Updates its clipping (before event start for updated texture coordinates in shader) */
@@ -1619,6 +1652,441 @@ static orxSTATUS orxFASTCALL orxRender_Home_RenderObject(const orxRENDER_NODE *_
   return eResult;
 }
 
+/** Resizes the render queue and its culling lists
+ * @param[in]   _u32Capacity    New capacity
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+static orxSTATUS orxFASTCALL orxRender_Home_ResizeQueue(orxU32 _u32Capacity)
+{
+  orxOBJECT            **apstObjectList;
+  orxRENDER_NODE        *astNodeList;
+  orxRENDER_QUEUE_ITEM  *astQueue, *astSortBuffer;
+  orxSTATUS              eResult;
+
+  /* Resizes all lists */
+  apstObjectList = (orxOBJECT **)orxMemory_Reallocate(sstRender.apstCullObjectList, _u32Capacity * sizeof(orxOBJECT *));
+  if(apstObjectList != orxNULL)
+  {
+    sstRender.apstCullObjectList = apstObjectList;
+  }
+  astNodeList = (orxRENDER_NODE *)orxMemory_Reallocate(sstRender.astCullNodeList, _u32Capacity * sizeof(orxRENDER_NODE));
+  if(astNodeList != orxNULL)
+  {
+    sstRender.astCullNodeList = astNodeList;
+  }
+  astQueue = (orxRENDER_QUEUE_ITEM *)orxMemory_Reallocate(sstRender.astQueue, _u32Capacity * sizeof(orxRENDER_QUEUE_ITEM));
+  if(astQueue != orxNULL)
+  {
+    sstRender.astQueue = astQueue;
+  }
+  astSortBuffer = (orxRENDER_QUEUE_ITEM *)orxMemory_Reallocate(sstRender.astSortBuffer, _u32Capacity * sizeof(orxRENDER_QUEUE_ITEM));
+  if(astSortBuffer != orxNULL)
+  {
+    sstRender.astSortBuffer = astSortBuffer;
+  }
+
+  /* Success? */
+  if((apstObjectList != orxNULL) && (astNodeList != orxNULL) && (astQueue != orxNULL) && (astSortBuffer != orxNULL))
+  {
+    /* Stores new capacity */
+    sstRender.u32QueueCapacity = _u32Capacity;
+
+    /* Updates result */
+    eResult = orxSTATUS_SUCCESS;
+  }
+  else
+  {
+    /* Updates result */
+    eResult = orxSTATUS_FAILURE;
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Deletes the render queue and its culling lists
+ */
+static void orxFASTCALL orxRender_Home_DeleteQueue()
+{
+  /* Deletes all lists */
+  if(sstRender.apstCullObjectList != orxNULL)
+  {
+    orxMemory_Free(sstRender.apstCullObjectList);
+    sstRender.apstCullObjectList = orxNULL;
+  }
+  if(sstRender.astCullNodeList != orxNULL)
+  {
+    orxMemory_Free(sstRender.astCullNodeList);
+    sstRender.astCullNodeList = orxNULL;
+  }
+  if(sstRender.astQueue != orxNULL)
+  {
+    orxMemory_Free(sstRender.astQueue);
+    sstRender.astQueue = orxNULL;
+  }
+  if(sstRender.astSortBuffer != orxNULL)
+  {
+    orxMemory_Free(sstRender.astSortBuffer);
+    sstRender.astSortBuffer = orxNULL;
+  }
+  sstRender.u32QueueCapacity = 0;
+
+  /* Done! */
+  return;
+}
+
+/** Hashes a pointer on a given number of bits
+ * @param[in]   _p              Pointer to hash
+ * @param[in]   _u32Bits        Number of bits of the result
+ * @return      Hashed value
+ */
+static orxINLINE orxU32 orxRender_Home_HashPointer(const void *_p, orxU32 _u32Bits)
+{
+  /* Done! */
+  return (_p != orxNULL) ? (orxU32)((((orxU64)(size_t)_p >> 4) * 0x9E3779B97F4A7C15ULL) >> (64 - _u32Bits)) : 0;
+}
+
+/** Gets the sort key of a render node: nodes are rendered from far to near, nodes sharing the same depth are grouped by state (texture, shader, blend mode & smoothing)
+ * @param[in]   _pstNode        Concerned render node
+ * @return      64-bit sort key, ascending order
+ */
+static orxINLINE orxU64 orxRender_Home_GetSortKey(const orxRENDER_NODE *_pstNode)
+{
+  union
+  {
+    orxFLOAT  fValue;
+    orxU32    u32Value;
+  }      stDepth;
+  orxU32 u32Depth, u32State;
+
+  /* Gets depth as ordered integer (-0 being normalized to +0) */
+  stDepth.fValue  = _pstNode->fZ + orxFLOAT_0;
+  u32Depth        = stDepth.u32Value ^ ((stDepth.u32Value & 0x80000000) ? 0xFFFFFFFF : 0x80000000);
+
+  /* Gets state */
+  u32State = (orxRender_Home_HashPointer(_pstNode->pstBitmap, orxRENDER_KU32_SORT_KEY_TEXTURE_BITS) << (orxRENDER_KU32_SORT_KEY_SHADER_BITS + orxRENDER_KU32_SORT_KEY_BLEND_BITS + orxRENDER_KU32_SORT_KEY_SMOOTHING_BITS))
+           | (orxRender_Home_HashPointer(_pstNode->pstShader, orxRENDER_KU32_SORT_KEY_SHADER_BITS) << (orxRENDER_KU32_SORT_KEY_BLEND_BITS + orxRENDER_KU32_SORT_KEY_SMOOTHING_BITS))
+           | (((orxU32)_pstNode->eBlendMode & ((1 << orxRENDER_KU32_SORT_KEY_BLEND_BITS) - 1)) << orxRENDER_KU32_SORT_KEY_SMOOTHING_BITS)
+           | ((orxU32)_pstNode->eSmoothing & ((1 << orxRENDER_KU32_SORT_KEY_SMOOTHING_BITS) - 1));
+
+  /* Done! (far first) */
+  return ((orxU64)~u32Depth << 32) | (orxU64)u32State;
+}
+
+/** Sorts the render queue (stable LSD radix sort on 8-bit digits)
+ * @param[in]   _u32Count       Number of queued items
+ * @return      Sorted queue
+ */
+static const orxRENDER_QUEUE_ITEM *orxFASTCALL orxRender_Home_SortQueue(orxU32 _u32Count)
+{
+  orxU32                au32Histogram[8][256];
+  orxRENDER_QUEUE_ITEM *astSrc, *astDst;
+  orxU32                i, j;
+
+  /* Clears histograms */
+  orxMemory_Zero(au32Histogram, sizeof(au32Histogram));
+
+  /* Computes all histograms in a single pass */
+  for(i = 0; i < _u32Count; i++)
+  {
+    orxU64 u64Key;
+
+    /* Gets key */
+    u64Key = sstRender.astQueue[i].u64Key;
+
+    /* For all digits */
+    for(j = 0; j < 8; j++)
+    {
+      /* Updates its histogram */
+      au32Histogram[j][(u64Key >> (j << 3)) & 0xFF]++;
+    }
+  }
+
+  /* For all digits */
+  for(j = 0, astSrc = sstRender.astQueue, astDst = sstRender.astSortBuffer; j < 8; j++)
+  {
+    orxU32 u32Offset;
+
+    /* All keys share the same digit? */
+    if(au32Histogram[j][(astSrc[0].u64Key >> (j << 3)) & 0xFF] == _u32Count)
+    {
+      /* Skips pass */
+      continue;
+    }
+
+    /* Converts histogram to offsets */
+    for(i = 0, u32Offset = 0; i < 256; i++)
+    {
+      orxU32 u32Count;
+
+      u32Count              = au32Histogram[j][i];
+      au32Histogram[j][i]   = u32Offset;
+      u32Offset            += u32Count;
+    }
+
+    /* Scatters items */
+    for(i = 0; i < _u32Count; i++)
+    {
+      astDst[au32Histogram[j][(astSrc[i].u64Key >> (j << 3)) & 0xFF]++] = astSrc[i];
+    }
+
+    /* Swaps buffers */
+    {
+      orxRENDER_QUEUE_ITEM *astTemp;
+      astTemp = astSrc;
+      astSrc  = astDst;
+      astDst  = astTemp;
+    }
+  }
+
+  /* Done! */
+  return astSrc;
+}
+
+/** Culls a batch of objects against a camera (can be run concurrently from different threads)
+ * @param[in]   _u32Start       Index of the first object to cull
+ * @param[in]   _u32End         Index past the last object to cull
+ * @param[in]   _pContext       Culling context
+ */
+static void orxFASTCALL orxRender_Home_CullObjects(orxU32 _u32Start, orxU32 _u32End, void *_pContext)
+{
+  const orxRENDER_CULL_CONTEXT *pstContext;
+  const orxCAMERA              *pstCamera;
+  orxAABOX                      stFrustum;
+  orxVECTOR                     vCameraPosition, vCameraCenter;
+  orxFLOAT                      fCameraDepth, fCameraBoundingRadius;
+  orxU32                        i;
+
+  /* Gets context */
+  pstContext            = (const orxRENDER_CULL_CONTEXT *)_pContext;
+  pstCamera             = pstContext->pstCamera;
+  fCameraDepth          = pstContext->fCameraDepth;
+  fCameraBoundingRadius = pstContext->fCameraBoundingRadius;
+  orxAABox_Copy(&stFrustum, &(pstContext->stFrustum));
+  orxVector_Copy(&vCameraPosition, &(pstContext->vCameraPosition));
+  orxVector_Copy(&vCameraCenter, &(pstContext->vCameraCenter));
+
+  /* For all objects in batch */
+  for(i = _u32Start; i < _u32End; i++)
+  {
+    orxOBJECT      *pstObject;
+    orxRENDER_NODE *pstNode;
+
+    /* Gets object & its node */
+    pstObject = sstRender.apstCullObjectList[i];
+    pstNode   = &(sstRender.astCullNodeList[i]);
+
+    /* Culled by default */
+    pstNode->pstObject = orxNULL;
+
+    /* Is object enabled? */
+    if(orxObject_IsEnabled(pstObject) != orxFALSE)
+    {
+      orxGRAPHIC *pstGraphic;
+
+      /* Gets object's graphic */
+      pstGraphic = orxObject_GetWorkingGraphic(pstObject);
+
+      /* Valid 2D graphic? */
+      if((pstGraphic != orxNULL)
+      && (orxStructure_TestFlags(pstGraphic, orxGRAPHIC_KU32_FLAG_2D | orxGRAPHIC_KU32_FLAG_TEXT) != orxFALSE))
+      {
+        orxFRAME     *pstFrame;
+        orxSTRUCTURE *pstData;
+        orxTEXTURE   *pstTexture;
+
+        /* Gets object's frame */
+        pstFrame = orxOBJECT_GET_STRUCTURE(pstObject, FRAME);
+
+        /* Gets graphic data */
+        pstData = orxGraphic_GetData(pstGraphic);
+
+        /* Valid and has text/texture data? */
+        if((pstFrame != orxNULL)
+        && (((pstTexture = orxTEXTURE(pstData)) != orxNULL)
+         || (orxTEXT(pstData) != orxNULL)))
+        {
+          orxVECTOR vObjectPos;
+
+          /* Not a texture? */
+          if(pstTexture == orxNULL)
+          {
+            /* Gets texture from text */
+            pstTexture = orxFont_GetTexture(orxText_GetFont(orxTEXT(pstData)));
+          }
+
+          /* Gets its position */
+          orxFrame_GetPosition(pstFrame, orxFRAME_SPACE_GLOBAL, &vObjectPos);
+
+          /* Is object in Z frustum? */
+          if((vObjectPos.fZ >= vCameraPosition.fZ) && (vObjectPos.fZ >= stFrustum.vTL.fZ) && (vObjectPos.fZ <= stFrustum.vBR.fZ))
+          {
+            orxFLOAT  fObjectBoundingRadius, fSqrDist, fDepthCoef, fObjectRotation;
+            orxVECTOR vSize, vOffset, vObjectScale, vDist;
+
+            /* Gets its size */
+            orxGraphic_GetSize(pstGraphic, &vSize);
+
+            /* Gets object's scale & rotation */
+            orxFrame_GetScale(pstFrame, orxFRAME_SPACE_GLOBAL, &vObjectScale);
+            fObjectRotation = orxFrame_GetRotation(pstFrame, orxFRAME_SPACE_GLOBAL);
+
+            /* Updates its size with object scale */
+            vSize.fX  *= vObjectScale.fX;
+            vSize.fY  *= vObjectScale.fY;
+
+            /* Gets offset based on pivot */
+            orxGraphic_GetPivot(pstGraphic, &vOffset);
+            vOffset.fX = orx2F(0.5f) * vSize.fX - vObjectScale.fX * vOffset.fX;
+            vOffset.fY = orx2F(0.5f) * vSize.fY - vObjectScale.fY * vOffset.fY;
+            orxVector_2DRotate(&vOffset, &vOffset, fObjectRotation);
+
+            /* Gets real 2D distance vector */
+            orxVector_Sub(&vDist, &vObjectPos, &vCameraCenter);
+            vDist.fZ = orxFLOAT_0;
+
+            /* Uses differential scrolling or depth scaling? */
+            if((orxStructure_TestFlags(pstFrame, orxFRAME_KU32_MASK_SCROLL_BOTH) != orxFALSE)
+            || (orxStructure_TestFlags(pstFrame, orxFRAME_KU32_FLAG_DEPTH_SCALE) != orxFALSE))
+            {
+              orxFLOAT fObjectRelativeDepth;
+
+              /* Gets objects relative depth */
+              fObjectRelativeDepth = vObjectPos.fZ - vCameraPosition.fZ;
+
+              /* On near plane? */
+              if(fObjectRelativeDepth == orxFLOAT_0)
+              {
+                /* Prints error message */
+                orxDEBUG_PRINT(orxDEBUG_LEVEL_RENDER, "[%s] is using AutoScroll/DepthScale and is on [%s]'s near plane: undefined results.", orxObject_GetName(pstObject), orxCamera_GetName(pstCamera));
+              }
+
+              /* Near space? */
+              if(fObjectRelativeDepth < (orx2F(0.5f) * fCameraDepth))
+              {
+                /* Gets depth scale coef */
+                fDepthCoef = (orx2F(0.5f) * fCameraDepth) / (fObjectRelativeDepth + orxMATH_KF_TINY_EPSILON);
+              }
+              /* Far space */
+              else
+              {
+                /* Gets depth scale coef */
+                fDepthCoef = (fCameraDepth - fObjectRelativeDepth) / (orx2F(0.5f) * fCameraDepth);
+              }
+
+              /* X-axis scroll? */
+              if(orxStructure_TestFlags(pstFrame, orxFRAME_KU32_FLAG_SCROLL_X) != orxFALSE)
+              {
+                /* Updates base distance vector */
+                vDist.fX *= fDepthCoef;
+              }
+
+              /* Y-axis scroll? */
+              if(orxStructure_TestFlags(pstFrame, orxFRAME_KU32_FLAG_SCROLL_Y) != orxFALSE)
+              {
+                /* Updates base distance vector */
+                vDist.fY *= fDepthCoef;
+              }
+
+              /* Depth scale? */
+              if(orxStructure_TestFlags(pstFrame, orxFRAME_KU32_FLAG_DEPTH_SCALE) != orxFALSE)
+              {
+                /* Updates size & offset */
+                vSize.fX *= fDepthCoef;
+                vSize.fY *= fDepthCoef;
+                vOffset.fX *= fDepthCoef;
+                vOffset.fY *= fDepthCoef;
+              }
+            }
+            else
+            {
+              /* Clears depth coef */
+              fDepthCoef = orxFLOAT_1;
+            }
+
+            /* Gets object square bounding radius */
+            fObjectBoundingRadius = orx2F(0.5f) * orxMath_Sqrt((vSize.fX * vSize.fX) + (vSize.fY * vSize.fY));
+
+            /* Updates distance vector */
+            orxVector_Add(&vDist, &vDist, &vOffset);
+
+            /* Gets 2D square distance to camera */
+            fSqrDist = orxVector_GetSquareSize(&vDist);
+
+            /* Circle test between object & camera */
+            if(fSqrDist <= (fCameraBoundingRadius + fObjectBoundingRadius) * (fCameraBoundingRadius + fObjectBoundingRadius))
+            {
+              orxDISPLAY_BLEND_MODE eBlendMode;
+              orxDISPLAY_SMOOTHING  eSmoothing;
+              const orxSHADER      *pstShader;
+              orxSHADERPOINTER     *pstShaderPointer;
+
+              /* Gets shader pointer */
+              pstShaderPointer = orxOBJECT_GET_STRUCTURE(pstObject, SHADERPOINTER);
+
+              /* Valid? */
+              if(pstShaderPointer != orxNULL)
+              {
+                /* Gets first shader */
+                pstShader = orxShaderPointer_GetShader(pstShaderPointer, 0);
+              }
+              else
+              {
+                /* Clears shader */
+                pstShader = orxNULL;
+              }
+
+              /* Gets graphic smoothing */
+              eSmoothing = orxGraphic_GetSmoothing(pstGraphic);
+
+              /* Default? */
+              if(eSmoothing == orxDISPLAY_SMOOTHING_DEFAULT)
+              {
+                /* Gets object smoothing */
+                eSmoothing = orxObject_GetSmoothing(pstObject);
+              }
+
+              /* Has graphic blend mode? */
+              if(orxGraphic_HasBlendMode(pstGraphic) != orxFALSE)
+              {
+                /* Gets graphic blend mode */
+                eBlendMode = orxGraphic_GetBlendMode(pstGraphic);
+              }
+              /* Has object blend mode? */
+              else if(orxObject_HasBlendMode(pstObject) != orxFALSE)
+              {
+                /* Gets object blend mode */
+                eBlendMode = orxObject_GetBlendMode(pstObject);
+              }
+              else
+              {
+                /* Defaults to alpha blend mode */
+                eBlendMode = orxDISPLAY_BLEND_MODE_ALPHA;
+              }
+
+              /* Stores object */
+              pstNode->pstObject  = pstObject;
+              pstNode->pstBitmap  = orxTexture_GetBitmap(pstTexture);
+              pstNode->pstShader  = pstShader;
+              pstNode->eSmoothing = eSmoothing;
+              pstNode->eBlendMode = eBlendMode;
+
+              /* Stores its Z coordinate */
+              pstNode->fZ         = vObjectPos.fZ;
+
+              /* Stores its depth coef */
+              pstNode->fDepthCoef = fDepthCoef;
+            }
+          }
+        }
+      }
+    }
+  }
+
+  /* Done! */
+  return;
+}
+
 /** Renders a viewport
  * @param[in]   _pstViewport    Viewport to render
  */
@@ -1777,12 +2245,14 @@ static orxINLINE void orxRender_Home_RenderViewport(const orxVIEWPORT *_pstViewp
             if((fCameraWidth > orxFLOAT_0)
             && (fCameraHeight > orxFLOAT_0))
             {
-              orxU32          u32Number;
-              orxOBJECT      *pstObject;
-              orxFRAME       *pstCameraFrame;
-              orxRENDER_NODE *pstRenderNode;
-              orxVECTOR       vCameraScale, vCameraCenter, vCameraPosition;
-              orxFLOAT        fCameraDepth, fRenderScaleX, fRenderScaleY, fRecZoom, fRenderRotation, fCameraBoundingRadius;
+              orxU32                      u32Number, u32ObjectCount, u32QueueCount, j;
+              orxOBJECT                  *pstObject;
+              orxFRAME                   *pstCameraFrame;
+              orxAABOX                    stCameraBox;
+              const orxRENDER_QUEUE_ITEM *astQueue;
+              orxRENDER_CULL_CONTEXT      stCullContext;
+              orxVECTOR               vCameraScale, vCameraCenter, vCameraPosition;
+              orxFLOAT                fCameraDepth, fRenderScaleX, fRenderScaleY, fRecZoom, fRenderRotation, fCameraBoundingRadius;
 
               /* Gets camera frame */
               pstCameraFrame = orxCamera_GetFrame(pstCamera);
@@ -1817,6 +2287,18 @@ static orxINLINE void orxRender_Home_RenderViewport(const orxVIEWPORT *_pstViewp
               /* Gets camera rotation */
               fRenderRotation = orxFrame_GetRotation(pstCameraFrame, orxFRAME_SPACE_GLOBAL);
 
+              /* Gets camera box (encloses camera's bounding circle) */
+              orxVector_Set(&(stCameraBox.vTL), vCameraCenter.fX - fCameraBoundingRadius, vCameraCenter.fY - fCameraBoundingRadius, stFrustum.vTL.fZ);
+              orxVector_Set(&(stCameraBox.vBR), vCameraCenter.fX + fCameraBoundingRadius, vCameraCenter.fY + fCameraBoundingRadius, stFrustum.vBR.fZ);
+
+              /* Inits culling context */
+              stCullContext.pstCamera             = pstCamera;
+              stCullContext.fCameraDepth          = fCameraDepth;
+              stCullContext.fCameraBoundingRadius = fCameraBoundingRadius;
+              orxAABox_Copy(&(stCullContext.stFrustum), &stFrustum);
+              orxVector_Copy(&(stCullContext.vCameraPosition), &vCameraPosition);
+              orxVector_Copy(&(stCullContext.vCameraCenter), &vCameraCenter);
+
               /* For all camera group IDs */
               for(i = 0, u32Number = orxCamera_GetGroupIDCount(pstCamera); i < u32Number; i++)
               {
@@ -1825,268 +2307,64 @@ static orxINLINE void orxRender_Home_RenderViewport(const orxVIEWPORT *_pstViewp
                 /* Gets it */
                 stGroupID = orxCamera_GetGroupID(pstCamera, i);
 
-                /* For all objects in this group */
-                for(pstObject = orxObject_GetNext(orxNULL, stGroupID);
-                    pstObject != orxNULL;
-                    pstObject = orxObject_GetNext(pstObject, stGroupID))
+                /* Gathers candidate objects in this group */
+                u32ObjectCount = orxObject_GetBoxCandidateList(&stCameraBox, stGroupID, sstRender.apstCullObjectList, sstRender.u32QueueCapacity);
+
+                /* Not enough room? */
+                if(u32ObjectCount > sstRender.u32QueueCapacity)
                 {
-                  /* Is object enabled? */
-                  if(orxObject_IsEnabled(pstObject) != orxFALSE)
+                  /* Can grow render queue? */
+                  if(orxRender_Home_ResizeQueue(orxMath_GetNextPowerOfTwo(u32ObjectCount)) != orxSTATUS_FAILURE)
                   {
-                    orxGRAPHIC *pstGraphic;
+                    /* Gathers all candidates */
+                    u32ObjectCount = orxObject_GetBoxCandidateList(&stCameraBox, stGroupID, sstRender.apstCullObjectList, sstRender.u32QueueCapacity);
+                  }
+                  else
+                  {
+                    /* Logs message */
+                    orxDEBUG_PRINT(orxDEBUG_LEVEL_RENDER, "Couldn't grow render queue to %u objects: skipping remaining objects for camera <%s>.", orxMath_GetNextPowerOfTwo(u32ObjectCount), orxCamera_GetName(pstCamera));
 
-                    /* Gets object's graphic */
-                    pstGraphic = orxObject_GetWorkingGraphic(pstObject);
+                    /* Updates count */
+                    u32ObjectCount = sstRender.u32QueueCapacity;
+                  }
+                }
 
-                    /* Valid 2D graphic? */
-                    if((pstGraphic != orxNULL)
-                    && (orxStructure_TestFlags(pstGraphic, orxGRAPHIC_KU32_FLAG_2D | orxGRAPHIC_KU32_FLAG_TEXT) != orxFALSE))
-                    {
-                      orxFRAME     *pstFrame;
-                      orxSTRUCTURE *pstData;
-                      orxTEXTURE   *pstTexture;
-
-                      /* Gets object's frame */
-                      pstFrame = orxOBJECT_GET_STRUCTURE(pstObject, FRAME);
-
-                      /* Gets graphic data */
-                      pstData = orxGraphic_GetData(pstGraphic);
-
-                      /* Valid and has text/texture data? */
-                      if((pstFrame != orxNULL)
-                      && (((pstTexture = orxTEXTURE(pstData)) != orxNULL)
-                       || (orxTEXT(pstData) != orxNULL)))
-                      {
-                        orxVECTOR vObjectPos;
-
-                        /* Not a texture? */
-                        if(pstTexture == orxNULL)
-                        {
-                          /* Gets texture from text */
-                          pstTexture = orxFont_GetTexture(orxText_GetFont(orxTEXT(pstData)));
-                        }
-
-                        /* Gets its position */
-                        orxFrame_GetPosition(pstFrame, orxFRAME_SPACE_GLOBAL, &vObjectPos);
-
-                        /* Is object in Z frustum? */
-                        if((vObjectPos.fZ >= vCameraPosition.fZ) && (vObjectPos.fZ >= stFrustum.vTL.fZ) && (vObjectPos.fZ <= stFrustum.vBR.fZ))
-                        {
-                          orxFLOAT  fObjectBoundingRadius, fSqrDist, fDepthCoef, fObjectRotation;
-                          orxVECTOR vSize, vOffset, vObjectScale, vDist;
-
-                          /* Gets its size */
-                          orxGraphic_GetSize(pstGraphic, &vSize);
-
-                          /* Gets object's scale & rotation */
-                          orxFrame_GetScale(pstFrame, orxFRAME_SPACE_GLOBAL, &vObjectScale);
-                          fObjectRotation = orxFrame_GetRotation(pstFrame, orxFRAME_SPACE_GLOBAL);
-
-                          /* Updates its size with object scale */
-                          vSize.fX  *= vObjectScale.fX;
-                          vSize.fY  *= vObjectScale.fY;
-
-                          /* Gets offset based on pivot */
-                          orxGraphic_GetPivot(pstGraphic, &vOffset);
-                          vOffset.fX = orx2F(0.5f) * vSize.fX - vObjectScale.fX * vOffset.fX;
-                          vOffset.fY = orx2F(0.5f) * vSize.fY - vObjectScale.fY * vOffset.fY;
-                          orxVector_2DRotate(&vOffset, &vOffset, fObjectRotation);
-
-                          /* Gets real 2D distance vector */
-                          orxVector_Sub(&vDist, &vObjectPos, &vCameraCenter);
-                          vDist.fZ = orxFLOAT_0;
-
-                          /* Uses differential scrolling or depth scaling? */
-                          if((orxStructure_TestFlags(pstFrame, orxFRAME_KU32_MASK_SCROLL_BOTH) != orxFALSE)
-                          || (orxStructure_TestFlags(pstFrame, orxFRAME_KU32_FLAG_DEPTH_SCALE) != orxFALSE))
-                          {
-                            orxFLOAT fObjectRelativeDepth;
-
-                            /* Gets objects relative depth */
-                            fObjectRelativeDepth = vObjectPos.fZ - vCameraPosition.fZ;
-
-                            /* On near plane? */
-                            if(fObjectRelativeDepth == orxFLOAT_0)
-                            {
-                              /* Prints error message */
-                              orxDEBUG_PRINT(orxDEBUG_LEVEL_RENDER, "[%s] is using AutoScroll/DepthScale and is on [%s]'s near plane: undefined results.", orxObject_GetName(pstObject), orxCamera_GetName(pstCamera));
-                            }
-
-                            /* Near space? */
-                            if(fObjectRelativeDepth < (orx2F(0.5f) * fCameraDepth))
-                            {
-                              /* Gets depth scale coef */
-                              fDepthCoef = (orx2F(0.5f) * fCameraDepth) / (fObjectRelativeDepth + orxMATH_KF_TINY_EPSILON);
-                            }
-                            /* Far space */
-                            else
-                            {
-                              /* Gets depth scale coef */
-                              fDepthCoef = (fCameraDepth - fObjectRelativeDepth) / (orx2F(0.5f) * fCameraDepth);
-                            }
-
-                            /* X-axis scroll? */
-                            if(orxStructure_TestFlags(pstFrame, orxFRAME_KU32_FLAG_SCROLL_X) != orxFALSE)
-                            {
-                              /* Updates base distance vector */
-                              vDist.fX *= fDepthCoef;
-                            }
-
-                            /* Y-axis scroll? */
-                            if(orxStructure_TestFlags(pstFrame, orxFRAME_KU32_FLAG_SCROLL_Y) != orxFALSE)
-                            {
-                              /* Updates base distance vector */
-                              vDist.fY *= fDepthCoef;
-                            }
-
-                            /* Depth scale? */
-                            if(orxStructure_TestFlags(pstFrame, orxFRAME_KU32_FLAG_DEPTH_SCALE) != orxFALSE)
-                            {
-                              /* Updates size & offset */
-                              vSize.fX *= fDepthCoef;
-                              vSize.fY *= fDepthCoef;
-                              vOffset.fX *= fDepthCoef;
-                              vOffset.fY *= fDepthCoef;
-                            }
-                          }
-                          else
-                          {
-                            /* Clears depth coef */
-                            fDepthCoef = orxFLOAT_1;
-                          }
-
-                          /* Gets object square bounding radius */
-                          fObjectBoundingRadius = orx2F(0.5f) * orxMath_Sqrt((vSize.fX * vSize.fX) + (vSize.fY * vSize.fY));
-
-                          /* Updates distance vector */
-                          orxVector_Add(&vDist, &vDist, &vOffset);
-
-                          /* Gets 2D square distance to camera */
-                          fSqrDist = orxVector_GetSquareSize(&vDist);
-
-                          /* Circle test between object & camera */
-                          if(fSqrDist <= (fCameraBoundingRadius + fObjectBoundingRadius) * (fCameraBoundingRadius + fObjectBoundingRadius))
-                          {
-                            orxDISPLAY_BLEND_MODE eBlendMode;
-                            orxDISPLAY_SMOOTHING  eSmoothing;
-                            const orxSHADER      *pstShader;
-                            orxSHADERPOINTER     *pstShaderPointer;
-
-                            /* Gets shader pointer */
-                            pstShaderPointer = orxOBJECT_GET_STRUCTURE(pstObject, SHADERPOINTER);
-
-                            /* Valid? */
-                            if(pstShaderPointer != orxNULL)
-                            {
-                              /* Gets first shader */
-                              pstShader = orxShaderPointer_GetShader(pstShaderPointer, 0);
-                            }
-                            else
-                            {
-                              /* Clears shader */
-                              pstShader = orxNULL;
-                            }
-
-                            /* Gets graphic smoothing */
-                            eSmoothing = orxGraphic_GetSmoothing(pstGraphic);
-
-                            /* Default? */
-                            if(eSmoothing == orxDISPLAY_SMOOTHING_DEFAULT)
-                            {
-                              /* Gets object smoothing */
-                              eSmoothing = orxObject_GetSmoothing(pstObject);
-                            }
-
-                            /* Has graphic blend mode? */
-                            if(orxGraphic_HasBlendMode(pstGraphic) != orxFALSE)
-                            {
-                              /* Gets graphic blend mode */
-                              eBlendMode = orxGraphic_GetBlendMode(pstGraphic);
-                            }
-                            /* Has object blend mode? */
-                            else if(orxObject_HasBlendMode(pstObject) != orxFALSE)
-                            {
-                              /* Gets object blend mode */
-                              eBlendMode = orxObject_GetBlendMode(pstObject);
-                            }
-                            else
-                            {
-                              /* Defaults to alpha blend mode */
-                              eBlendMode = orxDISPLAY_BLEND_MODE_ALPHA;
-                            }
-
-                            /* Creates a render node */
-                            pstRenderNode = (orxRENDER_NODE *)orxBank_Allocate(sstRender.pstRenderBank);
-
-                            /* Cleans its internal node */
-                            orxMemory_Zero(pstRenderNode, sizeof(orxLINKLIST_NODE));
-
-                            /* Stores object */
-                            pstRenderNode->pstObject  = pstObject;
-                            pstRenderNode->pstTexture = pstTexture;
-                            pstRenderNode->pstShader  = pstShader;
-                            pstRenderNode->eSmoothing = eSmoothing;
-                            pstRenderNode->eBlendMode = eBlendMode;
-
-                            /* Stores its Z coordinate */
-                            pstRenderNode->fZ = vObjectPos.fZ;
-
-                            /* Stores its depth coef */
-                            pstRenderNode->fDepthCoef = fDepthCoef;
-
-                            /* Empty list? */
-                            if(orxLinkList_GetCount(&(sstRender.stRenderList)) == 0)
-                            {
-                              /* Adds node at beginning */
-                              orxLinkList_AddStart(&(sstRender.stRenderList), (orxLINKLIST_NODE *)pstRenderNode);
-                            }
-                            else
-                            {
-                              orxRENDER_NODE *pstNode;
-
-                              /* Finds correct node position */
-                              for(pstNode = (orxRENDER_NODE *)orxLinkList_GetFirst(&(sstRender.stRenderList));
-                                  (pstNode != orxNULL)
-                               && ((vObjectPos.fZ < pstNode->fZ)
-                                || ((vObjectPos.fZ == pstNode->fZ)
-                                 && ((pstTexture < pstNode->pstTexture)
-                                  || ((pstTexture == pstNode->pstTexture)
-                                   && ((pstShader < pstNode->pstShader)
-                                    || ((pstShader == pstNode->pstShader)
-                                     && (eBlendMode < pstNode->eBlendMode))
-                                      || ((eBlendMode == pstNode->eBlendMode)
-                                       && (eSmoothing < pstNode->eSmoothing)))))));
-                                  pstNode = (orxRENDER_NODE *)orxLinkList_GetNext(&(pstNode->stNode)));
-
-                              /* End of list reached? */
-                              if(pstNode == orxNULL)
-                              {
-                                /* Adds it at end */
-                                orxLinkList_AddEnd(&(sstRender.stRenderList), &(pstRenderNode->stNode));
-                              }
-                              else
-                              {
-                                /* Adds it before found node */
-                                orxLinkList_AddBefore(&(pstNode->stNode), &(pstRenderNode->stNode));
-                              }
-                            }
-                          }
-                        }
-                      }
-                    }
+                /* Culls them */
+                orxThread_ParallelFor(u32ObjectCount, orxRENDER_KU32_CULL_GRAIN, orxRender_Home_CullObjects, &stCullContext);
+
+                /* For all culling results, in reverse order (most recent objects come first among equals) */
+                for(j = u32ObjectCount, u32QueueCount = 0; j > 0; j--)
+                {
+                  const orxRENDER_NODE *pstCullNode;
+
+                  /* Gets it */
+                  pstCullNode = &(sstRender.astCullNodeList[j - 1]);
+
+                  /* Is visible? */
+                  if(pstCullNode->pstObject != orxNULL)
+                  {
+                    /* Queues it */
+                    sstRender.astQueue[u32QueueCount].pstNode = pstCullNode;
+                    sstRender.astQueue[u32QueueCount].u64Key  = orxRender_Home_GetSortKey(pstCullNode);
+                    u32QueueCount++;
                   }
                 }
 
-                /* For all render nodes */
-                for(pstRenderNode = (orxRENDER_NODE *)orxLinkList_GetFirst(&(sstRender.stRenderList));
-                    pstRenderNode != orxNULL;
-                    pstRenderNode = (orxRENDER_NODE *)orxLinkList_GetNext((orxLINKLIST_NODE *)pstRenderNode))
+                /* Sorts queue */
+                astQueue = (u32QueueCount > 1) ? orxRender_Home_SortQueue(u32QueueCount) : sstRender.astQueue;
+
+                /* For all queued render nodes */
+                for(j = 0; j < u32QueueCount; j++)
                 {
+                  const orxRENDER_NODE *pstRenderNode;
                   orxFRAME             *pstFrame;
                   orxVECTOR             vObjectPos, vRenderPos, vObjectScale;
                   orxFLOAT              fObjectRotation, fObjectScaleX, fObjectScaleY, fRepeatX, fRepeatY;
                   orxDISPLAY_TRANSFORM  stTransform;
 
+                  /* Gets render node */
+                  pstRenderNode = astQueue[j].pstNode;
+
                   /* Gets object */
                   pstObject = pstRenderNode->pstObject;
 
@@ -2180,12 +2458,6 @@ static orxINLINE void orxRender_Home_RenderViewport(const orxVIEWPORT *_pstViewp
                     orxDEBUG_PRINT(orxDEBUG_LEVEL_RENDER, "[orxOBJECT %p / %s] couldn't be rendered.", pstObject, orxObject_GetName(pstObject));
                   }
                 }
-
-                /* Cleans rendering bank */
-                orxBank_Clear(sstRender.pstRenderBank);
-
-                /* Cleans rendering list */
-                orxMemory_Zero(&(sstRender.stRenderList), sizeof(orxLINKLIST));
               }
             }
             else
@@ -2922,11 +3194,8 @@ orxSTATUS orxFASTCALL orxRender_Home_Init()
     /* Cleans static controller */
     orxMemory_Zero(&sstRender, sizeof(orxRENDER_STATIC));
 
-    /* Creates rendering bank */
-    sstRender.pstRenderBank = orxBank_Create(orxRENDER_KU32_ORDER_BANK_SIZE, sizeof(orxRENDER_NODE), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
-
-    /* Valid? */
-    if(sstRender.pstRenderBank != orxNULL)
+    /* Creates render queue */
+    if(orxRender_Home_ResizeQueue(orxRENDER_KU32_QUEUE_SIZE) != orxSTATUS_FAILURE)
     {
       orxFLOAT fMinFrequency = orxFLOAT_0;
 
@@ -3033,14 +3302,14 @@ orxSTATUS orxFASTCALL orxRender_Home_Init()
             /* Deletes frame */
             orxFrame_Delete(sstRender.pstFrame);
 
-            /* Deletes bank */
-            orxBank_Delete(sstRender.pstRenderBank);
+            /* Deletes render queue */
+            orxRender_Home_DeleteQueue();
           }
         }
         else
         {
-          /* Deletes bank */
-          orxBank_Delete(sstRender.pstRenderBank);
+          /* Deletes render queue */
+          orxRender_Home_DeleteQueue();
 
           /* Updates result */
           eResult = orxSTATUS_FAILURE;
@@ -3048,8 +3317,8 @@ orxSTATUS orxFASTCALL orxRender_Home_Init()
       }
       else
       {
-        /* Deletes bank */
-        orxBank_Delete(sstRender.pstRenderBank);
+        /* Deletes render queue */
+        orxRender_Home_DeleteQueue();
 
         /* Updates result */
         eResult = orxSTATUS_FAILURE;
@@ -3057,6 +3326,9 @@ orxSTATUS orxFASTCALL orxRender_Home_Init()
     }
     else
     {
+      /* Deletes render queue */
+      orxRender_Home_DeleteQueue();
+
       /* Updates result */
       eResult = orxSTATUS_FAILURE;
     }
@@ -3099,8 +3371,8 @@ void orxFASTCALL orxRender_Home_Exit()
     /* Deletes conversion frame */
     orxFrame_Delete(sstRender.pstFrame);
 
-    /* Deletes rendering bank */
-    orxBank_Delete(sstRender.pstRenderBank);
+    /* Deletes render queue */
+    orxRender_Home_DeleteQueue();
 
     /* Updates flags */
     sstRender.u32Flags &= ~(orxRENDER_KU32_STATIC_FLAG_READY | orxRENDER_KU32_STATIC_FLAG_REGISTERED);
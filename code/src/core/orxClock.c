@@ -732,6 +732,12 @@ orxSTATUS orxFASTCALL orxClock_Update()
     /* Unlocks clocks */
     sstClock.u32Flags &= ~orxCLOCK_KU32_STATIC_FLAG_UPDATE_LOCK;
 
+    /* Dispatches posted events */
+    orxEvent_Dispatch();
+
+    /* Resets frame memory */
+    orxMemory_ResetFrame();
+
     /* Gets real remaining delay */
     fDelay = fDelay + orxCLOCK_KF_DELAY_ADJUSTMENT - orx2F(orxSystem_GetTime() - sstClock.dTime);
 
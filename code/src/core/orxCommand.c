@@ -40,6 +40,7 @@
 #include "memory/orxMemory.h"
 #include "memory/orxBank.h"
 #include "object/orxTimeLine.h"
+#include "utils/orxHashTable.h"
 #include "utils/orxString.h"
 #include "utils/orxTree.h"
 
@@ -56,6 +57,7 @@
 #define orxCOMMAND_KU32_STATIC_FLAG_NONE              0x00000000                      /**< No flags */
 
 #define orxCOMMAND_KU32_STATIC_FLAG_READY             0x00000001                      /**< Ready flag */
+#define orxCOMMAND_KU32_STATIC_FLAG_CLEAR_PROGRAMS    0x00000002                      /**< Clear programs flag */
 
 #define orxCOMMAND_KU32_STATIC_MASK_ALL               0xFFFFFFFF                      /**< All mask */
 
@@ -73,6 +75,16 @@
 #define orxCOMMAND_KU32_PROCESS_BUFFER_SIZE           4096
 #define orxCOMMAND_KU32_PROTOTYPE_BUFFER_SIZE         512
 
+#define orxCOMMAND_KU32_ALIAS_MAX_DEPTH               32
+
+#define orxCOMMAND_KU32_PROGRAM_TABLE_SIZE            256
+#define orxCOMMAND_KU32_COMPILE_INSTRUCTION_NUMBER    64
+#define orxCOMMAND_KU32_COMPILE_ARG_NUMBER            256
+#define orxCOMMAND_KU32_COMPILE_BUFFER_SIZE           8192
+
+#define orxCOMMAND_KC_COMPILED_POP                    '\x01'                          /**< Pop token, used when compiling */
+#define orxCOMMAND_KC_COMPILED_GUID                   '\x02'                          /**< GUID token, used when compiling */
+
 #define orxCOMMAND_KZ_ERROR_VALUE                     "ERROR"
 #define orxCOMMAND_KZ_STACK_ERROR_VALUE               "STACK_ERROR"
 
@@ -126,6 +138,63 @@ typedef struct __orxCOMMAND_t
 
 } orxCOMMAND;
 
+/** Compiled argument source enum
+ */
+typedef enum __orxCOMMAND_ARG_SOURCE_t
+{
+  orxCOMMAND_ARG_SOURCE_LITERAL = 0,
+  orxCOMMAND_ARG_SOURCE_POP,
+  orxCOMMAND_ARG_SOURCE_GUID,
+
+  orxCOMMAND_ARG_SOURCE_NUMBER,
+
+  orxCOMMAND_ARG_SOURCE_NONE = orxENUM_NONE
+
+} orxCOMMAND_ARG_SOURCE;
+
+/** Command compile info
+ */
+typedef struct __orxCOMMAND_COMPILE_INFO_t
+{
+  orxU8                    *au8SourceList;                                            /**< Argument source list */
+  orxU32                    u32MarkerCount;                                           /**< Number of expanded GUID/pop markers */
+  orxU32                    u32TokenCount;                                            /**< Number of GUID/pop markers parsed as whole arguments */
+  orxBOOL                   bIsValid;                                                 /**< Is valid? */
+
+} orxCOMMAND_COMPILE_INFO;
+
+/** Compiled argument
+ */
+typedef struct __orxCOMMAND_COMPILED_ARG_t
+{
+  orxCOMMAND_VAR            stValue;                                                  /**< Value, string literals store their offset in the program's text (u32Value) */
+  orxU32                    u32Source;                                                /**< Source (orxCOMMAND_ARG_SOURCE) */
+
+} orxCOMMAND_COMPILED_ARG;
+
+/** Compiled instruction: a resolved command (aliases already expanded) with its arguments
+ */
+typedef struct __orxCOMMAND_INSTRUCTION_t
+{
+  const orxCOMMAND         *pstCommand;                                               /**< Command */
+  orxU32                    u32ArgIndex;                                              /**< First argument index */
+  orxU32                    u32SourceOffset;                                          /**< Source offset in the program's text */
+  orxU16                    u16ArgNumber;                                             /**< Argument number */
+  orxU16                    u16PushCount;                                             /**< Result push count */
+
+} orxCOMMAND_INSTRUCTION;
+
+/** Compiled program, followed in memory by its instruction list, its argument list and its text (command line + string literals)
+ */
+typedef struct __orxCOMMAND_PROGRAM_t
+{
+  orxU32                    u32InstructionNumber;                                     /**< Instruction number */
+  orxU32                    u32ArgNumber;                                             /**< Argument number */
+  orxU32                    u32TextOffset;                                            /**< Text offset, from the start of the program */
+  orxU32                    u32TailOffset;                                            /**< Uncompiled tail offset in the text, orxU32_UNDEFINED if none */
+
+} orxCOMMAND_PROGRAM;
+
 /** Command trie node
  */
 typedef struct __orxCOMMAND_TRIE_NODE_t
@@ -144,11 +213,17 @@ typedef struct __orxCOMMAND_STATIC_t
   orxBANK                  *pstTrieBank;                                              /**< Command trie bank */
   orxTREE                   stCommandTrie;                                            /**< Command trie */
   orxBANK                  *pstResultBank;                                            /**< Command result bank */
+  orxHASHTABLE             *pstProgramTable;                                          /**< Compiled program table */
+  orxCOMMAND_INSTRUCTION    astCompileInstructionList[orxCOMMAND_KU32_COMPILE_INSTRUCTION_NUMBER]; /**< Compile instruction list */
+  orxCOMMAND_COMPILED_ARG   astCompileArgList[orxCOMMAND_KU32_COMPILE_ARG_NUMBER];    /**< Compile argument list */
+  orxU8                     au8CompileSourceList[orxCOMMAND_KU32_COMPILE_ARG_NUMBER]; /**< Compile argument source list */
+  orxCHAR                   acCompileBuffer[orxCOMMAND_KU32_COMPILE_BUFFER_SIZE];     /**< Compile buffer */
   orxCHAR                   acEvaluateBuffer[orxCOMMAND_KU32_EVALUATE_BUFFER_SIZE];   /**< Evaluate buffer */
   orxCHAR                   acProcessBuffer[orxCOMMAND_KU32_PROCESS_BUFFER_SIZE];     /**< Process buffer */
   orxCHAR                   acPrototypeBuffer[orxCOMMAND_KU32_PROTOTYPE_BUFFER_SIZE]; /**< Prototype buffer */
   orxCHAR                   acResultBuffer[orxCOMMAND_KU32_RESULT_BUFFER_SIZE];       /**< Result buffer */
   orxS32                    s32EvaluateOffset;                                        /**< Evaluate buffer offset */
+  orxU32                    u32ProgramDepth;                                          /**< Running program depth */
   orxU32                    u32Flags;                                                 /**< Control flags */
 
 } orxCOMMAND_STATIC;
@@ -442,706 +517,1462 @@ static orxINLINE const orxCOMMAND *orxCommand_FindNext(const orxCOMMAND_TRIE_NOD
   return pstResult;
 }
 
-static orxCOMMAND_VAR *orxFASTCALL orxCommand_Process(const orxSTRING _zCommandLine, const orxU64 _u64GUID, orxCOMMAND_VAR *_pstResult, orxBOOL _bSilent)
+/** Gets the argument buffer list of a command: its input first, then its aliases' arguments
+ * @param[in]   _zCommand       Command name, as used in the command line
+ * @param[in]   _pcCommandEnd   End of command name in the command line (input arguments)
+ * @param[out]  _azBufferList   Argument buffer list
+ * @return      Number of argument buffers
+ */
+static orxINLINE orxS32 orxCommand_GetBufferList(const orxSTRING _zCommand, const orxCHAR *_pcCommandEnd, const orxSTRING *_azBufferList)
 {
-  const orxSTRING zCommand;
-  orxBOOL         bProcessed = orxFALSE;
-  orxCOMMAND_VAR *pstResult = orxNULL;
-
-  /* Profiles */
-  orxPROFILER_PUSH_MARKER("orxCommand_Process");
+  orxCOMMAND_TRIE_NODE *pstCommandNode;
+  orxS32                s32Result = 0;
 
-  /* Gets start of command */
-  zCommand = orxString_SkipWhiteSpaces(_zCommandLine);
+  /* Adds input to the buffer list */
+  _azBufferList[s32Result++] = _pcCommandEnd;
 
-  /* For all commands */
-  while(*zCommand != orxCHAR_NULL)
+  /* For all alias nodes */
+  for(pstCommandNode = orxCommand_FindTrieNode(_zCommand, orxFALSE);
+      (pstCommandNode->pstCommand->bIsAlias != orxFALSE) && (s32Result < orxCOMMAND_KU32_ALIAS_MAX_DEPTH);
+      pstCommandNode = orxCommand_FindTrieNode(pstCommandNode->pstCommand->zAliasedCommandName, orxFALSE))
   {
-    orxU32          u32PushCount;
-    const orxCHAR  *pcCommandEnd;
-    orxCOMMAND     *pstCommand;
-    orxCHAR         cBackupChar;
-
-    /* Updates status */
-    bProcessed = orxTRUE;
-
-    /* For all push markers / spaces */
-    for(u32PushCount = 0; (*zCommand == orxCOMMAND_KC_PUSH_MARKER) || (orxCommand_IsWhiteSpace(*zCommand) != orxFALSE); zCommand++)
+    /* Has args? */
+    if(pstCommandNode->pstCommand->zArgs != orxNULL)
     {
-      /* Is a push marker? */
-      if(*zCommand == orxCOMMAND_KC_PUSH_MARKER)
-      {
-        /* Updates push count */
-        u32PushCount++;
-      }
+      /* Adds it to the buffer list */
+      _azBufferList[s32Result++] = pstCommandNode->pstCommand->zArgs;
     }
+  }
 
-    /* Finds end of command */
-    for(pcCommandEnd = zCommand + 1; (*pcCommandEnd != orxCHAR_NULL) && (orxCommand_IsWhiteSpace(*pcCommandEnd) == orxFALSE) && (*pcCommandEnd != orxCHAR_CR) && (*pcCommandEnd != orxCHAR_LF) && (*pcCommandEnd != orxCOMMAND_KC_SEPARATOR); pcCommandEnd++)
-      ;
+  /* Done! */
+  return s32Result;
+}
 
-    /* Ends command */
-    cBackupChar               = *pcCommandEnd;
-    *(orxCHAR *)pcCommandEnd  = orxCHAR_NULL;
+/** Expands a command's argument buffers (aliases' arguments, then input) in the process buffer, replacing GUID & pop markers
+ * @param[in]   _zCommandLine   Command line, for logging
+ * @param[in]   _azBufferList   Argument buffer list, input first
+ * @param[in]   _s32BufferCount Number of argument buffers
+ * @param[in]   _zGUID          GUID literal
+ * @param[in]   _s32GUIDLength  GUID literal length, 0 for no GUID
+ * @param[in]   _pstCompileInfo Compile info: markers are then replaced with tokens instead of being evaluated, orxNULL when not compiling
+ * @return      End of processed input
+ */
+static const orxCHAR *orxFASTCALL orxCommand_ExpandArgs(const orxSTRING _zCommandLine, const orxSTRING *_azBufferList, orxS32 _s32BufferCount, const orxSTRING _zGUID, orxS32 _s32GUIDLength, orxCOMMAND_COMPILE_INFO *_pstCompileInfo)
+{
+  orxS32          s32VectorDepth = 0, i;
+  orxBOOL         bInBlock = orxFALSE;
+  const orxCHAR  *pcSrc = orxNULL;
+  orxCHAR        *pcDst;
 
-    /* Gets it */
-    pstCommand = orxCommand_FindNoAlias(zCommand);
+  /* For all stacked buffers */
+  for(i = _s32BufferCount - 1, pcDst = sstCommand.acProcessBuffer; i >= 0; i--)
+  {
+    orxBOOL bStop;
 
-    /* Found? */
-    if(pstCommand != orxNULL)
+    /* Has room for next buffer? */
+    if((i != _s32BufferCount - 1) && (*_azBufferList[i] != orxCHAR_NULL) && (pcDst - sstCommand.acProcessBuffer < orxCOMMAND_KU32_PROCESS_BUFFER_SIZE - 2))
     {
-#define orxCOMMAND_KU32_ALIAS_MAX_DEPTH             32
-      orxSTATUS             eStatus;
-      orxS32                s32GUIDLength, s32BufferCount = 0, s32VectorDepth = 0, i;
-      orxBOOL               bInBlock = orxFALSE;
-      orxCOMMAND_TRIE_NODE *pstCommandNode;
-      const orxCHAR        *pcSrc;
-      orxCHAR              *pcDst;
-      const orxSTRING       zArg;
-      const orxSTRING       azBufferList[orxCOMMAND_KU32_ALIAS_MAX_DEPTH];
-      orxU32                u32ArgNumber, u32ParamNumber = (orxU32)pstCommand->u16RequiredParamNumber + (orxU32)pstCommand->u16OptionalParamNumber;
-      orxCHAR               acGUID[20];
-
-#ifdef __orxMSVC__
-
-      orxCOMMAND_VAR *astArgList = (orxCOMMAND_VAR *)alloca(u32ParamNumber * sizeof(orxCOMMAND_VAR));
-
-#else /* __orxMSVC__ */
-
-      orxCOMMAND_VAR astArgList[u32ParamNumber];
-
-#endif /* __orxMSVC__ */
-
-      /* Is GUID valid? */
-      if(_u64GUID != orxU64_UNDEFINED)
-      {
-        /* Gets owner's GUID */
-        acGUID[19]    = orxCHAR_NULL;
-        s32GUIDLength = orxString_NPrint(acGUID, 19, "0x%016llX", _u64GUID);
-      }
-      else
-      {
-        /* No GUID */
-        s32GUIDLength = 0;
-      }
-
-      /* Adds input to the buffer list */
-      azBufferList[s32BufferCount++] = pcCommandEnd;
+      /* Inserts space */
+      *pcDst++ = ' ';
+    }
 
-      /* For all alias nodes */
-      for(pstCommandNode = orxCommand_FindTrieNode(zCommand, orxFALSE);
-          (pstCommandNode->pstCommand->bIsAlias != orxFALSE) && (s32BufferCount < orxCOMMAND_KU32_ALIAS_MAX_DEPTH);
-          pstCommandNode = orxCommand_FindTrieNode(pstCommandNode->pstCommand->zAliasedCommandName, orxFALSE))
+    /* For all characters */
+    for(pcSrc = _azBufferList[i], bStop = orxFALSE; (bStop == orxFALSE) && (*pcSrc != orxCHAR_NULL) && (pcDst - sstCommand.acProcessBuffer < orxCOMMAND_KU32_PROCESS_BUFFER_SIZE - 2); pcSrc++)
+    {
+      /* Depending on character */
+      switch(*pcSrc)
       {
-        /* Has args? */
-        if(pstCommandNode->pstCommand->zArgs != orxNULL)
+        case orxCOMMAND_KC_GUID_MARKER:
         {
-          /* Adds it to the buffer list */
-          azBufferList[s32BufferCount++] = pstCommandNode->pstCommand->zArgs;
-        }
-      }
+          /* Compiling? */
+          if(_pstCompileInfo != orxNULL)
+          {
+            /* Inserts GUID token */
+            *pcDst++ = orxCOMMAND_KC_COMPILED_GUID;
 
-      /* Restores command end */
-      *(orxCHAR *)pcCommandEnd = cBackupChar;
+            /* Updates marker count */
+            _pstCompileInfo->u32MarkerCount++;
+          }
+          /* Has valid GUID? */
+          else if(_s32GUIDLength != 0)
+          {
+            /* Replaces it with GUID */
+            orxString_NCopy(pcDst, _zGUID, orxCOMMAND_KU32_PROCESS_BUFFER_SIZE - 1 - (orxU32)(pcDst - sstCommand.acProcessBuffer));
 
-      /* For all stacked buffers */
-      for(i = s32BufferCount - 1, pcDst = sstCommand.acProcessBuffer; i >= 0; i--)
-      {
-        orxBOOL bStop;
+            /* Updates pointer */
+            pcDst += _s32GUIDLength;
+          }
+          else
+          {
+            /* Copies character */
+            *pcDst++ = *pcSrc;
+          }
 
-        /* Has room for next buffer? */
-        if((i != s32BufferCount - 1) && (*azBufferList[i] != orxCHAR_NULL) && (pcDst - sstCommand.acProcessBuffer < orxCOMMAND_KU32_PROCESS_BUFFER_SIZE - 2))
-        {
-          /* Inserts space */
-          *pcDst++ = ' ';
+          break;
         }
 
-        /* For all characters */
-        for(pcSrc = azBufferList[i], bStop = orxFALSE; (bStop == orxFALSE) && (*pcSrc != orxCHAR_NULL) && (pcDst - sstCommand.acProcessBuffer < orxCOMMAND_KU32_PROCESS_BUFFER_SIZE - 2); pcSrc++)
+        case orxCOMMAND_KC_POP_MARKER:
         {
-          /* Depending on character */
-          switch(*pcSrc)
+          /* Compiling? */
+          if(_pstCompileInfo != orxNULL)
           {
-            case orxCOMMAND_KC_GUID_MARKER:
-            {
-              /* Has valid GUID? */
-              if(s32GUIDLength != 0)
-              {
-                /* Replaces it with GUID */
-                orxString_NCopy(pcDst, acGUID, orxCOMMAND_KU32_PROCESS_BUFFER_SIZE - 1 - (orxU32)(pcDst - sstCommand.acProcessBuffer));
+            /* Inserts pop token */
+            *pcDst++ = orxCOMMAND_KC_COMPILED_POP;
 
-                /* Updates pointer */
-                pcDst += s32GUIDLength;
-              }
-              else
-              {
-                /* Copies character */
-                *pcDst++ = *pcSrc;
-              }
+            /* Updates marker count */
+            _pstCompileInfo->u32MarkerCount++;
+          }
+          /* Valid? */
+          else if(orxBank_GetCount(sstCommand.pstResultBank) > 0)
+          {
+            orxCOMMAND_STACK_ENTRY *pstEntry;
+            orxCHAR                 acValue[64];
+            orxBOOL                 bUseStringMarker = orxFALSE;
+            const orxSTRING         zValue = acValue;
 
-              break;
-            }
+            /* Gets last stack entry */
+            pstEntry = (orxCOMMAND_STACK_ENTRY *)orxBank_GetAtIndex(sstCommand.pstResultBank, orxBank_GetCount(sstCommand.pstResultBank) - 1);
 
-            case orxCOMMAND_KC_POP_MARKER:
+            /* Inits value */
+            acValue[sizeof(acValue) - 1] = orxCHAR_NULL;
+
+            /* Depending on type */
+            switch(pstEntry->stValue.eType)
             {
-              /* Valid? */
-              if(orxBank_GetCount(sstCommand.pstResultBank) > 0)
+              case orxCOMMAND_VAR_TYPE_STRING:
               {
-                orxCOMMAND_STACK_ENTRY *pstEntry;
-                orxCHAR                 acValue[64];
-                orxBOOL                 bUseStringMarker = orxFALSE;
-                const orxSTRING         zValue = acValue;
-
-                /* Gets last stack entry */
-                pstEntry = (orxCOMMAND_STACK_ENTRY *)orxBank_GetAtIndex(sstCommand.pstResultBank, orxBank_GetCount(sstCommand.pstResultBank) - 1);
-
-                /* Inits value */
-                acValue[sizeof(acValue) - 1] = orxCHAR_NULL;
+                /* Updates pointer */
+                zValue = pstEntry->stValue.zValue;
 
-                /* Depending on type */
-                switch(pstEntry->stValue.eType)
+                /* Is not in block? */
+                if(bInBlock == orxFALSE)
                 {
-                  case orxCOMMAND_VAR_TYPE_STRING:
-                  {
-                    /* Updates pointer */
-                    zValue = pstEntry->stValue.zValue;
+                  const orxCHAR *pc = zValue;
 
-                    /* Is not in block? */
-                    if(bInBlock == orxFALSE)
+                  /* For all characters */
+                  do
+                  {
+                    /* Is a white space? */
+                    if((*pc == orxCHAR_NULL) || (orxCommand_IsWhiteSpace(*pc) != orxFALSE))
                     {
-                      const orxCHAR *pc = zValue;
-
-                      /* For all characters */
-                      do
+                      /* Has room? */
+                      if(pcDst - sstCommand.acProcessBuffer < orxCOMMAND_KU32_PROCESS_BUFFER_SIZE - 1)
                       {
-                        /* Is a white space? */
-                        if((*pc == orxCHAR_NULL) || (orxCommand_IsWhiteSpace(*pc) != orxFALSE))
-                        {
-                          /* Has room? */
-                          if(pcDst - sstCommand.acProcessBuffer < orxCOMMAND_KU32_PROCESS_BUFFER_SIZE - 1)
-                          {
-                            /* Adds block marker */
-                            *pcDst++ = orxCOMMAND_KC_BLOCK_MARKER;
-
-                            /* Updates string marker status */
-                            bUseStringMarker = orxTRUE;
-                          }
-
-                          break;
-                        }
-
-                        /* Gets next character */
-                        pc++;
-
-                      } while(*pc != orxCHAR_NULL);
-                    }
-
-                    break;
-                  }
-
-                  default:
-                  {
-                    orxCommand_PrintVar(acValue, sizeof(acValue) - 1, &(pstEntry->stValue));
+                        /* Adds block marker */
+                        *pcDst++ = orxCOMMAND_KC_BLOCK_MARKER;
 
-                    break;
-                  }
-                }
+                        /* Updates string marker status */
+                        bUseStringMarker = orxTRUE;
+                      }
 
-                /* Replaces marker with stacked value */
-                orxString_NCopy(pcDst, zValue, orxCOMMAND_KU32_PROCESS_BUFFER_SIZE - 1 - (orxU32)(pcDst - sstCommand.acProcessBuffer));
+                      break;
+                    }
 
-                /* Updates pointers */
-                pcDst += orxString_GetLength(zValue);
+                    /* Gets next character */
+                    pc++;
 
-                /* Used a string marker? */
-                if(bUseStringMarker != orxFALSE)
-                {
-                  /* Has room? */
-                  if(pcDst - sstCommand.acProcessBuffer < orxCOMMAND_KU32_PROCESS_BUFFER_SIZE - 1)
-                  {
-                    *pcDst++ = orxCOMMAND_KC_BLOCK_MARKER;
-                  }
+                  } while(*pc != orxCHAR_NULL);
                 }
 
-                /* Deletes stack entry */
-                orxBank_Free(sstCommand.pstResultBank, pstEntry);
+                break;
               }
-              else
-              {
-                /* Logs message */
-                orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Can't pop stacked argument for command line [%s]: stack is empty.", _zCommandLine);
 
-                /* Replaces marker with stack error */
-                orxString_NCopy(pcDst, orxCOMMAND_KZ_STACK_ERROR_VALUE, orxCOMMAND_KU32_PROCESS_BUFFER_SIZE - 1 - (orxU32)(pcDst - sstCommand.acProcessBuffer));
+              default:
+              {
+                orxCommand_PrintVar(acValue, sizeof(acValue) - 1, &(pstEntry->stValue));
 
-                /* Updates pointers */
-                pcDst += orxString_GetLength(orxCOMMAND_KZ_ERROR_VALUE);
+                break;
               }
-
-              break;
             }
 
-            case orxCOMMAND_KC_SEPARATOR:
-            case orxCHAR_CR:
-            case orxCHAR_LF:
+            /* Replaces marker with stacked value */
+            orxString_NCopy(pcDst, zValue, orxCOMMAND_KU32_PROCESS_BUFFER_SIZE - 1 - (orxU32)(pcDst - sstCommand.acProcessBuffer));
+
+            /* Updates pointers */
+            pcDst += orxString_GetLength(zValue);
+
+            /* Used a string marker? */
+            if(bUseStringMarker != orxFALSE)
             {
-              /* Not in block or in vector? */
-              if((bInBlock == orxFALSE)
-              && (s32VectorDepth == 0))
-              {
-                /* Stops */
-                bStop = orxTRUE;
-              }
-              else
+              /* Has room? */
+              if(pcDst - sstCommand.acProcessBuffer < orxCOMMAND_KU32_PROCESS_BUFFER_SIZE - 1)
               {
-                /* Copies it */
-                *pcDst++ = *pcSrc;
+                *pcDst++ = orxCOMMAND_KC_BLOCK_MARKER;
               }
-
-              break;
             }
 
-            case orxSTRING_KC_VECTOR_START:
-            case orxSTRING_KC_VECTOR_START_ALT:
-            {
-              /* Increments vector depth */
-              s32VectorDepth++;
+            /* Deletes stack entry */
+            orxBank_Free(sstCommand.pstResultBank, pstEntry);
+          }
+          else
+          {
+            /* Logs message */
+            orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Can't pop stacked argument for command line [%s]: stack is empty.", _zCommandLine);
 
-              /* Copies it */
-              *pcDst++ = *pcSrc;
+            /* Replaces marker with stack error */
+            orxString_NCopy(pcDst, orxCOMMAND_KZ_STACK_ERROR_VALUE, orxCOMMAND_KU32_PROCESS_BUFFER_SIZE - 1 - (orxU32)(pcDst - sstCommand.acProcessBuffer));
 
-              break;
-            }
+            /* Updates pointers */
+            pcDst += orxString_GetLength(orxCOMMAND_KZ_STACK_ERROR_VALUE);
+          }
 
-            case orxSTRING_KC_VECTOR_END:
-            case orxSTRING_KC_VECTOR_END_ALT:
-            {
-              /* Decrements vector depth */
-              s32VectorDepth--;
+          break;
+        }
 
-              /* Copies it */
-              *pcDst++ = *pcSrc;
+        case orxCOMMAND_KC_SEPARATOR:
+        case orxCHAR_CR:
+        case orxCHAR_LF:
+        {
+          /* Not in block or in vector? */
+          if((bInBlock == orxFALSE)
+          && (s32VectorDepth == 0))
+          {
+            /* Stops */
+            bStop = orxTRUE;
+          }
+          else
+          {
+            /* Copies it */
+            *pcDst++ = *pcSrc;
+          }
 
-              break;
-            }
+          break;
+        }
 
-            case orxCOMMAND_KC_BLOCK_MARKER:
-            {
-              /* Toggles block status */
-              bInBlock = !bInBlock;
+        case orxSTRING_KC_VECTOR_START:
+        case orxSTRING_KC_VECTOR_START_ALT:
+        {
+          /* Increments vector depth */
+          s32VectorDepth++;
 
-              /* Falls through */
-            }
+          /* Copies it */
+          *pcDst++ = *pcSrc;
 
-            default:
-            {
-              /* Copies it */
-              *pcDst++ = *pcSrc;
+          break;
+        }
 
-              break;
-            }
+        case orxSTRING_KC_VECTOR_END:
+        case orxSTRING_KC_VECTOR_END_ALT:
+        {
+          /* Decrements vector depth */
+          s32VectorDepth--;
+
+          /* Copies it */
+          *pcDst++ = *pcSrc;
+
+          break;
+        }
+
+        case orxCOMMAND_KC_BLOCK_MARKER:
+        {
+          /* Toggles block status */
+          bInBlock = !bInBlock;
+
+          /* Falls through */
+        }
+
+        case orxCOMMAND_KC_COMPILED_POP:
+        case orxCOMMAND_KC_COMPILED_GUID:
+        {
+          /* Compiling? */
+          if(_pstCompileInfo != orxNULL)
+          {
+            /* Can't be compiled */
+            _pstCompileInfo->bIsValid = orxFALSE;
           }
+
+          /* Copies it */
+          *pcDst++ = *pcSrc;
+
+          break;
+        }
+
+        default:
+        {
+          /* Copies it */
+          *pcDst++ = *pcSrc;
+
+          break;
         }
       }
+    }
+  }
 
-      /* Copies end of string */
-      *pcDst = orxCHAR_NULL;
+  /* Copies end of string */
+  *pcDst = orxCHAR_NULL;
 
-      /* Updates next command expression */
-      zCommand = orxString_SkipWhiteSpaces(pcSrc);
+  /* Done! */
+  return pcSrc;
+}
+
+/** Parses arguments from the process buffer
+ * @param[in]   _pstCommand     Concerned command
+ * @param[out]  _astArgList     Parsed argument list
+ * @param[out]  _pu32ArgNumber  Number of parsed arguments
+ * @param[in]   _pstCompileInfo Compile info: GUID & pop tokens are then recognized, orxNULL when not compiling
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+static orxSTATUS orxFASTCALL orxCommand_ParseArgs(const orxCOMMAND *_pstCommand, orxCOMMAND_VAR *_astArgList, orxU32 *_pu32ArgNumber, orxCOMMAND_COMPILE_INFO *_pstCompileInfo)
+{
+  orxS32          s32VectorDepth;
+  const orxCHAR  *pcSrc;
+  const orxSTRING zArg;
+  orxU32          u32ArgNumber, u32ParamNumber = (orxU32)_pstCommand->u16RequiredParamNumber + (orxU32)_pstCommand->u16OptionalParamNumber;
+  orxSTATUS       eResult;
+
+  /* For all characters in the buffer */
+  for(pcSrc = sstCommand.acProcessBuffer, eResult = orxSTATUS_SUCCESS, zArg = orxSTRING_EMPTY, u32ArgNumber = 0;
+      (u32ArgNumber < u32ParamNumber) && (pcSrc - sstCommand.acProcessBuffer < orxCOMMAND_KU32_PROCESS_BUFFER_SIZE) && (*pcSrc != orxCHAR_NULL);
+      pcSrc++, u32ArgNumber++)
+  {
+    /* Skips all whitespaces */
+    pcSrc = orxString_SkipWhiteSpaces(pcSrc);
 
-      /* For all characters in the buffer */
-      for(pcSrc = sstCommand.acProcessBuffer, eStatus = orxSTATUS_SUCCESS, zArg = orxSTRING_EMPTY, u32ArgNumber = 0;
-          (u32ArgNumber < u32ParamNumber) && (pcSrc - sstCommand.acProcessBuffer < orxCOMMAND_KU32_PROCESS_BUFFER_SIZE) && (*pcSrc != orxCHAR_NULL);
-          pcSrc++, u32ArgNumber++)
+    /* Valid? */
+    if(*pcSrc != orxCHAR_NULL)
+    {
+      orxBOOL bInBlock = orxFALSE, bUseDefault = orxFALSE;
+
+      /* Inits vector depth */
+      s32VectorDepth = ((*pcSrc == orxSTRING_KC_VECTOR_START) || (*pcSrc == orxSTRING_KC_VECTOR_START_ALT)) ? 0 : -1;
+
+      /* Gets arg's beginning */
+      zArg = pcSrc;
+
+      /* Is a block marker? */
+      if(*pcSrc == orxCOMMAND_KC_BLOCK_MARKER)
       {
-        /* Skips all whitespaces */
-        pcSrc = orxString_SkipWhiteSpaces(pcSrc);
+        /* Updates arg pointer */
+        zArg++;
+        pcSrc++;
 
-        /* Valid? */
-        if(*pcSrc != orxCHAR_NULL)
+        /* Is an empty block? */
+        if((*pcSrc == orxCOMMAND_KC_BLOCK_MARKER)
+        && (*(pcSrc + 1) != orxCOMMAND_KC_BLOCK_MARKER))
+        {
+          /* Uses default */
+          bUseDefault = orxTRUE;
+
+          /* Updates arg pointer */
+          zArg++;
+          pcSrc++;
+        }
+        else
         {
-          orxBOOL bInBlock = orxFALSE, bUseDefault = orxFALSE;
+          /* Updates block status */
+          bInBlock = orxTRUE;
+        }
+      }
 
-          /* Inits vector depth */
-          s32VectorDepth = ((*pcSrc == orxSTRING_KC_VECTOR_START) || (*pcSrc == orxSTRING_KC_VECTOR_START_ALT)) ? 0 : -1;
+      /* Is a compiled marker token? */
+      if((_pstCompileInfo != orxNULL)
+      && (bInBlock == orxFALSE)
+      && (bUseDefault == orxFALSE)
+      && ((*pcSrc == orxCOMMAND_KC_COMPILED_POP) || (*pcSrc == orxCOMMAND_KC_COMPILED_GUID))
+      && ((*(pcSrc + 1) == orxCHAR_NULL) || (orxCommand_IsWhiteSpace(*(pcSrc + 1)) != orxFALSE)))
+      {
+        /* Stores its type & source */
+        _astArgList[u32ArgNumber].eType             = _pstCommand->astParamList[u32ArgNumber].eType;
+        _pstCompileInfo->au8SourceList[u32ArgNumber] = (orxU8)((*pcSrc == orxCOMMAND_KC_COMPILED_POP) ? orxCOMMAND_ARG_SOURCE_POP : orxCOMMAND_ARG_SOURCE_GUID);
 
-          /* Gets arg's beginning */
-          zArg = pcSrc;
+        /* Updates token count */
+        _pstCompileInfo->u32TokenCount++;
 
-          /* Is a block marker? */
-          if(*pcSrc == orxCOMMAND_KC_BLOCK_MARKER)
-          {
-            /* Updates arg pointer */
-            zArg++;
-            pcSrc++;
+        /* Skips it */
+        pcSrc++;
+      }
+      else
+      {
+        /* Stores its type */
+        _astArgList[u32ArgNumber].eType = _pstCommand->astParamList[u32ArgNumber].eType;
 
-            /* Is an empty block? */
-            if((*pcSrc == orxCOMMAND_KC_BLOCK_MARKER)
-            && (*(pcSrc + 1) != orxCOMMAND_KC_BLOCK_MARKER))
+        /* Depending on its type */
+        switch(_pstCommand->astParamList[u32ArgNumber].eType)
+        {
+          case orxCOMMAND_VAR_TYPE_NUMERIC:
+          {
+            /* Should use default? */
+            if(bUseDefault != orxFALSE)
             {
-              /* Uses default */
-              bUseDefault = orxTRUE;
+              /* Replaces block end marker with 0 */
+              pcSrc--;
+              zArg--;
+              *((orxCHAR *)pcSrc) = '0';
 
-              /* Updates arg pointer */
-              zArg++;
-              pcSrc++;
+              /* Fall through */
             }
-            else
+            /* Not in block? */
+            else if(bInBlock == orxFALSE)
             {
-              /* Updates block status */
-              bInBlock = orxTRUE;
+              orxVECTOR vValue;
+
+              /* Is a vector */
+              if(orxString_ToVector(zArg, &vValue, &pcSrc) != orxSTATUS_FAILURE)
+              {
+                /* Stores its value */
+                _astArgList[u32ArgNumber].zValue = zArg;
+
+                /* Stops */
+                break;
+              }
+              else
+              {
+                /* Fall through */
+              }
             }
           }
 
-          /* Stores its type */
-          astArgList[u32ArgNumber].eType = pstCommand->astParamList[u32ArgNumber].eType;
-
-          /* Depending on its type */
-          switch(pstCommand->astParamList[u32ArgNumber].eType)
+          default:
+          case orxCOMMAND_VAR_TYPE_STRING:
           {
-            case orxCOMMAND_VAR_TYPE_NUMERIC:
+            /* For all argument characters */
+            for(; *pcSrc != orxCHAR_NULL; pcSrc++)
             {
-              /* Should use default? */
-              if(bUseDefault != orxFALSE)
-              {
-                /* Replaces block end marker with 0 */
-                pcSrc--;
-                zArg--;
-                *((orxCHAR *)pcSrc) = '0';
+              orxCHAR *pcTemp;
 
-                /* Fall through */
-              }
-              /* Not in block? */
-              else if(bInBlock == orxFALSE)
+              /* Depending on character */
+              switch(*pcSrc)
               {
-                orxVECTOR vValue;
-
-                /* Is a vector */
-                if(orxString_ToVector(zArg, &vValue, &pcSrc) != orxSTATUS_FAILURE)
+                case orxSTRING_KC_VECTOR_START:
+                case orxSTRING_KC_VECTOR_START_ALT:
                 {
-                  /* Stores its value */
-                  astArgList[u32ArgNumber].zValue = zArg;
-
-                  /* Stops */
+                  /* Should update? */
+                  if(s32VectorDepth >= 0)
+                  {
+                    /* Increments vector depth */
+                    s32VectorDepth++;
+                  }
                   break;
                 }
-                else
+
+                case orxSTRING_KC_VECTOR_END:
+                case orxSTRING_KC_VECTOR_END_ALT:
                 {
-                  /* Fall through */
-                }
-              }
-            }
-
-            default:
-            case orxCOMMAND_VAR_TYPE_STRING:
-            {
-              /* For all argument characters */
-              for(; *pcSrc != orxCHAR_NULL; pcSrc++)
-              {
-                orxCHAR *pcTemp;
-
-                /* Depending on character */
-                switch(*pcSrc)
-                {
-                  case orxSTRING_KC_VECTOR_START:
-                  case orxSTRING_KC_VECTOR_START_ALT:
+                  /* Should update? */
+                  if(s32VectorDepth >= 0)
                   {
-                    /* Should update? */
-                    if(s32VectorDepth >= 0)
-                    {
-                      /* Increments vector depth */
-                      s32VectorDepth++;
-                    }
-                    break;
+                    /* Decrements vector depth */
+                    s32VectorDepth--;
                   }
+                  break;
+                }
 
-                  case orxSTRING_KC_VECTOR_END:
-                  case orxSTRING_KC_VECTOR_END_ALT:
+                case orxCOMMAND_KC_BLOCK_MARKER:
+                {
+                  /* Erases it */
+                  for(pcTemp = (orxCHAR *)pcSrc; *pcTemp != orxCHAR_NULL; pcTemp++)
                   {
-                    /* Should update? */
-                    if(s32VectorDepth >= 0)
-                    {
-                      /* Decrements vector depth */
-                      s32VectorDepth--;
-                    }
-                    break;
+                    *pcTemp = *(pcTemp + 1);
                   }
 
-                  case orxCOMMAND_KC_BLOCK_MARKER:
+                  /* Not double marker? */
+                  if(*pcSrc != orxCOMMAND_KC_BLOCK_MARKER)
                   {
-                    /* Erases it */
-                    for(pcTemp = (orxCHAR *)pcSrc; *pcTemp != orxCHAR_NULL; pcTemp++)
-                    {
-                      *pcTemp = *(pcTemp + 1);
-                    }
-
-                    /* Not double marker? */
-                    if(*pcSrc != orxCOMMAND_KC_BLOCK_MARKER)
-                    {
-                      /* Updates block status */
-                      bInBlock = !bInBlock;
+                    /* Updates block status */
+                    bInBlock = !bInBlock;
 
-                      /* Handles current character in new mode */
-                      pcSrc--;
-                    }
-                    continue;
-                  }
-                  default:
-                  {
-                    break;
+                    /* Handles current character in new mode */
+                    pcSrc--;
                   }
+                  continue;
                 }
+                default:
+                {
+                  break;
+                }
+              }
 
-                /* Not in block or in vector? */
-                if((bInBlock == orxFALSE) && (s32VectorDepth <= 0))
+              /* Not in block or in vector? */
+              if((bInBlock == orxFALSE) && (s32VectorDepth <= 0))
+              {
+                /* End of string? */
+                if(orxCommand_IsWhiteSpace(*pcSrc) != orxFALSE)
                 {
-                  /* End of string? */
-                  if(orxCommand_IsWhiteSpace(*pcSrc) != orxFALSE)
-                  {
-                    /* Stops */
-                    break;
-                  }
+                  /* Stops */
+                  break;
                 }
               }
+            }
 
-              /* Stores its value */
-              astArgList[u32ArgNumber].zValue = zArg;
+            /* Stores its value */
+            _astArgList[u32ArgNumber].zValue = zArg;
 
-              break;
+            break;
+          }
+
+          case orxCOMMAND_VAR_TYPE_FLOAT:
+          {
+            /* Should use default? */
+            if(bUseDefault != orxFALSE)
+            {
+              /* Uses default value */
+              _astArgList[u32ArgNumber].fValue = orxFLOAT_0;
+            }
+            else
+            {
+              /* Gets its value */
+              eResult = orxString_ToFloat(zArg, &(_astArgList[u32ArgNumber].fValue), &pcSrc);
+            }
+
+            break;
+          }
+
+          case orxCOMMAND_VAR_TYPE_S32:
+          {
+            /* Should use default? */
+            if(bUseDefault != orxFALSE)
+            {
+              /* Uses default value */
+              _astArgList[u32ArgNumber].s32Value = 0;
+            }
+            else
+            {
+              /* Gets its value */
+              eResult = orxString_ToS32(zArg, &(_astArgList[u32ArgNumber].s32Value), &pcSrc);
+            }
+
+            break;
+          }
+
+          case orxCOMMAND_VAR_TYPE_U32:
+          {
+            /* Should use default? */
+            if(bUseDefault != orxFALSE)
+            {
+              /* Uses default value */
+              _astArgList[u32ArgNumber].u32Value = 0;
+            }
+            else
+            {
+              /* Gets its value */
+              eResult = orxString_ToU32(zArg, &(_astArgList[u32ArgNumber].u32Value), &pcSrc);
+            }
+
+            break;
+          }
+
+          case orxCOMMAND_VAR_TYPE_S64:
+          {
+            /* Should use default? */
+            if(bUseDefault != orxFALSE)
+            {
+              /* Uses default value */
+              _astArgList[u32ArgNumber].s64Value = 0;
+            }
+            else
+            {
+              /* Gets its value */
+              eResult = orxString_ToS64(zArg, &(_astArgList[u32ArgNumber].s64Value), &pcSrc);
+            }
+
+            break;
+          }
+
+          case orxCOMMAND_VAR_TYPE_U64:
+          {
+            /* Should use default? */
+            if(bUseDefault != orxFALSE)
+            {
+              /* Uses default value */
+              _astArgList[u32ArgNumber].u64Value = 0;
+            }
+            else
+            {
+              /* Gets its value */
+              eResult = orxString_ToU64(zArg, &(_astArgList[u32ArgNumber].u64Value), &pcSrc);
+            }
+
+            break;
+          }
+
+          case orxCOMMAND_VAR_TYPE_BOOL:
+          {
+            /* Should use default? */
+            if(bUseDefault != orxFALSE)
+            {
+              /* Uses default value */
+              _astArgList[u32ArgNumber].bValue = orxFALSE;
+            }
+            else
+            {
+              /* Gets its value */
+              eResult = orxString_ToBool(zArg, &(_astArgList[u32ArgNumber].bValue), &pcSrc);
+            }
+
+            break;
+          }
+
+          case orxCOMMAND_VAR_TYPE_VECTOR:
+          {
+            /* Should use default? */
+            if(bUseDefault != orxFALSE)
+            {
+              /* Uses default value */
+              orxVector_Copy(&(_astArgList[u32ArgNumber].vValue), &orxVECTOR_0);
+            }
+            else
+            {
+              /* Gets its value */
+              eResult = orxString_ToVector(zArg, &(_astArgList[u32ArgNumber].vValue), &pcSrc);
+            }
+
+            break;
+          }
+        }
+      }
+
+      /* Interrupted? */
+      if((eResult == orxSTATUS_FAILURE) || (*pcSrc == orxCHAR_NULL))
+      {
+        /* Updates argument count */
+        u32ArgNumber++;
+
+        /* Stops processing */
+        break;
+      }
+      else
+      {
+        /* Ends current argument */
+        *(orxCHAR *)pcSrc = orxCHAR_NULL;
+      }
+    }
+    else
+    {
+      /* Stops */
+      break;
+    }
+  }
+
+  /* Stores argument number */
+  *_pu32ArgNumber = u32ArgNumber;
+
+  /* Done! */
+  return eResult;
+}
+
+/** Pushes a result on the stack
+ */
+static orxINLINE void orxCommand_PushResult(const orxCOMMAND_VAR *_pstResult)
+{
+  orxCOMMAND_STACK_ENTRY *pstEntry;
+
+  /* Allocates stack entry */
+  pstEntry = (orxCOMMAND_STACK_ENTRY *)orxBank_Allocate(sstCommand.pstResultBank);
+
+  /* Checks */
+  orxASSERT(pstEntry != orxNULL);
+
+  /* Is a string or numeric value? */
+  if((_pstResult->eType == orxCOMMAND_VAR_TYPE_STRING)
+  || (_pstResult->eType == orxCOMMAND_VAR_TYPE_NUMERIC))
+  {
+    /* Checks */
+    orxASSERT(orxString_GetLength(_pstResult->zValue) < orxCOMMAND_KU32_STACK_ENTRY_BUFFER_SIZE);
+
+    /* Duplicates it */
+    pstEntry->stValue.eType   = _pstResult->eType;
+    pstEntry->stValue.zValue  = pstEntry->acBuffer;
+    orxString_NCopy(pstEntry->acBuffer, _pstResult->zValue, orxCOMMAND_KU32_STACK_ENTRY_BUFFER_SIZE - 1);
+    pstEntry->acBuffer[orxCOMMAND_KU32_STACK_ENTRY_BUFFER_SIZE - 1] = orxCHAR_NULL;
+  }
+  else
+  {
+    /* Stores value */
+    orxMemory_Copy(&(pstEntry->stValue), _pstResult, sizeof(orxCOMMAND_VAR));
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Processes a command line
+ * @param[in]   _zCommandLine   Command line (modified during processing, restored afterward)
+ * @param[in]   _u32Offset      Offset of the first command to process
+ * @param[in]   _u64GUID        GUID to use in place of the GUID markers
+ * @param[out]  _pstResult      Variable that will contain the result
+ * @param[in]   _pstLastResult  Result of the commands processed before the offset, orxNULL if none
+ * @param[in]   _bSilent        Don't log unknown commands
+ * @return      Command result if found, orxNULL otherwise
+ */
+static orxCOMMAND_VAR *orxFASTCALL orxCommand_Process(const orxSTRING _zCommandLine, orxU32 _u32Offset, const orxU64 _u64GUID, orxCOMMAND_VAR *_pstResult, orxCOMMAND_VAR *_pstLastResult, orxBOOL _bSilent)
+{
+  const orxSTRING zCommand;
+  orxBOOL         bProcessed = orxFALSE;
+  orxCOMMAND_VAR *pstResult = _pstLastResult;
+
+  /* Profiles */
+  orxPROFILER_PUSH_MARKER("orxCommand_Process");
+
+  /* Gets start of command */
+  zCommand = orxString_SkipWhiteSpaces(_zCommandLine + _u32Offset);
+
+  /* For all commands */
+  while(*zCommand != orxCHAR_NULL)
+  {
+    orxU32          u32PushCount;
+    const orxCHAR  *pcCommandEnd;
+    orxCOMMAND     *pstCommand;
+    orxCHAR         cBackupChar;
+
+    /* Updates status */
+    bProcessed = orxTRUE;
+
+    /* For all push markers / spaces */
+    for(u32PushCount = 0; (*zCommand == orxCOMMAND_KC_PUSH_MARKER) || (orxCommand_IsWhiteSpace(*zCommand) != orxFALSE); zCommand++)
+    {
+      /* Is a push marker? */
+      if(*zCommand == orxCOMMAND_KC_PUSH_MARKER)
+      {
+        /* Updates push count */
+        u32PushCount++;
+      }
+    }
+
+    /* Finds end of command */
+    for(pcCommandEnd = zCommand + 1; (*pcCommandEnd != orxCHAR_NULL) && (orxCommand_IsWhiteSpace(*pcCommandEnd) == orxFALSE) && (*pcCommandEnd != orxCHAR_CR) && (*pcCommandEnd != orxCHAR_LF) && (*pcCommandEnd != orxCOMMAND_KC_SEPARATOR); pcCommandEnd++)
+      ;
+
+    /* Ends command */
+    cBackupChar               = *pcCommandEnd;
+    *(orxCHAR *)pcCommandEnd  = orxCHAR_NULL;
+
+    /* Gets it */
+    pstCommand = orxCommand_FindNoAlias(zCommand);
+
+    /* Found? */
+    if(pstCommand != orxNULL)
+    {
+      orxSTATUS             eStatus;
+      orxS32                s32GUIDLength, s32BufferCount;
+      const orxCHAR        *pcSrc;
+      const orxSTRING       azBufferList[orxCOMMAND_KU32_ALIAS_MAX_DEPTH];
+      orxU32                u32ArgNumber, u32ParamNumber = (orxU32)pstCommand->u16RequiredParamNumber + (orxU32)pstCommand->u16OptionalParamNumber;
+      orxCHAR               acGUID[20];
+
+#ifdef __orxMSVC__
+
+      orxCOMMAND_VAR *astArgList = (orxCOMMAND_VAR *)alloca(u32ParamNumber * sizeof(orxCOMMAND_VAR));
+
+#else /* __orxMSVC__ */
+
+      orxCOMMAND_VAR astArgList[u32ParamNumber];
+
+#endif /* __orxMSVC__ */
+
+      /* Is GUID valid? */
+      if(_u64GUID != orxU64_UNDEFINED)
+      {
+        /* Gets owner's GUID */
+        acGUID[19]    = orxCHAR_NULL;
+        s32GUIDLength = orxString_NPrint(acGUID, 19, "0x%016llX", _u64GUID);
+      }
+      else
+      {
+        /* No GUID */
+        s32GUIDLength = 0;
+      }
+
+      /* Adds argument buffers */
+      s32BufferCount = orxCommand_GetBufferList(zCommand, pcCommandEnd, azBufferList);
+
+      /* Restores command end */
+      *(orxCHAR *)pcCommandEnd = cBackupChar;
+
+      /* Expands arguments */
+      pcSrc = orxCommand_ExpandArgs(_zCommandLine, azBufferList, s32BufferCount, acGUID, s32GUIDLength, orxNULL);
+
+      /* Updates next command expression */
+      zCommand = orxString_SkipWhiteSpaces(pcSrc);
+
+      /* Parses arguments */
+      eStatus = orxCommand_ParseArgs(pstCommand, astArgList, &u32ArgNumber, orxNULL);
+
+      /* Error? */
+      if((eStatus == orxSTATUS_FAILURE) || (u32ArgNumber < (orxU32)pstCommand->u16RequiredParamNumber))
+      {
+        /* Incorrect parameter? */
+        if(eStatus == orxSTATUS_FAILURE)
+        {
+          /* Logs message */
+          orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Can't evaluate command line [%s], invalid argument #%d.", _zCommandLine, u32ArgNumber);
+        }
+        else
+        {
+          /* Logs message */
+          orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Can't evaluate command line [%s], expected %d[+%d] arguments, found %d.", _zCommandLine, (orxU32)pstCommand->u16RequiredParamNumber, (orxU32)pstCommand->u16OptionalParamNumber, u32ArgNumber);
+        }
+      }
+      else
+      {
+        /* Runs it */
+        pstResult = orxCommand_Run(pstCommand, orxFALSE, u32ArgNumber, astArgList, _pstResult);
+      }
+    }
+    else
+    {
+      /* Restores command end */
+      *(orxCHAR *)pcCommandEnd = cBackupChar;
+
+      /* Not silent? */
+      if(_bSilent == orxFALSE)
+      {
+        /* Logs message */
+        orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Can't evaluate command line [%s]: [%s] is not a registered command.", _zCommandLine, zCommand);
+      }
+
+      /* Stops */
+      zCommand = orxSTRING_EMPTY;
+    }
+
+    /* Failure? */
+    if(pstResult == orxNULL)
+    {
+      /* Stores error */
+      _pstResult->eType   = orxCOMMAND_VAR_TYPE_STRING;
+      _pstResult->zValue  = orxCOMMAND_KZ_ERROR_VALUE;
+    }
+
+    /* For all requested pushes */
+    for(; u32PushCount > 0; u32PushCount--)
+    {
+      /* Pushes result */
+      orxCommand_PushResult(_pstResult);
+    }
+  }
+
+  /* Unprocessed? */
+  if(bProcessed == orxFALSE)
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Can't evaluate command line [%s]: [%s] is not a registered command.", _zCommandLine, zCommand);
+  }
+
+  /* Profiles */
+  orxPROFILER_POP_MARKER();
+
+  /* Done! */
+  return pstResult;
+}
+
+/** Compiles a command line
+ * @param[in]   _zCommandLine   Command line
+ * @return      orxCOMMAND_PROGRAM / orxNULL if the command line is too long
+ */
+static orxCOMMAND_PROGRAM *orxFASTCALL orxCommand_Compile(const orxSTRING _zCommandLine)
+{
+  orxU32              u32Length;
+  orxCOMMAND_PROGRAM *pstResult = orxNULL;
+
+  /* Gets command line length */
+  u32Length = orxString_GetLength(_zCommandLine);
+
+  /* Fits in the compile buffer? */
+  if(u32Length < orxCOMMAND_KU32_COMPILE_BUFFER_SIZE)
+  {
+    const orxSTRING zCommand;
+    orxU32          u32InstructionNumber = 0, u32ArgNumber = 0, u32TextSize, u32TailOffset = orxU32_UNDEFINED, u32Size;
+
+    /* Copies command line, it'll be the start of the program's text */
+    orxMemory_Copy(sstCommand.acCompileBuffer, _zCommandLine, (u32Length + 1) * sizeof(orxCHAR));
+    u32TextSize = u32Length + 1;
+
+    /* For all commands */
+    for(zCommand = orxString_SkipWhiteSpaces(sstCommand.acCompileBuffer); *zCommand != orxCHAR_NULL;)
+    {
+      const orxSTRING zSegment;
+      orxU32          u32PushCount;
+      const orxCHAR  *pcCommandEnd;
+      orxCOMMAND     *pstCommand;
+      orxCHAR         cBackupChar;
+      orxBOOL         bCompiled = orxFALSE;
+
+      /* Stores segment start */
+      zSegment = zCommand;
+
+      /* For all push markers / spaces */
+      for(u32PushCount = 0; (*zCommand == orxCOMMAND_KC_PUSH_MARKER) || (orxCommand_IsWhiteSpace(*zCommand) != orxFALSE); zCommand++)
+      {
+        /* Is a push marker? */
+        if(*zCommand == orxCOMMAND_KC_PUSH_MARKER)
+        {
+          /* Updates push count */
+          u32PushCount++;
+        }
+      }
+
+      /* Finds end of command */
+      for(pcCommandEnd = zCommand + 1; (*pcCommandEnd != orxCHAR_NULL) && (orxCommand_IsWhiteSpace(*pcCommandEnd) == orxFALSE) && (*pcCommandEnd != orxCHAR_CR) && (*pcCommandEnd != orxCHAR_LF) && (*pcCommandEnd != orxCOMMAND_KC_SEPARATOR); pcCommandEnd++)
+        ;
+
+      /* Ends command */
+      cBackupChar               = *pcCommandEnd;
+      *(orxCHAR *)pcCommandEnd  = orxCHAR_NULL;
+
+      /* Gets it */
+      pstCommand = orxCommand_FindNoAlias(zCommand);
+
+      /* Found and has room for it? */
+      if((pstCommand != orxNULL)
+      && (u32InstructionNumber < orxCOMMAND_KU32_COMPILE_INSTRUCTION_NUMBER)
+      && (u32PushCount <= 0xFFFF)
+      && (u32ArgNumber + (orxU32)pstCommand->u16RequiredParamNumber + (orxU32)pstCommand->u16OptionalParamNumber <= orxCOMMAND_KU32_COMPILE_ARG_NUMBER))
+      {
+        orxCOMMAND_COMPILE_INFO stCompileInfo;
+        orxSTATUS               eStatus;
+        orxS32                  s32BufferCount;
+        const orxCHAR          *pcSrc;
+        const orxSTRING         azBufferList[orxCOMMAND_KU32_ALIAS_MAX_DEPTH];
+        orxU32                  u32CommandArgNumber, u32ParamNumber = (orxU32)pstCommand->u16RequiredParamNumber + (orxU32)pstCommand->u16OptionalParamNumber;
+
+#ifdef __orxMSVC__
+
+        orxCOMMAND_VAR *astArgList = (orxCOMMAND_VAR *)alloca(u32ParamNumber * sizeof(orxCOMMAND_VAR));
+
+#else /* __orxMSVC__ */
+
+        orxCOMMAND_VAR astArgList[u32ParamNumber];
+
+#endif /* __orxMSVC__ */
+
+        /* Adds argument buffers */
+        s32BufferCount = orxCommand_GetBufferList(zCommand, pcCommandEnd, azBufferList);
+
+        /* Restores command end */
+        *(orxCHAR *)pcCommandEnd = cBackupChar;
+
+        /* Inits compile info */
+        orxMemory_Zero(&stCompileInfo, sizeof(orxCOMMAND_COMPILE_INFO));
+        orxMemory_Zero(sstCommand.au8CompileSourceList, u32ParamNumber * sizeof(orxU8));
+        stCompileInfo.au8SourceList = sstCommand.au8CompileSourceList;
+        stCompileInfo.bIsValid      = orxTRUE;
+
+        /* Expands arguments, replacing GUID & pop markers with tokens */
+        pcSrc = orxCommand_ExpandArgs(_zCommandLine, azBufferList, s32BufferCount, orxSTRING_EMPTY, 0, &stCompileInfo);
+
+        /* Parses arguments */
+        eStatus = orxCommand_ParseArgs(pstCommand, astArgList, &u32CommandArgNumber, &stCompileInfo);
+
+        /* Valid and all GUID/pop markers are whole arguments? */
+        if((eStatus != orxSTATUS_FAILURE)
+        && (u32CommandArgNumber >= (orxU32)pstCommand->u16RequiredParamNumber)
+        && (stCompileInfo.bIsValid != orxFALSE)
+        && (stCompileInfo.u32MarkerCount == stCompileInfo.u32TokenCount))
+        {
+          orxU32 i;
+
+          /* For all arguments */
+          for(i = 0, bCompiled = orxTRUE; i < u32CommandArgNumber; i++)
+          {
+            orxCOMMAND_COMPILED_ARG *pstArg;
+
+            /* Gets compiled argument */
+            pstArg = &(sstCommand.astCompileArgList[u32ArgNumber + i]);
+
+            /* Stores it */
+            orxMemory_Copy(&(pstArg->stValue), &(astArgList[i]), sizeof(orxCOMMAND_VAR));
+            pstArg->u32Source = (orxU32)sstCommand.au8CompileSourceList[i];
+
+            /* Is a string literal? */
+            if((pstArg->u32Source == orxCOMMAND_ARG_SOURCE_LITERAL)
+            && ((pstArg->stValue.eType == orxCOMMAND_VAR_TYPE_STRING)
+             || (pstArg->stValue.eType == orxCOMMAND_VAR_TYPE_NUMERIC)))
+            {
+              orxU32 u32ValueLength;
+
+              /* Gets its length */
+              u32ValueLength = orxString_GetLength(astArgList[i].zValue);
+
+              /* Has room for it? */
+              if(u32TextSize + u32ValueLength < orxCOMMAND_KU32_COMPILE_BUFFER_SIZE)
+              {
+                /* Copies it to the text */
+                orxMemory_Copy(sstCommand.acCompileBuffer + u32TextSize, astArgList[i].zValue, (u32ValueLength + 1) * sizeof(orxCHAR));
+
+                /* Stores its offset */
+                pstArg->stValue.u32Value = u32TextSize;
+
+                /* Updates text size */
+                u32TextSize += u32ValueLength + 1;
+              }
+              else
+              {
+                /* Can't compile it */
+                bCompiled = orxFALSE;
+                break;
+              }
             }
+          }
+
+          /* Compiled? */
+          if(bCompiled != orxFALSE)
+          {
+            orxCOMMAND_INSTRUCTION *pstInstruction;
+
+            /* Stores instruction */
+            pstInstruction                  = &(sstCommand.astCompileInstructionList[u32InstructionNumber++]);
+            pstInstruction->pstCommand      = pstCommand;
+            pstInstruction->u32ArgIndex     = u32ArgNumber;
+            pstInstruction->u32SourceOffset = (orxU32)(zSegment - sstCommand.acCompileBuffer);
+            pstInstruction->u16ArgNumber    = (orxU16)u32CommandArgNumber;
+            pstInstruction->u16PushCount    = (orxU16)u32PushCount;
+
+            /* Updates argument number */
+            u32ArgNumber += u32CommandArgNumber;
+
+            /* Updates next command expression */
+            zCommand = orxString_SkipWhiteSpaces(pcSrc);
+          }
+        }
+      }
+      else
+      {
+        /* Restores command end */
+        *(orxCHAR *)pcCommandEnd = cBackupChar;
+      }
+
+      /* Not compiled? */
+      if(bCompiled == orxFALSE)
+      {
+        /* Processes the rest of the command line as text */
+        u32TailOffset = (orxU32)(zSegment - sstCommand.acCompileBuffer);
+        break;
+      }
+    }
+
+    /* Empty command line? */
+    if((u32InstructionNumber == 0) && (u32TailOffset == orxU32_UNDEFINED))
+    {
+      /* Processes it as text */
+      u32TailOffset = 0;
+    }
+
+    /* Gets program size */
+    u32Size = sizeof(orxCOMMAND_PROGRAM) + u32InstructionNumber * sizeof(orxCOMMAND_INSTRUCTION) + u32ArgNumber * sizeof(orxCOMMAND_COMPILED_ARG) + u32TextSize * sizeof(orxCHAR);
+
+    /* Allocates it */
+    pstResult = (orxCOMMAND_PROGRAM *)orxMemory_Allocate(u32Size, orxMEMORY_TYPE_MAIN);
+
+    /* Success? */
+    if(pstResult != orxNULL)
+    {
+      orxU8 *pu8Data;
+
+      /* Inits it */
+      pstResult->u32InstructionNumber = u32InstructionNumber;
+      pstResult->u32ArgNumber         = u32ArgNumber;
+      pstResult->u32TextOffset        = u32Size - u32TextSize * sizeof(orxCHAR);
+      pstResult->u32TailOffset        = u32TailOffset;
+
+      /* Copies instructions, arguments & text */
+      pu8Data = (orxU8 *)(pstResult + 1);
+      orxMemory_Copy(pu8Data, sstCommand.astCompileInstructionList, u32InstructionNumber * sizeof(orxCOMMAND_INSTRUCTION));
+      pu8Data += u32InstructionNumber * sizeof(orxCOMMAND_INSTRUCTION);
+      orxMemory_Copy(pu8Data, sstCommand.astCompileArgList, u32ArgNumber * sizeof(orxCOMMAND_COMPILED_ARG));
+      pu8Data += u32ArgNumber * sizeof(orxCOMMAND_COMPILED_ARG);
+      orxMemory_Copy(pu8Data, sstCommand.acCompileBuffer, u32TextSize * sizeof(orxCHAR));
+    }
+    else
+    {
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Can't allocate memory for compiling command line [%s].", _zCommandLine);
+    }
+  }
+
+  /* Done! */
+  return pstResult;
+}
+
+/** Gets a compiled GUID/pop argument's value
+ */
+static orxINLINE orxSTATUS orxCommand_GetDynamicArg(const orxSTRING _zCommandLine, orxU32 _u32Source, orxU64 _u64GUID, orxCHAR *_acBuffer, orxU32 _u32Size, orxCOMMAND_VAR *_pstArg)
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Pop? */
+  if(_u32Source == orxCOMMAND_ARG_SOURCE_POP)
+  {
+    /* Valid? */
+    if(orxBank_GetCount(sstCommand.pstResultBank) > 0)
+    {
+      orxCOMMAND_STACK_ENTRY *pstEntry;
+
+      /* Gets last stack entry */
+      pstEntry = (orxCOMMAND_STACK_ENTRY *)orxBank_GetAtIndex(sstCommand.pstResultBank, orxBank_GetCount(sstCommand.pstResultBank) - 1);
+
+      /* Is a string? */
+      if(pstEntry->stValue.eType == orxCOMMAND_VAR_TYPE_STRING)
+      {
+        /* Copies it */
+        orxString_NCopy(_acBuffer, pstEntry->stValue.zValue, _u32Size - 1);
+        _acBuffer[_u32Size - 1] = orxCHAR_NULL;
+      }
+      else
+      {
+        /* Prints it */
+        orxCommand_PrintVar(_acBuffer, _u32Size - 1, &(pstEntry->stValue));
+        _acBuffer[_u32Size - 1] = orxCHAR_NULL;
+      }
+
+      /* Deletes stack entry */
+      orxBank_Free(sstCommand.pstResultBank, pstEntry);
+    }
+    else
+    {
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Can't pop stacked argument for command line [%s]: stack is empty.", _zCommandLine);
+
+      /* Uses stack error */
+      orxString_NCopy(_acBuffer, orxCOMMAND_KZ_STACK_ERROR_VALUE, _u32Size - 1);
+      _acBuffer[_u32Size - 1] = orxCHAR_NULL;
+    }
+  }
+  else
+  {
+    /* Checks */
+    orxASSERT(_u32Source == orxCOMMAND_ARG_SOURCE_GUID);
+
+    /* Has valid GUID? */
+    if(_u64GUID != orxU64_UNDEFINED)
+    {
+      /* Prints it */
+      orxString_NPrint(_acBuffer, _u32Size - 1, "0x%016llX", _u64GUID);
+    }
+    else
+    {
+      /* Keeps marker */
+      _acBuffer[0] = orxCOMMAND_KC_GUID_MARKER;
+      _acBuffer[1] = orxCHAR_NULL;
+    }
+  }
+
+  /* Depending on type */
+  switch(_pstArg->eType)
+  {
+    case orxCOMMAND_VAR_TYPE_NUMERIC:
+    {
+      /* Stores value, empty values use default */
+      _pstArg->zValue = (*_acBuffer != orxCHAR_NULL) ? _acBuffer : "0";
+
+      break;
+    }
+
+    default:
+    case orxCOMMAND_VAR_TYPE_STRING:
+    {
+      /* Stores value */
+      _pstArg->zValue = _acBuffer;
+
+      break;
+    }
+
+#define orxCOMMAND_DECLARE_DYNAMIC_ARG(TYPE, FIELD, FUNCTION, DEFAULT)   \
+    case orxCOMMAND_VAR_TYPE_##TYPE:                                     \
+    {                                                                    \
+      if(*_acBuffer == orxCHAR_NULL)                                     \
+      {                                                                  \
+        _pstArg->FIELD = DEFAULT;                                        \
+      }                                                                  \
+      else                                                               \
+      {                                                                  \
+        eResult = FUNCTION(_acBuffer, &(_pstArg->FIELD), orxNULL);       \
+      }                                                                  \
+      break;                                                             \
+    }
+
+    orxCOMMAND_DECLARE_DYNAMIC_ARG(FLOAT, fValue, orxString_ToFloat, orxFLOAT_0);
+    orxCOMMAND_DECLARE_DYNAMIC_ARG(S32, s32Value, orxString_ToS32, 0);
+    orxCOMMAND_DECLARE_DYNAMIC_ARG(U32, u32Value, orxString_ToU32, 0);
+    orxCOMMAND_DECLARE_DYNAMIC_ARG(S64, s64Value, orxString_ToS64, 0);
+    orxCOMMAND_DECLARE_DYNAMIC_ARG(U64, u64Value, orxString_ToU64, 0);
+    orxCOMMAND_DECLARE_DYNAMIC_ARG(BOOL, bValue, orxString_ToBool, orxFALSE);
+
+#undef orxCOMMAND_DECLARE_DYNAMIC_ARG
+
+    case orxCOMMAND_VAR_TYPE_VECTOR:
+    {
+      /* Empty? */
+      if(*_acBuffer == orxCHAR_NULL)
+      {
+        /* Uses default value */
+        orxVector_Copy(&(_pstArg->vValue), &orxVECTOR_0);
+      }
+      else
+      {
+        /* Gets its value */
+        eResult = orxString_ToVector(_acBuffer, &(_pstArg->vValue), orxNULL);
+      }
+
+      break;
+    }
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Runs a compiled program
+ * @param[in]   _pstProgram     Program to run
+ * @param[in]   _u64GUID        GUID to use in place of the GUID markers
+ * @param[out]  _pstResult      Variable that will contain the result
+ * @param[in]   _bSilent        Don't log unknown commands
+ * @return      Command result if found, orxNULL otherwise
+ */
+static orxCOMMAND_VAR *orxFASTCALL orxCommand_RunProgram(orxCOMMAND_PROGRAM *_pstProgram, orxU64 _u64GUID, orxCOMMAND_VAR *_pstResult, orxBOOL _bSilent)
+{
+  const orxCOMMAND_INSTRUCTION   *astInstructionList;
+  const orxCOMMAND_COMPILED_ARG  *astCompiledArgList;
+  orxCHAR                        *acText;
+  orxU32                          u32TailOffset, i;
+  orxCOMMAND_VAR                 *pstResult = orxNULL;
+
+  /* Profiles */
+  orxPROFILER_PUSH_MARKER("orxCommand_RunProgram");
 
-            case orxCOMMAND_VAR_TYPE_FLOAT:
-            {
-              /* Should use default? */
-              if(bUseDefault != orxFALSE)
-              {
-                /* Uses default value */
-                astArgList[u32ArgNumber].fValue = orxFLOAT_0;
-              }
-              else
-              {
-                /* Gets its value */
-                eStatus = orxString_ToFloat(zArg, &(astArgList[u32ArgNumber].fValue), &pcSrc);
-              }
+  /* Gets instructions, arguments & text */
+  astInstructionList  = (const orxCOMMAND_INSTRUCTION *)(_pstProgram + 1);
+  astCompiledArgList  = (const orxCOMMAND_COMPILED_ARG *)(astInstructionList + _pstProgram->u32InstructionNumber);
+  acText              = (orxCHAR *)_pstProgram + _pstProgram->u32TextOffset;
 
-              break;
-            }
+  /* Updates program depth */
+  sstCommand.u32ProgramDepth++;
 
-            case orxCOMMAND_VAR_TYPE_S32:
-            {
-              /* Should use default? */
-              if(bUseDefault != orxFALSE)
-              {
-                /* Uses default value */
-                astArgList[u32ArgNumber].s32Value = 0;
-              }
-              else
-              {
-                /* Gets its value */
-                eStatus = orxString_ToS32(zArg, &(astArgList[u32ArgNumber].s32Value), &pcSrc);
-              }
+  /* For all instructions */
+  for(i = 0, u32TailOffset = _pstProgram->u32TailOffset; i < _pstProgram->u32InstructionNumber; i++)
+  {
+    const orxCOMMAND_INSTRUCTION *pstInstruction;
 
-              break;
-            }
+    /* Gets instruction */
+    pstInstruction = &(astInstructionList[i]);
 
-            case orxCOMMAND_VAR_TYPE_U32:
-            {
-              /* Should use default? */
-              if(bUseDefault != orxFALSE)
-              {
-                /* Uses default value */
-                astArgList[u32ArgNumber].u32Value = 0;
-              }
-              else
-              {
-                /* Gets its value */
-                eStatus = orxString_ToU32(zArg, &(astArgList[u32ArgNumber].u32Value), &pcSrc);
-              }
+    /* Programs have been invalidated? */
+    if(orxFLAG_TEST(sstCommand.u32Flags, orxCOMMAND_KU32_STATIC_FLAG_CLEAR_PROGRAMS))
+    {
+      /* Processes the rest of the command line as text */
+      u32TailOffset = pstInstruction->u32SourceOffset;
+      break;
+    }
+    else
+    {
+      orxSTATUS eStatus = orxSTATUS_SUCCESS;
+      orxCHAR  *pcBuffer;
+      orxU32    u32PushCount, j;
 
-              break;
-            }
+#ifdef __orxMSVC__
 
-            case orxCOMMAND_VAR_TYPE_S64:
-            {
-              /* Should use default? */
-              if(bUseDefault != orxFALSE)
-              {
-                /* Uses default value */
-                astArgList[u32ArgNumber].s64Value = 0;
-              }
-              else
-              {
-                /* Gets its value */
-                eStatus = orxString_ToS64(zArg, &(astArgList[u32ArgNumber].s64Value), &pcSrc);
-              }
+      orxCOMMAND_VAR *astArgList = (orxCOMMAND_VAR *)alloca((orxU32)pstInstruction->u16ArgNumber * sizeof(orxCOMMAND_VAR));
 
-              break;
-            }
+#else /* __orxMSVC__ */
 
-            case orxCOMMAND_VAR_TYPE_U64:
-            {
-              /* Should use default? */
-              if(bUseDefault != orxFALSE)
-              {
-                /* Uses default value */
-                astArgList[u32ArgNumber].u64Value = 0;
-              }
-              else
-              {
-                /* Gets its value */
-                eStatus = orxString_ToU64(zArg, &(astArgList[u32ArgNumber].u64Value), &pcSrc);
-              }
+      orxCOMMAND_VAR astArgList[pstInstruction->u16ArgNumber];
 
-              break;
-            }
+#endif /* __orxMSVC__ */
 
-            case orxCOMMAND_VAR_TYPE_BOOL:
-            {
-              /* Should use default? */
-              if(bUseDefault != orxFALSE)
-              {
-                /* Uses default value */
-                astArgList[u32ArgNumber].bValue = orxFALSE;
-              }
-              else
-              {
-                /* Gets its value */
-                eStatus = orxString_ToBool(zArg, &(astArgList[u32ArgNumber].bValue), &pcSrc);
-              }
+      /* For all arguments */
+      for(j = 0, pcBuffer = sstCommand.acProcessBuffer; j < (orxU32)pstInstruction->u16ArgNumber; j++)
+      {
+        const orxCOMMAND_COMPILED_ARG *pstArg;
 
-              break;
-            }
+        /* Gets compiled argument */
+        pstArg = &(astCompiledArgList[pstInstruction->u32ArgIndex + j]);
 
-            case orxCOMMAND_VAR_TYPE_VECTOR:
-            {
-              /* Should use default? */
-              if(bUseDefault != orxFALSE)
-              {
-                /* Uses default value */
-                orxVector_Copy(&(astArgList[u32ArgNumber].vValue), &orxVECTOR_0);
-              }
-              else
-              {
-                /* Gets its value */
-                eStatus = orxString_ToVector(zArg, &(astArgList[u32ArgNumber].vValue), &pcSrc);
-              }
+        /* Copies its value */
+        orxMemory_Copy(&(astArgList[j]), &(pstArg->stValue), sizeof(orxCOMMAND_VAR));
 
-              break;
-            }
+        /* Literal? */
+        if(pstArg->u32Source == orxCOMMAND_ARG_SOURCE_LITERAL)
+        {
+          /* String? */
+          if((pstArg->stValue.eType == orxCOMMAND_VAR_TYPE_STRING)
+          || (pstArg->stValue.eType == orxCOMMAND_VAR_TYPE_NUMERIC))
+          {
+            /* Gets it from text */
+            astArgList[j].zValue = acText + pstArg->stValue.u32Value;
           }
+        }
+        else
+        {
+          orxU32 u32Size;
 
-          /* Interrupted? */
-          if((eStatus == orxSTATUS_FAILURE) || (*pcSrc == orxCHAR_NULL))
-          {
-            /* Updates argument count */
-            u32ArgNumber++;
+          /* Gets available size */
+          u32Size = orxCOMMAND_KU32_PROCESS_BUFFER_SIZE - (orxU32)(pcBuffer - sstCommand.acProcessBuffer);
 
-            /* Stops processing */
-            break;
+          /* Gets its value */
+          if((u32Size >= 2) && (orxCommand_GetDynamicArg(acText, pstArg->u32Source, _u64GUID, pcBuffer, u32Size, &(astArgList[j])) != orxSTATUS_FAILURE))
+          {
+            /* Updates buffer */
+            pcBuffer += orxString_GetLength(pcBuffer) + 1;
           }
           else
           {
-            /* Ends current argument */
-            *(orxCHAR *)pcSrc = orxCHAR_NULL;
+            /* Logs message */
+            orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Can't evaluate command line [%s], invalid argument #%d.", acText, j + 1);
+
+            /* Updates status */
+            eStatus = orxSTATUS_FAILURE;
           }
         }
-        else
-        {
-          /* Stops */
-          break;
-        }
       }
 
-      /* Error? */
-      if((eStatus == orxSTATUS_FAILURE) || (u32ArgNumber < (orxU32)pstCommand->u16RequiredParamNumber))
-      {
-        /* Incorrect parameter? */
-        if(eStatus == orxSTATUS_FAILURE)
-        {
-          /* Logs message */
-          orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Can't evaluate command line [%s], invalid argument #%d.", _zCommandLine, u32ArgNumber);
-        }
-        else
-        {
-          /* Logs message */
-          orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Can't evaluate command line [%s], expected %d[+%d] arguments, found %d.", _zCommandLine, (orxU32)pstCommand->u16RequiredParamNumber, (orxU32)pstCommand->u16OptionalParamNumber, u32ArgNumber);
-        }
-      }
-      else
+      /* Success? */
+      if(eStatus != orxSTATUS_FAILURE)
       {
         /* Runs it */
-        pstResult = orxCommand_Run(pstCommand, orxFALSE, u32ArgNumber, astArgList, _pstResult);
+        pstResult = orxCommand_Run(pstInstruction->pstCommand, orxFALSE, (orxU32)pstInstruction->u16ArgNumber, astArgList, _pstResult);
       }
-    }
-    else
-    {
-      /* Restores command end */
-      *(orxCHAR *)pcCommandEnd = cBackupChar;
 
-      /* Not silent? */
-      if(_bSilent == orxFALSE)
+      /* Failure? */
+      if(pstResult == orxNULL)
       {
-        /* Logs message */
-        orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Can't evaluate command line [%s]: [%s] is not a registered command.", _zCommandLine, zCommand);
+        /* Stores error */
+        _pstResult->eType   = orxCOMMAND_VAR_TYPE_STRING;
+        _pstResult->zValue  = orxCOMMAND_KZ_ERROR_VALUE;
       }
 
-      /* Stops */
-      zCommand = orxSTRING_EMPTY;
+      /* For all requested pushes */
+      for(u32PushCount = (orxU32)pstInstruction->u16PushCount; u32PushCount > 0; u32PushCount--)
+      {
+        /* Pushes result */
+        orxCommand_PushResult(_pstResult);
+      }
     }
+  }
 
-    /* Failure? */
-    if(pstResult == orxNULL)
-    {
-      /* Stores error */
-      _pstResult->eType   = orxCOMMAND_VAR_TYPE_STRING;
-      _pstResult->zValue  = orxCOMMAND_KZ_ERROR_VALUE;
-    }
+  /* Has uncompiled tail? */
+  if(u32TailOffset != orxU32_UNDEFINED)
+  {
+    /* Processes it */
+    pstResult = orxCommand_Process(acText, u32TailOffset, _u64GUID, _pstResult, pstResult, _bSilent);
+  }
 
-    /* For all requested pushes */
-    while(u32PushCount > 0)
-    {
-      orxCOMMAND_STACK_ENTRY *pstEntry;
+  /* Updates program depth */
+  sstCommand.u32ProgramDepth--;
 
-      /* Allocates stack entry */
-      pstEntry = (orxCOMMAND_STACK_ENTRY *)orxBank_Allocate(sstCommand.pstResultBank);
+  /* Profiles */
+  orxPROFILER_POP_MARKER();
 
-      /* Checks */
-      orxASSERT(pstEntry != orxNULL);
+  /* Done! */
+  return pstResult;
+}
 
-      /* Is a string or numeric value? */
-      if((_pstResult->eType == orxCOMMAND_VAR_TYPE_STRING)
-      || (_pstResult->eType == orxCOMMAND_VAR_TYPE_NUMERIC))
-      {
-        /* Checks */
-        orxASSERT(orxString_GetLength(_pstResult->zValue) < orxCOMMAND_KU32_STACK_ENTRY_BUFFER_SIZE);
+/** Clears all compiled programs (deferred till no program is running)
+ */
+static void orxFASTCALL orxCommand_ClearPrograms()
+{
+  /* No program running? */
+  if(sstCommand.u32ProgramDepth == 0)
+  {
+    /* Has programs? */
+    if(orxHashTable_GetCount(sstCommand.pstProgramTable) != 0)
+    {
+      orxHANDLE           hIterator;
+      orxCOMMAND_PROGRAM *pstProgram;
 
-        /* Duplicates it */
-        pstEntry->stValue.eType   = _pstResult->eType;
-        pstEntry->stValue.zValue  = pstEntry->acBuffer;
-        orxString_NCopy(pstEntry->acBuffer, _pstResult->zValue, orxCOMMAND_KU32_STACK_ENTRY_BUFFER_SIZE - 1);
-        pstEntry->acBuffer[orxCOMMAND_KU32_STACK_ENTRY_BUFFER_SIZE - 1] = orxCHAR_NULL;
-      }
-      else
+      /* For all programs */
+      for(hIterator = orxHashTable_GetNext(sstCommand.pstProgramTable, orxHANDLE_UNDEFINED, orxNULL, (void **)&pstProgram);
+          hIterator != orxHANDLE_UNDEFINED;
+          hIterator = orxHashTable_GetNext(sstCommand.pstProgramTable, hIterator, orxNULL, (void **)&pstProgram))
       {
-        /* Stores value */
-        orxMemory_Copy(&(pstEntry->stValue), _pstResult, sizeof(orxCOMMAND_VAR));
+        /* Deletes it */
+        orxMemory_Free(pstProgram);
       }
 
-      /* Updates push count */
-      u32PushCount--;
+      /* Clears table */
+      orxHashTable_Clear(sstCommand.pstProgramTable);
     }
+
+    /* Updates flags */
+    orxFLAG_SET(sstCommand.u32Flags, orxCOMMAND_KU32_STATIC_FLAG_NONE, orxCOMMAND_KU32_STATIC_FLAG_CLEAR_PROGRAMS);
+  }
+  else
+  {
+    /* Defers it */
+    orxFLAG_SET(sstCommand.u32Flags, orxCOMMAND_KU32_STATIC_FLAG_CLEAR_PROGRAMS, orxCOMMAND_KU32_STATIC_FLAG_NONE);
   }
 
-  /* Unprocessed? */
-  if(bProcessed == orxFALSE)
+  /* Done! */
+  return;
+}
+
+/** Evaluates a command line from a copy in the evaluate buffer
+ */
+static orxINLINE orxCOMMAND_VAR *orxCommand_EvaluateCopy(const orxSTRING _zCommandLine, orxU64 _u64GUID, orxCOMMAND_VAR *_pstResult, orxBOOL _bSilent)
+{
+  orxS32          s32Offset;
+  orxCOMMAND_VAR *pstResult;
+
+  /* Stores it in buffer */
+  s32Offset = orxString_NPrint(sstCommand.acEvaluateBuffer + sstCommand.s32EvaluateOffset, orxCOMMAND_KU32_EVALUATE_BUFFER_SIZE - sstCommand.s32EvaluateOffset - 1, "%s", _zCommandLine) + 1;
+  sstCommand.s32EvaluateOffset += s32Offset;
+
+  /* Processes it */
+  pstResult = orxCommand_Process(sstCommand.acEvaluateBuffer + sstCommand.s32EvaluateOffset - s32Offset, 0, _u64GUID, _pstResult, orxNULL, _bSilent);
+
+  /* Restores buffer offset */
+  sstCommand.s32EvaluateOffset -= s32Offset;
+
+  /* Done! */
+  return pstResult;
+}
+
+/** Evaluates a command line using its compiled program, compiling it first if needed
+ */
+static orxCOMMAND_VAR *orxFASTCALL orxCommand_EvaluateProgram(const orxSTRING _zCommandLine, orxU64 _u64GUID, orxCOMMAND_VAR *_pstResult, orxBOOL _bSilent)
+{
+  orxSTRINGID         stID;
+  orxCOMMAND_PROGRAM *pstProgram;
+  orxCOMMAND_VAR     *pstResult;
+
+  /* Has pending program clear? */
+  if(orxFLAG_TEST(sstCommand.u32Flags, orxCOMMAND_KU32_STATIC_FLAG_CLEAR_PROGRAMS))
   {
-    /* Logs message */
-    orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Can't evaluate command line [%s]: [%s] is not a registered command.", _zCommandLine, zCommand);
+    /* Clears programs */
+    orxCommand_ClearPrograms();
   }
 
-  /* Profiles */
-  orxPROFILER_POP_MARKER();
+  /* Gets command line ID */
+  stID = orxString_ToCRC(_zCommandLine);
+
+  /* Gets its program */
+  pstProgram = (orxCOMMAND_PROGRAM *)orxHashTable_Get(sstCommand.pstProgramTable, (orxU64)stID);
+
+  /* Not found? */
+  if(pstProgram == orxNULL)
+  {
+    /* Compiles it */
+    pstProgram = orxCommand_Compile(_zCommandLine);
+
+    /* Success? */
+    if(pstProgram != orxNULL)
+    {
+      /* Stores it */
+      orxHashTable_Add(sstCommand.pstProgramTable, (orxU64)stID, pstProgram);
+    }
+  }
+  /* ID collision? */
+  else if(orxString_Compare((const orxCHAR *)pstProgram + pstProgram->u32TextOffset, _zCommandLine) != 0)
+  {
+    /* Doesn't use it */
+    pstProgram = orxNULL;
+  }
+
+  /* Valid? */
+  if(pstProgram != orxNULL)
+  {
+    /* Runs it */
+    pstResult = orxCommand_RunProgram(pstProgram, _u64GUID, _pstResult, _bSilent);
+
+    /* Has pending program clear and no program running? */
+    if((sstCommand.u32ProgramDepth == 0) && (orxFLAG_TEST(sstCommand.u32Flags, orxCOMMAND_KU32_STATIC_FLAG_CLEAR_PROGRAMS)))
+    {
+      /* Clears programs */
+      orxCommand_ClearPrograms();
+    }
+  }
+  else
+  {
+    /* Evaluates it as text */
+    pstResult = orxCommand_EvaluateCopy(_zCommandLine, _u64GUID, _pstResult, _bSilent);
+  }
 
   /* Done! */
   return pstResult;
@@ -1173,7 +2004,7 @@ static orxSTATUS orxFASTCALL orxCommand_EventHandler(const orxEVENT *_pstEvent)
           pstPayload = (orxTIMELINE_EVENT_PAYLOAD *)_pstEvent->pstPayload;
 
           /* Processes command */
-          orxCommand_Process(pstPayload->zEvent, orxStructure_GetGUID(orxSTRUCTURE(_pstEvent->hSender)), &stResult, orxTRUE);
+          orxCommand_EvaluateProgram(pstPayload->zEvent, orxStructure_GetGUID(orxSTRUCTURE(_pstEvent->hSender)), &stResult, orxTRUE);
 
           break;
         }
@@ -1202,7 +2033,7 @@ static orxSTATUS orxFASTCALL orxCommand_EventHandler(const orxEVENT *_pstEvent)
           pstPayload = (orxANIM_EVENT_PAYLOAD *)_pstEvent->pstPayload;
 
           /* Processes command */
-          orxCommand_Process(pstPayload->stCustom.zName, orxStructure_GetGUID(orxSTRUCTURE(_pstEvent->hSender)), &stResult, orxTRUE);
+          orxCommand_EvaluateProgram(pstPayload->stCustom.zName, orxStructure_GetGUID(orxSTRUCTURE(_pstEvent->hSender)), &stResult, orxTRUE);
 
           break;
         }
@@ -2757,8 +3588,11 @@ orxSTATUS orxFASTCALL orxCommand_Init()
       sstCommand.pstTrieBank    = orxBank_Create(orxCOMMAND_KU32_TRIE_BANK_SIZE, sizeof(orxCOMMAND_TRIE_NODE), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
       sstCommand.pstResultBank  = orxBank_Create(orxCOMMAND_KU32_RESULT_BANK_SIZE, sizeof(orxCOMMAND_STACK_ENTRY), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
 
+      /* Creates program table */
+      sstCommand.pstProgramTable = orxHashTable_Create(orxCOMMAND_KU32_PROGRAM_TABLE_SIZE, orxHASHTABLE_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+
       /* Valid? */
-      if((sstCommand.pstBank != orxNULL) && (sstCommand.pstTrieBank != orxNULL) && (sstCommand.pstResultBank != orxNULL))
+      if((sstCommand.pstBank != orxNULL) && (sstCommand.pstTrieBank != orxNULL) && (sstCommand.pstResultBank != orxNULL) && (sstCommand.pstProgramTable != orxNULL))
       {
         orxCOMMAND_TRIE_NODE *pstTrieRoot;
 
@@ -2800,10 +3634,11 @@ orxSTATUS orxFASTCALL orxCommand_Init()
           orxEvent_RemoveHandler(orxEVENT_TYPE_TIMELINE, orxCommand_EventHandler);
           orxEvent_RemoveHandler(orxEVENT_TYPE_ANIM, orxCommand_EventHandler);
 
-          /* Deletes banks */
+          /* Deletes banks & program table */
           orxBank_Delete(sstCommand.pstBank);
           orxBank_Delete(sstCommand.pstTrieBank);
           orxBank_Delete(sstCommand.pstResultBank);
+          orxHashTable_Delete(sstCommand.pstProgramTable);
 
           /* Logs message */
           orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Failed to create command trie.");
@@ -2811,6 +3646,20 @@ orxSTATUS orxFASTCALL orxCommand_Init()
       }
       else
       {
+        /* Partly initialized? */
+        if(sstCommand.pstProgramTable != orxNULL)
+        {
+          /* Deletes program table */
+          orxHashTable_Delete(sstCommand.pstProgramTable);
+        }
+
+        /* Partly initialized? */
+        if(sstCommand.pstResultBank != orxNULL)
+        {
+          /* Deletes bank */
+          orxBank_Delete(sstCommand.pstResultBank);
+        }
+
         /* Partly initialized? */
         if(sstCommand.pstTrieBank != orxNULL)
         {
@@ -2866,13 +3715,17 @@ void orxFASTCALL orxCommand_Exit()
     /* Unregisters commands */
     orxCommand_UnregisterCommands();
 
+    /* Clears programs */
+    orxCommand_ClearPrograms();
+
     /* Clears trie */
     orxTree_Clean(&(sstCommand.stCommandTrie));
 
-    /* Deletes banks */
+    /* Deletes banks & program table */
     orxBank_Delete(sstCommand.pstBank);
     orxBank_Delete(sstCommand.pstTrieBank);
     orxBank_Delete(sstCommand.pstResultBank);
+    orxHashTable_Delete(sstCommand.pstProgramTable);
 
     /* Removes event handler */
     orxEvent_RemoveHandler(orxEVENT_TYPE_TIMELINE, orxCommand_EventHandler);
@@ -2967,6 +3820,13 @@ orxSTATUS orxFASTCALL orxCommand_Register(const orxSTRING _zCommand, const orxCO
     }
   }
 
+  /* Success? */
+  if(eResult != orxSTATUS_FAILURE)
+  {
+    /* Clears compiled programs */
+    orxCommand_ClearPrograms();
+  }
+
   /* Done! */
   return eResult;
 }
@@ -3013,6 +3873,13 @@ orxSTATUS orxFASTCALL orxCommand_Unregister(const orxSTRING _zCommand)
     }
   }
 
+  /* Success? */
+  if(eResult != orxSTATUS_FAILURE)
+  {
+    /* Clears compiled programs */
+    orxCommand_ClearPrograms();
+  }
+
   /* Done! */
   return eResult;
 }
@@ -3171,6 +4038,13 @@ orxSTATUS orxFASTCALL orxCommand_AddAlias(const orxSTRING _zAlias, const orxSTRI
     }
   }
 
+  /* Success? */
+  if(eResult != orxSTATUS_FAILURE)
+  {
+    /* Clears compiled programs */
+    orxCommand_ClearPrograms();
+  }
+
   /* Done! */
   return eResult;
 }
@@ -3232,6 +4106,13 @@ orxSTATUS orxFASTCALL orxCommand_RemoveAlias(const orxSTRING _zAlias)
     }
   }
 
+  /* Success? */
+  if(eResult != orxSTATUS_FAILURE)
+  {
+    /* Clears compiled programs */
+    orxCommand_ClearPrograms();
+  }
+
   /* Done! */
   return eResult;
 }
@@ -3541,17 +4422,55 @@ extern orxDLLAPI orxCOMMAND_VAR *orxFASTCALL orxCommand_EvaluateWithGUID(const o
   /* Valid? */
   if((_zCommandLine != orxNULL) && (_zCommandLine != orxSTRING_EMPTY))
   {
-    orxS32 s32Offset;
+    /* Processes it */
+    pstResult = orxCommand_EvaluateCopy(_zCommandLine, _u64GUID, _pstResult, orxFALSE);
+  }
 
-    /* Stores it in buffer */
-    s32Offset = orxString_NPrint(sstCommand.acEvaluateBuffer + sstCommand.s32EvaluateOffset, orxCOMMAND_KU32_EVALUATE_BUFFER_SIZE - sstCommand.s32EvaluateOffset - 1, "%s", _zCommandLine) + 1;
-    sstCommand.s32EvaluateOffset += s32Offset;
+  /* Done! */
+  return pstResult;
+}
 
-    /* Processes it */
-    pstResult = orxCommand_Process(sstCommand.acEvaluateBuffer + sstCommand.s32EvaluateOffset - s32Offset, _u64GUID, _pstResult, orxFALSE);
+/** Evaluates a command using its compiled form, compiling it on first use
+* @param[in]   _zCommandLine  Command name + arguments
+* @param[out]  _pstResult     Variable that will contain the result
+* @return      Command result if found, orxNULL otherwise
+*/
+orxCOMMAND_VAR *orxFASTCALL orxCommand_EvaluateCompiled(const orxSTRING _zCommandLine, orxCOMMAND_VAR *_pstResult)
+{
+  orxCOMMAND_VAR *pstResult;
+
+  /* Checks */
+  orxASSERT(orxFLAG_TEST(sstCommand.u32Flags, orxCOMMAND_KU32_STATIC_FLAG_READY));
+  orxASSERT(_zCommandLine != orxNULL);
+  orxASSERT(_pstResult != orxNULL);
+
+  /* Evaluates it */
+  pstResult = orxCommand_EvaluateCompiledWithGUID(_zCommandLine, orxU64_UNDEFINED, _pstResult);
+
+  /* Done! */
+  return pstResult;
+}
 
-    /* Restores buffer offset */
-    sstCommand.s32EvaluateOffset -= s32Offset;
+/** Evaluates a command with a specific GUID using its compiled form, compiling it on first use
+* @param[in]   _zCommandLine  Command name + arguments
+* @param[in]   _u64GUID       GUID to use in place of the GUID markers in the command
+* @param[out]  _pstResult     Variable that will contain the result
+* @return      Command result if found, orxNULL otherwise
+*/
+orxCOMMAND_VAR *orxFASTCALL orxCommand_EvaluateCompiledWithGUID(const orxSTRING _zCommandLine, orxU64 _u64GUID, orxCOMMAND_VAR *_pstResult)
+{
+  orxCOMMAND_VAR *pstResult = orxNULL;
+
+  /* Checks */
+  orxASSERT(orxFLAG_TEST(sstCommand.u32Flags, orxCOMMAND_KU32_STATIC_FLAG_READY));
+  orxASSERT(_zCommandLine != orxNULL);
+  orxASSERT(_pstResult != orxNULL);
+
+  /* Valid? */
+  if((_zCommandLine != orxNULL) && (_zCommandLine != orxSTRING_EMPTY))
+  {
+    /* Evaluates it */
+    pstResult = orxCommand_EvaluateProgram(_zCommandLine, _u64GUID, _pstResult, orxFALSE);
   }
 
   /* Done! */
@@ -92,6 +92,8 @@
 #define orxCONFIG_KU32_STACK_BANK_SIZE            32          /**< Default stack bank size */
 #define orxCONFIG_KU32_ENTRY_BANK_SIZE            16384       /**< Default entry bank size */
 #define orxCONFIG_KU32_HISTORY_BANK_SIZE          32          /**< Default history bank size */
+#define orxCONFIG_KU32_ENTRY_INDEX_THRESHOLD      8           /**< Minimum number of entries in a section before using an index */
+#define orxCONFIG_KU32_ENTRY_INDEX_MIN_SIZE       32          /**< Minimum entry index size (power of two) */
 #define orxCONFIG_KU32_BASE_FILENAME_LENGTH       256         /**< Base file name length */
 
 #define orxCONFIG_KU32_BUFFER_SIZE                16384       /**< Buffer size */
@@ -122,6 +124,10 @@
 #define orxCONFIG_KZ_UTF8_BOM                     "\xEF\xBB\xBF" /**< UTF-8 BOM */
 #define orxCONFIG_KU32_UTF8_BOM_LENGTH            3           /**< UTF-8 BOM length */
 
+#define orxCONFIG_KU32_SNAPSHOT_MAGIC             0x5358524F  /**< Snapshot magic number ("ORXS") */
+#define orxCONFIG_KU32_SNAPSHOT_VERSION           1           /**< Snapshot format version */
+#define orxCONFIG_KU32_SNAPSHOT_NO_DEFAULT_PARENT 0xFFFFFFFE  /**< Snapshot parent offset for 'no default parent' sections */
+
 #define orxCONFIG_KZ_CONFIG_MEMORY                "Memory"    /**< Memory buffer name */
 
 #if defined(__orxDEBUG__)
@@ -228,9 +234,56 @@ typedef struct __orxCONFIG_SECTION_t
   orxLINKLIST       stEntryList;            /**< Entry list : 32 */
   orxS32            s32ProtectionCount;     /**< Protection count : 36 */
   orxSTRINGID       stOriginID;             /**< Origin : 40 */
+  orxCONFIG_ENTRY **apstEntryIndex;         /**< Entry index (open addressing) : 44 */
+  orxU32            u32EntryIndexSize;      /**< Entry index size : 48 */
 
 } orxCONFIG_SECTION;
 
+/** Config snapshot header (all offsets are relative to the string pool)
+ */
+typedef struct __orxCONFIG_SNAPSHOT_HEADER_t
+{
+  orxU32            u32Magic;               /**< Magic number : 4 */
+  orxU32            u32Version;             /**< Format version : 8 */
+  orxU32            u32EntrySize;           /**< Size of an entry record : 12 */
+  orxU32            u32SectionCount;        /**< Number of sections : 16 */
+  orxU32            u32EntryCount;          /**< Number of entries : 20 */
+  orxU32            u32IndexCount;          /**< Number of list indices : 24 */
+  orxU32            u32StringPoolSize;      /**< String pool size : 28 */
+  orxU32            u32Size;                /**< Total image size : 32 */
+
+} orxCONFIG_SNAPSHOT_HEADER;
+
+/** Config snapshot section record
+ */
+typedef struct __orxCONFIG_SNAPSHOT_SECTION_t
+{
+  orxU32            u32NameOffset;          /**< Name : 4 */
+  orxU32            u32ParentOffset;        /**< Parent name / orxU32_UNDEFINED / orxCONFIG_KU32_SNAPSHOT_NO_DEFAULT_PARENT : 8 */
+  orxU32            u32OriginOffset;        /**< Origin / orxU32_UNDEFINED : 12 */
+  orxU32            u32EntryCount;          /**< Number of entries : 16 */
+
+} orxCONFIG_SNAPSHOT_SECTION;
+
+/** Config snapshot entry record (holds pre-parsed typed values)
+ */
+typedef struct __orxCONFIG_SNAPSHOT_ENTRY_t
+{
+  orxVECTOR         vValue;                 /**< Value : 12 */
+  orxVECTOR         vAltValue;              /**< Alternate value : 24 */
+  orxVECTOR         vStepValue;             /**< Step value : 36 */
+  orxU32            u32KeyOffset;           /**< Key : 40 */
+  orxU32            u32OriginOffset;        /**< Origin / orxU32_UNDEFINED : 44 */
+  orxU32            u32ValueOffset;         /**< Literal value : 48 */
+  orxU32            u32ValueSize;           /**< Literal value size, including all list items : 52 */
+  orxU32            u32IndexOffset;         /**< List index table / orxU32_UNDEFINED : 56 */
+  orxU16            u16Type;                /**< Value type : 58 */
+  orxU16            u16Flags;               /**< Status flags : 60 */
+  orxU16            u16ListCount;           /**< List count : 62 */
+  orxU16            u16CacheIndex;          /**< Cache index : 64 */
+
+} orxCONFIG_SNAPSHOT_ENTRY;
+
 /** Config stack entry structure
  */
 typedef struct __orxCONFIG_STACK_ENTRY_t
@@ -335,6 +388,119 @@ static orxINLINE void orxConfig_CleanValue(orxCONFIG_VALUE *_pstValue)
   return;
 }
 
+/** Deletes a section's entry index (it'll be rebuilt on next lookup)
+ * @param[in] _pstSection       Concerned section
+ */
+static orxINLINE void orxConfig_DeleteEntryIndex(orxCONFIG_SECTION *_pstSection)
+{
+  /* Has index? */
+  if(_pstSection->apstEntryIndex != orxNULL)
+  {
+    /* Deletes it */
+    orxMemory_Free(_pstSection->apstEntryIndex);
+    _pstSection->apstEntryIndex     = orxNULL;
+    _pstSection->u32EntryIndexSize  = 0;
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Inserts an entry in a section's entry index
+ * @param[in] _pstSection       Concerned section
+ * @param[in] _pstEntry         Entry to insert
+ */
+static orxINLINE void orxConfig_InsertEntryIndex(orxCONFIG_SECTION *_pstSection, orxCONFIG_ENTRY *_pstEntry)
+{
+  orxU32 u32Mask, i;
+
+  /* Checks */
+  orxASSERT(_pstSection->apstEntryIndex != orxNULL);
+
+  /* Gets mask */
+  u32Mask = _pstSection->u32EntryIndexSize - 1;
+
+  /* Finds first free slot */
+  for(i = (orxU32)_pstEntry->stID & u32Mask; _pstSection->apstEntryIndex[i] != orxNULL; i = (i + 1) & u32Mask);
+
+  /* Stores entry */
+  _pstSection->apstEntryIndex[i] = _pstEntry;
+
+  /* Done! */
+  return;
+}
+
+/** Builds a section's entry index, sized for its current entry count
+ * @param[in] _pstSection       Concerned section
+ * @return                      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+static orxSTATUS orxFASTCALL orxConfig_BuildEntryIndex(orxCONFIG_SECTION *_pstSection)
+{
+  orxCONFIG_ENTRY *pstEntry;
+  orxU32           u32Size;
+  orxSTATUS        eResult = orxSTATUS_FAILURE;
+
+  /* Deletes current index */
+  orxConfig_DeleteEntryIndex(_pstSection);
+
+  /* Gets size, starting with a load factor of at most 25% (grows past 50%) */
+  for(u32Size = orxCONFIG_KU32_ENTRY_INDEX_MIN_SIZE; u32Size < (orxLinkList_GetCount(&(_pstSection->stEntryList)) << 2); u32Size <<= 1);
+
+  /* Allocates index */
+  _pstSection->apstEntryIndex = (orxCONFIG_ENTRY **)orxMemory_Allocate(u32Size * sizeof(orxCONFIG_ENTRY *), orxMEMORY_TYPE_CONFIG);
+
+  /* Success? */
+  if(_pstSection->apstEntryIndex != orxNULL)
+  {
+    /* Clears it */
+    orxMemory_Zero(_pstSection->apstEntryIndex, u32Size * sizeof(orxCONFIG_ENTRY *));
+
+    /* Stores its size */
+    _pstSection->u32EntryIndexSize = u32Size;
+
+    /* For all entries */
+    for(pstEntry = (orxCONFIG_ENTRY *)orxLinkList_GetFirst(&(_pstSection->stEntryList));
+        pstEntry != orxNULL;
+        pstEntry = (orxCONFIG_ENTRY *)orxLinkList_GetNext(&(pstEntry->stNode)))
+    {
+      /* Inserts it */
+      orxConfig_InsertEntryIndex(_pstSection, pstEntry);
+    }
+
+    /* Updates result */
+    eResult = orxSTATUS_SUCCESS;
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Adds a newly linked entry to its section's entry index, if any
+ * @param[in] _pstSection       Concerned section
+ * @param[in] _pstEntry         Entry to add
+ */
+static orxINLINE void orxConfig_AddEntryIndex(orxCONFIG_SECTION *_pstSection, orxCONFIG_ENTRY *_pstEntry)
+{
+  /* Has index? */
+  if(_pstSection->apstEntryIndex != orxNULL)
+  {
+    /* Load factor still under 50%? */
+    if((orxLinkList_GetCount(&(_pstSection->stEntryList)) << 1) <= _pstSection->u32EntryIndexSize)
+    {
+      /* Inserts entry */
+      orxConfig_InsertEntryIndex(_pstSection, _pstEntry);
+    }
+    else
+    {
+      /* Grows index */
+      orxConfig_BuildEntryIndex(_pstSection);
+    }
+  }
+
+  /* Done! */
+  return;
+}
+
 /** Deletes an entry
  * @param[in] _pstEntry         Entry to delete
  */
@@ -346,6 +512,9 @@ static orxINLINE void orxConfig_DeleteEntry(orxCONFIG_ENTRY *_pstEntry)
   /* Deletes value */
   orxConfig_CleanValue(&(_pstEntry->stValue));
 
+  /* Invalidates its section's index */
+  orxConfig_DeleteEntryIndex(orxSTRUCT_GET_FROM_FIELD(orxCONFIG_SECTION, stEntryList, orxLinkList_GetList(&(_pstEntry->stNode))));
+
   /* Removes it from list */
   orxLinkList_Remove(&(_pstEntry->stNode));
 
@@ -355,6 +524,221 @@ static orxINLINE void orxConfig_DeleteEntry(orxCONFIG_ENTRY *_pstEntry)
   return;
 }
 
+/** Gets the size of a value's literal, including all its list items
+ * @param[in] _pstValue         Concerned config value
+ * @return                      Size of the literal, including the final null character
+ */
+static orxINLINE orxU32 orxConfig_GetLiteralSize(const orxCONFIG_VALUE *_pstValue)
+{
+  orxU32 u32Result;
+
+  /* Is a list? */
+  if(orxFLAG_TEST(_pstValue->u16Flags, orxCONFIG_VALUE_KU16_FLAG_LIST))
+  {
+    orxU32 u32LastIndex;
+
+    /* Gets last item's index */
+    u32LastIndex = _pstValue->au32ListIndexTable[_pstValue->u16ListCount - 2];
+
+    /* Updates result */
+    u32Result = u32LastIndex + orxString_GetLength(_pstValue->zValue + u32LastIndex) + 1;
+  }
+  else
+  {
+    /* Updates result */
+    u32Result = orxString_GetLength(_pstValue->zValue) + 1;
+  }
+
+  /* Done! */
+  return u32Result;
+}
+
+/** Adds a string to a snapshot string pool, sharing identical strings
+ * @param[in] _pcPool           String pool
+ * @param[in,out] _pu32PoolSize Current size of the string pool
+ * @param[in] _pstTable         Table of already added strings
+ * @param[in] _zString          String to add
+ * @return                      Offset of the string in the pool
+ */
+static orxU32 orxFASTCALL orxConfig_AddSnapshotString(orxCHAR *_pcPool, orxU32 *_pu32PoolSize, orxHASHTABLE *_pstTable, const orxSTRING _zString)
+{
+  orxU64  u64Key;
+  orxU32  u32Result;
+  void   *pOffset;
+
+  /* Gets key */
+  u64Key = (orxU64)orxString_ToCRC(_zString);
+
+  /* Already added? */
+  if((pOffset = orxHashTable_Get(_pstTable, u64Key)) != orxNULL)
+  {
+    /* Updates result */
+    u32Result = (orxU32)((size_t)pOffset - 1);
+  }
+  else
+  {
+    orxU32 u32Size;
+
+    /* Gets its size */
+    u32Size = orxString_GetLength(_zString) + 1;
+
+    /* Copies it */
+    orxMemory_Copy(_pcPool + *_pu32PoolSize, _zString, u32Size);
+
+    /* Updates result */
+    u32Result = *_pu32PoolSize;
+
+    /* Stores its offset */
+    orxHashTable_Add(_pstTable, u64Key, (void *)(size_t)(u32Result + 1));
+
+    /* Updates pool size */
+    *_pu32PoolSize += u32Size;
+  }
+
+  /* Done! */
+  return u32Result;
+}
+
+/** Checks a snapshot image: all counts, offsets and sizes have to stay within the image and all strings have to be null-terminated
+ * @param[in] _pu8Image         Snapshot image
+ * @param[in] _s64Size          Size of the image, in bytes
+ * @return orxSTATUS_SUCCESS if the image can be safely loaded / orxSTATUS_FAILURE otherwise
+ */
+static orxSTATUS orxFASTCALL orxConfig_CheckSnapshot(const orxU8 *_pu8Image, orxS64 _s64Size)
+{
+  const orxCONFIG_SNAPSHOT_HEADER *pstHeader;
+  orxSTATUS                        eResult = orxSTATUS_FAILURE;
+
+  /* Gets header */
+  pstHeader = (const orxCONFIG_SNAPSHOT_HEADER *)_pu8Image;
+
+  /* Valid header? */
+  if((_s64Size >= (orxS64)sizeof(orxCONFIG_SNAPSHOT_HEADER))
+  && (pstHeader->u32Magic == orxCONFIG_KU32_SNAPSHOT_MAGIC)
+  && (pstHeader->u32Version == orxCONFIG_KU32_SNAPSHOT_VERSION)
+  && (pstHeader->u32EntrySize == sizeof(orxCONFIG_SNAPSHOT_ENTRY))
+  && ((orxS64)pstHeader->u32Size == _s64Size)
+  && ((orxU64)sizeof(orxCONFIG_SNAPSHOT_HEADER)
+    + ((orxU64)pstHeader->u32SectionCount * (orxU64)sizeof(orxCONFIG_SNAPSHOT_SECTION))
+    + ((orxU64)pstHeader->u32EntryCount * (orxU64)sizeof(orxCONFIG_SNAPSHOT_ENTRY))
+    + ((orxU64)pstHeader->u32IndexCount * (orxU64)sizeof(orxU32))
+    + (orxU64)pstHeader->u32StringPoolSize == (orxU64)_s64Size))
+  {
+    const orxCONFIG_SNAPSHOT_SECTION *astSectionList;
+    const orxCONFIG_SNAPSHOT_ENTRY   *astEntryList;
+    const orxU32                     *au32IndexList;
+    const orxCHAR                    *pcPool;
+    orxU32                            u32PoolSize;
+
+    /* Gets all tables */
+    astSectionList  = (const orxCONFIG_SNAPSHOT_SECTION *)(_pu8Image + sizeof(orxCONFIG_SNAPSHOT_HEADER));
+    astEntryList    = (const orxCONFIG_SNAPSHOT_ENTRY *)(astSectionList + pstHeader->u32SectionCount);
+    au32IndexList   = (const orxU32 *)(astEntryList + pstHeader->u32EntryCount);
+    pcPool          = (const orxCHAR *)(au32IndexList + pstHeader->u32IndexCount);
+    u32PoolSize     = pstHeader->u32StringPoolSize;
+
+    /* Is string pool null-terminated (or empty with no records)? */
+    if(((u32PoolSize > 0) && (pcPool[u32PoolSize - 1] == orxCHAR_NULL))
+    || ((u32PoolSize == 0) && (pstHeader->u32SectionCount == 0) && (pstHeader->u32EntryCount == 0)))
+    {
+      orxU64 u64EntryCount;
+      orxU32 i;
+
+      /* Updates result */
+      eResult = orxSTATUS_SUCCESS;
+
+      /* For all sections */
+      for(i = 0, u64EntryCount = 0; (i < pstHeader->u32SectionCount) && (eResult != orxSTATUS_FAILURE); i++)
+      {
+        const orxCONFIG_SNAPSHOT_SECTION *pstSection;
+
+        /* Gets it */
+        pstSection = &(astSectionList[i]);
+
+        /* Invalid name, origin or parent? */
+        if((pstSection->u32NameOffset >= u32PoolSize)
+        || ((pstSection->u32OriginOffset != orxU32_UNDEFINED) && (pstSection->u32OriginOffset >= u32PoolSize))
+        || ((pstSection->u32ParentOffset != orxU32_UNDEFINED) && (pstSection->u32ParentOffset != orxCONFIG_KU32_SNAPSHOT_NO_DEFAULT_PARENT) && (pstSection->u32ParentOffset >= u32PoolSize)))
+        {
+          /* Updates result */
+          eResult = orxSTATUS_FAILURE;
+        }
+
+        /* Updates entry count */
+        u64EntryCount += (orxU64)pstSection->u32EntryCount;
+      }
+
+      /* Entry counts don't match? */
+      if(u64EntryCount != (orxU64)pstHeader->u32EntryCount)
+      {
+        /* Updates result */
+        eResult = orxSTATUS_FAILURE;
+      }
+
+      /* For all entries */
+      for(i = 0; (i < pstHeader->u32EntryCount) && (eResult != orxSTATUS_FAILURE); i++)
+      {
+        const orxCONFIG_SNAPSHOT_ENTRY *pstEntry;
+
+        /* Gets it */
+        pstEntry = &(astEntryList[i]);
+
+        /* Invalid key, origin, type, literal or cache index? */
+        if((pstEntry->u32KeyOffset >= u32PoolSize)
+        || ((pstEntry->u32OriginOffset != orxU32_UNDEFINED) && (pstEntry->u32OriginOffset >= u32PoolSize))
+        || ((pstEntry->u16Type >= (orxU16)orxCONFIG_VALUE_TYPE_NUMBER) && (pstEntry->u16Type != (orxU16)orxCONFIG_VALUE_TYPE_NONE))
+        || (pstEntry->u32ValueSize == 0)
+        || ((orxU64)pstEntry->u32ValueOffset + (orxU64)pstEntry->u32ValueSize > (orxU64)u32PoolSize)
+        || (pcPool[pstEntry->u32ValueOffset + pstEntry->u32ValueSize - 1] != orxCHAR_NULL)
+        || (pstEntry->u16ListCount == 0)
+        || (pstEntry->u16CacheIndex >= pstEntry->u16ListCount))
+        {
+          /* Updates result */
+          eResult = orxSTATUS_FAILURE;
+        }
+        /* List? */
+        else if(orxFLAG_TEST(pstEntry->u16Flags, orxCONFIG_VALUE_KU16_FLAG_LIST))
+        {
+          /* Invalid index table? */
+          if((pstEntry->u16ListCount < 2)
+          || (pstEntry->u32IndexOffset == orxU32_UNDEFINED)
+          || ((orxU64)pstEntry->u32IndexOffset + (orxU64)(pstEntry->u16ListCount - 1) > (orxU64)pstHeader->u32IndexCount))
+          {
+            /* Updates result */
+            eResult = orxSTATUS_FAILURE;
+          }
+          else
+          {
+            orxU32 j;
+
+            /* For all list items */
+            for(j = 0; j < (orxU32)(pstEntry->u16ListCount - 1); j++)
+            {
+              /* Outside of literal? */
+              if(au32IndexList[pstEntry->u32IndexOffset + j] >= pstEntry->u32ValueSize)
+              {
+                /* Updates result */
+                eResult = orxSTATUS_FAILURE;
+
+                break;
+              }
+            }
+          }
+        }
+        /* Not a single value? */
+        else if(pstEntry->u16ListCount != 1)
+        {
+          /* Updates result */
+          eResult = orxSTATUS_FAILURE;
+        }
+      }
+    }
+  }
+
+  /* Done! */
+  return eResult;
+}
+
 /** Event handler
  */
 static orxSTATUS orxFASTCALL orxConfig_EventHandler(const orxEVENT *_pstEvent)
@@ -923,7 +1307,7 @@ static orxINLINE const orxSTRING orxConfig_GetListValue(orxCONFIG_VALUE *_pstVal
         orxCOMMAND_VAR stResult;
 
         /* Evaluates command */
-        if(orxCommand_Evaluate(zResult + 1, &stResult) != orxNULL)
+        if(orxCommand_EvaluateCompiled(zResult + 1, &stResult) != orxNULL)
         {
           /* String? */
           if(stResult.eType == orxCOMMAND_VAR_TYPE_STRING)
@@ -983,29 +1367,58 @@ static orxINLINE void orxConfig_CryptBuffer(orxCHAR *_acBuffer, orxU32 _u32Buffe
   return;
 }
 
-/** Gets an entry from the current section
+/** Gets an entry from a section
+ * @param[in] _pstSection       Concerned section
  * @param[in] _stKeyID          Entry key ID
  * @return                      orxCONFIG_ENTRY / orxNULL
  */
-static orxINLINE orxCONFIG_ENTRY *orxConfig_GetEntry(orxSTRINGID _stKeyID)
+static orxINLINE orxCONFIG_ENTRY *orxConfig_GetSectionEntry(orxCONFIG_SECTION *_pstSection, orxSTRINGID _stKeyID)
 {
   orxCONFIG_ENTRY *pstResult = orxNULL, *pstEntry;
 
   /* Checks */
-  orxASSERT(sstConfig.pstCurrentSection != orxNULL);
+  orxASSERT(_pstSection != orxNULL);
 
-  /* For all entries */
-  for(pstEntry = (orxCONFIG_ENTRY *)orxLinkList_GetFirst(&(sstConfig.pstCurrentSection->stEntryList));
-      pstEntry != orxNULL;
-      pstEntry = (orxCONFIG_ENTRY *)orxLinkList_GetNext(&(pstEntry->stNode)))
+  /* Large section? */
+  if((orxLinkList_GetCount(&(_pstSection->stEntryList)) >= orxCONFIG_KU32_ENTRY_INDEX_THRESHOLD)
+  && ((_pstSection->apstEntryIndex != orxNULL)
+   || (orxConfig_BuildEntryIndex(_pstSection) != orxSTATUS_FAILURE)))
   {
-    /* Found? */
-    if(_stKeyID == pstEntry->stID)
+    orxU32 u32Mask, i;
+
+    /* Gets mask */
+    u32Mask = _pstSection->u32EntryIndexSize - 1;
+
+    /* For all probed slots */
+    for(i = (orxU32)_stKeyID & u32Mask;
+        (pstEntry = _pstSection->apstEntryIndex[i]) != orxNULL;
+        i = (i + 1) & u32Mask)
     {
-      /* Updates result */
-      pstResult = pstEntry;
+      /* Found? */
+      if(_stKeyID == pstEntry->stID)
+      {
+        /* Updates result */
+        pstResult = pstEntry;
 
-      break;
+        break;
+      }
+    }
+  }
+  else
+  {
+    /* For all entries */
+    for(pstEntry = (orxCONFIG_ENTRY *)orxLinkList_GetFirst(&(_pstSection->stEntryList));
+        pstEntry != orxNULL;
+        pstEntry = (orxCONFIG_ENTRY *)orxLinkList_GetNext(&(pstEntry->stNode)))
+    {
+      /* Found? */
+      if(_stKeyID == pstEntry->stID)
+      {
+        /* Updates result */
+        pstResult = pstEntry;
+
+        break;
+      }
     }
   }
 
@@ -1013,62 +1426,47 @@ static orxINLINE orxCONFIG_ENTRY *orxConfig_GetEntry(orxSTRINGID _stKeyID)
   return pstResult;
 }
 
+/** Gets an entry from the current section
+ * @param[in] _stKeyID          Entry key ID
+ * @return                      orxCONFIG_ENTRY / orxNULL
+ */
+static orxINLINE orxCONFIG_ENTRY *orxConfig_GetEntry(orxSTRINGID _stKeyID)
+{
+  /* Checks */
+  orxASSERT(sstConfig.pstCurrentSection != orxNULL);
+
+  /* Done! */
+  return orxConfig_GetSectionEntry(sstConfig.pstCurrentSection, _stKeyID);
+}
+
 /** Gets an entry from the current section, using inheritance
  * @param[in] _stKeyID          Entry key ID
  * @return                      orxCONFIG_ENTRY / orxNULL
  */
 static orxCONFIG_ENTRY *orxFASTCALL orxConfig_GetEntryFromKey(orxSTRINGID _stKeyID)
 {
-  orxCONFIG_ENTRY *pstResult = orxNULL;
+  orxCONFIG_SECTION *pstSection;
+  orxCONFIG_ENTRY   *pstResult = orxNULL;
 
   /* Checks */
   orxASSERT(sstConfig.pstCurrentSection != orxNULL);
 
-  /* Gets corresponding entry */
-  pstResult = orxConfig_GetEntry(_stKeyID);
-
-  /* Not found? */
-  if(pstResult == orxNULL)
+  /* For all sections in the inheritance chain */
+  for(pstSection = sstConfig.pstCurrentSection;
+      (pstSection != orxNULL) && (pstSection != orxHANDLE_UNDEFINED);
+      pstSection = (pstSection->pstParent != orxNULL)
+                 ? pstSection->pstParent
+                 : (pstSection != sstConfig.pstDefaultSection)
+                   ? sstConfig.pstDefaultSection
+                   : orxNULL)
   {
-    orxCONFIG_SECTION *pstParent;
+    /* Gets corresponding entry */
+    pstResult = orxConfig_GetSectionEntry(pstSection, _stKeyID);
 
-    /* Has parent? */
-    if(sstConfig.pstCurrentSection->pstParent != 0)
-    {
-      /* Selects it */
-      pstParent = sstConfig.pstCurrentSection->pstParent;
-    }
-    else
-    {
-      /* Isn't the default parent? */
-      if(sstConfig.pstCurrentSection != sstConfig.pstDefaultSection)
-      {
-        /* Selects default parent */
-        pstParent = sstConfig.pstDefaultSection;
-      }
-      else
-      {
-        /* No parent */
-        pstParent = orxNULL;
-      }
-    }
-
-    /* Valid parent ID */
-    if((pstParent != orxNULL) && (pstParent != orxHANDLE_UNDEFINED))
+    /* Found? */
+    if(pstResult != orxNULL)
     {
-      orxCONFIG_SECTION *pstPreviousSection;
-
-      /* Backups current section */
-      pstPreviousSection = sstConfig.pstCurrentSection;
-
-      /* Sets parent as current section */
-      sstConfig.pstCurrentSection = pstParent;
-
-      /* Gets inherited value */
-      pstResult = orxConfig_GetEntryFromKey(_stKeyID);
-
-      /* Restores current section */
-      sstConfig.pstCurrentSection = pstPreviousSection;
+      break;
     }
   }
 
@@ -1395,6 +1793,9 @@ static orxINLINE orxSTATUS orxConfig_SetEntry(const orxSTRING _zKey, const orxST
 
           /* Sets its ID */
           pstEntry->stID = stKeyID;
+
+          /* Adds it to index */
+          orxConfig_AddEntryIndex(sstConfig.pstCurrentSection, pstEntry);
         }
 
         /* Inits its type */
@@ -1411,6 +1812,9 @@ static orxINLINE orxSTATUS orxConfig_SetEntry(const orxSTRING _zKey, const orxST
           /* Reusing entry? */
           if(bReuse != orxFALSE)
           {
+            /* Invalidates section's index */
+            orxConfig_DeleteEntryIndex(sstConfig.pstCurrentSection);
+
             /* Removes it from list */
             orxLinkList_Remove(&(pstEntry->stNode));
           }
@@ -1464,6 +1868,10 @@ static orxINLINE orxCONFIG_SECTION *orxConfig_CreateSection(const orxSTRING _zSe
 
     /* Clears its protection count */
     pstSection->s32ProtectionCount = 0;
+
+    /* Clears its entry index */
+    pstSection->apstEntryIndex    = orxNULL;
+    pstSection->u32EntryIndexSize = 0;
   }
 
   /* Done! */
@@ -1559,6 +1967,9 @@ static orxINLINE orxSTATUS orxConfig_DeleteSection(orxCONFIG_SECTION *_pstSectio
         /* Removes it from table */
         orxHashTable_Remove(sstConfig.pstSectionTable, orxString_ToCRC(_pstSection->zName));
 
+        /* Deletes its entry index */
+        orxConfig_DeleteEntryIndex(_pstSection);
+
         /* Removes section */
         orxBank_Free(sstConfig.pstSectionBank, _pstSection);
 
@@ -3297,6 +3708,28 @@ void orxFASTCALL orxConfig_CommandSave(orxU32 _u32ArgNumber, const orxCOMMAND_VA
   return;
 }
 
+/** Command: SaveSnapshot
+ */
+void orxFASTCALL orxConfig_CommandSaveSnapshot(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
+{
+  /* Updates result */
+  _pstResult->bValue = (orxConfig_SaveSnapshot(_astArgList[0].zValue) != orxSTATUS_FAILURE) ? orxTRUE : orxFALSE;
+
+  /* Done! */
+  return;
+}
+
+/** Command: LoadSnapshot
+ */
+void orxFASTCALL orxConfig_CommandLoadSnapshot(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
+{
+  /* Updates result */
+  _pstResult->bValue = (orxConfig_LoadSnapshot(_astArgList[0].zValue) != orxSTATUS_FAILURE) ? orxTRUE : orxFALSE;
+
+  /* Done! */
+  return;
+}
+
 /** Command: Reload
  */
 void orxFASTCALL orxConfig_CommandReload(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
@@ -3710,6 +4143,10 @@ static orxINLINE void orxConfig_RegisterCommands()
   orxCOMMAND_REGISTER_CORE_COMMAND(Config, Load, "Success?", orxCOMMAND_VAR_TYPE_BOOL, 1, 0, {"FileName", orxCOMMAND_VAR_TYPE_STRING});
   /* Command: Save */
   orxCOMMAND_REGISTER_CORE_COMMAND(Config, Save, "Success?", orxCOMMAND_VAR_TYPE_BOOL, 1, 2, {"FileName", orxCOMMAND_VAR_TYPE_STRING}, {"OnlyOrigin = false", orxCOMMAND_VAR_TYPE_BOOL}, {"Encrypt = false", orxCOMMAND_VAR_TYPE_BOOL});
+  /* Command: SaveSnapshot */
+  orxCOMMAND_REGISTER_CORE_COMMAND(Config, SaveSnapshot, "Success?", orxCOMMAND_VAR_TYPE_BOOL, 1, 0, {"FileName", orxCOMMAND_VAR_TYPE_STRING});
+  /* Command: LoadSnapshot */
+  orxCOMMAND_REGISTER_CORE_COMMAND(Config, LoadSnapshot, "Success?", orxCOMMAND_VAR_TYPE_BOOL, 1, 0, {"FileName", orxCOMMAND_VAR_TYPE_STRING});
 
   /* Command: Reload */
   orxCOMMAND_REGISTER_CORE_COMMAND(Config, Reload, "Success?", orxCOMMAND_VAR_TYPE_BOOL, 0, 0);
@@ -3787,6 +4224,10 @@ static orxINLINE void orxConfig_UnregisterCommands()
   orxCOMMAND_UNREGISTER_CORE_COMMAND(Config, Load);
   /* Command: Save */
   orxCOMMAND_UNREGISTER_CORE_COMMAND(Config, Save);
+  /* Command: SaveSnapshot */
+  orxCOMMAND_UNREGISTER_CORE_COMMAND(Config, SaveSnapshot);
+  /* Command: LoadSnapshot */
+  orxCOMMAND_UNREGISTER_CORE_COMMAND(Config, LoadSnapshot);
   /* Command: Reload */
   orxCOMMAND_UNREGISTER_CORE_COMMAND(Config, Reload);
 
@@ -4010,6 +4451,8 @@ void orxFASTCALL orxConfig_Exit()
   /* Initialized? */
   if(orxFLAG_TEST(sstConfig.u32Flags, orxCONFIG_KU32_STATIC_FLAG_READY))
   {
+    orxCONFIG_SECTION *pstSection;
+
     /* Removes event handler */
     orxEvent_RemoveHandler(orxEVENT_TYPE_RESOURCE, orxConfig_EventHandler);
 
@@ -4022,6 +4465,15 @@ void orxFASTCALL orxConfig_Exit()
     /* Clears all data */
     orxConfig_Clear(orxNULL);
 
+    /* For all remaining sections */
+    for(pstSection = (orxCONFIG_SECTION *)orxLinkList_GetFirst(&(sstConfig.stSectionList));
+        pstSection != orxNULL;
+        pstSection = (orxCONFIG_SECTION *)orxLinkList_GetNext(&(pstSection->stNode)))
+    {
+      /* Deletes its entry index */
+      orxConfig_DeleteEntryIndex(pstSection);
+    }
+
     /* Clears section list */
     orxLinkList_Clean(&(sstConfig.stSectionList));
 
@@ -4796,6 +5248,527 @@ orxSTATUS orxFASTCALL orxConfig_Save(const orxSTRING _zFileName, orxBOOL _bUseEn
   return eResult;
 }
 
+/** Writes a binary snapshot of the whole config to given file, that can be loaded later on with orxConfig_LoadSnapshot() without any text parsing
+ * @param[in] _zFileName        File name
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+orxSTATUS orxFASTCALL orxConfig_SaveSnapshot(const orxSTRING _zFileName)
+{
+  const orxSTRING zResourceLocation;
+  orxHANDLE       hResource;
+  orxSTATUS       eResult = orxSTATUS_FAILURE;
+
+  /* Profiles */
+  orxPROFILER_PUSH_MARKER("orxConfig_SaveSnapshot");
+
+  /* Checks */
+  orxASSERT(orxFLAG_TEST(sstConfig.u32Flags, orxCONFIG_KU32_STATIC_FLAG_READY));
+  orxASSERT(_zFileName != orxNULL);
+
+  /* Valid file to open? */
+  if((_zFileName != orxSTRING_EMPTY)
+  && ((zResourceLocation = orxResource_LocateInStorage(orxCONFIG_KZ_RESOURCE_GROUP, orxNULL, _zFileName)) != orxNULL)
+  && ((hResource = orxResource_Open(zResourceLocation, orxTRUE)) != orxHANDLE_UNDEFINED))
+  {
+    orxCONFIG_SNAPSHOT_HEADER stHeader;
+    orxCONFIG_SECTION        *pstSection;
+    orxU32                    u32PoolCapacity = 0;
+
+    /* Clears header */
+    orxMemory_Zero(&stHeader, sizeof(orxCONFIG_SNAPSHOT_HEADER));
+
+    /* For all sections */
+    for(pstSection = (orxCONFIG_SECTION *)orxLinkList_GetFirst(&(sstConfig.stSectionList));
+        pstSection != orxNULL;
+        pstSection = (orxCONFIG_SECTION *)orxLinkList_GetNext(&(pstSection->stNode)))
+    {
+      orxCONFIG_ENTRY *pstEntry;
+
+      /* Updates counts */
+      stHeader.u32SectionCount++;
+      u32PoolCapacity += orxString_GetLength(pstSection->zName) + 1;
+      u32PoolCapacity += (pstSection->stOriginID != orxSTRINGID_UNDEFINED) ? orxString_GetLength(orxString_GetFromID(pstSection->stOriginID)) + 1 : 0;
+
+      /* For all its entries */
+      for(pstEntry = (orxCONFIG_ENTRY *)orxLinkList_GetFirst(&(pstSection->stEntryList));
+          pstEntry != orxNULL;
+          pstEntry = (orxCONFIG_ENTRY *)orxLinkList_GetNext(&(pstEntry->stNode)))
+      {
+        /* Updates counts */
+        stHeader.u32EntryCount++;
+        stHeader.u32IndexCount += orxFLAG_TEST(pstEntry->stValue.u16Flags, orxCONFIG_VALUE_KU16_FLAG_LIST) ? (orxU32)(pstEntry->stValue.u16ListCount - 1) : 0;
+        u32PoolCapacity += orxString_GetLength(orxString_GetFromID(pstEntry->stID)) + 1;
+        u32PoolCapacity += (pstEntry->stOriginID != orxSTRINGID_UNDEFINED) ? orxString_GetLength(orxString_GetFromID(pstEntry->stOriginID)) + 1 : 0;
+        u32PoolCapacity += orxConfig_GetLiteralSize(&(pstEntry->stValue));
+      }
+    }
+
+    /* Inits header */
+    stHeader.u32Magic     = orxCONFIG_KU32_SNAPSHOT_MAGIC;
+    stHeader.u32Version   = orxCONFIG_KU32_SNAPSHOT_VERSION;
+    stHeader.u32EntrySize = sizeof(orxCONFIG_SNAPSHOT_ENTRY);
+
+    {
+      orxCONFIG_SNAPSHOT_SECTION *astSectionList;
+      orxCONFIG_SNAPSHOT_ENTRY   *astEntryList;
+      orxU32                     *au32IndexList;
+      orxCHAR                    *pcPool;
+      orxHASHTABLE               *pstStringTable;
+
+      /* Allocates all tables */
+      astSectionList  = (orxCONFIG_SNAPSHOT_SECTION *)orxMemory_Allocate(orxMAX(stHeader.u32SectionCount, 1) * sizeof(orxCONFIG_SNAPSHOT_SECTION), orxMEMORY_TYPE_TEMP);
+      astEntryList    = (orxCONFIG_SNAPSHOT_ENTRY *)orxMemory_Allocate(orxMAX(stHeader.u32EntryCount, 1) * sizeof(orxCONFIG_SNAPSHOT_ENTRY), orxMEMORY_TYPE_TEMP);
+      au32IndexList   = (orxU32 *)orxMemory_Allocate(orxMAX(stHeader.u32IndexCount, 1) * sizeof(orxU32), orxMEMORY_TYPE_TEMP);
+      pcPool          = (orxCHAR *)orxMemory_Allocate(orxMAX(u32PoolCapacity, 1), orxMEMORY_TYPE_TEMP);
+      pstStringTable  = orxHashTable_Create(orxMAX(stHeader.u32EntryCount, 16), orxHASHTABLE_KU32_FLAG_NONE, orxMEMORY_TYPE_TEMP);
+
+      /* Success? */
+      if((astSectionList != orxNULL) && (astEntryList != orxNULL) && (au32IndexList != orxNULL) && (pcPool != orxNULL) && (pstStringTable != orxNULL))
+      {
+        orxU32 u32SectionIndex, u32EntryIndex, u32IndexIndex;
+
+        /* For all sections */
+        for(pstSection = (orxCONFIG_SECTION *)orxLinkList_GetFirst(&(sstConfig.stSectionList)), u32SectionIndex = u32EntryIndex = u32IndexIndex = 0;
+            pstSection != orxNULL;
+            pstSection = (orxCONFIG_SECTION *)orxLinkList_GetNext(&(pstSection->stNode)), u32SectionIndex++)
+        {
+          orxCONFIG_SNAPSHOT_SECTION *pstSnapshotSection;
+          orxCONFIG_ENTRY            *pstEntry;
+
+          /* Gets its record */
+          pstSnapshotSection = &(astSectionList[u32SectionIndex]);
+
+          /* Stores its name & origin */
+          pstSnapshotSection->u32NameOffset   = orxConfig_AddSnapshotString(pcPool, &(stHeader.u32StringPoolSize), pstStringTable, pstSection->zName);
+          pstSnapshotSection->u32OriginOffset = (pstSection->stOriginID != orxSTRINGID_UNDEFINED) ? orxConfig_AddSnapshotString(pcPool, &(stHeader.u32StringPoolSize), pstStringTable, orxString_GetFromID(pstSection->stOriginID)) : orxU32_UNDEFINED;
+
+          /* Stores its parent */
+          pstSnapshotSection->u32ParentOffset = (pstSection->pstParent == orxHANDLE_UNDEFINED)
+                                              ? orxCONFIG_KU32_SNAPSHOT_NO_DEFAULT_PARENT
+                                              : (pstSection->pstParent != orxNULL)
+                                                ? orxConfig_AddSnapshotString(pcPool, &(stHeader.u32StringPoolSize), pstStringTable, pstSection->pstParent->zName)
+                                                : orxU32_UNDEFINED;
+
+          /* Stores its entry count */
+          pstSnapshotSection->u32EntryCount   = orxLinkList_GetCount(&(pstSection->stEntryList));
+
+          /* For all its entries */
+          for(pstEntry = (orxCONFIG_ENTRY *)orxLinkList_GetFirst(&(pstSection->stEntryList));
+              pstEntry != orxNULL;
+              pstEntry = (orxCONFIG_ENTRY *)orxLinkList_GetNext(&(pstEntry->stNode)), u32EntryIndex++)
+          {
+            orxCONFIG_SNAPSHOT_ENTRY *pstSnapshotEntry;
+
+            /* Gets its record */
+            pstSnapshotEntry = &(astEntryList[u32EntryIndex]);
+
+            /* Stores its key & origin */
+            pstSnapshotEntry->u32KeyOffset    = orxConfig_AddSnapshotString(pcPool, &(stHeader.u32StringPoolSize), pstStringTable, orxString_GetFromID(pstEntry->stID));
+            pstSnapshotEntry->u32OriginOffset = (pstEntry->stOriginID != orxSTRINGID_UNDEFINED) ? orxConfig_AddSnapshotString(pcPool, &(stHeader.u32StringPoolSize), pstStringTable, orxString_GetFromID(pstEntry->stOriginID)) : orxU32_UNDEFINED;
+
+            /* Stores its literal value, including all list items */
+            pstSnapshotEntry->u32ValueSize    = orxConfig_GetLiteralSize(&(pstEntry->stValue));
+            pstSnapshotEntry->u32ValueOffset  = stHeader.u32StringPoolSize;
+            orxMemory_Copy(pcPool + stHeader.u32StringPoolSize, pstEntry->stValue.zValue, pstSnapshotEntry->u32ValueSize);
+            stHeader.u32StringPoolSize       += pstSnapshotEntry->u32ValueSize;
+
+            /* Is a list? */
+            if(orxFLAG_TEST(pstEntry->stValue.u16Flags, orxCONFIG_VALUE_KU16_FLAG_LIST))
+            {
+              /* Stores its index table */
+              pstSnapshotEntry->u32IndexOffset = u32IndexIndex;
+              orxMemory_Copy(au32IndexList + u32IndexIndex, pstEntry->stValue.au32ListIndexTable, (orxU32)(pstEntry->stValue.u16ListCount - 1) * sizeof(orxU32));
+              u32IndexIndex += (orxU32)(pstEntry->stValue.u16ListCount - 1);
+            }
+            else
+            {
+              /* Clears its index table */
+              pstSnapshotEntry->u32IndexOffset = orxU32_UNDEFINED;
+            }
+
+            /* Stores its pre-parsed values */
+            pstSnapshotEntry->u16Type         = pstEntry->stValue.u16Type;
+            pstSnapshotEntry->u16Flags        = pstEntry->stValue.u16Flags;
+            pstSnapshotEntry->u16ListCount    = pstEntry->stValue.u16ListCount;
+            pstSnapshotEntry->u16CacheIndex   = pstEntry->stValue.u16CacheIndex;
+            orxVector_Copy(&(pstSnapshotEntry->vValue), &(pstEntry->stValue.vValue));
+            orxVector_Copy(&(pstSnapshotEntry->vAltValue), &(pstEntry->stValue.vAltValue));
+            orxVector_Copy(&(pstSnapshotEntry->vStepValue), &(pstEntry->stValue.vStepValue));
+          }
+        }
+
+        /* Updates total size */
+        stHeader.u32Size = sizeof(orxCONFIG_SNAPSHOT_HEADER)
+                         + (stHeader.u32SectionCount * sizeof(orxCONFIG_SNAPSHOT_SECTION))
+                         + (stHeader.u32EntryCount * sizeof(orxCONFIG_SNAPSHOT_ENTRY))
+                         + (stHeader.u32IndexCount * sizeof(orxU32))
+                         + stHeader.u32StringPoolSize;
+
+        /* Writes everything */
+        if((orxResource_Write(hResource, sizeof(orxCONFIG_SNAPSHOT_HEADER), &stHeader, orxNULL, orxNULL) == (orxS64)sizeof(orxCONFIG_SNAPSHOT_HEADER))
+        && (orxResource_Write(hResource, (orxS64)(stHeader.u32SectionCount * sizeof(orxCONFIG_SNAPSHOT_SECTION)), astSectionList, orxNULL, orxNULL) == (orxS64)(stHeader.u32SectionCount * sizeof(orxCONFIG_SNAPSHOT_SECTION)))
+        && (orxResource_Write(hResource, (orxS64)(stHeader.u32EntryCount * sizeof(orxCONFIG_SNAPSHOT_ENTRY)), astEntryList, orxNULL, orxNULL) == (orxS64)(stHeader.u32EntryCount * sizeof(orxCONFIG_SNAPSHOT_ENTRY)))
+        && (orxResource_Write(hResource, (orxS64)(stHeader.u32IndexCount * sizeof(orxU32)), au32IndexList, orxNULL, orxNULL) == (orxS64)(stHeader.u32IndexCount * sizeof(orxU32)))
+        && (orxResource_Write(hResource, (orxS64)stHeader.u32StringPoolSize, pcPool, orxNULL, orxNULL) == (orxS64)stHeader.u32StringPoolSize))
+        {
+          /* Updates result */
+          eResult = orxSTATUS_SUCCESS;
+        }
+        else
+        {
+          /* Logs message */
+          orxDEBUG_PRINT(orxDEBUG_LEVEL_CONFIG, "[%s]: Can't save snapshot, write error.", _zFileName);
+        }
+      }
+      else
+      {
+        /* Logs message */
+        orxDEBUG_PRINT(orxDEBUG_LEVEL_CONFIG, "[%s]: Can't save snapshot, couldn't allocate memory for %u sections and %u entries.", _zFileName, stHeader.u32SectionCount, stHeader.u32EntryCount);
+      }
+
+      /* Frees all tables */
+      if(pstStringTable != orxNULL)
+      {
+        orxHashTable_Delete(pstStringTable);
+      }
+      if(pcPool != orxNULL)
+      {
+        orxMemory_Free(pcPool);
+      }
+      if(au32IndexList != orxNULL)
+      {
+        orxMemory_Free(au32IndexList);
+      }
+      if(astEntryList != orxNULL)
+      {
+        orxMemory_Free(astEntryList);
+      }
+      if(astSectionList != orxNULL)
+      {
+        orxMemory_Free(astSectionList);
+      }
+    }
+
+    /* Flushes & closes the resource */
+    orxResource_Close(hResource);
+  }
+  else
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_CONFIG, "[%s]: Can't save snapshot, can't open file on disk!", _zFileName);
+  }
+
+  /* Profiles */
+  orxPROFILER_POP_MARKER();
+
+  /* Done! */
+  return eResult;
+}
+
+/** Loads a binary config snapshot written by orxConfig_SaveSnapshot(), on top of the current config content. Text files can still be (re)loaded on top of it.
+ * @param[in] _zFileName        File name
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+orxSTATUS orxFASTCALL orxConfig_LoadSnapshot(const orxSTRING _zFileName)
+{
+  const orxSTRING zResourceLocation;
+  orxHANDLE       hResource;
+  orxSTATUS       eResult = orxSTATUS_FAILURE;
+
+  /* Profiles */
+  orxPROFILER_PUSH_MARKER("orxConfig_LoadSnapshot");
+
+  /* Checks */
+  orxASSERT(orxFLAG_TEST(sstConfig.u32Flags, orxCONFIG_KU32_STATIC_FLAG_READY));
+  orxASSERT(_zFileName != orxNULL);
+
+  /* Valid file to open? */
+  if((_zFileName != orxSTRING_EMPTY)
+  && ((zResourceLocation = orxResource_Locate(orxCONFIG_KZ_RESOURCE_GROUP, _zFileName)) != orxNULL)
+  && ((hResource = orxResource_Open(zResourceLocation, orxFALSE)) != orxHANDLE_UNDEFINED))
+  {
+    orxS64        s64Size;
+    const orxU8  *pu8Image;
+
+    /* Maps image */
+    pu8Image = (const orxU8 *)orxResource_Map(hResource, orxTRUE, &s64Size);
+
+    /* Valid image? */
+    if((pu8Image != orxNULL) && (s64Size >= (orxS64)sizeof(orxCONFIG_SNAPSHOT_HEADER)) && (s64Size <= (orxS64)orxU32_UNDEFINED))
+    {
+      const orxCONFIG_SNAPSHOT_HEADER *pstHeader;
+
+      /* Gets header */
+      pstHeader = (const orxCONFIG_SNAPSHOT_HEADER *)pu8Image;
+
+      /* Valid? */
+      if(orxConfig_CheckSnapshot(pu8Image, s64Size) != orxSTATUS_FAILURE)
+      {
+        const orxCONFIG_SNAPSHOT_SECTION *astSectionList;
+        const orxCONFIG_SNAPSHOT_ENTRY   *pstSnapshotEntry;
+        const orxU32                     *au32IndexList;
+        const orxCHAR                    *pcPool;
+        orxCONFIG_SECTION               **apstSectionList;
+
+        /* Gets all tables */
+        astSectionList    = (const orxCONFIG_SNAPSHOT_SECTION *)(pu8Image + sizeof(orxCONFIG_SNAPSHOT_HEADER));
+        pstSnapshotEntry  = (const orxCONFIG_SNAPSHOT_ENTRY *)(astSectionList + pstHeader->u32SectionCount);
+        au32IndexList     = (const orxU32 *)(pstSnapshotEntry + pstHeader->u32EntryCount);
+        pcPool            = (const orxCHAR *)(au32IndexList + pstHeader->u32IndexCount);
+
+        /* Allocates section list */
+        apstSectionList   = (orxCONFIG_SECTION **)orxMemory_Allocate(orxMAX(pstHeader->u32SectionCount, 1) * sizeof(orxCONFIG_SECTION *), orxMEMORY_TYPE_TEMP);
+
+        /* Success? */
+        if(apstSectionList != orxNULL)
+        {
+          orxU32 i;
+
+          /* Updates result */
+          eResult = orxSTATUS_SUCCESS;
+
+          /* For all sections */
+          for(i = 0; (i < pstHeader->u32SectionCount) && (eResult != orxSTATUS_FAILURE); i++)
+          {
+            const orxCONFIG_SNAPSHOT_SECTION *pstSnapshotSection;
+            orxCONFIG_SECTION                *pstSection;
+            const orxSTRING                   zName;
+            orxU32                            j;
+
+            /* Gets its record & name */
+            pstSnapshotSection  = &(astSectionList[i]);
+            zName               = pcPool + pstSnapshotSection->u32NameOffset;
+
+            /* Gets existing section */
+            pstSection = (orxCONFIG_SECTION *)orxHashTable_Get(sstConfig.pstSectionTable, orxString_ToCRC(zName));
+
+            /* Not found? */
+            if(pstSection == orxNULL)
+            {
+              /* Creates it */
+              pstSection = orxConfig_CreateSection(orxString_Store(zName), orxNULL);
+
+              /* Success? */
+              if(pstSection != orxNULL)
+              {
+                /* Stores its origin */
+                pstSection->stOriginID = (pstSnapshotSection->u32OriginOffset != orxU32_UNDEFINED) ? orxString_GetID(pcPool + pstSnapshotSection->u32OriginOffset) : orxSTRINGID_UNDEFINED;
+              }
+              else
+              {
+                /* Logs message */
+                orxDEBUG_PRINT(orxDEBUG_LEVEL_CONFIG, "[%s]: Failed to create config section [%s] from snapshot.", _zFileName, zName);
+
+                /* Updates result */
+                eResult = orxSTATUS_FAILURE;
+
+                break;
+              }
+            }
+
+            /* Stores it */
+            apstSectionList[i] = pstSection;
+
+            /* For all its entries */
+            for(j = 0; j < pstSnapshotSection->u32EntryCount; j++, pstSnapshotEntry++)
+            {
+              orxCONFIG_ENTRY  *pstEntry;
+              orxSTRINGID       stKeyID;
+
+              /* Gets key ID */
+              stKeyID = orxString_GetID(pcPool + pstSnapshotEntry->u32KeyOffset);
+
+              /* Gets existing entry */
+              pstEntry = orxConfig_GetSectionEntry(pstSection, stKeyID);
+
+              /* Found? */
+              if(pstEntry != orxNULL)
+              {
+                /* Deletes its value */
+                orxConfig_CleanValue(&(pstEntry->stValue));
+              }
+              else
+              {
+                /* Creates it */
+                pstEntry = (orxCONFIG_ENTRY *)orxBank_Allocate(sstConfig.pstEntryBank);
+
+                /* Success? */
+                if(pstEntry != orxNULL)
+                {
+                  /* Sets its ID */
+                  pstEntry->stID = stKeyID;
+
+                  /* Adds it to list */
+                  orxMemory_Zero(&(pstEntry->stNode), sizeof(orxLINKLIST_NODE));
+                  orxLinkList_AddEnd(&(pstSection->stEntryList), &(pstEntry->stNode));
+
+                  /* Adds it to index */
+                  orxConfig_AddEntryIndex(pstSection, pstEntry);
+                }
+                else
+                {
+                  /* Logs message */
+                  orxDEBUG_PRINT(orxDEBUG_LEVEL_CONFIG, "[%s]: Failed to create config entry <%s.%s> from snapshot.", _zFileName, zName, pcPool + pstSnapshotEntry->u32KeyOffset);
+
+                  /* Updates result */
+                  eResult = orxSTATUS_FAILURE;
+
+                  break;
+                }
+              }
+
+              /* Stores its origin */
+              pstEntry->stOriginID = (pstSnapshotEntry->u32OriginOffset != orxU32_UNDEFINED) ? orxString_GetID(pcPool + pstSnapshotEntry->u32OriginOffset) : orxSTRINGID_UNDEFINED;
+
+              /* Is a list? */
+              if(orxFLAG_TEST(pstSnapshotEntry->u16Flags, orxCONFIG_VALUE_KU16_FLAG_LIST))
+              {
+                orxSTRING zValue;
+                orxU32   *au32ListIndexTable;
+
+                /* Allocates its literal & index table */
+                zValue              = (orxSTRING)orxMemory_Allocate(pstSnapshotEntry->u32ValueSize, orxMEMORY_TYPE_TEXT);
+                au32ListIndexTable  = (orxU32 *)orxMemory_Allocate((orxU32)(pstSnapshotEntry->u16ListCount - 1) * sizeof(orxU32), orxMEMORY_TYPE_CONFIG);
+
+                /* Success? */
+                if((zValue != orxNULL) && (au32ListIndexTable != orxNULL))
+                {
+                  /* Copies them */
+                  orxMemory_Copy(zValue, pcPool + pstSnapshotEntry->u32ValueOffset, pstSnapshotEntry->u32ValueSize);
+                  orxMemory_Copy(au32ListIndexTable, au32IndexList + pstSnapshotEntry->u32IndexOffset, (orxU32)(pstSnapshotEntry->u16ListCount - 1) * sizeof(orxU32));
+
+                  /* Stores them */
+                  pstEntry->stValue.zValue              = zValue;
+                  pstEntry->stValue.au32ListIndexTable  = au32ListIndexTable;
+                }
+                else
+                {
+                  /* Frees them */
+                  if(zValue != orxNULL)
+                  {
+                    orxMemory_Free(zValue);
+                  }
+                  if(au32ListIndexTable != orxNULL)
+                  {
+                    orxMemory_Free(au32ListIndexTable);
+                  }
+
+                  /* Leaves an empty value */
+                  pstEntry->stValue.zValue              = (orxSTRING)orxSTRING_EMPTY;
+                  pstEntry->stValue.au32ListIndexTable  = orxNULL;
+                  pstEntry->stValue.u16Type             = (orxU16)orxCONFIG_VALUE_TYPE_STRING;
+                  pstEntry->stValue.u16Flags            = orxCONFIG_VALUE_KU16_FLAG_NONE;
+                  pstEntry->stValue.u16ListCount        = 1;
+                  pstEntry->stValue.u16CacheIndex       = 0;
+
+                  /* Logs message */
+                  orxDEBUG_PRINT(orxDEBUG_LEVEL_CONFIG, "[%s]: Failed to allocate value for config entry <%s.%s> from snapshot.", _zFileName, zName, pcPool + pstSnapshotEntry->u32KeyOffset);
+
+                  /* Updates result */
+                  eResult = orxSTATUS_FAILURE;
+
+                  break;
+                }
+              }
+              else
+              {
+                /* Stores its literal */
+                pstEntry->stValue.zValue              = (pstSnapshotEntry->u32ValueSize > 1) ? (orxSTRING)orxString_Store(pcPool + pstSnapshotEntry->u32ValueOffset) : (orxSTRING)orxSTRING_EMPTY;
+                pstEntry->stValue.au32ListIndexTable  = orxNULL;
+              }
+
+              /* Restores its pre-parsed values */
+              pstEntry->stValue.u16Type       = pstSnapshotEntry->u16Type;
+              pstEntry->stValue.u16Flags      = pstSnapshotEntry->u16Flags;
+              pstEntry->stValue.u16ListCount  = pstSnapshotEntry->u16ListCount;
+              pstEntry->stValue.u16CacheIndex = pstSnapshotEntry->u16CacheIndex;
+              orxVector_Copy(&(pstEntry->stValue.vValue), &(pstSnapshotEntry->vValue));
+              orxVector_Copy(&(pstEntry->stValue.vAltValue), &(pstSnapshotEntry->vAltValue));
+              orxVector_Copy(&(pstEntry->stValue.vStepValue), &(pstSnapshotEntry->vStepValue));
+            }
+          }
+
+          /* For all loaded sections */
+          for(i = 0; (i < pstHeader->u32SectionCount) && (eResult != orxSTATUS_FAILURE); i++)
+          {
+            orxCONFIG_SECTION *pstSection, *pstParent;
+            orxU32             u32ParentOffset;
+
+            /* Gets section & its parent */
+            pstSection      = apstSectionList[i];
+            u32ParentOffset = astSectionList[i].u32ParentOffset;
+            pstParent       = (u32ParentOffset == orxCONFIG_KU32_SNAPSHOT_NO_DEFAULT_PARENT)
+                            ? (orxCONFIG_SECTION *)orxHANDLE_UNDEFINED
+                            : (u32ParentOffset != orxU32_UNDEFINED)
+                              ? (orxCONFIG_SECTION *)orxHashTable_Get(sstConfig.pstSectionTable, orxString_ToCRC(pcPool + u32ParentOffset))
+                              : orxNULL;
+
+            /* New parent? */
+            if(pstParent != pstSection->pstParent)
+            {
+              /* Had a parent? */
+              if((pstSection->pstParent != orxNULL) && (pstSection->pstParent != orxHANDLE_UNDEFINED))
+              {
+                /* Unprotects it */
+                pstSection->pstParent->s32ProtectionCount--;
+
+                /* Checks */
+                orxASSERT(pstSection->pstParent->s32ProtectionCount >= 0);
+              }
+
+              /* Stores new parent */
+              pstSection->pstParent = pstParent;
+
+              /* Has a parent? */
+              if((pstParent != orxNULL) && (pstParent != orxHANDLE_UNDEFINED))
+              {
+                /* Protects it */
+                pstParent->s32ProtectionCount++;
+              }
+            }
+          }
+
+          /* Frees section list */
+          orxMemory_Free(apstSectionList);
+
+          /* Optimizes the section table */
+          orxHashTable_Optimize(sstConfig.pstSectionTable);
+        }
+        else
+        {
+          /* Logs message */
+          orxDEBUG_PRINT(orxDEBUG_LEVEL_CONFIG, "[%s]: Can't load snapshot, couldn't allocate memory for %u sections.", _zFileName, pstHeader->u32SectionCount);
+        }
+      }
+      else
+      {
+        /* Logs message */
+        orxDEBUG_PRINT(orxDEBUG_LEVEL_CONFIG, "[%s]: Can't load snapshot, invalid, corrupted or incompatible format.", _zFileName);
+      }
+
+    }
+    else
+    {
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_CONFIG, "[%s]: Can't load snapshot, read error.", _zFileName);
+    }
+
+    /* Closes resource (unmaps image) */
+    orxResource_Close(hResource);
+  }
+  else
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_CONFIG, "[%s]: Can't load snapshot: invalid / file not found", _zFileName);
+  }
+
+  /* Profiles */
+  orxPROFILER_POP_MARKER();
+
+  /* Done! */
+  return eResult;
+}
+
 /** Copies a file with optional encryption
  * @param[in] _zDstFileName     Name of the destination file
  * @param[in] _zSrcFileName     Name of the source file
@@ -39,6 +39,7 @@
 #include "memory/orxBank.h"
 #include "utils/orxHashTable.h"
 #include "utils/orxLinkList.h"
+#include "utils/orxString.h"
 
 
 /** Module flags
@@ -46,6 +47,7 @@
 #define orxEVENT_KU32_STATIC_FLAG_NONE    0x00000000  /**< No flags */
 
 #define orxEVENT_KU32_STATIC_FLAG_READY   0x00000001  /**< Ready flag */
+#define orxEVENT_KU32_STATIC_FLAG_DISPATCH 0x00000002 /**< Dispatch flag */
 
 #define orxEVENT_KU32_STATIC_MASK_ALL     0xFFFFFFFF  /**< All mask */
 
@@ -56,6 +58,11 @@
 #define orxEVENT_KU32_HANDLER_BANK_SIZE   32
 #define orxEVENT_KU32_STORAGE_BANK_SIZE   32
 
+#define orxEVENT_KU32_POST_QUEUE_SIZE     262144      /**< Post queue size, in bytes, per thread (power of two) */
+#define orxEVENT_KU32_POST_ALIGNMENT      8
+#define orxEVENT_KU32_POST_TABLE_SIZE     256
+#define orxEVENT_KU32_POST_LIST_SIZE      256
+
 
 /***************************************************************************
  * Structure declaration                                                   *
@@ -65,10 +72,11 @@
  */
 typedef struct __orxEVENT_HANDLER_INFO_t
 {
-  orxLINKLIST_NODE  stNode;
-  orxEVENT_HANDLER  pfnHandler;
-  void             *pContext;
-  orxU32            u32IDFlags;
+  orxLINKLIST_NODE        stNode;
+  orxEVENT_HANDLER        pfnHandler;
+  orxEVENT_BATCH_HANDLER  pfnBatchHandler;
+  void                   *pContext;
+  orxU32                  u32IDFlags;
 
 } orxEVENT_HANDLER_INFO;
 
@@ -78,9 +86,34 @@ typedef struct __orxEVENT_HANDLER_STORAGE_t
 {
   orxLINKLIST stList;
   orxBANK    *pstBank;
+  orxU32      u32BatchCount;
 
 } orxEVENT_HANDLER_STORAGE;
 
+/** Posted event entry, followed by its payload copy
+ */
+typedef struct __orxEVENT_POST_ENTRY_t
+{
+  orxEVENT  stEvent;                                  /**< Event */
+  orxU32    u32Size;                                  /**< Entry size (including payload), 0 for a wrap marker */
+  orxU32    u32PayloadSize;                           /**< Payload size */
+  orxBOOL   bCoalesce;                                /**< Can be coalesced? */
+  orxBOOL   bBatched;                                 /**< Already batched? */
+
+} orxEVENT_POST_ENTRY;
+
+/** Post queue: single producer (owner thread) / single consumer (main thread) ring buffer
+ */
+typedef struct __orxEVENT_POST_QUEUE_t
+{
+  volatile orxU32 u32Head;                            /**< Write position, only modified by the owner thread */
+  orxU32          au32PaddingHead[15];
+  volatile orxU32 u32Tail;                            /**< Read position, only modified by the main thread */
+  orxU32          au32PaddingTail[15];
+  orxU8           au8Buffer[orxEVENT_KU32_POST_QUEUE_SIZE]; /**< Buffer */
+
+} orxEVENT_POST_QUEUE;
+
 /** Static structure
  */
 typedef struct __orxEVENT_STATIC_t
@@ -90,6 +123,11 @@ typedef struct __orxEVENT_STATIC_t
   orxHASHTABLE             *pstHandlerStorageTable;   /**< Handler storage table */
   orxBANK                  *pstHandlerStorageBank;    /**< Handler storage bank */
   orxEVENT_HANDLER_STORAGE *astCoreHandlerStorageList[orxEVENT_TYPE_CORE_NUMBER]; /**< Core handler storage list */
+  orxEVENT_POST_QUEUE      *apstPostQueueList[orxTHREAD_KU32_MAX_THREAD_NUMBER]; /**< Post queue list (per thread) */
+  orxHASHTABLE             *pstCoalesceTable;         /**< Coalesce table */
+  orxEVENT_POST_ENTRY     **apstPostList;             /**< Posted events being dispatched */
+  orxEVENT                 *astBatchList;             /**< Batch event list */
+  orxU32                    u32PostListSize;          /**< Size of the posted event/batch lists */
 
 } orxEVENT_STATIC;
 
@@ -105,6 +143,371 @@ static orxEVENT_STATIC sstEvent;
  * Private functions                                                       *
  ***************************************************************************/
 
+/** Adds a handler info
+ * @param[in] _eEventType           Concerned type of event
+ * @param[in] _pfnEventHandler      Event handler to add, orxNULL for a batch handler
+ * @param[in] _pfnBatchHandler      Batch handler to add, orxNULL for an event handler
+ * @param[in] _pContext             Context that will be stored in events sent to this handler
+ * return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+static orxSTATUS orxFASTCALL orxEvent_AddHandlerInfo(orxEVENT_TYPE _eEventType, orxEVENT_HANDLER _pfnEventHandler, orxEVENT_BATCH_HANDLER _pfnBatchHandler, void *_pContext)
+{
+  orxEVENT_HANDLER_STORAGE *pstStorage;
+  orxSTATUS                 eResult = orxSTATUS_FAILURE;
+
+  /* Gets corresponding storage */
+  pstStorage = (_eEventType < orxEVENT_TYPE_CORE_NUMBER) ? sstEvent.astCoreHandlerStorageList[_eEventType] : (orxEVENT_HANDLER_STORAGE *)orxHashTable_Get(sstEvent.pstHandlerStorageTable, _eEventType);
+
+  /* No storage yet? */
+  if(pstStorage == orxNULL)
+  {
+    /* Allocates it */
+    pstStorage = (orxEVENT_HANDLER_STORAGE *)orxBank_Allocate(sstEvent.pstHandlerStorageBank);
+
+    /* Success? */
+    if(pstStorage != orxNULL)
+    {
+      /* Creates its bank */
+      pstStorage->pstBank = orxBank_Create(orxEVENT_KU32_HANDLER_BANK_SIZE, sizeof(orxEVENT_HANDLER_INFO), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+
+      /* Success? */
+      if(pstStorage->pstBank != orxNULL)
+      {
+        /* Clears its list */
+        orxMemory_Zero(&(pstStorage->stList), sizeof(orxLINKLIST));
+
+        /* Clears its batch count */
+        pstStorage->u32BatchCount = 0;
+
+        /* Is a core event handler? */
+        if(_eEventType < orxEVENT_TYPE_CORE_NUMBER)
+        {
+          /* Stores it */
+          sstEvent.astCoreHandlerStorageList[_eEventType] = pstStorage;
+        }
+        else
+        {
+          /* Tries to add it to the table */
+          if(orxHashTable_Add(sstEvent.pstHandlerStorageTable, _eEventType, pstStorage) == orxSTATUS_FAILURE)
+          {
+            /* Deletes its bank */
+            orxBank_Delete(pstStorage->pstBank);
+
+            /* Frees storage */
+            orxBank_Free(sstEvent.pstHandlerStorageBank, pstStorage);
+            pstStorage = orxNULL;
+          }
+        }
+      }
+      else
+      {
+        /* Frees storage */
+        orxBank_Free(sstEvent.pstHandlerStorageBank, pstStorage);
+        pstStorage = orxNULL;
+      }
+    }
+  }
+
+  /* Valid? */
+  if(pstStorage != orxNULL)
+  {
+    orxEVENT_HANDLER_INFO *pstInfo;
+
+    /* Allocates a new handler info */
+    pstInfo = (orxEVENT_HANDLER_INFO *)orxBank_Allocate(pstStorage->pstBank);
+
+    /* Valid? */
+    if(pstInfo != orxNULL)
+    {
+      /* Clears its node */
+      orxMemory_Zero(&(pstInfo->stNode), sizeof(orxLINKLIST_NODE));
+
+      /* Stores its handlers */
+      pstInfo->pfnHandler       = _pfnEventHandler;
+      pstInfo->pfnBatchHandler  = _pfnBatchHandler;
+
+      /* Stores context */
+      pstInfo->pContext = _pContext;
+
+      /* Inits its ID flags */
+      pstInfo->u32IDFlags = orxEVENT_KU32_MASK_ID_ALL;
+
+      /* Adds it to the list */
+      eResult = orxLinkList_AddEnd(&(pstStorage->stList), &(pstInfo->stNode));
+
+      /* Success and batch handler? */
+      if((eResult != orxSTATUS_FAILURE) && (_pfnBatchHandler != orxNULL))
+      {
+        /* Updates batch count */
+        pstStorage->u32BatchCount++;
+      }
+    }
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Sends an event to a storage's handlers
+ * @param[in] _pstStorage           Concerned storage
+ * @param[in] _pstEvent             Event to send
+ * @param[in] _bBatch               Also send it to batch handlers?
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+static orxSTATUS orxFASTCALL orxEvent_SendToStorage(orxEVENT_HANDLER_STORAGE *_pstStorage, orxEVENT *_pstEvent, orxBOOL _bBatch)
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT((_pstEvent->eID >= 0) && (_pstEvent->eID < 32));
+
+  /* Has handler(s)? */
+  if(orxLinkList_GetCount(&(_pstStorage->stList)) != 0)
+  {
+    orxEVENT_HANDLER_INFO  *pstInfo;
+    orxU32                  u32IDFlag, u32CurrentThread;
+
+    /* Get its ID flag */
+    u32IDFlag = orxEVENT_GET_FLAG(_pstEvent->eID);
+
+    /* Gets current thread */
+    u32CurrentThread = orxThread_GetCurrent();
+
+    /* Main thread? */
+    if(u32CurrentThread == orxTHREAD_KU32_MAIN_THREAD_ID)
+    {
+      /* Updates event send count */
+      sstEvent.s32EventSendCount++;
+    }
+
+    /* For all handlers */
+    for(pstInfo = (orxEVENT_HANDLER_INFO *)orxLinkList_GetFirst(&(_pstStorage->stList));
+        pstInfo != orxNULL;
+        pstInfo = (orxEVENT_HANDLER_INFO *)orxLinkList_GetNext(&(pstInfo->stNode)))
+    {
+      /* Batch handler? */
+      if(pstInfo->pfnBatchHandler != orxNULL)
+      {
+        /* Should process? */
+        if(_bBatch != orxFALSE)
+        {
+          /* Stores context */
+          _pstEvent->pContext = pstInfo->pContext;
+
+          /* Calls it with a single event */
+          if((pstInfo->pfnBatchHandler)(_pstEvent, 1) == orxSTATUS_FAILURE)
+          {
+            /* Updates result */
+            eResult = orxSTATUS_FAILURE;
+
+            break;
+          }
+        }
+      }
+      /* Should process? */
+      else if(orxFLAG_TEST(pstInfo->u32IDFlags, u32IDFlag))
+      {
+        /* Stores context */
+        _pstEvent->pContext = pstInfo->pContext;
+
+        /* Calls it */
+        if((pstInfo->pfnHandler)(_pstEvent) == orxSTATUS_FAILURE)
+        {
+          /* Updates result */
+          eResult = orxSTATUS_FAILURE;
+
+          break;
+        }
+      }
+    }
+
+    /* Clears context */
+    _pstEvent->pContext = orxNULL;
+
+    /* Main thread? */
+    if(u32CurrentThread == orxTHREAD_KU32_MAIN_THREAD_ID)
+    {
+      /* Updates event send count */
+      sstEvent.s32EventSendCount--;
+    }
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Gets a key for coalescing a posted event
+ * @param[in] _pstEntry             Concerned entry
+ * @return Key
+ */
+static orxINLINE orxU64 orxEvent_GetCoalesceKey(const orxEVENT_POST_ENTRY *_pstEntry)
+{
+  orxU32 u32CRC;
+  orxU64 u64Result;
+
+  /* Computes CRC of the event header */
+  u32CRC = spfnCRCFunction(0xFFFFFFFF, (const orxU8 *)&(_pstEntry->stEvent.eType), sizeof(orxEVENT_TYPE));
+  u32CRC = spfnCRCFunction(u32CRC, (const orxU8 *)&(_pstEntry->stEvent.eID), sizeof(orxENUM));
+  u32CRC = spfnCRCFunction(u32CRC, (const orxU8 *)&(_pstEntry->stEvent.hSender), sizeof(orxHANDLE));
+  u32CRC = spfnCRCFunction(u32CRC, (const orxU8 *)&(_pstEntry->stEvent.hRecipient), sizeof(orxHANDLE));
+
+  /* Has payload copy? */
+  if(_pstEntry->u32PayloadSize != 0)
+  {
+    /* Adds it */
+    u32CRC = spfnCRCFunction(u32CRC, (const orxU8 *)_pstEntry->stEvent.pstPayload, _pstEntry->u32PayloadSize);
+  }
+  else
+  {
+    /* Adds payload pointer */
+    u32CRC = spfnCRCFunction(u32CRC, (const orxU8 *)&(_pstEntry->stEvent.pstPayload), sizeof(void *));
+  }
+
+  /* Updates result, mixing in payload size */
+  u64Result = ((orxU64)_pstEntry->u32PayloadSize << 32) | (orxU64)u32CRC;
+
+  /* Done! */
+  return u64Result;
+}
+
+/** Are two posted events identical?
+ * @param[in] _pstEntry1            First entry
+ * @param[in] _pstEntry2            Second entry
+ * @return orxTRUE / orxFALSE
+ */
+static orxINLINE orxBOOL orxEvent_IsSamePost(const orxEVENT_POST_ENTRY *_pstEntry1, const orxEVENT_POST_ENTRY *_pstEntry2)
+{
+  orxBOOL bResult;
+
+  /* Updates result */
+  bResult = ((_pstEntry1->stEvent.eType == _pstEntry2->stEvent.eType)
+          && (_pstEntry1->stEvent.eID == _pstEntry2->stEvent.eID)
+          && (_pstEntry1->stEvent.hSender == _pstEntry2->stEvent.hSender)
+          && (_pstEntry1->stEvent.hRecipient == _pstEntry2->stEvent.hRecipient)
+          && (_pstEntry1->u32PayloadSize == _pstEntry2->u32PayloadSize)
+          && (((_pstEntry1->u32PayloadSize == 0) && (_pstEntry1->stEvent.pstPayload == _pstEntry2->stEvent.pstPayload))
+           || ((_pstEntry1->u32PayloadSize != 0) && (orxMemory_Compare(_pstEntry1->stEvent.pstPayload, _pstEntry2->stEvent.pstPayload, _pstEntry1->u32PayloadSize) == 0)))) ? orxTRUE : orxFALSE;
+
+  /* Done! */
+  return bResult;
+}
+
+/** Gets the post queue of the current thread, creating it if needed
+ * @return orxEVENT_POST_QUEUE / orxNULL
+ */
+static orxINLINE orxEVENT_POST_QUEUE *orxEvent_GetPostQueue()
+{
+  orxU32                u32Thread;
+  orxEVENT_POST_QUEUE  *pstResult = orxNULL;
+
+  /* Gets current thread */
+  u32Thread = orxThread_GetCurrent();
+
+  /* Valid? */
+  if(u32Thread != orxU32_UNDEFINED)
+  {
+    /* Gets its queue (only this thread can create it) */
+    pstResult = sstEvent.apstPostQueueList[u32Thread];
+
+    /* Not created yet? */
+    if(pstResult == orxNULL)
+    {
+      /* Allocates it */
+      pstResult = (orxEVENT_POST_QUEUE *)orxMemory_Allocate(sizeof(orxEVENT_POST_QUEUE), orxMEMORY_TYPE_MAIN);
+
+      /* Success? */
+      if(pstResult != orxNULL)
+      {
+        /* Inits it */
+        pstResult->u32Head = pstResult->u32Tail = 0;
+
+        /* Publishes it */
+        orxMEMORY_ATOMIC_EXCHANGE_POINTER(&(sstEvent.apstPostQueueList[u32Thread]), pstResult);
+      }
+      else
+      {
+        /* Logs message */
+        orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Couldn't allocate post queue for thread <%u>.", u32Thread);
+      }
+    }
+  }
+  else
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Can't post event from a thread that hasn't been created with orxThread_Start().");
+  }
+
+  /* Done! */
+  return pstResult;
+}
+
+/** Sends a batch of posted events of the same type to the batch handlers
+ * @param[in] _pstStorage           Concerned storage
+ * @param[in] _u32First             Index of the first posted event of this type
+ * @param[in] _u32Count             Number of posted events
+ */
+static void orxFASTCALL orxEvent_SendPostBatch(orxEVENT_HANDLER_STORAGE *_pstStorage, orxU32 _u32First, orxU32 _u32Count)
+{
+  orxEVENT_HANDLER_INFO  *pstInfo;
+  orxEVENT_TYPE           eType;
+  orxU32                  u32Number, i;
+
+  /* Gets type */
+  eType = sstEvent.apstPostList[_u32First]->stEvent.eType;
+
+  /* For all remaining posted events */
+  for(i = _u32First, u32Number = 0; i < _u32Count; i++)
+  {
+    orxEVENT_POST_ENTRY *pstEntry;
+
+    /* Gets it */
+    pstEntry = sstEvent.apstPostList[i];
+
+    /* Same type? */
+    if((pstEntry->stEvent.eType == eType) && (pstEntry->bBatched == orxFALSE))
+    {
+      /* Adds it to the batch */
+      orxMemory_Copy(&(sstEvent.astBatchList[u32Number++]), &(pstEntry->stEvent), sizeof(orxEVENT));
+
+      /* Updates status */
+      pstEntry->bBatched = orxTRUE;
+    }
+  }
+
+  /* Updates event send count */
+  sstEvent.s32EventSendCount++;
+
+  /* For all handlers */
+  for(pstInfo = (orxEVENT_HANDLER_INFO *)orxLinkList_GetFirst(&(_pstStorage->stList));
+      pstInfo != orxNULL;
+      pstInfo = (orxEVENT_HANDLER_INFO *)orxLinkList_GetNext(&(pstInfo->stNode)))
+  {
+    /* Batch handler? */
+    if(pstInfo->pfnBatchHandler != orxNULL)
+    {
+      /* For all events */
+      for(i = 0; i < u32Number; i++)
+      {
+        /* Stores context */
+        sstEvent.astBatchList[i].pContext = pstInfo->pContext;
+      }
+
+      /* Calls it */
+      if((pstInfo->pfnBatchHandler)(sstEvent.astBatchList, u32Number) == orxSTATUS_FAILURE)
+      {
+        /* Stops */
+        break;
+      }
+    }
+  }
+
+  /* Updates event send count */
+  sstEvent.s32EventSendCount--;
+
+  /* Done! */
+  return;
+}
+
 
 /***************************************************************************
  * Public functions                                                        *
@@ -146,8 +549,11 @@ orxSTATUS orxFASTCALL orxEvent_Init()
       /* Creates handler storage bank */
       sstEvent.pstHandlerStorageBank = orxBank_Create(orxEVENT_KU32_STORAGE_BANK_SIZE, sizeof(orxEVENT_HANDLER_STORAGE), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
 
+      /* Creates coalesce table */
+      sstEvent.pstCoalesceTable = orxHashTable_Create(orxEVENT_KU32_POST_TABLE_SIZE, orxHASHTABLE_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+
       /* Success? */
-      if(sstEvent.pstHandlerStorageBank != orxNULL)
+      if((sstEvent.pstHandlerStorageBank != orxNULL) && (sstEvent.pstCoalesceTable != orxNULL))
       {
         /* Inits Flags */
         orxFLAG_SET(sstEvent.u32Flags, orxEVENT_KU32_STATIC_FLAG_READY, orxEVENT_KU32_STATIC_MASK_ALL);
@@ -160,8 +566,22 @@ orxSTATUS orxFASTCALL orxEvent_Init()
         /* Deletes table */
         orxHashTable_Delete(sstEvent.pstHandlerStorageTable);
 
+        /* Has bank? */
+        if(sstEvent.pstHandlerStorageBank != orxNULL)
+        {
+          /* Deletes it */
+          orxBank_Delete(sstEvent.pstHandlerStorageBank);
+        }
+
+        /* Has coalesce table? */
+        if(sstEvent.pstCoalesceTable != orxNULL)
+        {
+          /* Deletes it */
+          orxHashTable_Delete(sstEvent.pstCoalesceTable);
+        }
+
         /* Logs message */
-        orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Event module failed to create bank.");
+        orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Event module failed to create bank/coalesce table.");
 
         /* Updates result */
         eResult = orxSTATUS_FAILURE;
@@ -193,6 +613,8 @@ orxSTATUS orxFASTCALL orxEvent_Init()
  */
 void orxFASTCALL orxEvent_Exit()
 {
+  orxU32 i;
+
   /* Initialized? */
   if(orxFLAG_TEST(sstEvent.u32Flags, orxEVENT_KU32_STATIC_FLAG_READY))
   {
@@ -202,121 +624,73 @@ void orxFASTCALL orxEvent_Exit()
     /* Deletes bank */
     orxBank_Delete(sstEvent.pstHandlerStorageBank);
 
-    /* Updates flags */
-    orxFLAG_SET(sstEvent.u32Flags, orxEVENT_KU32_STATIC_FLAG_NONE, orxEVENT_KU32_STATIC_MASK_ALL);
-  }
-
-  return;
-}
-
-/** Adds an event handler
- * @param[in] _eEventType           Concerned type of event
- * @param[in] _pfnHandler           Event handler to add
- * return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
- */
-orxSTATUS orxFASTCALL orxEvent_AddHandler(orxEVENT_TYPE _eEventType, orxEVENT_HANDLER _pfnEventHandler)
-{
-  orxSTATUS eResult;
-
-  /* Adds handler */
-  eResult = orxEvent_AddHandlerWithContext(_eEventType, _pfnEventHandler, orxNULL);
-
-  /* Done! */
-  return eResult;
-}
-
-/** Adds an event handler with user-defined context
- * @param[in] _eEventType           Concerned type of event
- * @param[in] _pfnHandler           Event handler to add
- * @param[in] _pContext             Context that will be stored in events sent to this handler
- * return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
- */
-orxSTATUS orxFASTCALL orxEvent_AddHandlerWithContext(orxEVENT_TYPE _eEventType, orxEVENT_HANDLER _pfnEventHandler, void *_pContext)
-{
-  orxEVENT_HANDLER_STORAGE *pstStorage;
-  orxSTATUS                 eResult = orxSTATUS_FAILURE;
-
-  /* Checks */
-  orxASSERT(orxFLAG_TEST(sstEvent.u32Flags, orxEVENT_KU32_STATIC_FLAG_READY));
-  orxASSERT(_pfnEventHandler != orxNULL);
+    /* Deletes coalesce table */
+    orxHashTable_Delete(sstEvent.pstCoalesceTable);
 
-  /* Gets corresponding storage */
-  pstStorage = (_eEventType < orxEVENT_TYPE_CORE_NUMBER) ? sstEvent.astCoreHandlerStorageList[_eEventType] : (orxEVENT_HANDLER_STORAGE *)orxHashTable_Get(sstEvent.pstHandlerStorageTable, _eEventType);
-
-  /* No storage yet? */
-  if(pstStorage == orxNULL)
-  {
-    /* Allocates it */
-    pstStorage = (orxEVENT_HANDLER_STORAGE *)orxBank_Allocate(sstEvent.pstHandlerStorageBank);
-
-    /* Success? */
-    if(pstStorage != orxNULL)
+    /* For all post queues */
+    for(i = 0; i < orxTHREAD_KU32_MAX_THREAD_NUMBER; i++)
     {
-      /* Creates its bank */
-      pstStorage->pstBank = orxBank_Create(orxEVENT_KU32_HANDLER_BANK_SIZE, sizeof(orxEVENT_HANDLER_INFO), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
-
-      /* Success? */
-      if(pstStorage->pstBank != orxNULL)
+      /* Valid? */
+      if(sstEvent.apstPostQueueList[i] != orxNULL)
       {
-        /* Clears its list */
-        orxMemory_Zero(&(pstStorage->stList), sizeof(orxLINKLIST));
+        /* Deletes it, discarding undispatched events */
+        orxMemory_Free(sstEvent.apstPostQueueList[i]);
+      }
+    }
 
-        /* Is a core event handler? */
-        if(_eEventType < orxEVENT_TYPE_CORE_NUMBER)
-        {
-          /* Stores it */
-          sstEvent.astCoreHandlerStorageList[_eEventType] = pstStorage;
-        }
-        else
-        {
-          /* Tries to add it to the table */
-          if(orxHashTable_Add(sstEvent.pstHandlerStorageTable, _eEventType, pstStorage) == orxSTATUS_FAILURE)
-          {
-            /* Deletes its bank */
-            orxBank_Delete(pstStorage->pstBank);
+    /* Has posted event list? */
+    if(sstEvent.apstPostList != orxNULL)
+    {
+      /* Deletes it */
+      orxMemory_Free(sstEvent.apstPostList);
+    }
 
-            /* Frees storage */
-            orxBank_Free(sstEvent.pstHandlerStorageBank, pstStorage);
-            pstStorage = orxNULL;
-          }
-        }
-      }
-      else
-      {
-        /* Frees storage */
-        orxBank_Free(sstEvent.pstHandlerStorageBank, pstStorage);
-        pstStorage = orxNULL;
-      }
+    /* Has batch list? */
+    if(sstEvent.astBatchList != orxNULL)
+    {
+      /* Deletes it */
+      orxMemory_Free(sstEvent.astBatchList);
     }
+
+    /* Updates flags */
+    orxFLAG_SET(sstEvent.u32Flags, orxEVENT_KU32_STATIC_FLAG_NONE, orxEVENT_KU32_STATIC_MASK_ALL);
   }
 
-  /* Valid? */
-  if(pstStorage != orxNULL)
-  {
-    orxEVENT_HANDLER_INFO *pstInfo;
+  return;
+}
 
-    /* Allocates a new handler info */
-    pstInfo = (orxEVENT_HANDLER_INFO *)orxBank_Allocate(pstStorage->pstBank);
+/** Adds an event handler
+ * @param[in] _eEventType           Concerned type of event
+ * @param[in] _pfnHandler           Event handler to add
+ * return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+orxSTATUS orxFASTCALL orxEvent_AddHandler(orxEVENT_TYPE _eEventType, orxEVENT_HANDLER _pfnEventHandler)
+{
+  orxSTATUS eResult;
 
-    /* Valid? */
-    if(pstInfo != orxNULL)
-    {
-      /* Clears its node */
-      orxMemory_Zero(&(pstInfo->stNode), sizeof(orxLINKLIST_NODE));
+  /* Adds handler */
+  eResult = orxEvent_AddHandlerWithContext(_eEventType, _pfnEventHandler, orxNULL);
 
-      /* Stores its handler */
-      pstInfo->pfnHandler = _pfnEventHandler;
+  /* Done! */
+  return eResult;
+}
 
-      /* Stores context */
-      pstInfo->pContext = _pContext;
+/** Adds an event handler with user-defined context
+ * @param[in] _eEventType           Concerned type of event
+ * @param[in] _pfnHandler           Event handler to add
+ * @param[in] _pContext             Context that will be stored in events sent to this handler
+ * return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+orxSTATUS orxFASTCALL orxEvent_AddHandlerWithContext(orxEVENT_TYPE _eEventType, orxEVENT_HANDLER _pfnEventHandler, void *_pContext)
+{
+  orxSTATUS eResult;
 
-      /* Inits its ID flags */
-      pstInfo->u32IDFlags = orxEVENT_KU32_MASK_ID_ALL;
+  /* Checks */
+  orxASSERT(orxFLAG_TEST(sstEvent.u32Flags, orxEVENT_KU32_STATIC_FLAG_READY));
+  orxASSERT(_pfnEventHandler != orxNULL);
 
-      /* Adds it to the list */
-      eResult = orxLinkList_AddEnd(&(pstStorage->stList), &(pstInfo->stNode));
-    }
-  }
+  /* Adds handler info */
+  eResult = orxEvent_AddHandlerInfo(_eEventType, _pfnEventHandler, orxNULL, _pContext);
 
   /* Done! */
   return eResult;
@@ -448,79 +822,110 @@ orxSTATUS orxFASTCALL orxEvent_SetHandlerIDFlags(orxEVENT_HANDLER _pfnEventHandl
   return eResult;
 }
 
-/** Sends an event
- * @param[in] _pstEvent             Event to send
+/** Adds a batch handler
+ * @param[in] _eEventType           Concerned type of event
+ * @param[in] _pfnBatchHandler      Batch handler to add
+ * @param[in] _pContext             Context that will be stored in events sent to this handler
+ * return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
  */
-orxSTATUS orxFASTCALL orxEvent_Send(orxEVENT *_pstEvent)
+orxSTATUS orxFASTCALL orxEvent_AddBatchHandler(orxEVENT_TYPE _eEventType, orxEVENT_BATCH_HANDLER _pfnBatchHandler, void *_pContext)
 {
-  orxEVENT_HANDLER_STORAGE *pstStorage;
-  orxSTATUS                 eResult = orxSTATUS_SUCCESS;
+  orxSTATUS eResult;
 
-  /* Profiles */
-  orxPROFILER_PUSH_MARKER("orxEvent_Send");
+  /* Checks */
+  orxASSERT(orxFLAG_TEST(sstEvent.u32Flags, orxEVENT_KU32_STATIC_FLAG_READY));
+  orxASSERT(_pfnBatchHandler != orxNULL);
+
+  /* Adds handler info */
+  eResult = orxEvent_AddHandlerInfo(_eEventType, orxNULL, _pfnBatchHandler, _pContext);
+
+  /* Done! */
+  return eResult;
+}
+
+/** Removes a batch handler which matches given context
+ * @param[in] _eEventType           Concerned type of event
+ * @param[in] _pfnBatchHandler      Batch handler to remove
+ * @param[in] _pContext             Context of the handler to remove, orxNULL for removing all occurrences regardless of their context
+ * return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+orxSTATUS orxFASTCALL orxEvent_RemoveBatchHandler(orxEVENT_TYPE _eEventType, orxEVENT_BATCH_HANDLER _pfnBatchHandler, void *_pContext)
+{
+  orxEVENT_HANDLER_STORAGE *pstStorage;
+  orxSTATUS                 eResult = orxSTATUS_FAILURE;
 
   /* Checks */
   orxASSERT(orxFLAG_TEST(sstEvent.u32Flags, orxEVENT_KU32_STATIC_FLAG_READY));
-  orxASSERT(_pstEvent != orxNULL);
-  orxASSERT((_pstEvent->eID >= 0) && (_pstEvent->eID < 32));
+  orxASSERT(_pfnBatchHandler != orxNULL);
 
   /* Gets corresponding storage */
-  pstStorage = (_pstEvent->eType < orxEVENT_TYPE_CORE_NUMBER) ? sstEvent.astCoreHandlerStorageList[_pstEvent->eType] : (orxEVENT_HANDLER_STORAGE *)orxHashTable_Get(sstEvent.pstHandlerStorageTable, _pstEvent->eType);
+  pstStorage = (_eEventType < orxEVENT_TYPE_CORE_NUMBER) ? sstEvent.astCoreHandlerStorageList[_eEventType] : (orxEVENT_HANDLER_STORAGE *)orxHashTable_Get(sstEvent.pstHandlerStorageTable, _eEventType);
 
   /* Valid? */
   if(pstStorage != orxNULL)
   {
-    /* Has handler(s)? */
-    if(orxLinkList_GetCount(&(pstStorage->stList)) != 0)
+    orxEVENT_HANDLER_INFO *pstInfo, *pstNext;
+
+    /* For all handlers */
+    for(pstInfo = (orxEVENT_HANDLER_INFO *)orxLinkList_GetFirst(&(pstStorage->stList));
+        pstInfo != orxNULL;
+        pstInfo = pstNext)
     {
-      orxEVENT_HANDLER_INFO  *pstInfo;
-      orxU32                  u32IDFlag, u32CurrentThread;
+      /* Gets next handler */
+      pstNext = (orxEVENT_HANDLER_INFO *)orxLinkList_GetNext(&(pstInfo->stNode));
+
+      /* Found? */
+      if((pstInfo->pfnBatchHandler == _pfnBatchHandler)
+      && ((_pContext == orxNULL)
+       || (_pContext == pstInfo->pContext)))
+      {
+        /* Removes it from list */
+        orxLinkList_Remove(&(pstInfo->stNode));
 
-      /* Get its ID flag */
-      u32IDFlag = orxEVENT_GET_FLAG(_pstEvent->eID);
+        /* Frees it */
+        orxBank_Free(pstStorage->pstBank, pstInfo);
 
-      /* Gets current thread */
-      u32CurrentThread = orxThread_GetCurrent();
+        /* Updates batch count */
+        pstStorage->u32BatchCount--;
 
-      /* Main thread? */
-      if(u32CurrentThread == orxTHREAD_KU32_MAIN_THREAD_ID)
-      {
-        /* Updates event send count */
-        sstEvent.s32EventSendCount++;
+        /* Updates result */
+        eResult = orxSTATUS_SUCCESS;
       }
+    }
+  }
+  else
+  {
+    /* Defaults to success */
+    eResult = orxSTATUS_SUCCESS;
+  }
 
-      /* For all handlers */
-      for(pstInfo = (orxEVENT_HANDLER_INFO *)orxLinkList_GetFirst(&(pstStorage->stList));
-          pstInfo != orxNULL;
-          pstInfo = (orxEVENT_HANDLER_INFO *)orxLinkList_GetNext(&(pstInfo->stNode)))
-      {
-        /* Should process? */
-        if(orxFLAG_TEST(pstInfo->u32IDFlags, u32IDFlag))
-        {
-          /* Stores context */
-          _pstEvent->pContext = pstInfo->pContext;
+  /* Done! */
+  return eResult;
+}
 
-          /* Calls it */
-          if((pstInfo->pfnHandler)(_pstEvent) == orxSTATUS_FAILURE)
-          {
-            /* Updates result */
-            eResult = orxSTATUS_FAILURE;
+/** Sends an event
+ * @param[in] _pstEvent             Event to send
+ */
+orxSTATUS orxFASTCALL orxEvent_Send(orxEVENT *_pstEvent)
+{
+  orxEVENT_HANDLER_STORAGE *pstStorage;
+  orxSTATUS                 eResult = orxSTATUS_SUCCESS;
 
-            break;
-          }
-        }
-      }
+  /* Profiles */
+  orxPROFILER_PUSH_MARKER("orxEvent_Send");
+
+  /* Checks */
+  orxASSERT(orxFLAG_TEST(sstEvent.u32Flags, orxEVENT_KU32_STATIC_FLAG_READY));
+  orxASSERT(_pstEvent != orxNULL);
 
-      /* Clears context */
-      _pstEvent->pContext = orxNULL;
+  /* Gets corresponding storage */
+  pstStorage = (_pstEvent->eType < orxEVENT_TYPE_CORE_NUMBER) ? sstEvent.astCoreHandlerStorageList[_pstEvent->eType] : (orxEVENT_HANDLER_STORAGE *)orxHashTable_Get(sstEvent.pstHandlerStorageTable, _pstEvent->eType);
 
-      /* Main thread? */
-      if(u32CurrentThread == orxTHREAD_KU32_MAIN_THREAD_ID)
-      {
-        /* Updates event send count */
-        sstEvent.s32EventSendCount--;
-      }
-    }
+  /* Valid? */
+  if(pstStorage != orxNULL)
+  {
+    /* Sends it to all its handlers */
+    eResult = orxEvent_SendToStorage(pstStorage, _pstEvent, orxTRUE);
   }
 
   /* Profiles */
@@ -571,3 +976,365 @@ orxBOOL orxFASTCALL orxEvent_IsSending()
   /* Done! */
   return bResult;
 }
+
+/** Posts an event: it will be copied (along with its payload) and dispatched later on, from the main thread, during orxEvent_Dispatch()
+ * @param[in] _pstEvent             Event to post
+ * @param[in] _u32PayloadSize       Size of the payload to copy, 0 to keep the payload pointer as-is (it then needs to remain valid till dispatch)
+ * @param[in] _bCoalesce            If true, the event will be dropped if an identical coalescable event (type, ID, sender, recipient & payload) is dispatched at the same time
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+orxSTATUS orxFASTCALL orxEvent_Post(const orxEVENT *_pstEvent, orxU32 _u32PayloadSize, orxBOOL _bCoalesce)
+{
+  orxEVENT_POST_QUEUE  *pstQueue;
+  orxSTATUS             eResult = orxSTATUS_FAILURE;
+
+  /* Checks */
+  orxASSERT(orxFLAG_TEST(sstEvent.u32Flags, orxEVENT_KU32_STATIC_FLAG_READY));
+  orxASSERT(_pstEvent != orxNULL);
+  orxASSERT(_pstEvent->eID < 32);
+  orxASSERT((_u32PayloadSize == 0) || (_pstEvent->pstPayload != orxNULL));
+
+  /* Gets post queue */
+  pstQueue = orxEvent_GetPostQueue();
+
+  /* Valid? */
+  if(pstQueue != orxNULL)
+  {
+    orxU32 u32Size;
+
+    /* Gets entry size */
+    u32Size = (orxU32)orxALIGN(sizeof(orxEVENT_POST_ENTRY) + _u32PayloadSize, orxEVENT_KU32_POST_ALIGNMENT);
+
+    /* Not too large? */
+    if(u32Size <= orxEVENT_KU32_POST_QUEUE_SIZE / 2)
+    {
+      orxU32 u32Head, u32Offset, u32Contiguous, u32Needed;
+
+      /* Gets head */
+      u32Head = pstQueue->u32Head;
+
+      /* Gets offset & contiguous space */
+      u32Offset     = u32Head & (orxEVENT_KU32_POST_QUEUE_SIZE - 1);
+      u32Contiguous = orxEVENT_KU32_POST_QUEUE_SIZE - u32Offset;
+
+      /* Gets needed space (wrapping if necessary) */
+      u32Needed = (u32Contiguous < u32Size) ? u32Contiguous + u32Size : u32Size;
+
+      /* Full? */
+      if(orxEVENT_KU32_POST_QUEUE_SIZE - (u32Head - pstQueue->u32Tail) < u32Needed)
+      {
+        /* Main thread and not dispatching? */
+        if((orxThread_GetCurrent() == orxTHREAD_KU32_MAIN_THREAD_ID)
+        && (!orxFLAG_TEST(sstEvent.u32Flags, orxEVENT_KU32_STATIC_FLAG_DISPATCH)))
+        {
+          /* Dispatches pending events */
+          orxEvent_Dispatch();
+        }
+      }
+
+      /* Enough space? */
+      if(orxEVENT_KU32_POST_QUEUE_SIZE - (u32Head - pstQueue->u32Tail) >= u32Needed)
+      {
+        orxEVENT_POST_ENTRY *pstEntry;
+
+        /* Should wrap? */
+        if(u32Contiguous < u32Size)
+        {
+          /* Can store a wrap marker? */
+          if(u32Contiguous >= sizeof(orxEVENT_POST_ENTRY))
+          {
+            /* Stores it */
+            ((orxEVENT_POST_ENTRY *)(pstQueue->au8Buffer + u32Offset))->u32Size = 0;
+          }
+
+          /* Updates head & offset */
+          u32Head  += u32Contiguous;
+          u32Offset = 0;
+        }
+
+        /* Gets entry */
+        pstEntry = (orxEVENT_POST_ENTRY *)(pstQueue->au8Buffer + u32Offset);
+
+        /* Inits it */
+        orxMemory_Copy(&(pstEntry->stEvent), _pstEvent, sizeof(orxEVENT));
+        pstEntry->stEvent.pContext  = orxNULL;
+        pstEntry->u32Size           = u32Size;
+        pstEntry->u32PayloadSize    = _u32PayloadSize;
+        pstEntry->bCoalesce         = _bCoalesce;
+        pstEntry->bBatched          = orxFALSE;
+
+        /* Has payload to copy? */
+        if(_u32PayloadSize != 0)
+        {
+          /* Copies it */
+          orxMemory_Copy(pstEntry + 1, _pstEvent->pstPayload, _u32PayloadSize);
+        }
+
+        /* Makes sure the entry is written before publishing it */
+        orxMEMORY_BARRIER();
+
+        /* Publishes it */
+        pstQueue->u32Head = u32Head + u32Size;
+
+        /* Updates result */
+        eResult = orxSTATUS_SUCCESS;
+      }
+      else
+      {
+        /* Logs message */
+        orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Can't post event [%u:%u]: post queue is full.", _pstEvent->eType, _pstEvent->eID);
+      }
+    }
+    else
+    {
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Can't post event [%u:%u]: payload size <%u> is too large.", _pstEvent->eType, _pstEvent->eID, _u32PayloadSize);
+    }
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Dispatches all posted events, main thread only
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+orxSTATUS orxFASTCALL orxEvent_Dispatch()
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT(orxFLAG_TEST(sstEvent.u32Flags, orxEVENT_KU32_STATIC_FLAG_READY));
+  orxASSERT(orxThread_GetCurrent() == orxTHREAD_KU32_MAIN_THREAD_ID);
+
+  /* Not already dispatching? */
+  if(!orxFLAG_TEST(sstEvent.u32Flags, orxEVENT_KU32_STATIC_FLAG_DISPATCH))
+  {
+    orxEVENT_POST_QUEUE  *apstQueueList[orxTHREAD_KU32_MAX_THREAD_NUMBER];
+    orxU32                au32TailList[orxTHREAD_KU32_MAX_THREAD_NUMBER];
+    orxU32                u32Count = 0, i;
+
+    /* Profiles */
+    orxPROFILER_PUSH_MARKER("orxEvent_Dispatch");
+
+    /* Updates status */
+    orxFLAG_SET(sstEvent.u32Flags, orxEVENT_KU32_STATIC_FLAG_DISPATCH, orxEVENT_KU32_STATIC_FLAG_NONE);
+
+    /* For all threads */
+    for(i = 0; i < orxTHREAD_KU32_MAX_THREAD_NUMBER; i++)
+    {
+      orxEVENT_POST_QUEUE *pstQueue;
+
+      /* Gets its queue */
+      apstQueueList[i] = pstQueue = (orxEVENT_POST_QUEUE *)orxMEMORY_ATOMIC_LOAD_POINTER(&(sstEvent.apstPostQueueList[i]));
+
+      /* Valid? */
+      if(pstQueue != orxNULL)
+      {
+        orxU32 u32Tail, u32Head;
+
+        /* Gets positions */
+        u32Tail = pstQueue->u32Tail;
+        u32Head = pstQueue->u32Head;
+
+        /* Makes sure entries are read after the head */
+        orxMEMORY_BARRIER();
+
+        /* For all published entries */
+        while(u32Tail != u32Head)
+        {
+          orxEVENT_POST_ENTRY  *pstEntry;
+          orxU32                u32Offset, u32Contiguous;
+
+          /* Gets offset & contiguous space */
+          u32Offset     = u32Tail & (orxEVENT_KU32_POST_QUEUE_SIZE - 1);
+          u32Contiguous = orxEVENT_KU32_POST_QUEUE_SIZE - u32Offset;
+
+          /* Gets entry */
+          pstEntry = (orxEVENT_POST_ENTRY *)(pstQueue->au8Buffer + u32Offset);
+
+          /* Wrap? */
+          if((u32Contiguous < sizeof(orxEVENT_POST_ENTRY)) || (pstEntry->u32Size == 0))
+          {
+            /* Skips to beginning */
+            u32Tail += u32Contiguous;
+          }
+          else
+          {
+            orxBOOL bKeep = orxTRUE;
+
+            /* Has payload copy? */
+            if(pstEntry->u32PayloadSize != 0)
+            {
+              /* Points to it */
+              pstEntry->stEvent.pstPayload = pstEntry + 1;
+            }
+
+            /* Coalescable? */
+            if(pstEntry->bCoalesce != orxFALSE)
+            {
+              orxEVENT_POST_ENTRY  *pstPrevious;
+              orxU64                u64Key;
+
+              /* Gets its key */
+              u64Key = orxEvent_GetCoalesceKey(pstEntry);
+
+              /* Gets previous entry */
+              pstPrevious = (orxEVENT_POST_ENTRY *)orxHashTable_Get(sstEvent.pstCoalesceTable, u64Key);
+
+              /* Found? */
+              if(pstPrevious != orxNULL)
+              {
+                /* Identical? */
+                if(orxEvent_IsSamePost(pstEntry, pstPrevious) != orxFALSE)
+                {
+                  /* Drops it */
+                  bKeep = orxFALSE;
+                }
+              }
+              else
+              {
+                /* Stores it */
+                orxHashTable_Add(sstEvent.pstCoalesceTable, u64Key, pstEntry);
+              }
+            }
+
+            /* Should keep it? */
+            if(bKeep != orxFALSE)
+            {
+              /* Needs to grow the lists? */
+              if(u32Count == sstEvent.u32PostListSize)
+              {
+                orxEVENT_POST_ENTRY **apstPostList;
+                orxEVENT             *astBatchList;
+                orxU32                u32Size;
+
+                /* Gets new size */
+                u32Size = (sstEvent.u32PostListSize != 0) ? sstEvent.u32PostListSize << 1 : orxEVENT_KU32_POST_LIST_SIZE;
+
+                /* Grows them */
+                apstPostList = (orxEVENT_POST_ENTRY **)orxMemory_Reallocate(sstEvent.apstPostList, u32Size * sizeof(orxEVENT_POST_ENTRY *));
+                if(apstPostList != orxNULL)
+                {
+                  sstEvent.apstPostList = apstPostList;
+                }
+                astBatchList = (orxEVENT *)orxMemory_Reallocate(sstEvent.astBatchList, u32Size * sizeof(orxEVENT));
+                if(astBatchList != orxNULL)
+                {
+                  sstEvent.astBatchList = astBatchList;
+                }
+
+                /* Success? */
+                if((apstPostList != orxNULL) && (astBatchList != orxNULL))
+                {
+                  /* Stores new size */
+                  sstEvent.u32PostListSize = u32Size;
+                }
+                else
+                {
+                  /* Logs message */
+                  orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Couldn't grow posted event list: dropping event [%u:%u].", pstEntry->stEvent.eType, pstEntry->stEvent.eID);
+
+                  /* Updates result */
+                  eResult = orxSTATUS_FAILURE;
+                }
+              }
+
+              /* Has room? */
+              if(u32Count < sstEvent.u32PostListSize)
+              {
+                /* Stores it */
+                sstEvent.apstPostList[u32Count++] = pstEntry;
+              }
+            }
+
+            /* Updates tail */
+            u32Tail += pstEntry->u32Size;
+          }
+        }
+
+        /* Stores new tail */
+        au32TailList[i] = u32Tail;
+      }
+    }
+
+    /* For all posted events */
+    for(i = 0; i < u32Count; i++)
+    {
+      orxEVENT_POST_ENTRY      *pstEntry;
+      orxEVENT_HANDLER_STORAGE *pstStorage;
+
+      /* Gets it */
+      pstEntry = sstEvent.apstPostList[i];
+
+      /* Gets corresponding storage */
+      pstStorage = (pstEntry->stEvent.eType < orxEVENT_TYPE_CORE_NUMBER) ? sstEvent.astCoreHandlerStorageList[pstEntry->stEvent.eType] : (orxEVENT_HANDLER_STORAGE *)orxHashTable_Get(sstEvent.pstHandlerStorageTable, pstEntry->stEvent.eType);
+
+      /* Valid? */
+      if(pstStorage != orxNULL)
+      {
+        /* Sends it to all its event handlers */
+        orxEvent_SendToStorage(pstStorage, &(pstEntry->stEvent), orxFALSE);
+      }
+    }
+
+    /* For all posted events */
+    for(i = 0; i < u32Count; i++)
+    {
+      orxEVENT_POST_ENTRY *pstEntry;
+
+      /* Gets it */
+      pstEntry = sstEvent.apstPostList[i];
+
+      /* Not batched yet? */
+      if(pstEntry->bBatched == orxFALSE)
+      {
+        orxEVENT_HANDLER_STORAGE *pstStorage;
+
+        /* Gets corresponding storage */
+        pstStorage = (pstEntry->stEvent.eType < orxEVENT_TYPE_CORE_NUMBER) ? sstEvent.astCoreHandlerStorageList[pstEntry->stEvent.eType] : (orxEVENT_HANDLER_STORAGE *)orxHashTable_Get(sstEvent.pstHandlerStorageTable, pstEntry->stEvent.eType);
+
+        /* Has batch handlers? */
+        if((pstStorage != orxNULL) && (pstStorage->u32BatchCount != 0))
+        {
+          /* Sends all events of this type */
+          orxEvent_SendPostBatch(pstStorage, i, u32Count);
+        }
+      }
+    }
+
+    /* Clears coalesce table */
+    orxHashTable_Clear(sstEvent.pstCoalesceTable);
+
+    /* Makes sure all entries have been consumed before releasing them */
+    orxMEMORY_BARRIER();
+
+    /* For all threads */
+    for(i = 0; i < orxTHREAD_KU32_MAX_THREAD_NUMBER; i++)
+    {
+      /* Has queue? */
+      if(apstQueueList[i] != orxNULL)
+      {
+        /* Releases dispatched entries */
+        apstQueueList[i]->u32Tail = au32TailList[i];
+      }
+    }
+
+    /* Updates status */
+    orxFLAG_SET(sstEvent.u32Flags, orxEVENT_KU32_STATIC_FLAG_NONE, orxEVENT_KU32_STATIC_FLAG_DISPATCH);
+
+    /* Profiles */
+    orxPROFILER_POP_MARKER();
+  }
+  else
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Can't dispatch posted events: already dispatching.");
+
+    /* Updates result */
+    eResult = orxSTATUS_FAILURE;
+  }
+
+  /* Done! */
+  return eResult;
+}
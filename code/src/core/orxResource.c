@@ -37,6 +37,7 @@
 #include "core/orxCommand.h"
 #include "core/orxConfig.h"
 #include "core/orxEvent.h"
+#include "core/orxSystem.h"
 #include "core/orxThread.h"
 #include "debug/orxProfiler.h"
 #include "io/orxFile.h"
@@ -52,6 +53,15 @@
 
 #endif /* __orxANDROID__ || __orxANDROID_NATIVE__ */
 
+#ifdef __orxLINUX__
+
+#include <sys/inotify.h>
+#include <unistd.h>
+#include <limits.h>
+#include <stdlib.h>
+
+#endif /* __orxLINUX__ */
+
 /** Module flags
  */
 #define orxRESOURCE_KU32_STATIC_FLAG_NONE             0x00000000                      /**< No flags */
@@ -60,6 +70,7 @@
 #define orxRESOURCE_KU32_STATIC_FLAG_CONFIG_LOADED    0x00000002                      /**< Config loaded flag */
 #define orxRESOURCE_KU32_STATIC_FLAG_WATCH_SET        0x00000004                      /**< Watch set flag */
 #define orxRESOURCE_KU32_STATIC_FLAG_NOTIFY_SET       0x00000008                      /**< Notify set flag */
+#define orxRESOURCE_KU32_STATIC_FLAG_POOL_SET         0x00000010                      /**< Pool set flag */
 
 #define orxRESOURCE_KU32_STATIC_MASK_ALL              0xFFFFFFFF                      /**< All mask */
 
@@ -75,18 +86,38 @@
 #define orxRESOURCE_KU32_TYPE_BANK_SIZE               8                               /**< Type bank size */
 
 #define orxRESOURCE_KU32_OPEN_INFO_BANK_SIZE          64                              /**< Open resource info bank size */
+#define orxRESOURCE_KU32_LOCATION_TABLE_SIZE          256                             /**< Location table size */
+#define orxRESOURCE_KU32_PACK_BANK_SIZE               16                              /**< Pack bank size */
+#define orxRESOURCE_KU32_PACK_TABLE_SIZE              16                              /**< Pack table size */
+
+#define orxRESOURCE_KU32_PACK_MAX_BLOCK_SIZE          0x00400000                      /**< Max pack block size */
+#define orxRESOURCE_PACK_GET_MAX_STORED_SIZE(SIZE)    ((SIZE) + ((SIZE) / 255) + 16)  /**< Max stored size of a compressed block */
 
 #define orxRESOURCE_KU32_WATCH_ITERATION_LIMIT        2                               /**< Watch iteration limit */
 #define orxRESOURCE_KU32_WATCH_TIME_UNINITIALIZED     -1                              /**< Watch time uninitialized */
 #define orxRESOURCE_KF_WATCH_NOTIFICATION_DELAY       0.2                             /**< Watch notification delay */
+#define orxRESOURCE_KS32_WATCH_ID_NONE                -1                              /**< No system watch ID: resource is polled */
+
+#ifdef __orxLINUX__
+
+#define orxRESOURCE_KU32_WATCH_TABLE_SIZE             256                             /**< System watch table size */
+#define orxRESOURCE_KU32_WATCH_FOLDER_TABLE_SIZE      32                              /**< System watch folder table size */
+#define orxRESOURCE_KU32_WATCH_EVENT_BUFFER_SIZE      4096                            /**< System watch event buffer size */
+#define orxRESOURCE_KU32_WATCH_EVENT_MASK             (IN_CLOSE_WRITE | IN_MOVED_TO | IN_MOVED_FROM | IN_CREATE | IN_DELETE | IN_ATTRIB) /**< System watch event mask */
+
+#endif /* __orxLINUX__ */
 
 #define orxRESOURCE_KU32_BUFFER_SIZE                  256                             /**< Buffer size */
 
 #define orxRESOURCE_KZ_CONFIG_SECTION                 "Resource"                      /**< Config section name */
 #define orxRESOURCE_KZ_CONFIG_WATCH_LIST              "WatchList"                     /**< Config watch list */
+#define orxRESOURCE_KZ_CONFIG_THREAD_NUMBER           "ThreadNumber"                  /**< Config thread number */
 
 #define orxRESOURCE_KU32_REQUEST_LIST_SIZE            2048                            /**< Request list size */
 
+#define orxRESOURCE_KU32_MAX_THREAD_NUMBER            4                               /**< Max thread number */
+#define orxRESOURCE_KU32_DEFAULT_THREAD_NUMBER        2                               /**< Default thread number */
+
 #define orxRESOURCE_KZ_THREAD_NAME                    "Resource"
 
 
@@ -111,6 +142,8 @@ typedef struct __orxRESOURCE_GROUP_t
   orxLINKLIST               stStorageList;                                            /**< Group storage list */
   orxBANK                  *pstStorageBank;                                           /**< Group storage bank */
   orxHASHTABLE             *pstCacheTable;                                            /**< Group cache table */
+  orxRESOURCE_STATS         stStats;                                                  /**< Group stats */
+  orxBOOL                   bWatch;                                                   /**< Is watched? */
 
 } orxRESOURCE_GROUP;
 
@@ -129,9 +162,11 @@ typedef struct __orxRESOURCE_INFO_t
 {
   orxSTRING                 zLocation;                                                /**< Resource literal location */
   orxRESOURCE_TYPE_INFO    *pstTypeInfo;                                              /**< Resource type info */
+  struct __orxRESOURCE_INFO_t *pstNextWatch;                                          /**< Next resource info sharing the same system watch key */
   orxS64                    s64Time;                                                  /**< Resource modification time */
   orxSTRINGID               stGroupID;                                                /**< Group ID */
   orxSTRINGID               stNameID;                                                 /**< Name ID */
+  orxS32                    s32WatchID;                                               /**< System watch ID, orxRESOURCE_KS32_WATCH_ID_NONE if polled */
 
 } orxRESOURCE_INFO;
 
@@ -142,10 +177,49 @@ typedef struct __orxRESOURCE_OPEN_INFO_t
   orxRESOURCE_TYPE_INFO    *pstTypeInfo;                                              /**< Resource type info */
   orxHANDLE                 hResource;                                                /**< Resource handle */
   orxSTRING                 zLocation;                                                /**< Resource location */
+  orxRESOURCE_GROUP        *pstGroup;                                                 /**< Resource group, if known */
+  orxRESOURCE_PRIORITY      ePriority;                                                /**< Priority of upcoming requests */
+  orxU32                    u32RequestCount;                                          /**< Issued request count */
+  orxU32                    u32ServiceCount;                                          /**< Serviced request count */
   volatile orxU32           u32OpCount;                                               /**< Operation count */
+  const void               *pMapData;                                                 /**< Mapped data */
+  orxS64                    s64MapSize;                                               /**< Mapped data size */
+  orxBOOL                   bMapCopy;                                                 /**< Mapped data is a copy */
 
 } orxRESOURCE_OPEN_INFO;
 
+/** Pack
+ */
+typedef struct __orxRESOURCE_PACK_t
+{
+  orxRESOURCE_PACK_HEADER   stHeader;                                                 /**< Header */
+  orxFILE                  *pstFile;                                                  /**< Pack file, orxNULL if the storage isn't a pack */
+  orxTHREAD_SEMAPHORE      *pstSemaphore;                                             /**< File access semaphore */
+  orxU8                    *pu8TOC;                                                   /**< Table of contents */
+  orxU32                   *au32SlotList;                                             /**< Hash slot list */
+  orxRESOURCE_PACK_ENTRY   *astEntryList;                                             /**< Entry list */
+  orxCHAR                  *acNameList;                                               /**< Name list */
+  const orxU8              *pu8Map;                                                   /**< Mapped pack, shared by all its entries */
+  orxS64                    s64MapSize;                                               /**< Mapped pack size, -1 if it couldn't be mapped */
+
+} orxRESOURCE_PACK;
+
+/** Pack handle
+ */
+typedef struct __orxRESOURCE_PACK_HANDLE_t
+{
+  orxRESOURCE_PACK         *pstPack;                                                  /**< Pack */
+  const orxRESOURCE_PACK_ENTRY *pstEntry;                                             /**< Entry */
+  orxU8                    *pu8Block;                                                 /**< Decoded block */
+  orxU8                    *pu8StoredBlock;                                           /**< Stored block */
+  orxS64                    s64Cursor;                                                /**< Cursor */
+  orxS64                    s64BlockStart;                                            /**< Decoded block start */
+  orxS64                    s64BlockSize;                                             /**< Decoded block size */
+  orxS64                    s64NextBlockOffset;                                       /**< Next block offset in pack */
+  orxS64                    s64NextBlockStart;                                        /**< Next block start */
+
+} orxRESOURCE_PACK_HANDLE;
+
 /** Request type enum
  */
 typedef enum __orxRESOURCE_REQUEST_TYPE_t
@@ -154,6 +228,7 @@ typedef enum __orxRESOURCE_REQUEST_TYPE_t
   orxRESOURCE_REQUEST_TYPE_WRITE,
   orxRESOURCE_REQUEST_TYPE_CLOSE,
   orxRESOURCE_REQUEST_TYPE_GET_TIME,
+  orxRESOURCE_REQUEST_TYPE_CANCEL,
 
   orxRESOURCE_REQUEST_TYPE_NUMBER,
 
@@ -165,12 +240,15 @@ typedef enum __orxRESOURCE_REQUEST_TYPE_t
  */
 typedef struct __orxRESOURCE_REQUEST_t
 {
+  orxLINKLIST_NODE          stNode;                                                   /**< Linklist node */
+  orxDOUBLE                 dTime;                                                    /**< Request issue time */
   orxS64                    s64Size;                                                  /**< Request buffer size */
   void                     *pBuffer;                                                  /**< Request buffer */
   orxRESOURCE_OP_FUNCTION   pfnCallback;                                              /**< Request completion callback */
   void                     *pContext;                                                 /**< Request context */
   orxRESOURCE_OPEN_INFO    *pstResourceInfo;                                          /**< Request open resource info */
   orxRESOURCE_REQUEST_TYPE  eType;                                                    /**< Request type */
+  orxU32                    u32Sequence;                                              /**< Request sequence in its resource */
 
 } orxRESOURCE_REQUEST;
 
@@ -180,8 +258,11 @@ typedef struct __orxRESOURCE_STATIC_t
 {
   orxBANK                  *pstGroupBank;                                             /**< Group bank */
   orxBANK                  *pstTypeBank;                                              /**< Type info bank */
+  orxBANK                  *pstPackBank;                                              /**< Pack bank */
+  orxHASHTABLE             *pstPackTable;                                             /**< Pack table */
   orxBANK                  *pstResourceInfoBank;                                      /**< Resource info bank */
   orxBANK                  *pstOpenInfoBank;                                          /**< Open resource table size */
+  orxHASHTABLE             *pstLocationTable;                                         /**< Location table */
   orxTHREAD_SEMAPHORE*      pstRequestSemaphore;                                      /**< Request semaphore */
   orxTHREAD_SEMAPHORE*      pstWorkerSemaphore;                                       /**< Worker semaphore */
   orxLINKLIST               stTypeList;                                               /**< Type list */
@@ -189,13 +270,26 @@ typedef struct __orxRESOURCE_STATIC_t
   orxSTRINGID               stLastWatchedGroupID;                                     /**< Last watched group ID */
   volatile orxSTATUS        eThreadResult;                                            /**< Thread result */
   orxCHAR                   acFileLocationBuffer[orxRESOURCE_KU32_BUFFER_SIZE];       /**< File location buffer size */
-  volatile orxRESOURCE_REQUEST astRequestList[orxRESOURCE_KU32_REQUEST_LIST_SIZE];    /**< Request list */
-  volatile orxU32           u32RequestInIndex;                                        /**< Request in index */
-  volatile orxU32           u32RequestProcessIndex;                                   /**< Request process index */
-  volatile orxU32           u32RequestOutIndex;                                       /**< Request out index */
-  orxU32                    u32RequestThreadID;                                       /**< Request thread ID */
+  orxCHAR                   acPackLocationBuffer[orxRESOURCE_KU32_BUFFER_SIZE];       /**< Pack location buffer size */
+  orxRESOURCE_REQUEST       astRequestList[orxRESOURCE_KU32_REQUEST_LIST_SIZE];       /**< Request list */
+  orxLINKLIST               astPendingList[orxRESOURCE_PRIORITY_NUMBER];              /**< Pending request lists, per priority */
+  orxLINKLIST               stDoneList;                                               /**< Serviced request list */
+  orxLINKLIST               stFreeList;                                               /**< Free request list */
+  orxRESOURCE_STATS         stStats;                                                  /**< Global stats */
+  volatile orxU32           u32PendingCount;                                          /**< Pending request count (queued or being serviced) */
+  orxU32                    au32ThreadList[orxRESOURCE_KU32_MAX_THREAD_NUMBER];       /**< Request thread IDs */
+  orxU32                    u32ThreadCount;                                           /**< Request thread count */
+  orxU32                    u32PollCount;                                             /**< Number of watched resources that need polling */
   orxU32                    u32Flags;                                                 /**< Control flags */
 
+#ifdef __orxLINUX__
+
+  orxHASHTABLE             *pstWatchTable;                                            /**< System watch table: path CRC -> resource info */
+  orxHASHTABLE             *pstWatchFolderTable;                                      /**< System watch folder table: watch ID -> folder */
+  int                       iWatchFD;                                                 /**< System watch file descriptor */
+
+#endif /* __orxLINUX__ */
+
 } orxRESOURCE_STATIC;
 
 
@@ -214,10 +308,19 @@ static orxRESOURCE_STATIC sstResource;
 
 static const orxSTRING orxFASTCALL orxResource_File_Locate(const orxSTRING _zStorage, const orxSTRING _zName, orxBOOL _bRequireExistence)
 {
-  const orxSTRING zResult = orxNULL;
+  const orxRESOURCE_PACK *pstPack;
+  const orxSTRING         zResult = orxNULL;
 
+  /* Gets pack */
+  pstPack = (const orxRESOURCE_PACK *)orxHashTable_Get(sstResource.pstPackTable, orxString_ToCRC(_zStorage));
+
+  /* Storage is a pack? */
+  if((pstPack != orxNULL) && (pstPack->pstFile != orxNULL))
+  {
+    /* Don't probe the file system */
+  }
   /* Default storage? */
-  if(orxString_Compare(_zStorage, orxRESOURCE_KZ_DEFAULT_STORAGE) == 0)
+  else if(orxString_Compare(_zStorage, orxRESOURCE_KZ_DEFAULT_STORAGE) == 0)
   {
     /* Uses name as path */
     orxString_NPrint(sstResource.acFileLocationBuffer, orxRESOURCE_KU32_BUFFER_SIZE - 1, "%s", _zName);
@@ -383,296 +486,1470 @@ static orxSTATUS orxFASTCALL orxResource_File_Delete(const orxSTRING _zLocation)
   return eResult;
 }
 
-static orxINLINE void orxResource_DeleteGroup(orxRESOURCE_GROUP *_pstGroup)
+static const void *orxFASTCALL orxResource_File_Map(orxHANDLE _hResource, orxS64 *_ps64Size)
 {
-  orxRESOURCE_INFO *pstResourceInfo;
-  orxU64            u64Key;
-  orxHANDLE         hIterator;
-
-  /* For all cached resources */
-  for(hIterator = orxHashTable_GetNext(_pstGroup->pstCacheTable, orxHANDLE_UNDEFINED, &u64Key, (void **)&pstResourceInfo);
-      hIterator != orxHANDLE_UNDEFINED;
-      hIterator = orxHashTable_GetNext(_pstGroup->pstCacheTable, hIterator, &u64Key, (void **)&pstResourceInfo))
-  {
-    /* Deletes its location */
-    orxMemory_Free(pstResourceInfo->zLocation);
+  orxFILE    *pstFile;
+  const void *pResult;
 
-    /* Frees it */
-    orxBank_Free(sstResource.pstResourceInfoBank, pstResourceInfo);
-  }
+  /* Gets file */
+  pstFile = (orxFILE *)_hResource;
 
-  /* Deletes cache table */
-  orxHashTable_Delete(_pstGroup->pstCacheTable);
+  /* Updates result */
+  pResult = orxFile_Map(pstFile, _ps64Size);
 
-  /* Deletes storage bank */
-  orxBank_Delete(_pstGroup->pstStorageBank);
+  /* Done! */
+  return pResult;
+}
 
-  /* Deletes it */
-  orxBank_Free(sstResource.pstGroupBank, _pstGroup);
+static void orxFASTCALL orxResource_File_Unmap(orxHANDLE _hResource, const void *_pData, orxS64 _s64Size)
+{
+  /* Unmaps data */
+  orxFile_Unmap(_pData, _s64Size);
 
   /* Done! */
   return;
 }
 
-static orxINLINE orxRESOURCE_GROUP *orxResource_CreateGroup(orxSTRINGID _stGroupID)
+static orxS32 orxFASTCALL orxResource_Pack_Decode(const orxU8 *_pu8Src, orxS32 _s32SrcSize, orxU8 *_pu8Dst, orxS32 _s32DstSize)
 {
-  orxRESOURCE_GROUP *pstResult;
-
-  /* Creates group */
-  pstResult = (orxRESOURCE_GROUP *)orxBank_Allocate(sstResource.pstGroupBank);
-
-  /* Success? */
-  if(pstResult != orxNULL)
+  const orxU8  *pu8Src, *pu8SrcEnd;
+  orxU8        *pu8Dst, *pu8DstEnd;
+  orxS32        s32Result = -1;
+
+  /* Inits pointers */
+  pu8Src    = _pu8Src;
+  pu8SrcEnd = _pu8Src + _s32SrcSize;
+  pu8Dst    = _pu8Dst;
+  pu8DstEnd = _pu8Dst + _s32DstSize;
+
+  /* For all sequences */
+  while(pu8Src < pu8SrcEnd)
   {
-    orxRESOURCE_STORAGE *pstStorage;
-
-    /* Inits it */
-    pstResult->stID           = _stGroupID;
-    pstResult->pstStorageBank = orxBank_Create(orxRESOURCE_KU32_STORAGE_BANK_SIZE, sizeof(orxRESOURCE_STORAGE), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
-    pstResult->pstCacheTable  = orxHashTable_Create(orxRESOURCE_KU32_CACHE_TABLE_SIZE, orxHASHTABLE_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
-    orxMemory_Zero(&(pstResult->stStorageList), sizeof(orxLINKLIST));
+    const orxU8  *pu8Match;
+    orxU32        u32Token, u32Length, u32Offset;
 
-    /* Creates storage */
-    pstStorage = (orxRESOURCE_STORAGE *)orxBank_Allocate(pstResult->pstStorageBank);
+    /* Gets token */
+    u32Token  = *pu8Src++;
 
-    /* Success? */
-    if(pstStorage != orxNULL)
+    /* Gets literal length */
+    u32Length = u32Token >> 4;
+    if(u32Length == 15)
     {
-      /* Stores its content */
-      pstStorage->stStorageID = orxString_GetID(orxRESOURCE_KZ_DEFAULT_STORAGE);
-
-      /* Clears node */
-      orxMemory_Zero(&(pstStorage->stNode), sizeof(orxLINKLIST_NODE));
+      orxU32 u32Byte;
 
-      /* Adds it first */
-      orxLinkList_AddStart(&(pstResult->stStorageList), &(pstStorage->stNode));
+      do
+      {
+        /* Out of data? */
+        if(pu8Src >= pu8SrcEnd)
+        {
+          return -1;
+        }
+        u32Byte     = *pu8Src++;
+        u32Length  += u32Byte;
+      } while(u32Byte == 255);
     }
-    else
+
+    /* Invalid literals? */
+    if((u32Length > (orxU32)(pu8SrcEnd - pu8Src)) || (u32Length > (orxU32)(pu8DstEnd - pu8Dst)))
     {
-      /* Deletes it */
-      orxResource_DeleteGroup(pstResult);
+      break;
+    }
 
+    /* Copies literals */
+    orxMemory_Copy(pu8Dst, pu8Src, u32Length);
+    pu8Src += u32Length;
+    pu8Dst += u32Length;
+
+    /* Last sequence? */
+    if(pu8Src == pu8SrcEnd)
+    {
       /* Updates result */
-      pstResult = orxNULL;
-    }
-  }
+      s32Result = (orxS32)(pu8Dst - _pu8Dst);
 
-  /* Done! */
-  return pstResult;
-}
+      break;
+    }
 
-static void orxFASTCALL orxResource_NotifyRequest(const orxCLOCK_INFO *_pstClockInfo, void *_pContext)
-{
-  /* Profiles */
-  orxPROFILER_PUSH_MARKER("orxResource_NotifyRequest");
+    /* Out of data? */
+    if(pu8SrcEnd - pu8Src < 2)
+    {
+      break;
+    }
 
-  /* While there are processed requests */
-  while(sstResource.u32RequestOutIndex != sstResource.u32RequestProcessIndex)
-  {
-    volatile orxRESOURCE_REQUEST *pstRequest;
+    /* Gets match offset */
+    u32Offset = (orxU32)pu8Src[0] | ((orxU32)pu8Src[1] << 8);
+    pu8Src   += 2;
 
-    /* Gets request */
-    pstRequest = &(sstResource.astRequestList[sstResource.u32RequestOutIndex]);
+    /* Invalid? */
+    if((u32Offset == 0) || (u32Offset > (orxU32)(pu8Dst - _pu8Dst)))
+    {
+      break;
+    }
 
-    /* Has callback? */
-    if(pstRequest->pfnCallback != orxNULL)
+    /* Gets match length */
+    u32Length = u32Token & 0x0F;
+    if(u32Length == 15)
     {
-      /* Notifies it */
-      pstRequest->pfnCallback((orxHANDLE)pstRequest->pstResourceInfo, pstRequest->s64Size, pstRequest->pBuffer, pstRequest->pContext);
+      orxU32 u32Byte;
+
+      do
+      {
+        /* Out of data? */
+        if(pu8Src >= pu8SrcEnd)
+        {
+          return -1;
+        }
+        u32Byte     = *pu8Src++;
+        u32Length  += u32Byte;
+      } while(u32Byte == 255);
     }
+    u32Length += 4;
 
-    /* Decrements operation count */
-    if(pstRequest->pstResourceInfo != orxNULL)
+    /* Invalid match? */
+    if(u32Length > (orxU32)(pu8DstEnd - pu8Dst))
     {
-      pstRequest->pstResourceInfo->u32OpCount--;
+      break;
     }
 
-    /* Updates request out index */
-    orxMEMORY_BARRIER();
-    sstResource.u32RequestOutIndex = (sstResource.u32RequestOutIndex + 1) & (orxRESOURCE_KU32_REQUEST_LIST_SIZE - 1);
+    /* Copies match (byte per byte as it can overlap) */
+    for(pu8Match = pu8Dst - u32Offset; u32Length != 0; u32Length--)
+    {
+      *pu8Dst++ = *pu8Match++;
+    }
   }
 
-  /* Profiles */
-  orxPROFILER_POP_MARKER();
-
   /* Done! */
-  return;
+  return s32Result;
 }
 
-static orxSTATUS orxFASTCALL orxResource_ProcessRequests(void *_pContext)
+static orxRESOURCE_PACK *orxFASTCALL orxResource_Pack_Get(const orxSTRING _zStorage)
 {
-  orxSTATUS eResult;
+  orxRESOURCE_PACK *pstResult;
+  orxSTRINGID       stKey;
 
-  /* Waits for worker semaphore */
-  orxThread_WaitSemaphore(sstResource.pstWorkerSemaphore);
+  /* Gets storage key */
+  stKey = orxString_ToCRC(_zStorage);
 
-  /* Profiles */
-  orxPROFILER_PUSH_MARKER("orxResource_ProcessRequests");
+  /* Gets pack */
+  pstResult = (orxRESOURCE_PACK *)orxHashTable_Get(sstResource.pstPackTable, stKey);
 
-  /* While there are pending requests */
-  while(sstResource.u32RequestProcessIndex != sstResource.u32RequestInIndex)
+  /* Not already probed? */
+  if(pstResult == orxNULL)
   {
-    volatile orxRESOURCE_REQUEST *pstRequest;
-
-    /* Gets request */
-    pstRequest = &(sstResource.astRequestList[sstResource.u32RequestProcessIndex]);
+    /* Allocates pack */
+    pstResult = (orxRESOURCE_PACK *)orxBank_Allocate(sstResource.pstPackBank);
 
-    /* Depending on request type */
-    switch(pstRequest->eType)
+    /* Success? */
+    if(pstResult != orxNULL)
     {
-      case orxRESOURCE_REQUEST_TYPE_READ:
-      {
-        /* Services it */
-        pstRequest->s64Size = pstRequest->pstResourceInfo->pstTypeInfo->pfnRead(pstRequest->pstResourceInfo->hResource, pstRequest->s64Size, pstRequest->pBuffer);
+      /* Inits it */
+      orxMemory_Zero(pstResult, sizeof(orxRESOURCE_PACK));
 
-        break;
-      }
+      /* Stores it, even if storage isn't a pack, so as to only probe it once */
+      orxHashTable_Add(sstResource.pstPackTable, stKey, pstResult);
+    }
 
-      case orxRESOURCE_REQUEST_TYPE_WRITE:
-      {
-        /* Services it */
-        pstRequest->s64Size = pstRequest->pstResourceInfo->pstTypeInfo->pfnWrite(pstRequest->pstResourceInfo->hResource, pstRequest->s64Size, pstRequest->pBuffer);
+    /* Not the default storage? */
+    if((pstResult != orxNULL)
+    && (orxString_Compare(_zStorage, orxRESOURCE_KZ_DEFAULT_STORAGE) != 0))
+    {
+      orxFILE *pstFile;
 
-        break;
-      }
+      /* Opens it */
+      pstFile = orxFile_Open(_zStorage, orxFILE_KU32_FLAG_OPEN_READ | orxFILE_KU32_FLAG_OPEN_BINARY);
 
-      case orxRESOURCE_REQUEST_TYPE_CLOSE:
+      /* Success? */
+      if(pstFile != orxNULL)
       {
-        /* Services it */
-        pstRequest->pstResourceInfo->pstTypeInfo->pfnClose(pstRequest->pstResourceInfo->hResource);
+        orxRESOURCE_PACK_HEADER stHeader;
+        orxS64                  s64FileSize;
+        orxU64                  u64TOCSize = 0;
+
+        /* Gets file size */
+        s64FileSize = orxFile_GetSize(pstFile);
+
+        /* Is a valid pack? */
+        if((s64FileSize >= (orxS64)sizeof(orxRESOURCE_PACK_HEADER))
+        && (orxFile_Read(&stHeader, sizeof(orxRESOURCE_PACK_HEADER), 1, pstFile) == 1)
+        && (stHeader.u32Magic == orxRESOURCE_KU32_PACK_MAGIC)
+        && (stHeader.u32Version == orxRESOURCE_KU32_PACK_VERSION)
+        && (stHeader.u32SlotCount > stHeader.u32EntryCount)
+        && (stHeader.u32SlotCount >= 2)
+        && (orxMath_IsPowerOfTwo(stHeader.u32SlotCount) != orxFALSE)
+        && (stHeader.u32NameSize != 0)
+        && (stHeader.u32BlockSize != 0)
+        && (stHeader.u32BlockSize <= orxRESOURCE_KU32_PACK_MAX_BLOCK_SIZE)
+        && ((u64TOCSize = (orxU64)stHeader.u32SlotCount * (orxU64)sizeof(orxU32) + (orxU64)stHeader.u32EntryCount * (orxU64)sizeof(orxRESOURCE_PACK_ENTRY) + (orxU64)stHeader.u32NameSize) <= (orxU64)(s64FileSize - (orxS64)sizeof(orxRESOURCE_PACK_HEADER)))
+        && (u64TOCSize < (orxU64)orxU32_UNDEFINED))
+        {
+          /* Incompatible string IDs? */
+          if(stHeader.u32IDVersion != orxString_GetIDVersion())
+          {
+            /* Logs message */
+            orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Can't mount pack <%s>: built with string ID version %u, expected %u. Please rebuild it with a matching orxPack.", _zStorage, stHeader.u32IDVersion, orxString_GetIDVersion());
+          }
+          /* Allocates table of contents & loads it */
+          else if(((pstResult->pu8TOC = (orxU8 *)orxMemory_Allocate((orxU32)u64TOCSize, orxMEMORY_TYPE_MAIN)) != orxNULL)
+               && (orxFile_Read(pstResult->pu8TOC, (orxS64)u64TOCSize, 1, pstFile) == 1))
+          {
+            orxU32 i;
 
-        /* Deletes location */
-        orxString_Delete(pstRequest->pstResourceInfo->zLocation);
+            /* Inits pack */
+            orxMemory_Copy(&(pstResult->stHeader), &stHeader, sizeof(orxRESOURCE_PACK_HEADER));
+            pstResult->au32SlotList = (orxU32 *)pstResult->pu8TOC;
+            pstResult->astEntryList = (orxRESOURCE_PACK_ENTRY *)(pstResult->pu8TOC + stHeader.u32SlotCount * sizeof(orxU32));
+            pstResult->acNameList   = (orxCHAR *)(pstResult->pu8TOC + stHeader.u32SlotCount * sizeof(orxU32) + stHeader.u32EntryCount * sizeof(orxRESOURCE_PACK_ENTRY));
 
-        /* Frees open info */
-        orxBank_Free(sstResource.pstOpenInfoBank, pstRequest->pstResourceInfo);
-        pstRequest->pstResourceInfo = orxNULL;
+            /* Checks slots */
+            for(i = 0; (i < stHeader.u32SlotCount) && (pstResult->au32SlotList[i] <= stHeader.u32EntryCount); i++)
+            ;
 
-        break;
-      }
+            /* Valid? */
+            if((i == stHeader.u32SlotCount)
+            && (pstResult->acNameList[stHeader.u32NameSize - 1] == orxCHAR_NULL))
+            {
+              orxS64 s64DataOffset;
 
-      case orxRESOURCE_REQUEST_TYPE_GET_TIME:
-      {
-        orxRESOURCE_INFO *pstResourceInfo;
+              /* Gets data offset */
+              s64DataOffset = (orxS64)sizeof(orxRESOURCE_PACK_HEADER) + (orxS64)u64TOCSize;
 
-        /* Gets resource info */
-        pstResourceInfo = (orxRESOURCE_INFO *)pstRequest->pContext;
+              /* For all entries */
+              for(i = 0; i < stHeader.u32EntryCount; i++)
+              {
+                const orxRESOURCE_PACK_ENTRY *pstEntry;
+
+                /* Gets it */
+                pstEntry = &(pstResult->astEntryList[i]);
+
+                /* Invalid name or data outside of the pack? */
+                if((pstEntry->u32NameOffset >= stHeader.u32NameSize)
+                || (pstEntry->s64Offset < s64DataOffset)
+                || (pstEntry->s64Offset > s64FileSize)
+                || (pstEntry->s64StoredSize < 0)
+                || (pstEntry->s64StoredSize > s64FileSize - pstEntry->s64Offset)
+                || (pstEntry->s64Size < 0)
+                || ((!orxFLAG_TEST(pstEntry->u32Flags, orxRESOURCE_KU32_PACK_ENTRY_FLAG_COMPRESSED)) && (pstEntry->s64Size != pstEntry->s64StoredSize)))
+                {
+                  break;
+                }
+              }
 
-        /* Gets its modification time (cheating for the storage) */
-        pstRequest->s64Size = pstResourceInfo->pstTypeInfo->pfnGetTime(pstResourceInfo->zLocation + orxString_GetLength(pstResourceInfo->pstTypeInfo->zTag) + 1);
+              /* Valid? */
+              if(i == stHeader.u32EntryCount)
+              {
+                /* Creates its semaphore */
+                pstResult->pstSemaphore = orxThread_CreateSemaphore(1);
+
+                /* Success? */
+                if(pstResult->pstSemaphore != orxNULL)
+                {
+                  /* Stores file */
+                  pstResult->pstFile = pstFile;
+                }
+              }
+            }
+          }
 
-        break;
-      }
+          /* Failure? */
+          if(pstResult->pstFile == orxNULL)
+          {
+            /* Has table of contents? */
+            if(pstResult->pu8TOC != orxNULL)
+            {
+              /* Deletes it */
+              orxMemory_Free(pstResult->pu8TOC);
+              pstResult->pu8TOC = orxNULL;
+            }
 
-      default:
-      {
-        break;
+            /* Not an ID version mismatch? */
+            if(stHeader.u32IDVersion == orxString_GetIDVersion())
+            {
+              /* Logs message */
+              orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Can't mount pack <%s>: invalid table of contents.", _zStorage);
+            }
+          }
+        }
+
+        /* Not a pack? */
+        if(pstResult->pstFile == orxNULL)
+        {
+          /* Closes file */
+          orxFile_Close(pstFile);
+        }
       }
     }
-
-    /* Updates request process index */
-    orxMEMORY_BARRIER();
-    sstResource.u32RequestProcessIndex = (sstResource.u32RequestProcessIndex + 1) & (orxRESOURCE_KU32_REQUEST_LIST_SIZE - 1);
   }
 
-  /* Profiles */
-  orxPROFILER_POP_MARKER();
-
-  /* Updates result */
-  eResult = sstResource.eThreadResult;
-
   /* Done! */
-  return eResult;
+  return pstResult;
 }
 
-static void orxResource_AddRequest(orxRESOURCE_REQUEST_TYPE _eType, orxS64 _s64Size, void *_pBuffer, orxRESOURCE_OP_FUNCTION _pfnCallback, void *_pContext, orxRESOURCE_OPEN_INFO *_pstResourceInfo)
+static const orxRESOURCE_PACK_ENTRY *orxFASTCALL orxResource_Pack_FindEntry(const orxRESOURCE_PACK *_pstPack, const orxSTRING _zName)
 {
-  orxU32  u32NextRequestIndex;
-  orxBOOL bAdd = orxTRUE;
+  const orxRESOURCE_PACK_ENTRY *pstResult = orxNULL;
+  orxSTRINGID                   stCRC;
+  orxU32                        u32Mask, u32Index, i;
 
-  /* Checks */
-  orxASSERT(orxThread_GetCurrent() == orxTHREAD_KU32_MAIN_THREAD_ID);
-
-  /* Waits for semaphore */
-  orxThread_WaitSemaphore(sstResource.pstRequestSemaphore);
+  /* Gets name CRC */
+  stCRC   = orxString_ToCRC(_zName);
 
-  /* Gets next request index */
-  u32NextRequestIndex = (sstResource.u32RequestInIndex + 1) & (orxRESOURCE_KU32_REQUEST_LIST_SIZE - 1);
+  /* Gets slot mask */
+  u32Mask = _pstPack->stHeader.u32SlotCount - 1;
 
-  /* Time request? */
-  if(_eType == orxRESOURCE_REQUEST_TYPE_GET_TIME)
+  /* For all slots, starting from the hashed one */
+  for(i = 0, u32Index = (orxU32)stCRC & u32Mask;
+      (i < _pstPack->stHeader.u32SlotCount) && (_pstPack->au32SlotList[u32Index] != 0);
+      i++, u32Index = (u32Index + 1) & u32Mask)
   {
-    orxU32 u32InIndex, u32ProcessIndex, u32FreeSlots;
-
-    /* Gets indices */
-    u32InIndex      = sstResource.u32RequestInIndex;
-    u32ProcessIndex = sstResource.u32RequestProcessIndex;
+    const orxRESOURCE_PACK_ENTRY *pstEntry;
 
-    /* Gets number of free slots */
-    u32FreeSlots = (u32InIndex >= u32ProcessIndex) ? orxRESOURCE_KU32_REQUEST_LIST_SIZE - u32InIndex + u32ProcessIndex : u32ProcessIndex - u32InIndex;
+    /* Gets entry */
+    pstEntry = &(_pstPack->astEntryList[_pstPack->au32SlotList[u32Index] - 1]);
 
-    /* More than a quarter of the slots are free? */
-    if(u32FreeSlots >= orxRESOURCE_KU32_REQUEST_LIST_SIZE / 4)
-    {
-      /* Process addition */
-      bAdd = orxTRUE;
-    }
-    else
+    /* Found? */
+    if((pstEntry->u32NameCRC == (orxU32)stCRC)
+    && (orxString_Compare(_pstPack->acNameList + pstEntry->u32NameOffset, _zName) == 0))
     {
-      /* Drops request */
-      bAdd = orxFALSE;
+      /* Updates result */
+      pstResult = pstEntry;
+
+      break;
     }
   }
-  else
+
+  /* Done! */
+  return pstResult;
+}
+
+static const orxSTRING orxFASTCALL orxResource_Pack_GetEntryName(const orxSTRING _zLocation, orxCHAR *_acStorage)
+{
+  const orxSTRING zResult = orxNULL;
+  const orxCHAR  *pc;
+
+  /* Finds last separator */
+  for(pc = _zLocation + orxString_GetLength(_zLocation); (pc > _zLocation) && (*(pc - 1) != orxRESOURCE_KC_PACK_SEPARATOR); pc--)
+  ;
+
+  /* Found? */
+  if((pc > _zLocation) && ((orxU32)(pc - _zLocation) <= orxRESOURCE_KU32_BUFFER_SIZE))
   {
-    /* Waits for a free slot */
-    while(u32NextRequestIndex == sstResource.u32RequestOutIndex)
-    {
-      /* Main thread? */
-      if(orxThread_GetCurrent() == orxTHREAD_KU32_MAIN_THREAD_ID)
-      {
-        /* Manually pumps some request notifications */
-        orxResource_NotifyRequest(orxNULL, orxNULL);
-      }
-    }
+    /* Stores storage */
+    orxMemory_Copy(_acStorage, _zLocation, (orxU32)(pc - _zLocation) - 1);
+    _acStorage[pc - _zLocation - 1] = orxCHAR_NULL;
 
-    /* Process addition */
-    bAdd = orxTRUE;
+    /* Updates result */
+    zResult = pc;
   }
 
-  /* Should add request? */
-  if(bAdd != orxFALSE)
-  {
-    volatile orxRESOURCE_REQUEST *pstRequest;
+  /* Done! */
+  return zResult;
+}
 
-    /* Gets current request */
-    pstRequest = &(sstResource.astRequestList[sstResource.u32RequestInIndex]);
+static const orxSTRING orxFASTCALL orxResource_Pack_Locate(const orxSTRING _zStorage, const orxSTRING _zName, orxBOOL _bRequireExistence)
+{
+  orxRESOURCE_PACK *pstPack;
+  const orxSTRING   zResult = orxNULL;
 
-    /* Inits it */
-    if(_pstResourceInfo != orxNULL)
-    {
-      _pstResourceInfo->u32OpCount++;
-    }
-    pstRequest->s64Size         = _s64Size;
-    pstRequest->pBuffer         = _pBuffer;
-    pstRequest->pfnCallback     = _pfnCallback;
-    pstRequest->pContext        = _pContext;
-    pstRequest->pstResourceInfo = _pstResourceInfo;
-    pstRequest->eType           = _eType;
+  /* Gets pack */
+  pstPack = orxResource_Pack_Get(_zStorage);
 
-    /* Commits request */
-    orxMEMORY_BARRIER();
-    sstResource.u32RequestInIndex = u32NextRequestIndex;
+  /* Valid and has entry? (packs are read-only, existence is always required) */
+  if((pstPack != orxNULL)
+  && (pstPack->pstFile != orxNULL)
+  && (orxResource_Pack_FindEntry(pstPack, _zName) != orxNULL))
+  {
+    /* Composes location */
+    orxString_NPrint(sstResource.acPackLocationBuffer, orxRESOURCE_KU32_BUFFER_SIZE - 1, "%s%c%s", _zStorage, orxRESOURCE_KC_PACK_SEPARATOR, _zName);
 
-    /* Signals worker semaphore */
-    orxThread_SignalSemaphore(sstResource.pstWorkerSemaphore);
+    /* Updates result */
+    zResult = sstResource.acPackLocationBuffer;
   }
 
-  /* Signals semaphore */
-  orxThread_SignalSemaphore(sstResource.pstRequestSemaphore);
+  /* Done! */
+  return zResult;
 }
 
-static void orxFASTCALL orxResource_NotifyUpdateChange(const orxCLOCK_INFO *_pstClockInfo, void *_pContext)
+static orxS64 orxFASTCALL orxResource_Pack_GetTime(const orxSTRING _zLocation)
+{
+  orxCHAR       acStorage[orxRESOURCE_KU32_BUFFER_SIZE];
+  orxFILE_INFO  stFileInfo;
+  orxS64        s64Result = 0;
+
+  /* Gets pack file info (pack's table of contents won't get reloaded, only the pack itself is checked) */
+  if((orxResource_Pack_GetEntryName(_zLocation, acStorage) != orxNULL)
+  && (orxFile_GetInfo(acStorage, &stFileInfo) != orxSTATUS_FAILURE))
+  {
+    /* Updates result */
+    s64Result = stFileInfo.s64TimeStamp;
+  }
+
+  /* Done! */
+  return s64Result;
+}
+
+static orxHANDLE orxFASTCALL orxResource_Pack_Open(const orxSTRING _zLocation, orxBOOL _bEraseMode)
+{
+  orxHANDLE hResult = orxHANDLE_UNDEFINED;
+
+  /* Not in erase mode? (packs are read-only) */
+  if(_bEraseMode == orxFALSE)
+  {
+    orxCHAR         acStorage[orxRESOURCE_KU32_BUFFER_SIZE];
+    const orxSTRING zName;
+
+    /* Gets entry name */
+    zName = orxResource_Pack_GetEntryName(_zLocation, acStorage);
+
+    /* Valid? */
+    if(zName != orxNULL)
+    {
+      orxRESOURCE_PACK *pstPack;
+
+      /* Gets pack */
+      pstPack = orxResource_Pack_Get(acStorage);
+
+      /* Valid? */
+      if((pstPack != orxNULL) && (pstPack->pstFile != orxNULL))
+      {
+        const orxRESOURCE_PACK_ENTRY *pstEntry;
+
+        /* Finds entry */
+        pstEntry = orxResource_Pack_FindEntry(pstPack, zName);
+
+        /* Found? */
+        if(pstEntry != orxNULL)
+        {
+          orxRESOURCE_PACK_HANDLE *pstHandle;
+
+          /* Allocates handle */
+          pstHandle = (orxRESOURCE_PACK_HANDLE *)orxMemory_Allocate(sizeof(orxRESOURCE_PACK_HANDLE), orxMEMORY_TYPE_MAIN);
+
+          /* Checks */
+          orxASSERT(pstHandle != orxNULL);
+
+          /* Inits it */
+          orxMemory_Zero(pstHandle, sizeof(orxRESOURCE_PACK_HANDLE));
+          pstHandle->pstPack            = pstPack;
+          pstHandle->pstEntry           = pstEntry;
+          pstHandle->s64NextBlockOffset = pstEntry->s64Offset;
+
+          /* Updates result */
+          hResult = (orxHANDLE)pstHandle;
+        }
+      }
+    }
+  }
+
+  /* Done! */
+  return hResult;
+}
+
+static void orxFASTCALL orxResource_Pack_Close(orxHANDLE _hResource)
+{
+  orxRESOURCE_PACK_HANDLE *pstHandle;
+
+  /* Gets handle */
+  pstHandle = (orxRESOURCE_PACK_HANDLE *)_hResource;
+
+  /* Has block buffer? */
+  if(pstHandle->pu8Block != orxNULL)
+  {
+    /* Deletes it */
+    orxMemory_Free(pstHandle->pu8Block);
+  }
+
+  /* Deletes handle */
+  orxMemory_Free(pstHandle);
+
+  /* Done! */
+  return;
+}
+
+static orxS64 orxFASTCALL orxResource_Pack_GetSize(orxHANDLE _hResource)
+{
+  orxRESOURCE_PACK_HANDLE  *pstHandle;
+  orxS64                    s64Result;
+
+  /* Gets handle */
+  pstHandle = (orxRESOURCE_PACK_HANDLE *)_hResource;
+
+  /* Updates result */
+  s64Result = pstHandle->pstEntry->s64Size;
+
+  /* Done! */
+  return s64Result;
+}
+
+static orxS64 orxFASTCALL orxResource_Pack_Seek(orxHANDLE _hResource, orxS64 _s64Offset, orxSEEK_OFFSET_WHENCE _eWhence)
+{
+  orxRESOURCE_PACK_HANDLE  *pstHandle;
+  orxS64                    s64Cursor;
+
+  /* Gets handle */
+  pstHandle = (orxRESOURCE_PACK_HANDLE *)_hResource;
+
+  /* Depending on whence */
+  switch(_eWhence)
+  {
+    case orxSEEK_OFFSET_WHENCE_CURRENT:
+    {
+      s64Cursor = pstHandle->s64Cursor + _s64Offset;
+      break;
+    }
+
+    case orxSEEK_OFFSET_WHENCE_END:
+    {
+      s64Cursor = pstHandle->pstEntry->s64Size + _s64Offset;
+      break;
+    }
+
+    default:
+    {
+      s64Cursor = _s64Offset;
+      break;
+    }
+  }
+
+  /* Updates cursor */
+  pstHandle->s64Cursor = orxCLAMP(s64Cursor, 0, pstHandle->pstEntry->s64Size);
+
+  /* Done! */
+  return pstHandle->s64Cursor;
+}
+
+static orxS64 orxFASTCALL orxResource_Pack_Tell(orxHANDLE _hResource)
+{
+  orxRESOURCE_PACK_HANDLE  *pstHandle;
+  orxS64                    s64Result;
+
+  /* Gets handle */
+  pstHandle = (orxRESOURCE_PACK_HANDLE *)_hResource;
+
+  /* Updates result */
+  s64Result = pstHandle->s64Cursor;
+
+  /* Done! */
+  return s64Result;
+}
+
+static orxS64 orxFASTCALL orxResource_Pack_Read(orxHANDLE _hResource, orxS64 _s64Size, void *_pBuffer)
+{
+  orxRESOURCE_PACK_HANDLE      *pstHandle;
+  const orxRESOURCE_PACK_ENTRY *pstEntry;
+  orxRESOURCE_PACK             *pstPack;
+  orxS64                        s64Result = 0;
+
+  /* Gets handle */
+  pstHandle = (orxRESOURCE_PACK_HANDLE *)_hResource;
+  pstEntry  = pstHandle->pstEntry;
+  pstPack   = pstHandle->pstPack;
+
+  /* Clamps size */
+  _s64Size  = orxMIN(_s64Size, pstEntry->s64Size - pstHandle->s64Cursor);
+
+  /* Not compressed? */
+  if(!orxFLAG_TEST(pstEntry->u32Flags, orxRESOURCE_KU32_PACK_ENTRY_FLAG_COMPRESSED))
+  {
+    /* Has something to read? */
+    if(_s64Size > 0)
+    {
+      /* Waits for semaphore */
+      orxThread_WaitSemaphore(pstPack->pstSemaphore);
+
+      /* Reads data */
+      if(orxFile_Seek(pstPack->pstFile, pstEntry->s64Offset + pstHandle->s64Cursor, orxSEEK_OFFSET_WHENCE_START) >= 0)
+      {
+        s64Result = orxFile_Read(_pBuffer, sizeof(orxU8), _s64Size, pstPack->pstFile);
+      }
+
+      /* Signals semaphore */
+      orxThread_SignalSemaphore(pstPack->pstSemaphore);
+
+      /* Updates cursor */
+      pstHandle->s64Cursor += s64Result;
+    }
+  }
+  else
+  {
+    orxU32 u32BlockSize;
+
+    /* Gets block size */
+    u32BlockSize = pstPack->stHeader.u32BlockSize;
+
+    /* Doesn't have block buffers yet? */
+    if((pstHandle->pu8Block == orxNULL) && (_s64Size > 0))
+    {
+      /* Allocates them: decoded block, followed by stored block */
+      pstHandle->pu8Block       = (orxU8 *)orxMemory_Allocate(u32BlockSize + orxRESOURCE_PACK_GET_MAX_STORED_SIZE(u32BlockSize), orxMEMORY_TYPE_MAIN);
+      pstHandle->pu8StoredBlock = pstHandle->pu8Block + u32BlockSize;
+    }
+
+    /* While there's something to read */
+    while((_s64Size > 0) && (pstHandle->pu8Block != orxNULL))
+    {
+      orxS64 s64CopySize;
+
+      /* Cursor outside of the decoded block? */
+      if((pstHandle->s64Cursor < pstHandle->s64BlockStart) || (pstHandle->s64Cursor >= pstHandle->s64BlockStart + pstHandle->s64BlockSize))
+      {
+        orxU32  u32Stored = 0, u32BlockLength = 0;
+        orxBOOL bValid = orxFALSE;
+
+        /* Cursor before next block? */
+        if(pstHandle->s64Cursor < pstHandle->s64NextBlockStart)
+        {
+          /* Rewinds */
+          pstHandle->s64NextBlockOffset = pstEntry->s64Offset;
+          pstHandle->s64NextBlockStart  = 0;
+        }
+
+        /* Clears decoded block */
+        pstHandle->s64BlockSize = 0;
+
+        /* Waits for semaphore */
+        orxThread_WaitSemaphore(pstPack->pstSemaphore);
+
+        /* Seeks next block */
+        if(orxFile_Seek(pstPack->pstFile, pstHandle->s64NextBlockOffset, orxSEEK_OFFSET_WHENCE_START) >= 0)
+        {
+          /* For all blocks up to the one containing the cursor */
+          while(orxFile_Read(&u32Stored, sizeof(orxU32), 1, pstPack->pstFile) == 1)
+          {
+            /* Gets its decoded length */
+            u32BlockLength = (orxU32)orxMIN((orxS64)u32BlockSize, pstEntry->s64Size - pstHandle->s64NextBlockStart);
+
+            /* Invalid? */
+            if((u32Stored & orxRESOURCE_KU32_PACK_BLOCK_MASK_SIZE) > orxRESOURCE_PACK_GET_MAX_STORED_SIZE(u32BlockSize))
+            {
+              break;
+            }
+
+            /* Contains cursor? */
+            if(pstHandle->s64Cursor < pstHandle->s64NextBlockStart + u32BlockLength)
+            {
+              /* Reads it */
+              bValid = (orxFile_Read(pstHandle->pu8StoredBlock, sizeof(orxU8), u32Stored & orxRESOURCE_KU32_PACK_BLOCK_MASK_SIZE, pstPack->pstFile) == (orxS64)(u32Stored & orxRESOURCE_KU32_PACK_BLOCK_MASK_SIZE)) ? orxTRUE : orxFALSE;
+
+              break;
+            }
+            else
+            {
+              /* Skips it */
+              pstHandle->s64NextBlockOffset  += sizeof(orxU32) + (u32Stored & orxRESOURCE_KU32_PACK_BLOCK_MASK_SIZE);
+              pstHandle->s64NextBlockStart   += u32BlockLength;
+              if(orxFile_Seek(pstPack->pstFile, pstHandle->s64NextBlockOffset, orxSEEK_OFFSET_WHENCE_START) < 0)
+              {
+                break;
+              }
+            }
+          }
+        }
+
+        /* Signals semaphore */
+        orxThread_SignalSemaphore(pstPack->pstSemaphore);
+
+        /* Valid? */
+        if(bValid != orxFALSE)
+        {
+          /* Raw block? */
+          if(orxFLAG_TEST(u32Stored, orxRESOURCE_KU32_PACK_BLOCK_FLAG_RAW))
+          {
+            /* Checks size */
+            if((u32Stored & orxRESOURCE_KU32_PACK_BLOCK_MASK_SIZE) == u32BlockLength)
+            {
+              /* Copies it */
+              orxMemory_Copy(pstHandle->pu8Block, pstHandle->pu8StoredBlock, u32BlockLength);
+            }
+            else
+            {
+              bValid = orxFALSE;
+            }
+          }
+          else
+          {
+            /* Decodes it */
+            bValid = (orxResource_Pack_Decode(pstHandle->pu8StoredBlock, (orxS32)u32Stored, pstHandle->pu8Block, (orxS32)u32BlockLength) == (orxS32)u32BlockLength) ? orxTRUE : orxFALSE;
+          }
+        }
+
+        /* Success? */
+        if(bValid != orxFALSE)
+        {
+          /* Updates decoded block */
+          pstHandle->s64BlockStart        = pstHandle->s64NextBlockStart;
+          pstHandle->s64BlockSize         = u32BlockLength;
+          pstHandle->s64NextBlockOffset  += sizeof(orxU32) + (u32Stored & orxRESOURCE_KU32_PACK_BLOCK_MASK_SIZE);
+          pstHandle->s64NextBlockStart   += u32BlockLength;
+        }
+        else
+        {
+          /* Logs message */
+          orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Can't read entry <%s> from pack: corrupted data.", pstPack->acNameList + pstEntry->u32NameOffset);
+
+          /* Rewinds */
+          pstHandle->s64NextBlockOffset   = pstEntry->s64Offset;
+          pstHandle->s64NextBlockStart    = 0;
+
+          break;
+        }
+      }
+
+      /* Copies decoded data */
+      s64CopySize = orxMIN(_s64Size, pstHandle->s64BlockStart + pstHandle->s64BlockSize - pstHandle->s64Cursor);
+      orxMemory_Copy((orxU8 *)_pBuffer + s64Result, pstHandle->pu8Block + (pstHandle->s64Cursor - pstHandle->s64BlockStart), (orxU32)s64CopySize);
+
+      /* Updates status */
+      pstHandle->s64Cursor += s64CopySize;
+      s64Result            += s64CopySize;
+      _s64Size             -= s64CopySize;
+    }
+  }
+
+  /* Done! */
+  return s64Result;
+}
+
+static const void *orxFASTCALL orxResource_Pack_Map(orxHANDLE _hResource, orxS64 *_ps64Size)
+{
+  orxRESOURCE_PACK_HANDLE  *pstHandle;
+  const void               *pResult = orxNULL;
+
+  /* Gets handle */
+  pstHandle = (orxRESOURCE_PACK_HANDLE *)_hResource;
+
+  /* Stored as is and not empty? */
+  if(!orxFLAG_TEST(pstHandle->pstEntry->u32Flags, orxRESOURCE_KU32_PACK_ENTRY_FLAG_COMPRESSED)
+  && (pstHandle->pstEntry->s64Size > 0))
+  {
+    orxRESOURCE_PACK *pstPack;
+
+    /* Gets pack */
+    pstPack = pstHandle->pstPack;
+
+    /* Waits for file access */
+    orxThread_WaitSemaphore(pstPack->pstSemaphore);
+
+    /* Not mapped yet? */
+    if(pstPack->s64MapSize == 0)
+    {
+      /* Maps the whole pack */
+      pstPack->pu8Map = (const orxU8 *)orxFile_Map(pstPack->pstFile, &(pstPack->s64MapSize));
+
+      /* Failure? */
+      if(pstPack->pu8Map == orxNULL)
+      {
+        /* Don't try again */
+        pstPack->s64MapSize = -1;
+      }
+    }
+
+    /* Valid entry in the mapped pack? */
+    if((pstPack->pu8Map != orxNULL)
+    && (pstHandle->pstEntry->s64Offset >= 0)
+    && (pstHandle->pstEntry->s64Offset + pstHandle->pstEntry->s64Size <= pstPack->s64MapSize))
+    {
+      /* Updates result */
+      pResult     = pstPack->pu8Map + pstHandle->pstEntry->s64Offset;
+      *_ps64Size  = pstHandle->pstEntry->s64Size;
+    }
+
+    /* Releases file access */
+    orxThread_SignalSemaphore(pstPack->pstSemaphore);
+  }
+
+  /* Done! */
+  return pResult;
+}
+
+static void orxFASTCALL orxResource_Pack_Unmap(orxHANDLE _hResource, const void *_pData, orxS64 _s64Size)
+{
+  /* Nothing to do, the mapping is shared by all the entries and released with the pack */
+  return;
+}
+
+static void orxFASTCALL orxResource_Pack_Delete(orxRESOURCE_PACK *_pstPack)
+{
+  /* Mounted? */
+  if(_pstPack->pstFile != orxNULL)
+  {
+    /* Was mapped? */
+    if(_pstPack->pu8Map != orxNULL)
+    {
+      /* Unmaps it */
+      orxFile_Unmap(_pstPack->pu8Map, _pstPack->s64MapSize);
+    }
+
+    /* Closes its file */
+    orxFile_Close(_pstPack->pstFile);
+
+    /* Deletes its semaphore */
+    orxThread_DeleteSemaphore(_pstPack->pstSemaphore);
+
+    /* Deletes its table of contents */
+    orxMemory_Free(_pstPack->pu8TOC);
+  }
+
+  /* Frees it */
+  orxBank_Free(sstResource.pstPackBank, _pstPack);
+
+  /* Done! */
+  return;
+}
+
+static orxBOOL orxFASTCALL orxResource_IsWatchedGroup(orxSTRINGID _stGroupID)
+{
+  orxS32  i, s32ListCount;
+  orxBOOL bResult = orxFALSE;
+
+  /* Pushes config section */
+  orxConfig_PushSection(orxRESOURCE_KZ_CONFIG_SECTION);
+
+  /* For all watched groups */
+  for(i = 0, s32ListCount = orxConfig_GetListCount(orxRESOURCE_KZ_CONFIG_WATCH_LIST); i < s32ListCount; i++)
+  {
+    /* Found? */
+    if(orxString_ToCRC(orxConfig_GetListString(orxRESOURCE_KZ_CONFIG_WATCH_LIST, i)) == _stGroupID)
+    {
+      /* Updates result */
+      bResult = orxTRUE;
+
+      break;
+    }
+  }
+
+  /* Pops config section */
+  orxConfig_PopSection();
+
+  /* Done! */
+  return bResult;
+}
+
+static orxINLINE void orxResource_DeleteGroup(orxRESOURCE_GROUP *_pstGroup)
+{
+  orxRESOURCE_INFO *pstResourceInfo;
+  orxU64            u64Key;
+  orxHANDLE         hIterator;
+
+  /* For all cached resources */
+  for(hIterator = orxHashTable_GetNext(_pstGroup->pstCacheTable, orxHANDLE_UNDEFINED, &u64Key, (void **)&pstResourceInfo);
+      hIterator != orxHANDLE_UNDEFINED;
+      hIterator = orxHashTable_GetNext(_pstGroup->pstCacheTable, hIterator, &u64Key, (void **)&pstResourceInfo))
+  {
+    /* Deletes its location */
+    orxMemory_Free(pstResourceInfo->zLocation);
+
+    /* Frees it */
+    orxBank_Free(sstResource.pstResourceInfoBank, pstResourceInfo);
+  }
+
+  /* Deletes cache table */
+  orxHashTable_Delete(_pstGroup->pstCacheTable);
+
+  /* Deletes storage bank */
+  orxBank_Delete(_pstGroup->pstStorageBank);
+
+  /* Deletes it */
+  orxBank_Free(sstResource.pstGroupBank, _pstGroup);
+
+  /* Done! */
+  return;
+}
+
+static orxINLINE orxRESOURCE_GROUP *orxResource_CreateGroup(orxSTRINGID _stGroupID)
+{
+  orxRESOURCE_GROUP *pstResult;
+
+  /* Creates group */
+  pstResult = (orxRESOURCE_GROUP *)orxBank_Allocate(sstResource.pstGroupBank);
+
+  /* Success? */
+  if(pstResult != orxNULL)
+  {
+    orxRESOURCE_STORAGE *pstStorage;
+
+    /* Inits it */
+    pstResult->stID           = _stGroupID;
+    pstResult->pstStorageBank = orxBank_Create(orxRESOURCE_KU32_STORAGE_BANK_SIZE, sizeof(orxRESOURCE_STORAGE), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+    pstResult->pstCacheTable  = orxHashTable_Create(orxRESOURCE_KU32_CACHE_TABLE_SIZE, orxHASHTABLE_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+    orxMemory_Zero(&(pstResult->stStorageList), sizeof(orxLINKLIST));
+    orxMemory_Zero(&(pstResult->stStats), sizeof(orxRESOURCE_STATS));
+    pstResult->bWatch         = orxFLAG_TEST(sstResource.u32Flags, orxRESOURCE_KU32_STATIC_FLAG_WATCH_SET) ? orxResource_IsWatchedGroup(_stGroupID) : orxFALSE;
+
+    /* Creates storage */
+    pstStorage = (orxRESOURCE_STORAGE *)orxBank_Allocate(pstResult->pstStorageBank);
+
+    /* Success? */
+    if(pstStorage != orxNULL)
+    {
+      /* Stores its content */
+      pstStorage->stStorageID = orxString_GetID(orxRESOURCE_KZ_DEFAULT_STORAGE);
+
+      /* Clears node */
+      orxMemory_Zero(&(pstStorage->stNode), sizeof(orxLINKLIST_NODE));
+
+      /* Adds it first */
+      orxLinkList_AddStart(&(pstResult->stStorageList), &(pstStorage->stNode));
+    }
+    else
+    {
+      /* Deletes it */
+      orxResource_DeleteGroup(pstResult);
+
+      /* Updates result */
+      pstResult = orxNULL;
+    }
+  }
+
+  /* Done! */
+  return pstResult;
+}
+
+static void orxFASTCALL orxResource_NotifyRequest(const orxCLOCK_INFO *_pstClockInfo, void *_pContext)
+{
+  /* Profiles */
+  orxPROFILER_PUSH_MARKER("orxResource_NotifyRequest");
+
+  /* While there are serviced requests */
+  while(orxLinkList_GetCount(&(sstResource.stDoneList)) != 0)
+  {
+    orxRESOURCE_REQUEST *pstRequest;
+
+    /* Waits for semaphore */
+    orxThread_WaitSemaphore(sstResource.pstRequestSemaphore);
+
+    /* Gets first serviced request */
+    pstRequest = (orxRESOURCE_REQUEST *)orxLinkList_GetFirst(&(sstResource.stDoneList));
+
+    /* Removes it from list */
+    orxLinkList_Remove(&(pstRequest->stNode));
+
+    /* Signals semaphore */
+    orxThread_SignalSemaphore(sstResource.pstRequestSemaphore);
+
+    /* Has open resource info? */
+    if(pstRequest->pstResourceInfo != orxNULL)
+    {
+      /* Decrements operation count */
+      pstRequest->pstResourceInfo->u32OpCount--;
+
+      /* Close request? */
+      if(pstRequest->eType == orxRESOURCE_REQUEST_TYPE_CLOSE)
+      {
+        /* Deletes location */
+        orxString_Delete(pstRequest->pstResourceInfo->zLocation);
+
+        /* Frees open info */
+        orxBank_Free(sstResource.pstOpenInfoBank, pstRequest->pstResourceInfo);
+      }
+    }
+
+    /* Has callback? */
+    if(pstRequest->pfnCallback != orxNULL)
+    {
+      /* Notifies it */
+      pstRequest->pfnCallback((orxHANDLE)pstRequest->pstResourceInfo, pstRequest->s64Size, pstRequest->pBuffer, pstRequest->pContext);
+    }
+
+    /* Frees request */
+    orxLinkList_AddEnd(&(sstResource.stFreeList), &(pstRequest->stNode));
+  }
+
+  /* Profiles */
+  orxPROFILER_POP_MARKER();
+
+  /* Done! */
+  return;
+}
+
+static orxINLINE orxRESOURCE_REQUEST *orxResource_GetNextRequest()
+{
+  orxRESOURCE_REQUEST  *pstResult = orxNULL;
+  orxU32                u32Priority;
+
+  /* Waits for semaphore */
+  orxThread_WaitSemaphore(sstResource.pstRequestSemaphore);
+
+  /* For all priorities, from highest to lowest */
+  for(u32Priority = 0; (pstResult == orxNULL) && (u32Priority < orxRESOURCE_PRIORITY_NUMBER); u32Priority++)
+  {
+    orxRESOURCE_REQUEST *pstRequest;
+
+    /* For all its pending requests */
+    for(pstRequest = (orxRESOURCE_REQUEST *)orxLinkList_GetFirst(&(sstResource.astPendingList[u32Priority]));
+        pstRequest != orxNULL;
+        pstRequest = (orxRESOURCE_REQUEST *)orxLinkList_GetNext(&(pstRequest->stNode)))
+    {
+      /* Not bound to a resource or next in line for it (operations on a same resource are serviced in order)? */
+      if((pstRequest->pstResourceInfo == orxNULL)
+      || (pstRequest->u32Sequence == pstRequest->pstResourceInfo->u32ServiceCount))
+      {
+        /* Removes it from list */
+        orxLinkList_Remove(&(pstRequest->stNode));
+
+        /* Updates result */
+        pstResult = pstRequest;
+
+        break;
+      }
+    }
+  }
+
+  /* Signals semaphore */
+  orxThread_SignalSemaphore(sstResource.pstRequestSemaphore);
+
+  /* Done! */
+  return pstResult;
+}
+
+static orxINLINE void orxResource_UpdateStats(orxRESOURCE_STATS *_pstStats, const orxRESOURCE_REQUEST *_pstRequest, orxDOUBLE _dWaitTime, orxDOUBLE _dServiceTime)
+{
+  /* Depending on request type */
+  switch(_pstRequest->eType)
+  {
+    case orxRESOURCE_REQUEST_TYPE_READ:
+    {
+      /* Updates read stats */
+      _pstStats->u64ReadSize   += (_pstRequest->s64Size > 0) ? (orxU64)_pstRequest->s64Size : 0;
+      _pstStats->dReadTime     += _dServiceTime;
+      _pstStats->dWaitTime     += _dWaitTime;
+      _pstStats->u32ReadCount++;
+
+      break;
+    }
+
+    case orxRESOURCE_REQUEST_TYPE_WRITE:
+    {
+      /* Updates write stats */
+      _pstStats->u64WriteSize  += (_pstRequest->s64Size > 0) ? (orxU64)_pstRequest->s64Size : 0;
+      _pstStats->dWriteTime    += _dServiceTime;
+      _pstStats->dWaitTime     += _dWaitTime;
+      _pstStats->u32WriteCount++;
+
+      break;
+    }
+
+    case orxRESOURCE_REQUEST_TYPE_CANCEL:
+    {
+      /* Updates cancel stats */
+      _pstStats->u32CancelCount++;
+
+      break;
+    }
+
+    default:
+    {
+      break;
+    }
+  }
+
+  /* Done! */
+  return;
+}
+
+static orxSTATUS orxFASTCALL orxResource_ProcessRequests(void *_pContext)
+{
+  orxRESOURCE_REQUEST  *pstRequest;
+  orxSTATUS             eResult;
+
+  /* Waits for worker semaphore */
+  orxThread_WaitSemaphore(sstResource.pstWorkerSemaphore);
+
+  /* Profiles */
+  orxPROFILER_PUSH_MARKER("orxResource_ProcessRequests");
+
+  /* While there are requests ready to be serviced */
+  while((pstRequest = orxResource_GetNextRequest()) != orxNULL)
+  {
+    orxDOUBLE dStartTime, dEndTime;
+
+    /* Gets start time */
+    dStartTime = orxSystem_GetTime();
+
+    /* Depending on request type */
+    switch(pstRequest->eType)
+    {
+      case orxRESOURCE_REQUEST_TYPE_READ:
+      {
+        /* Services it */
+        pstRequest->s64Size = pstRequest->pstResourceInfo->pstTypeInfo->pfnRead(pstRequest->pstResourceInfo->hResource, pstRequest->s64Size, pstRequest->pBuffer);
+
+        break;
+      }
+
+      case orxRESOURCE_REQUEST_TYPE_WRITE:
+      {
+        /* Services it */
+        pstRequest->s64Size = pstRequest->pstResourceInfo->pstTypeInfo->pfnWrite(pstRequest->pstResourceInfo->hResource, pstRequest->s64Size, pstRequest->pBuffer);
+
+        break;
+      }
+
+      case orxRESOURCE_REQUEST_TYPE_CLOSE:
+      {
+        /* Unmaps it */
+        orxResource_Unmap((orxHANDLE)pstRequest->pstResourceInfo);
+
+        /* Services it */
+        pstRequest->pstResourceInfo->pstTypeInfo->pfnClose(pstRequest->pstResourceInfo->hResource);
+
+        /* Clears handle (open info will be freed upon notification) */
+        pstRequest->pstResourceInfo->hResource = orxHANDLE_UNDEFINED;
+
+        break;
+      }
+
+      case orxRESOURCE_REQUEST_TYPE_GET_TIME:
+      {
+        orxRESOURCE_INFO *pstResourceInfo;
+
+        /* Gets resource info */
+        pstResourceInfo = (orxRESOURCE_INFO *)pstRequest->pContext;
+
+        /* Gets its modification time (cheating for the storage) */
+        pstRequest->s64Size = pstResourceInfo->pstTypeInfo->pfnGetTime(pstResourceInfo->zLocation + orxString_GetLength(pstResourceInfo->pstTypeInfo->zTag) + 1);
+
+        break;
+      }
+
+      case orxRESOURCE_REQUEST_TYPE_CANCEL:
+      {
+        /* Nothing was read */
+        pstRequest->s64Size = 0;
+
+        break;
+      }
+
+      default:
+      {
+        break;
+      }
+    }
+
+    /* Gets end time */
+    dEndTime = orxSystem_GetTime();
+
+    /* Waits for semaphore */
+    orxThread_WaitSemaphore(sstResource.pstRequestSemaphore);
+
+    /* Has open resource info? */
+    if(pstRequest->pstResourceInfo != orxNULL)
+    {
+      /* Unblocks its next request */
+      pstRequest->pstResourceInfo->u32ServiceCount++;
+
+      /* Has group? */
+      if(pstRequest->pstResourceInfo->pstGroup != orxNULL)
+      {
+        /* Updates its stats */
+        orxResource_UpdateStats(&(pstRequest->pstResourceInfo->pstGroup->stStats), pstRequest, dStartTime - pstRequest->dTime, dEndTime - dStartTime);
+      }
+    }
+
+    /* Updates global stats */
+    orxResource_UpdateStats(&(sstResource.stStats), pstRequest, dStartTime - pstRequest->dTime, dEndTime - dStartTime);
+
+    /* Commits request */
+    orxLinkList_AddEnd(&(sstResource.stDoneList), &(pstRequest->stNode));
+    sstResource.u32PendingCount--;
+
+    /* Signals semaphore */
+    orxThread_SignalSemaphore(sstResource.pstRequestSemaphore);
+  }
+
+  /* Profiles */
+  orxPROFILER_POP_MARKER();
+
+  /* Updates result */
+  eResult = sstResource.eThreadResult;
+
+  /* Done! */
+  return eResult;
+}
+
+static void orxResource_AddRequest(orxRESOURCE_REQUEST_TYPE _eType, orxS64 _s64Size, void *_pBuffer, orxRESOURCE_OP_FUNCTION _pfnCallback, void *_pContext, orxRESOURCE_OPEN_INFO *_pstResourceInfo, orxRESOURCE_PRIORITY _ePriority)
+{
+  orxRESOURCE_REQUEST *pstRequest;
+
+  /* Checks */
+  orxASSERT(orxThread_GetCurrent() == orxTHREAD_KU32_MAIN_THREAD_ID);
+  orxASSERT(_ePriority < orxRESOURCE_PRIORITY_NUMBER);
+
+  /* Time request? */
+  if(_eType == orxRESOURCE_REQUEST_TYPE_GET_TIME)
+  {
+    /* More than a quarter of the slots are free? */
+    if(orxLinkList_GetCount(&(sstResource.stFreeList)) >= orxRESOURCE_KU32_REQUEST_LIST_SIZE / 4)
+    {
+      /* Gets free request */
+      pstRequest = (orxRESOURCE_REQUEST *)orxLinkList_GetFirst(&(sstResource.stFreeList));
+    }
+    else
+    {
+      /* Drops request */
+      pstRequest = orxNULL;
+    }
+  }
+  else
+  {
+    /* Waits for a free slot */
+    while((pstRequest = (orxRESOURCE_REQUEST *)orxLinkList_GetFirst(&(sstResource.stFreeList))) == orxNULL)
+    {
+      /* Manually pumps some request notifications */
+      orxResource_NotifyRequest(orxNULL, orxNULL);
+    }
+  }
+
+  /* Should add request? */
+  if(pstRequest != orxNULL)
+  {
+    /* Removes it from free list */
+    orxLinkList_Remove(&(pstRequest->stNode));
+
+    /* Inits it */
+    if(_pstResourceInfo != orxNULL)
+    {
+      _pstResourceInfo->u32OpCount++;
+      pstRequest->u32Sequence   = _pstResourceInfo->u32RequestCount++;
+    }
+    else
+    {
+      pstRequest->u32Sequence   = 0;
+    }
+    pstRequest->dTime           = orxSystem_GetTime();
+    pstRequest->s64Size         = _s64Size;
+    pstRequest->pBuffer         = _pBuffer;
+    pstRequest->pfnCallback     = _pfnCallback;
+    pstRequest->pContext        = _pContext;
+    pstRequest->pstResourceInfo = _pstResourceInfo;
+    pstRequest->eType           = _eType;
+
+    /* Waits for semaphore */
+    orxThread_WaitSemaphore(sstResource.pstRequestSemaphore);
+
+    /* Commits request */
+    orxLinkList_AddEnd(&(sstResource.astPendingList[_ePriority]), &(pstRequest->stNode));
+    sstResource.u32PendingCount++;
+
+    /* Signals semaphore */
+    orxThread_SignalSemaphore(sstResource.pstRequestSemaphore);
+
+    /* Signals worker semaphore */
+    orxThread_SignalSemaphore(sstResource.pstWorkerSemaphore);
+  }
+}
+
+static void orxResource_CancelRequests(orxRESOURCE_OPEN_INFO *_pstResourceInfo)
+{
+  orxU32 u32Priority;
+
+  /* Waits for semaphore */
+  orxThread_WaitSemaphore(sstResource.pstRequestSemaphore);
+
+  /* For all priorities */
+  for(u32Priority = 0; u32Priority < orxRESOURCE_PRIORITY_NUMBER; u32Priority++)
+  {
+    orxRESOURCE_REQUEST *pstRequest, *pstNextRequest;
+
+    /* For all its pending requests */
+    for(pstRequest = (orxRESOURCE_REQUEST *)orxLinkList_GetFirst(&(sstResource.astPendingList[u32Priority]));
+        pstRequest != orxNULL;
+        pstRequest = pstNextRequest)
+    {
+      /* Gets next request */
+      pstNextRequest = (orxRESOURCE_REQUEST *)orxLinkList_GetNext(&(pstRequest->stNode));
+
+      /* Pending read on this resource? */
+      if((pstRequest->pstResourceInfo == _pstResourceInfo)
+      && (pstRequest->eType == orxRESOURCE_REQUEST_TYPE_READ))
+      {
+        /* Cancels it: it keeps its place in the resource sequence but won't touch the resource anymore */
+        pstRequest->eType = orxRESOURCE_REQUEST_TYPE_CANCEL;
+
+        /* Moves it to the highest priority */
+        orxLinkList_Remove(&(pstRequest->stNode));
+        orxLinkList_AddEnd(&(sstResource.astPendingList[orxRESOURCE_PRIORITY_CRITICAL]), &(pstRequest->stNode));
+      }
+    }
+  }
+
+  /* Signals semaphore */
+  orxThread_SignalSemaphore(sstResource.pstRequestSemaphore);
+}
+
+#ifdef __orxLINUX__
+
+static orxINLINE orxSTRINGID orxResource_GetWatchKey(const orxSTRING _zFolder, const orxSTRING _zName)
+{
+  /* Done! */
+  return orxString_ContinueCRC(_zName, orxString_ContinueCRC("/", orxString_ToCRC(_zFolder)));
+}
+
+#endif /* __orxLINUX__ */
+
+/** Watches a resource, with the system if possible, by polling otherwise
+ * @return orxTRUE if watched by the system, orxFALSE if polled
+ */
+static orxBOOL orxFASTCALL orxResource_AddWatch(orxRESOURCE_INFO *_pstResourceInfo)
+{
+  orxBOOL bResult = orxFALSE;
+
+#ifdef __orxLINUX__
+
+  /* Has system watch instance and is a file? */
+  if((sstResource.iWatchFD >= 0) && (_pstResourceInfo->pstTypeInfo->pfnGetTime == &orxResource_File_GetTime))
+  {
+    const orxSTRING zPath;
+    const orxSTRING zName;
+    orxCHAR         acFolder[PATH_MAX], acRealFolder[PATH_MAX];
+    orxS32          s32Index, s32SeparatorIndex;
+
+    /* Gets its path */
+    zPath = _pstResourceInfo->zLocation + orxString_GetLength(_pstResourceInfo->pstTypeInfo->zTag) + 1;
+
+    /* Finds its last separator */
+    for(s32SeparatorIndex = -1, s32Index = orxString_SearchCharIndex(zPath, '/', 0);
+        s32Index >= 0;
+        s32SeparatorIndex = s32Index, s32Index = orxString_SearchCharIndex(zPath, '/', s32Index + 1))
+    ;
+
+    /* Gets its folder and name */
+    if(s32SeparatorIndex >= 0)
+    {
+      orxU32 u32Length;
+
+      u32Length = orxMIN((orxU32)orxMAX(s32SeparatorIndex, 1), sizeof(acFolder) - 1);
+      orxString_NCopy(acFolder, zPath, u32Length);
+      acFolder[u32Length] = orxCHAR_NULL;
+      zName = zPath + s32SeparatorIndex + 1;
+    }
+    else
+    {
+      orxString_NCopy(acFolder, ".", sizeof(acFolder) - 1);
+      zName = zPath;
+    }
+
+    /* Gets its canonical folder */
+    if(realpath(acFolder, acRealFolder) != NULL)
+    {
+      int iWatchID;
+
+      /* Watches it */
+      iWatchID = inotify_add_watch(sstResource.iWatchFD, acRealFolder, orxRESOURCE_KU32_WATCH_EVENT_MASK);
+
+      /* Success? */
+      if(iWatchID >= 0)
+      {
+        orxSTRINGID stKey;
+
+        /* New folder? */
+        if(orxHashTable_Get(sstResource.pstWatchFolderTable, (orxU64)iWatchID) == orxNULL)
+        {
+          /* Stores it */
+          orxHashTable_Add(sstResource.pstWatchFolderTable, (orxU64)iWatchID, orxString_Duplicate(acRealFolder));
+        }
+
+        /* Gets its key */
+        stKey = orxResource_GetWatchKey(acRealFolder, zName);
+
+        /* Links it with resources using the same path */
+        _pstResourceInfo->pstNextWatch  = (orxRESOURCE_INFO *)orxHashTable_Get(sstResource.pstWatchTable, stKey);
+        _pstResourceInfo->s32WatchID    = (orxS32)iWatchID;
+        orxHashTable_Set(sstResource.pstWatchTable, stKey, _pstResourceInfo);
+
+        /* Updates result */
+        bResult = orxTRUE;
+      }
+    }
+  }
+
+#endif /* __orxLINUX__ */
+
+  /* Not watched by the system? */
+  if(bResult == orxFALSE)
+  {
+    /* Updates poll count */
+    sstResource.u32PollCount++;
+  }
+
+  /* Done! */
+  return bResult;
+}
+
+/** Removes a resource from the watch: from the system watch table if it's still linked there, from the poll count if it's polled
+ */
+static void orxFASTCALL orxResource_RemoveWatch(orxRESOURCE_INFO *_pstResourceInfo)
+{
+#ifdef __orxLINUX__
+
+  /* Has system watch instance? */
+  if(sstResource.iWatchFD >= 0)
+  {
+    orxRESOURCE_INFO *pstFirst;
+    orxU64            u64Key;
+    orxHANDLE         hIterator;
+
+    /* For all watched paths */
+    for(hIterator = orxHashTable_GetNext(sstResource.pstWatchTable, orxHANDLE_UNDEFINED, &u64Key, (void **)&pstFirst);
+        hIterator != orxHANDLE_UNDEFINED;
+        hIterator = orxHashTable_GetNext(sstResource.pstWatchTable, hIterator, &u64Key, (void **)&pstFirst))
+    {
+      /* First resource of this path? */
+      if(pstFirst == _pstResourceInfo)
+      {
+        /* Has others? */
+        if(_pstResourceInfo->pstNextWatch != orxNULL)
+        {
+          /* Updates first resource */
+          orxHashTable_Set(sstResource.pstWatchTable, u64Key, _pstResourceInfo->pstNextWatch);
+        }
+        else
+        {
+          /* Removes path */
+          orxHashTable_Remove(sstResource.pstWatchTable, u64Key);
+        }
+
+        break;
+      }
+      else
+      {
+        orxRESOURCE_INFO *pstPrevious;
+
+        /* Finds previous resource */
+        for(pstPrevious = pstFirst; (pstPrevious->pstNextWatch != orxNULL) && (pstPrevious->pstNextWatch != _pstResourceInfo); pstPrevious = pstPrevious->pstNextWatch)
+          ;
+
+        /* Found? */
+        if(pstPrevious->pstNextWatch == _pstResourceInfo)
+        {
+          /* Unlinks it */
+          pstPrevious->pstNextWatch = _pstResourceInfo->pstNextWatch;
+
+          break;
+        }
+      }
+    }
+  }
+
+#endif /* __orxLINUX__ */
+
+  /* Was polled? */
+  if(_pstResourceInfo->s32WatchID == orxRESOURCE_KS32_WATCH_ID_NONE)
+  {
+    /* Checks */
+    orxASSERT(sstResource.u32PollCount > 0);
+
+    /* Updates poll count */
+    sstResource.u32PollCount--;
+  }
+
+  /* Clears its watch */
+  _pstResourceInfo->s32WatchID    = orxRESOURCE_KS32_WATCH_ID_NONE;
+  _pstResourceInfo->pstNextWatch  = orxNULL;
+
+  /* Done! */
+  return;
+}
+
+static void orxFASTCALL orxResource_NotifyUpdateChange(const orxCLOCK_INFO *_pstClockInfo, void *_pContext)
 {
   orxRESOURCE_INFO         *pstResourceInfo;
   orxRESOURCE_EVENT_PAYLOAD stPayload;
@@ -734,6 +2011,20 @@ static void orxFASTCALL orxResource_NotifyChange(orxHANDLE _hResource, orxS64 _s
         /* Added */
         else
         {
+#ifdef __orxLINUX__
+
+          /* Was polled after losing its system watch (ie. its folder got removed)? */
+          if((sstResource.iWatchFD >= 0)
+          && (pstResourceInfo->s32WatchID == orxRESOURCE_KS32_WATCH_ID_NONE)
+          && (pstResourceInfo->pstTypeInfo->pfnGetTime == &orxResource_File_GetTime))
+          {
+            /* Watches it again, with the system if possible */
+            orxResource_RemoveWatch(pstResourceInfo);
+            orxResource_AddWatch(pstResourceInfo);
+          }
+
+#endif /* __orxLINUX__ */
+
           /* Sends event */
           orxEVENT_SEND(orxEVENT_TYPE_RESOURCE, orxRESOURCE_EVENT_ADD, orxNULL, orxNULL, &stPayload);
         }
@@ -761,6 +2052,131 @@ static void orxFASTCALL orxResource_NotifyChange(orxHANDLE _hResource, orxS64 _s
   return;
 }
 
+#ifdef __orxLINUX__
+
+static orxINLINE void orxResource_CheckWatchedResources(orxSTRINGID _stKey)
+{
+  orxRESOURCE_INFO *pstResourceInfo;
+
+  /* For all resources using this path */
+  for(pstResourceInfo = (orxRESOURCE_INFO *)orxHashTable_Get(sstResource.pstWatchTable, _stKey);
+      pstResourceInfo != orxNULL;
+      pstResourceInfo = pstResourceInfo->pstNextWatch)
+  {
+    /* Still watched by the system? */
+    if(pstResourceInfo->s32WatchID != orxRESOURCE_KS32_WATCH_ID_NONE)
+    {
+      /* Adds request */
+      orxResource_AddRequest(orxRESOURCE_REQUEST_TYPE_GET_TIME, 0, orxNULL, &orxResource_NotifyChange, pstResourceInfo, orxNULL, orxRESOURCE_PRIORITY_BACKGROUND);
+    }
+  }
+
+  /* Done! */
+  return;
+}
+
+static void orxFASTCALL orxResource_ProcessWatchEvents()
+{
+  union
+  {
+    struct inotify_event  stEvent;
+    orxCHAR               acBuffer[orxRESOURCE_KU32_WATCH_EVENT_BUFFER_SIZE];
+  } uBuffer;
+  ssize_t sSize;
+
+  /* While there are pending system notifications */
+  while((sSize = read(sstResource.iWatchFD, &uBuffer, sizeof(uBuffer))) > 0)
+  {
+    const struct inotify_event *pstEvent;
+    const orxCHAR              *pc;
+
+    /* For all events */
+    for(pc = uBuffer.acBuffer; pc < uBuffer.acBuffer + sSize; pc += sizeof(struct inotify_event) + pstEvent->len)
+    {
+      /* Gets it */
+      pstEvent = (const struct inotify_event *)pc;
+
+      /* Lost events? */
+      if(pstEvent->mask & IN_Q_OVERFLOW)
+      {
+        orxRESOURCE_INFO *pstResourceInfo;
+        orxU64            u64Key;
+        orxHANDLE         hIterator;
+
+        /* Logs message */
+        orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "System watch queue overflowed, checking all watched resources.");
+
+        /* For all watched paths */
+        for(hIterator = orxHashTable_GetNext(sstResource.pstWatchTable, orxHANDLE_UNDEFINED, &u64Key, (void **)&pstResourceInfo);
+            hIterator != orxHANDLE_UNDEFINED;
+            hIterator = orxHashTable_GetNext(sstResource.pstWatchTable, hIterator, &u64Key, (void **)&pstResourceInfo))
+        {
+          /* Checks its resources */
+          orxResource_CheckWatchedResources((orxSTRINGID)u64Key);
+        }
+      }
+      /* Folder not watched anymore? */
+      else if(pstEvent->mask & IN_IGNORED)
+      {
+        orxSTRING zFolder;
+
+        /* Gets its folder */
+        zFolder = (orxSTRING)orxHashTable_Get(sstResource.pstWatchFolderTable, (orxU64)pstEvent->wd);
+
+        /* Valid? */
+        if(zFolder != orxNULL)
+        {
+          orxRESOURCE_INFO *pstResourceInfo;
+          orxU64            u64Key;
+          orxHANDLE         hIterator;
+
+          /* For all watched paths */
+          for(hIterator = orxHashTable_GetNext(sstResource.pstWatchTable, orxHANDLE_UNDEFINED, &u64Key, (void **)&pstResourceInfo);
+              hIterator != orxHANDLE_UNDEFINED;
+              hIterator = orxHashTable_GetNext(sstResource.pstWatchTable, hIterator, &u64Key, (void **)&pstResourceInfo))
+          {
+            /* For all their resources */
+            for(; pstResourceInfo != orxNULL; pstResourceInfo = pstResourceInfo->pstNextWatch)
+            {
+              /* Was in this folder? */
+              if(pstResourceInfo->s32WatchID == (orxS32)pstEvent->wd)
+              {
+                /* Falls back to polling */
+                pstResourceInfo->s32WatchID = orxRESOURCE_KS32_WATCH_ID_NONE;
+                sstResource.u32PollCount++;
+              }
+            }
+          }
+
+          /* Removes folder */
+          orxHashTable_Remove(sstResource.pstWatchFolderTable, (orxU64)pstEvent->wd);
+          orxString_Delete(zFolder);
+        }
+      }
+      /* Named event? */
+      else if(pstEvent->len != 0)
+      {
+        const orxSTRING zFolder;
+
+        /* Gets its folder */
+        zFolder = (const orxSTRING)orxHashTable_Get(sstResource.pstWatchFolderTable, (orxU64)pstEvent->wd);
+
+        /* Valid? */
+        if(zFolder != orxNULL)
+        {
+          /* Checks resources using this path */
+          orxResource_CheckWatchedResources(orxResource_GetWatchKey(zFolder, pstEvent->name));
+        }
+      }
+    }
+  }
+
+  /* Done! */
+  return;
+}
+
+#endif /* __orxLINUX__ */
+
 static void orxFASTCALL orxResource_Watch(const orxCLOCK_INFO *_pstClockInfo, void *_pContext)
 {
   static orxS32 ss32GroupIndex = 0;
@@ -771,11 +2187,22 @@ static void orxFASTCALL orxResource_Watch(const orxCLOCK_INFO *_pstClockInfo, vo
   /* Profiles */
   orxPROFILER_PUSH_MARKER("orxResource_Watch");
 
+#ifdef __orxLINUX__
+
+  /* Has system notifications? */
+  if(sstResource.iWatchFD >= 0)
+  {
+    /* Processes them */
+    orxResource_ProcessWatchEvents();
+  }
+
+#endif /* __orxLINUX__ */
+
   /* Pushes config section */
   orxConfig_PushSection(orxRESOURCE_KZ_CONFIG_SECTION);
 
-  /* For all watched groups */
-  for(s32ListCount = orxConfig_GetListCount(orxRESOURCE_KZ_CONFIG_WATCH_LIST); ss32GroupIndex < s32ListCount; ss32GroupIndex++)
+  /* For all watched groups, if any resource needs polling */
+  for(s32ListCount = (sstResource.u32PollCount != 0) ? orxConfig_GetListCount(orxRESOURCE_KZ_CONFIG_WATCH_LIST) : 0; ss32GroupIndex < s32ListCount; ss32GroupIndex++)
   {
     orxRESOURCE_GROUP  *pstGroup;
     orxSTRINGID         stGroupID;
@@ -811,11 +2238,11 @@ static void orxFASTCALL orxResource_Watch(const orxCLOCK_INFO *_pstClockInfo, vo
           shIterator != orxHANDLE_UNDEFINED;
           shIterator = orxHashTable_GetNext(pstGroup->pstCacheTable, shIterator, &u64Key, (void **)&pstResourceInfo))
       {
-        /* Does its type support time? */
-        if(pstResourceInfo->pstTypeInfo->pfnGetTime != orxNULL)
+        /* Not watched by the system and does its type support time? */
+        if((pstResourceInfo->s32WatchID == orxRESOURCE_KS32_WATCH_ID_NONE) && (pstResourceInfo->pstTypeInfo->pfnGetTime != orxNULL))
         {
           /* Adds request */
-          orxResource_AddRequest(orxRESOURCE_REQUEST_TYPE_GET_TIME, 0, orxNULL, &orxResource_NotifyChange, pstResourceInfo, orxNULL);
+          orxResource_AddRequest(orxRESOURCE_REQUEST_TYPE_GET_TIME, 0, orxNULL, &orxResource_NotifyChange, pstResourceInfo, orxNULL, orxRESOURCE_PRIORITY_BACKGROUND);
 
           /* Updates watch count */
           u32WatchCount++;
@@ -888,6 +2315,48 @@ static void orxResource_UpdatePostInit()
   /* Is config loaded now? */
   if(orxFLAG_TEST(sstResource.u32Flags, orxRESOURCE_KU32_STATIC_FLAG_CONFIG_LOADED))
   {
+    /* Isn't pool set? */
+    if(!orxFLAG_TEST(sstResource.u32Flags, orxRESOURCE_KU32_STATIC_FLAG_POOL_SET))
+    {
+      orxU32 u32ThreadNumber;
+
+      /* Pushes resource config section */
+      orxConfig_PushSection(orxRESOURCE_KZ_CONFIG_SECTION);
+
+      /* Gets thread number */
+      u32ThreadNumber = (orxConfig_HasValue(orxRESOURCE_KZ_CONFIG_THREAD_NUMBER) != orxFALSE) ? orxConfig_GetU32(orxRESOURCE_KZ_CONFIG_THREAD_NUMBER) : orxRESOURCE_KU32_DEFAULT_THREAD_NUMBER;
+      u32ThreadNumber = orxCLAMP(u32ThreadNumber, 1, orxRESOURCE_KU32_MAX_THREAD_NUMBER);
+
+      /* Pops config section */
+      orxConfig_PopSection();
+
+      /* Starts additional request processing threads */
+      while(sstResource.u32ThreadCount < u32ThreadNumber)
+      {
+        orxU32 u32ThreadID;
+
+        /* Starts thread */
+        u32ThreadID = orxThread_Start(&orxResource_ProcessRequests, orxRESOURCE_KZ_THREAD_NAME, orxNULL);
+
+        /* Success? */
+        if(u32ThreadID != orxU32_UNDEFINED)
+        {
+          /* Stores it */
+          sstResource.au32ThreadList[sstResource.u32ThreadCount++] = u32ThreadID;
+        }
+        else
+        {
+          /* Logs message */
+          orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Couldn't start resource thread #%u/%u, using %u thread(s) to process asynchronous operations.", sstResource.u32ThreadCount + 1, u32ThreadNumber, sstResource.u32ThreadCount);
+
+          break;
+        }
+      }
+
+      /* Updates flags */
+      orxFLAG_SET(sstResource.u32Flags, orxRESOURCE_KU32_STATIC_FLAG_POOL_SET, orxRESOURCE_KU32_STATIC_FLAG_NONE);
+    }
+
     /* Doesn't have watch */
     if(!orxFLAG_TEST(sstResource.u32Flags, orxRESOURCE_KU32_STATIC_FLAG_WATCH_SET))
     {
@@ -900,6 +2369,58 @@ static void orxResource_UpdatePostInit()
         /* Has watch list? */
         if(orxConfig_HasValue(orxRESOURCE_KZ_CONFIG_WATCH_LIST) != orxFALSE)
         {
+          orxRESOURCE_GROUP *pstGroup;
+
+#ifdef __orxLINUX__
+
+          /* Creates system watch instance */
+          sstResource.iWatchFD = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+
+          /* Success? */
+          if(sstResource.iWatchFD >= 0)
+          {
+            /* Creates system watch tables */
+            sstResource.pstWatchTable       = orxHashTable_Create(orxRESOURCE_KU32_WATCH_TABLE_SIZE, orxHASHTABLE_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+            sstResource.pstWatchFolderTable = orxHashTable_Create(orxRESOURCE_KU32_WATCH_FOLDER_TABLE_SIZE, orxHASHTABLE_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+          }
+          else
+          {
+            /* Logs message */
+            orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Couldn't create system watch instance, falling back to polling watched resources.");
+          }
+
+#endif /* __orxLINUX__ */
+
+          /* For all groups */
+          for(pstGroup = (orxRESOURCE_GROUP *)orxBank_GetNext(sstResource.pstGroupBank, orxNULL);
+              pstGroup != orxNULL;
+              pstGroup = (orxRESOURCE_GROUP *)orxBank_GetNext(sstResource.pstGroupBank, pstGroup))
+          {
+            /* Is watched? */
+            if(orxResource_IsWatchedGroup(pstGroup->stID) != orxFALSE)
+            {
+              orxRESOURCE_INFO *pstResourceInfo;
+              orxU64            u64Key;
+              orxHANDLE         hIterator;
+
+              /* Updates its status */
+              pstGroup->bWatch = orxTRUE;
+
+              /* For all its cached resources */
+              for(hIterator = orxHashTable_GetNext(pstGroup->pstCacheTable, orxHANDLE_UNDEFINED, &u64Key, (void **)&pstResourceInfo);
+                  hIterator != orxHANDLE_UNDEFINED;
+                  hIterator = orxHashTable_GetNext(pstGroup->pstCacheTable, hIterator, &u64Key, (void **)&pstResourceInfo))
+              {
+                /* Watches it: by the system? */
+                if(orxResource_AddWatch(pstResourceInfo) != orxFALSE)
+                {
+                  /* Gets its initial time */
+                  orxResource_AddRequest(orxRESOURCE_REQUEST_TYPE_GET_TIME, 0, orxNULL, &orxResource_NotifyChange, pstResourceInfo, orxNULL, orxRESOURCE_PRIORITY_BACKGROUND);
+                }
+              }
+            }
+          }
+
           /* Registers watch callbacks */
           orxClock_Register(orxClock_FindFirst(orx2F(-1.0f), orxCLOCK_TYPE_CORE), orxResource_Watch, orxNULL, orxMODULE_ID_RESOURCE, orxCLOCK_PRIORITY_LOWEST);
         }
@@ -1077,6 +2598,13 @@ orxSTATUS orxFASTCALL orxResource_Init()
     /* Cleans control structure */
     orxMemory_Zero(&sstResource, sizeof(orxRESOURCE_STATIC));
 
+#ifdef __orxLINUX__
+
+    /* Inits system watch file descriptor */
+    sstResource.iWatchFD = -1;
+
+#endif /* __orxLINUX__ */
+
     /* Creates semaphores */
     sstResource.pstRequestSemaphore = orxThread_CreateSemaphore(1);
     sstResource.pstWorkerSemaphore  = orxThread_CreateSemaphore(1);
@@ -1084,8 +2612,17 @@ orxSTATUS orxFASTCALL orxResource_Init()
     /* Valid? */
     if((sstResource.pstRequestSemaphore != orxNULL) && (sstResource.pstWorkerSemaphore != orxNULL))
     {
-      /* Inits request thread ID */
-      sstResource.u32RequestThreadID = orxU32_UNDEFINED;
+      orxU32 i;
+
+      /* For all requests */
+      for(i = 0; i < orxRESOURCE_KU32_REQUEST_LIST_SIZE; i++)
+      {
+        /* Adds it to free list */
+        orxLinkList_AddEnd(&(sstResource.stFreeList), &(sstResource.astRequestList[i].stNode));
+      }
+
+      /* Creates location table */
+      sstResource.pstLocationTable    = orxHashTable_Create(orxRESOURCE_KU32_LOCATION_TABLE_SIZE, orxHASHTABLE_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
 
       /* Creates resource info bank */
       sstResource.pstResourceInfoBank = orxBank_Create(orxRESOURCE_KU32_RESOURCE_INFO_BANK_SIZE, sizeof(orxRESOURCE_INFO), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
@@ -1099,8 +2636,14 @@ orxSTATUS orxFASTCALL orxResource_Init()
       /* Creates type info bank */
       sstResource.pstTypeBank         = orxBank_Create(orxRESOURCE_KU32_TYPE_BANK_SIZE, sizeof(orxRESOURCE_TYPE), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
 
+      /* Creates pack bank */
+      sstResource.pstPackBank         = orxBank_Create(orxRESOURCE_KU32_PACK_BANK_SIZE, sizeof(orxRESOURCE_PACK), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+
+      /* Creates pack table */
+      sstResource.pstPackTable        = orxHashTable_Create(orxRESOURCE_KU32_PACK_TABLE_SIZE, orxHASHTABLE_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+
       /* Success? */
-      if((sstResource.pstResourceInfoBank != orxNULL) && (sstResource.pstOpenInfoBank != orxNULL) && (sstResource.pstGroupBank != orxNULL) && (sstResource.pstTypeBank != orxNULL))
+      if((sstResource.pstLocationTable != orxNULL) && (sstResource.pstResourceInfoBank != orxNULL) && (sstResource.pstOpenInfoBank != orxNULL) && (sstResource.pstGroupBank != orxNULL) && (sstResource.pstTypeBank != orxNULL) && (sstResource.pstPackBank != orxNULL) && (sstResource.pstPackTable != orxNULL))
       {
         orxRESOURCE_TYPE_INFO stTypeInfo;
 
@@ -1119,10 +2662,34 @@ orxSTATUS orxFASTCALL orxResource_Init()
         stTypeInfo.pfnRead    = orxResource_File_Read;
         stTypeInfo.pfnWrite   = orxResource_File_Write;
         stTypeInfo.pfnDelete  = orxResource_File_Delete;
+        stTypeInfo.pfnMap     = orxResource_File_Map;
+        stTypeInfo.pfnUnmap   = orxResource_File_Unmap;
 
         /* Registers it */
         eResult = orxResource_RegisterType(&stTypeInfo);
 
+        /* Success? */
+        if(eResult != orxSTATUS_FAILURE)
+        {
+          /* Inits pack type */
+          stTypeInfo.zTag       = orxRESOURCE_KZ_TYPE_TAG_PACK;
+          stTypeInfo.pfnLocate  = orxResource_Pack_Locate;
+          stTypeInfo.pfnGetTime = orxResource_Pack_GetTime;
+          stTypeInfo.pfnOpen    = orxResource_Pack_Open;
+          stTypeInfo.pfnClose   = orxResource_Pack_Close;
+          stTypeInfo.pfnGetSize = orxResource_Pack_GetSize;
+          stTypeInfo.pfnSeek    = orxResource_Pack_Seek;
+          stTypeInfo.pfnTell    = orxResource_Pack_Tell;
+          stTypeInfo.pfnRead    = orxResource_Pack_Read;
+          stTypeInfo.pfnWrite   = orxNULL;
+          stTypeInfo.pfnDelete  = orxNULL;
+          stTypeInfo.pfnMap     = orxResource_Pack_Map;
+          stTypeInfo.pfnUnmap   = orxResource_Pack_Unmap;
+
+          /* Registers it (after the file type, so that packs get probed first) */
+          eResult = orxResource_RegisterType(&stTypeInfo);
+        }
+
         /* Success? */
         if(eResult != orxSTATUS_FAILURE)
         {
@@ -1132,12 +2699,15 @@ orxSTATUS orxFASTCALL orxResource_Init()
           /* Waits for worker semaphore */
           orxThread_WaitSemaphore(sstResource.pstWorkerSemaphore);
 
-          /* Starts request processing thread */
-          sstResource.u32RequestThreadID = orxThread_Start(&orxResource_ProcessRequests, orxRESOURCE_KZ_THREAD_NAME, orxNULL);
+          /* Starts first request processing thread, the others will be started once config is available */
+          sstResource.au32ThreadList[0] = orxThread_Start(&orxResource_ProcessRequests, orxRESOURCE_KZ_THREAD_NAME, orxNULL);
 
           /* Success? */
-          if(sstResource.u32RequestThreadID != orxU32_UNDEFINED)
+          if(sstResource.au32ThreadList[0] != orxU32_UNDEFINED)
           {
+            /* Updates thread count */
+            sstResource.u32ThreadCount = 1;
+
             /* Registers commands */
             orxResource_RegisterCommands();
 
@@ -1171,6 +2741,12 @@ orxSTATUS orxFASTCALL orxResource_Init()
         orxThread_DeleteSemaphore(sstResource.pstWorkerSemaphore);
       }
 
+      /* Deletes location table */
+      if(sstResource.pstLocationTable != orxNULL)
+      {
+        orxHashTable_Delete(sstResource.pstLocationTable);
+      }
+
       /* Deletes info bank */
       if(sstResource.pstResourceInfoBank != orxNULL)
       {
@@ -1195,12 +2771,16 @@ orxSTATUS orxFASTCALL orxResource_Init()
         orxBank_Delete(sstResource.pstTypeBank);
       }
 
-      /* Has request thread? */
-      if(sstResource.u32RequestThreadID != orxU32_UNDEFINED)
+      /* Deletes pack bank */
+      if(sstResource.pstPackBank != orxNULL)
       {
-        /* Joins it */
-        orxThread_Join(sstResource.u32RequestThreadID);
-        sstResource.u32RequestThreadID = orxU32_UNDEFINED;
+        orxBank_Delete(sstResource.pstPackBank);
+      }
+
+      /* Deletes pack table */
+      if(sstResource.pstPackTable != orxNULL)
+      {
+        orxHashTable_Delete(sstResource.pstPackTable);
       }
 
       /* Logs message */
@@ -1229,26 +2809,40 @@ void orxFASTCALL orxResource_Exit()
   {
     orxRESOURCE_GROUP      *pstGroup;
     orxRESOURCE_OPEN_INFO  *pstOpenInfo;
+    orxRESOURCE_PACK       *pstPack;
+    orxU32                  i;
 
     /* Unregisters commands */
     orxResource_UnregisterCommands();
 
-    /* Makes sure resource thread is enabled */
-    orxThread_Enable(orxTHREAD_GET_FLAG_FROM_ID(sstResource.u32RequestThreadID), orxTHREAD_KU32_FLAG_NONE);
+    /* For all request threads */
+    for(i = 0; i < sstResource.u32ThreadCount; i++)
+    {
+      /* Makes sure it is enabled */
+      orxThread_Enable(orxTHREAD_GET_FLAG_FROM_ID(sstResource.au32ThreadList[i]), orxTHREAD_KU32_FLAG_NONE);
+    }
 
     /* Waits for all pending operations to complete */
-    while(sstResource.u32RequestProcessIndex != sstResource.u32RequestInIndex);
+    while(sstResource.u32PendingCount != 0);
 
     /* Updates worker result */
     sstResource.eThreadResult = orxSTATUS_FAILURE;
     orxMEMORY_BARRIER();
 
-    /* Signals worker semaphore */
-    orxThread_SignalSemaphore(sstResource.pstWorkerSemaphore);
+    /* For all request threads */
+    for(i = 0; i < sstResource.u32ThreadCount; i++)
+    {
+      /* Signals worker semaphore */
+      orxThread_SignalSemaphore(sstResource.pstWorkerSemaphore);
+    }
 
-    /* Joins request thread */
-    orxThread_Join(sstResource.u32RequestThreadID);
-    sstResource.u32RequestThreadID = orxU32_UNDEFINED;
+    /* For all request threads */
+    for(i = 0; i < sstResource.u32ThreadCount; i++)
+    {
+      /* Joins it */
+      orxThread_Join(sstResource.au32ThreadList[i]);
+    }
+    sstResource.u32ThreadCount = 0;
 
     /* Delete semaphores */
     orxThread_DeleteSemaphore(sstResource.pstRequestSemaphore);
@@ -1256,6 +2850,35 @@ void orxFASTCALL orxResource_Exit()
 
     /* Don't unregister clock callbacks as the clock module has already exited */
 
+#ifdef __orxLINUX__
+
+    /* Has system watch instance? */
+    if(sstResource.iWatchFD >= 0)
+    {
+      orxSTRING zFolder;
+      orxU64    u64Key;
+      orxHANDLE hIterator;
+
+      /* Closes it */
+      close(sstResource.iWatchFD);
+      sstResource.iWatchFD = -1;
+
+      /* For all watched folders */
+      for(hIterator = orxHashTable_GetNext(sstResource.pstWatchFolderTable, orxHANDLE_UNDEFINED, &u64Key, (void **)&zFolder);
+          hIterator != orxHANDLE_UNDEFINED;
+          hIterator = orxHashTable_GetNext(sstResource.pstWatchFolderTable, hIterator, &u64Key, (void **)&zFolder))
+      {
+        /* Deletes it */
+        orxString_Delete(zFolder);
+      }
+
+      /* Deletes system watch tables */
+      orxHashTable_Delete(sstResource.pstWatchFolderTable);
+      orxHashTable_Delete(sstResource.pstWatchTable);
+    }
+
+#endif /* __orxLINUX__ */
+
     /* Has uncached location? */
     if(sstResource.zLastUncachedLocation != orxNULL)
     {
@@ -1288,6 +2911,22 @@ void orxFASTCALL orxResource_Exit()
     /* Deletes open info bank */
     orxBank_Delete(sstResource.pstOpenInfoBank);
 
+    /* Deletes location table */
+    orxHashTable_Delete(sstResource.pstLocationTable);
+
+    /* For all packs */
+    while((pstPack = (orxRESOURCE_PACK *)orxBank_GetNext(sstResource.pstPackBank, orxNULL)) != orxNULL)
+    {
+      /* Deletes it */
+      orxResource_Pack_Delete(pstPack);
+    }
+
+    /* Deletes pack bank */
+    orxBank_Delete(sstResource.pstPackBank);
+
+    /* Deletes pack table */
+    orxHashTable_Delete(sstResource.pstPackTable);
+
     /* Checks */
     orxASSERT(orxBank_GetCount(sstResource.pstResourceInfoBank) == 0);
 
@@ -1789,7 +3428,9 @@ const orxSTRING orxFASTCALL orxResource_Locate(const orxSTRING _zGroup, const or
 
               /* Inits it */
               pstResourceInfo->pstTypeInfo  = &(pstType->stInfo);
+              pstResourceInfo->pstNextWatch = orxNULL;
               pstResourceInfo->s64Time      = orxRESOURCE_KU32_WATCH_TIME_UNINITIALIZED;
+              pstResourceInfo->s32WatchID   = orxRESOURCE_KS32_WATCH_ID_NONE;
               pstResourceInfo->zLocation    = (orxSTRING)orxMemory_Allocate(orxString_GetLength(pstType->stInfo.zTag) + orxString_GetLength(zLocation) + 2, orxMEMORY_TYPE_TEXT);
               orxASSERT(pstResourceInfo->zLocation != orxNULL);
               orxString_Print(pstResourceInfo->zLocation, "%s%c%s", pstType->stInfo.zTag, orxRESOURCE_KC_LOCATION_SEPARATOR, zLocation);
@@ -1800,6 +3441,20 @@ const orxSTRING orxFASTCALL orxResource_Locate(const orxSTRING _zGroup, const or
               /* Adds it to cache */
               orxHashTable_Add(pstGroup->pstCacheTable, stKey, pstResourceInfo);
 
+              /* Binds its location to the group, for stats */
+              orxHashTable_Set(sstResource.pstLocationTable, orxString_ToCRC(pstResourceInfo->zLocation), pstGroup);
+
+              /* Is group watched? */
+              if(pstGroup->bWatch != orxFALSE)
+              {
+                /* Watches it: by the system? */
+                if(orxResource_AddWatch(pstResourceInfo) != orxFALSE)
+                {
+                  /* Gets its initial time */
+                  orxResource_AddRequest(orxRESOURCE_REQUEST_TYPE_GET_TIME, 0, orxNULL, &orxResource_NotifyChange, pstResourceInfo, orxNULL, orxRESOURCE_PRIORITY_BACKGROUND);
+                }
+              }
+
               /* Updates result */
               zResult = pstResourceInfo->zLocation;
 
@@ -2108,8 +3763,15 @@ orxHANDLE orxFASTCALL orxResource_Open(const orxSTRING _zLocation, orxBOOL _bEra
       orxASSERT(pstOpenInfo != orxNULL);
 
       /* Inits it */
-      pstOpenInfo->pstTypeInfo = &(pstType->stInfo);
-      pstOpenInfo->u32OpCount = 0;
+      pstOpenInfo->pstTypeInfo      = &(pstType->stInfo);
+      pstOpenInfo->pstGroup         = (orxRESOURCE_GROUP *)orxHashTable_Get(sstResource.pstLocationTable, orxString_ToCRC(_zLocation));
+      pstOpenInfo->ePriority        = orxRESOURCE_PRIORITY_INTERACTIVE;
+      pstOpenInfo->u32RequestCount  = 0;
+      pstOpenInfo->u32ServiceCount  = 0;
+      pstOpenInfo->u32OpCount       = 0;
+      pstOpenInfo->pMapData         = orxNULL;
+      pstOpenInfo->s64MapSize       = 0;
+      pstOpenInfo->bMapCopy         = orxFALSE;
 
       /* Opens it */
       pstOpenInfo->hResource = pstType->stInfo.pfnOpen(_zLocation + u32TagLength + 1, _bEraseMode);
@@ -2143,7 +3805,7 @@ orxHANDLE orxFASTCALL orxResource_Open(const orxSTRING _zLocation, orxBOOL _bEra
   return hResult;
 }
 
-/** Closes a resource
+/** Closes a resource, its pending asynchronous reads get cancelled and will be notified with a size of 0
  * @param[in] _hResource        Concerned resource
  */
 void orxFASTCALL orxResource_Close(orxHANDLE _hResource)
@@ -2159,16 +3821,26 @@ void orxFASTCALL orxResource_Close(orxHANDLE _hResource)
     /* Gets open info */
     pstOpenInfo = (orxRESOURCE_OPEN_INFO *)_hResource;
 
-    /* Has pending operations (and thread hasn't been terminated)? */
-    if((pstOpenInfo->u32OpCount != 0) && (sstResource.u32RequestThreadID != orxU32_UNDEFINED))
+    /* Has pending operations (and threads haven't been terminated)? */
+    if((pstOpenInfo->u32OpCount != 0) && (sstResource.u32ThreadCount != 0))
     {
+      /* Cancels its pending reads */
+      orxResource_CancelRequests(pstOpenInfo);
+
       /* Adds request */
-      orxResource_AddRequest(orxRESOURCE_REQUEST_TYPE_CLOSE, 0, orxNULL, orxNULL, orxNULL, pstOpenInfo);
+      orxResource_AddRequest(orxRESOURCE_REQUEST_TYPE_CLOSE, 0, orxNULL, orxNULL, orxNULL, pstOpenInfo, orxRESOURCE_PRIORITY_CRITICAL);
     }
     else
     {
-      /* Closes resource */
-      pstOpenInfo->pstTypeInfo->pfnClose(pstOpenInfo->hResource);
+      /* Wasn't already closed by a pending request? */
+      if(pstOpenInfo->hResource != orxHANDLE_UNDEFINED)
+      {
+        /* Unmaps it */
+        orxResource_Unmap(_hResource);
+
+        /* Closes resource */
+        pstOpenInfo->pstTypeInfo->pfnClose(pstOpenInfo->hResource);
+      }
 
       /* Deletes location */
       orxString_Delete(pstOpenInfo->zLocation);
@@ -2330,7 +4002,7 @@ orxS64 orxFASTCALL orxResource_Read(orxHANDLE _hResource, orxS64 _s64Size, void
     if(_pfnCallback != orxNULL)
     {
       /* Adds request */
-      orxResource_AddRequest(orxRESOURCE_REQUEST_TYPE_READ, _s64Size, _pBuffer, _pfnCallback, _pContext, pstOpenInfo);
+      orxResource_AddRequest(orxRESOURCE_REQUEST_TYPE_READ, _s64Size, _pBuffer, _pfnCallback, _pContext, pstOpenInfo, pstOpenInfo->ePriority);
 
       /* Updates result */
       s64Result = -1;
@@ -2377,7 +4049,7 @@ orxS64 orxFASTCALL orxResource_Write(orxHANDLE _hResource, orxS64 _s64Size, cons
       if(_pfnCallback != orxNULL)
       {
         /* Adds request */
-        orxResource_AddRequest(orxRESOURCE_REQUEST_TYPE_WRITE, _s64Size, (void *)_pBuffer, _pfnCallback, _pContext, pstOpenInfo);
+        orxResource_AddRequest(orxRESOURCE_REQUEST_TYPE_WRITE, _s64Size, (void *)_pBuffer, _pfnCallback, _pContext, pstOpenInfo, pstOpenInfo->ePriority);
 
         /* Updates result */
         s64Result = -1;
@@ -2394,6 +4066,160 @@ orxS64 orxFASTCALL orxResource_Write(orxHANDLE _hResource, orxS64 _s64Size, cons
   return s64Result;
 }
 
+/** Maps the whole content of a resource in memory, read-only, without copying it when its type supports it (ie. file and uncompressed pack entries)
+ * A resource can only be mapped once at a time and no asynchronous operation should be pending on it. The resource cursor isn't modified.
+ * @param[in] _hResource        Concerned resource
+ * @param[in] _bAllowCopy       If the resource can't be mapped, its content will be read into a buffer instead; if orxFALSE, orxNULL will be returned in this case
+ * @param[out] _ps64Size        Size of the mapped data, in bytes
+ * @return Mapped data, valid till orxResource_Unmap or orxResource_Close is called, orxNULL on failure
+ */
+const void *orxFASTCALL orxResource_Map(orxHANDLE _hResource, orxBOOL _bAllowCopy, orxS64 *_ps64Size)
+{
+  const void *pResult = orxNULL;
+
+  /* Checks */
+  orxASSERT(orxFLAG_TEST(sstResource.u32Flags, orxRESOURCE_KU32_STATIC_FLAG_READY));
+  orxASSERT(_ps64Size != orxNULL);
+
+  /* Clears size */
+  *_ps64Size = 0;
+
+  /* Valid? */
+  if((_hResource != orxHANDLE_UNDEFINED) && (_hResource != orxNULL))
+  {
+    orxRESOURCE_OPEN_INFO *pstOpenInfo;
+
+    /* Gets open info */
+    pstOpenInfo = (orxRESOURCE_OPEN_INFO *)_hResource;
+
+    /* Checks */
+    orxASSERT(pstOpenInfo->u32OpCount == 0);
+
+    /* Already mapped? */
+    if(pstOpenInfo->pMapData != orxNULL)
+    {
+      /* Updates result */
+      pResult     = pstOpenInfo->pMapData;
+      *_ps64Size  = pstOpenInfo->s64MapSize;
+    }
+    else
+    {
+      /* Supports mapping? */
+      if(pstOpenInfo->pstTypeInfo->pfnMap != orxNULL)
+      {
+        /* Maps it */
+        pResult = pstOpenInfo->pstTypeInfo->pfnMap(pstOpenInfo->hResource, _ps64Size);
+      }
+
+      /* Success? */
+      if(pResult != orxNULL)
+      {
+        /* Stores it */
+        pstOpenInfo->pMapData   = pResult;
+        pstOpenInfo->s64MapSize = *_ps64Size;
+        pstOpenInfo->bMapCopy   = orxFALSE;
+      }
+      /* Can copy? */
+      else if(_bAllowCopy != orxFALSE)
+      {
+        orxS64 s64Size;
+
+        /* Gets its size */
+        s64Size = pstOpenInfo->pstTypeInfo->pfnGetSize(pstOpenInfo->hResource);
+
+        /* Valid? */
+        if((s64Size >= 0) && ((orxU64)s64Size < (orxU64)orxU32_UNDEFINED))
+        {
+          orxU8 *pu8Buffer;
+
+          /* Allocates buffer */
+          pu8Buffer = (orxU8 *)orxMemory_Allocate((orxU32)orxMAX(s64Size, 1), orxMEMORY_TYPE_MAIN);
+
+          /* Success? */
+          if(pu8Buffer != orxNULL)
+          {
+            orxS64 s64Cursor;
+
+            /* Stores cursor */
+            s64Cursor = pstOpenInfo->pstTypeInfo->pfnTell(pstOpenInfo->hResource);
+
+            /* Reads the whole content */
+            if((pstOpenInfo->pstTypeInfo->pfnSeek(pstOpenInfo->hResource, 0, orxSEEK_OFFSET_WHENCE_START) == 0)
+            && (pstOpenInfo->pstTypeInfo->pfnRead(pstOpenInfo->hResource, s64Size, pu8Buffer) == s64Size))
+            {
+              /* Stores it */
+              pstOpenInfo->pMapData   = pu8Buffer;
+              pstOpenInfo->s64MapSize = s64Size;
+              pstOpenInfo->bMapCopy   = orxTRUE;
+
+              /* Updates result */
+              pResult     = pu8Buffer;
+              *_ps64Size  = s64Size;
+            }
+            else
+            {
+              /* Logs message */
+              orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "[%s]: Can't map resource, read error.", pstOpenInfo->zLocation);
+
+              /* Frees buffer */
+              orxMemory_Free(pu8Buffer);
+            }
+
+            /* Restores cursor */
+            pstOpenInfo->pstTypeInfo->pfnSeek(pstOpenInfo->hResource, s64Cursor, orxSEEK_OFFSET_WHENCE_START);
+          }
+        }
+      }
+    }
+  }
+
+  /* Done! */
+  return pResult;
+}
+
+/** Unmaps the content of a resource, this is also done automatically when the resource gets closed
+ * Unlike orxResource_Close, this function can be called from any thread.
+ * @param[in] _hResource        Concerned resource
+ */
+void orxFASTCALL orxResource_Unmap(orxHANDLE _hResource)
+{
+  /* Checks */
+  orxASSERT(orxFLAG_TEST(sstResource.u32Flags, orxRESOURCE_KU32_STATIC_FLAG_READY));
+
+  /* Valid? */
+  if((_hResource != orxHANDLE_UNDEFINED) && (_hResource != orxNULL))
+  {
+    orxRESOURCE_OPEN_INFO *pstOpenInfo;
+
+    /* Gets open info */
+    pstOpenInfo = (orxRESOURCE_OPEN_INFO *)_hResource;
+
+    /* Is mapped? */
+    if(pstOpenInfo->pMapData != orxNULL)
+    {
+      /* Copy? */
+      if(pstOpenInfo->bMapCopy != orxFALSE)
+      {
+        /* Frees it */
+        orxMemory_Free((void *)pstOpenInfo->pMapData);
+      }
+      else
+      {
+        /* Unmaps it */
+        pstOpenInfo->pstTypeInfo->pfnUnmap(pstOpenInfo->hResource, pstOpenInfo->pMapData, pstOpenInfo->s64MapSize);
+      }
+
+      /* Clears it */
+      pstOpenInfo->pMapData   = orxNULL;
+      pstOpenInfo->s64MapSize = 0;
+      pstOpenInfo->bMapCopy   = orxFALSE;
+    }
+  }
+
+  /* Done! */
+  return;
+}
+
 /** Deletes a resource, given its location
  * @param[in] _zLocation        Location of the resource to delete
  * @return orxSTATUS_SUCCESS upon success, orxSTATUS_FAILURE otherwise
@@ -2450,6 +4276,38 @@ orxSTATUS orxFASTCALL orxResource_Delete(const orxSTRING _zLocation)
   return eResult;
 }
 
+/** Sets the priority of the upcoming asynchronous operations on a resource, operations on a same resource are always serviced in order
+ * @param[in] _hResource        Concerned resource
+ * @param[in] _ePriority        Priority of the upcoming asynchronous operations, defaults to orxRESOURCE_PRIORITY_INTERACTIVE
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+orxSTATUS orxFASTCALL orxResource_SetPriority(orxHANDLE _hResource, orxRESOURCE_PRIORITY _ePriority)
+{
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  /* Checks */
+  orxASSERT(orxFLAG_TEST(sstResource.u32Flags, orxRESOURCE_KU32_STATIC_FLAG_READY));
+  orxASSERT(_ePriority < orxRESOURCE_PRIORITY_NUMBER);
+
+  /* Valid? */
+  if((_hResource != orxHANDLE_UNDEFINED) && (_hResource != orxNULL))
+  {
+    orxRESOURCE_OPEN_INFO *pstOpenInfo;
+
+    /* Gets open info */
+    pstOpenInfo = (orxRESOURCE_OPEN_INFO *)_hResource;
+
+    /* Stores priority */
+    pstOpenInfo->ePriority = _ePriority;
+
+    /* Updates result */
+    eResult = orxSTATUS_SUCCESS;
+  }
+
+  /* Done! */
+  return eResult;
+}
+
 /** Gets pending operation count for a given resource
  * @param[in] _hResource        Concerned resource
  * @return Number of pending asynchronous operations for that resource
@@ -2482,18 +4340,13 @@ orxU32 orxFASTCALL orxResource_GetPendingOpCount(const orxHANDLE _hResource)
  */
 orxU32 orxFASTCALL orxResource_GetTotalPendingOpCount()
 {
-  orxU32 u32InIndex, u32OutIndex;
   orxU32 u32Result = 0;
 
   /* Checks */
   orxASSERT(orxFLAG_TEST(sstResource.u32Flags, orxRESOURCE_KU32_STATIC_FLAG_READY));
 
-  /* Gets indices */
-  u32InIndex  = sstResource.u32RequestInIndex;
-  u32OutIndex = sstResource.u32RequestOutIndex;
-
   /* Update result */
-  u32Result = (u32InIndex >= u32OutIndex) ? u32InIndex - u32OutIndex : u32InIndex + (orxRESOURCE_KU32_REQUEST_LIST_SIZE - u32OutIndex);
+  u32Result = orxRESOURCE_KU32_REQUEST_LIST_SIZE - orxLinkList_GetCount(&(sstResource.stFreeList));
 
   /* Has pending operations? */
   if(u32Result != 0)
@@ -2510,6 +4363,73 @@ orxU32 orxFASTCALL orxResource_GetTotalPendingOpCount()
   return u32Result;
 }
 
+/** Gets asynchronous operation stats for a given group
+ * @param[in] _zGroup           Concerned resource group, orxNULL for stats accumulated over all resources
+ * @param[out] _pstStats        Stats of the group
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+orxSTATUS orxFASTCALL orxResource_GetStats(const orxSTRING _zGroup, orxRESOURCE_STATS *_pstStats)
+{
+  const orxRESOURCE_STATS  *pstStats = orxNULL;
+  orxSTATUS                 eResult = orxSTATUS_FAILURE;
+
+  /* Checks */
+  orxASSERT(orxFLAG_TEST(sstResource.u32Flags, orxRESOURCE_KU32_STATIC_FLAG_READY));
+  orxASSERT(_pstStats != orxNULL);
+
+  /* Global stats? */
+  if(_zGroup == orxNULL)
+  {
+    /* Selects them */
+    pstStats = &(sstResource.stStats);
+  }
+  else
+  {
+    orxRESOURCE_GROUP  *pstGroup;
+    orxSTRINGID         stGroupID;
+
+    /* Gets group ID */
+    stGroupID = orxString_GetID(_zGroup);
+
+    /* Gets group */
+    for(pstGroup = (orxRESOURCE_GROUP *)orxBank_GetNext(sstResource.pstGroupBank, orxNULL);
+        (pstGroup != orxNULL) && (pstGroup->stID != stGroupID);
+        pstGroup = (orxRESOURCE_GROUP *)orxBank_GetNext(sstResource.pstGroupBank, pstGroup))
+    ;
+
+    /* Found? */
+    if(pstGroup != orxNULL)
+    {
+      /* Selects its stats */
+      pstStats = &(pstGroup->stStats);
+    }
+  }
+
+  /* Found? */
+  if(pstStats != orxNULL)
+  {
+    /* Waits for semaphore */
+    orxThread_WaitSemaphore(sstResource.pstRequestSemaphore);
+
+    /* Copies them */
+    orxMemory_Copy(_pstStats, pstStats, sizeof(orxRESOURCE_STATS));
+
+    /* Signals semaphore */
+    orxThread_SignalSemaphore(sstResource.pstRequestSemaphore);
+
+    /* Updates result */
+    eResult = orxSTATUS_SUCCESS;
+  }
+  else
+  {
+    /* Clears stats */
+    orxMemory_Zero(_pstStats, sizeof(orxRESOURCE_STATS));
+  }
+
+  /* Done! */
+  return eResult;
+}
+
 /** Registers a new resource type
  * @param[in] _pstInfo          Info describing the new resource type and how to handle it
  * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
@@ -2531,7 +4451,8 @@ orxSTATUS orxFASTCALL orxResource_RegisterType(const orxRESOURCE_TYPE_INFO *_pst
   && (_pstInfo->pfnGetSize != orxNULL)
   && (_pstInfo->pfnSeek != orxNULL)
   && (_pstInfo->pfnTell != orxNULL)
-  && (_pstInfo->pfnRead != orxNULL))
+  && (_pstInfo->pfnRead != orxNULL)
+  && ((_pstInfo->pfnMap == orxNULL) || (_pstInfo->pfnUnmap != orxNULL)))
   {
     orxRESOURCE_TYPE *pstType;
 
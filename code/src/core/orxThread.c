@@ -32,6 +32,7 @@
 #include "core/orxThread.h"
 
 #include "core/orxClock.h"
+#include "core/orxConfig.h"
 #include "core/orxSystem.h"
 #include "debug/orxDebug.h"
 #include "memory/orxMemory.h"
@@ -73,14 +74,29 @@
 #define orxTHREAD_KU32_INFO_FLAG_ENABLED              0x20000000  /**< Enabled flag */
 #define orxTHREAD_KU32_INFO_MASK_ALL                  0xFFFFFFFF  /**< The module has been initialized */
 
+#define orxTHREAD_KU32_TASK_FLAG_NONE                 0x00000000  /**< No flags have been set */
+#define orxTHREAD_KU32_TASK_FLAG_JOB                  0x00000001  /**< Job flag */
+#define orxTHREAD_KU32_TASK_FLAG_RANGE                0x00000002  /**< Parallel range flag */
+
+#define orxTHREAD_KU32_JOB_STATUS_NONE                0           /**< Job hasn't been run */
+#define orxTHREAD_KU32_JOB_STATUS_PENDING             1           /**< Job has been submitted */
+#define orxTHREAD_KU32_JOB_STATUS_DONE                2           /**< Job has completed */
+
 
 /** Misc
  */
-#define orxTHREAD_KU32_TASK_LIST_SIZE                 64
+#define orxTHREAD_KU32_MAX_WORKER_NUMBER              8
+#define orxTHREAD_KU32_WORKER_QUEUE_SIZE              256
+#define orxTHREAD_KU32_TASK_CHUNK_SIZE                64
+#define orxTHREAD_KU32_TASK_KEY_TABLE_SIZE            256
+#define orxTHREAD_KU32_JOB_SUCCESSOR_NUMBER           8
 
 #define orxTHREAD_KZ_THREAD_NAME_MAIN                 "Main"
 #define orxTHREAD_KZ_THREAD_NAME_WORKER               "Task Runner"
 
+#define orxTHREAD_KZ_CONFIG_SECTION                   "Thread"
+#define orxTHREAD_KZ_CONFIG_WORKER_NUMBER             "WorkerNumber"
+
 
 /***************************************************************************
  * Structure declaration                                                   *
@@ -114,14 +130,64 @@ typedef struct __orxTHREAD_INFO_t
  */
 typedef struct __orxTHREAD_TASK_t
 {
-  orxTHREAD_FUNCTION      pfnRun;
-  orxTHREAD_FUNCTION      pfnThen;
-  orxTHREAD_FUNCTION      pfnElse;
-  void                   *pContext;
-  orxSTATUS               eResult;
+  orxTHREAD_FUNCTION                pfnRun;
+  orxTHREAD_FUNCTION                pfnThen;
+  orxTHREAD_FUNCTION                pfnElse;
+  void                             *pContext;
+  struct __orxTHREAD_TASK_t        *pstNext;                        /**< Inbox / done / free list link */
+  struct __orxTHREAD_TASK_t        *pstSuccessor;                   /**< Next task sharing the same context */
+  struct __orxTHREAD_TASK_t        *pstKeyNext;                     /**< Key table bucket link */
+  orxSTATUS                         eResult;
+  orxU32                            u32Flags;
 
 } orxTHREAD_TASK;
 
+/** Job
+ */
+struct __orxTHREAD_JOB_t
+{
+  orxTHREAD_TASK                    stTask;                         /**< Task, first structure member */
+  orxTHREAD_JOB                    *apstSuccessorList[orxTHREAD_KU32_JOB_SUCCESSOR_NUMBER]; /**< Jobs waiting for this one */
+  orxU32                            u32SuccessorCount;              /**< Successor count */
+  volatile orxU32                   u32PendingCount;                /**< Unfinished predecessors (+1 until submitted) */
+  volatile orxU32                   u32Status;                      /**< Status */
+};
+
+/** Parallel range
+ */
+typedef struct __orxTHREAD_RANGE_t
+{
+  orxTHREAD_RANGE_FUNCTION          pfnRun;
+  void                             *pContext;
+  orxU32                            u32Count;
+  orxU32                            u32Grain;
+  volatile orxU32                   u32Next;                        /**< Next index to process */
+  volatile orxU32                   u32Remaining;                   /**< Unfinished batches */
+  volatile orxU32                   u32RefCount;                    /**< Threads still referencing the range */
+
+} orxTHREAD_RANGE;
+
+/** Task chunk
+ */
+typedef struct __orxTHREAD_TASK_CHUNK_t
+{
+  struct __orxTHREAD_TASK_CHUNK_t  *pstNext;
+  orxTHREAD_TASK                    astTaskList[orxTHREAD_KU32_TASK_CHUNK_SIZE];
+
+} orxTHREAD_TASK_CHUNK;
+
+/** Worker: owns a bounded queue, pushed at the bottom by its owner only, popped at the top by anyone (owner or thieves)
+ */
+typedef struct __orxTHREAD_WORKER_t
+{
+  volatile orxU32                   u32Top;
+  volatile orxU32                   u32Bottom;
+  orxTHREAD_TASK * volatile         apstQueue[orxTHREAD_KU32_WORKER_QUEUE_SIZE];
+  orxU32                            u32Index;
+  orxU32                            u32ThreadID;
+
+} orxTHREAD_WORKER;
+
 /** Static structure
  */
 typedef struct __orxTHREAD_STATIC_t
@@ -132,12 +198,16 @@ typedef struct __orxTHREAD_STATIC_t
   void                   *pThreadContext;
   orxTHREAD_FUNCTION      pfnThreadStart;
   orxTHREAD_FUNCTION      pfnThreadStop;
-  orxU32                  u32WorkerID;
-  volatile orxU32         u32TaskInIndex;
-  volatile orxU32         u32TaskProcessIndex;
-  volatile orxU32         u32TaskOutIndex;
+  orxTHREAD_TASK * volatile pstInbox;
+  orxTHREAD_TASK * volatile pstDoneList;
+  orxTHREAD_TASK         *pstFreeList;
+  orxTHREAD_TASK_CHUNK   *pstChunkList;
+  volatile orxU32         u32TaskCount;
+  volatile orxU32         u32SleepingCount;
+  orxU32                  u32WorkerCount;
+  orxTHREAD_TASK         *apstKeyTable[orxTHREAD_KU32_TASK_KEY_TABLE_SIZE];
+  orxTHREAD_WORKER        astWorkerList[orxTHREAD_KU32_MAX_WORKER_NUMBER];
   volatile orxTHREAD_INFO astThreadInfoList[orxTHREAD_KU32_MAX_THREAD_NUMBER];
-  volatile orxTHREAD_TASK astTaskList[orxTHREAD_KU32_TASK_LIST_SIZE];
 
   orxU32                  u32Flags;
 
@@ -211,20 +281,475 @@ static void *orxThread_Execute(void *_pContext)
     sstThread.pfnThreadStop(sstThread.pThreadContext);
   }
 
+  /* Releases its memory cache */
+  orxMemory_ReleaseCache();
+
   /* Done! */
   return 0;
 }
 
-static void orxFASTCALL orxThread_NotifyTask(const orxCLOCK_INFO *_pstClockInfo, void *_pContext)
+/** Gets the number of available cores
+ */
+static orxU32 orxFASTCALL orxThread_GetCoreCount()
+{
+  orxU32 u32Result;
+
+#ifdef __orxWINDOWS__
+
+  {
+    SYSTEM_INFO stInfo;
+
+    /* Gets system info */
+    GetSystemInfo(&stInfo);
+
+    /* Updates result */
+    u32Result = (orxU32)stInfo.dwNumberOfProcessors;
+  }
+
+#else /* __orxWINDOWS__ */
+
+  {
+    long lCount;
+
+    /* Gets online processor count */
+    lCount = sysconf(_SC_NPROCESSORS_ONLN);
+
+    /* Updates result */
+    u32Result = (lCount > 0) ? (orxU32)lCount : 1;
+  }
+
+#endif /* __orxWINDOWS__ */
+
+  /* Done! */
+  return u32Result;
+}
+
+/** Gets the key table bucket of a task context
+ */
+static orxINLINE orxU32 orxThread_GetKeyBucket(const void *_pContext)
+{
+  size_t  stKey;
+  orxU32  u32Result;
+
+  /* Gets key */
+  stKey = (size_t)_pContext;
+
+  /* Updates result */
+  u32Result = (orxU32)((stKey >> 4) ^ (stKey >> 12)) & (orxTHREAD_KU32_TASK_KEY_TABLE_SIZE - 1);
+
+  /* Done! */
+  return u32Result;
+}
+
+/** Pushes a list of tasks onto a lock-free stack (inbox or done list)
+ */
+static orxINLINE void orxThread_PushTaskList(orxTHREAD_TASK * volatile *_ppstStack, orxTHREAD_TASK *_pstFirst, orxTHREAD_TASK *_pstLast)
+{
+  orxTHREAD_TASK *pstHead;
+
+  /* Links it in front of the current head */
+  do
+  {
+    pstHead           = *_ppstStack;
+    _pstLast->pstNext = pstHead;
+  }
+  while(orxMEMORY_ATOMIC_CAS_POINTER(_ppstStack, pstHead, _pstFirst) == orxFALSE);
+
+  /* Done! */
+  return;
+}
+
+/** Pops all tasks from a lock-free stack, in push order
+ */
+static orxINLINE orxTHREAD_TASK *orxThread_PopTaskList(orxTHREAD_TASK * volatile *_ppstStack)
+{
+  orxTHREAD_TASK *pstTask, *pstResult = orxNULL;
+
+  /* For all tasks, from newest to oldest */
+  for(pstTask = (orxTHREAD_TASK *)orxMEMORY_ATOMIC_EXCHANGE_POINTER(_ppstStack, (orxTHREAD_TASK *)orxNULL); pstTask != orxNULL;)
+  {
+    orxTHREAD_TASK *pstNext;
+
+    /* Reverses it */
+    pstNext           = pstTask->pstNext;
+    pstTask->pstNext  = pstResult;
+    pstResult         = pstTask;
+    pstTask           = pstNext;
+  }
+
+  /* Done! */
+  return pstResult;
+}
+
+/** Pushes a task at the bottom of a worker's queue (owner only)
+ */
+static orxINLINE orxBOOL orxThread_PushWorkerTask(orxTHREAD_WORKER *_pstWorker, orxTHREAD_TASK *_pstTask)
+{
+  orxU32  u32Bottom;
+  orxBOOL bResult = orxFALSE;
+
+  /* Gets bottom */
+  u32Bottom = _pstWorker->u32Bottom;
+
+  /* Not full? */
+  if(u32Bottom - _pstWorker->u32Top < orxTHREAD_KU32_WORKER_QUEUE_SIZE)
+  {
+    /* Stores task */
+    _pstWorker->apstQueue[u32Bottom & (orxTHREAD_KU32_WORKER_QUEUE_SIZE - 1)] = _pstTask;
+
+    /* Commits it */
+    orxMEMORY_BARRIER();
+    _pstWorker->u32Bottom = u32Bottom + 1;
+
+    /* Updates result */
+    bResult = orxTRUE;
+  }
+
+  /* Done! */
+  return bResult;
+}
+
+/** Pops a task from the top of a worker's queue (owner or thief)
+ */
+static orxINLINE orxTHREAD_TASK *orxThread_PopWorkerTask(orxTHREAD_WORKER *_pstWorker)
+{
+  orxTHREAD_TASK *pstResult = orxNULL;
+  orxU32          u32Top;
+
+  /* While not empty */
+  for(u32Top = _pstWorker->u32Top, orxMEMORY_BARRIER(); u32Top != _pstWorker->u32Bottom; u32Top = _pstWorker->u32Top, orxMEMORY_BARRIER())
+  {
+    orxTHREAD_TASK *pstTask;
+
+    /* Makes sure the task is read after the bottom that published it */
+    orxMEMORY_BARRIER();
+
+    /* Gets task */
+    pstTask = _pstWorker->apstQueue[u32Top & (orxTHREAD_KU32_WORKER_QUEUE_SIZE - 1)];
+
+    /* Claims it */
+    if(orxMEMORY_ATOMIC_CAS_U32(&(_pstWorker->u32Top), u32Top, u32Top + 1) != orxFALSE)
+    {
+      /* Makes sure the task's content is read after it has been claimed */
+      orxMEMORY_BARRIER();
+
+      /* Updates result */
+      pstResult = pstTask;
+      break;
+    }
+  }
+
+  /* Done! */
+  return pstResult;
+}
+
+/** Allocates a task node (task semaphore has to be held)
+ */
+static orxTHREAD_TASK *orxFASTCALL orxThread_AllocateTask()
+{
+  orxTHREAD_TASK *pstResult;
+
+  /* No free task left? */
+  if(sstThread.pstFreeList == orxNULL)
+  {
+    orxTHREAD_TASK_CHUNK *pstChunk;
+
+    /* Allocates a new chunk */
+    pstChunk = (orxTHREAD_TASK_CHUNK *)orxMemory_Allocate(sizeof(orxTHREAD_TASK_CHUNK), orxMEMORY_TYPE_SYSTEM);
+
+    /* Success? */
+    if(pstChunk != orxNULL)
+    {
+      orxU32 i;
+
+      /* Links it */
+      pstChunk->pstNext       = sstThread.pstChunkList;
+      sstThread.pstChunkList  = pstChunk;
+
+      /* Adds all its tasks to free list */
+      for(i = 0; i < orxTHREAD_KU32_TASK_CHUNK_SIZE; i++)
+      {
+        pstChunk->astTaskList[i].pstNext = sstThread.pstFreeList;
+        sstThread.pstFreeList = &(pstChunk->astTaskList[i]);
+      }
+    }
+  }
+
+  /* Gets free task */
+  pstResult = sstThread.pstFreeList;
+
+  /* Valid? */
+  if(pstResult != orxNULL)
+  {
+    /* Removes it from free list */
+    sstThread.pstFreeList = pstResult->pstNext;
+
+    /* Cleans it */
+    orxMemory_Zero(pstResult, sizeof(orxTHREAD_TASK));
+  }
+
+  /* Done! */
+  return pstResult;
+}
+
+/** Schedules a ready task: on the given worker's queue if possible, in the shared inbox otherwise
+ */
+static void orxFASTCALL orxThread_ScheduleTask(orxTHREAD_WORKER *_pstWorker, orxTHREAD_TASK *_pstTask)
+{
+  /* Can't queue it locally? */
+  if((_pstWorker == orxNULL) || (orxThread_PushWorkerTask(_pstWorker, _pstTask) == orxFALSE))
+  {
+    /* Sends it to inbox */
+    orxThread_PushTaskList(&(sstThread.pstInbox), _pstTask, _pstTask);
+
+    /* Signals worker semaphore */
+    orxThread_SignalSemaphore(sstThread.pstWorkerSemaphore);
+  }
+  else
+  {
+    /* Makes sure the sleeping count is read after the task has been published */
+    orxMEMORY_BARRIER();
+
+    /* Any sleeping worker? */
+    if(sstThread.u32SleepingCount != 0)
+    {
+      /* Wakes one up so that it can steal the task */
+      orxThread_SignalSemaphore(sstThread.pstWorkerSemaphore);
+    }
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Gets the worker associated to the current thread, if any
+ */
+static orxTHREAD_WORKER *orxFASTCALL orxThread_GetCurrentWorker()
+{
+  orxTHREAD_WORKER *pstResult = orxNULL;
+  orxU32            u32ThreadID, i;
+
+  /* Gets current thread */
+  u32ThreadID = orxThread_GetCurrent();
+
+  /* For all workers */
+  for(i = 0; i < sstThread.u32WorkerCount; i++)
+  {
+    /* Matches? */
+    if(sstThread.astWorkerList[i].u32ThreadID == u32ThreadID)
+    {
+      /* Updates result */
+      pstResult = &(sstThread.astWorkerList[i]);
+      break;
+    }
+  }
+
+  /* Done! */
+  return pstResult;
+}
+
+/** Runs batches of a parallel range till none remains
+ */
+static void orxFASTCALL orxThread_RunRange(orxTHREAD_RANGE *_pstRange)
+{
+  orxU32 u32Start;
+
+  /* While there are batches to claim */
+  for(u32Start = orxMEMORY_ATOMIC_ADD_U32(&(_pstRange->u32Next), _pstRange->u32Grain);
+      u32Start < _pstRange->u32Count;
+      u32Start = orxMEMORY_ATOMIC_ADD_U32(&(_pstRange->u32Next), _pstRange->u32Grain))
+  {
+    /* Runs it */
+    _pstRange->pfnRun(u32Start, orxMIN(u32Start + _pstRange->u32Grain, _pstRange->u32Count), _pstRange->pContext);
+
+    /* Updates remaining batches */
+    orxMEMORY_ATOMIC_ADD_U32(&(_pstRange->u32Remaining), (orxU32)-1);
+  }
+
+  /* Releases range */
+  if(orxMEMORY_ATOMIC_ADD_U32(&(_pstRange->u32RefCount), (orxU32)-1) == 1)
+  {
+    /* Deletes it */
+    orxMemory_Free(_pstRange);
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Runs a job and schedules the successors that became ready
+ */
+static void orxFASTCALL orxThread_ProcessJob(orxTHREAD_WORKER *_pstWorker, orxTHREAD_JOB *_pstJob)
+{
+  orxU32 i;
+
+  /* Runs it */
+  _pstJob->stTask.eResult = (_pstJob->stTask.pfnRun != orxNULL) ? _pstJob->stTask.pfnRun(_pstJob->stTask.pContext) : orxSTATUS_SUCCESS;
+
+  /* For all successors */
+  for(i = 0; i < _pstJob->u32SuccessorCount; i++)
+  {
+    orxTHREAD_JOB *pstSuccessor;
+
+    /* Gets it */
+    pstSuccessor = _pstJob->apstSuccessorList[i];
+
+    /* Was it its last pending predecessor? */
+    if(orxMEMORY_ATOMIC_ADD_U32(&(pstSuccessor->u32PendingCount), (orxU32)-1) == 1)
+    {
+      /* Schedules it */
+      orxThread_ScheduleTask(_pstWorker, &(pstSuccessor->stTask));
+    }
+  }
+
+  /* Updates status (job mustn't be accessed past this point as it can get deleted by its owner) */
+  orxMEMORY_BARRIER();
+  _pstJob->u32Status = orxTHREAD_KU32_JOB_STATUS_DONE;
+  orxMEMORY_BARRIER();
+
+  /* Done! */
+  return;
+}
+
+/** Gets next task to run for a worker: own queue first, then shared inbox, then stealing from others
+ */
+static orxTHREAD_TASK *orxFASTCALL orxThread_GetNextTask(orxTHREAD_WORKER *_pstWorker)
+{
+  orxTHREAD_TASK *pstResult;
+
+  /* Pops from own queue */
+  pstResult = orxThread_PopWorkerTask(_pstWorker);
+
+  /* Empty? */
+  if(pstResult == orxNULL)
+  {
+    /* Grabs all pending submissions */
+    pstResult = orxThread_PopTaskList(&(sstThread.pstInbox));
+
+    /* Found any? */
+    if(pstResult != orxNULL)
+    {
+      orxTHREAD_TASK *pstTask;
+
+      /* Moves the others to own queue, where they can be stolen */
+      for(pstTask = pstResult->pstNext; (pstTask != orxNULL) && (orxThread_PushWorkerTask(_pstWorker, pstTask) != orxFALSE); pstTask = pstTask->pstNext)
+        ;
+
+      /* Overflow? */
+      if(pstTask != orxNULL)
+      {
+        orxTHREAD_TASK *pstLast;
+
+        /* Finds last one */
+        for(pstLast = pstTask; pstLast->pstNext != orxNULL; pstLast = pstLast->pstNext)
+          ;
+
+        /* Sends them back to inbox */
+        orxThread_PushTaskList(&(sstThread.pstInbox), pstTask, pstLast);
+      }
+    }
+    else
+    {
+      orxU32 i;
+
+      /* For all other workers */
+      for(i = 1; (i < sstThread.u32WorkerCount) && (pstResult == orxNULL); i++)
+      {
+        /* Steals from it */
+        pstResult = orxThread_PopWorkerTask(&(sstThread.astWorkerList[(_pstWorker->u32Index + i) % sstThread.u32WorkerCount]));
+      }
+    }
+  }
+
+  /* Done! */
+  return pstResult;
+}
+
+/** Runs a task and schedules its successor, if any
+ */
+static void orxFASTCALL orxThread_ProcessTask(orxTHREAD_WORKER *_pstWorker, orxTHREAD_TASK *_pstTask)
 {
-  /* While there are processed tasks */
-  while(sstThread.u32TaskOutIndex != sstThread.u32TaskProcessIndex)
+  orxTHREAD_TASK *pstSuccessor;
+
+  /* Is a job? */
+  if(orxFLAG_TEST(_pstTask->u32Flags, orxTHREAD_KU32_TASK_FLAG_JOB))
+  {
+    /* Processes it */
+    orxThread_ProcessJob(_pstWorker, (orxTHREAD_JOB *)_pstTask);
+
+    return;
+  }
+  /* Is a parallel range helper? */
+  else if(orxFLAG_TEST(_pstTask->u32Flags, orxTHREAD_KU32_TASK_FLAG_RANGE))
+  {
+    /* Runs range */
+    orxThread_RunRange((orxTHREAD_RANGE *)_pstTask->pContext);
+
+    /* Waits for task semaphore */
+    orxThread_WaitSemaphore(sstThread.pstTaskSemaphore);
+
+    /* Returns it to free list */
+    _pstTask->pstNext     = sstThread.pstFreeList;
+    sstThread.pstFreeList = _pstTask;
+
+    /* Signals task semaphore */
+    orxThread_SignalSemaphore(sstThread.pstTaskSemaphore);
+
+    return;
+  }
+
+  /* Runs it */
+  _pstTask->eResult = (_pstTask->pfnRun != orxNULL) ? _pstTask->pfnRun(_pstTask->pContext) : orxSTATUS_SUCCESS;
+
+  /* Waits for task semaphore */
+  orxThread_WaitSemaphore(sstThread.pstTaskSemaphore);
+
+  /* Gets successor */
+  pstSuccessor = _pstTask->pstSuccessor;
+
+  /* None? */
+  if(pstSuccessor == orxNULL)
+  {
+    orxTHREAD_TASK **ppstLink;
+
+    /* Finds it in key table (it's the last task for its context) */
+    for(ppstLink = &(sstThread.apstKeyTable[orxThread_GetKeyBucket(_pstTask->pContext)]); *ppstLink != _pstTask; ppstLink = &((*ppstLink)->pstKeyNext))
+    {
+      /* Checks */
+      orxASSERT(*ppstLink != orxNULL);
+    }
+
+    /* Removes it */
+    *ppstLink = _pstTask->pstKeyNext;
+  }
+
+  /* Signals task semaphore */
+  orxThread_SignalSemaphore(sstThread.pstTaskSemaphore);
+
+  /* Sends it for notification */
+  orxThread_PushTaskList(&(sstThread.pstDoneList), _pstTask, _pstTask);
+
+  /* Has successor? */
+  if(pstSuccessor != orxNULL)
   {
-    volatile orxTHREAD_TASK *pstTask;
+    /* Schedules it */
+    orxThread_ScheduleTask(_pstWorker, pstSuccessor);
+  }
 
-    /* Gets Task */
-    pstTask = &(sstThread.astTaskList[sstThread.u32TaskOutIndex]);
+  /* Done! */
+  return;
+}
 
+static void orxFASTCALL orxThread_NotifyTask(const orxCLOCK_INFO *_pstClockInfo, void *_pContext)
+{
+  orxTHREAD_TASK *pstTask, *pstLast = orxNULL, *pstFirst;
+
+  /* Gets all processed tasks */
+  pstFirst = orxThread_PopTaskList(&(sstThread.pstDoneList));
+
+  /* For all processed tasks */
+  for(pstTask = pstFirst; pstTask != orxNULL; pstLast = pstTask, pstTask = pstTask->pstNext)
+  {
     /* Succeeded? */
     if(pstTask->eResult != orxSTATUS_FAILURE)
     {
@@ -245,9 +770,22 @@ static void orxFASTCALL orxThread_NotifyTask(const orxCLOCK_INFO *_pstClockInfo,
       }
     }
 
-    /* Updates task out index */
-    orxMEMORY_BARRIER();
-    sstThread.u32TaskOutIndex = (sstThread.u32TaskOutIndex + 1) & (orxTHREAD_KU32_TASK_LIST_SIZE - 1);
+    /* Updates task count */
+    orxMEMORY_ATOMIC_ADD_U32(&(sstThread.u32TaskCount), (orxU32)-1);
+  }
+
+  /* Any task notified? */
+  if(pstLast != orxNULL)
+  {
+    /* Waits for task semaphore */
+    orxThread_WaitSemaphore(sstThread.pstTaskSemaphore);
+
+    /* Returns them to free list */
+    pstLast->pstNext      = sstThread.pstFreeList;
+    sstThread.pstFreeList = pstFirst;
+
+    /* Signals task semaphore */
+    orxThread_SignalSemaphore(sstThread.pstTaskSemaphore);
   }
 
   /* Done! */
@@ -256,25 +794,179 @@ static void orxFASTCALL orxThread_NotifyTask(const orxCLOCK_INFO *_pstClockInfo,
 
 static orxSTATUS orxFASTCALL orxThread_Work(void *_pContext)
 {
-  orxSTATUS eResult = orxSTATUS_SUCCESS;
+  orxTHREAD_WORKER *pstWorker;
+  orxTHREAD_TASK   *pstTask;
+  orxSTATUS         eResult = orxSTATUS_SUCCESS;
+
+  /* Gets worker */
+  pstWorker = (orxTHREAD_WORKER *)_pContext;
+
+  /* While there are pending tasks */
+  while((pstTask = orxThread_GetNextTask(pstWorker)) != orxNULL)
+  {
+    /* Processes it */
+    orxThread_ProcessTask(pstWorker, pstTask);
+  }
+
+  /* Marks it as sleeping */
+  orxMEMORY_ATOMIC_ADD_U32(&(sstThread.u32SleepingCount), 1);
+
+  /* Checks for tasks again, as those pushed locally before it was marked as sleeping wouldn't wake it up */
+  pstTask = orxThread_GetNextTask(pstWorker);
+
+  /* Found one? */
+  if(pstTask != orxNULL)
+  {
+    /* Unmarks it */
+    orxMEMORY_ATOMIC_ADD_U32(&(sstThread.u32SleepingCount), (orxU32)-1);
+
+    /* Processes it */
+    orxThread_ProcessTask(pstWorker, pstTask);
+  }
+  else
+  {
+    /* Waits for worker semaphore */
+    orxThread_WaitSemaphore(sstThread.pstWorkerSemaphore);
+
+    /* Unmarks it */
+    orxMEMORY_ATOMIC_ADD_U32(&(sstThread.u32SleepingCount), (orxU32)-1);
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Starts task worker threads
+ */
+static orxSTATUS orxFASTCALL orxThread_StartWorkers()
+{
+  orxU32    u32CoreCount, u32Count, i;
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  /* Gets core count */
+  u32CoreCount = orxThread_GetCoreCount();
+
+  /* Defaults to all cores but the main one */
+  u32Count = (u32CoreCount > 1) ? u32CoreCount - 1 : 1;
+
+  /* Is config module initialized? */
+  if(orxModule_IsInitialized(orxMODULE_ID_CONFIG) != orxFALSE)
+  {
+    /* Pushes config section */
+    orxConfig_PushSection(orxTHREAD_KZ_CONFIG_SECTION);
+
+    /* Has worker number? */
+    if(orxConfig_HasValue(orxTHREAD_KZ_CONFIG_WORKER_NUMBER) != orxFALSE)
+    {
+      /* Gets it */
+      u32Count = orxConfig_GetU32(orxTHREAD_KZ_CONFIG_WORKER_NUMBER);
+    }
+
+    /* Pops config section */
+    orxConfig_PopSection();
+  }
+
+  /* Clamps it */
+  u32Count = orxCLAMP(u32Count, 1, orxTHREAD_KU32_MAX_WORKER_NUMBER);
+
+  /* For all workers */
+  for(i = 0; i < u32Count; i++)
+  {
+    orxTHREAD_WORKER *pstWorker;
+    orxCHAR           acBuffer[64];
+
+    /* Gets it */
+    pstWorker = &(sstThread.astWorkerList[i]);
+
+    /* Inits it */
+    pstWorker->u32Index = i;
+
+    /* Gets its name */
+    acBuffer[orxString_NPrint(acBuffer, sizeof(acBuffer) - 1, "%s %u", orxTHREAD_KZ_THREAD_NAME_WORKER, i + 1)] = orxCHAR_NULL;
+
+    /* Starts its thread */
+    pstWorker->u32ThreadID = orxThread_Start(orxThread_Work, acBuffer, (void *)pstWorker);
+
+    /* Failure? */
+    if(pstWorker->u32ThreadID == orxU32_UNDEFINED)
+    {
+      /* Stops */
+      break;
+    }
 
-  /* Waits for worker semaphore */
-  orxThread_WaitSemaphore(sstThread.pstWorkerSemaphore);
+#if defined(__orxLINUX__)
 
-  /* While there are pending requests */
-  while(sstThread.u32TaskProcessIndex != sstThread.u32TaskInIndex)
+    /* Has more than one core? */
+    if(u32CoreCount > 1)
+    {
+      cpu_set_t stSet;
+      orxU32    j;
+
+      /* Lets it use all cores but the main thread's one (new threads inherit the main thread's affinity) */
+      CPU_ZERO(&stSet);
+      for(j = 1; j < u32CoreCount; j++)
+      {
+        CPU_SET(j, &stSet);
+      }
+
+      /* Applies it */
+      pthread_setaffinity_np(sstThread.astThreadInfoList[pstWorker->u32ThreadID].hThread, sizeof(cpu_set_t), &stSet);
+    }
+
+#endif /* __orxLINUX__ */
+  }
+
+  /* Stores worker count */
+  orxMEMORY_BARRIER();
+  sstThread.u32WorkerCount = i;
+
+  /* Success? */
+  if(i != 0)
+  {
+    /* Updates result */
+    eResult = orxSTATUS_SUCCESS;
+  }
+  else
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Couldn't start any task worker thread.");
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Makes sure task notification is registered and workers are started
+ */
+static orxSTATUS orxFASTCALL orxThread_StartTasks()
+{
+  orxSTATUS eResult;
+
+  /* Is notify callback not registered? */
+  if(!orxFLAG_TEST(sstThread.u32Flags, orxTHREAD_KU32_STATIC_FLAG_REGISTERED))
+  {
+    /* Are we on main thread, is clock module initialized, did we register callback and start workers? */
+    if((orxThread_GetCurrent() == orxTHREAD_KU32_MAIN_THREAD_ID)
+    && (orxModule_IsInitialized(orxMODULE_ID_CLOCK) != orxFALSE)
+    && (orxClock_Register(orxClock_FindFirst(orx2F(-1.0f), orxCLOCK_TYPE_CORE), orxThread_NotifyTask, orxNULL, orxMODULE_ID_RESOURCE, orxCLOCK_PRIORITY_LOWEST) != orxSTATUS_FAILURE)
+    && (orxThread_StartWorkers() != orxSTATUS_FAILURE))
+    {
+      /* Updates status */
+      orxFLAG_SET(sstThread.u32Flags, orxTHREAD_KU32_STATIC_FLAG_REGISTERED, orxTHREAD_KU32_STATIC_FLAG_NONE);
+
+      /* Updates result */
+      eResult = orxSTATUS_SUCCESS;
+    }
+    else
+    {
+      /* Updates result */
+      eResult = orxSTATUS_FAILURE;
+    }
+  }
+  else
   {
-    volatile orxTHREAD_TASK *pstTask;
-
-    /* Gets task */
-    pstTask = &(sstThread.astTaskList[sstThread.u32TaskProcessIndex]);
-
-    /* Runs it */
-    pstTask->eResult = (pstTask->pfnRun != orxNULL) ? pstTask->pfnRun(pstTask->pContext) : orxSTATUS_SUCCESS;
-
-    /* Updates task process index */
-    orxMEMORY_BARRIER();
-    sstThread.u32TaskProcessIndex = (sstThread.u32TaskProcessIndex + 1) & (orxTHREAD_KU32_TASK_LIST_SIZE - 1);
+    /* Updates result */
+    eResult = orxSTATUS_SUCCESS;
   }
 
   /* Done! */
@@ -306,7 +998,8 @@ orxSTATUS orxFASTCALL orxThread_Init()
   orxSTATUS eResult = orxSTATUS_FAILURE;
 
   /* Checks */
-  orxASSERT(orxMath_IsPowerOfTwo(orxTHREAD_KU32_TASK_LIST_SIZE) != orxFALSE);
+  orxASSERT(orxMath_IsPowerOfTwo(orxTHREAD_KU32_WORKER_QUEUE_SIZE) != orxFALSE);
+  orxASSERT(orxMath_IsPowerOfTwo(orxTHREAD_KU32_TASK_KEY_TABLE_SIZE) != orxFALSE);
 
   /* Was not already initialized? */
   if(!(sstThread.u32Flags & orxTHREAD_KU32_STATIC_FLAG_READY))
@@ -333,7 +1026,7 @@ orxSTATUS orxFASTCALL orxThread_Init()
     /* Creates semaphores */
     sstThread.pstThreadSemaphore  = orxThread_CreateSemaphore(1);
     sstThread.pstTaskSemaphore    = orxThread_CreateSemaphore(1);
-    sstThread.pstWorkerSemaphore  = orxThread_CreateSemaphore(1);
+    sstThread.pstWorkerSemaphore  = orxThread_CreateSemaphore(0);
 
     /* Success? */
     if((sstThread.pstThreadSemaphore != orxNULL) && (sstThread.pstTaskSemaphore != orxNULL) && (sstThread.pstWorkerSemaphore != orxNULL))
@@ -376,38 +1069,8 @@ orxSTATUS orxFASTCALL orxThread_Init()
 
 #endif /* __orxWINDOWS__ */
 
-      /* Waits for worker semaphore */
-      orxThread_WaitSemaphore(sstThread.pstWorkerSemaphore);
-
-      /* Creates worker thread */
-      sstThread.u32WorkerID = orxThread_Start(orxThread_Work, orxTHREAD_KZ_THREAD_NAME_WORKER, orxNULL);
-
-      /* Success? */
-      if(sstThread.u32WorkerID != orxU32_UNDEFINED)
-      {
-        /* Updates result */
-        eResult = orxSTATUS_SUCCESS;
-      }
-      else
-      {
-        /* Logs message */
-        orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Couldn't start internal worker thread.");
-
-        /* Deletes semaphores */
-        orxThread_DeleteSemaphore(sstThread.pstThreadSemaphore);
-        orxThread_DeleteSemaphore(sstThread.pstTaskSemaphore);
-        orxThread_DeleteSemaphore(sstThread.pstWorkerSemaphore);
-
-#ifdef __orxWINDOWS__
-
-        /* Asks for small time slices */
-        timeEndPeriod(1);
-
-#endif /* __orxWINDOWS__ */
-
-        /* Updates status */
-        sstThread.u32Flags &= ~orxTHREAD_KU32_STATIC_FLAG_READY;
-      }
+      /* Updates result (task workers will be started along with the first task) */
+      eResult = orxSTATUS_SUCCESS;
     }
     else
     {
@@ -444,19 +1107,45 @@ void orxFASTCALL orxThread_Exit()
   /* Checks */
   if((sstThread.u32Flags & orxTHREAD_KU32_STATIC_FLAG_READY) == orxTHREAD_KU32_STATIC_FLAG_READY)
   {
-    /* Updates worker thread stop flag */
-    orxFLAG_SET(sstThread.astThreadInfoList[sstThread.u32WorkerID].u32Flags, orxTHREAD_KU32_INFO_FLAG_STOP, orxTHREAD_KU32_INFO_FLAG_NONE);
+    orxTHREAD_TASK_CHUNK *pstChunk;
+    orxU32                i;
+
+    /* For all workers */
+    for(i = 0; i < sstThread.u32WorkerCount; i++)
+    {
+      /* Updates its thread stop flag */
+      orxFLAG_SET(sstThread.astThreadInfoList[sstThread.astWorkerList[i].u32ThreadID].u32Flags, orxTHREAD_KU32_INFO_FLAG_STOP, orxTHREAD_KU32_INFO_FLAG_NONE);
+    }
     orxMEMORY_BARRIER();
 
     /* Re-enables all threads */
     orxThread_Enable(orxTHREAD_KU32_MASK_ALL, orxTHREAD_KU32_FLAG_NONE);
 
-    /* Signals worker semaphore */
-    orxThread_SignalSemaphore(sstThread.pstWorkerSemaphore);
+    /* For all workers */
+    for(i = 0; i < sstThread.u32WorkerCount; i++)
+    {
+      /* Signals worker semaphore */
+      orxThread_SignalSemaphore(sstThread.pstWorkerSemaphore);
+    }
 
     /* Joins all remaining threads */
     orxThread_JoinAll();
 
+    /* Deletes all task chunks */
+    for(pstChunk = sstThread.pstChunkList; pstChunk != orxNULL;)
+    {
+      orxTHREAD_TASK_CHUNK *pstNext;
+
+      /* Gets next chunk */
+      pstNext = pstChunk->pstNext;
+
+      /* Deletes it */
+      orxMemory_Free(pstChunk);
+
+      /* Goes to next chunk */
+      pstChunk = pstNext;
+    }
+
 #ifdef __orxWINDOWS__
 
     /* Resets time slices */
@@ -1019,7 +1708,7 @@ orxSTATUS orxFASTCALL orxThread_SignalSemaphore(orxTHREAD_SEMAPHORE *_pstSemapho
 }
 
 /** Runs an asynchronous task and optional follow-ups
- * @param[in]   _pfnRun                               Asynchronous task to run, executed on a different thread dedicated to tasks
+ * @param[in]   _pfnRun                               Asynchronous task to run, executed on one of the task worker threads; tasks sharing the same context run in submission order
  * @param[in]   _pfnThen                              Executed (on the main thread) if Run does *not* return orxSTATUS_FAILURE, can be orxNULL
  * @param[in]   _pfnElse                              Executed (on the main thread) if Run returns orxSTATUS_FAILURE, can be orxNULL
  * @param[in]   _pContext                             Context that will be transmitted to all the task functions
@@ -1032,72 +1721,74 @@ orxSTATUS orxFASTCALL orxThread_RunTask(const orxTHREAD_FUNCTION _pfnRun, const
   /* Checks */
   orxASSERT((sstThread.u32Flags & orxTHREAD_KU32_STATIC_FLAG_READY) == orxTHREAD_KU32_STATIC_FLAG_READY);
 
-  /* Is notify callback not registered? */
-  if(!orxFLAG_TEST(sstThread.u32Flags, orxTHREAD_KU32_STATIC_FLAG_REGISTERED))
-  {
-    /* Are we on main thread, is clock module initialized and did we register callback? */
-    if((orxThread_GetCurrent() == orxTHREAD_KU32_MAIN_THREAD_ID)
-    && (orxModule_IsInitialized(orxMODULE_ID_CLOCK) != orxFALSE)
-    && (orxClock_Register(orxClock_FindFirst(orx2F(-1.0f), orxCLOCK_TYPE_CORE), orxThread_NotifyTask, orxNULL, orxMODULE_ID_RESOURCE, orxCLOCK_PRIORITY_LOWEST) != orxSTATUS_FAILURE))
-    {
-      /* Updates status */
-      orxFLAG_SET(sstThread.u32Flags, orxTHREAD_KU32_STATIC_FLAG_REGISTERED, orxTHREAD_KU32_STATIC_FLAG_NONE);
-
-      /* Updates result */
-      eResult = orxSTATUS_SUCCESS;
-    }
-    else
-    {
-      /* Updates result */
-      eResult = orxSTATUS_FAILURE;
-    }
-  }
-  else
-  {
-    /* Updates result */
-    eResult = orxSTATUS_SUCCESS;
-  }
+  /* Starts tasks */
+  eResult = orxThread_StartTasks();
 
   /* Valid? */
   if(eResult != orxSTATUS_FAILURE)
   {
-    volatile orxTHREAD_TASK  *pstTask;
-    orxU32                    u32NextTaskIndex;
+    orxTHREAD_TASK   *pstTask, **ppstLink;
+    orxBOOL           bPost = orxTRUE;
+
+    /* Updates task count */
+    orxMEMORY_ATOMIC_ADD_U32(&(sstThread.u32TaskCount), 1);
 
     /* Waits for task semaphore */
     orxThread_WaitSemaphore(sstThread.pstTaskSemaphore);
 
-    /* Gets next task index */
-    u32NextTaskIndex = (sstThread.u32TaskInIndex + 1) & (orxTHREAD_KU32_TASK_LIST_SIZE - 1);
+    /* Allocates task */
+    pstTask = orxThread_AllocateTask();
 
-    /* Waits for a free slot */
-    while(u32NextTaskIndex == sstThread.u32TaskOutIndex)
+    /* Valid? */
+    if(pstTask != orxNULL)
     {
-      /* On main thread? */
-      if(orxThread_GetCurrent() == orxTHREAD_KU32_MAIN_THREAD_ID)
+      /* Inits it */
+      pstTask->pfnRun       = _pfnRun;
+      pstTask->pfnThen      = _pfnThen;
+      pstTask->pfnElse      = _pfnElse;
+      pstTask->pContext     = _pContext;
+
+      /* Finds last pending task sharing the same context */
+      for(ppstLink = &(sstThread.apstKeyTable[orxThread_GetKeyBucket(_pContext)]); (*ppstLink != orxNULL) && ((*ppstLink)->pContext != _pContext); ppstLink = &((*ppstLink)->pstKeyNext))
+        ;
+
+      /* Found? */
+      if(*ppstLink != orxNULL)
+      {
+        /* Chains new task after it, to keep tasks sharing the same context in order */
+        (*ppstLink)->pstSuccessor = pstTask;
+
+        /* Replaces it in key table */
+        pstTask->pstKeyNext = (*ppstLink)->pstKeyNext;
+
+        /* Don't post it, its predecessor will schedule it */
+        bPost = orxFALSE;
+      }
+      else
       {
-        /* Manually pumps some task notifications */
-        orxThread_NotifyTask(orxNULL, orxNULL);
+        /* Adds it to key table */
+        pstTask->pstKeyNext = orxNULL;
       }
+      *ppstLink = pstTask;
     }
-    /* Gets current task */
-    pstTask = &(sstThread.astTaskList[sstThread.u32TaskInIndex]);
-
-    /* Inits it */
-    pstTask->pfnRun   = _pfnRun;
-    pstTask->pfnThen  = _pfnThen;
-    pstTask->pfnElse  = _pfnElse;
-    pstTask->pContext = _pContext;
+    else
+    {
+      /* Updates task count */
+      orxMEMORY_ATOMIC_ADD_U32(&(sstThread.u32TaskCount), (orxU32)-1);
 
-    /* Commits Task */
-    orxMEMORY_BARRIER();
-    sstThread.u32TaskInIndex = u32NextTaskIndex;
+      /* Updates result */
+      eResult = orxSTATUS_FAILURE;
+    }
 
     /* Signals task semaphore */
     orxThread_SignalSemaphore(sstThread.pstTaskSemaphore);
 
-    /* Signals worker semaphore */
-    orxThread_SignalSemaphore(sstThread.pstWorkerSemaphore);
+    /* Should post it? */
+    if((pstTask != orxNULL) && (bPost != orxFALSE))
+    {
+      /* Schedules it */
+      orxThread_ScheduleTask(orxNULL, pstTask);
+    }
   }
 
   /* Done! */
@@ -1109,7 +1800,7 @@ orxSTATUS orxFASTCALL orxThread_RunTask(const orxTHREAD_FUNCTION _pfnRun, const
  */
 orxU32 orxFASTCALL orxThread_GetTaskCount()
 {
-  orxU32 u32TaskInIndex, u32TaskOutIndex, u32Result;
+  orxU32 u32Result;
 
   /* Checks */
   orxASSERT((sstThread.u32Flags & orxTHREAD_KU32_STATIC_FLAG_READY) == orxTHREAD_KU32_STATIC_FLAG_READY);
@@ -1121,17 +1812,344 @@ orxU32 orxFASTCALL orxThread_GetTaskCount()
     orxThread_NotifyTask(orxNULL, orxNULL);
   }
 
-  /* Gets indices */
-  u32TaskInIndex  = sstThread.u32TaskInIndex;
-  u32TaskOutIndex = sstThread.u32TaskOutIndex;
-
   /* Updates result */
-  u32Result = (u32TaskInIndex >= u32TaskOutIndex) ? u32TaskInIndex - u32TaskOutIndex : u32TaskInIndex + orxTHREAD_KU32_TASK_LIST_SIZE - u32TaskOutIndex;
+  u32Result = sstThread.u32TaskCount;
 
   /* Done! */
   return u32Result;
 }
 
+/** Creates a job, ie. a task that can depend on other jobs and be waited for, without any main thread notification
+ * @param[in]   _pfnRun                               Function to run on a task worker thread, if orxNULL defaults to an empty job that always succeeds
+ * @param[in]   _pContext                             Context that will be transmitted to the function
+ * @return      orxTHREAD_JOB / orxNULL
+ */
+orxTHREAD_JOB *orxFASTCALL orxThread_CreateJob(const orxTHREAD_FUNCTION _pfnRun, void *_pContext)
+{
+  orxTHREAD_JOB *pstResult;
+
+  /* Checks */
+  orxASSERT((sstThread.u32Flags & orxTHREAD_KU32_STATIC_FLAG_READY) == orxTHREAD_KU32_STATIC_FLAG_READY);
+
+  /* Allocates it */
+  pstResult = (orxTHREAD_JOB *)orxMemory_Allocate(sizeof(orxTHREAD_JOB), orxMEMORY_TYPE_SYSTEM);
+
+  /* Success? */
+  if(pstResult != orxNULL)
+  {
+    /* Inits it */
+    orxMemory_Zero(pstResult, sizeof(orxTHREAD_JOB));
+    pstResult->stTask.pfnRun    = _pfnRun;
+    pstResult->stTask.pContext  = _pContext;
+    pstResult->stTask.u32Flags  = orxTHREAD_KU32_TASK_FLAG_JOB;
+    pstResult->stTask.eResult   = orxSTATUS_SUCCESS;
+    pstResult->u32PendingCount  = 1;
+    pstResult->u32Status        = orxTHREAD_KU32_JOB_STATUS_NONE;
+  }
+
+  /* Done! */
+  return pstResult;
+}
+
+/** Deletes a job, it must either never have been run or be completed
+ * @param[in]   _pstJob                               Concerned job
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+orxSTATUS orxFASTCALL orxThread_DeleteJob(orxTHREAD_JOB *_pstJob)
+{
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  /* Checks */
+  orxASSERT((sstThread.u32Flags & orxTHREAD_KU32_STATIC_FLAG_READY) == orxTHREAD_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstJob != orxNULL);
+
+  /* Not pending? */
+  if(_pstJob->u32Status != orxTHREAD_KU32_JOB_STATUS_PENDING)
+  {
+    /* Deletes it */
+    orxMemory_Free(_pstJob);
+
+    /* Updates result */
+    eResult = orxSTATUS_SUCCESS;
+  }
+  else
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Can't delete job <%p>: it's still pending.", _pstJob);
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Adds a dependency between two jobs: a job will only start once all its predecessors have completed; both jobs must not have been run yet
+ * @param[in]   _pstJob                               Concerned job
+ * @param[in]   _pstPredecessor                       Job that needs to complete before the concerned one can start
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+orxSTATUS orxFASTCALL orxThread_AddJobDependency(orxTHREAD_JOB *_pstJob, orxTHREAD_JOB *_pstPredecessor)
+{
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  /* Checks */
+  orxASSERT((sstThread.u32Flags & orxTHREAD_KU32_STATIC_FLAG_READY) == orxTHREAD_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstJob != orxNULL);
+  orxASSERT(_pstPredecessor != orxNULL);
+  orxASSERT(_pstJob != _pstPredecessor);
+  orxASSERT(_pstJob->u32Status == orxTHREAD_KU32_JOB_STATUS_NONE);
+  orxASSERT(_pstPredecessor->u32Status == orxTHREAD_KU32_JOB_STATUS_NONE);
+
+  /* Has room for a new successor? */
+  if(_pstPredecessor->u32SuccessorCount < orxTHREAD_KU32_JOB_SUCCESSOR_NUMBER)
+  {
+    /* Links them */
+    _pstPredecessor->apstSuccessorList[_pstPredecessor->u32SuccessorCount++] = _pstJob;
+    _pstJob->u32PendingCount++;
+
+    /* Updates result */
+    eResult = orxSTATUS_SUCCESS;
+  }
+  else
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Can't add dependency to job <%p>: its predecessor already has %u successors.", _pstJob, orxTHREAD_KU32_JOB_SUCCESSOR_NUMBER);
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Runs a job: it'll be executed on a task worker thread as soon as all its predecessors have completed
+ * @param[in]   _pstJob                               Concerned job
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+orxSTATUS orxFASTCALL orxThread_RunJob(orxTHREAD_JOB *_pstJob)
+{
+  orxSTATUS eResult;
+
+  /* Checks */
+  orxASSERT((sstThread.u32Flags & orxTHREAD_KU32_STATIC_FLAG_READY) == orxTHREAD_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstJob != orxNULL);
+  orxASSERT(_pstJob->u32Status == orxTHREAD_KU32_JOB_STATUS_NONE);
+
+  /* Starts tasks */
+  eResult = orxThread_StartTasks();
+
+  /* Success? */
+  if(eResult != orxSTATUS_FAILURE)
+  {
+    /* Updates status */
+    _pstJob->u32Status = orxTHREAD_KU32_JOB_STATUS_PENDING;
+    orxMEMORY_BARRIER();
+
+    /* Releases submission hold: no more pending predecessors? */
+    if(orxMEMORY_ATOMIC_ADD_U32(&(_pstJob->u32PendingCount), (orxU32)-1) == 1)
+    {
+      /* Schedules it */
+      orxThread_ScheduleTask(orxThread_GetCurrentWorker(), &(_pstJob->stTask));
+    }
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Is a job done?
+ * @param[in]   _pstJob                               Concerned job
+ * @return      orxTRUE if the job has completed, orxFALSE otherwise
+ */
+orxBOOL orxFASTCALL orxThread_IsJobDone(const orxTHREAD_JOB *_pstJob)
+{
+  orxBOOL bResult;
+
+  /* Checks */
+  orxASSERT((sstThread.u32Flags & orxTHREAD_KU32_STATIC_FLAG_READY) == orxTHREAD_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstJob != orxNULL);
+
+  /* Updates result */
+  bResult = (_pstJob->u32Status == orxTHREAD_KU32_JOB_STATUS_DONE) ? orxTRUE : orxFALSE;
+
+  /* Done! */
+  return bResult;
+}
+
+/** Waits for a job to complete (when called from a task worker thread, other tasks will be processed while waiting)
+ * @param[in]   _pstJob                               Concerned job
+ * @return      Status returned by the job's function
+ */
+orxSTATUS orxFASTCALL orxThread_WaitJob(const orxTHREAD_JOB *_pstJob)
+{
+  orxTHREAD_WORKER *pstWorker;
+  orxSTATUS         eResult;
+
+  /* Checks */
+  orxASSERT((sstThread.u32Flags & orxTHREAD_KU32_STATIC_FLAG_READY) == orxTHREAD_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstJob != orxNULL);
+  orxASSERT(_pstJob->u32Status != orxTHREAD_KU32_JOB_STATUS_NONE);
+
+  /* Gets current worker */
+  pstWorker = orxThread_GetCurrentWorker();
+
+  /* While not done */
+  while(_pstJob->u32Status != orxTHREAD_KU32_JOB_STATUS_DONE)
+  {
+    orxTHREAD_TASK *pstTask;
+
+    /* Is a worker and has a task to process? */
+    if((pstWorker != orxNULL) && ((pstTask = orxThread_GetNextTask(pstWorker)) != orxNULL))
+    {
+      /* Processes it */
+      orxThread_ProcessTask(pstWorker, pstTask);
+    }
+    else
+    {
+      /* Yields */
+      orxThread_Yield();
+    }
+  }
+
+  /* Updates result */
+  orxMEMORY_BARRIER();
+  eResult = _pstJob->stTask.eResult;
+
+  /* Done! */
+  return eResult;
+}
+
+/** Runs a function over a range of indices, split in batches processed in parallel by the calling thread and the task worker threads; returns once all batches have been processed
+ * @param[in]   _u32Count                             Number of indices to process, [0, _u32Count[
+ * @param[in]   _u32Grain                             Maximum number of indices per batch (0 will default to 1)
+ * @param[in]   _pfnRun                               Function to run on each batch, can be called concurrently from different threads
+ * @param[in]   _pContext                             Context that will be transmitted to the function
+ */
+void orxFASTCALL orxThread_ParallelFor(orxU32 _u32Count, orxU32 _u32Grain, const orxTHREAD_RANGE_FUNCTION _pfnRun, void *_pContext)
+{
+  orxU32 u32BatchCount, u32HelperCount = 0;
+
+  /* Checks */
+  orxASSERT((sstThread.u32Flags & orxTHREAD_KU32_STATIC_FLAG_READY) == orxTHREAD_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pfnRun != orxNULL);
+
+  /* Gets batch count */
+  _u32Grain     = (_u32Grain != 0) ? _u32Grain : 1;
+  u32BatchCount = (_u32Count / _u32Grain) + (((_u32Count % _u32Grain) != 0) ? 1 : 0);
+
+  /* More than one batch and workers are available? */
+  if((u32BatchCount > 1) && (orxThread_StartTasks() != orxSTATUS_FAILURE))
+  {
+    /* Gets helper count */
+    u32HelperCount = orxMIN(u32BatchCount - 1, sstThread.u32WorkerCount);
+  }
+
+  /* Any helper? */
+  if(u32HelperCount != 0)
+  {
+    orxTHREAD_RANGE *pstRange;
+
+    /* Allocates range */
+    pstRange = (orxTHREAD_RANGE *)orxMemory_Allocate(sizeof(orxTHREAD_RANGE), orxMEMORY_TYPE_TEMP);
+
+    /* Success? */
+    if(pstRange != orxNULL)
+    {
+      orxTHREAD_TASK *pstFirst = orxNULL, *pstLast = orxNULL;
+      orxU32          i;
+
+      /* Inits it */
+      pstRange->pfnRun        = _pfnRun;
+      pstRange->pContext      = _pContext;
+      pstRange->u32Count      = _u32Count;
+      pstRange->u32Grain      = _u32Grain;
+      pstRange->u32Next       = 0;
+      pstRange->u32Remaining  = u32BatchCount;
+      pstRange->u32RefCount   = u32HelperCount + 1;
+
+      /* Waits for task semaphore */
+      orxThread_WaitSemaphore(sstThread.pstTaskSemaphore);
+
+      /* For all helpers */
+      for(i = 0; i < u32HelperCount; i++)
+      {
+        orxTHREAD_TASK *pstTask;
+
+        /* Allocates its task */
+        pstTask = orxThread_AllocateTask();
+
+        /* Failure? */
+        if(pstTask == orxNULL)
+        {
+          /* Releases missing helpers' references */
+          orxMEMORY_ATOMIC_ADD_U32(&(pstRange->u32RefCount), (orxU32)-(orxS32)(u32HelperCount - i));
+
+          break;
+        }
+
+        /* Inits it */
+        pstTask->pContext = pstRange;
+        pstTask->u32Flags = orxTHREAD_KU32_TASK_FLAG_RANGE;
+
+        /* Links it */
+        pstTask->pstNext  = pstFirst;
+        pstFirst          = pstTask;
+        if(pstLast == orxNULL)
+        {
+          pstLast         = pstTask;
+        }
+      }
+
+      /* Signals task semaphore */
+      orxThread_SignalSemaphore(sstThread.pstTaskSemaphore);
+
+      /* Any helper task? */
+      if(pstFirst != orxNULL)
+      {
+        /* Sends them to inbox */
+        orxThread_PushTaskList(&(sstThread.pstInbox), pstFirst, pstLast);
+
+        /* For all of them */
+        for(; i > 0; i--)
+        {
+          /* Signals worker semaphore */
+          orxThread_SignalSemaphore(sstThread.pstWorkerSemaphore);
+        }
+      }
+
+      /* Takes its own reference for waiting */
+      orxMEMORY_ATOMIC_ADD_U32(&(pstRange->u32RefCount), 1);
+
+      /* Participates */
+      orxThread_RunRange(pstRange);
+
+      /* Waits for batches claimed by helpers */
+      while(pstRange->u32Remaining != 0)
+      {
+        /* Yields */
+        orxThread_Yield();
+      }
+
+      /* Releases range */
+      if(orxMEMORY_ATOMIC_ADD_U32(&(pstRange->u32RefCount), (orxU32)-1) == 1)
+      {
+        /* Deletes it */
+        orxMemory_Free(pstRange);
+      }
+    }
+    else
+    {
+      /* Runs all inline */
+      _pfnRun(0, _u32Count, _pContext);
+    }
+  }
+  else if(_u32Count != 0)
+  {
+    /* Runs all inline */
+    _pfnRun(0, _u32Count, _pContext);
+  }
+
+  /* Done! */
+  return;
+}
+
 /** Sets callbacks to run when starting and stopping new threads
  * @param[in]   _pfnStart                             Function to run whenever a new thread is started
  * @param[in]   _pfnStop                              Function to run whenever a thread is stopped
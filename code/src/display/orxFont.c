@@ -390,6 +390,9 @@ static orxSTATUS orxFASTCALL orxFont_ProcessConfigData(orxFONT *_pstFont)
       /* Valid? */
       if(pstTexture != orxNULL)
       {
+        /* Keeps it out of atlases, as glyphs are mapped in texture space */
+        orxTexture_Unpack(pstTexture);
+
         /* Links it */
         if(orxFont_SetTexture(_pstFont, pstTexture) != orxSTATUS_FAILURE)
         {
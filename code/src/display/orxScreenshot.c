@@ -35,7 +35,9 @@
 #include "debug/orxDebug.h"
 #include "core/orxCommand.h"
 #include "core/orxConfig.h"
+#include "core/orxEvent.h"
 #include "display/orxDisplay.h"
+#include "render/orxRender.h"
 #include "io/orxFile.h"
 #include "utils/orxString.h"
 #include "memory/orxMemory.h"
@@ -70,6 +72,7 @@
 typedef struct __orxSCREENSHOT_STATIC_t
 {
   orxU32    u32ScreenshotIndex;                                 /**< Screenshot index */
+  orxU32    u32SequenceCount;                                   /**< Remaining sequence frame count */
   orxU32    u32Flags;                                           /**< Control flags */
   orxCHAR   acScreenshotBuffer[orxSCREENSHOT_KU32_BUFFER_SIZE]; /**< Screenshot file name buffer */
 
@@ -103,6 +106,20 @@ void orxFASTCALL orxScreenshot_CommandCapture(orxU32 _u32ArgNumber, const orxCOM
   return;
 }
 
+/** Command: CaptureSequence
+ */
+void orxFASTCALL orxScreenshot_CommandCaptureSequence(orxU32 _u32ArgNumber, const orxCOMMAND_VAR *_astArgList, orxCOMMAND_VAR *_pstResult)
+{
+  /* Starts/stops sequence */
+  orxScreenshot_CaptureSequence(_astArgList[0].u32Value);
+
+  /* Updates result */
+  _pstResult->u32Value = sstScreenshot.u32SequenceCount;
+
+  /* Done! */
+  return;
+}
+
 /** Computes next screenshot index
  * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
  */
@@ -198,12 +215,52 @@ static orxINLINE orxSTATUS orxScreenshot_ComputeIndex()
   return eResult;
 }
 
+/** Event handler
+ */
+static orxSTATUS orxFASTCALL orxScreenshot_EventHandler(const orxEVENT *_pstEvent)
+{
+  /* Checks */
+  orxASSERT(_pstEvent->eType == orxEVENT_TYPE_RENDER);
+  orxASSERT(_pstEvent->eID == orxRENDER_EVENT_STOP);
+
+  /* Capturing a sequence? */
+  if(sstScreenshot.u32SequenceCount > 0)
+  {
+    /* Captures current frame, before it gets swapped */
+    if(orxScreenshot_Capture() != orxSTATUS_FAILURE)
+    {
+      /* Updates remaining count */
+      sstScreenshot.u32SequenceCount--;
+    }
+    else
+    {
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_SCREENSHOT, "Couldn't capture sequence frame, aborting with <%u> frame(s) left.", sstScreenshot.u32SequenceCount);
+
+      /* Stops sequence */
+      sstScreenshot.u32SequenceCount = 0;
+    }
+  }
+
+  /* Sequence over? */
+  if(sstScreenshot.u32SequenceCount == 0)
+  {
+    /* Stops listening to render events */
+    orxEvent_SetHandlerIDFlags(orxScreenshot_EventHandler, orxEVENT_TYPE_RENDER, orxNULL, orxEVENT_KU32_FLAG_ID_NONE, orxEVENT_KU32_MASK_ID_ALL);
+  }
+
+  /* Done! */
+  return orxSTATUS_SUCCESS;
+}
+
 /** Registers all the screenshot commands
  */
 static orxINLINE void orxScreenshot_RegisterCommands()
 {
   /* Command: Capture */
   orxCOMMAND_REGISTER_CORE_COMMAND(Screenshot, Capture, "File", orxCOMMAND_VAR_TYPE_STRING, 0, 0);
+  /* Command: CaptureSequence */
+  orxCOMMAND_REGISTER_CORE_COMMAND(Screenshot, CaptureSequence, "Remaining", orxCOMMAND_VAR_TYPE_U32, 1, 0, {"FrameNumber", orxCOMMAND_VAR_TYPE_U32});
 }
 
 /** Unregisters all the screenshot commands
@@ -212,6 +269,8 @@ static orxINLINE void orxScreenshot_UnregisterCommands()
 {
   /* Command: Capture */
   orxCOMMAND_UNREGISTER_CORE_COMMAND(Screenshot, Capture);
+  /* Command: CaptureSequence */
+  orxCOMMAND_UNREGISTER_CORE_COMMAND(Screenshot, CaptureSequence);
 }
 
 /***************************************************************************
@@ -227,6 +286,7 @@ void orxFASTCALL orxScreenshot_Setup()
   orxModule_AddDependency(orxMODULE_ID_SCREENSHOT, orxMODULE_ID_STRING);
   orxModule_AddDependency(orxMODULE_ID_SCREENSHOT, orxMODULE_ID_CONFIG);
   orxModule_AddDependency(orxMODULE_ID_SCREENSHOT, orxMODULE_ID_COMMAND);
+  orxModule_AddDependency(orxMODULE_ID_SCREENSHOT, orxMODULE_ID_EVENT);
   orxModule_AddDependency(orxMODULE_ID_SCREENSHOT, orxMODULE_ID_FILE);
   orxModule_AddDependency(orxMODULE_ID_SCREENSHOT, orxMODULE_ID_DISPLAY);
 
@@ -246,11 +306,26 @@ orxSTATUS orxFASTCALL orxScreenshot_Init()
     /* Cleans control structure */
     orxMemory_Zero(&sstScreenshot, sizeof(orxSCREENSHOT_STATIC));
 
-    /* Registers commands */
-    orxScreenshot_RegisterCommands();
+    /* Adds event handler */
+    eResult = orxEvent_AddHandler(orxEVENT_TYPE_RENDER, orxScreenshot_EventHandler);
+
+    /* Success? */
+    if(eResult != orxSTATUS_FAILURE)
+    {
+      /* Filters out all event IDs till a sequence gets captured */
+      orxEvent_SetHandlerIDFlags(orxScreenshot_EventHandler, orxEVENT_TYPE_RENDER, orxNULL, orxEVENT_KU32_FLAG_ID_NONE, orxEVENT_KU32_MASK_ID_ALL);
+
+      /* Registers commands */
+      orxScreenshot_RegisterCommands();
 
-    /* Inits flags */
-    sstScreenshot.u32Flags = orxSCREENSHOT_KU32_STATIC_FLAG_READY;
+      /* Inits flags */
+      sstScreenshot.u32Flags = orxSCREENSHOT_KU32_STATIC_FLAG_READY;
+    }
+    else
+    {
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_SCREENSHOT, "Failed to add event handler.");
+    }
   }
   else
   {
@@ -272,6 +347,12 @@ void orxFASTCALL orxScreenshot_Exit()
     /* Unregisters commands */
     orxScreenshot_UnregisterCommands();
 
+    /* Removes event handler */
+    orxEvent_RemoveHandler(orxEVENT_TYPE_RENDER, orxScreenshot_EventHandler);
+
+    /* Stops sequence */
+    sstScreenshot.u32SequenceCount = 0;
+
     /* Updates flags */
     sstScreenshot.u32Flags &= ~orxSCREENSHOT_KU32_STATIC_FLAG_READY;
   }
@@ -314,3 +395,33 @@ orxSTATUS orxFASTCALL orxScreenshot_Capture()
   /* Done! */
   return eResult;
 }
+
+/** Captures a sequence of screenshots, one per rendered frame, without stalling rendering when supported by the display plugin
+ * @param[in]   _u32FrameNumber Number of consecutive frames to capture, starting with the current one, 0 to stop any ongoing sequence
+ */
+void orxFASTCALL orxScreenshot_CaptureSequence(orxU32 _u32FrameNumber)
+{
+  /* Checks */
+  orxASSERT(sstScreenshot.u32Flags & orxSCREENSHOT_KU32_STATIC_FLAG_READY);
+
+  /* Stores frame count */
+  sstScreenshot.u32SequenceCount = _u32FrameNumber;
+
+  /* Only listens to render stop events while capturing a sequence */
+  orxEvent_SetHandlerIDFlags(orxScreenshot_EventHandler, orxEVENT_TYPE_RENDER, orxNULL, (_u32FrameNumber > 0) ? orxEVENT_GET_FLAG(orxRENDER_EVENT_STOP) : orxEVENT_KU32_FLAG_ID_NONE, orxEVENT_KU32_MASK_ID_ALL);
+
+  /* Done! */
+  return;
+}
+
+/** Gets the number of frames left to capture in the ongoing sequence
+ * @return Number of remaining frames, 0 if no sequence is being captured
+ */
+orxU32 orxFASTCALL orxScreenshot_GetSequenceCount()
+{
+  /* Checks */
+  orxASSERT(sstScreenshot.u32Flags & orxSCREENSHOT_KU32_STATIC_FLAG_READY);
+
+  /* Done! */
+  return sstScreenshot.u32SequenceCount;
+}
@@ -32,15 +32,19 @@
 
 #include "display/orxTexture.h"
 
+#include "core/orxClock.h"
 #include "core/orxCommand.h"
+#include "core/orxConfig.h"
 #include "core/orxEvent.h"
 #include "core/orxResource.h"
 #include "debug/orxDebug.h"
 #include "debug/orxProfiler.h"
 #include "display/orxDisplay.h"
+#include "memory/orxBank.h"
 #include "memory/orxMemory.h"
 #include "object/orxStructure.h"
 #include "utils/orxHashTable.h"
+#include "utils/orxLinkList.h"
 
 
 /** Module flags
@@ -48,6 +52,7 @@
 #define orxTEXTURE_KU32_STATIC_FLAG_NONE        0x00000000
 
 #define orxTEXTURE_KU32_STATIC_FLAG_READY       0x00000001
+#define orxTEXTURE_KU32_STATIC_FLAG_ATLAS       0x00000002
 
 #define orxTEXTURE_KU32_STATIC_MASK_ALL         0xFFFFFFFF
 
@@ -61,6 +66,9 @@
 #define orxTEXTURE_KU32_FLAG_REF_COORD          0x01000000
 #define orxTEXTURE_KU32_FLAG_SIZE               0x02000000
 #define orxTEXTURE_KU32_FLAG_LOADING            0x04000000
+#define orxTEXTURE_KU32_FLAG_ATLAS              0x08000000
+#define orxTEXTURE_KU32_FLAG_ATLAS_PENDING      0x00100000
+#define orxTEXTURE_KU32_FLAG_NO_ATLAS           0x00200000
 
 #define orxTEXTURE_KU32_MASK_ALL                0xFFFFFFFF
 
@@ -68,51 +76,1032 @@
 
 #define orxTEXTURE_KU32_BANK_SIZE               128
 
+#define orxTEXTURE_KU32_ATLAS_BANK_SIZE         8
+#define orxTEXTURE_KU32_ATLAS_GROUP_TABLE_SIZE  64
+#define orxTEXTURE_KU32_ATLAS_PADDING           1
+#define orxTEXTURE_KU32_ATLAS_MIN_SIZE          64
+#define orxTEXTURE_KU32_ATLAS_MAX_SIZE          8192
+
 #define orxTEXTURE_KU32_HOTLOAD_DELAY           orx2F(0.01f)
 #define orxTEXTURE_KU32_HOTLOAD_TRY_NUMBER      10
 
-#define orxTEXTURE_KZ_DEFAULT_EXTENSION         "png"
+#define orxTEXTURE_KZ_DEFAULT_EXTENSION         "png"
+
+
+/***************************************************************************
+ * Structure declaration                                                   *
+ ***************************************************************************/
+
+/** Skyline node
+ */
+typedef struct __orxTEXTURE_SKYLINE_NODE_t
+{
+  orxU32          u32X;                         /**< X : 4 */
+  orxU32          u32Y;                         /**< Y : 8 */
+  orxU32          u32Width;                     /**< Width : 12 */
+
+} orxTEXTURE_SKYLINE_NODE;
+
+/** Atlas page
+ */
+typedef struct __orxTEXTURE_ATLAS_t
+{
+  orxLINKLIST_NODE          stNode;             /**< Linklist node : 12 */
+  orxBITMAP                *pstBitmap;          /**< Page bitmap : 16 */
+  orxTEXTURE_SKYLINE_NODE  *astSkyline;         /**< Skyline : 20 */
+  orxU32                    u32SkylineCount;    /**< Skyline node count : 24 */
+  orxSTRINGID               stGroupID;          /**< Group ID : 28 */
+  orxU32                    u32UsedArea;        /**< Area used by live textures : 32 */
+  orxU32                    u32AllocatedArea;   /**< Area allocated since last repack : 36 */
+  orxU32                    u32TextureCount;    /**< Texture count : 40 */
+
+} orxTEXTURE_ATLAS;
+
+/** Texture structure
+ */
+struct __orxTEXTURE_t
+{
+  orxSTRUCTURE      stStructure;                /**< Public structure, first structure member : 32 */
+  orxSTRINGID       stID;                       /**< Associated name ID : 36 */
+  orxFLOAT          fWidth;                     /**< Width : 40 */
+  orxFLOAT          fHeight;                    /**< Height : 44 */
+  orxHANDLE         hData;                      /**< Data : 48 */
+  orxTEXTURE_ATLAS *pstAtlas;                   /**< Atlas page : 52 */
+  orxU32            u32AtlasX;                  /**< X position inside atlas page : 56 */
+  orxU32            u32AtlasY;                  /**< Y position inside atlas page : 60 */
+  orxU8            *au8AtlasData;               /**< Decoded pixels (RGBA) waiting to be packed : 64 */
+};
+
+/** Atlas entry
+ */
+typedef struct __orxTEXTURE_ATLAS_ENTRY_t
+{
+  orxTEXTURE     *pstTexture;                   /**< Texture : 4 */
+  orxU32          u32X;                         /**< X : 8 */
+  orxU32          u32Y;                         /**< Y : 12 */
+
+} orxTEXTURE_ATLAS_ENTRY;
+
+/** Static structure
+ */
+typedef struct __orxTEXTURE_STATIC_t
+{
+  orxHASHTABLE   *pstTable;                     /**< Bitmap hashtable */
+  orxTEXTURE     *pstScreen;                    /**< Screen texture */
+  orxTEXTURE     *pstPixel;                     /**< Pixel texture */
+  orxSTRINGID     stResourceGroupID;            /**< Resource group ID */
+  orxU32          u32LoadCount;                 /**< Load count */
+  orxTEXTURE     *pstLoadingTexture;            /**< Texture being loaded synchronously */
+  orxSTRINGID     stLoadingID;                  /**< Name ID of the texture being loaded synchronously */
+  orxHASHTABLE   *pstAtlasGroupTable;           /**< Atlas group table (texture name ID -> group ID) */
+  orxBANK        *pstAtlasBank;                 /**< Atlas page bank */
+  orxLINKLIST     stAtlasList;                  /**< Atlas page list */
+  const orxTEXTURE *pstLastAtlasTexture;        /**< Last queried atlas texture */
+  const orxTEXTURE_ATLAS *pstLastAtlas;         /**< Last queried atlas page */
+  orxSTRINGID     stDefaultAtlasGroupID;        /**< Default atlas group ID */
+  orxU32          u32AtlasSize;                 /**< Atlas page size */
+  orxU32          u32AtlasThreshold;            /**< Atlas size threshold */
+  orxU32          u32AtlasPendingCount;         /**< Textures waiting to be packed */
+  orxU32          u32AtlasRepackCount;          /**< Repack count */
+  orxU32          u32AtlasSavedBindCount;       /**< Saved binds (current frame) */
+  orxU32          u32AtlasLastSavedBindCount;   /**< Saved binds (last frame) */
+  orxU32          u32Flags;                     /**< Control flags */
+
+} orxTEXTURE_STATIC;
+
+
+/***************************************************************************
+ * Module global variable                                                  *
+ ***************************************************************************/
+
+static orxTEXTURE_STATIC sstTexture;
+
+
+/***************************************************************************
+ * Private functions                                                       *
+ ***************************************************************************/
+
+/** Gets the atlas group of a texture
+ * @param[in]   _stID           Texture name ID
+ * @param[in]   _u32Width       Texture width
+ * @param[in]   _u32Height      Texture height
+ * @return      Group ID / orxSTRINGID_UNDEFINED if it shouldn't be packed
+ */
+static orxINLINE orxSTRINGID orxTexture_GetAtlasGroup(orxSTRINGID _stID, orxU32 _u32Width, orxU32 _u32Height)
+{
+  void       *pGroup;
+  orxSTRINGID stResult = orxSTRINGID_UNDEFINED;
+
+  /* Gets explicit group */
+  pGroup = orxHashTable_Get(sstTexture.pstAtlasGroupTable, _stID);
+
+  /* Found? */
+  if(pGroup != orxNULL)
+  {
+    /* Updates result */
+    stResult = (orxSTRINGID)(size_t)pGroup;
+  }
+  /* Small enough? */
+  else if((_u32Width <= sstTexture.u32AtlasThreshold)
+       && (_u32Height <= sstTexture.u32AtlasThreshold))
+  {
+    /* Uses default group */
+    stResult = sstTexture.stDefaultAtlasGroupID;
+  }
+
+  /* Done! */
+  return stResult;
+}
+
+/** Cancels a pending pack request, releasing its decoded pixels
+ * @param[in]   _pstTexture     Concerned texture
+ */
+static orxINLINE void orxTexture_CancelAtlas(orxTEXTURE *_pstTexture)
+{
+  /* Pending? */
+  if(orxStructure_TestFlags(_pstTexture, orxTEXTURE_KU32_FLAG_ATLAS_PENDING) != orxFALSE)
+  {
+    /* Updates status */
+    orxStructure_SetFlags(_pstTexture, orxTEXTURE_KU32_FLAG_NONE, orxTEXTURE_KU32_FLAG_ATLAS_PENDING);
+
+    /* Updates pending count */
+    sstTexture.u32AtlasPendingCount--;
+  }
+
+  /* Has decoded pixels? */
+  if(_pstTexture->au8AtlasData != orxNULL)
+  {
+    /* Frees them */
+    orxMemory_Free(_pstTexture->au8AtlasData);
+    _pstTexture->au8AtlasData = orxNULL;
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Requests a texture to be packed during next update
+ * @param[in]   _pstTexture     Concerned texture
+ */
+static orxINLINE void orxTexture_RequestAtlas(orxTEXTURE *_pstTexture)
+{
+  /* Atlas enabled, texture owns its bitmap and wasn't excluded? */
+  if(orxFLAG_TEST(sstTexture.u32Flags, orxTEXTURE_KU32_STATIC_FLAG_ATLAS)
+  && (orxStructure_TestAllFlags(_pstTexture, orxTEXTURE_KU32_FLAG_BITMAP | orxTEXTURE_KU32_FLAG_INTERNAL) != orxFALSE)
+  && (orxStructure_TestFlags(_pstTexture, orxTEXTURE_KU32_FLAG_NO_ATLAS | orxTEXTURE_KU32_FLAG_ATLAS | orxTEXTURE_KU32_FLAG_ATLAS_PENDING) == orxFALSE)
+  && (orxTexture_GetAtlasGroup(_pstTexture->stID, orxF2U(_pstTexture->fWidth), orxF2U(_pstTexture->fHeight)) != orxSTRINGID_UNDEFINED))
+  {
+    /* Updates status */
+    orxStructure_SetFlags(_pstTexture, orxTEXTURE_KU32_FLAG_ATLAS_PENDING, orxTEXTURE_KU32_FLAG_NONE);
+
+    /* Updates pending count */
+    sstTexture.u32AtlasPendingCount++;
+  }
+  /* Not pending? */
+  else if(orxStructure_TestFlags(_pstTexture, orxTEXTURE_KU32_FLAG_ATLAS_PENDING) == orxFALSE)
+  {
+    /* Releases pixels stored for packing */
+    orxTexture_CancelAtlas(_pstTexture);
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Inserts a texture in a list sorted by decreasing height
+ * @param[in]   _astEntryList   Entry list
+ * @param[in]   _u32Count       Current entry count
+ * @param[in]   _pstTexture     Texture to insert
+ */
+static orxINLINE void orxTexture_InsertAtlasEntry(orxTEXTURE_ATLAS_ENTRY *_astEntryList, orxU32 _u32Count, orxTEXTURE *_pstTexture)
+{
+  orxU32 i;
+
+  /* Finds its place, shifting smaller ones */
+  for(i = _u32Count; (i > 0) && (_astEntryList[i - 1].pstTexture->fHeight < _pstTexture->fHeight); i--)
+  {
+    _astEntryList[i] = _astEntryList[i - 1];
+  }
+
+  /* Stores it */
+  _astEntryList[i].pstTexture = _pstTexture;
+  _astEntryList[i].u32X       = 0;
+  _astEntryList[i].u32Y       = 0;
+
+  /* Done! */
+  return;
+}
+
+/** Resets an atlas skyline
+ * @param[in]   _pstAtlas       Concerned atlas page
+ */
+static orxINLINE void orxTexture_ResetSkyline(orxTEXTURE_ATLAS *_pstAtlas)
+{
+  /* Single flat segment */
+  _pstAtlas->astSkyline[0].u32X     = 0;
+  _pstAtlas->astSkyline[0].u32Y     = 0;
+  _pstAtlas->astSkyline[0].u32Width = sstTexture.u32AtlasSize;
+  _pstAtlas->u32SkylineCount        = 1;
+
+  /* Done! */
+  return;
+}
+
+/** Allocates a rectangle in an atlas page, using the skyline bottom-left heuristic
+ * @param[in]   _pstAtlas       Concerned atlas page
+ * @param[in]   _u32Width       Rectangle width
+ * @param[in]   _u32Height      Rectangle height
+ * @param[out]  _pu32X          Rectangle X
+ * @param[out]  _pu32Y          Rectangle Y
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+static orxSTATUS orxFASTCALL orxTexture_AllocateSkyline(orxTEXTURE_ATLAS *_pstAtlas, orxU32 _u32Width, orxU32 _u32Height, orxU32 *_pu32X, orxU32 *_pu32Y)
+{
+  orxTEXTURE_SKYLINE_NODE  *astSkyline;
+  orxU32                    u32BestIndex = orxU32_UNDEFINED, u32BestY = orxU32_UNDEFINED, u32BestWidth = orxU32_UNDEFINED, i;
+  orxSTATUS                 eResult = orxSTATUS_FAILURE;
+
+  /* Gets skyline */
+  astSkyline = _pstAtlas->astSkyline;
+
+  /* For all segments */
+  for(i = 0; i < _pstAtlas->u32SkylineCount; i++)
+  {
+    /* Fits horizontally? */
+    if(astSkyline[i].u32X + _u32Width <= sstTexture.u32AtlasSize)
+    {
+      orxU32 u32Y, u32Remaining, j;
+
+      /* Finds resting height over all covered segments */
+      for(u32Y = 0, u32Remaining = _u32Width, j = i; u32Remaining > 0; j++)
+      {
+        /* Updates height */
+        u32Y = orxMAX(u32Y, astSkyline[j].u32Y);
+
+        /* Updates remaining width */
+        u32Remaining = (astSkyline[j].u32Width < u32Remaining) ? u32Remaining - astSkyline[j].u32Width : 0;
+      }
+
+      /* Fits vertically and is a better (lower, then narrower) spot? */
+      if((u32Y + _u32Height <= sstTexture.u32AtlasSize)
+      && ((u32Y < u32BestY)
+       || ((u32Y == u32BestY) && (astSkyline[i].u32Width < u32BestWidth))))
+      {
+        /* Stores it */
+        u32BestIndex  = i;
+        u32BestY      = u32Y;
+        u32BestWidth  = astSkyline[i].u32Width;
+      }
+    }
+    else
+    {
+      /* Next segments will be even further right */
+      break;
+    }
+  }
+
+  /* Found? */
+  if(u32BestIndex != orxU32_UNDEFINED)
+  {
+    orxU32 u32X, u32Right;
+
+    /* Gets position */
+    u32X = astSkyline[u32BestIndex].u32X;
+
+    /* Makes room for the new segment */
+    orxMemory_Move(&astSkyline[u32BestIndex + 1], &astSkyline[u32BestIndex], (_pstAtlas->u32SkylineCount - u32BestIndex) * sizeof(orxTEXTURE_SKYLINE_NODE));
+    _pstAtlas->u32SkylineCount++;
+
+    /* Inits it */
+    astSkyline[u32BestIndex].u32X     = u32X;
+    astSkyline[u32BestIndex].u32Y     = u32BestY + _u32Height;
+    astSkyline[u32BestIndex].u32Width = _u32Width;
+    u32Right                          = u32X + _u32Width;
+
+    /* Trims or removes the segments it now covers */
+    for(i = u32BestIndex + 1; (i < _pstAtlas->u32SkylineCount) && (astSkyline[i].u32X < u32Right);)
+    {
+      /* Fully covered? */
+      if(astSkyline[i].u32X + astSkyline[i].u32Width <= u32Right)
+      {
+        /* Removes it */
+        orxMemory_Move(&astSkyline[i], &astSkyline[i + 1], (_pstAtlas->u32SkylineCount - i - 1) * sizeof(orxTEXTURE_SKYLINE_NODE));
+        _pstAtlas->u32SkylineCount--;
+      }
+      else
+      {
+        /* Trims it */
+        astSkyline[i].u32Width -= u32Right - astSkyline[i].u32X;
+        astSkyline[i].u32X      = u32Right;
+        break;
+      }
+    }
+
+    /* Merges neighbor segments of same height */
+    for(i = 0; i + 1 < _pstAtlas->u32SkylineCount;)
+    {
+      /* Same height? */
+      if(astSkyline[i].u32Y == astSkyline[i + 1].u32Y)
+      {
+        /* Merges them */
+        astSkyline[i].u32Width += astSkyline[i + 1].u32Width;
+        orxMemory_Move(&astSkyline[i + 1], &astSkyline[i + 2], (_pstAtlas->u32SkylineCount - i - 2) * sizeof(orxTEXTURE_SKYLINE_NODE));
+        _pstAtlas->u32SkylineCount--;
+      }
+      else
+      {
+        i++;
+      }
+    }
+
+    /* Stores position */
+    *_pu32X = u32X;
+    *_pu32Y = u32BestY;
+
+    /* Updates result */
+    eResult = orxSTATUS_SUCCESS;
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Creates an atlas page
+ * @param[in]   _stGroupID      Group ID
+ * @return      orxTEXTURE_ATLAS / orxNULL
+ */
+static orxTEXTURE_ATLAS *orxFASTCALL orxTexture_CreateAtlas(orxSTRINGID _stGroupID)
+{
+  orxTEXTURE_ATLAS *pstResult;
+
+  /* Allocates it */
+  pstResult = (orxTEXTURE_ATLAS *)orxBank_Allocate(sstTexture.pstAtlasBank);
+
+  /* Success? */
+  if(pstResult != orxNULL)
+  {
+    /* Inits it */
+    orxMemory_Zero(pstResult, sizeof(orxTEXTURE_ATLAS));
+    pstResult->stGroupID  = _stGroupID;
+
+    /* Creates its bitmap */
+    pstResult->pstBitmap  = orxDisplay_CreateBitmap(sstTexture.u32AtlasSize, sstTexture.u32AtlasSize);
+
+    /* Allocates its skyline (one extra node for transient splits) */
+    pstResult->astSkyline = (orxTEXTURE_SKYLINE_NODE *)orxMemory_Allocate((sstTexture.u32AtlasSize + 1) * sizeof(orxTEXTURE_SKYLINE_NODE), orxMEMORY_TYPE_MAIN);
+
+    /* Success? */
+    if((pstResult->pstBitmap != orxNULL) && (pstResult->astSkyline != orxNULL))
+    {
+      /* Clears its content */
+      orxDisplay_ClearBitmap(pstResult->pstBitmap, orx2RGBA(0x00, 0x00, 0x00, 0x00));
+
+      /* Resets skyline */
+      orxTexture_ResetSkyline(pstResult);
+
+      /* Adds it to the list */
+      orxLinkList_AddEnd(&(sstTexture.stAtlasList), &(pstResult->stNode));
+    }
+    else
+    {
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "Couldn't create %ux%u atlas page.", sstTexture.u32AtlasSize, sstTexture.u32AtlasSize);
+
+      /* Frees everything */
+      if(pstResult->pstBitmap != orxNULL)
+      {
+        orxDisplay_DeleteBitmap(pstResult->pstBitmap);
+      }
+      if(pstResult->astSkyline != orxNULL)
+      {
+        orxMemory_Free(pstResult->astSkyline);
+      }
+      orxBank_Free(sstTexture.pstAtlasBank, pstResult);
+
+      /* Updates result */
+      pstResult = orxNULL;
+    }
+  }
+
+  /* Done! */
+  return pstResult;
+}
+
+/** Deletes an atlas page
+ * @param[in]   _pstAtlas       Concerned atlas page
+ */
+static void orxFASTCALL orxTexture_DeleteAtlas(orxTEXTURE_ATLAS *_pstAtlas)
+{
+  /* Removes it from the list */
+  orxLinkList_Remove(&(_pstAtlas->stNode));
+
+  /* Was last queried page? */
+  if(sstTexture.pstLastAtlas == _pstAtlas)
+  {
+    /* Clears it */
+    sstTexture.pstLastAtlas         = orxNULL;
+    sstTexture.pstLastAtlasTexture  = orxNULL;
+  }
+
+  /* Frees everything */
+  orxDisplay_DeleteBitmap(_pstAtlas->pstBitmap);
+  orxMemory_Free(_pstAtlas->astSkyline);
+  orxBank_Free(sstTexture.pstAtlasBank, _pstAtlas);
+
+  /* Done! */
+  return;
+}
+
+/** Releases a texture's slot from its atlas page, deleting the page when it becomes empty
+ * @param[in]   _pstTexture     Concerned texture
+ */
+static void orxFASTCALL orxTexture_ReleaseAtlas(orxTEXTURE *_pstTexture)
+{
+  orxTEXTURE_ATLAS *pstAtlas;
+
+  /* Gets its page */
+  pstAtlas = _pstTexture->pstAtlas;
+
+  /* Checks */
+  orxASSERT(pstAtlas != orxNULL);
+  orxASSERT(pstAtlas->u32TextureCount > 0);
+
+  /* Updates page */
+  pstAtlas->u32UsedArea -= (orxF2U(_pstTexture->fWidth) + 2 * orxTEXTURE_KU32_ATLAS_PADDING) * (orxF2U(_pstTexture->fHeight) + 2 * orxTEXTURE_KU32_ATLAS_PADDING);
+  pstAtlas->u32TextureCount--;
+
+  /* Updates texture */
+  _pstTexture->pstAtlas = orxNULL;
+  orxStructure_SetFlags(_pstTexture, orxTEXTURE_KU32_FLAG_NONE, orxTEXTURE_KU32_FLAG_ATLAS);
+
+  /* Empty? */
+  if(pstAtlas->u32TextureCount == 0)
+  {
+    /* Deletes it */
+    orxTexture_DeleteAtlas(pstAtlas);
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Uploads pixels into an atlas slot, extruding borders into the padding
+ * @param[in]   _pstAtlas       Concerned atlas page
+ * @param[in]   _u32X           Slot X (padding included)
+ * @param[in]   _u32Y           Slot Y (padding included)
+ * @param[in]   _u32Width       Source width
+ * @param[in]   _u32Height      Source height
+ * @param[in]   _au8Source      Source pixels (RGBA)
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+static orxSTATUS orxFASTCALL orxTexture_WriteAtlas(orxTEXTURE_ATLAS *_pstAtlas, orxU32 _u32X, orxU32 _u32Y, orxU32 _u32Width, orxU32 _u32Height, const orxU8 *_au8Source)
+{
+  orxU8    *au8Slot;
+  orxU32    u32SlotWidth, u32SlotHeight;
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  /* Gets slot size */
+  u32SlotWidth  = _u32Width + 2 * orxTEXTURE_KU32_ATLAS_PADDING;
+  u32SlotHeight = _u32Height + 2 * orxTEXTURE_KU32_ATLAS_PADDING;
+
+  /* Allocates slot buffer */
+  au8Slot = (orxU8 *)orxMemory_Allocate(u32SlotWidth * u32SlotHeight * 4 * sizeof(orxU8), orxMEMORY_TYPE_TEMP);
+
+  /* Success? */
+  if(au8Slot != orxNULL)
+  {
+    orxU8  *pu8Dst;
+    orxU32  i, j;
+
+    /* For all slot rows */
+    for(j = 0, pu8Dst = au8Slot; j < u32SlotHeight; j++)
+    {
+      const orxU8  *pu8Src;
+      orxU32        u32SrcY;
+
+      /* Gets source row (clamped) */
+      u32SrcY = (j < orxTEXTURE_KU32_ATLAS_PADDING) ? 0 : orxMIN(j - orxTEXTURE_KU32_ATLAS_PADDING, _u32Height - 1);
+      pu8Src  = _au8Source + u32SrcY * _u32Width * 4;
+
+      /* Left border */
+      for(i = 0; i < orxTEXTURE_KU32_ATLAS_PADDING; i++, pu8Dst += 4)
+      {
+        orxMemory_Copy(pu8Dst, pu8Src, 4);
+      }
+
+      /* Content */
+      orxMemory_Copy(pu8Dst, pu8Src, _u32Width * 4);
+      pu8Dst += _u32Width * 4;
+
+      /* Right border */
+      for(i = 0; i < orxTEXTURE_KU32_ATLAS_PADDING; i++, pu8Dst += 4)
+      {
+        orxMemory_Copy(pu8Dst, pu8Src + (_u32Width - 1) * 4, 4);
+      }
+    }
+
+    /* Uploads slot */
+    eResult = orxDisplay_SetPartialBitmapData(_pstAtlas->pstBitmap, au8Slot, _u32X, _u32Y, u32SlotWidth, u32SlotHeight);
+
+    /* Frees slot buffer */
+    orxMemory_Free(au8Slot);
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Reads back the content of an atlas page, only used when textures need to be moved around or extracted
+ * @param[in]   _pstAtlas       Concerned atlas page
+ * @return      Page pixels (RGBA), to be freed by the caller / orxNULL
+ */
+static orxU8 *orxFASTCALL orxTexture_ReadAtlas(const orxTEXTURE_ATLAS *_pstAtlas)
+{
+  orxU8  *au8Result;
+  orxU32  u32Size;
+
+  /* Gets page size */
+  u32Size   = sstTexture.u32AtlasSize * sstTexture.u32AtlasSize * 4 * sizeof(orxU8);
+
+  /* Allocates buffer */
+  au8Result = (orxU8 *)orxMemory_Allocate(u32Size, orxMEMORY_TYPE_TEMP);
+
+  /* Success? */
+  if(au8Result != orxNULL)
+  {
+    /* Failed reading page? */
+    if(orxDisplay_GetBitmapData(_pstAtlas->pstBitmap, au8Result, u32Size) == orxSTATUS_FAILURE)
+    {
+      /* Frees buffer */
+      orxMemory_Free(au8Result);
+      au8Result = orxNULL;
+    }
+  }
+
+  /* Done! */
+  return au8Result;
+}
+
+/** Repacks an atlas page, reclaiming space freed by unloaded textures
+ * @param[in]   _pstAtlas       Concerned atlas page
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+static orxSTATUS orxFASTCALL orxTexture_RepackAtlas(orxTEXTURE_ATLAS *_pstAtlas)
+{
+  orxTEXTURE_ATLAS_ENTRY   *astEntryList;
+  orxTEXTURE_SKYLINE_NODE  *astSkylineBackup;
+  orxSTATUS                 eResult = orxSTATUS_FAILURE;
+
+  /* Profiles */
+  orxPROFILER_PUSH_MARKER("orxTexture_RepackAtlas");
+
+  /* Allocates working buffers */
+  astEntryList      = (orxTEXTURE_ATLAS_ENTRY *)orxMemory_Allocate(_pstAtlas->u32TextureCount * sizeof(orxTEXTURE_ATLAS_ENTRY), orxMEMORY_TYPE_TEMP);
+  astSkylineBackup  = (orxTEXTURE_SKYLINE_NODE *)orxMemory_Allocate(_pstAtlas->u32SkylineCount * sizeof(orxTEXTURE_SKYLINE_NODE), orxMEMORY_TYPE_TEMP);
+
+  /* Success? */
+  if((astEntryList != orxNULL) && (astSkylineBackup != orxNULL))
+  {
+    orxTEXTURE *pstTexture;
+    orxU8      *au8Data = orxNULL, *au8Slot = orxNULL;
+    orxU32      u32Count, u32SkylineCount, u32MaxSlotSize, i;
+
+    /* Gathers page's textures, tallest first */
+    for(pstTexture = orxTEXTURE(orxStructure_GetFirst(orxSTRUCTURE_ID_TEXTURE)), u32Count = 0, u32MaxSlotSize = 0;
+        pstTexture != orxNULL;
+        pstTexture = orxTEXTURE(orxStructure_GetNext(pstTexture)))
+    {
+      /* In page? */
+      if(pstTexture->pstAtlas == _pstAtlas)
+      {
+        orxU32 u32SlotSize;
+
+        /* Inserts it */
+        orxTexture_InsertAtlasEntry(astEntryList, u32Count++, pstTexture);
+
+        /* Updates largest slot size */
+        u32SlotSize     = (orxF2U(pstTexture->fWidth) + 2 * orxTEXTURE_KU32_ATLAS_PADDING) * (orxF2U(pstTexture->fHeight) + 2 * orxTEXTURE_KU32_ATLAS_PADDING) * 4 * sizeof(orxU8);
+        u32MaxSlotSize  = orxMAX(u32MaxSlotSize, u32SlotSize);
+      }
+    }
+
+    /* Checks */
+    orxASSERT(u32Count == _pstAtlas->u32TextureCount);
+
+    /* Backups skyline */
+    u32SkylineCount = _pstAtlas->u32SkylineCount;
+    orxMemory_Copy(astSkylineBackup, _pstAtlas->astSkyline, u32SkylineCount * sizeof(orxTEXTURE_SKYLINE_NODE));
+
+    /* Resets it */
+    orxTexture_ResetSkyline(_pstAtlas);
+
+    /* Allocates all slots */
+    for(i = 0; i < u32Count; i++)
+    {
+      /* Failure? */
+      if(orxTexture_AllocateSkyline(_pstAtlas, orxF2U(astEntryList[i].pstTexture->fWidth) + 2 * orxTEXTURE_KU32_ATLAS_PADDING, orxF2U(astEntryList[i].pstTexture->fHeight) + 2 * orxTEXTURE_KU32_ATLAS_PADDING, &(astEntryList[i].u32X), &(astEntryList[i].u32Y)) == orxSTATUS_FAILURE)
+      {
+        break;
+      }
+    }
+
+    /* All placed? */
+    if(i == u32Count)
+    {
+      /* Reads current content and allocates slot buffer */
+      au8Data = orxTexture_ReadAtlas(_pstAtlas);
+      au8Slot = (orxU8 *)orxMemory_Allocate(u32MaxSlotSize, orxMEMORY_TYPE_TEMP);
+    }
+
+    /* Ready to move slots? */
+    if((au8Data != orxNULL) && (au8Slot != orxNULL))
+    {
+      /* For all textures */
+      for(i = 0; i < u32Count; i++)
+      {
+        orxU32 u32Width, u32Height, j;
+
+        /* Gets slot size */
+        pstTexture  = astEntryList[i].pstTexture;
+        u32Width    = orxF2U(pstTexture->fWidth) + 2 * orxTEXTURE_KU32_ATLAS_PADDING;
+        u32Height   = orxF2U(pstTexture->fHeight) + 2 * orxTEXTURE_KU32_ATLAS_PADDING;
+
+        /* Extracts its slot from former content */
+        for(j = 0; j < u32Height; j++)
+        {
+          orxMemory_Copy(au8Slot + j * u32Width * 4,
+                         au8Data + ((pstTexture->u32AtlasY - orxTEXTURE_KU32_ATLAS_PADDING + j) * sstTexture.u32AtlasSize + pstTexture->u32AtlasX - orxTEXTURE_KU32_ATLAS_PADDING) * 4,
+                         u32Width * 4);
+        }
+
+        /* Uploads it at its new position */
+        orxDisplay_SetPartialBitmapData(_pstAtlas->pstBitmap, au8Slot, astEntryList[i].u32X, astEntryList[i].u32Y, u32Width, u32Height);
+
+        /* Updates its position */
+        pstTexture->u32AtlasX = astEntryList[i].u32X + orxTEXTURE_KU32_ATLAS_PADDING;
+        pstTexture->u32AtlasY = astEntryList[i].u32Y + orxTEXTURE_KU32_ATLAS_PADDING;
+      }
+
+      /* Updates page */
+      _pstAtlas->u32AllocatedArea = _pstAtlas->u32UsedArea;
+
+      /* Updates stats */
+      sstTexture.u32AtlasRepackCount++;
+
+      /* Updates result */
+      eResult = orxSTATUS_SUCCESS;
+    }
+    else
+    {
+      /* Restores skyline */
+      orxMemory_Copy(_pstAtlas->astSkyline, astSkylineBackup, u32SkylineCount * sizeof(orxTEXTURE_SKYLINE_NODE));
+      _pstAtlas->u32SkylineCount = u32SkylineCount;
+    }
+
+    /* Frees pixel buffers */
+    if(au8Data != orxNULL)
+    {
+      orxMemory_Free(au8Data);
+    }
+    if(au8Slot != orxNULL)
+    {
+      orxMemory_Free(au8Slot);
+    }
+  }
+
+  /* Frees working buffers */
+  if(astEntryList != orxNULL)
+  {
+    orxMemory_Free(astEntryList);
+  }
+  if(astSkylineBackup != orxNULL)
+  {
+    orxMemory_Free(astSkylineBackup);
+  }
+
+  /* Profiles */
+  orxPROFILER_POP_MARKER();
+
+  /* Done! */
+  return eResult;
+}
+
+/** Packs a texture into an atlas page of its group, using the pixels stored when its bitmap got decoded
+ * @param[in]   _pstTexture     Concerned texture
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+static orxSTATUS orxFASTCALL orxTexture_PackAtlas(orxTEXTURE *_pstTexture)
+{
+  orxSTRINGID stGroupID;
+  orxU32      u32Width, u32Height, u32SlotWidth, u32SlotHeight;
+  orxSTATUS   eResult = orxSTATUS_FAILURE;
+
+  /* Gets its sizes */
+  u32Width      = orxF2U(_pstTexture->fWidth);
+  u32Height     = orxF2U(_pstTexture->fHeight);
+  u32SlotWidth  = u32Width + 2 * orxTEXTURE_KU32_ATLAS_PADDING;
+  u32SlotHeight = u32Height + 2 * orxTEXTURE_KU32_ATLAS_PADDING;
+
+  /* Gets its group */
+  stGroupID     = orxTexture_GetAtlasGroup(_pstTexture->stID, u32Width, u32Height);
+
+  /* Has pixels, still eligible and fits in a page? */
+  if((_pstTexture->au8AtlasData != orxNULL)
+  && (stGroupID != orxSTRINGID_UNDEFINED)
+  && (orxStructure_TestFlags(_pstTexture, orxTEXTURE_KU32_FLAG_INTERNAL) != orxFALSE)
+  && (u32Width > 0)
+  && (u32Height > 0)
+  && (u32SlotWidth <= sstTexture.u32AtlasSize)
+  && (u32SlotHeight <= sstTexture.u32AtlasSize))
+  {
+    orxTEXTURE_ATLAS *pstAtlas;
+    orxU32            u32X = 0, u32Y = 0;
+
+    /* For all pages of its group */
+    for(pstAtlas = (orxTEXTURE_ATLAS *)orxLinkList_GetFirst(&(sstTexture.stAtlasList));
+        pstAtlas != orxNULL;
+        pstAtlas = (orxTEXTURE_ATLAS *)orxLinkList_GetNext(&(pstAtlas->stNode)))
+    {
+      /* Same group and has room? */
+      if((pstAtlas->stGroupID == stGroupID)
+      && (orxTexture_AllocateSkyline(pstAtlas, u32SlotWidth, u32SlotHeight, &u32X, &u32Y) != orxSTATUS_FAILURE))
+      {
+        break;
+      }
+    }
+
+    /* Not found? */
+    if(pstAtlas == orxNULL)
+    {
+      /* For all pages of its group */
+      for(pstAtlas = (orxTEXTURE_ATLAS *)orxLinkList_GetFirst(&(sstTexture.stAtlasList));
+          pstAtlas != orxNULL;
+          pstAtlas = (orxTEXTURE_ATLAS *)orxLinkList_GetNext(&(pstAtlas->stNode)))
+      {
+        /* Same group and enough freed space to be worth a repack? */
+        if((pstAtlas->stGroupID == stGroupID)
+        && (pstAtlas->u32AllocatedArea - pstAtlas->u32UsedArea >= u32SlotWidth * u32SlotHeight)
+        && (orxTexture_RepackAtlas(pstAtlas) != orxSTATUS_FAILURE)
+        && (orxTexture_AllocateSkyline(pstAtlas, u32SlotWidth, u32SlotHeight, &u32X, &u32Y) != orxSTATUS_FAILURE))
+        {
+          break;
+        }
+      }
+
+      /* Still not found? */
+      if(pstAtlas == orxNULL)
+      {
+        /* Creates new page */
+        pstAtlas = orxTexture_CreateAtlas(stGroupID);
+
+        /* Success? */
+        if(pstAtlas != orxNULL)
+        {
+          /* Allocates slot (can't fail on an empty page) */
+          eResult = orxTexture_AllocateSkyline(pstAtlas, u32SlotWidth, u32SlotHeight, &u32X, &u32Y);
+          orxASSERT(eResult != orxSTATUS_FAILURE);
+        }
+      }
+    }
+
+    /* Found? */
+    if(pstAtlas != orxNULL)
+    {
+      /* Uploads its pixels */
+      eResult = orxTexture_WriteAtlas(pstAtlas, u32X, u32Y, u32Width, u32Height, _pstTexture->au8AtlasData);
+
+      /* Updates page (the slot remains allocated upon failure, till next repack) */
+      pstAtlas->u32AllocatedArea += u32SlotWidth * u32SlotHeight;
+
+      /* Success? */
+      if(eResult != orxSTATUS_FAILURE)
+      {
+        /* Updates page */
+        pstAtlas->u32UsedArea += u32SlotWidth * u32SlotHeight;
+        pstAtlas->u32TextureCount++;
+
+        /* Deletes standalone bitmap */
+        orxDisplay_DeleteBitmap((orxBITMAP *)_pstTexture->hData);
+
+        /* Updates texture */
+        _pstTexture->hData      = (orxHANDLE)pstAtlas->pstBitmap;
+        _pstTexture->pstAtlas   = pstAtlas;
+        _pstTexture->u32AtlasX  = u32X + orxTEXTURE_KU32_ATLAS_PADDING;
+        _pstTexture->u32AtlasY  = u32Y + orxTEXTURE_KU32_ATLAS_PADDING;
+        orxStructure_SetFlags(_pstTexture, orxTEXTURE_KU32_FLAG_ATLAS, orxTEXTURE_KU32_FLAG_INTERNAL);
+      }
+      /* Empty page? */
+      else if(pstAtlas->u32TextureCount == 0)
+      {
+        /* Deletes it */
+        orxTexture_DeleteAtlas(pstAtlas);
+      }
+    }
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Moves a packed texture back to its own bitmap
+ * @param[in]   _pstTexture     Concerned texture
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+static orxSTATUS orxFASTCALL orxTexture_UnpackAtlas(orxTEXTURE *_pstTexture)
+{
+  orxBITMAP  *pstBitmap;
+  orxU32      u32Width, u32Height;
+  orxSTATUS   eResult = orxSTATUS_FAILURE;
 
+  /* Checks */
+  orxASSERT(orxStructure_TestFlags(_pstTexture, orxTEXTURE_KU32_FLAG_ATLAS) != orxFALSE);
 
-/***************************************************************************
- * Structure declaration                                                   *
- ***************************************************************************/
+  /* Gets its size */
+  u32Width  = orxF2U(_pstTexture->fWidth);
+  u32Height = orxF2U(_pstTexture->fHeight);
 
-/** Texture structure
+  /* Creates its own bitmap */
+  pstBitmap = orxDisplay_CreateBitmap(u32Width, u32Height);
+
+  /* Success? */
+  if(pstBitmap != orxNULL)
+  {
+    orxU8 *au8Data, *au8Buffer;
+
+    /* Reads page and allocates pixel buffer */
+    au8Data   = orxTexture_ReadAtlas(_pstTexture->pstAtlas);
+    au8Buffer = (orxU8 *)orxMemory_Allocate(u32Width * u32Height * 4 * sizeof(orxU8), orxMEMORY_TYPE_TEMP);
+
+    /* Success? */
+    if((au8Data != orxNULL) && (au8Buffer != orxNULL))
+    {
+      orxU32 j;
+
+      /* Extracts its rows */
+      for(j = 0; j < u32Height; j++)
+      {
+        orxMemory_Copy(au8Buffer + j * u32Width * 4, au8Data + ((_pstTexture->u32AtlasY + j) * sstTexture.u32AtlasSize + _pstTexture->u32AtlasX) * 4, u32Width * 4);
+      }
+
+      /* Uploads them */
+      eResult = orxDisplay_SetBitmapData(pstBitmap, au8Buffer, u32Width * u32Height * 4 * sizeof(orxU8));
+    }
+
+    /* Frees pixel buffers */
+    if(au8Data != orxNULL)
+    {
+      orxMemory_Free(au8Data);
+    }
+    if(au8Buffer != orxNULL)
+    {
+      orxMemory_Free(au8Buffer);
+    }
+
+    /* Success? */
+    if(eResult != orxSTATUS_FAILURE)
+    {
+      /* Releases its slot */
+      orxTexture_ReleaseAtlas(_pstTexture);
+
+      /* Updates texture */
+      _pstTexture->hData = (orxHANDLE)pstBitmap;
+      orxStructure_SetFlags(_pstTexture, orxTEXTURE_KU32_FLAG_INTERNAL, orxTEXTURE_KU32_FLAG_NONE);
+    }
+    else
+    {
+      /* Deletes bitmap */
+      orxDisplay_DeleteBitmap(pstBitmap);
+    }
+  }
+
+  /* Failure? */
+  if(eResult == orxSTATUS_FAILURE)
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "Couldn't unpack texture <%s> from its atlas.", orxTexture_GetName(_pstTexture));
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Stores the decoded pixels of a texture that is eligible for packing, till next atlas update
+ * @param[in]   _pstTexture     Concerned texture
+ * @param[in]   _pstBitmap      Decoded bitmap
+ * @param[in]   _pstPayload     Bitmap load payload
  */
-struct __orxTEXTURE_t
+static void orxFASTCALL orxTexture_StoreAtlasData(orxTEXTURE *_pstTexture, const orxBITMAP *_pstBitmap, const orxDISPLAY_EVENT_PAYLOAD *_pstPayload)
 {
-  orxSTRUCTURE    stStructure;                  /**< Public structure, first structure member : 32 */
-  orxSTRINGID     stID;                         /**< Associated name ID : 36 */
-  orxFLOAT        fWidth;                       /**< Width : 40 */
-  orxFLOAT        fHeight;                      /**< Height : 44 */
-  orxHANDLE       hData;                        /**< Data : 48 */
-};
+  /* Releases previous pixels */
+  if(_pstTexture->au8AtlasData != orxNULL)
+  {
+    orxMemory_Free(_pstTexture->au8AtlasData);
+    _pstTexture->au8AtlasData = orxNULL;
+  }
 
-/** Static structure
+  /* Atlas enabled, has pixels and wasn't excluded? */
+  if(orxFLAG_TEST(sstTexture.u32Flags, orxTEXTURE_KU32_STATIC_FLAG_ATLAS)
+  && (_pstPayload->stBitmap.au8Data != orxNULL)
+  && (orxStructure_TestFlags(_pstTexture, orxTEXTURE_KU32_FLAG_NO_ATLAS) == orxFALSE))
+  {
+    orxFLOAT  fWidth, fHeight;
+    orxU32    u32Width, u32Height;
+
+    /* Gets bitmap size */
+    orxDisplay_GetBitmapSize(_pstBitmap, &fWidth, &fHeight);
+    u32Width  = orxF2U(fWidth);
+    u32Height = orxF2U(fHeight);
+
+    /* Eligible? */
+    if((u32Width > 0)
+    && (u32Height > 0)
+    && (_pstPayload->stBitmap.u32LineSize >= u32Width * 4 * sizeof(orxU8))
+    && (orxTexture_GetAtlasGroup(_pstPayload->stBitmap.stFilenameID, u32Width, u32Height) != orxSTRINGID_UNDEFINED))
+    {
+      /* Allocates pixel buffer */
+      _pstTexture->au8AtlasData = (orxU8 *)orxMemory_Allocate(u32Width * u32Height * 4 * sizeof(orxU8), orxMEMORY_TYPE_TEMP);
+
+      /* Success? */
+      if(_pstTexture->au8AtlasData != orxNULL)
+      {
+        orxU32 j;
+
+        /* For all rows */
+        for(j = 0; j < u32Height; j++)
+        {
+          /* Copies it */
+          orxMemory_Copy(_pstTexture->au8AtlasData + j * u32Width * 4, _pstPayload->stBitmap.au8Data + j * _pstPayload->stBitmap.u32LineSize, u32Width * 4);
+        }
+      }
+    }
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Updates atlases: packs pending textures
  */
-typedef struct __orxTEXTURE_STATIC_t
+static void orxFASTCALL orxTexture_UpdateAtlas(const orxCLOCK_INFO *_pstClockInfo, void *_pContext)
 {
-  orxHASHTABLE   *pstTable;                     /**< Bitmap hashtable */
-  orxTEXTURE     *pstScreen;                    /**< Screen texture */
-  orxTEXTURE     *pstPixel;                     /**< Pixel texture */
-  orxSTRINGID     stResourceGroupID;            /**< Resource group ID */
-  orxU32          u32LoadCount;                 /**< Load count */
-  orxU32          u32Flags;                     /**< Control flags */
+  /* Profiles */
+  orxPROFILER_PUSH_MARKER("orxTexture_UpdateAtlas");
 
-} orxTEXTURE_STATIC;
+  /* Has pending textures? */
+  if(sstTexture.u32AtlasPendingCount != 0)
+  {
+    orxTEXTURE_ATLAS_ENTRY *astEntryList;
 
+    /* Allocates entry list */
+    astEntryList = (orxTEXTURE_ATLAS_ENTRY *)orxMemory_Allocate(sstTexture.u32AtlasPendingCount * sizeof(orxTEXTURE_ATLAS_ENTRY), orxMEMORY_TYPE_TEMP);
 
-/***************************************************************************
- * Module global variable                                                  *
- ***************************************************************************/
+    /* Success? */
+    if(astEntryList != orxNULL)
+    {
+      orxTEXTURE *pstTexture;
+      orxU32      u32Count, i;
 
-static orxTEXTURE_STATIC sstTexture;
+      /* Gathers all loaded pending textures, tallest first for a tighter packing */
+      for(pstTexture = orxTEXTURE(orxStructure_GetFirst(orxSTRUCTURE_ID_TEXTURE)), u32Count = 0;
+          pstTexture != orxNULL;
+          pstTexture = orxTEXTURE(orxStructure_GetNext(pstTexture)))
+      {
+        /* Pending and loaded? */
+        if((orxStructure_TestFlags(pstTexture, orxTEXTURE_KU32_FLAG_ATLAS_PENDING) != orxFALSE)
+        && (orxStructure_TestFlags(pstTexture, orxTEXTURE_KU32_FLAG_LOADING) == orxFALSE))
+        {
+          /* Inserts it */
+          orxTexture_InsertAtlasEntry(astEntryList, u32Count++, pstTexture);
+        }
+      }
+
+      /* For all gathered textures */
+      for(i = 0; i < u32Count; i++)
+      {
+        /* Packs it */
+        orxTexture_PackAtlas(astEntryList[i].pstTexture);
 
+        /* Clears its request and releases its pixels */
+        orxTexture_CancelAtlas(astEntryList[i].pstTexture);
+      }
 
-/***************************************************************************
- * Private functions                                                       *
- ***************************************************************************/
+      /* Frees entry list */
+      orxMemory_Free(astEntryList);
+    }
+  }
+
+  /* Rolls bind stats over */
+  sstTexture.u32AtlasLastSavedBindCount = sstTexture.u32AtlasSavedBindCount;
+  sstTexture.u32AtlasSavedBindCount     = 0;
+  sstTexture.pstLastAtlas               = orxNULL;
+  sstTexture.pstLastAtlasTexture        = orxNULL;
+
+  /* Profiles */
+  orxPROFILER_POP_MARKER();
+
+  /* Done! */
+  return;
+}
 
 /** Event handler
  */
@@ -150,6 +1139,13 @@ static orxSTATUS orxFASTCALL orxTexture_EventHandler(const orxEVENT *_pstEvent)
           /* Profiles */
           orxPROFILER_PUSH_MARKER("orxTexture_CreateFromFile");
 
+          /* Packed? */
+          if(orxStructure_TestFlags(pstTexture, orxTEXTURE_KU32_FLAG_ATLAS) != orxFALSE)
+          {
+            /* Moves it back to its own bitmap, to be used as backup */
+            orxTexture_UnpackAtlas(pstTexture);
+          }
+
           /* Stores status */
           bInternal = orxStructure_TestFlags(pstTexture, orxTEXTURE_KU32_FLAG_INTERNAL);
 
@@ -165,6 +1161,10 @@ static orxSTATUS orxFASTCALL orxTexture_EventHandler(const orxEVENT *_pstEvent)
           /* Unlinks it */
           orxTexture_UnlinkBitmap(pstTexture);
 
+          /* Stores texture being loaded */
+          sstTexture.pstLoadingTexture  = pstTexture;
+          sstTexture.stLoadingID        = pstPayload->stNameID;
+
           /* Re-loads bitmap */
           pstBitmap = orxDisplay_LoadBitmap(zName);
 
@@ -178,6 +1178,9 @@ static orxSTATUS orxFASTCALL orxTexture_EventHandler(const orxEVENT *_pstEvent)
             pstBitmap = orxDisplay_LoadBitmap(zName);
           }
 
+          /* Clears texture being loaded */
+          sstTexture.pstLoadingTexture  = orxNULL;
+
           /* Success? */
           if(pstBitmap != orxNULL)
           {
@@ -200,6 +1203,9 @@ static orxSTATUS orxFASTCALL orxTexture_EventHandler(const orxEVENT *_pstEvent)
           /* Assigns given bitmap to it */
           if(orxTexture_LinkBitmap(pstTexture, pstBitmap, zName, bInternal) != orxSTATUS_FAILURE)
           {
+            /* Requests packing */
+            orxTexture_RequestAtlas(pstTexture);
+
             /* Asynchronous loading? */
             if(orxDisplay_GetTempBitmap() != orxNULL)
             {
@@ -249,9 +1255,25 @@ static orxSTATUS orxFASTCALL orxTexture_EventHandler(const orxEVENT *_pstEvent)
         /* Success? */
         if(pstPayload->stBitmap.u32ID != orxU32_UNDEFINED)
         {
+          /* Stores its pixels for packing */
+          orxTexture_StoreAtlasData(pstTexture, (const orxBITMAP *)_pstEvent->hSender, pstPayload);
+
           /* Sends event */
           orxEVENT_SEND(orxEVENT_TYPE_TEXTURE, orxTEXTURE_EVENT_LOAD, pstTexture, orxNULL, orxNULL);
         }
+        else
+        {
+          /* Cancels packing */
+          orxTexture_CancelAtlas(pstTexture);
+        }
+      }
+      /* Synchronous load of a texture not linked yet? */
+      else if((sstTexture.pstLoadingTexture != orxNULL)
+           && (pstPayload->stBitmap.stFilenameID == sstTexture.stLoadingID)
+           && (pstPayload->stBitmap.u32ID != orxU32_UNDEFINED))
+      {
+        /* Stores its pixels for packing */
+        orxTexture_StoreAtlasData(sstTexture.pstLoadingTexture, (const orxBITMAP *)_pstEvent->hSender, pstPayload);
       }
     }
   }
@@ -495,8 +1517,24 @@ void orxFASTCALL orxTexture_CommandSave(orxU32 _u32ArgNumber, const orxCOMMAND_V
       }
     }
 
-    /* Saves it */
-    _pstResult->bValue = (orxDisplay_SaveBitmap(orxTexture_GetBitmap(pstTexture), zName) != orxSTATUS_FAILURE) ? orxTRUE : orxFALSE;
+    /* Packed? */
+    if(orxStructure_TestFlags(pstTexture, orxTEXTURE_KU32_FLAG_ATLAS) != orxFALSE)
+    {
+      /* Saves a copy of its own region */
+      _pstResult->bValue = orxFALSE;
+      if(orxTexture_UnpackAtlas(pstTexture) != orxSTATUS_FAILURE)
+      {
+        _pstResult->bValue = (orxDisplay_SaveBitmap(orxTexture_GetBitmap(pstTexture), zName) != orxSTATUS_FAILURE) ? orxTRUE : orxFALSE;
+
+        /* Packs it again */
+        orxTexture_RequestAtlas(pstTexture);
+      }
+    }
+    else
+    {
+      /* Saves it */
+      _pstResult->bValue = (orxDisplay_SaveBitmap(orxTexture_GetBitmap(pstTexture), zName) != orxSTATUS_FAILURE) ? orxTRUE : orxFALSE;
+    }
   }
   else
   {
@@ -594,6 +1632,122 @@ static orxINLINE orxTEXTURE *orxTexture_CreateInternal()
   return pstResult;
 }
 
+/** Inits atlases, if enabled in config
+ */
+static orxINLINE void orxTexture_InitAtlas()
+{
+  orxU32 u32Size;
+
+  /* Pushes config section */
+  orxConfig_PushSection(orxTEXTURE_KZ_CONFIG_SECTION);
+
+  /* Gets atlas size */
+  u32Size = orxConfig_GetU32(orxTEXTURE_KZ_CONFIG_ATLAS_SIZE);
+
+  /* Enabled? */
+  if(u32Size != 0)
+  {
+    /* Creates page bank & group table */
+    sstTexture.pstAtlasBank       = orxBank_Create(orxTEXTURE_KU32_ATLAS_BANK_SIZE, sizeof(orxTEXTURE_ATLAS), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+    sstTexture.pstAtlasGroupTable = orxHashTable_Create(orxTEXTURE_KU32_ATLAS_GROUP_TABLE_SIZE, orxHASHTABLE_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+
+    /* Success? */
+    if((sstTexture.pstAtlasBank != orxNULL)
+    && (sstTexture.pstAtlasGroupTable != orxNULL)
+    && (orxClock_Register(orxClock_FindFirst(orx2F(-1.0f), orxCLOCK_TYPE_CORE), orxTexture_UpdateAtlas, orxNULL, orxMODULE_ID_TEXTURE, orxCLOCK_PRIORITY_LOWER) != orxSTATUS_FAILURE))
+    {
+      orxS32 i, s32GroupCount;
+
+      /* Inits values */
+      sstTexture.u32AtlasSize           = orxCLAMP(u32Size, orxTEXTURE_KU32_ATLAS_MIN_SIZE, orxTEXTURE_KU32_ATLAS_MAX_SIZE);
+      sstTexture.u32AtlasThreshold      = orxConfig_GetU32(orxTEXTURE_KZ_CONFIG_ATLAS_THRESHOLD);
+      sstTexture.stDefaultAtlasGroupID  = orxString_GetID(orxTEXTURE_KZ_CONFIG_SECTION);
+
+      /* For all explicit groups */
+      for(i = 0, s32GroupCount = orxConfig_GetListCount(orxTEXTURE_KZ_CONFIG_ATLAS_GROUP_LIST); i < s32GroupCount; i++)
+      {
+        const orxSTRING zGroup;
+        orxSTRINGID     stGroupID;
+        orxS32          j, s32TextureCount;
+
+        /* Gets group */
+        zGroup    = orxConfig_GetListString(orxTEXTURE_KZ_CONFIG_ATLAS_GROUP_LIST, i);
+        stGroupID = orxString_GetID(zGroup);
+
+        /* Pushes its section */
+        orxConfig_PushSection(zGroup);
+
+        /* For all its textures */
+        for(j = 0, s32TextureCount = orxConfig_GetListCount(orxTEXTURE_KZ_CONFIG_TEXTURE_LIST); j < s32TextureCount; j++)
+        {
+          /* Adds it (first group wins) */
+          orxHashTable_Add(sstTexture.pstAtlasGroupTable, orxString_GetID(orxConfig_GetListString(orxTEXTURE_KZ_CONFIG_TEXTURE_LIST, j)), (void *)(size_t)stGroupID);
+        }
+
+        /* Pops config section */
+        orxConfig_PopSection();
+      }
+
+      /* Updates status */
+      orxFLAG_SET(sstTexture.u32Flags, orxTEXTURE_KU32_STATIC_FLAG_ATLAS, orxTEXTURE_KU32_STATIC_FLAG_NONE);
+    }
+    else
+    {
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_DISPLAY, "Couldn't initialize texture atlases, textures won't be packed.");
+
+      /* Deletes page bank & group table */
+      if(sstTexture.pstAtlasBank != orxNULL)
+      {
+        orxBank_Delete(sstTexture.pstAtlasBank);
+        sstTexture.pstAtlasBank = orxNULL;
+      }
+      if(sstTexture.pstAtlasGroupTable != orxNULL)
+      {
+        orxHashTable_Delete(sstTexture.pstAtlasGroupTable);
+        sstTexture.pstAtlasGroupTable = orxNULL;
+      }
+    }
+  }
+
+  /* Pops config section */
+  orxConfig_PopSection();
+
+  /* Done! */
+  return;
+}
+
+/** Exits from atlases
+ */
+static orxINLINE void orxTexture_ExitAtlas()
+{
+  /* Enabled? */
+  if(orxFLAG_TEST(sstTexture.u32Flags, orxTEXTURE_KU32_STATIC_FLAG_ATLAS))
+  {
+    orxTEXTURE_ATLAS *pstAtlas;
+
+    /* Unregisters update */
+    orxClock_Unregister(orxClock_FindFirst(orx2F(-1.0f), orxCLOCK_TYPE_CORE), orxTexture_UpdateAtlas);
+
+    /* Deletes remaining pages */
+    while((pstAtlas = (orxTEXTURE_ATLAS *)orxLinkList_GetFirst(&(sstTexture.stAtlasList))) != orxNULL)
+    {
+      orxTexture_DeleteAtlas(pstAtlas);
+    }
+
+    /* Deletes page bank & group table */
+    orxBank_Delete(sstTexture.pstAtlasBank);
+    sstTexture.pstAtlasBank = orxNULL;
+    orxHashTable_Delete(sstTexture.pstAtlasGroupTable);
+    sstTexture.pstAtlasGroupTable = orxNULL;
+
+    /* Updates status */
+    orxFLAG_SET(sstTexture.u32Flags, orxTEXTURE_KU32_STATIC_FLAG_NONE, orxTEXTURE_KU32_STATIC_FLAG_ATLAS);
+  }
+
+  /* Done! */
+  return;
+}
 
 
 /***************************************************************************
@@ -606,11 +1760,14 @@ void orxFASTCALL orxTexture_Setup()
 {
   /* Adds module dependencies */
   orxModule_AddDependency(orxMODULE_ID_TEXTURE, orxMODULE_ID_MEMORY);
+  orxModule_AddDependency(orxMODULE_ID_TEXTURE, orxMODULE_ID_BANK);
   orxModule_AddDependency(orxMODULE_ID_TEXTURE, orxMODULE_ID_STRING);
   orxModule_AddDependency(orxMODULE_ID_TEXTURE, orxMODULE_ID_STRUCTURE);
   orxModule_AddDependency(orxMODULE_ID_TEXTURE, orxMODULE_ID_PROFILER);
   orxModule_AddDependency(orxMODULE_ID_TEXTURE, orxMODULE_ID_COMMAND);
   orxModule_AddDependency(orxMODULE_ID_TEXTURE, orxMODULE_ID_EVENT);
+  orxModule_AddDependency(orxMODULE_ID_TEXTURE, orxMODULE_ID_CONFIG);
+  orxModule_AddDependency(orxMODULE_ID_TEXTURE, orxMODULE_ID_CLOCK);
   orxModule_AddDependency(orxMODULE_ID_TEXTURE, orxMODULE_ID_DISPLAY);
 
   return;
@@ -691,6 +1848,9 @@ orxSTATUS orxFASTCALL orxTexture_Init()
                   orxEvent_AddHandler(orxEVENT_TYPE_DISPLAY, orxTexture_EventHandler);
                   orxEvent_SetHandlerIDFlags(orxTexture_EventHandler, orxEVENT_TYPE_RESOURCE, orxNULL, orxEVENT_GET_FLAG(orxRESOURCE_EVENT_ADD) | orxEVENT_GET_FLAG(orxRESOURCE_EVENT_UPDATE), orxEVENT_KU32_MASK_ID_ALL);
                   orxEvent_SetHandlerIDFlags(orxTexture_EventHandler, orxEVENT_TYPE_DISPLAY, orxNULL, orxEVENT_GET_FLAG(orxDISPLAY_EVENT_LOAD_BITMAP), orxEVENT_KU32_MASK_ID_ALL);
+
+                  /* Inits atlases */
+                  orxTexture_InitAtlas();
                 }
                 else
                 {
@@ -793,6 +1953,9 @@ void orxFASTCALL orxTexture_Exit()
     /* Deletes texture list */
     orxTexture_DeleteAll();
 
+    /* Exits from atlases */
+    orxTexture_ExitAtlas();
+
     /* Deletes hash table */
     orxHashTable_Delete(sstTexture.pstTable);
     sstTexture.pstTable = orxNULL;
@@ -871,13 +2034,23 @@ orxTEXTURE *orxFASTCALL orxTexture_CreateFromFile(const orxSTRING _zFileName, or
     {
       orxBITMAP *pstBitmap;
 
+      /* Stores texture being loaded */
+      sstTexture.pstLoadingTexture  = pstResult;
+      sstTexture.stLoadingID        = orxString_GetID(_zFileName);
+
       /* Loads bitmap */
       pstBitmap = orxDisplay_LoadBitmap(_zFileName);
 
+      /* Clears texture being loaded */
+      sstTexture.pstLoadingTexture  = orxNULL;
+
       /* Assigns given bitmap to it */
       if((pstBitmap != orxNULL)
       && (orxTexture_LinkBitmap(pstResult, pstBitmap, _zFileName, orxTRUE) != orxSTATUS_FAILURE))
       {
+        /* Requests packing */
+        orxTexture_RequestAtlas(pstResult);
+
         /* Should keep it in cache? */
         if(_bKeepInCache != orxFALSE)
         {
@@ -963,6 +2136,9 @@ orxSTATUS orxFASTCALL orxTexture_Delete(orxTEXTURE *_pstTexture)
     /* Cleans bitmap reference */
     orxTexture_UnlinkBitmap(_pstTexture);
 
+    /* Releases pixels stored for packing */
+    orxTexture_CancelAtlas(_pstTexture);
+
     /* Deletes structure */
     orxStructure_Delete(_pstTexture);
   }
@@ -1105,13 +2281,22 @@ orxSTATUS orxFASTCALL orxTexture_UnlinkBitmap(orxTEXTURE *_pstTexture)
   /* Has bitmap */
   if(orxStructure_TestFlags(_pstTexture, orxTEXTURE_KU32_FLAG_BITMAP) != orxFALSE)
   {
+    /* Packed? */
+    if(orxStructure_TestFlags(_pstTexture, orxTEXTURE_KU32_FLAG_ATLAS))
+    {
+      /* Releases its slot */
+      orxTexture_ReleaseAtlas(_pstTexture);
+    }
     /* Internally handled? */
-    if(orxStructure_TestFlags(_pstTexture, orxTEXTURE_KU32_FLAG_INTERNAL))
+    else if(orxStructure_TestFlags(_pstTexture, orxTEXTURE_KU32_FLAG_INTERNAL))
     {
       /* Deletes bitmap */
       orxDisplay_DeleteBitmap((orxBITMAP *)(_pstTexture->hData));
     }
 
+    /* Cancels packing */
+    orxTexture_CancelAtlas(_pstTexture);
+
     /* Updates flags */
     orxStructure_SetFlags(_pstTexture, orxTEXTURE_KU32_FLAG_NONE, orxTEXTURE_KU32_FLAG_BITMAP | orxTEXTURE_KU32_FLAG_SIZE | orxTEXTURE_KU32_FLAG_INTERNAL);
 
@@ -1248,3 +2433,121 @@ orxU32 orxFASTCALL orxTexture_GetLoadCount()
   /* Done! */
   return sstTexture.u32LoadCount;
 }
+
+/** Gets texture origin inside its atlas bitmap, ie. the offset to apply to texture coordinates when drawing with orxTexture_GetBitmap()
+ * @param[in]   _pstTexture     Concerned texture
+ * @param[out]  _pvOrigin       Texture's origin inside its atlas, orxVECTOR_0 if not packed
+ * @return      orxVECTOR
+ */
+orxVECTOR *orxFASTCALL orxTexture_GetAtlasOrigin(const orxTEXTURE *_pstTexture, orxVECTOR *_pvOrigin)
+{
+  /* Checks */
+  orxASSERT(sstTexture.u32Flags & orxTEXTURE_KU32_STATIC_FLAG_READY);
+  orxSTRUCTURE_ASSERT(_pstTexture);
+  orxASSERT(_pvOrigin != orxNULL);
+
+  /* Packed? */
+  if(orxStructure_TestFlags(_pstTexture, orxTEXTURE_KU32_FLAG_ATLAS) != orxFALSE)
+  {
+    /* Different texture sharing the previous one's page? */
+    if((_pstTexture != sstTexture.pstLastAtlasTexture) && (_pstTexture->pstAtlas == sstTexture.pstLastAtlas))
+    {
+      /* Updates stats */
+      sstTexture.u32AtlasSavedBindCount++;
+    }
+
+    /* Stores it */
+    sstTexture.pstLastAtlasTexture  = _pstTexture;
+    sstTexture.pstLastAtlas         = _pstTexture->pstAtlas;
+
+    /* Updates result */
+    orxVector_Set(_pvOrigin, orxU2F(_pstTexture->u32AtlasX), orxU2F(_pstTexture->u32AtlasY), orxFLOAT_0);
+  }
+  else
+  {
+    /* Clears last page */
+    sstTexture.pstLastAtlasTexture  = _pstTexture;
+    sstTexture.pstLastAtlas         = orxNULL;
+
+    /* Updates result */
+    orxVector_Copy(_pvOrigin, &orxVECTOR_0);
+  }
+
+  /* Done! */
+  return _pvOrigin;
+}
+
+/** Unpacks a texture from its atlas (if any) and prevents it from being packed again, needed for textures used as render targets, fonts or shader parameters
+ * @param[in]   _pstTexture     Concerned texture
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+orxSTATUS orxFASTCALL orxTexture_Unpack(orxTEXTURE *_pstTexture)
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT(sstTexture.u32Flags & orxTEXTURE_KU32_STATIC_FLAG_READY);
+  orxSTRUCTURE_ASSERT(_pstTexture);
+
+  /* Excludes it from packing */
+  orxStructure_SetFlags(_pstTexture, orxTEXTURE_KU32_FLAG_NO_ATLAS, orxTEXTURE_KU32_FLAG_NONE);
+
+  /* Cancels pending packing */
+  orxTexture_CancelAtlas(_pstTexture);
+
+  /* Packed? */
+  if(orxStructure_TestFlags(_pstTexture, orxTEXTURE_KU32_FLAG_ATLAS) != orxFALSE)
+  {
+    /* Unpacks it */
+    eResult = orxTexture_UnpackAtlas(_pstTexture);
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Gets atlas stats
+ * @param[out]  _pstStats       Atlas stats
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+orxSTATUS orxFASTCALL orxTexture_GetAtlasStats(orxTEXTURE_ATLAS_STATS *_pstStats)
+{
+  const orxTEXTURE_ATLAS *pstAtlas;
+  orxSTATUS               eResult;
+
+  /* Checks */
+  orxASSERT(sstTexture.u32Flags & orxTEXTURE_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstStats != orxNULL);
+
+  /* Clears stats */
+  orxMemory_Zero(_pstStats, sizeof(orxTEXTURE_ATLAS_STATS));
+
+  /* Enabled? */
+  if(orxFLAG_TEST(sstTexture.u32Flags, orxTEXTURE_KU32_STATIC_FLAG_ATLAS))
+  {
+    /* For all pages */
+    for(pstAtlas = (const orxTEXTURE_ATLAS *)orxLinkList_GetFirst(&(sstTexture.stAtlasList));
+        pstAtlas != orxNULL;
+        pstAtlas = (const orxTEXTURE_ATLAS *)orxLinkList_GetNext(&(pstAtlas->stNode)))
+    {
+      /* Updates stats */
+      _pstStats->u32PageCount++;
+      _pstStats->u32TextureCount     += pstAtlas->u32TextureCount;
+      _pstStats->u64UsedTexelCount   += (orxU64)pstAtlas->u32UsedArea;
+      _pstStats->u64TotalTexelCount  += (orxU64)sstTexture.u32AtlasSize * (orxU64)sstTexture.u32AtlasSize;
+    }
+    _pstStats->u32RepackCount     = sstTexture.u32AtlasRepackCount;
+    _pstStats->u32SavedBindCount  = sstTexture.u32AtlasLastSavedBindCount;
+
+    /* Updates result */
+    eResult = orxSTATUS_SUCCESS;
+  }
+  else
+  {
+    /* Updates result */
+    eResult = orxSTATUS_FAILURE;
+  }
+
+  /* Done! */
+  return eResult;
+}
@@ -64,6 +64,7 @@
 
   #include <dirent.h>
   #include <fnmatch.h>
+  #include <sys/mman.h>
   #include <unistd.h>
   #include <stdlib.h>
   #include <stdio.h>
@@ -1228,6 +1229,108 @@ orxS64 orxFASTCALL orxFile_GetTime(const orxFILE *_pstFile)
   return s64Result;
 }
 
+/** Maps a whole file in memory, read-only, the mapping remains valid after the file has been closed
+ * @param[in] _pstFile              Concerned file
+ * @param[out] _ps64Size            Size of the mapped data
+ * @return Mapped data if successful, orxNULL if the file is empty or the platform/file doesn't support mapping
+ */
+const void *orxFASTCALL orxFile_Map(orxFILE *_pstFile, orxS64 *_ps64Size)
+{
+  const void *pResult = orxNULL;
+
+  /* Checks */
+  orxASSERT((sstFile.u32Flags & orxFILE_KU32_STATIC_FLAG_READY) == orxFILE_KU32_STATIC_FLAG_READY);
+  orxASSERT(_ps64Size != orxNULL);
+
+  /* Clears size */
+  *_ps64Size = 0;
+
+  /* Valid? */
+  if(_pstFile != orxNULL)
+  {
+    orxS64 s64Size;
+
+    /* Gets its size */
+    s64Size = orxFile_GetSize(_pstFile);
+
+    /* Not empty and addressable? */
+    if((s64Size > 0) && ((orxU64)s64Size <= (orxU64)((size_t)-1)))
+    {
+#ifdef __orxWINDOWS__
+
+      HANDLE hMapping;
+
+      /* Creates mapping */
+      hMapping = CreateFileMapping((HANDLE)_get_osfhandle(_fileno((FILE *)_pstFile)), NULL, PAGE_READONLY, 0, 0, NULL);
+
+      /* Success? */
+      if(hMapping != NULL)
+      {
+        /* Maps view, it'll keep the mapping alive */
+        pResult = MapViewOfFile(hMapping, FILE_MAP_READ, 0, 0, (SIZE_T)s64Size);
+
+        /* Closes mapping */
+        CloseHandle(hMapping);
+      }
+
+#else /* __orxWINDOWS__ */
+
+      void *pData;
+
+      /* Maps file */
+      pData = mmap(NULL, (size_t)s64Size, PROT_READ, MAP_PRIVATE, fileno((FILE *)_pstFile), 0);
+
+      /* Success? */
+      if(pData != MAP_FAILED)
+      {
+        /* Updates result */
+        pResult = pData;
+      }
+
+#endif /* __orxWINDOWS__ */
+
+      /* Success? */
+      if(pResult != orxNULL)
+      {
+        /* Stores size */
+        *_ps64Size = s64Size;
+      }
+    }
+  }
+
+  /* Done! */
+  return pResult;
+}
+
+/** Unmaps data previously mapped with orxFile_Map
+ * @param[in] _pData                Mapped data
+ * @param[in] _s64Size              Size of the mapped data, as retrieved by orxFile_Map
+ */
+void orxFASTCALL orxFile_Unmap(const void *_pData, orxS64 _s64Size)
+{
+  /* Checks */
+  orxASSERT((sstFile.u32Flags & orxFILE_KU32_STATIC_FLAG_READY) == orxFILE_KU32_STATIC_FLAG_READY);
+
+  /* Valid? */
+  if(_pData != orxNULL)
+  {
+#ifdef __orxWINDOWS__
+
+    /* Unmaps view */
+    UnmapViewOfFile(_pData);
+
+#else /* __orxWINDOWS__ */
+
+    /* Unmaps data */
+    munmap((void *)_pData, (size_t)_s64Size);
+
+#endif /* __orxWINDOWS__ */
+  }
+
+  /* Done! */
+  return;
+}
+
 /** Prints a formatted string to a file
  * @param[in] _pstFile             Pointer to the file descriptor
  * @param[in] _zString             Formatted string
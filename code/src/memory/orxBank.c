@@ -40,6 +40,10 @@
 #define orxBANK_KU32_STATIC_FLAG_NONE         0x00000000  /**< No flags have been set */
 #define orxBANK_KU32_STATIC_FLAG_READY        0x00000001  /**< The module has been initialized */
 
+#define orxBANK_KU32_SEGMENT_LIST_SIZE        32          /**< Initial segment list size (multiple of 32) */
+#define orxBANK_KU32_SEGMENT_TABLE_SIZE       16          /**< Initial segment lookup table size (power of two) */
+#define orxBANK_KU32_SEGMENT_KEY_NUMBER       3           /**< Maximum number of lookup table keys per segment */
+
 
 /***************************************************************************
  * Structure declaration                                                   *
@@ -50,8 +54,9 @@
 typedef struct __orxBANK_SEGMENT_t
 {
   void                       *pSegmentData;     /**< Pointer address on the head of the segment data cells */
-  struct __orxBANK_SEGMENT_t *pstNext;          /**< Pointer to the next segment */
+  orxU32                      u32Index;         /**< Index of the segment in its bank */
   orxU32                      u32NbFree;        /**< Number of free elements in the segment */
+  orxU32                      u32FreeMapHint;   /**< Index of the first map part that may contain free elements */
   orxU32                      au32CellAllocationMap[0]; /**< List of bits that represents free and used elements in the segment */
 
 } orxBANK_SEGMENT;
@@ -59,16 +64,32 @@ typedef struct __orxBANK_SEGMENT_t
   #pragma warning(default : 4200)
 #endif /* __orxMSVC__ */
 
+/** Segment lookup table entry: a range of addresses (key) overlaps at most two segments
+ */
+typedef struct __orxBANK_SEGMENT_ENTRY_t
+{
+  size_t                      uKey;             /**< Address key (address >> shift) */
+  orxBANK_SEGMENT            *apstSegment[2];   /**< Segments overlapping this address range */
+
+} orxBANK_SEGMENT_ENTRY;
+
 struct __orxBANK_t
 {
-  orxLINKLIST_NODE  stNode;                 /**< Linklist node */
-  orxBANK_SEGMENT  *pstFirstSegment;        /**< First segment used in the bank */
-  orxU32            u32Count;               /**< Number of allocated cells */
-  orxU32            u32ElemSize;            /**< Size of a cell */
-  orxU16            u16NbCellPerSegments;   /**< Number of cells per banks */
-  orxU16            u16SizeSegmentBitField; /**< Number of u32 (4 bytes) to represent a segment */
-  orxU32            u32Flags;               /**< Flags set for the memory bank */
-  orxMEMORY_TYPE    eMemType;               /**< Memory type that will be used by the memory allocation */
+  orxLINKLIST_NODE        stNode;                 /**< Linklist node */
+  orxBANK_SEGMENT       **apstSegmentList;        /**< Segments, by index */
+  orxU32                 *au32FreeSegmentMap;     /**< List of bits that represents segments with free elements */
+  orxBANK_SEGMENT_ENTRY  *astSegmentTable;        /**< Segment lookup table, by cell address */
+  orxU32                  u32SegmentCount;        /**< Number of segments */
+  orxU32                  u32SegmentListSize;     /**< Segment list size (multiple of 32) */
+  orxU32                  u32SegmentTableSize;    /**< Segment lookup table size (power of two) */
+  orxU32                  u32SegmentShift;        /**< Address shift used for segment lookup */
+  orxU32                  u32SegmentDataSize;     /**< Size of a segment's cells */
+  orxU32                  u32Count;               /**< Number of allocated cells */
+  orxU32                  u32ElemSize;            /**< Size of a cell */
+  orxU16                  u16NbCellPerSegments;   /**< Number of cells per banks */
+  orxU16                  u16SizeSegmentBitField; /**< Number of u32 (4 bytes) to represent a segment */
+  orxU32                  u32Flags;               /**< Flags set for the memory bank */
+  orxMEMORY_TYPE          eMemType;               /**< Memory type that will be used by the memory allocation */
 };
 
 typedef struct __orxBANK_STATIC_t
@@ -117,7 +138,6 @@ static orxINLINE orxBANK_SEGMENT *orxBank_CreateSegment(const orxBANK *_pstBank)
 
     /* Set initial segment values */
     orxMemory_Zero(pstSegment, u32BaseSegmentSize + (_pstBank->u16NbCellPerSegments * _pstBank->u32ElemSize));
-    pstSegment->pstNext               = orxNULL;
     pstSegment->u32NbFree             = _pstBank->u16NbCellPerSegments;
     pAlignedSegmentData               = ((orxU8 *)pstSegment) + u32BaseSegmentSize;
     pstSegment->pSegmentData          = (void *)orxALIGN(pAlignedSegmentData, sstBank.u32CacheLineSize);
@@ -130,6 +150,199 @@ static orxINLINE orxBANK_SEGMENT *orxBank_CreateSegment(const orxBANK *_pstBank)
   return pstSegment;
 }
 
+/** Gets the lookup table slot of an address key
+ * @param[in] _pstBank    Concerned bank
+ * @param[in] _uKey       Address key
+ * @return  Slot index
+ */
+static orxINLINE orxU32 orxBank_GetSegmentSlot(const orxBANK *_pstBank, size_t _uKey)
+{
+  /* Done! */
+  return (orxU32)(((orxU64)_uKey * 0x9E3779B97F4A7C15ULL) >> 32) & (_pstBank->u32SegmentTableSize - 1);
+}
+
+/** Adds a segment to the lookup table
+ * @param[in] _pstBank    Concerned bank
+ * @param[in] _pstSegment Segment to add
+ */
+static orxINLINE void orxBank_AddSegmentEntries(orxBANK *_pstBank, orxBANK_SEGMENT *_pstSegment)
+{
+  size_t uKey, uLastKey;
+
+  /* For all address keys covered by the segment (at most three as a key range is at least half a segment) */
+  for(uKey = (size_t)_pstSegment->pSegmentData >> _pstBank->u32SegmentShift, uLastKey = ((size_t)_pstSegment->pSegmentData + _pstBank->u32SegmentDataSize - 1) >> _pstBank->u32SegmentShift;
+      uKey <= uLastKey;
+      uKey++)
+  {
+    orxU32 u32Slot;
+
+    /* Finds its slot */
+    for(u32Slot = orxBank_GetSegmentSlot(_pstBank, uKey);
+        (_pstBank->astSegmentTable[u32Slot].apstSegment[0] != orxNULL) && (_pstBank->astSegmentTable[u32Slot].uKey != uKey);
+        u32Slot = (u32Slot + 1) & (_pstBank->u32SegmentTableSize - 1));
+
+    /* New entry? */
+    if(_pstBank->astSegmentTable[u32Slot].apstSegment[0] == orxNULL)
+    {
+      /* Stores it */
+      _pstBank->astSegmentTable[u32Slot].uKey           = uKey;
+      _pstBank->astSegmentTable[u32Slot].apstSegment[0] = _pstSegment;
+    }
+    else
+    {
+      /* Checks */
+      orxASSERT(_pstBank->astSegmentTable[u32Slot].apstSegment[1] == orxNULL);
+
+      /* Stores it */
+      _pstBank->astSegmentTable[u32Slot].apstSegment[1] = _pstSegment;
+    }
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Rebuilds the segment lookup table
+ * @param[in] _pstBank    Concerned bank
+ * @param[in] _u32Size    Table size (power of two)
+ * @return  orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+static orxSTATUS orxFASTCALL orxBank_RebuildSegmentTable(orxBANK *_pstBank, orxU32 _u32Size)
+{
+  orxBANK_SEGMENT_ENTRY  *astSegmentTable;
+  orxSTATUS               eResult = orxSTATUS_FAILURE;
+
+  /* Checks */
+  orxASSERT(orxMath_IsPowerOfTwo(_u32Size) != orxFALSE);
+
+  /* Allocates new table */
+  astSegmentTable = (orxBANK_SEGMENT_ENTRY *)orxMemory_Allocate(_u32Size * sizeof(orxBANK_SEGMENT_ENTRY), _pstBank->eMemType);
+
+  /* Success? */
+  if(astSegmentTable != orxNULL)
+  {
+    orxU32 i;
+
+    /* Clears it */
+    orxMemory_Zero(astSegmentTable, _u32Size * sizeof(orxBANK_SEGMENT_ENTRY));
+
+    /* Replaces previous one */
+    if(_pstBank->astSegmentTable != orxNULL)
+    {
+      orxMemory_Free(_pstBank->astSegmentTable);
+    }
+    _pstBank->astSegmentTable     = astSegmentTable;
+    _pstBank->u32SegmentTableSize = _u32Size;
+
+    /* For all segments */
+    for(i = 0; i < _pstBank->u32SegmentCount; i++)
+    {
+      /* Adds it */
+      orxBank_AddSegmentEntries(_pstBank, _pstBank->apstSegmentList[i]);
+    }
+
+    /* Updates result */
+    eResult = orxSTATUS_SUCCESS;
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Adds a new segment to a bank
+ * @param[in] _pstBank    Concerned bank
+ * @return  The new segment (orxNULL if an error occurred)
+ */
+static orxBANK_SEGMENT *orxFASTCALL orxBank_AddSegment(orxBANK *_pstBank)
+{
+  orxBANK_SEGMENT *pstResult = orxNULL;
+
+  /* Segment list full? */
+  if(_pstBank->u32SegmentCount == _pstBank->u32SegmentListSize)
+  {
+    orxBANK_SEGMENT **apstSegmentList;
+    orxU32           *au32FreeSegmentMap;
+    orxU32            u32Size;
+
+    /* Gets new size */
+    u32Size = (_pstBank->u32SegmentListSize != 0) ? _pstBank->u32SegmentListSize << 1 : orxBANK_KU32_SEGMENT_LIST_SIZE;
+
+    /* Allocates new list & map */
+    apstSegmentList     = (orxBANK_SEGMENT **)orxMemory_Allocate(u32Size * sizeof(orxBANK_SEGMENT *), _pstBank->eMemType);
+    au32FreeSegmentMap  = (orxU32 *)orxMemory_Allocate((u32Size >> 5) * sizeof(orxU32), _pstBank->eMemType);
+
+    /* Success? */
+    if((apstSegmentList != orxNULL) && (au32FreeSegmentMap != orxNULL))
+    {
+      /* Clears map */
+      orxMemory_Zero(au32FreeSegmentMap, (u32Size >> 5) * sizeof(orxU32));
+
+      /* Had previous ones? */
+      if(_pstBank->apstSegmentList != orxNULL)
+      {
+        /* Copies them */
+        orxMemory_Copy(apstSegmentList, _pstBank->apstSegmentList, _pstBank->u32SegmentCount * sizeof(orxBANK_SEGMENT *));
+        orxMemory_Copy(au32FreeSegmentMap, _pstBank->au32FreeSegmentMap, (_pstBank->u32SegmentListSize >> 5) * sizeof(orxU32));
+
+        /* Frees them */
+        orxMemory_Free(_pstBank->apstSegmentList);
+        orxMemory_Free(_pstBank->au32FreeSegmentMap);
+      }
+
+      /* Stores new ones */
+      _pstBank->apstSegmentList     = apstSegmentList;
+      _pstBank->au32FreeSegmentMap  = au32FreeSegmentMap;
+      _pstBank->u32SegmentListSize  = u32Size;
+    }
+    else
+    {
+      /* Frees partial allocations */
+      if(apstSegmentList != orxNULL)
+      {
+        orxMemory_Free(apstSegmentList);
+      }
+      if(au32FreeSegmentMap != orxNULL)
+      {
+        orxMemory_Free(au32FreeSegmentMap);
+      }
+
+      /* Done! */
+      return orxNULL;
+    }
+  }
+
+  /* Lookup table too small (keeping it at most half full)? */
+  if((_pstBank->u32SegmentCount + 1) * orxBANK_KU32_SEGMENT_KEY_NUMBER * 2 > _pstBank->u32SegmentTableSize)
+  {
+    /* Grows it */
+    if(orxBank_RebuildSegmentTable(_pstBank, (_pstBank->u32SegmentTableSize != 0) ? _pstBank->u32SegmentTableSize << 1 : orxBANK_KU32_SEGMENT_TABLE_SIZE) == orxSTATUS_FAILURE)
+    {
+      /* Done! */
+      return orxNULL;
+    }
+  }
+
+  /* Creates segment */
+  pstResult = orxBank_CreateSegment(_pstBank);
+
+  /* Success? */
+  if(pstResult != orxNULL)
+  {
+    /* Stores it */
+    pstResult->u32Index = _pstBank->u32SegmentCount;
+    _pstBank->apstSegmentList[_pstBank->u32SegmentCount++] = pstResult;
+
+    /* Marks it as having free elements */
+    _pstBank->au32FreeSegmentMap[pstResult->u32Index >> 5] |= 1 << (pstResult->u32Index & 31);
+
+    /* Adds it to lookup table */
+    orxBank_AddSegmentEntries(_pstBank, pstResult);
+  }
+
+  /* Done! */
+  return pstResult;
+}
+
 /** Returns the segment where is stored _pCell
  * @param[in] _pstBank  Bank that stores segments
  * @param[in] _pCell    Cell stored by the segment to find
@@ -137,8 +350,7 @@ static orxINLINE orxBANK_SEGMENT *orxBank_CreateSegment(const orxBANK *_pstBank)
  */
 static orxINLINE orxBANK_SEGMENT *orxBank_GetSegment(const orxBANK *_pstBank, const void *_pCell)
 {
-  orxBANK_SEGMENT  *pstSegment, *pstResult = orxNULL;
-  orxU32            u32Size;
+  orxBANK_SEGMENT  *pstResult = orxNULL;
 
   /* Module initialized ? */
   orxASSERT((sstBank.u32Flags & orxBANK_KU32_STATIC_FLAG_READY) == orxBANK_KU32_STATIC_FLAG_READY);
@@ -147,19 +359,55 @@ static orxINLINE orxBANK_SEGMENT *orxBank_GetSegment(const orxBANK *_pstBank, co
   orxASSERT(_pstBank != orxNULL);
   orxASSERT(_pCell != orxNULL);
 
-  /* For all segments */
-  for(pstSegment = _pstBank->pstFirstSegment, u32Size = _pstBank->u32ElemSize * (orxU32)_pstBank->u16NbCellPerSegments;
-      pstSegment != orxNULL;
-      pstSegment = pstSegment->pstNext)
+  /* Single segment? */
+  if(_pstBank->u32SegmentCount == 1)
   {
     /* Is cell in segment? */
-    if((_pCell >= pstSegment->pSegmentData)
-    && (((orxU32)((orxU8 *)_pCell - (orxU8 *)pstSegment->pSegmentData)) < u32Size))
+    if((_pCell >= _pstBank->apstSegmentList[0]->pSegmentData)
+    && (((orxU32)((orxU8 *)_pCell - (orxU8 *)_pstBank->apstSegmentList[0]->pSegmentData)) < _pstBank->u32SegmentDataSize))
     {
       /* Updates result */
-      pstResult = pstSegment;
+      pstResult = _pstBank->apstSegmentList[0];
+    }
+  }
+  else
+  {
+    size_t uKey;
+    orxU32 u32Slot;
 
-      break;
+    /* Gets address key */
+    uKey = (size_t)_pCell >> _pstBank->u32SegmentShift;
+
+    /* Finds its slot */
+    for(u32Slot = orxBank_GetSegmentSlot(_pstBank, uKey);
+        _pstBank->astSegmentTable[u32Slot].apstSegment[0] != orxNULL;
+        u32Slot = (u32Slot + 1) & (_pstBank->u32SegmentTableSize - 1))
+    {
+      /* Found? */
+      if(_pstBank->astSegmentTable[u32Slot].uKey == uKey)
+      {
+        orxU32 i;
+
+        /* For both overlapping segments */
+        for(i = 0; (i < 2) && (_pstBank->astSegmentTable[u32Slot].apstSegment[i] != orxNULL); i++)
+        {
+          orxBANK_SEGMENT *pstSegment;
+
+          /* Gets it */
+          pstSegment = _pstBank->astSegmentTable[u32Slot].apstSegment[i];
+
+          /* Is cell in segment? */
+          if((_pCell >= pstSegment->pSegmentData)
+          && (((orxU32)((orxU8 *)_pCell - (orxU8 *)pstSegment->pSegmentData)) < _pstBank->u32SegmentDataSize))
+          {
+            /* Updates result */
+            pstResult = pstSegment;
+            break;
+          }
+        }
+
+        break;
+      }
     }
   }
 
@@ -270,11 +518,16 @@ orxBANK *orxFASTCALL orxBank_Create(orxU16 _u16NbElem, orxU32 _u32Size, orxU32 _
     /* Compute the necessary number of 32 bits packs */
     pstBank->u16SizeSegmentBitField   = orxALIGN32(_u16NbElem) >> 5;
 
-    /* Allocate the first segment, and select it as current */
-    pstBank->pstFirstSegment          = orxBank_CreateSegment(pstBank);
+    /* Computes segment data size and lookup shift (largest power of two not above it) */
+    pstBank->u32SegmentDataSize       = pstBank->u32ElemSize * (orxU32)_u16NbElem;
+    pstBank->u32SegmentShift          = orxMath_GetTrailingZeroCount(orxMath_GetNextPowerOfTwo(pstBank->u32SegmentDataSize));
+    if(orxMath_IsPowerOfTwo(pstBank->u32SegmentDataSize) == orxFALSE)
+    {
+      pstBank->u32SegmentShift--;
+    }
 
-    /* Success? */
-    if(pstBank->pstFirstSegment != orxNULL)
+    /* Allocate the first segment */
+    if(orxBank_AddSegment(pstBank) != orxNULL)
     {
       /* Add it to the list */
       orxLinkList_AddEnd(&(sstBank.stBankList), &(pstBank->stNode));
@@ -282,6 +535,15 @@ orxBANK *orxFASTCALL orxBank_Create(orxU16 _u16NbElem, orxU32 _u32Size, orxU32 _
     else
     {
       /* Can't allocate segment, cancel bank allocation */
+      if(pstBank->apstSegmentList != orxNULL)
+      {
+        orxMemory_Free(pstBank->apstSegmentList);
+        orxMemory_Free(pstBank->au32FreeSegmentMap);
+      }
+      if(pstBank->astSegmentTable != orxNULL)
+      {
+        orxMemory_Free(pstBank->astSegmentTable);
+      }
       orxMemory_Free(pstBank);
       pstBank = orxNULL;
     }
@@ -295,7 +557,7 @@ orxBANK *orxFASTCALL orxBank_Create(orxU16 _u16NbElem, orxU32 _u32Size, orxU32 _
  */
 void orxFASTCALL orxBank_Delete(orxBANK *_pstBank)
 {
-  orxBANK_SEGMENT *pstSegment, *pstSegmentToDelete;
+  orxU32 i;
 
   /* Module initialized ? */
   orxASSERT((sstBank.u32Flags & orxBANK_KU32_STATIC_FLAG_READY) == orxBANK_KU32_STATIC_FLAG_READY);
@@ -307,9 +569,15 @@ void orxFASTCALL orxBank_Delete(orxBANK *_pstBank)
   orxLinkList_Remove(&(_pstBank->stNode));
 
   /* Deletes all segments */
-  for(pstSegment = _pstBank->pstFirstSegment;
-      pstSegment != orxNULL;
-      pstSegmentToDelete = pstSegment, pstSegment = pstSegment->pstNext, orxMemory_Free(pstSegmentToDelete));
+  for(i = 0; i < _pstBank->u32SegmentCount; i++)
+  {
+    orxMemory_Free(_pstBank->apstSegmentList[i]);
+  }
+
+  /* Deletes segment list, map & lookup table */
+  orxMemory_Free(_pstBank->apstSegmentList);
+  orxMemory_Free(_pstBank->au32FreeSegmentMap);
+  orxMemory_Free(_pstBank->astSegmentTable);
 
   /* Completly Free Bank */
   orxMemory_Free(_pstBank);
@@ -335,8 +603,8 @@ void *orxFASTCALL orxBank_Allocate(orxBANK *_pstBank)
  */
 void *orxFASTCALL orxBank_AllocateIndexed(orxBANK *_pstBank, orxU32 *_pu32ItemIndex, void **_ppPrevious)
 {
-  orxU32            u32SegmentIndex;
-  orxBANK_SEGMENT  *pstCurrentSegment, *pstPreviousSegment;
+  orxU32            i, u32SegmentIndex = orxU32_UNDEFINED;
+  orxBANK_SEGMENT  *pstCurrentSegment = orxNULL;
   void             *pResult = orxNULL;
 
   /* Profiles */
@@ -350,84 +618,90 @@ void *orxFASTCALL orxBank_AllocateIndexed(orxBANK *_pstBank, orxU32 *_pu32ItemIn
   orxASSERT(_pu32ItemIndex != orxNULL);
 
   /* Finds the first segment with empty space */
-  for(u32SegmentIndex = 0, pstCurrentSegment = _pstBank->pstFirstSegment, pstPreviousSegment = orxNULL;
-      (pstCurrentSegment->pstNext != orxNULL) && (pstCurrentSegment->u32NbFree == 0);
-      u32SegmentIndex++, pstPreviousSegment = pstCurrentSegment, pstCurrentSegment = pstCurrentSegment->pstNext);
+  for(i = 0; i < (_pstBank->u32SegmentCount + 31) >> 5; i++)
+  {
+    /* Any segment with free elements? */
+    if(_pstBank->au32FreeSegmentMap[i] != 0)
+    {
+      /* Gets it */
+      u32SegmentIndex   = (i << 5) + orxMath_GetTrailingZeroCount(_pstBank->au32FreeSegmentMap[i]);
+      pstCurrentSegment = _pstBank->apstSegmentList[u32SegmentIndex];
+      break;
+    }
+  }
 
-  /* Is there a free space in the current segment ? (If no, try to expand it if allowed) */
-  if((pstCurrentSegment->u32NbFree == 0) && (!(_pstBank->u32Flags & orxBANK_KU32_FLAG_NOT_EXPANDABLE)))
+  /* No free space? (Try to expand the bank if allowed) */
+  if((pstCurrentSegment == orxNULL) && (!(_pstBank->u32Flags & orxBANK_KU32_FLAG_NOT_EXPANDABLE)))
   {
-    /* No, Try to allocate a new segment */
-    pstCurrentSegment->pstNext = orxBank_CreateSegment(_pstBank);
+    /* Try to allocate a new segment */
+    pstCurrentSegment = orxBank_AddSegment(_pstBank);
 
     /* Correct segment allocation ? */
-    if(pstCurrentSegment->pstNext != orxNULL)
+    if(pstCurrentSegment != orxNULL)
     {
-      /* Set the new allocated segment as the current selected one */
-      pstCurrentSegment = pstCurrentSegment->pstNext;
-      u32SegmentIndex++;
+      /* Updates segment index */
+      u32SegmentIndex = pstCurrentSegment->u32Index;
     }
   }
 
-  /* Does the current segment has free nodes ? (yes : the allocation was correct (if there was), else returns orxNULL) */
-  if(pstCurrentSegment->u32NbFree > 0)
+  /* Found a segment with free nodes ? */
+  if(pstCurrentSegment != orxNULL)
   {
-    orxU32  u32BitIndex, u32MapPartIndex;
-    orxBOOL bFound;
+    orxU32 u32BitIndex, u32MapPartIndex, u32MapPartValue;
 
-    /* For all map parts */
-    for(u32BitIndex = 0, u32MapPartIndex = 0, bFound = orxFALSE; u32MapPartIndex < (orxU32)_pstBank->u16SizeSegmentBitField; u32MapPartIndex++)
+    /* Checks */
+    orxASSERT(pstCurrentSegment->u32NbFree > 0);
+
+    /* Finds first map part with a free element, starting from hint */
+    for(u32MapPartIndex = pstCurrentSegment->u32FreeMapHint;
+        (u32MapPartValue = ~(pstCurrentSegment->au32CellAllocationMap[u32MapPartIndex])) == 0;
+        u32MapPartIndex++)
     {
-      orxU32 u32MapPartValue;
+      /* Checks */
+      orxASSERT(u32MapPartIndex < (orxU32)_pstBank->u16SizeSegmentBitField - 1);
+    }
 
-      /* Gets the available slots */
-      u32MapPartValue = ~(pstCurrentSegment->au32CellAllocationMap[u32MapPartIndex]);
+    /* Gets free cell's map part index */
+    u32BitIndex = orxMath_GetTrailingZeroCount(u32MapPartValue);
 
-      /* Any free one? */
-      if(u32MapPartValue != 0)
-      {
-        /* Gets free cell's map part index */
-        u32BitIndex = orxMath_GetTrailingZeroCount(u32MapPartValue);
+    /* Get the pointer to the cell according to index value and cells size */
+    pResult = (void *)(((orxU8 *)pstCurrentSegment->pSegmentData) + _pstBank->u32ElemSize * ((u32MapPartIndex << 5) + u32BitIndex));
 
-        /* Found ! */
-        bFound = orxTRUE;
+    /* Updates hint */
+    pstCurrentSegment->u32FreeMapHint = u32MapPartIndex;
 
-        break;
-      }
-    }
+    /* Decrease the number of free elements */
+    pstCurrentSegment->u32NbFree--;
 
-    /* Found a free element ? */
-    if(bFound)
+    /* Segment is now full? */
+    if(pstCurrentSegment->u32NbFree == 0)
     {
-      /* Get the pointer to the cell according to index value and cells size */
-      pResult = (void *)(((orxU8 *)pstCurrentSegment->pSegmentData) + _pstBank->u32ElemSize * ((u32MapPartIndex << 5) + u32BitIndex));
-
-      /* Decrease the number of free elements */
-      pstCurrentSegment->u32NbFree--;
+      /* Removes it from the free segment map */
+      _pstBank->au32FreeSegmentMap[u32SegmentIndex >> 5] &= ~(1 << (u32SegmentIndex & 31));
+    }
 
-      /* Updates bank count */
-      _pstBank->u32Count++;
+    /* Updates bank count */
+    _pstBank->u32Count++;
 
-      /* Sets the bit as used */
-      ((orxU32 *)(pstCurrentSegment->au32CellAllocationMap))[u32MapPartIndex] |= 1 << u32BitIndex;
+    /* Sets the bit as used */
+    pstCurrentSegment->au32CellAllocationMap[u32MapPartIndex] |= 1 << u32BitIndex;
 
-      /* Updates item ID */
-      *_pu32ItemIndex = (u32SegmentIndex * (orxU32)_pstBank->u16NbCellPerSegments) + (u32MapPartIndex << 5) + u32BitIndex;
+    /* Updates item ID */
+    *_pu32ItemIndex = (u32SegmentIndex * (orxU32)_pstBank->u16NbCellPerSegments) + (u32MapPartIndex << 5) + u32BitIndex;
 
-      /* Asked for previous element? */
-      if(_ppPrevious != orxNULL)
+    /* Asked for previous element? */
+    if(_ppPrevious != orxNULL)
+    {
+      /* Is current allocation first in segment? */
+      if((u32MapPartIndex == 0) && (u32BitIndex == 0))
       {
-        /* Is current allocation first in segment? */
-        if((u32MapPartIndex == 0) && (u32BitIndex == 0))
-        {
-          /* Updates previous */
-          *_ppPrevious = (pstPreviousSegment != orxNULL) ? (void *)(((orxU8 *)pstPreviousSegment->pSegmentData) + _pstBank->u32ElemSize * (_pstBank->u16NbCellPerSegments - 1)) : orxNULL;
-        }
-        else
-        {
-          /* Updates previous */
-          *_ppPrevious = (void *)(((orxU8 *)pResult) - _pstBank->u32ElemSize);
-        }
+        /* Updates previous */
+        *_ppPrevious = (u32SegmentIndex != 0) ? (void *)(((orxU8 *)_pstBank->apstSegmentList[u32SegmentIndex - 1]->pSegmentData) + _pstBank->u32ElemSize * (_pstBank->u16NbCellPerSegments - 1)) : orxNULL;
+      }
+      else
+      {
+        /* Updates previous */
+        *_ppPrevious = (void *)(((orxU8 *)pResult) - _pstBank->u32ElemSize);
       }
     }
   }
@@ -473,9 +747,25 @@ void orxFASTCALL orxBank_Free(orxBANK *_pstBank, void *_pCell)
   u32Index32Bits  = u32CellIndex >> 5;
   u32IndexBit     = u32CellIndex & 31;
 
+  /* Checks */
+  orxASSERT(pstSegment->au32CellAllocationMap[u32Index32Bits] & (1 << u32IndexBit));
+
   /* Set cell as Free */
   pstSegment->au32CellAllocationMap[u32Index32Bits] &= ~(1 << u32IndexBit);
 
+  /* Updates hint */
+  if(u32Index32Bits < pstSegment->u32FreeMapHint)
+  {
+    pstSegment->u32FreeMapHint = u32Index32Bits;
+  }
+
+  /* Was full? */
+  if(pstSegment->u32NbFree == 0)
+  {
+    /* Adds it to the free segment map */
+    _pstBank->au32FreeSegmentMap[pstSegment->u32Index >> 5] |= 1 << (pstSegment->u32Index & 31);
+  }
+
   /* Increase the number of free elements */
   pstSegment->u32NbFree++;
 
@@ -494,7 +784,7 @@ void orxFASTCALL orxBank_Free(orxBANK *_pstBank, void *_pCell)
  */
 void orxFASTCALL orxBank_Clear(orxBANK *_pstBank)
 {
-  orxBANK_SEGMENT *pstSegment;
+  orxU32 i;
 
   /* Module initialized ? */
   orxASSERT((sstBank.u32Flags & orxBANK_KU32_STATIC_FLAG_READY) == orxBANK_KU32_STATIC_FLAG_READY);
@@ -503,13 +793,20 @@ void orxFASTCALL orxBank_Clear(orxBANK *_pstBank)
   orxASSERT(_pstBank != orxNULL);
 
   /* For all segments */
-  for(pstSegment = _pstBank->pstFirstSegment;
-      pstSegment != orxNULL;
-      pstSegment = pstSegment->pstNext)
+  for(i = 0; i < _pstBank->u32SegmentCount; i++)
   {
+    orxBANK_SEGMENT *pstSegment;
+
+    /* Gets it */
+    pstSegment = _pstBank->apstSegmentList[i];
+
     /* Clears it */
-    pstSegment->u32NbFree = (orxU32)_pstBank->u16NbCellPerSegments;
+    pstSegment->u32NbFree       = (orxU32)_pstBank->u16NbCellPerSegments;
+    pstSegment->u32FreeMapHint  = 0;
     orxMemory_Zero(pstSegment->au32CellAllocationMap, _pstBank->u16SizeSegmentBitField * sizeof(orxU32));
+
+    /* Marks it as having free elements */
+    _pstBank->au32FreeSegmentMap[i >> 5] |= 1 << (i & 31);
   }
 
   /* Clears bank count */
@@ -521,30 +818,63 @@ void orxFASTCALL orxBank_Clear(orxBANK *_pstBank)
  */
 void orxFASTCALL orxBank_Compact(orxBANK *_pstBank)
 {
-  orxBANK_SEGMENT *pstSegment, *pstPreviousSegment;
+  orxU32 i, u32Count;
 
   /* Checks */
   orxASSERT(sstBank.u32Flags & orxBANK_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstBank != orxNULL);
 
-  /* For all segments */
-  for(pstPreviousSegment = _pstBank->pstFirstSegment, pstSegment = pstPreviousSegment->pstNext;
-      pstSegment != orxNULL;
-      pstPreviousSegment = pstSegment, pstSegment = pstSegment->pstNext)
+  /* Clears free segment map */
+  orxMemory_Zero(_pstBank->au32FreeSegmentMap, (_pstBank->u32SegmentListSize >> 5) * sizeof(orxU32));
+
+  /* For all segments (always keeping the first one) */
+  for(i = 0, u32Count = 0; i < _pstBank->u32SegmentCount; i++)
   {
+    orxBANK_SEGMENT *pstSegment;
+
+    /* Gets it */
+    pstSegment = _pstBank->apstSegmentList[i];
+
     /* Is empty? */
-    if(pstSegment->u32NbFree == (orxU32)_pstBank->u16NbCellPerSegments)
+    if((i != 0) && (pstSegment->u32NbFree == (orxU32)_pstBank->u16NbCellPerSegments))
     {
-      /* Updates previous segment's next */
-      pstPreviousSegment->pstNext = pstSegment->pstNext;
-
       /* Frees it */
       orxMemory_Free(pstSegment);
+    }
+    else
+    {
+      /* Stores it at its new index */
+      pstSegment->u32Index                = u32Count;
+      _pstBank->apstSegmentList[u32Count] = pstSegment;
 
-      /* Reverts back to previous */
-      pstSegment = pstPreviousSegment;
+      /* Has free elements? */
+      if(pstSegment->u32NbFree != 0)
+      {
+        /* Marks it */
+        _pstBank->au32FreeSegmentMap[u32Count >> 5] |= 1 << (u32Count & 31);
+      }
+
+      /* Updates count */
+      u32Count++;
+    }
+  }
+
+  /* Any segment removed? */
+  if(u32Count != _pstBank->u32SegmentCount)
+  {
+    /* Updates segment count */
+    _pstBank->u32SegmentCount = u32Count;
+
+    /* Rebuilds lookup table (can't fail when reusing the same table size) */
+    orxMemory_Zero(_pstBank->astSegmentTable, _pstBank->u32SegmentTableSize * sizeof(orxBANK_SEGMENT_ENTRY));
+    for(i = 0; i < u32Count; i++)
+    {
+      orxBank_AddSegmentEntries(_pstBank, _pstBank->apstSegmentList[i]);
     }
   }
+
+  /* Done! */
+  return;
 }
 
 /** Compacts all banks by removing all their unused segments
@@ -586,12 +916,12 @@ void *orxFASTCALL orxBank_GetNext(const orxBANK *_pstBank, const void *_pCell)
   if(_pstBank->u32Count > 0)
   {
     orxBANK_SEGMENT *pstSegment;
-    orxU32          u32ByteIndex, u32Mask;
+    orxU32          u32SegmentIndex, u32ByteIndex, u32Mask;
 
     /* Look for the segment associated to this cell */
     if(_pCell == orxNULL)
     {
-      pstSegment = _pstBank->pstFirstSegment;
+      pstSegment = _pstBank->apstSegmentList[0];
 
       /* Get the first bit index */
       u32ByteIndex  = 0;
@@ -614,8 +944,13 @@ void *orxFASTCALL orxBank_GetNext(const orxBANK *_pstBank, const void *_pCell)
     }
 
     /* Loop on bank segments while not found */
-    for(;pstSegment != orxNULL; pstSegment = pstSegment->pstNext, u32ByteIndex = 0)
+    for(u32SegmentIndex = pstSegment->u32Index;
+        u32SegmentIndex < _pstBank->u32SegmentCount;
+        u32SegmentIndex++, u32ByteIndex = 0)
     {
+      /* Gets segment */
+      pstSegment = _pstBank->apstSegmentList[u32SegmentIndex];
+
       /* Loop on segment bitfields while not found */
       for(;u32ByteIndex < _pstBank->u16SizeSegmentBitField; u32ByteIndex++, u32Mask = 0xFFFFFFFF)
       {
@@ -646,26 +981,15 @@ void *orxFASTCALL orxBank_GetNext(const orxBANK *_pstBank, const void *_pCell)
 orxU32 orxFASTCALL orxBank_GetIndex(const orxBANK *_pstBank, const void *_pCell)
 {
   orxBANK_SEGMENT  *pstSegment;
-  orxU32            u32CellIndex, u32Size, u32SegmentCount, u32Result = orxU32_UNDEFINED;
+  orxU32            u32CellIndex, u32Result = orxU32_UNDEFINED;
 
   /* Checks */
   orxASSERT((sstBank.u32Flags & orxBANK_KU32_STATIC_FLAG_READY) == orxBANK_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstBank != orxNULL);
   orxASSERT(_pCell != orxNULL);
 
-  /* For all segments */
-  for(pstSegment = _pstBank->pstFirstSegment, u32Size = _pstBank->u32ElemSize * (orxU32)_pstBank->u16NbCellPerSegments, u32SegmentCount = 0;
-      pstSegment != orxNULL;
-      pstSegment = pstSegment->pstNext, u32SegmentCount++)
-  {
-    /* Is cell in segment? */
-    if((_pCell >= pstSegment->pSegmentData)
-    && (((orxU32)((orxU8 *)_pCell - (orxU8 *)pstSegment->pSegmentData)) < u32Size))
-    {
-      /* Stops */
-      break;
-    }
-  }
+  /* Gets segment */
+  pstSegment = orxBank_GetSegment(_pstBank, _pCell);
 
   /* Checks */
   orxASSERT(pstSegment != orxNULL);
@@ -677,7 +1001,7 @@ orxU32 orxFASTCALL orxBank_GetIndex(const orxBANK *_pstBank, const void *_pCell)
   if(pstSegment->au32CellAllocationMap[u32CellIndex >> 5] & (1 << (u32CellIndex & 31)))
   {
     /* Updates result */
-    u32Result = (u32SegmentCount * (orxU32)_pstBank->u16NbCellPerSegments) + u32CellIndex;
+    u32Result = (pstSegment->u32Index * (orxU32)_pstBank->u16NbCellPerSegments) + u32CellIndex;
   }
 
   /* Done! */
@@ -700,15 +1024,21 @@ void *orxFASTCALL orxBank_GetAtIndex(const orxBANK *_pstBank, orxU32 _u32Index)
   /* Non empty? */
   if(_pstBank->u32Count > 0)
   {
-    orxBANK_SEGMENT  *pstSegment;
-    orxU32            u32Index;
+    orxU32 u32SegmentIndex;
 
-    /* Skips all segments till we hit the right one */
-    for(u32Index = _u32Index, pstSegment = _pstBank->pstFirstSegment; (u32Index >= (orxU32)_pstBank->u16NbCellPerSegments) && (pstSegment != orxNULL); u32Index -= (orxU32)_pstBank->u16NbCellPerSegments, pstSegment = pstSegment->pstNext);
+    /* Gets segment index */
+    u32SegmentIndex = _u32Index / (orxU32)_pstBank->u16NbCellPerSegments;
 
     /* Is segment valid? */
-    if(pstSegment != orxNULL)
+    if(u32SegmentIndex < _pstBank->u32SegmentCount)
     {
+      orxBANK_SEGMENT  *pstSegment;
+      orxU32            u32Index;
+
+      /* Gets segment & cell index */
+      pstSegment  = _pstBank->apstSegmentList[u32SegmentIndex];
+      u32Index    = _u32Index - (u32SegmentIndex * (orxU32)_pstBank->u16NbCellPerSegments);
+
       /* Checks */
       orxASSERT((u32Index >> 5) < _pstBank->u16SizeSegmentBitField);
 
@@ -37,6 +37,7 @@
 #define USE_DL_PREFIX
 #define USE_BUILTIN_FFS 1
 #define USE_LOCKS 1
+#define MALLOC_ALIGNMENT ((size_t)16U)
 #undef _GNU_SOURCE
 
 #if defined(__orxIOS__) && defined(__orxLLVM__)
@@ -57,6 +58,26 @@
 
 #define orxMEMORY_KZ_LITERAL_PREFIX             "MEM_"
 
+#define orxMEMORY_KU32_CACHE_NUMBER             32          /**< Max number of thread caches */
+#define orxMEMORY_KU32_CACHE_CLASS_NUMBER       16          /**< Number of size classes */
+#define orxMEMORY_KU32_CACHE_CLASS_SHIFT        4           /**< Size class granularity (16 bytes, header included) */
+#define orxMEMORY_KU32_CACHE_BLOCK_NUMBER       64          /**< Max number of cached blocks per class */
+#define orxMEMORY_KU32_CACHE_REFILL_NUMBER      16          /**< Number of blocks allocated at once on refill */
+#define orxMEMORY_KU32_CACHE_MAX_SIZE           ((orxMEMORY_KU32_CACHE_CLASS_NUMBER << orxMEMORY_KU32_CACHE_CLASS_SHIFT) - sizeof(orxMEMORY_HEADER)) /**< Max cached allocation size */
+
+#define orxMEMORY_KU32_ARENA_CHUNK_SIZE         65536       /**< Frame arena chunk size */
+#define orxMEMORY_KU32_ARENA_ALIGNMENT          16          /**< Frame arena allocation alignment */
+
+#define orxMEMORY_KU8_CLASS_NONE                0xFF        /**< Direct (uncached) allocation */
+#define orxMEMORY_KU8_CLASS_FRAME               0xFE        /**< Frame arena allocation */
+#define orxMEMORY_KU32_CACHE_INDEX_NONE         0xFFFFFFFF  /**< No cache available for thread */
+
+#if defined(__orxMSVC__)
+  #define orxMEMORY_THREAD_LOCAL                __declspec(thread)
+#else /* __orxMSVC__ */
+  #define orxMEMORY_THREAD_LOCAL                __thread
+#endif /* __orxMSVC__ */
+
 
 /***************************************************************************
  * Structure declaration                                                   *
@@ -70,6 +91,81 @@ typedef struct __orxMEMORY_TRACKER_t
 
 } orxMEMORY_TRACKER;
 
+/** Memory block header, stored before every allocation, padded so that allocations keep the maximum platform alignment (16)
+ */
+typedef struct __orxMEMORY_HEADER_t
+{
+  orxU32  u32Type;                                          /**< Memory type : 4 */
+  orxU8   u8Class;                                          /**< Size class, orxMEMORY_KU8_CLASS_NONE for direct allocations : 5 */
+  orxU8   u8Cache;                                          /**< Owner cache index : 6 */
+  orxU8   au8Padding[10];                                   /**< Padding : 16 */
+
+} orxMEMORY_HEADER;
+
+/** Free cached block (link stored in its payload)
+ */
+typedef struct __orxMEMORY_BLOCK_t
+{
+  orxMEMORY_HEADER                stHeader;                 /**< Header : 16 */
+  struct __orxMEMORY_BLOCK_t     *pstNext;                  /**< Next free block : 20/24 */
+
+} orxMEMORY_BLOCK;
+
+/** Thread cache: per-class free lists, only accessed by their owner thread, and a queue of blocks freed by other threads
+ */
+typedef struct __orxMEMORY_CACHE_t
+{
+  orxMEMORY_BLOCK                *apstBlockList[orxMEMORY_KU32_CACHE_CLASS_NUMBER];  /**< Free block lists */
+  orxU32                          au32BlockCount[orxMEMORY_KU32_CACHE_CLASS_NUMBER]; /**< Free block counts */
+  orxMEMORY_BLOCK * volatile      pstRemoteList;            /**< Blocks freed by other threads */
+  volatile orxU32                 u32Used;                  /**< Used by a thread? */
+  orxU8                           au8Padding[orxMEMORY_KU32_DEFAULT_CACHE_LINE_SIZE]; /**< Padding (avoids false sharing) */
+
+} orxMEMORY_CACHE;
+
+/** Frame block header
+ */
+typedef struct __orxMEMORY_FRAME_HEADER_t
+{
+  orxU32                          u32Size;                  /**< Block size : 4 */
+  orxU32                          au32Padding[3];           /**< Padding : 16 */
+  orxMEMORY_HEADER                stHeader;                 /**< Header : 32 */
+
+} orxMEMORY_FRAME_HEADER;
+
+/** Frame arena chunk
+ */
+typedef struct __orxMEMORY_ARENA_CHUNK_t
+{
+  struct __orxMEMORY_ARENA_CHUNK_t *pstNext;                /**< Next chunk in arena : 4/8 */
+  struct __orxMEMORY_ARENA_CHUNK_t *pstNextGlobal;          /**< Next chunk in global list : 8/16 */
+  orxU32                          u32Size;                  /**< Chunk size (excluding this header) : 12/20 */
+
+#ifdef __orx64__
+
+  orxU32                          au32Padding[3];           /**< Padding : 32 */
+
+#else /* __orx64__ */
+
+  orxU32                          u32Padding;               /**< Padding : 16 */
+
+#endif /* __orx64__ */
+
+} orxMEMORY_ARENA_CHUNK;
+
+/** Frame arena (one per thread)
+ */
+typedef struct __orxMEMORY_ARENA_t
+{
+  orxMEMORY_ARENA_CHUNK          *pstFirstChunk;            /**< First chunk */
+  orxMEMORY_ARENA_CHUNK          *pstChunk;                 /**< Current chunk */
+  orxU8                          *pu8Cursor;                /**< Current chunk cursor */
+  orxU8                          *pu8End;                   /**< Current chunk end */
+  orxU32                          u32FrameCount;            /**< Frame count of last use */
+  orxU32                          u32SessionCount;          /**< Module session count of last use */
+
+} orxMEMORY_ARENA;
+
 typedef struct __orxMEMORY_STATIC_t
 {
 #ifdef __orxPROFILER__
@@ -78,6 +174,11 @@ typedef struct __orxMEMORY_STATIC_t
 
 #endif /* __orxPROFILER__ */
 
+  orxMEMORY_CACHE astCacheList[orxMEMORY_KU32_CACHE_NUMBER]; /**< Thread caches */
+  orxMEMORY_ARENA_CHUNK * volatile pstArenaChunkList;       /**< All frame arena chunks */
+  volatile orxU32 u32FrameCount;                            /**< Frame count */
+  orxU32 u32SessionCount;                                   /**< Module session count */
+
   orxU32 u32Flags;   /**< Flags set by the memory module */
 
 } orxMEMORY_STATIC;
@@ -89,6 +190,18 @@ typedef struct __orxMEMORY_STATIC_t
 
 static orxMEMORY_STATIC sstMemory;
 
+/** Cache index of the current thread (0: none yet, orxMEMORY_KU32_CACHE_INDEX_NONE: unavailable, index + 1 otherwise)
+ */
+static orxMEMORY_THREAD_LOCAL orxU32 su32CacheIndex;
+
+/** Frame arena of the current thread
+ */
+static orxMEMORY_THREAD_LOCAL orxMEMORY_ARENA sstArena;
+
+/** Module session count (survives module exit)
+ */
+static orxU32 su32SessionCount;
+
 
 /***************************************************************************
  * Private functions                                                       *
@@ -191,6 +304,381 @@ static orxINLINE orxU32 orxMemory_CacheLineSize()
 
 #endif
 
+/** Gets the usable size of a block
+ * @param[in] _pstHeader  Block header
+ * @return Usable size
+ */
+static orxINLINE orxU32 orxMemory_GetBlockSize(orxMEMORY_HEADER *_pstHeader)
+{
+  orxU32 u32Result;
+
+  /* Updates result */
+  u32Result = (_pstHeader->u8Class == orxMEMORY_KU8_CLASS_NONE)
+            ? (orxU32)(dlmalloc_usable_size(_pstHeader) - sizeof(orxMEMORY_HEADER))
+            : (_pstHeader->u8Class == orxMEMORY_KU8_CLASS_FRAME)
+            ? orxSTRUCT_GET_FROM_FIELD(orxMEMORY_FRAME_HEADER, stHeader, _pstHeader)->u32Size
+            : (orxU32)((((orxU32)_pstHeader->u8Class + 1) << orxMEMORY_KU32_CACHE_CLASS_SHIFT) - sizeof(orxMEMORY_HEADER));
+
+  /* Done! */
+  return u32Result;
+}
+
+/** Allocates a block from the current thread's frame arena
+ * @param[in] _u32Size    Size of the block
+ * @return orxMEMORY_HEADER / orxNULL
+ */
+static orxMEMORY_HEADER *orxFASTCALL orxMemory_AllocateFrame(orxU32 _u32Size)
+{
+  orxMEMORY_FRAME_HEADER *pstFrameHeader;
+  orxU32                  u32Size;
+  orxMEMORY_HEADER       *pstResult = orxNULL;
+
+  /* Arena from a previous session? */
+  if(sstArena.u32SessionCount != sstMemory.u32SessionCount)
+  {
+    /* Forgets it (its chunks have been freed upon exit) */
+    orxMemory_Zero(&sstArena, sizeof(orxMEMORY_ARENA));
+    sstArena.u32SessionCount  = sstMemory.u32SessionCount;
+    sstArena.u32FrameCount    = sstMemory.u32FrameCount;
+  }
+  /* New frame? */
+  else if(sstArena.u32FrameCount != sstMemory.u32FrameCount)
+  {
+    /* Rewinds it */
+    sstArena.pstChunk       = sstArena.pstFirstChunk;
+    sstArena.pu8Cursor      = (sstArena.pstChunk != orxNULL) ? (orxU8 *)(sstArena.pstChunk + 1) : orxNULL;
+    sstArena.pu8End         = (sstArena.pstChunk != orxNULL) ? sstArena.pu8Cursor + sstArena.pstChunk->u32Size : orxNULL;
+    sstArena.u32FrameCount  = sstMemory.u32FrameCount;
+  }
+
+  /* Gets aligned size, header included */
+  u32Size = (_u32Size + sizeof(orxMEMORY_FRAME_HEADER) + orxMEMORY_KU32_ARENA_ALIGNMENT - 1) & ~(orxMEMORY_KU32_ARENA_ALIGNMENT - 1);
+
+  /* While current chunk is too small */
+  while((orxU32)(sstArena.pu8End - sstArena.pu8Cursor) < u32Size)
+  {
+    /* Has next chunk? */
+    if((sstArena.pstChunk != orxNULL) && (sstArena.pstChunk->pstNext != orxNULL))
+    {
+      /* Selects it */
+      sstArena.pstChunk = sstArena.pstChunk->pstNext;
+    }
+    else
+    {
+      orxMEMORY_ARENA_CHUNK  *pstChunk;
+      orxU32                  u32ChunkSize;
+
+      /* Gets chunk size */
+      u32ChunkSize = (u32Size > orxMEMORY_KU32_ARENA_CHUNK_SIZE) ? u32Size : orxMEMORY_KU32_ARENA_CHUNK_SIZE;
+
+      /* Allocates it */
+      pstChunk = (orxMEMORY_ARENA_CHUNK *)dlmalloc((size_t)(u32ChunkSize + sizeof(orxMEMORY_ARENA_CHUNK)));
+
+      /* Failure? */
+      if(pstChunk == NULL)
+      {
+        break;
+      }
+
+      /* Inits it */
+      pstChunk->pstNext = orxNULL;
+      pstChunk->u32Size = u32ChunkSize;
+
+      /* Adds it to global list (for module exit) */
+      do
+      {
+        pstChunk->pstNextGlobal = sstMemory.pstArenaChunkList;
+      } while(orxMEMORY_ATOMIC_CAS_POINTER(&(sstMemory.pstArenaChunkList), pstChunk->pstNextGlobal, pstChunk) == orxFALSE);
+
+      /* Links it to arena */
+      if(sstArena.pstChunk != orxNULL)
+      {
+        sstArena.pstChunk->pstNext = pstChunk;
+      }
+      else
+      {
+        sstArena.pstFirstChunk = pstChunk;
+      }
+
+      /* Selects it */
+      sstArena.pstChunk = pstChunk;
+    }
+
+    /* Updates cursor */
+    sstArena.pu8Cursor  = (orxU8 *)(sstArena.pstChunk + 1);
+    sstArena.pu8End     = sstArena.pu8Cursor + sstArena.pstChunk->u32Size;
+  }
+
+  /* Enough room? */
+  if((orxU32)(sstArena.pu8End - sstArena.pu8Cursor) >= u32Size)
+  {
+    /* Gets block */
+    pstFrameHeader = (orxMEMORY_FRAME_HEADER *)sstArena.pu8Cursor;
+
+    /* Updates cursor */
+    sstArena.pu8Cursor += u32Size;
+
+    /* Inits it */
+    pstFrameHeader->u32Size           = u32Size - sizeof(orxMEMORY_FRAME_HEADER);
+    pstFrameHeader->stHeader.u8Class  = orxMEMORY_KU8_CLASS_FRAME;
+    pstFrameHeader->stHeader.u8Cache  = 0;
+
+    /* Updates result */
+    pstResult = &(pstFrameHeader->stHeader);
+  }
+
+  /* Done! */
+  return pstResult;
+}
+
+/** Gets the cache of the current thread, claiming one if needed
+ * @return orxMEMORY_CACHE / orxNULL
+ */
+static orxINLINE orxMEMORY_CACHE *orxMemory_GetCache()
+{
+  orxMEMORY_CACHE *pstResult = orxNULL;
+
+  /* No cache yet? */
+  if(su32CacheIndex == 0)
+  {
+    orxU32 i;
+
+    /* Defaults to unavailable */
+    su32CacheIndex = orxMEMORY_KU32_CACHE_INDEX_NONE;
+
+    /* For all caches */
+    for(i = 0; i < orxMEMORY_KU32_CACHE_NUMBER; i++)
+    {
+      /* Claims it? */
+      if(orxMEMORY_ATOMIC_CAS_U32(&(sstMemory.astCacheList[i].u32Used), 0, 1) != orxFALSE)
+      {
+        /* Stores its index */
+        su32CacheIndex = i + 1;
+        break;
+      }
+    }
+  }
+
+  /* Has cache? */
+  if(su32CacheIndex != orxMEMORY_KU32_CACHE_INDEX_NONE)
+  {
+    /* Updates result */
+    pstResult = &(sstMemory.astCacheList[su32CacheIndex - 1]);
+  }
+
+  /* Done! */
+  return pstResult;
+}
+
+/** Collects blocks freed by other threads into a cache's free lists
+ * @param[in] _pstCache   Concerned cache
+ */
+static orxINLINE void orxMemory_CollectRemoteBlocks(orxMEMORY_CACHE *_pstCache)
+{
+  orxMEMORY_BLOCK *pstBlock;
+
+  /* Gets all remote blocks */
+  pstBlock = (orxMEMORY_BLOCK *)orxMEMORY_ATOMIC_EXCHANGE_POINTER(&(_pstCache->pstRemoteList), orxNULL);
+
+  /* For all of them */
+  while(pstBlock != orxNULL)
+  {
+    orxMEMORY_BLOCK  *pstNext;
+    orxU32            u32Class;
+
+    /* Gets next and class */
+    pstNext   = pstBlock->pstNext;
+    u32Class  = pstBlock->stHeader.u8Class;
+
+    /* Adds it to its free list */
+    pstBlock->pstNext = _pstCache->apstBlockList[u32Class];
+    _pstCache->apstBlockList[u32Class] = pstBlock;
+    _pstCache->au32BlockCount[u32Class]++;
+
+    /* Go to next */
+    pstBlock = pstNext;
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Gives blocks of a free list back to the system allocator
+ * @param[in] _pstCache   Concerned cache
+ * @param[in] _u32Class   Concerned class
+ * @param[in] _u32Count   Number of blocks to release
+ */
+static void orxFASTCALL orxMemory_ReleaseBlocks(orxMEMORY_CACHE *_pstCache, orxU32 _u32Class, orxU32 _u32Count)
+{
+  void   *apBlockList[orxMEMORY_KU32_CACHE_BLOCK_NUMBER];
+  orxU32  u32Count;
+
+  /* While there are blocks to release */
+  while((_u32Count > 0) && (_pstCache->apstBlockList[_u32Class] != orxNULL))
+  {
+    /* Gathers a batch of them */
+    for(u32Count = 0;
+        (u32Count < _u32Count) && (u32Count < orxMEMORY_KU32_CACHE_BLOCK_NUMBER) && (_pstCache->apstBlockList[_u32Class] != orxNULL);
+        u32Count++)
+    {
+      apBlockList[u32Count] = _pstCache->apstBlockList[_u32Class];
+      _pstCache->apstBlockList[_u32Class] = _pstCache->apstBlockList[_u32Class]->pstNext;
+    }
+
+    /* Updates counts */
+    _pstCache->au32BlockCount[_u32Class] -= u32Count;
+    _u32Count -= u32Count;
+
+    /* Frees them with a single lock */
+    dlbulk_free(apBlockList, (size_t)u32Count);
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Releases all the blocks of a cache
+ * @param[in] _pstCache   Concerned cache
+ */
+static void orxFASTCALL orxMemory_ReleaseCacheBlocks(orxMEMORY_CACHE *_pstCache)
+{
+  orxU32 i;
+
+  /* Collects remote blocks */
+  orxMemory_CollectRemoteBlocks(_pstCache);
+
+  /* For all classes */
+  for(i = 0; i < orxMEMORY_KU32_CACHE_CLASS_NUMBER; i++)
+  {
+    /* Releases all their blocks */
+    orxMemory_ReleaseBlocks(_pstCache, i, _pstCache->au32BlockCount[i]);
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Allocates a block from a cache
+ * @param[in] _pstCache   Concerned cache
+ * @param[in] _u32Class   Size class
+ * @return orxMEMORY_HEADER / orxNULL
+ */
+static orxINLINE orxMEMORY_HEADER *orxMemory_AllocateCached(orxMEMORY_CACHE *_pstCache, orxU32 _u32Class)
+{
+  orxMEMORY_BLOCK  *pstBlock;
+  orxMEMORY_HEADER *pstResult = orxNULL;
+
+  /* Empty free list? */
+  if(_pstCache->apstBlockList[_u32Class] == orxNULL)
+  {
+    /* Collects remote blocks */
+    orxMemory_CollectRemoteBlocks(_pstCache);
+
+    /* Still empty? */
+    if(_pstCache->apstBlockList[_u32Class] == orxNULL)
+    {
+      void   *apBlockList[orxMEMORY_KU32_CACHE_REFILL_NUMBER];
+      size_t  auSizeList[orxMEMORY_KU32_CACHE_REFILL_NUMBER];
+      orxU32  i;
+
+      /* Inits sizes */
+      for(i = 0; i < orxMEMORY_KU32_CACHE_REFILL_NUMBER; i++)
+      {
+        auSizeList[i] = (size_t)((_u32Class + 1) << orxMEMORY_KU32_CACHE_CLASS_SHIFT);
+      }
+
+      /* Allocates a batch of blocks with a single lock */
+      if(dlindependent_comalloc(orxMEMORY_KU32_CACHE_REFILL_NUMBER, auSizeList, apBlockList) != NULL)
+      {
+        orxU8 u8Cache;
+
+        /* Gets cache index */
+        u8Cache = (orxU8)(_pstCache - sstMemory.astCacheList);
+
+        /* For all blocks */
+        for(i = 0; i < orxMEMORY_KU32_CACHE_REFILL_NUMBER; i++)
+        {
+          /* Inits it */
+          pstBlock                    = (orxMEMORY_BLOCK *)apBlockList[i];
+          pstBlock->stHeader.u8Class  = (orxU8)_u32Class;
+          pstBlock->stHeader.u8Cache  = u8Cache;
+
+          /* Adds it to free list */
+          pstBlock->pstNext = _pstCache->apstBlockList[_u32Class];
+          _pstCache->apstBlockList[_u32Class] = pstBlock;
+        }
+
+        /* Updates count */
+        _pstCache->au32BlockCount[_u32Class] += orxMEMORY_KU32_CACHE_REFILL_NUMBER;
+      }
+    }
+  }
+
+  /* Gets first free block */
+  pstBlock = _pstCache->apstBlockList[_u32Class];
+
+  /* Valid? */
+  if(pstBlock != orxNULL)
+  {
+    /* Removes it from free list */
+    _pstCache->apstBlockList[_u32Class] = pstBlock->pstNext;
+    _pstCache->au32BlockCount[_u32Class]--;
+
+    /* Updates result */
+    pstResult = &(pstBlock->stHeader);
+  }
+
+  /* Done! */
+  return pstResult;
+}
+
+/** Frees a cached block
+ * @param[in] _pstHeader  Header of the block to free
+ */
+static orxINLINE void orxMemory_FreeCached(orxMEMORY_HEADER *_pstHeader)
+{
+  orxMEMORY_CACHE  *pstCache;
+  orxMEMORY_BLOCK  *pstBlock;
+  orxU32            u32Class;
+
+  /* Gets block, class & current thread's cache */
+  pstBlock  = orxSTRUCT_GET_FROM_FIELD(orxMEMORY_BLOCK, stHeader, _pstHeader);
+  u32Class  = _pstHeader->u8Class;
+  pstCache  = orxMemory_GetCache();
+
+  /* Owned by current thread? */
+  if((pstCache != orxNULL) && (pstCache == &(sstMemory.astCacheList[_pstHeader->u8Cache])))
+  {
+    /* Adds it to its free list */
+    pstBlock->pstNext = pstCache->apstBlockList[u32Class];
+    pstCache->apstBlockList[u32Class] = pstBlock;
+
+    /* Too many cached blocks? */
+    if(++pstCache->au32BlockCount[u32Class] > orxMEMORY_KU32_CACHE_BLOCK_NUMBER)
+    {
+      /* Releases half of them */
+      orxMemory_ReleaseBlocks(pstCache, u32Class, orxMEMORY_KU32_CACHE_BLOCK_NUMBER >> 1);
+    }
+  }
+  else
+  {
+    orxMEMORY_BLOCK *pstNext;
+
+    /* Gets owner cache */
+    pstCache = &(sstMemory.astCacheList[_pstHeader->u8Cache]);
+
+    /* Pushes it to the owner's remote list */
+    do
+    {
+      pstNext           = pstCache->pstRemoteList;
+      pstBlock->pstNext = pstNext;
+    } while(orxMEMORY_ATOMIC_CAS_POINTER(&(pstCache->pstRemoteList), pstNext, pstBlock) == orxFALSE);
+  }
+
+  /* Done! */
+  return;
+}
+
 
 /***************************************************************************
  * Public functions                                                        *
@@ -218,6 +706,9 @@ orxSTATUS orxFASTCALL orxMemory_Init()
     /* Cleans static controller */
     orxMemory_Zero(&sstMemory, sizeof(orxMEMORY_STATIC));
 
+    /* Starts new session (invalidates frame arenas of previous ones) */
+    sstMemory.u32SessionCount = ++su32SessionCount;
+
     /* Module initialized */
     sstMemory.u32Flags = orxMEMORY_KU32_STATIC_FLAG_READY;
 
@@ -244,6 +735,31 @@ void orxFASTCALL orxMemory_Exit()
   /* Module initialized ? */
   if((sstMemory.u32Flags & orxMEMORY_KU32_STATIC_FLAG_READY) == orxMEMORY_KU32_STATIC_FLAG_READY)
   {
+    orxU32 i;
+
+    /* For all caches */
+    for(i = 0; i < orxMEMORY_KU32_CACHE_NUMBER; i++)
+    {
+      /* Releases its blocks */
+      orxMemory_ReleaseCacheBlocks(&(sstMemory.astCacheList[i]));
+
+      /* Frees it */
+      sstMemory.astCacheList[i].u32Used = 0;
+    }
+
+    /* Resets current thread's cache */
+    su32CacheIndex = 0;
+
+    /* Frees all frame arena chunks */
+    while(sstMemory.pstArenaChunkList != orxNULL)
+    {
+      orxMEMORY_ARENA_CHUNK *pstChunk;
+
+      pstChunk = sstMemory.pstArenaChunkList;
+      sstMemory.pstArenaChunkList = pstChunk->pstNextGlobal;
+      dlfree(pstChunk);
+    }
+
     /* Module uninitialized */
     sstMemory.u32Flags = orxMEMORY_KU32_STATIC_FLAG_NONE;
   }
@@ -258,42 +774,67 @@ void orxFASTCALL orxMemory_Exit()
  */
 void *orxFASTCALL orxMemory_Allocate(orxU32 _u32Size, orxMEMORY_TYPE _eMemType)
 {
-  void *pResult;
+  orxMEMORY_HEADER *pstHeader = orxNULL;
+  orxMEMORY_CACHE  *pstCache;
+  void             *pResult = orxNULL;
 
   /* Checks */
   orxASSERT((sstMemory.u32Flags & orxMEMORY_KU32_STATIC_FLAG_READY) == orxMEMORY_KU32_STATIC_FLAG_READY);
   orxASSERT(_eMemType < orxMEMORY_TYPE_NUMBER);
 
-#ifdef __orxPROFILER__
+  /* Frame memory? */
+  if(_eMemType == orxMEMORY_TYPE_FRAME)
+  {
+    /* Allocates it from frame arena */
+    pstHeader = orxMemory_AllocateFrame(_u32Size);
 
-  /* Allocates memory */
-  pResult = dlmalloc((size_t)(_u32Size + sizeof(orxMEMORY_TYPE)));
+    /* Failure? */
+    if(pstHeader == orxNULL)
+    {
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_MEMORY, "Couldn't allocate <%u> bytes of frame memory.", _u32Size);
+    }
+  }
+  /* Small enough to be cached and has a cache? */
+  else if((_u32Size <= orxMEMORY_KU32_CACHE_MAX_SIZE)
+  && ((pstCache = orxMemory_GetCache()) != orxNULL))
+  {
+    /* Allocates it from cache (empty blocks still need room for their free list link) */
+    pstHeader = orxMemory_AllocateCached(pstCache, (((_u32Size != 0) ? _u32Size : 1) + sizeof(orxMEMORY_HEADER) - 1) >> orxMEMORY_KU32_CACHE_CLASS_SHIFT);
+  }
 
-  /* Success? */
-  if(pResult != NULL)
+  /* Not allocated yet? */
+  if((pstHeader == orxNULL) && (_eMemType != orxMEMORY_TYPE_FRAME))
   {
-    size_t uMemoryChunkSize;
+    /* Allocates memory */
+    pstHeader = (orxMEMORY_HEADER *)dlmalloc((size_t)(_u32Size + sizeof(orxMEMORY_HEADER)));
 
+    /* Success? */
+    if(pstHeader != NULL)
+    {
+      /* Inits it */
+      pstHeader->u8Class = orxMEMORY_KU8_CLASS_NONE;
+      pstHeader->u8Cache = 0;
+    }
+  }
+
+  /* Success? */
+  if(pstHeader != orxNULL)
+  {
     /* Tags memory chunk */
-    *(orxMEMORY_TYPE *)pResult = _eMemType;
+    pstHeader->u32Type = (orxU32)_eMemType;
 
-    /* Gets memory chunk size */
-    uMemoryChunkSize = dlmalloc_usable_size(pResult);
+#ifdef __orxPROFILER__
 
     /* Updates memory tracker */
-    orxMemory_Track(_eMemType, (orxU32)(uMemoryChunkSize - sizeof(orxMEMORY_TYPE)), orxTRUE);
+    orxMemory_Track(_eMemType, orxMemory_GetBlockSize(pstHeader), orxTRUE);
+
+#endif /* __orxPROFILER__ */
 
     /* Updates result */
-    pResult = (orxU8 *)pResult + sizeof(orxMEMORY_TYPE);
+    pResult = pstHeader + 1;
   }
 
-#else /* __orxPROFILER__ */
-
-  /* Allocates memory */
-  pResult = dlmalloc((size_t)_u32Size);
-
-#endif /* __orxPROFILER__ */
-
   /* Done! */
   return pResult;
 }
@@ -320,44 +861,64 @@ void *orxFASTCALL orxMemory_Reallocate(void *_pMem, orxU32 _u32Size)
   }
   else
   {
+    orxMEMORY_HEADER *pstHeader;
+    orxU32            u32BlockSize;
 
-#ifdef __orxPROFILER__
-
-    orxMEMORY_TYPE eMemType;
-    size_t         uMemoryChunkSize;
-
-    /* Updates pointer */
-    _pMem = (orxU8 *)_pMem - sizeof(orxMEMORY_TYPE);
-
-    /* Gets memory type from memory chunk tag */
-    eMemType = *(orxMEMORY_TYPE *)_pMem;
-
-    /* Gets memory chunk size */
-    uMemoryChunkSize = dlmalloc_usable_size(_pMem);
+    /* Gets header & block size */
+    pstHeader     = (orxMEMORY_HEADER *)_pMem - 1;
+    u32BlockSize  = orxMemory_GetBlockSize(pstHeader);
 
-    /* Reallocates memory */
-    pResult = dlrealloc(_pMem, (size_t)(_u32Size + sizeof(orxMEMORY_TYPE)));
-
-    /* Success? */
-    if(pResult != NULL)
+    /* Cached or frame block? */
+    if(pstHeader->u8Class != orxMEMORY_KU8_CLASS_NONE)
     {
-      /* Tags memory chunk */
-      *(orxMEMORY_TYPE *)pResult = eMemType;
-
-      /* Updates memory tracker */
-      orxMemory_Track(eMemType, (orxU32)(uMemoryChunkSize - sizeof(orxMEMORY_TYPE)), orxFALSE);
-      orxMemory_Track(eMemType, (orxU32)(dlmalloc_usable_size(pResult) - sizeof(orxMEMORY_TYPE)), orxTRUE);
-
-      /* Updates result */
-      pResult = (orxU8 *)pResult + sizeof(orxMEMORY_TYPE);
+      /* Still fits? */
+      if(_u32Size <= u32BlockSize)
+      {
+        /* Keeps it */
+        pResult = _pMem;
+      }
+      else
+      {
+        /* Allocates new block */
+        pResult = orxMemory_Allocate(_u32Size, (orxMEMORY_TYPE)pstHeader->u32Type);
+
+        /* Success? */
+        if(pResult != orxNULL)
+        {
+          /* Copies content */
+          orxMemory_Copy(pResult, _pMem, u32BlockSize);
+
+          /* Frees old block */
+          orxMemory_Free(_pMem);
+        }
+      }
     }
+    else
+    {
+      /* Reallocates memory */
+      pstHeader = (orxMEMORY_HEADER *)dlrealloc(pstHeader, (size_t)(_u32Size + sizeof(orxMEMORY_HEADER)));
 
-#else /* __orxPROFILER__ */
+      /* Success? */
+      if(pstHeader != NULL)
+      {
 
-    /* Reallocates memory */
-    pResult = dlrealloc(_pMem, (size_t)_u32Size);
+#ifdef __orxPROFILER__
+
+        /* Updates memory tracker */
+        orxMemory_Track((orxMEMORY_TYPE)pstHeader->u32Type, u32BlockSize, orxFALSE);
+        orxMemory_Track((orxMEMORY_TYPE)pstHeader->u32Type, orxMemory_GetBlockSize(pstHeader), orxTRUE);
 
 #endif /* __orxPROFILER__ */
+
+        /* Updates result */
+        pResult = pstHeader + 1;
+      }
+      else
+      {
+        /* Updates result */
+        pResult = orxNULL;
+      }
+    }
   }
 
   /* Done! */
@@ -372,35 +933,96 @@ void orxFASTCALL orxMemory_Free(void *_pMem)
   /* Checks */
   orxASSERT((sstMemory.u32Flags & orxMEMORY_KU32_STATIC_FLAG_READY) == orxMEMORY_KU32_STATIC_FLAG_READY);
 
-#ifdef __orxPROFILER__
-
   /* Valid? */
   if(_pMem != NULL)
   {
-    orxMEMORY_TYPE eMemType;
-    size_t         uMemoryChunkSize;
+    orxMEMORY_HEADER *pstHeader;
 
-    /* Updates pointer */
-    _pMem = (orxU8 *)_pMem - sizeof(orxMEMORY_TYPE);
+    /* Gets header */
+    pstHeader = (orxMEMORY_HEADER *)_pMem - 1;
 
-    /* Gets memory type from memory chunk tag */
-    eMemType = *(orxMEMORY_TYPE *)_pMem;
+    /* Not a frame block? (they're all released at once, in orxMemory_ResetFrame()) */
+    if(pstHeader->u8Class != orxMEMORY_KU8_CLASS_FRAME)
+    {
 
-    /* Gets memory chunk size */
-    uMemoryChunkSize = dlmalloc_usable_size(_pMem);
+#ifdef __orxPROFILER__
 
-    /* Updates memory tracker */
-    orxMemory_Track(eMemType, (orxU32)(uMemoryChunkSize - sizeof(orxMEMORY_TYPE)), orxFALSE);
-  }
+      /* Updates memory tracker */
+      orxMemory_Track((orxMEMORY_TYPE)pstHeader->u32Type, orxMemory_GetBlockSize(pstHeader), orxFALSE);
 
 #endif /* __orxPROFILER__ */
 
-  /* System call to free memory */
-  dlfree(_pMem);
+      /* Cached block? */
+      if(pstHeader->u8Class != orxMEMORY_KU8_CLASS_NONE)
+      {
+        /* Frees it to its cache */
+        orxMemory_FreeCached(pstHeader);
+      }
+      else
+      {
+        /* System call to free memory */
+        dlfree(pstHeader);
+      }
+    }
+  }
 
   return;
 }
 
+/** Releases the memory cache of the calling thread: small blocks freed by this thread are given back to the system allocator
+ * @note Called automatically when threads created with orxThread_Start() stop, only needed for other threads that allocated memory with orx
+ */
+void orxFASTCALL orxMemory_ReleaseCache()
+{
+  /* Checks */
+  orxASSERT((sstMemory.u32Flags & orxMEMORY_KU32_STATIC_FLAG_READY) == orxMEMORY_KU32_STATIC_FLAG_READY);
+
+  /* Has cache? */
+  if((su32CacheIndex != 0) && (su32CacheIndex != orxMEMORY_KU32_CACHE_INDEX_NONE))
+  {
+    orxMEMORY_CACHE *pstCache;
+
+    /* Gets it */
+    pstCache = &(sstMemory.astCacheList[su32CacheIndex - 1]);
+
+    /* Releases its blocks (blocks still in use will be collected by the next thread claiming this cache) */
+    orxMemory_ReleaseCacheBlocks(pstCache);
+
+    /* Frees it */
+    orxMEMORY_BARRIER();
+    pstCache->u32Used = 0;
+  }
+
+  /* Resets cache index */
+  su32CacheIndex = 0;
+
+  /* Done! */
+  return;
+}
+
+/** Resets frame memory (orxMEMORY_TYPE_FRAME) of all threads: all frame allocations become invalid
+ * @note Called automatically at the end of orxClock_Update(), each thread's arena is then rewound upon its next frame allocation
+ */
+void orxFASTCALL orxMemory_ResetFrame()
+{
+  /* Checks */
+  orxASSERT((sstMemory.u32Flags & orxMEMORY_KU32_STATIC_FLAG_READY) == orxMEMORY_KU32_STATIC_FLAG_READY);
+
+  /* Updates frame count */
+  orxMEMORY_ATOMIC_ADD_U32(&(sstMemory.u32FrameCount), 1);
+
+#ifdef __orxPROFILER__
+
+  /* Resets frame memory tracker (peak values are kept as high-water marks) */
+  sstMemory.astMemoryTrackerList[orxMEMORY_TYPE_FRAME].u32Count = 0;
+  sstMemory.astMemoryTrackerList[orxMEMORY_TYPE_FRAME].u32Size  = 0;
+
+#endif /* __orxPROFILER__ */
+
+  /* Done! */
+  return;
+}
+
 /** Gets memory type literal name
  * @param[in] _eMemType               Concerned memory type
  * @return Memory type name
@@ -424,9 +1046,11 @@ const orxSTRING orxFASTCALL orxMemory_GetTypeName(orxMEMORY_TYPE _eMemType)
     orxMEMORY_DECLARE_TYPE_NAME(TEXT);
     orxMEMORY_DECLARE_TYPE_NAME(AUDIO);
     orxMEMORY_DECLARE_TYPE_NAME(PHYSICS);
+    orxMEMORY_DECLARE_TYPE_NAME(STRING);
     orxMEMORY_DECLARE_TYPE_NAME(SYSTEM);
     orxMEMORY_DECLARE_TYPE_NAME(TEMP);
     orxMEMORY_DECLARE_TYPE_NAME(DEBUG);
+    orxMEMORY_DECLARE_TYPE_NAME(FRAME);
     default:
     {
       /* Logs message */
@@ -34,11 +34,26 @@
 
 #include "debug/orxDebug.h"
 #include "debug/orxProfiler.h"
+#include "core/orxThread.h"
 #include "memory/orxMemory.h"
 #include "memory/orxBank.h"
 #include "object/orxStructure.h"
 #include "math/orxMath.h"
 
+#if defined(__orxX86_64__) || (defined(__orxX86__) && (defined(__SSE__) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 1))))
+
+  #include <xmmintrin.h>
+
+  #define __orxFRAME_SSE__
+
+#elif (defined(__orxARM__) || defined(__orxARM64__)) && (defined(__ARM_NEON) || defined(__ARM_NEON__))
+
+  #include <arm_neon.h>
+
+  #define __orxFRAME_NEON__
+
+#endif
+
 
 /** Module flags
  */
@@ -57,6 +72,7 @@
 #define orxFRAME_KU32_FLAG_NONE             0x00000000  /**< No flags */
 
 #define orxFRAME_KU32_FLAG_DATA_2D          0x10000000  /**< 2D ID flag */
+#define orxFRAME_KU32_FLAG_UPDATED          0x20000000  /**< Updated flag (ie. stored in update list) */
 
 #define orxFRAME_KU32_MASK_ALL              0xFFFFFFFF  /**< All mask */
 
@@ -64,6 +80,23 @@
 /** Misc defines
  */
 #define orxFRAME_KU32_BANK_SIZE             2048        /**< Bank size */
+#define orxFRAME_KU32_UPDATE_LIST_SIZE      1024        /**< Initial update list size */
+#define orxFRAME_KU32_BATCH_CHILD_NUMBER    256         /**< Minimum number of children for batch processing */
+#define orxFRAME_KU32_BATCH_SIZE            1024        /**< Initial batch size */
+#define orxFRAME_KU32_BATCH_LEVEL_SIZE      16          /**< Initial batch level size */
+#define orxFRAME_KU32_BATCH_CHUNK_SIZE      64          /**< Number of frames transformed at once */
+#define orxFRAME_KU32_BATCH_PARALLEL_NUMBER 1024        /**< Minimum number of frames in a level for parallel processing */
+#define orxFRAME_KU32_BATCH_PARALLEL_GRAIN  256         /**< Number of frames per parallel batch */
+
+#define orxFRAME_KU32_BATCH_DATA_X          0           /**< Batch global X array index */
+#define orxFRAME_KU32_BATCH_DATA_Y          1           /**< Batch global Y array index */
+#define orxFRAME_KU32_BATCH_DATA_Z          2           /**< Batch global Z array index */
+#define orxFRAME_KU32_BATCH_DATA_ROTATION   3           /**< Batch global rotation array index */
+#define orxFRAME_KU32_BATCH_DATA_SCALE_X    4           /**< Batch global X scale array index */
+#define orxFRAME_KU32_BATCH_DATA_SCALE_Y    5           /**< Batch global Y scale array index */
+#define orxFRAME_KU32_BATCH_DATA_COS        6           /**< Batch global rotation cosine array index */
+#define orxFRAME_KU32_BATCH_DATA_SIN        7           /**< Batch global rotation sine array index */
+#define orxFRAME_KU32_BATCH_DATA_NUMBER     8           /**< Batch global array number */
 
 #define orxFRAME_KZ_NONE                    "none"
 #define orxFRAME_KZ_ROTATION                "rotation"
@@ -107,6 +140,44 @@ struct __orxFRAME_t
   orxFRAME_DATA_2D  stData;                 /**< Frame data : 64 */
 };
 
+/** Batch structure: breadth-first flattened subtree, with its global data stored as arrays (SoA)
+ */
+typedef struct __orxFRAME_BATCH_t
+{
+  orxFRAME        **apstFrameList;          /**< Frame list, level by level : 4 */
+  orxU32           *au32ParentList;         /**< Parent index list : 8 */
+  orxU32           *au32LevelList;          /**< Level start index list (+ end sentinel) : 12 */
+  orxFLOAT         *afData;                 /**< Global data arrays, orxFRAME_KU32_BATCH_DATA_NUMBER * u32Size : 16 */
+  const orxFRAME   *pstRoot;                /**< Root frame : 20 */
+  orxU32            u32Count;               /**< Frame count : 24 */
+  orxU32            u32Size;                /**< Frame list size : 28 */
+  orxU32            u32LevelCount;          /**< Level count : 32 */
+  orxU32            u32LevelSize;           /**< Level list size : 36 */
+  orxU32            u32Generation;          /**< Tree generation it was built for : 40 */
+
+} orxFRAME_BATCH;
+
+/** Batch chunk structure: inputs of a batch transform
+ */
+typedef struct __orxFRAME_BATCH_CHUNK_t
+{
+  orxFLOAT  afLocalX[orxFRAME_KU32_BATCH_CHUNK_SIZE];
+  orxFLOAT  afLocalY[orxFRAME_KU32_BATCH_CHUNK_SIZE];
+  orxFLOAT  afLocalZ[orxFRAME_KU32_BATCH_CHUNK_SIZE];
+  orxFLOAT  afLocalRotation[orxFRAME_KU32_BATCH_CHUNK_SIZE];
+  orxFLOAT  afLocalScaleX[orxFRAME_KU32_BATCH_CHUNK_SIZE];
+  orxFLOAT  afLocalScaleY[orxFRAME_KU32_BATCH_CHUNK_SIZE];
+  orxFLOAT  afParentX[orxFRAME_KU32_BATCH_CHUNK_SIZE];
+  orxFLOAT  afParentY[orxFRAME_KU32_BATCH_CHUNK_SIZE];
+  orxFLOAT  afParentZ[orxFRAME_KU32_BATCH_CHUNK_SIZE];
+  orxFLOAT  afParentRotation[orxFRAME_KU32_BATCH_CHUNK_SIZE];
+  orxFLOAT  afParentScaleX[orxFRAME_KU32_BATCH_CHUNK_SIZE];
+  orxFLOAT  afParentScaleY[orxFRAME_KU32_BATCH_CHUNK_SIZE];
+  orxFLOAT  afParentCos[orxFRAME_KU32_BATCH_CHUNK_SIZE];
+  orxFLOAT  afParentSin[orxFRAME_KU32_BATCH_CHUNK_SIZE];
+
+} orxFRAME_BATCH_CHUNK;
+
 /** Static structure
  */
 typedef struct __orxFRAME_STATIC_t
@@ -114,6 +185,12 @@ typedef struct __orxFRAME_STATIC_t
   orxU32    u32Flags;                       /**< Control flags : 4 */
   orxFRAME *pstRoot;                        /**< Frame root : 8 */
   orxBANK  *pst2DDataBank;                  /**< 2D Data bank : 12 */
+  orxU64   *au64UpdateList;                 /**< Update list (frame GUIDs) : 16 */
+  orxU32    u32UpdateListSize;              /**< Update list size : 20 */
+  volatile orxU32 u32UpdateCount;           /**< Update count : 24 */
+  orxU32    u32Generation;                  /**< Tree generation (incremented on hierarchy changes) : 28 */
+  volatile orxU32 u32BatchLock;             /**< Batch lock : 32 */
+  orxFRAME_BATCH stBatch;                   /**< Batch : 72 */
 
 } orxFRAME_STATIC;
 
@@ -601,6 +678,34 @@ static orxINLINE orxVECTOR *orxFrame_FromGlobalToLocalScale(const orxFRAME *_pst
   return pvResult;
 }
 
+/** Adds a frame to the update list, if not already there
+ * @param[in]   _pstFrame       Concerned frame
+ */
+static orxINLINE void orxFrame_AddToUpdateList(orxFRAME *_pstFrame)
+{
+  /* Not already in update list? */
+  if(!orxStructure_TestFlags(_pstFrame, orxFRAME_KU32_FLAG_UPDATED))
+  {
+    orxU32 u32Index;
+
+    /* Updates flags */
+    orxStructure_SetFlags(_pstFrame, orxFRAME_KU32_FLAG_UPDATED, orxFRAME_KU32_FLAG_NONE);
+
+    /* Gets update index (frames can be processed concurrently) */
+    u32Index = orxMEMORY_ATOMIC_ADD_U32(&(sstFrame.u32UpdateCount), 1);
+
+    /* Enough room? */
+    if(u32Index < sstFrame.u32UpdateListSize)
+    {
+      /* Stores it */
+      sstFrame.au64UpdateList[u32Index] = orxStructure_GetGUID(_pstFrame);
+    }
+  }
+
+  /* Done! */
+  return;
+}
+
 /** Updates frame global data using parent's global and frame local ones
  * @param[out]  _pstFrame       Frame to update
  * @param[in]   _pstParent Parent frame to use for update
@@ -632,20 +737,625 @@ static orxINLINE void orxFrame_UpdateData(orxFRAME *_pstFrame, const orxFRAME *_
   _orxFrame_SetScale(_pstFrame, &vScale, orxFRAME_SPACE_GLOBAL);
   _orxFrame_SetPosition(_pstFrame, &vPos, orxFRAME_SPACE_GLOBAL);
 
+  /* Adds it to update list */
+  orxFrame_AddToUpdateList(_pstFrame);
+
+  /* Done! */
+  return;
+}
+
+/** Clears update flags of a frame and all its descendants
+ * @param[in]   _pstFrame       Concerned frame
+ */
+static void orxFASTCALL orxFrame_ClearUpdateFlags(orxFRAME *_pstFrame)
+{
+  orxFRAME *pstChild;
+
+  /* Updates flags */
+  orxStructure_SetFlags(_pstFrame, orxFRAME_KU32_FLAG_NONE, orxFRAME_KU32_FLAG_UPDATED);
+
+  /* For all children */
+  for(pstChild = orxFRAME(orxStructure_GetChild(_pstFrame));
+      pstChild != orxNULL;
+      pstChild = orxFRAME(orxStructure_GetSibling(pstChild)))
+  {
+    /* Clears its flags */
+    orxFrame_ClearUpdateFlags(pstChild);
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Gets cosine & sine of a global rotation, matching orxVector_2DRotate
+ * @param[in]   _fRotation      Rotation
+ * @param[in]   _fRefRotation   Reference rotation, whose cosine & sine are already known
+ * @param[in]   _fRefCos        Reference cosine
+ * @param[in]   _fRefSin        Reference sine
+ * @param[out]  _pfCos          Cosine
+ * @param[out]  _pfSin          Sine
+ */
+static orxINLINE void orxFrame_GetBatchCosSin(orxFLOAT _fRotation, orxFLOAT _fRefRotation, orxFLOAT _fRefCos, orxFLOAT _fRefSin, orxFLOAT *_pfCos, orxFLOAT *_pfSin)
+{
+  /* Same as reference (ie. no local rotation)? */
+  if(_fRotation == _fRefRotation)
+  {
+    *_pfCos = _fRefCos;
+    *_pfSin = _fRefSin;
+  }
+  /* No rotation? */
+  else if(_fRotation == orxFLOAT_0)
+  {
+    *_pfCos = orxFLOAT_1;
+    *_pfSin = orxFLOAT_0;
+  }
+  /* PI/2? */
+  else if(_fRotation == orxMATH_KF_PI_BY_2)
+  {
+    *_pfCos = orxFLOAT_0;
+    *_pfSin = orxFLOAT_1;
+  }
+  /* -PI/2? */
+  else if(_fRotation == -orxMATH_KF_PI_BY_2)
+  {
+    *_pfCos = orxFLOAT_0;
+    *_pfSin = -orxFLOAT_1;
+  }
+  else
+  {
+    *_pfCos = orxMath_Cos(_fRotation);
+    *_pfSin = orxMath_Sin(_fRotation);
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Transforms a chunk of frames that don't ignore any of their parent's data (same math as orxFrame_UpdateData)
+ * @param[in]   _pstChunk       Chunk inputs
+ * @param[in]   _u32Count       Number of frames in chunk
+ * @param[in]   _u32Index       Index of chunk's first frame in batch
+ */
+static orxINLINE void orxFrame_TransformBatchChunk(const orxFRAME_BATCH_CHUNK *_pstChunk, orxU32 _u32Count, orxU32 _u32Index)
+{
+  orxFLOAT *afX, *afY, *afZ, *afRotation, *afScaleX, *afScaleY;
+  orxU32    i = 0;
+
+  /* Gets output arrays */
+  afX         = sstFrame.stBatch.afData + (orxFRAME_KU32_BATCH_DATA_X * sstFrame.stBatch.u32Size) + _u32Index;
+  afY         = sstFrame.stBatch.afData + (orxFRAME_KU32_BATCH_DATA_Y * sstFrame.stBatch.u32Size) + _u32Index;
+  afZ         = sstFrame.stBatch.afData + (orxFRAME_KU32_BATCH_DATA_Z * sstFrame.stBatch.u32Size) + _u32Index;
+  afRotation  = sstFrame.stBatch.afData + (orxFRAME_KU32_BATCH_DATA_ROTATION * sstFrame.stBatch.u32Size) + _u32Index;
+  afScaleX    = sstFrame.stBatch.afData + (orxFRAME_KU32_BATCH_DATA_SCALE_X * sstFrame.stBatch.u32Size) + _u32Index;
+  afScaleY    = sstFrame.stBatch.afData + (orxFRAME_KU32_BATCH_DATA_SCALE_Y * sstFrame.stBatch.u32Size) + _u32Index;
+
+#if defined(__orxFRAME_SSE__)
+
+  /* For all quads */
+  for(; i + 4 <= _u32Count; i += 4)
+  {
+    __m128 vParentScaleX, vParentScaleY, vParentCos, vParentSin, vX, vY;
+
+    /* Loads parent's scale & rotation */
+    vParentScaleX = _mm_loadu_ps(_pstChunk->afParentScaleX + i);
+    vParentScaleY = _mm_loadu_ps(_pstChunk->afParentScaleY + i);
+    vParentCos    = _mm_loadu_ps(_pstChunk->afParentCos + i);
+    vParentSin    = _mm_loadu_ps(_pstChunk->afParentSin + i);
+
+    /* Scale */
+    _mm_storeu_ps(afScaleX + i, _mm_mul_ps(_mm_loadu_ps(_pstChunk->afLocalScaleX + i), vParentScaleX));
+    _mm_storeu_ps(afScaleY + i, _mm_mul_ps(_mm_loadu_ps(_pstChunk->afLocalScaleY + i), vParentScaleY));
+
+    /* Rotation */
+    _mm_storeu_ps(afRotation + i, _mm_add_ps(_mm_loadu_ps(_pstChunk->afLocalRotation + i), _mm_loadu_ps(_pstChunk->afParentRotation + i)));
+
+    /* Position: scale, rotation & translation */
+    vX = _mm_mul_ps(_mm_loadu_ps(_pstChunk->afLocalX + i), vParentScaleX);
+    vY = _mm_mul_ps(_mm_loadu_ps(_pstChunk->afLocalY + i), vParentScaleY);
+    _mm_storeu_ps(afX + i, _mm_add_ps(_mm_sub_ps(_mm_mul_ps(vParentCos, vX), _mm_mul_ps(vParentSin, vY)), _mm_loadu_ps(_pstChunk->afParentX + i)));
+    _mm_storeu_ps(afY + i, _mm_add_ps(_mm_add_ps(_mm_mul_ps(vParentSin, vX), _mm_mul_ps(vParentCos, vY)), _mm_loadu_ps(_pstChunk->afParentY + i)));
+    _mm_storeu_ps(afZ + i, _mm_add_ps(_mm_loadu_ps(_pstChunk->afLocalZ + i), _mm_loadu_ps(_pstChunk->afParentZ + i)));
+  }
+
+#elif defined(__orxFRAME_NEON__)
+
+  /* For all quads */
+  for(; i + 4 <= _u32Count; i += 4)
+  {
+    float32x4_t vParentScaleX, vParentScaleY, vParentCos, vParentSin, vX, vY;
+
+    /* Loads parent's scale & rotation */
+    vParentScaleX = vld1q_f32(_pstChunk->afParentScaleX + i);
+    vParentScaleY = vld1q_f32(_pstChunk->afParentScaleY + i);
+    vParentCos    = vld1q_f32(_pstChunk->afParentCos + i);
+    vParentSin    = vld1q_f32(_pstChunk->afParentSin + i);
+
+    /* Scale */
+    vst1q_f32(afScaleX + i, vmulq_f32(vld1q_f32(_pstChunk->afLocalScaleX + i), vParentScaleX));
+    vst1q_f32(afScaleY + i, vmulq_f32(vld1q_f32(_pstChunk->afLocalScaleY + i), vParentScaleY));
+
+    /* Rotation */
+    vst1q_f32(afRotation + i, vaddq_f32(vld1q_f32(_pstChunk->afLocalRotation + i), vld1q_f32(_pstChunk->afParentRotation + i)));
+
+    /* Position: scale, rotation & translation */
+    vX = vmulq_f32(vld1q_f32(_pstChunk->afLocalX + i), vParentScaleX);
+    vY = vmulq_f32(vld1q_f32(_pstChunk->afLocalY + i), vParentScaleY);
+    vst1q_f32(afX + i, vaddq_f32(vsubq_f32(vmulq_f32(vParentCos, vX), vmulq_f32(vParentSin, vY)), vld1q_f32(_pstChunk->afParentX + i)));
+    vst1q_f32(afY + i, vaddq_f32(vaddq_f32(vmulq_f32(vParentSin, vX), vmulq_f32(vParentCos, vY)), vld1q_f32(_pstChunk->afParentY + i)));
+    vst1q_f32(afZ + i, vaddq_f32(vld1q_f32(_pstChunk->afLocalZ + i), vld1q_f32(_pstChunk->afParentZ + i)));
+  }
+
+#endif /* __orxFRAME_SSE__ */
+
+  /* For all remaining frames */
+  for(; i < _u32Count; i++)
+  {
+    orxFLOAT fX, fY;
+
+    /* Scale */
+    afScaleX[i] = _pstChunk->afLocalScaleX[i] * _pstChunk->afParentScaleX[i];
+    afScaleY[i] = _pstChunk->afLocalScaleY[i] * _pstChunk->afParentScaleY[i];
+
+    /* Rotation */
+    afRotation[i] = _pstChunk->afLocalRotation[i] + _pstChunk->afParentRotation[i];
+
+    /* Position: scale, rotation & translation */
+    fX = _pstChunk->afLocalX[i] * _pstChunk->afParentScaleX[i];
+    fY = _pstChunk->afLocalY[i] * _pstChunk->afParentScaleY[i];
+    afX[i] = ((_pstChunk->afParentCos[i] * fX) - (_pstChunk->afParentSin[i] * fY)) + _pstChunk->afParentX[i];
+    afY[i] = ((_pstChunk->afParentSin[i] * fX) + (_pstChunk->afParentCos[i] * fY)) + _pstChunk->afParentY[i];
+    afZ[i] = _pstChunk->afLocalZ[i] + _pstChunk->afParentZ[i];
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Stores a batch frame's global data
+ * @param[in]   _u32Index       Index of frame in batch
+ */
+static orxINLINE void orxFrame_StoreBatchData(orxU32 _u32Index)
+{
+  orxFRAME       *pstFrame;
+  const orxFLOAT *afData;
+  orxU32          u32Size;
+
+  /* Gets frame, data & size */
+  pstFrame  = sstFrame.stBatch.apstFrameList[_u32Index];
+  afData    = sstFrame.stBatch.afData + _u32Index;
+  u32Size   = sstFrame.stBatch.u32Size;
+
+  /* Stores its global data */
+  pstFrame->stData.vGlobalPos.fX    = afData[orxFRAME_KU32_BATCH_DATA_X * u32Size];
+  pstFrame->stData.vGlobalPos.fY    = afData[orxFRAME_KU32_BATCH_DATA_Y * u32Size];
+  pstFrame->stData.vGlobalPos.fZ    = afData[orxFRAME_KU32_BATCH_DATA_Z * u32Size];
+  pstFrame->stData.fGlobalRotation  = afData[orxFRAME_KU32_BATCH_DATA_ROTATION * u32Size];
+  pstFrame->stData.fGlobalScaleX    = afData[orxFRAME_KU32_BATCH_DATA_SCALE_X * u32Size];
+  pstFrame->stData.fGlobalScaleY    = afData[orxFRAME_KU32_BATCH_DATA_SCALE_Y * u32Size];
+
+  /* Done! */
+  return;
+}
+
+/** Loads a batch frame's global data
+ * @param[in]   _u32Index       Index of frame in batch
+ */
+static orxINLINE void orxFrame_LoadBatchData(orxU32 _u32Index)
+{
+  const orxFRAME *pstFrame;
+  orxFLOAT       *afData;
+  orxU32          u32Size;
+
+  /* Gets frame, data & size */
+  pstFrame  = sstFrame.stBatch.apstFrameList[_u32Index];
+  afData    = sstFrame.stBatch.afData + _u32Index;
+  u32Size   = sstFrame.stBatch.u32Size;
+
+  /* Loads its global data */
+  afData[orxFRAME_KU32_BATCH_DATA_X * u32Size]        = pstFrame->stData.vGlobalPos.fX;
+  afData[orxFRAME_KU32_BATCH_DATA_Y * u32Size]        = pstFrame->stData.vGlobalPos.fY;
+  afData[orxFRAME_KU32_BATCH_DATA_Z * u32Size]        = pstFrame->stData.vGlobalPos.fZ;
+  afData[orxFRAME_KU32_BATCH_DATA_ROTATION * u32Size] = pstFrame->stData.fGlobalRotation;
+  afData[orxFRAME_KU32_BATCH_DATA_SCALE_X * u32Size]  = pstFrame->stData.fGlobalScaleX;
+  afData[orxFRAME_KU32_BATCH_DATA_SCALE_Y * u32Size]  = pstFrame->stData.fGlobalScaleY;
+
+  /* Done! */
+  return;
+}
+
+/** Processes a range of frames belonging to the same batch level (their parents having already been processed)
+ * @param[in]   _u32Start       Index of the first frame to process, relative to the level start
+ * @param[in]   _u32End         Index past the last frame to process, relative to the level start
+ * @param[in]   _pContext       Level start index
+ */
+static void orxFASTCALL orxFrame_ProcessBatchRange(orxU32 _u32Start, orxU32 _u32End, void *_pContext)
+{
+  orxFRAME_BATCH_CHUNK  stChunk;
+  const orxFLOAT       *afData;
+  orxU32                u32LevelStart, u32Size, u32Index;
+
+  /* Gets level start, data & size */
+  u32LevelStart = *(const orxU32 *)_pContext;
+  afData        = sstFrame.stBatch.afData;
+  u32Size       = sstFrame.stBatch.u32Size;
+
+  /* For all chunks */
+  for(u32Index = u32LevelStart + _u32Start; u32Index < u32LevelStart + _u32End; u32Index += orxFRAME_KU32_BATCH_CHUNK_SIZE)
+  {
+    orxU32 u32Count, i;
+
+    /* Gets chunk's frame count */
+    u32Count = orxMIN(orxFRAME_KU32_BATCH_CHUNK_SIZE, u32LevelStart + _u32End - u32Index);
+
+    /* Gathers local & parent's global data */
+    for(i = 0; i < u32Count; i++)
+    {
+      const orxFRAME *pstFrame;
+      orxU32          u32Parent;
+
+      /* Gets frame & its parent index */
+      pstFrame  = sstFrame.stBatch.apstFrameList[u32Index + i];
+      u32Parent = sstFrame.stBatch.au32ParentList[u32Index + i];
+
+      /* Gathers its data */
+      stChunk.afLocalX[i]         = pstFrame->stData.vLocalPos.fX;
+      stChunk.afLocalY[i]         = pstFrame->stData.vLocalPos.fY;
+      stChunk.afLocalZ[i]         = pstFrame->stData.vLocalPos.fZ;
+      stChunk.afLocalRotation[i]  = pstFrame->stData.fLocalRotation;
+      stChunk.afLocalScaleX[i]    = pstFrame->stData.fLocalScaleX;
+      stChunk.afLocalScaleY[i]    = pstFrame->stData.fLocalScaleY;
+      stChunk.afParentX[i]        = afData[(orxFRAME_KU32_BATCH_DATA_X * u32Size) + u32Parent];
+      stChunk.afParentY[i]        = afData[(orxFRAME_KU32_BATCH_DATA_Y * u32Size) + u32Parent];
+      stChunk.afParentZ[i]        = afData[(orxFRAME_KU32_BATCH_DATA_Z * u32Size) + u32Parent];
+      stChunk.afParentRotation[i] = afData[(orxFRAME_KU32_BATCH_DATA_ROTATION * u32Size) + u32Parent];
+      stChunk.afParentScaleX[i]   = afData[(orxFRAME_KU32_BATCH_DATA_SCALE_X * u32Size) + u32Parent];
+      stChunk.afParentScaleY[i]   = afData[(orxFRAME_KU32_BATCH_DATA_SCALE_Y * u32Size) + u32Parent];
+      stChunk.afParentCos[i]      = afData[(orxFRAME_KU32_BATCH_DATA_COS * u32Size) + u32Parent];
+      stChunk.afParentSin[i]      = afData[(orxFRAME_KU32_BATCH_DATA_SIN * u32Size) + u32Parent];
+    }
+
+    /* Transforms them */
+    orxFrame_TransformBatchChunk(&stChunk, u32Count, u32Index);
+
+    /* For all frames in chunk */
+    for(i = 0; i < u32Count; i++)
+    {
+      orxFRAME *pstFrame;
+      orxFLOAT *pfCos, *pfSin;
+
+      /* Gets frame */
+      pstFrame = sstFrame.stBatch.apstFrameList[u32Index + i];
+
+      /* Ignores some of its parent's data? */
+      if(orxStructure_TestFlags(pstFrame, orxFRAME_KU32_MASK_IGNORE_ALL))
+      {
+        /* Updates it the regular way (its parent has already been stored) */
+        orxFrame_UpdateData(pstFrame, orxFRAME(orxStructure_GetParent(pstFrame)));
+
+        /* Loads its global data back */
+        orxFrame_LoadBatchData(u32Index + i);
+      }
+      else
+      {
+        /* Stores its global data */
+        orxFrame_StoreBatchData(u32Index + i);
+
+        /* Adds it to update list */
+        orxFrame_AddToUpdateList(pstFrame);
+      }
+
+      /* Updates its cosine & sine, for its children */
+      pfCos = sstFrame.stBatch.afData + (orxFRAME_KU32_BATCH_DATA_COS * u32Size) + u32Index + i;
+      pfSin = sstFrame.stBatch.afData + (orxFRAME_KU32_BATCH_DATA_SIN * u32Size) + u32Index + i;
+      orxFrame_GetBatchCosSin(afData[(orxFRAME_KU32_BATCH_DATA_ROTATION * u32Size) + u32Index + i], stChunk.afParentRotation[i], stChunk.afParentCos[i], stChunk.afParentSin[i], pfCos, pfSin);
+    }
+  }
+
   /* Done! */
   return;
 }
 
+/** Resizes batch storage
+ * @param[in]   _u32Size        New size
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+static orxSTATUS orxFASTCALL orxFrame_ResizeBatch(orxU32 _u32Size)
+{
+  orxFRAME  **apstFrameList;
+  orxU32     *au32ParentList;
+  orxFLOAT   *afData;
+  orxSTATUS   eResult = orxSTATUS_FAILURE;
+
+  /* Allocates new storage */
+  apstFrameList   = (orxFRAME **)orxMemory_Allocate(_u32Size * sizeof(orxFRAME *), orxMEMORY_TYPE_MAIN);
+  au32ParentList  = (orxU32 *)orxMemory_Allocate(_u32Size * sizeof(orxU32), orxMEMORY_TYPE_MAIN);
+  afData          = (orxFLOAT *)orxMemory_Allocate(orxFRAME_KU32_BATCH_DATA_NUMBER * _u32Size * sizeof(orxFLOAT), orxMEMORY_TYPE_MAIN);
+
+  /* Success? */
+  if((apstFrameList != orxNULL) && (au32ParentList != orxNULL) && (afData != orxNULL))
+  {
+    /* Had previous storage? */
+    if(sstFrame.stBatch.apstFrameList != orxNULL)
+    {
+      /* Copies lists (data arrays don't need to be preserved) */
+      orxMemory_Copy(apstFrameList, sstFrame.stBatch.apstFrameList, sstFrame.stBatch.u32Count * sizeof(orxFRAME *));
+      orxMemory_Copy(au32ParentList, sstFrame.stBatch.au32ParentList, sstFrame.stBatch.u32Count * sizeof(orxU32));
+
+      /* Frees them */
+      orxMemory_Free(sstFrame.stBatch.apstFrameList);
+      orxMemory_Free(sstFrame.stBatch.au32ParentList);
+      orxMemory_Free(sstFrame.stBatch.afData);
+    }
+
+    /* Stores new ones */
+    sstFrame.stBatch.apstFrameList  = apstFrameList;
+    sstFrame.stBatch.au32ParentList = au32ParentList;
+    sstFrame.stBatch.afData         = afData;
+    sstFrame.stBatch.u32Size        = _u32Size;
+
+    /* Updates result */
+    eResult = orxSTATUS_SUCCESS;
+  }
+  else
+  {
+    /* Frees partial allocations */
+    if(apstFrameList != orxNULL)
+    {
+      orxMemory_Free(apstFrameList);
+    }
+    if(au32ParentList != orxNULL)
+    {
+      orxMemory_Free(au32ParentList);
+    }
+    if(afData != orxNULL)
+    {
+      orxMemory_Free(afData);
+    }
+
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_OBJECT, "Couldn't resize frame batch to <%u> frames.", _u32Size);
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Adds a level to the batch
+ * @param[in]   _u32Start       Index of the level's first frame
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+static orxSTATUS orxFASTCALL orxFrame_AddBatchLevel(orxU32 _u32Start)
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Not enough room (keeping one for the end sentinel)? */
+  if(sstFrame.stBatch.u32LevelCount + 1 >= sstFrame.stBatch.u32LevelSize)
+  {
+    orxU32 *au32LevelList;
+    orxU32  u32Size;
+
+    /* Gets new size */
+    u32Size = (sstFrame.stBatch.u32LevelSize != 0) ? sstFrame.stBatch.u32LevelSize << 1 : orxFRAME_KU32_BATCH_LEVEL_SIZE;
+
+    /* Allocates new list */
+    au32LevelList = (orxU32 *)orxMemory_Allocate(u32Size * sizeof(orxU32), orxMEMORY_TYPE_MAIN);
+
+    /* Success? */
+    if(au32LevelList != orxNULL)
+    {
+      /* Had a previous list? */
+      if(sstFrame.stBatch.au32LevelList != orxNULL)
+      {
+        /* Copies it */
+        orxMemory_Copy(au32LevelList, sstFrame.stBatch.au32LevelList, sstFrame.stBatch.u32LevelCount * sizeof(orxU32));
+
+        /* Frees it */
+        orxMemory_Free(sstFrame.stBatch.au32LevelList);
+      }
+
+      /* Stores new one */
+      sstFrame.stBatch.au32LevelList  = au32LevelList;
+      sstFrame.stBatch.u32LevelSize   = u32Size;
+    }
+    else
+    {
+      /* Updates result */
+      eResult = orxSTATUS_FAILURE;
+    }
+  }
+
+  /* Valid? */
+  if(eResult != orxSTATUS_FAILURE)
+  {
+    /* Stores level start & end sentinel */
+    sstFrame.stBatch.au32LevelList[sstFrame.stBatch.u32LevelCount++] = _u32Start;
+    sstFrame.stBatch.au32LevelList[sstFrame.stBatch.u32LevelCount]   = sstFrame.stBatch.u32Count;
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Builds the batch of a frame's subtree, level by level
+ * @param[in]   _pstFrame       Batch root frame
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+static orxSTATUS orxFASTCALL orxFrame_BuildBatch(orxFRAME *_pstFrame)
+{
+  orxU32    u32Start, u32End;
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Invalidates current batch */
+  sstFrame.stBatch.pstRoot        = orxNULL;
+  sstFrame.stBatch.u32Count       = 0;
+  sstFrame.stBatch.u32LevelCount  = 0;
+
+  /* No storage yet? */
+  if(sstFrame.stBatch.u32Size == 0)
+  {
+    /* Allocates it */
+    eResult = orxFrame_ResizeBatch(orxFRAME_KU32_BATCH_SIZE);
+  }
+
+  /* Valid? */
+  if(eResult != orxSTATUS_FAILURE)
+  {
+    /* Adds root */
+    sstFrame.stBatch.apstFrameList[0]   = _pstFrame;
+    sstFrame.stBatch.au32ParentList[0]  = orxU32_UNDEFINED;
+    sstFrame.stBatch.u32Count           = 1;
+
+    /* For all levels */
+    for(u32Start = 0, u32End = 1;
+        (eResult != orxSTATUS_FAILURE) && (u32Start < u32End);
+        u32Start = u32End, u32End = sstFrame.stBatch.u32Count)
+    {
+      orxU32 i;
+
+      /* Adds level */
+      eResult = orxFrame_AddBatchLevel(u32Start);
+
+      /* For all its frames */
+      for(i = u32Start; (eResult != orxSTATUS_FAILURE) && (i < u32End); i++)
+      {
+        orxFRAME *pstChild;
+
+        /* For all their children */
+        for(pstChild = orxFRAME(orxStructure_GetChild(sstFrame.stBatch.apstFrameList[i]));
+            pstChild != orxNULL;
+            pstChild = orxFRAME(orxStructure_GetSibling(pstChild)))
+        {
+          /* Full? */
+          if(sstFrame.stBatch.u32Count == sstFrame.stBatch.u32Size)
+          {
+            /* Grows storage */
+            if(orxFrame_ResizeBatch(sstFrame.stBatch.u32Size << 1) == orxSTATUS_FAILURE)
+            {
+              /* Updates result */
+              eResult = orxSTATUS_FAILURE;
+              break;
+            }
+          }
+
+          /* Adds it */
+          sstFrame.stBatch.apstFrameList[sstFrame.stBatch.u32Count]  = pstChild;
+          sstFrame.stBatch.au32ParentList[sstFrame.stBatch.u32Count] = i;
+          sstFrame.stBatch.u32Count++;
+        }
+      }
+    }
+
+    /* Success? */
+    if(eResult != orxSTATUS_FAILURE)
+    {
+      /* Stores root & generation */
+      sstFrame.stBatch.pstRoot        = _pstFrame;
+      sstFrame.stBatch.u32Generation  = sstFrame.u32Generation;
+    }
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Processes a frame's subtree as a batch, level by level, transforming frames in contiguous chunks (the frame itself has already been updated)
+ * @param[in]   _pstFrame       Batch root frame
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+static orxSTATUS orxFASTCALL orxFrame_ProcessBatch(orxFRAME *_pstFrame)
+{
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  /* Not already processing a batch (from another thread)? */
+  if(orxMEMORY_ATOMIC_CAS_U32(&(sstFrame.u32BatchLock), 0, 1) != orxFALSE)
+  {
+    /* Is cached batch still valid? */
+    if((sstFrame.stBatch.pstRoot == _pstFrame)
+    && (sstFrame.stBatch.u32Generation == sstFrame.u32Generation))
+    {
+      /* Updates result */
+      eResult = orxSTATUS_SUCCESS;
+    }
+    else
+    {
+      /* Profiles */
+      orxPROFILER_PUSH_MARKER("orxFrame_BuildBatch");
+
+      /* Builds it */
+      eResult = orxFrame_BuildBatch(_pstFrame);
+
+      /* Profiles */
+      orxPROFILER_POP_MARKER();
+    }
+
+    /* Valid? */
+    if(eResult != orxSTATUS_FAILURE)
+    {
+      orxU32 i;
+
+      /* Loads root's global data */
+      orxFrame_LoadBatchData(0);
+      orxFrame_GetBatchCosSin(_pstFrame->stData.fGlobalRotation, orxFLOAT_0, orxFLOAT_1, orxFLOAT_0, &(sstFrame.stBatch.afData[orxFRAME_KU32_BATCH_DATA_COS * sstFrame.stBatch.u32Size]), &(sstFrame.stBatch.afData[orxFRAME_KU32_BATCH_DATA_SIN * sstFrame.stBatch.u32Size]));
+
+      /* For all levels below root */
+      for(i = 1; i < sstFrame.stBatch.u32LevelCount; i++)
+      {
+        orxU32 u32LevelStart, u32LevelCount;
+
+        /* Gets level start & count */
+        u32LevelStart = sstFrame.stBatch.au32LevelList[i];
+        u32LevelCount = sstFrame.stBatch.au32LevelList[i + 1] - u32LevelStart;
+
+        /* Large enough for parallel processing? */
+        if(u32LevelCount >= orxFRAME_KU32_BATCH_PARALLEL_NUMBER)
+        {
+          /* Processes it in parallel (frames of a level are independent) */
+          orxThread_ParallelFor(u32LevelCount, orxFRAME_KU32_BATCH_PARALLEL_GRAIN, orxFrame_ProcessBatchRange, &u32LevelStart);
+        }
+        else
+        {
+          /* Processes it */
+          orxFrame_ProcessBatchRange(0, u32LevelCount, &u32LevelStart);
+        }
+      }
+    }
+
+    /* Releases lock */
+    orxMEMORY_ATOMIC_CAS_U32(&(sstFrame.u32BatchLock), 1, 0);
+  }
+
+  /* Done! */
+  return eResult;
+}
+
 /** Processes a frame
  * @param[in]   _pstFrame       Concerned frame
  */
 static void orxFASTCALL orxFrame_Process(orxFRAME *_pstFrame, const orxFRAME *_pstParent)
 {
   orxFRAME *pstChild;
+  orxU32    u32ChildCount;
 
   /* Updates frame's data */
   orxFrame_UpdateData(_pstFrame, _pstParent);
 
+  /* Counts children */
+  for(pstChild = orxFRAME(orxStructure_GetChild(_pstFrame)), u32ChildCount = 0;
+      (pstChild != orxNULL) && (u32ChildCount < orxFRAME_KU32_BATCH_CHILD_NUMBER);
+      pstChild = orxFRAME(orxStructure_GetSibling(pstChild)), u32ChildCount++);
+
+  /* Enough for batch processing or already batched? */
+  if((u32ChildCount >= orxFRAME_KU32_BATCH_CHILD_NUMBER)
+  || ((sstFrame.stBatch.pstRoot == _pstFrame) && (sstFrame.stBatch.u32Generation == sstFrame.u32Generation)))
+  {
+    /* Success? */
+    if(orxFrame_ProcessBatch(_pstFrame) != orxSTATUS_FAILURE)
+    {
+      /* Done! */
+      return;
+    }
+  }
+
   /* For all children */
   for(pstChild = orxFRAME(orxStructure_GetChild(_pstFrame));
       pstChild != orxNULL;
@@ -850,6 +1560,7 @@ void orxFASTCALL orxFrame_Setup()
   orxModule_AddDependency(orxMODULE_ID_FRAME, orxMODULE_ID_MEMORY);
   orxModule_AddDependency(orxMODULE_ID_FRAME, orxMODULE_ID_STRUCTURE);
   orxModule_AddDependency(orxMODULE_ID_FRAME, orxMODULE_ID_PROFILER);
+  orxModule_AddDependency(orxMODULE_ID_FRAME, orxMODULE_ID_THREAD);
 
   /* Done! */
   return;
@@ -877,6 +1588,12 @@ orxSTATUS orxFASTCALL orxFrame_Init()
     /* Successful? */
     if(eResult != orxSTATUS_FAILURE)
     {
+      /* Allocates update list */
+      sstFrame.au64UpdateList = (orxU64 *)orxMemory_Allocate(orxFRAME_KU32_UPDATE_LIST_SIZE * sizeof(orxU64), orxMEMORY_TYPE_MAIN);
+
+      /* Stores its size (frames will simply get untracked when it's missing) */
+      sstFrame.u32UpdateListSize = (sstFrame.au64UpdateList != orxNULL) ? orxFRAME_KU32_UPDATE_LIST_SIZE : 0;
+
       /* Inits frame tree */
       sstFrame.pstRoot = orxFrame_Create(orxFRAME_KU32_FLAG_NONE);
 
@@ -891,6 +1608,13 @@ orxSTATUS orxFASTCALL orxFrame_Init()
       }
       else
       {
+        /* Deletes update list */
+        if(sstFrame.au64UpdateList != orxNULL)
+        {
+          orxMemory_Free(sstFrame.au64UpdateList);
+          sstFrame.au64UpdateList = orxNULL;
+        }
+
         /* Unregister structure type */
         orxStructure_Unregister(orxSTRUCTURE_ID_FRAME);
 
@@ -925,6 +1649,26 @@ void orxFASTCALL orxFrame_Exit()
     /* Deletes frame tree */
     orxFrame_DeleteAll();
 
+    /* Deletes update list */
+    if(sstFrame.au64UpdateList != orxNULL)
+    {
+      orxMemory_Free(sstFrame.au64UpdateList);
+      sstFrame.au64UpdateList = orxNULL;
+    }
+
+    /* Deletes batch storage */
+    if(sstFrame.stBatch.apstFrameList != orxNULL)
+    {
+      orxMemory_Free(sstFrame.stBatch.apstFrameList);
+      orxMemory_Free(sstFrame.stBatch.au32ParentList);
+      orxMemory_Free(sstFrame.stBatch.afData);
+    }
+    if(sstFrame.stBatch.au32LevelList != orxNULL)
+    {
+      orxMemory_Free(sstFrame.stBatch.au32LevelList);
+    }
+    orxMemory_Zero(&(sstFrame.stBatch), sizeof(orxFRAME_BATCH));
+
     /* Unregisters structure type */
     orxStructure_Unregister(orxSTRUCTURE_ID_FRAME);
 
@@ -1009,6 +1753,9 @@ orxSTATUS orxFASTCALL orxFrame_Delete(orxFRAME *_pstFrame)
   /* Not referenced? */
   if(orxStructure_GetRefCount(_pstFrame) == 0)
   {
+    /* Updates tree generation */
+    sstFrame.u32Generation++;
+
     /* Deletes structure */
     orxStructure_Delete(_pstFrame);
   }
@@ -1041,6 +1788,9 @@ void orxFASTCALL orxFrame_SetParent(orxFRAME *_pstFrame, orxFRAME *_pstParent)
       /* Root is parent */
       orxStructure_SetParent(_pstFrame, sstFrame.pstRoot);
 
+      /* Updates tree generation */
+      sstFrame.u32Generation++;
+
       /* Profiles */
       orxPROFILER_PUSH_MARKER("orxFrame_Process");
 
@@ -1059,6 +1809,9 @@ void orxFASTCALL orxFrame_SetParent(orxFRAME *_pstFrame, orxFRAME *_pstParent)
       /* Sets parent */
       orxStructure_SetParent(_pstFrame, _pstParent);
 
+      /* Updates tree generation */
+      sstFrame.u32Generation++;
+
       /* Profiles */
       orxPROFILER_PUSH_MARKER("orxFrame_Process");
 
@@ -1488,3 +2241,77 @@ orxVECTOR *orxFASTCALL orxFrame_TransformScale(orxFRAME *_pstFrame, orxFRAME_SPA
   /* Done! */
   return pvResult;
 }
+
+/** Flushes the list of frames whose global data has been updated since the previous flush
+ * @param[in]   _pfnCallback    Function called once for every updated frame, must not modify any frame
+ * @param[in]   _pContext       Context sent to the callback
+ * @return      orxSTATUS_SUCCESS / orxSTATUS_FAILURE if some updated frames couldn't be tracked (all frames should then be considered as updated)
+ */
+orxSTATUS orxFASTCALL orxFrame_FlushUpdateList(const orxFRAME_UPDATE_FUNCTION _pfnCallback, void *_pContext)
+{
+  orxU32    u32Count, i;
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT(sstFrame.u32Flags & orxFRAME_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pfnCallback != orxNULL);
+
+  /* Gets update count */
+  u32Count = sstFrame.u32UpdateCount;
+
+  /* For all stored frames */
+  for(i = 0; i < orxMIN(u32Count, sstFrame.u32UpdateListSize); i++)
+  {
+    orxFRAME *pstFrame;
+
+    /* Gets frame */
+    pstFrame = orxFRAME(orxStructure_Get(sstFrame.au64UpdateList[i]));
+
+    /* Still valid? */
+    if(pstFrame != orxNULL)
+    {
+      /* Updates flags */
+      orxStructure_SetFlags(pstFrame, orxFRAME_KU32_FLAG_NONE, orxFRAME_KU32_FLAG_UPDATED);
+
+      /* Calls callback */
+      _pfnCallback(pstFrame, _pContext);
+    }
+  }
+
+  /* Some frames weren't stored? */
+  if(u32Count > sstFrame.u32UpdateListSize)
+  {
+    orxU64 *au64UpdateList;
+    orxU32  u32Size;
+
+    /* Clears all update flags */
+    orxFrame_ClearUpdateFlags(sstFrame.pstRoot);
+
+    /* Gets new size */
+    u32Size = orxMath_GetNextPowerOfTwo(u32Count);
+
+    /* Allocates new list */
+    au64UpdateList = (orxU64 *)orxMemory_Allocate(u32Size * sizeof(orxU64), orxMEMORY_TYPE_MAIN);
+
+    /* Success? */
+    if(au64UpdateList != orxNULL)
+    {
+      /* Replaces current list */
+      if(sstFrame.au64UpdateList != orxNULL)
+      {
+        orxMemory_Free(sstFrame.au64UpdateList);
+      }
+      sstFrame.au64UpdateList     = au64UpdateList;
+      sstFrame.u32UpdateListSize  = u32Size;
+    }
+
+    /* Updates result */
+    eResult = orxSTATUS_FAILURE;
+  }
+
+  /* Clears update count */
+  sstFrame.u32UpdateCount = 0;
+
+  /* Done! */
+  return eResult;
+}
@@ -80,10 +80,14 @@
 #define orxOBJECT_KU32_FLAG_SPAWNER_LIFETIME    0x00010000  /**< Spawner lifetime flag  */
 #define orxOBJECT_KU32_FLAG_TIMELINE_LIFETIME   0x00020000  /**< Timeline lifetime flag  */
 #define orxOBJECT_KU32_FLAG_CHILDREN_LIFETIME   0x00040000  /**< Children lifetime flag  */
+#define orxOBJECT_KU32_FLAG_IDLE                0x00080000  /**< Idle flag (not ticked, active time is relative to the idle time) */
 
 #define orxOBJECT_KU32_MASK_STRUCTURE_LIFETIME  0x00C70000  /**< Structure lifetime mask */
 #define orxOBJECT_KU32_MASK_LINKED_STRUCTURE    0x0000FFFF  /**< Linked structure mask */
 
+#define orxOBJECT_KU32_MASK_UPDATE_STRUCTURE    ((1 << orxSTRUCTURE_ID_ANIMPOINTER) | (1 << orxSTRUCTURE_ID_CLOCK) | (1 << orxSTRUCTURE_ID_FXPOINTER) | (1 << orxSTRUCTURE_ID_SOUNDPOINTER) | (1 << orxSTRUCTURE_ID_SPAWNER) | (1 << orxSTRUCTURE_ID_TIMELINE)) /**< Structures that need to be updated */
+#define orxOBJECT_KU32_MASK_UPDATE              (orxOBJECT_KU32_MASK_UPDATE_STRUCTURE | orxOBJECT_KU32_MASK_STRUCTURE_LIFETIME | orxOBJECT_KU32_FLAG_HAS_LIFETIME | orxOBJECT_KU32_FLAG_DEATH_ROW | orxOBJECT_KU32_FLAG_DETACH_JOINT_CHILD) /**< Update mask */
+
 #define orxOBJECT_KU32_MASK_ALL                 0xFFFFFFFF  /**< All mask */
 
 
@@ -104,6 +108,16 @@
 #define orxOBJECT_KU32_GROUP_BANK_SIZE          64
 #define orxOBJECT_KU32_GROUP_TABLE_SIZE         64
 
+#define orxOBJECT_KU32_INDEX_CELL_BANK_SIZE     256
+#define orxOBJECT_KU32_INDEX_TABLE_SIZE         1024
+#define orxOBJECT_KU32_INDEX_FRAME_TABLE_SIZE   2048
+#define orxOBJECT_KU32_INDEX_LIST_SIZE          256
+#define orxOBJECT_KU32_INDEX_SORT_BITS          8
+#define orxOBJECT_KF_INDEX_CELL_SIZE            orx2F(256.0f)
+
+#define orxOBJECT_KZ_CONFIG_SECTION             "Object"
+#define orxOBJECT_KZ_CONFIG_INDEX_CELL_SIZE     "IndexCellSize"
+
 #define orxOBJECT_KZ_CONFIG_GRAPHIC_NAME        "Graphic"
 #define orxOBJECT_KZ_CONFIG_ANIMPOINTER_NAME    "AnimationSet"
 #define orxOBJECT_KZ_CONFIG_BODY                "Body"
@@ -222,8 +236,21 @@ struct __orxOBJECT_t
   orxVECTOR         vSize;                      /**< Object size : 144 */
   orxVECTOR         vPivot;                     /**< Object pivot : 156 */
   orxLINKLIST_NODE  stGroupNode;                /**< Group node: 176 */
+  orxLINKLIST_NODE  stIndexNode;                /**< Index node: 188 */
+  orxLINKLIST_NODE  stActiveNode;               /**< Active node: 200 */
+  orxU32            u32GroupIndex;              /**< Group index: 204 */
+  orxDOUBLE         dIdleStart;                 /**< Idle start time: 212 */
 };
 
+/** Index cell structure
+ */
+typedef struct __orxOBJECT_INDEX_CELL_t
+{
+  orxLINKLIST       stObjectList;               /**< Object list : 12 */
+  orxU64            u64Key;                     /**< Cell key : 20 */
+
+} orxOBJECT_INDEX_CELL;
+
 /** Static structure
  */
 typedef struct __orxOBJECT_STATIC_t
@@ -231,12 +258,24 @@ typedef struct __orxOBJECT_STATIC_t
   orxCLOCK     *pstClock;                       /**< Clock */
   orxBANK      *pstGroupBank;                   /**< Group bank */
   orxBANK      *pstAgeBank;                     /**< Age bank */
+  orxBANK      *pstIndexCellBank;               /**< Index cell bank */
   orxHASHTABLE *pstGroupTable;                  /**< Group table */
+  orxHASHTABLE *pstIndexTable;                  /**< Index table */
+  orxHASHTABLE *pstIndexFrameTable;             /**< Index frame table */
   orxLINKLIST  *pstCachedGroupList;             /**< Cached group list */
+  orxLINKLIST   stActiveList;                   /**< Active object list */
   orxOBJECT    *pstCurrentObject;               /**< Current object */
+  orxOBJECT   **apstIndexList;                  /**< Index query list */
+  orxOBJECT   **apstIndexSortBuffer;            /**< Index sort buffer */
+  orxU32        u32IndexListSize;               /**< Index query list size */
+  orxU32        u32IndexSortBufferSize;         /**< Index sort buffer size */
+  orxFLOAT      fIndexCellSize;                 /**< Index cell size */
+  orxFLOAT      fIndexRecCellSize;              /**< Index reciprocal cell size */
+  orxDOUBLE     dIdleTime;                      /**< Idle time */
   orxSTRINGID   stDefaultGroupID;               /**< Default group ID */
   orxSTRINGID   stCurrentGroupID;               /**< Current group ID */
   orxSTRINGID   stCachedGroupID;                /**< Cached group ID */
+  orxU32        u32GroupIndex;                  /**< Group index counter */
   orxU32        u32Flags;                       /**< Control flags */
 
 } orxOBJECT_STATIC;
@@ -255,6 +294,518 @@ static orxOBJECT_STATIC sstObject;
  * Private functions                                                       *
  ***************************************************************************/
 
+/** Does an object need to be updated every tick?
+ * @param[in]   _pstObject      Concerned object
+ * @return      orxTRUE / orxFALSE
+ */
+static orxINLINE orxBOOL orxObject_NeedsUpdate(const orxOBJECT *_pstObject)
+{
+  orxBOOL bResult;
+
+  /* Updates result */
+  bResult = (orxStructure_TestFlags(_pstObject, orxOBJECT_KU32_MASK_UPDATE)
+          || (orxVector_IsNull(&(_pstObject->vSpeed)) == orxFALSE)
+          || (_pstObject->fAngularVelocity != orxFLOAT_0)) ? orxTRUE : orxFALSE;
+
+  /* Done! */
+  return bResult;
+}
+
+/** Updates an object's activity: objects that need to be updated get added to the active list, the others get their active time tracked through the idle time
+ * Objects are only removed from the active list during their update
+ * @param[in]   _pstObject      Concerned object
+ */
+static void orxFASTCALL orxObject_UpdateActivity(orxOBJECT *_pstObject)
+{
+  /* Was idle? */
+  if(orxStructure_TestFlags(_pstObject, orxOBJECT_KU32_FLAG_IDLE))
+  {
+    /* Adds its idle duration to its active time */
+    _pstObject->fActiveTime += (orxFLOAT)(sstObject.dIdleTime - _pstObject->dIdleStart);
+
+    /* Updates status */
+    orxStructure_SetFlags(_pstObject, orxOBJECT_KU32_FLAG_NONE, orxOBJECT_KU32_FLAG_IDLE);
+  }
+
+  /* Needs update? */
+  if(orxObject_NeedsUpdate(_pstObject) != orxFALSE)
+  {
+    /* Not active yet? */
+    if(orxLinkList_GetList(&(_pstObject->stActiveNode)) == orxNULL)
+    {
+      /* Adds it to the active list */
+      orxLinkList_AddEnd(&(sstObject.stActiveList), &(_pstObject->stActiveNode));
+    }
+  }
+  /* Not active, enabled and not paused? */
+  else if((orxLinkList_GetList(&(_pstObject->stActiveNode)) == orxNULL)
+       && (orxStructure_GetFlags(_pstObject, orxOBJECT_KU32_FLAG_ENABLED | orxOBJECT_KU32_FLAG_PAUSED) == orxOBJECT_KU32_FLAG_ENABLED))
+  {
+    /* Stores its idle start time */
+    _pstObject->dIdleStart = sstObject.dIdleTime;
+
+    /* Updates status */
+    orxStructure_SetFlags(_pstObject, orxOBJECT_KU32_FLAG_IDLE, orxOBJECT_KU32_FLAG_NONE);
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Gets index key of a grid cell (the unbounded cell of a group uses the group ID as key)
+ * @param[in]   _stGroupID      Group ID
+ * @param[in]   _s32X           Cell X coordinate
+ * @param[in]   _s32Y           Cell Y coordinate
+ * @return      Cell key
+ */
+static orxINLINE orxU64 orxObject_GetIndexKey(orxSTRINGID _stGroupID, orxS32 _s32X, orxS32 _s32Y)
+{
+  /* Done! */
+  return ((orxU64)_stGroupID << 32) | ((orxU64)((orxU32)_s32X & 0xFFFF) << 16) | (orxU64)((orxU32)_s32Y & 0xFFFF);
+}
+
+/** Gets the radius of a circle centered on an object's position that contains the bounding circle of its box
+ * @param[in]   _pvSize         Size
+ * @param[in]   _pvPivot        Pivot
+ * @return      Radius
+ */
+static orxINLINE orxFLOAT orxObject_GetIndexExtent(const orxVECTOR *_pvSize, const orxVECTOR *_pvPivot)
+{
+  orxFLOAT fX, fY;
+
+  /* Gets box center offset */
+  fX = orx2F(0.5f) * _pvSize->fX - _pvPivot->fX;
+  fY = orx2F(0.5f) * _pvSize->fY - _pvPivot->fY;
+
+  /* Done! */
+  return orxMath_Sqrt((fX * fX) + (fY * fY)) + orx2F(0.5f) * orxMath_Sqrt((_pvSize->fX * _pvSize->fX) + (_pvSize->fY * _pvSize->fY));
+}
+
+/** Gets the radius of an object around its position, for indexing purposes
+ * @param[in]   _pstObject      Concerned object
+ * @param[in]   _pstFrame       Object's frame
+ * @return      Radius, orxFLOAT_MAX if unbounded
+ */
+static orxFLOAT orxFASTCALL orxObject_GetIndexRadius(const orxOBJECT *_pstObject, orxFRAME *_pstFrame)
+{
+  orxGRAPHIC *pstGraphic, *pstWorkingGraphic;
+  orxFLOAT    fResult;
+
+  /* Gets graphics */
+  pstGraphic        = orxOBJECT_GET_STRUCTURE(_pstObject, GRAPHIC);
+  pstWorkingGraphic = orxObject_GetWorkingGraphic(_pstObject);
+
+  /* Is a text? (its content can change without notifying the object) */
+  if(((pstGraphic != orxNULL) && (orxStructure_TestFlags(pstGraphic, orxGRAPHIC_KU32_FLAG_TEXT) != orxFALSE))
+  || ((pstWorkingGraphic != orxNULL) && (orxStructure_TestFlags(pstWorkingGraphic, orxGRAPHIC_KU32_FLAG_TEXT) != orxFALSE)))
+  {
+    /* Updates result */
+    fResult = orxFLOAT_MAX;
+  }
+  else
+  {
+    orxVECTOR vSize, vPivot, vScale;
+
+    /* Gets object's extent */
+    orxObject_GetSize(_pstObject, &vSize);
+    orxObject_GetPivot(_pstObject, &vPivot);
+    fResult = orxObject_GetIndexExtent(&vSize, &vPivot);
+
+    /* Has a different working graphic? */
+    if((pstWorkingGraphic != orxNULL) && (pstWorkingGraphic != pstGraphic))
+    {
+      orxFLOAT fExtent;
+
+      /* Gets its extent */
+      orxGraphic_GetSize(pstWorkingGraphic, &vSize);
+      orxGraphic_GetPivot(pstWorkingGraphic, &vPivot);
+      fExtent = orxObject_GetIndexExtent(&vSize, &vPivot);
+
+      /* Updates result */
+      fResult = orxMAX(fResult, fExtent);
+    }
+
+    /* Applies object's scale */
+    orxFrame_GetScale(_pstFrame, orxFRAME_SPACE_GLOBAL, &vScale);
+    fResult *= orxMAX(orxMath_Abs(vScale.fX), orxMath_Abs(vScale.fY));
+  }
+
+  /* Done! */
+  return fResult;
+}
+
+/** Removes an object from the spatial index
+ * @param[in]   _pstObject      Concerned object
+ */
+static void orxFASTCALL orxObject_RemoveFromIndex(orxOBJECT *_pstObject)
+{
+  orxLINKLIST *pstList;
+
+  /* Is indexed? */
+  if((pstList = orxLinkList_GetList(&(_pstObject->stIndexNode))) != orxNULL)
+  {
+    /* Removes it */
+    orxLinkList_Remove(&(_pstObject->stIndexNode));
+
+    /* Empty cell? */
+    if(orxLinkList_GetCount(pstList) == 0)
+    {
+      orxOBJECT_INDEX_CELL *pstCell;
+
+      /* Gets cell */
+      pstCell = orxSTRUCT_GET_FROM_FIELD(orxOBJECT_INDEX_CELL, stObjectList, pstList);
+
+      /* Deletes it */
+      orxHashTable_Remove(sstObject.pstIndexTable, pstCell->u64Key);
+      orxBank_Free(sstObject.pstIndexCellBank, pstCell);
+    }
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Updates an object in the spatial index: objects are stored in the grid cell of their position, with a radius no larger
+ * than a cell, or in their group's unbounded cell otherwise (which is also used for differential scrolling/depth scaling)
+ * @param[in]   _pstObject      Concerned object
+ */
+static void orxFASTCALL orxObject_UpdateIndex(orxOBJECT *_pstObject)
+{
+  orxFRAME *pstFrame;
+  orxU64    u64Key = 0;
+
+  /* Gets frame */
+  pstFrame = orxOBJECT_GET_STRUCTURE(_pstObject, FRAME);
+
+  /* Valid? */
+  if(pstFrame != orxNULL)
+  {
+    /* Uses differential scrolling/depth scaling or is larger than a cell? */
+    if((orxStructure_TestFlags(pstFrame, orxFRAME_KU32_MASK_SCROLL_BOTH | orxFRAME_KU32_FLAG_DEPTH_SCALE) != orxFALSE)
+    || (orxObject_GetIndexRadius(_pstObject, pstFrame) > sstObject.fIndexCellSize))
+    {
+      /* Uses group's unbounded cell */
+      u64Key = (orxU64)_pstObject->stGroupID;
+    }
+    else
+    {
+      orxVECTOR vPosition;
+
+      /* Gets its position */
+      orxFrame_GetPosition(pstFrame, orxFRAME_SPACE_GLOBAL, &vPosition);
+
+      /* Gets its cell key */
+      u64Key = orxObject_GetIndexKey(_pstObject->stGroupID, (orxS32)orxMath_Floor(vPosition.fX * sstObject.fIndexRecCellSize), (orxS32)orxMath_Floor(vPosition.fY * sstObject.fIndexRecCellSize));
+    }
+  }
+
+  /* Not already in the right cell? */
+  if((orxLinkList_GetList(&(_pstObject->stIndexNode)) == orxNULL)
+  || (orxSTRUCT_GET_FROM_FIELD(orxOBJECT_INDEX_CELL, stObjectList, orxLinkList_GetList(&(_pstObject->stIndexNode)))->u64Key != u64Key))
+  {
+    /* Removes it from its current cell */
+    orxObject_RemoveFromIndex(_pstObject);
+
+    /* Should be indexed? */
+    if(u64Key != 0)
+    {
+      orxOBJECT_INDEX_CELL **ppstBucket;
+
+      /* Gets cell bucket */
+      ppstBucket = (orxOBJECT_INDEX_CELL **)orxHashTable_Retrieve(sstObject.pstIndexTable, u64Key);
+
+      /* Valid? */
+      if(ppstBucket != orxNULL)
+      {
+        /* New cell? */
+        if(*ppstBucket == orxNULL)
+        {
+          /* Allocates it */
+          *ppstBucket = (orxOBJECT_INDEX_CELL *)orxBank_Allocate(sstObject.pstIndexCellBank);
+
+          /* Success? */
+          if(*ppstBucket != orxNULL)
+          {
+            /* Inits it */
+            orxMemory_Zero(*ppstBucket, sizeof(orxOBJECT_INDEX_CELL));
+            (*ppstBucket)->u64Key = u64Key;
+          }
+          else
+          {
+            /* Removes bucket */
+            orxHashTable_Remove(sstObject.pstIndexTable, u64Key);
+
+            /* Logs message */
+            orxDEBUG_PRINT(orxDEBUG_LEVEL_OBJECT, "Couldn't allocate index cell for object <%s>.", orxObject_GetName(_pstObject));
+
+            /* Done! */
+            return;
+          }
+        }
+
+        /* Adds object to it */
+        orxLinkList_AddEnd(&((*ppstBucket)->stObjectList), &(_pstObject->stIndexNode));
+      }
+    }
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Updates the index of the object linked to an updated frame
+ * @param[in]   _pstFrame       Updated frame
+ * @param[in]   _pContext       Context (unused)
+ */
+static void orxFASTCALL orxObject_UpdateFrameIndex(orxFRAME *_pstFrame, void *_pContext)
+{
+  orxOBJECT *pstObject;
+
+  /* Gets linked object */
+  pstObject = (orxOBJECT *)orxHashTable_Get(sstObject.pstIndexFrameTable, (orxU64)(size_t)_pstFrame);
+
+  /* Valid? */
+  if(pstObject != orxNULL)
+  {
+    /* Updates its index */
+    orxObject_UpdateIndex(pstObject);
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Refreshes the spatial index with all the frames updated since last refresh
+ */
+static void orxFASTCALL orxObject_RefreshIndex()
+{
+  /* Profiles */
+  orxPROFILER_PUSH_MARKER("orxObject_RefreshIndex");
+
+  /* Couldn't get all updated frames? */
+  if(orxFrame_FlushUpdateList(orxObject_UpdateFrameIndex, orxNULL) == orxSTATUS_FAILURE)
+  {
+    orxOBJECT *pstObject;
+
+    /* For all objects */
+    for(pstObject = orxOBJECT(orxStructure_GetFirst(orxSTRUCTURE_ID_OBJECT));
+        pstObject != orxNULL;
+        pstObject = orxOBJECT(orxStructure_GetNext(pstObject)))
+    {
+      /* Updates its index */
+      orxObject_UpdateIndex(pstObject);
+    }
+  }
+
+  /* Profiles */
+  orxPROFILER_POP_MARKER();
+
+  /* Done! */
+  return;
+}
+
+/** Adds all objects of an index cell to a candidate list
+ * @param[in]   _pstCell        Concerned cell, can be orxNULL
+ * @param[out]  _apstObjectList Candidate list
+ * @param[in]   _u32Size        Candidate list size
+ * @param[in]   _u32Count       Current number of candidates
+ * @return      New number of candidates
+ */
+static orxINLINE orxU32 orxObject_AddIndexCell(const orxOBJECT_INDEX_CELL *_pstCell, orxOBJECT **_apstObjectList, orxU32 _u32Size, orxU32 _u32Count)
+{
+  orxU32 u32Result = _u32Count;
+
+  /* Valid? */
+  if(_pstCell != orxNULL)
+  {
+    orxLINKLIST_NODE *pstNode;
+
+    /* For all its objects */
+    for(pstNode = orxLinkList_GetFirst(&(_pstCell->stObjectList));
+        pstNode != orxNULL;
+        pstNode = orxLinkList_GetNext(pstNode), u32Result++)
+    {
+      /* Enough room? */
+      if(u32Result < _u32Size)
+      {
+        /* Stores it */
+        _apstObjectList[u32Result] = orxSTRUCT_GET_FROM_FIELD(orxOBJECT, stIndexNode, pstNode);
+      }
+    }
+  }
+
+  /* Done! */
+  return u32Result;
+}
+
+/** Sorts candidates in group order (stable LSD radix sort on group indices)
+ * @param[in]   _apstObjectList Candidate list
+ * @param[in]   _u32Count       Number of candidates
+ */
+static void orxFASTCALL orxObject_SortIndexList(orxOBJECT **_apstObjectList, orxU32 _u32Count)
+{
+  /* Not enough sort room? */
+  if(_u32Count > sstObject.u32IndexSortBufferSize)
+  {
+    orxOBJECT **apstSortBuffer;
+    orxU32      u32Size;
+
+    /* Gets new size */
+    u32Size = orxMath_GetNextPowerOfTwo(_u32Count);
+
+    /* Grows sort buffer */
+    apstSortBuffer = (orxOBJECT **)orxMemory_Reallocate(sstObject.apstIndexSortBuffer, u32Size * sizeof(orxOBJECT *));
+
+    /* Success? */
+    if(apstSortBuffer != orxNULL)
+    {
+      /* Stores it */
+      sstObject.apstIndexSortBuffer     = apstSortBuffer;
+      sstObject.u32IndexSortBufferSize  = u32Size;
+    }
+    else
+    {
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_OBJECT, "Couldn't grow index sort buffer to %u objects: candidates won't be sorted.", u32Size);
+
+      /* Done! */
+      return;
+    }
+  }
+
+  /* More than one candidate? */
+  if(_u32Count > 1)
+  {
+    orxOBJECT **apstSrc, **apstDst, **apstTemp;
+    orxU32      u32Shift, i;
+
+    /* For all digits */
+    for(u32Shift = 0, apstSrc = _apstObjectList, apstDst = sstObject.apstIndexSortBuffer; u32Shift < 32; u32Shift += orxOBJECT_KU32_INDEX_SORT_BITS)
+    {
+      orxU32 au32Offset[1 << orxOBJECT_KU32_INDEX_SORT_BITS], u32Digit, u32Offset;
+
+      /* Clears histogram */
+      orxMemory_Zero(au32Offset, sizeof(au32Offset));
+
+      /* Computes histogram */
+      for(i = 0; i < _u32Count; i++)
+      {
+        au32Offset[(apstSrc[i]->u32GroupIndex >> u32Shift) & ((1 << orxOBJECT_KU32_INDEX_SORT_BITS) - 1)]++;
+      }
+
+      /* All candidates share this digit? */
+      if(au32Offset[(apstSrc[0]->u32GroupIndex >> u32Shift) & ((1 << orxOBJECT_KU32_INDEX_SORT_BITS) - 1)] == _u32Count)
+      {
+        /* Skips it */
+        continue;
+      }
+
+      /* Computes offsets */
+      for(u32Digit = 0, u32Offset = 0; u32Digit < (1 << orxOBJECT_KU32_INDEX_SORT_BITS); u32Digit++)
+      {
+        orxU32 u32Number;
+
+        u32Number             = au32Offset[u32Digit];
+        au32Offset[u32Digit]  = u32Offset;
+        u32Offset            += u32Number;
+      }
+
+      /* Scatters candidates */
+      for(i = 0; i < _u32Count; i++)
+      {
+        apstDst[au32Offset[(apstSrc[i]->u32GroupIndex >> u32Shift) & ((1 << orxOBJECT_KU32_INDEX_SORT_BITS) - 1)]++] = apstSrc[i];
+      }
+
+      /* Swaps lists */
+      apstTemp  = apstSrc;
+      apstSrc   = apstDst;
+      apstDst   = apstTemp;
+    }
+
+    /* Result isn't in the candidate list? */
+    if(apstSrc != _apstObjectList)
+    {
+      /* Copies it */
+      orxMemory_Copy(_apstObjectList, apstSrc, _u32Count * sizeof(orxOBJECT *));
+    }
+  }
+
+  /* Done! */
+  return;
+}
+
+/** Gets the 2D axis-aligned box containing an oriented box
+ * @param[in]   _pstBox         Oriented box
+ * @param[out]  _pstResult      Axis-aligned box
+ * @return      Axis-aligned box
+ */
+static orxINLINE orxAABOX *orxObject_GetOBoxAABox(const orxOBOX *_pstBox, orxAABOX *_pstResult)
+{
+  orxVECTOR vOrigin;
+
+  /* Gets box origin */
+  orxVector_Sub(&vOrigin, &(_pstBox->vPosition), &(_pstBox->vPivot));
+
+  /* Gets extents */
+  _pstResult->vTL.fX = vOrigin.fX + orxMIN(orxFLOAT_0, _pstBox->vX.fX) + orxMIN(orxFLOAT_0, _pstBox->vY.fX);
+  _pstResult->vTL.fY = vOrigin.fY + orxMIN(orxFLOAT_0, _pstBox->vX.fY) + orxMIN(orxFLOAT_0, _pstBox->vY.fY);
+  _pstResult->vBR.fX = vOrigin.fX + orxMAX(orxFLOAT_0, _pstBox->vX.fX) + orxMAX(orxFLOAT_0, _pstBox->vY.fX);
+  _pstResult->vBR.fY = vOrigin.fY + orxMAX(orxFLOAT_0, _pstBox->vX.fY) + orxMAX(orxFLOAT_0, _pstBox->vY.fY);
+  _pstResult->vTL.fZ = _pstBox->vPosition.fZ;
+  _pstResult->vBR.fZ = _pstBox->vPosition.fZ + _pstBox->vZ.fZ;
+
+  /* Done! */
+  return _pstResult;
+}
+
+/** Gets the candidates for a 2D box query in the internal query list
+ * @param[in]   _pstBox         Box to check
+ * @param[in]   _stGroupID      Group ID to consider, orxSTRINGID_UNDEFINED for all
+ * @return      Number of candidates
+ */
+static orxU32 orxFASTCALL orxObject_GetIndexList(const orxAABOX *_pstBox, orxSTRINGID _stGroupID)
+{
+  orxU32 u32Result;
+
+  /* Gets candidates */
+  u32Result = orxObject_GetBoxCandidateList(_pstBox, _stGroupID, sstObject.apstIndexList, sstObject.u32IndexListSize);
+
+  /* Not enough room? */
+  if(u32Result > sstObject.u32IndexListSize)
+  {
+    orxOBJECT **apstIndexList;
+    orxU32      u32Size;
+
+    /* Gets new size */
+    u32Size = orxMath_GetNextPowerOfTwo(u32Result);
+
+    /* Grows list */
+    apstIndexList = (orxOBJECT **)orxMemory_Reallocate(sstObject.apstIndexList, u32Size * sizeof(orxOBJECT *));
+
+    /* Success? */
+    if(apstIndexList != orxNULL)
+    {
+      /* Stores it */
+      sstObject.apstIndexList     = apstIndexList;
+      sstObject.u32IndexListSize  = u32Size;
+
+      /* Gets all candidates */
+      u32Result = orxObject_GetBoxCandidateList(_pstBox, _stGroupID, sstObject.apstIndexList, sstObject.u32IndexListSize);
+    }
+    else
+    {
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_OBJECT, "Couldn't grow index query list to %u objects: skipping %u candidates.", u32Size, u32Result - sstObject.u32IndexListSize);
+
+      /* Updates result */
+      u32Result = sstObject.u32IndexListSize;
+    }
+  }
+
+  /* Done! */
+  return u32Result;
+}
+
 /** Update body scale
  */
 void orxFASTCALL orxObject_UpdateBodyScale(orxOBJECT *_pstObject)
@@ -502,6 +1053,9 @@ static orxINLINE orxSTATUS orxObject_SetLiteralLifeTime(orxOBJECT *_pstObject, c
     /* Applies them */
     orxStructure_SetFlags(_pstObject, u32Flags, orxOBJECT_KU32_MASK_STRUCTURE_LIFETIME);
 
+    /* Updates its activity */
+    orxObject_UpdateActivity(_pstObject);
+
     /* Updates result */
     eResult = orxSTATUS_SUCCESS;
   }
@@ -3349,6 +3903,9 @@ static orxINLINE orxOBJECT *orxObject_CreateInternal()
     /* Inits active time */
     pstResult->fActiveTime = orxFLOAT_0;
 
+    /* Updates its activity */
+    orxObject_UpdateActivity(pstResult);
+
     /* Sets default group ID */
     orxObject_SetGroupID(pstResult, sstObject.stDefaultGroupID);
 
@@ -3420,6 +3977,12 @@ static orxINLINE orxSTATUS orxObject_DeleteInternal(orxOBJECT *_pstObject)
         orxLinkList_Remove(&(_pstObject->stGroupNode));
       }
 
+      /* Removes object from the active list */
+      if(orxLinkList_GetList(&(_pstObject->stActiveNode)) != orxNULL)
+      {
+        orxLinkList_Remove(&(_pstObject->stActiveNode));
+      }
+
       /* Deletes structure */
       orxStructure_Delete(_pstObject);
     }
@@ -3428,11 +3991,11 @@ static orxINLINE orxSTATUS orxObject_DeleteInternal(orxOBJECT *_pstObject)
       /* Increases count */
       orxStructure_IncreaseCount(_pstObject);
 
-      /* Resets its active time: going undead */
-      _pstObject->fActiveTime = orxFLOAT_0;
-
       /* Disables it */
       orxObject_Enable(_pstObject, orxFALSE);
+
+      /* Resets its active time: going undead */
+      _pstObject->fActiveTime = orxFLOAT_0;
     }
   }
   else
@@ -3490,9 +4053,29 @@ static orxINLINE void orxObject_DeleteAll()
   return;
 }
 
+/** Gets next active object
+ * @param[in] _pstObject          Concerned object
+ * @return orxOBJECT / orxNULL
+ */
+static orxINLINE orxOBJECT *orxObject_GetNextActive(const orxOBJECT *_pstObject)
+{
+  orxLINKLIST_NODE *pstNode;
+  orxOBJECT        *pstResult;
+
+  /* Gets next node */
+  pstNode = orxLinkList_GetNext(&(_pstObject->stActiveNode));
+
+  /* Updates result */
+  pstResult = (pstNode != orxNULL) ? orxSTRUCT_GET_FROM_FIELD(orxOBJECT, stActiveNode, pstNode) : (orxOBJECT *)orxNULL;
+
+  /* Done! */
+  return pstResult;
+}
+
 /** Updates an object
  * @param[int] _pstObject         Concerned object
  * @param[in] _pstClockInfo       Clock information where this callback has been registered
+ * @return Next active object
  */
 static orxOBJECT *orxFASTCALL orxObject_UpdateInternal(orxOBJECT *_pstObject, const orxCLOCK_INFO *_pstClockInfo)
 {
@@ -3541,7 +4124,7 @@ static orxOBJECT *orxFASTCALL orxObject_UpdateInternal(orxOBJECT *_pstObject, co
       if(_pstObject->fLifeTime <= orxFLOAT_0)
       {
         /* Gets next object */
-        pstResult = orxOBJECT(orxStructure_GetNext(_pstObject));
+        pstResult = orxObject_GetNextActive(_pstObject);
 
         /* Deletes it */
         orxObject_Delete(_pstObject);
@@ -3551,9 +4134,6 @@ static orxOBJECT *orxFASTCALL orxObject_UpdateInternal(orxOBJECT *_pstObject, co
       }
     }
 
-    /* !!! TODO !!! */
-    /* Updates culling info before calling update subfunctions */
-
     /* Wasn't object deleted? */
     if(bDeleted == orxFALSE)
     {
@@ -3577,6 +4157,13 @@ static orxOBJECT *orxFASTCALL orxObject_UpdateInternal(orxOBJECT *_pstObject, co
           }
         }
 
+        /* Has animation? */
+        if(orxStructure_TestFlags(_pstObject, 1 << orxSTRUCTURE_ID_ANIMPOINTER))
+        {
+          /* Updates its index (its size might have changed) */
+          orxObject_UpdateIndex(_pstObject);
+        }
+
         /* Has no body? */
         if(!orxStructure_TestFlags(_pstObject, 1 << orxSTRUCTURE_ID_BODY))
         {
@@ -3672,7 +4259,18 @@ static orxOBJECT *orxFASTCALL orxObject_UpdateInternal(orxOBJECT *_pstObject, co
   if(bDeleted == orxFALSE)
   {
     /* Gets next object */
-    pstResult = (orxOBJECT *)orxStructure_GetNext(_pstObject);
+    pstResult = orxObject_GetNextActive(_pstObject);
+
+    /* Active and doesn't need to be updated anymore? */
+    if((orxLinkList_GetList(&(_pstObject->stActiveNode)) != orxNULL)
+    && (orxObject_NeedsUpdate(_pstObject) == orxFALSE))
+    {
+      /* Removes it from the active list */
+      orxLinkList_Remove(&(_pstObject->stActiveNode));
+
+      /* Updates its activity */
+      orxObject_UpdateActivity(_pstObject);
+    }
   }
 
   /* Profiles */
@@ -3688,13 +4286,20 @@ static orxOBJECT *orxFASTCALL orxObject_UpdateInternal(orxOBJECT *_pstObject, co
  */
 static void orxFASTCALL orxObject_UpdateAll(const orxCLOCK_INFO *_pstClockInfo, void *_pContext)
 {
-  orxOBJECT *pstObject, *pstNextObject;
+  orxLINKLIST_NODE *pstNode;
+  orxOBJECT        *pstObject, *pstNextObject;
 
   /* Profiles */
   orxPROFILER_PUSH_MARKER("orxObject_UpdateAll");
 
-  /* For all objects */
-  for(pstObject = (orxOBJECT *)orxStructure_GetFirst(orxSTRUCTURE_ID_OBJECT);
+  /* Updates idle time */
+  sstObject.dIdleTime += (orxDOUBLE)_pstClockInfo->fDT;
+
+  /* Gets first active node */
+  pstNode = orxLinkList_GetFirst(&(sstObject.stActiveList));
+
+  /* For all active objects */
+  for(pstObject = (pstNode != orxNULL) ? orxSTRUCT_GET_FROM_FIELD(orxOBJECT, stActiveNode, pstNode) : (orxOBJECT *)orxNULL;
       pstObject != orxNULL;
       pstObject = pstNextObject)
   {
@@ -3702,6 +4307,9 @@ static void orxFASTCALL orxObject_UpdateAll(const orxCLOCK_INFO *_pstClockInfo,
     pstNextObject = orxObject_UpdateInternal(pstObject, _pstClockInfo);
   }
 
+  /* Refreshes spatial index */
+  orxObject_RefreshIndex();
+
   /* Profiles */
   orxPROFILER_POP_MARKER();
 
@@ -3787,18 +4395,41 @@ orxSTATUS orxFASTCALL orxObject_Init()
           if(eResult != orxSTATUS_FAILURE)
           {
             /* Creates banks */
-            sstObject.pstGroupBank  = orxBank_Create(orxOBJECT_KU32_GROUP_BANK_SIZE, sizeof(orxLINKLIST), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
-            sstObject.pstAgeBank    = orxBank_Create(orxOBJECT_KU32_AGE_BANK_SIZE, sizeof(orxOBJECT *), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+            sstObject.pstGroupBank      = orxBank_Create(orxOBJECT_KU32_GROUP_BANK_SIZE, sizeof(orxLINKLIST), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+            sstObject.pstAgeBank        = orxBank_Create(orxOBJECT_KU32_AGE_BANK_SIZE, sizeof(orxOBJECT *), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+            sstObject.pstIndexCellBank  = orxBank_Create(orxOBJECT_KU32_INDEX_CELL_BANK_SIZE, sizeof(orxOBJECT_INDEX_CELL), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
 
             /* Success? */
-            if((sstObject.pstGroupBank != orxNULL) && (sstObject.pstAgeBank != orxNULL))
+            if((sstObject.pstGroupBank != orxNULL) && (sstObject.pstAgeBank != orxNULL) && (sstObject.pstIndexCellBank != orxNULL))
             {
-              /* Creates group table */
-              sstObject.pstGroupTable = orxHashTable_Create(orxOBJECT_KU32_GROUP_TABLE_SIZE, orxHASHTABLE_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+              /* Creates tables */
+              sstObject.pstGroupTable       = orxHashTable_Create(orxOBJECT_KU32_GROUP_TABLE_SIZE, orxHASHTABLE_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+              sstObject.pstIndexTable       = orxHashTable_Create(orxOBJECT_KU32_INDEX_TABLE_SIZE, orxHASHTABLE_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+              sstObject.pstIndexFrameTable  = orxHashTable_Create(orxOBJECT_KU32_INDEX_FRAME_TABLE_SIZE, orxHASHTABLE_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
 
               /* Success? */
-              if(sstObject.pstGroupTable != orxNULL)
+              if((sstObject.pstGroupTable != orxNULL) && (sstObject.pstIndexTable != orxNULL) && (sstObject.pstIndexFrameTable != orxNULL))
               {
+                /* Pushes config section */
+                orxConfig_PushSection(orxOBJECT_KZ_CONFIG_SECTION);
+
+                /* Gets index cell size */
+                sstObject.fIndexCellSize = (orxConfig_HasValue(orxOBJECT_KZ_CONFIG_INDEX_CELL_SIZE) != orxFALSE) ? orxConfig_GetFloat(orxOBJECT_KZ_CONFIG_INDEX_CELL_SIZE) : orxOBJECT_KF_INDEX_CELL_SIZE;
+
+                /* Invalid? */
+                if(sstObject.fIndexCellSize <= orxFLOAT_0)
+                {
+                  /* Logs message */
+                  orxDEBUG_PRINT(orxDEBUG_LEVEL_OBJECT, "Invalid index cell size [%g], using default value [%g] instead.", sstObject.fIndexCellSize, orxOBJECT_KF_INDEX_CELL_SIZE);
+
+                  /* Uses default value */
+                  sstObject.fIndexCellSize = orxOBJECT_KF_INDEX_CELL_SIZE;
+                }
+                sstObject.fIndexRecCellSize = orxFLOAT_1 / sstObject.fIndexCellSize;
+
+                /* Pops config section */
+                orxConfig_PopSection();
+
                 /* Registers commands */
                 orxObject_RegisterCommands();
 
@@ -3817,9 +4448,24 @@ orxSTATUS orxFASTCALL orxObject_Init()
                 /* Removes event handler */
                 orxEvent_RemoveHandler(orxEVENT_TYPE_OBJECT, orxObject_EventHandler);
 
+                /* Deletes tables */
+                if(sstObject.pstGroupTable != orxNULL)
+                {
+                  orxHashTable_Delete(sstObject.pstGroupTable);
+                }
+                if(sstObject.pstIndexTable != orxNULL)
+                {
+                  orxHashTable_Delete(sstObject.pstIndexTable);
+                }
+                if(sstObject.pstIndexFrameTable != orxNULL)
+                {
+                  orxHashTable_Delete(sstObject.pstIndexFrameTable);
+                }
+
                 /* Deletes banks */
                 orxBank_Delete(sstObject.pstGroupBank);
                 orxBank_Delete(sstObject.pstAgeBank);
+                orxBank_Delete(sstObject.pstIndexCellBank);
 
                 /* Unregisters from clock */
                 orxClock_Unregister(sstObject.pstClock, orxObject_UpdateAll);
@@ -3842,6 +4488,10 @@ orxSTATUS orxFASTCALL orxObject_Init()
               {
                 orxBank_Delete(sstObject.pstAgeBank);
               }
+              if(sstObject.pstIndexCellBank != orxNULL)
+              {
+                orxBank_Delete(sstObject.pstIndexCellBank);
+              }
 
               /* Unregisters from clock */
               orxClock_Unregister(sstObject.pstClock, orxObject_UpdateAll);
@@ -3925,12 +4575,27 @@ void orxFASTCALL orxObject_Exit()
     /* Unregisters structure type */
     orxStructure_Unregister(orxSTRUCTURE_ID_OBJECT);
 
-    /* Deletes group table */
+    /* Deletes tables */
     orxHashTable_Delete(sstObject.pstGroupTable);
+    orxHashTable_Delete(sstObject.pstIndexTable);
+    orxHashTable_Delete(sstObject.pstIndexFrameTable);
 
     /* Deletes banks */
     orxBank_Delete(sstObject.pstGroupBank);
     orxBank_Delete(sstObject.pstAgeBank);
+    orxBank_Delete(sstObject.pstIndexCellBank);
+
+    /* Deletes index lists */
+    if(sstObject.apstIndexList != orxNULL)
+    {
+      orxMemory_Free(sstObject.apstIndexList);
+      sstObject.apstIndexList = orxNULL;
+    }
+    if(sstObject.apstIndexSortBuffer != orxNULL)
+    {
+      orxMemory_Free(sstObject.apstIndexSortBuffer);
+      sstObject.apstIndexSortBuffer = orxNULL;
+    }
 
     /* Updates flags */
     sstObject.u32Flags &= ~orxOBJECT_KU32_STATIC_FLAG_READY;
@@ -4738,6 +5403,9 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
                   /* Marks it as a joint child */
                   orxStructure_SetFlags(pstChild, orxOBJECT_KU32_FLAG_IS_JOINT_CHILD | orxOBJECT_KU32_FLAG_DETACH_JOINT_CHILD, orxOBJECT_KU32_FLAG_NONE);
 
+                  /* Updates its activity */
+                  orxObject_UpdateActivity(pstChild);
+
                   /* Updates flags */
                   u32Flags |= orxOBJECT_KU32_FLAG_HAS_JOINT_CHILDREN;
                 }
@@ -4936,6 +5604,9 @@ orxOBJECT *orxFASTCALL orxObject_CreateFromConfig(const orxSTRING _zConfigID)
         /* Updates flags */
         orxStructure_SetFlags(pstResult, u32Flags, orxOBJECT_KU32_FLAG_NONE);
 
+        /* Updates its activity */
+        orxObject_UpdateActivity(pstResult);
+
         /* Sends event */
         orxEVENT_SEND(orxEVENT_TYPE_OBJECT, orxOBJECT_EVENT_CREATE, pstResult, orxNULL, orxNULL);
 
@@ -5073,6 +5744,25 @@ orxSTATUS orxFASTCALL orxObject_LinkStructure(orxOBJECT *_pstObject, orxSTRUCTUR
 
     /* Updates flags */
     orxStructure_SetFlags(_pstObject, 1 << eStructureID, orxOBJECT_KU32_FLAG_NONE);
+
+    /* Updates its activity */
+    orxObject_UpdateActivity(_pstObject);
+
+    /* Frame? */
+    if(eStructureID == orxSTRUCTURE_ID_FRAME)
+    {
+      /* Stores it for index updates */
+      orxHashTable_Set(sstObject.pstIndexFrameTable, (orxU64)(size_t)_pstStructure, _pstObject);
+
+      /* Updates index */
+      orxObject_UpdateIndex(_pstObject);
+    }
+    /* Graphic or animation? */
+    else if((eStructureID == orxSTRUCTURE_ID_GRAPHIC) || (eStructureID == orxSTRUCTURE_ID_ANIMPOINTER))
+    {
+      /* Updates index */
+      orxObject_UpdateIndex(_pstObject);
+    }
   }
   else
   {
@@ -5109,6 +5799,20 @@ void orxFASTCALL orxObject_UnlinkStructure(orxOBJECT *_pstObject, orxSTRUCTURE_I
     /* Decreases structure reference count */
     orxStructure_DecreaseCount(pstStructure);
 
+    /* Frame? */
+    if(_eStructureID == orxSTRUCTURE_ID_FRAME)
+    {
+      /* Was stored for this object? */
+      if(orxHashTable_Get(sstObject.pstIndexFrameTable, (orxU64)(size_t)pstStructure) == _pstObject)
+      {
+        /* Removes it */
+        orxHashTable_Remove(sstObject.pstIndexFrameTable, (orxU64)(size_t)pstStructure);
+      }
+
+      /* Removes object from index */
+      orxObject_RemoveFromIndex(_pstObject);
+    }
+
     /* Was internally handled? */
     if(orxFLAG_TEST(_pstObject->astStructureList[_eStructureID].u32Flags, orxOBJECT_KU32_STORAGE_FLAG_INTERNAL))
     {
@@ -5194,6 +5898,13 @@ void orxFASTCALL orxObject_UnlinkStructure(orxOBJECT *_pstObject, orxSTRUCTURE_I
 
     /* Updates flags */
     orxStructure_SetFlags(_pstObject, orxOBJECT_KU32_FLAG_NONE, 1 << _eStructureID);
+
+    /* Graphic or animation? */
+    if((_eStructureID == orxSTRUCTURE_ID_GRAPHIC) || (_eStructureID == orxSTRUCTURE_ID_ANIMPOINTER))
+    {
+      /* Updates index */
+      orxObject_UpdateIndex(_pstObject);
+    }
   }
 
   return;
@@ -5249,6 +5960,9 @@ void orxFASTCALL orxObject_Enable(orxOBJECT *_pstObject, orxBOOL _bEnable)
 
       /* Updates status flags */
       orxStructure_SetFlags(_pstObject, orxOBJECT_KU32_FLAG_ENABLED, orxOBJECT_KU32_FLAG_NONE);
+
+      /* Updates its activity */
+      orxObject_UpdateActivity(_pstObject);
     }
   }
   else
@@ -5261,6 +5975,9 @@ void orxFASTCALL orxObject_Enable(orxOBJECT *_pstObject, orxBOOL _bEnable)
 
       /* Updates status flags */
       orxStructure_SetFlags(_pstObject, orxOBJECT_KU32_FLAG_NONE, orxOBJECT_KU32_FLAG_ENABLED);
+
+      /* Updates its activity */
+      orxObject_UpdateActivity(_pstObject);
     }
   }
 
@@ -5309,6 +6026,9 @@ void orxFASTCALL orxObject_Pause(orxOBJECT *_pstObject, orxBOOL _bPause)
 
       /* Updates status flags */
       orxStructure_SetFlags(_pstObject, orxOBJECT_KU32_FLAG_PAUSED, orxOBJECT_KU32_FLAG_NONE);
+
+      /* Updates its activity */
+      orxObject_UpdateActivity(_pstObject);
     }
   }
   else
@@ -5321,6 +6041,9 @@ void orxFASTCALL orxObject_Pause(orxOBJECT *_pstObject, orxBOOL _bPause)
 
       /* Updates status flags */
       orxStructure_SetFlags(_pstObject, orxOBJECT_KU32_FLAG_NONE, orxOBJECT_KU32_FLAG_PAUSED);
+
+      /* Updates its activity */
+      orxObject_UpdateActivity(_pstObject);
     }
   }
 
@@ -5701,6 +6424,9 @@ orxSTATUS orxFASTCALL orxObject_SetPivot(orxOBJECT *_pstObject, const orxVECTOR
     eResult = orxSTATUS_SUCCESS;
   }
 
+  /* Updates index */
+  orxObject_UpdateIndex(_pstObject);
+
   /* Done! */
   return eResult;
 }
@@ -5781,6 +6507,9 @@ orxSTATUS orxFASTCALL orxObject_SetSize(orxOBJECT *_pstObject, const orxVECTOR *
     eResult = orxSTATUS_SUCCESS;
   }
 
+  /* Updates index */
+  orxObject_UpdateIndex(_pstObject);
+
   /* Done! */
   return eResult;
 }
@@ -7086,6 +7815,9 @@ orxSTATUS orxFASTCALL orxObject_SetSpeed(orxOBJECT *_pstObject, const orxVECTOR
     /* Stores it */
     orxVector_Copy(&(_pstObject->vSpeed), _pvSpeed);
 
+    /* Updates its activity */
+    orxObject_UpdateActivity(_pstObject);
+
     /* Updates result */
     eResult = orxSTATUS_SUCCESS;
   }
@@ -7147,6 +7879,9 @@ orxSTATUS orxFASTCALL orxObject_SetAngularVelocity(orxOBJECT *_pstObject, orxFLO
     /* Stores it */
     _pstObject->fAngularVelocity = _fVelocity;
 
+    /* Updates its activity */
+    orxObject_UpdateActivity(_pstObject);
+
     /* Updates result */
     eResult = orxSTATUS_SUCCESS;
   }
@@ -8499,13 +9234,20 @@ orxBANK *orxFASTCALL orxObject_CreateNeighborList(const orxOBOX *_pstCheckBox, o
   /* Valid? */
   if(pstResult != orxNULL)
   {
-    orxU32 u32Count;
+    orxAABOX  stBox;
+    orxU32    u32Count, u32Number, i;
 
-    /* For all objects */
-    for(u32Count = 0, pstObject = orxObject_GetNext(orxNULL, _stGroupID);
-        (u32Count < orxOBJECT_KU32_NEIGHBOR_LIST_SIZE) && (pstObject != orxNULL);
-        pstObject = orxObject_GetNext(pstObject, _stGroupID))
+    /* Gets candidates */
+    u32Number = orxObject_GetIndexList(orxObject_GetOBoxAABox(_pstCheckBox, &stBox), _stGroupID);
+
+    /* For all candidates */
+    for(u32Count = 0, i = 0;
+        (u32Count < orxOBJECT_KU32_NEIGHBOR_LIST_SIZE) && (i < u32Number);
+        i++)
     {
+      /* Gets it */
+      pstObject = sstObject.apstIndexList[i];
+
       /* Gets its bounding box */
       if(orxObject_GetBoundingBox(pstObject, &stObjectBox) != orxNULL)
       {
@@ -9144,6 +9886,9 @@ orxSTATUS orxFASTCALL orxObject_SetLifeTime(orxOBJECT *_pstObject, orxFLOAT _fLi
     orxStructure_SetFlags(_pstObject, orxOBJECT_KU32_FLAG_NONE, orxOBJECT_KU32_FLAG_HAS_LIFETIME | orxOBJECT_KU32_FLAG_DEATH_ROW);
   }
 
+  /* Updates its activity */
+  orxObject_UpdateActivity(_pstObject);
+
   /* Done! */
   return eResult;
 }
@@ -9181,7 +9926,7 @@ orxFLOAT orxFASTCALL orxObject_GetActiveTime(const orxOBJECT *_pstObject)
   orxSTRUCTURE_ASSERT(_pstObject);
 
   /* Updates result */
-  fResult = _pstObject->fActiveTime;
+  fResult = orxStructure_TestFlags(_pstObject, orxOBJECT_KU32_FLAG_IDLE) ? _pstObject->fActiveTime + (orxFLOAT)(sstObject.dIdleTime - _pstObject->dIdleStart) : _pstObject->fActiveTime;
 
   /* Done! */
   return fResult;
@@ -9269,8 +10014,16 @@ extern orxDLLAPI orxSTATUS orxFASTCALL orxObject_SetGroupID(orxOBJECT *_pstObjec
   /* Adds object to end of list */
   orxLinkList_AddEnd(pstGroupList, &(_pstObject->stGroupNode));
 
-  /* Stores group ID */
-  _pstObject->stGroupID = _stGroupID;
+  /* Stores group ID & index */
+  _pstObject->stGroupID     = _stGroupID;
+  _pstObject->u32GroupIndex = sstObject.u32GroupIndex++;
+
+  /* Is indexed? */
+  if(orxLinkList_GetList(&(_pstObject->stIndexNode)) != orxNULL)
+  {
+    /* Updates index */
+    orxObject_UpdateIndex(_pstObject);
+  }
 
   /* Done! */
   return eResult;
@@ -9353,6 +10106,121 @@ extern orxDLLAPI orxOBJECT *orxFASTCALL orxObject_GetNext(const orxOBJECT *_pstO
   return pstResult;
 }
 
+/** Gets candidate objects for a 2D box query, using the spatial index. Objects are indexed by group in a uniform grid
+ * (cell size defined by Object.IndexCellSize, defaults to 256) that is kept up-to-date as their frames get updated.
+ * Candidates are a superset of the objects touching the box and still need to be tested by the caller. When they all fit
+ * in the list, they're sorted in group order (see orxObject_GetNext()).
+ * @param[in]   _pstBox         Box to check (only X & Y are considered)
+ * @param[in]   _stGroupID      Group ID to consider, orxSTRINGID_UNDEFINED for all
+ * @param[out]  _apstObjectList List that will receive candidates, can be orxNULL if _u32Size is 0
+ * @param[in]   _u32Size        Size of the list
+ * @return      Number of candidates, if greater than _u32Size, only _u32Size have been stored (unsorted) and the call should be repeated with a larger list
+ */
+orxU32 orxFASTCALL orxObject_GetBoxCandidateList(const orxAABOX *_pstBox, orxSTRINGID _stGroupID, orxOBJECT **_apstObjectList, orxU32 _u32Size)
+{
+  orxU32 u32Result = 0;
+
+  /* Checks */
+  orxASSERT(sstObject.u32Flags & orxOBJECT_KU32_STATIC_FLAG_READY);
+  orxASSERT(_pstBox != orxNULL);
+  orxASSERT((_apstObjectList != orxNULL) || (_u32Size == 0));
+
+  /* Profiles */
+  orxPROFILER_PUSH_MARKER("orxObject_GetBoxCandidateList");
+
+  /* Refreshes spatial index */
+  orxObject_RefreshIndex();
+
+  /* Has group? */
+  if(_stGroupID != orxSTRINGID_UNDEFINED)
+  {
+    orxLINKLIST *pstGroupList;
+
+    /* Gets group list */
+    pstGroupList = (orxLINKLIST *)orxHashTable_Get(sstObject.pstGroupTable, _stGroupID);
+
+    /* Valid? */
+    if(pstGroupList != orxNULL)
+    {
+      orxFLOAT fMinX, fMinY, fMaxX, fMaxY;
+
+      /* Gets cell range (objects are stored in the cell of their position, hence the extra margin) */
+      fMinX = orxMath_Floor((orxMIN(_pstBox->vTL.fX, _pstBox->vBR.fX) - sstObject.fIndexCellSize) * sstObject.fIndexRecCellSize);
+      fMinY = orxMath_Floor((orxMIN(_pstBox->vTL.fY, _pstBox->vBR.fY) - sstObject.fIndexCellSize) * sstObject.fIndexRecCellSize);
+      fMaxX = orxMath_Floor((orxMAX(_pstBox->vTL.fX, _pstBox->vBR.fX) + sstObject.fIndexCellSize) * sstObject.fIndexRecCellSize);
+      fMaxY = orxMath_Floor((orxMAX(_pstBox->vTL.fY, _pstBox->vBR.fY) + sstObject.fIndexCellSize) * sstObject.fIndexRecCellSize);
+
+      /* Fewer cells to check than objects in group (and no wrapping cell coordinates)? */
+      if(((fMaxX - fMinX + orxFLOAT_1) * (fMaxY - fMinY + orxFLOAT_1) < orxU2F(orxLinkList_GetCount(pstGroupList)))
+      && (fMaxX - fMinX < orx2F(65536.0f))
+      && (fMaxY - fMinY < orx2F(65536.0f)))
+      {
+        orxS32 s32MinY, s32MaxX, s32MaxY, s32X, s32Y;
+
+        /* Adds group's unbounded objects */
+        u32Result = orxObject_AddIndexCell((orxOBJECT_INDEX_CELL *)orxHashTable_Get(sstObject.pstIndexTable, (orxU64)_stGroupID), _apstObjectList, _u32Size, u32Result);
+
+        /* For all cells */
+        for(s32X = orxF2S(fMinX), s32MinY = orxF2S(fMinY), s32MaxX = orxF2S(fMaxX), s32MaxY = orxF2S(fMaxY); s32X <= s32MaxX; s32X++)
+        {
+          for(s32Y = s32MinY; s32Y <= s32MaxY; s32Y++)
+          {
+            /* Adds its objects */
+            u32Result = orxObject_AddIndexCell((orxOBJECT_INDEX_CELL *)orxHashTable_Get(sstObject.pstIndexTable, orxObject_GetIndexKey(_stGroupID, s32X, s32Y)), _apstObjectList, _u32Size, u32Result);
+          }
+        }
+
+        /* All candidates stored? */
+        if(u32Result <= _u32Size)
+        {
+          /* Sorts them in group order */
+          orxObject_SortIndexList(_apstObjectList, u32Result);
+        }
+      }
+      else
+      {
+        orxLINKLIST_NODE *pstNode;
+
+        /* For all objects in group */
+        for(pstNode = orxLinkList_GetFirst(pstGroupList);
+            pstNode != orxNULL;
+            pstNode = orxLinkList_GetNext(pstNode), u32Result++)
+        {
+          /* Enough room? */
+          if(u32Result < _u32Size)
+          {
+            /* Stores it */
+            _apstObjectList[u32Result] = orxSTRUCT_GET_FROM_FIELD(orxOBJECT, stGroupNode, pstNode);
+          }
+        }
+      }
+    }
+  }
+  else
+  {
+    orxOBJECT *pstObject;
+
+    /* For all objects */
+    for(pstObject = orxOBJECT(orxStructure_GetFirst(orxSTRUCTURE_ID_OBJECT));
+        pstObject != orxNULL;
+        pstObject = orxOBJECT(orxStructure_GetNext(pstObject)), u32Result++)
+    {
+      /* Enough room? */
+      if(u32Result < _u32Size)
+      {
+        /* Stores it */
+        _apstObjectList[u32Result] = pstObject;
+      }
+    }
+  }
+
+  /* Profiles */
+  orxPROFILER_POP_MARKER();
+
+  /* Done! */
+  return u32Result;
+}
+
 /** Picks the first active object with size "under" the given position, within a given group. See
  * orxObject_BoxPick(), orxObject_CreateNeighborList() and orxObject_Raycast for other ways of picking
  * objects.
@@ -9362,18 +10230,26 @@ extern orxDLLAPI orxOBJECT *orxFASTCALL orxObject_GetNext(const orxOBJECT *_pstO
  */
 orxOBJECT *orxFASTCALL orxObject_Pick(const orxVECTOR *_pvPosition, orxSTRINGID _stGroupID)
 {
+  orxAABOX    stBox;
   orxFLOAT    fSelectedZ;
   orxOBJECT  *pstResult = orxNULL, *pstObject;
+  orxU32      u32Number, i;
 
   /* Checks */
   orxASSERT(sstObject.u32Flags & orxOBJECT_KU32_STATIC_FLAG_READY);
   orxASSERT(_pvPosition != orxNULL);
 
-  /* For all objects */
-  for(pstObject = orxObject_GetNext(orxNULL, _stGroupID), fSelectedZ = _pvPosition->fZ;
-      pstObject != orxNULL;
-      pstObject = orxObject_GetNext(pstObject, _stGroupID))
+  /* Gets candidates */
+  orxVector_Copy(&(stBox.vTL), _pvPosition);
+  orxVector_Copy(&(stBox.vBR), _pvPosition);
+  u32Number = orxObject_GetIndexList(&stBox, _stGroupID);
+
+  /* For all candidates */
+  for(i = 0, fSelectedZ = _pvPosition->fZ; i < u32Number; i++)
   {
+    /* Gets it */
+    pstObject = sstObject.apstIndexList[i];
+
     /* Is enabled? */
     if(orxObject_IsEnabled(pstObject) != orxFALSE)
     {
@@ -9421,18 +10297,24 @@ orxOBJECT *orxFASTCALL orxObject_Pick(const orxVECTOR *_pvPosition, orxSTRINGID
  */
 orxOBJECT *orxFASTCALL orxObject_BoxPick(const orxOBOX *_pstBox, orxSTRINGID _stGroupID)
 {
+  orxAABOX    stBox;
   orxFLOAT    fSelectedZ;
   orxOBJECT  *pstResult = orxNULL, *pstObject;
+  orxU32      u32Number, i;
 
   /* Checks */
   orxASSERT(sstObject.u32Flags & orxOBJECT_KU32_STATIC_FLAG_READY);
   orxASSERT(_pstBox != orxNULL);
 
-  /* For all objects */
-  for(pstObject = orxObject_GetNext(orxNULL, _stGroupID), fSelectedZ = _pstBox->vPosition.fZ;
-      pstObject != orxNULL;
-      pstObject = orxObject_GetNext(pstObject, _stGroupID))
+  /* Gets candidates */
+  u32Number = orxObject_GetIndexList(orxObject_GetOBoxAABox(_pstBox, &stBox), _stGroupID);
+
+  /* For all candidates */
+  for(i = 0, fSelectedZ = _pstBox->vPosition.fZ; i < u32Number; i++)
   {
+    /* Gets it */
+    pstObject = sstObject.apstIndexList[i];
+
     /* Is enabled? */
     if(orxObject_IsEnabled(pstObject) != orxFALSE)
     {
@@ -154,6 +154,7 @@ static orxSTRUCTURE_STATIC sstStructure;
 static orxINLINE orxTREE_NODE *orxStructure_InsertLogNode(orxBANK *_pstBank, orxHASHTABLE *_pstTable, orxTREE_NODE *_pstRoot, orxSTRUCTURE *_pstStructure)
 {
   orxSTRUCTURE_LOG_NODE **ppstBucket;
+  orxSTRUCTURE_LOG_NODE  *pstNode;
 
   /* Retrieves structure's bucket */
   ppstBucket = (orxSTRUCTURE_LOG_NODE **)orxHashTable_Retrieve(_pstTable, orxStructure_GetGUID(_pstStructure));
@@ -161,14 +162,16 @@ static orxINLINE orxTREE_NODE *orxStructure_InsertLogNode(orxBANK *_pstBank, orx
   /* Not already in the tree? */
   if(*ppstBucket == orxNULL)
   {
-    orxSTRUCTURE           *pstOwner;
-    orxSTRUCTURE_LOG_NODE  *pstNode;
+    orxSTRUCTURE *pstOwner;
 
     /* Creates its node */
     pstNode = (orxSTRUCTURE_LOG_NODE *)orxBank_Allocate(_pstBank);
     orxASSERT(pstNode != orxNULL);
     pstNode->pstStructure = _pstStructure;
 
+    /* Stores it (before inserting its owner, which invalidates the bucket) */
+    *ppstBucket = pstNode;
+
     /* Gets its owner */
     pstOwner = orxStructure_GetOwner(_pstStructure);
 
@@ -188,13 +191,15 @@ static orxINLINE orxTREE_NODE *orxStructure_InsertLogNode(orxBANK *_pstBank, orx
       /* Inserts as child of root */
       orxTree_AddChild(_pstRoot, &(pstNode->stNode));
     }
-
-    /* Stores it */
-    *ppstBucket = pstNode;
+  }
+  else
+  {
+    /* Gets it */
+    pstNode = *ppstBucket;
   }
 
   /* Done! */
-  return &((*ppstBucket)->stNode);
+  return &(pstNode->stNode);
 }
 
 static orxINLINE void orxStructure_LogNode(const orxTREE_NODE *_pstNode)
@@ -58,6 +58,18 @@
 #include "../plugins/Render/Home/orxRender.c"
 #include "../plugins/Sound/android/orxSoundSystem.c"
 
+/* Headless? */
+#elif defined(__orxHEADLESS__)
+
+/* Software display, no input devices & silent sound system */
+#include "../plugins/Display/Software/orxDisplay.c"
+#include "../plugins/Joystick/Dummy/orxJoystick.c"
+#include "../plugins/Keyboard/Dummy/orxKeyboard.c"
+#include "../plugins/Mouse/Dummy/orxMouse.c"
+#include "../plugins/Physics/LiquidFun/orxPhysics.cpp"
+#include "../plugins/Render/Home/orxRender.c"
+#include "../plugins/Sound/Dummy/orxSoundSystem.c"
+
 /* Others */
 #else /* __orxANDROID__ || __orxANDROID_NATIVE__ */
 
@@ -310,6 +310,13 @@ static orxSTATUS orxFASTCALL orxShader_ProcessConfigData(orxSHADER *_pstShader)
 
                 /* Creates texture */
                 ((orxTEXTURE **)astValueBuffer)[j] = orxTexture_CreateFromFile(zValue, orxFALSE);
+
+                /* Valid? */
+                if(((orxTEXTURE **)astValueBuffer)[j] != orxNULL)
+                {
+                  /* Keeps it out of atlases, as shaders sample it as a whole */
+                  orxTexture_Unpack(((orxTEXTURE **)astValueBuffer)[j]);
+                }
               }
               else
               {
@@ -343,6 +350,13 @@ static orxSTATUS orxFASTCALL orxShader_ProcessConfigData(orxSHADER *_pstShader)
               {
                 /* Creates texture */
                 ((orxTEXTURE **)astValueBuffer)[0] = orxTexture_CreateFromFile(zValue, orxFALSE);
+
+                /* Valid? */
+                if(((orxTEXTURE **)astValueBuffer)[0] != orxNULL)
+                {
+                  /* Keeps it out of atlases, as shaders sample it as a whole */
+                  orxTexture_Unpack(((orxTEXTURE **)astValueBuffer)[0]);
+                }
               }
             }
             else
@@ -1284,6 +1284,13 @@ orxVIEWPORT *orxFASTCALL orxViewport_CreateFromConfig(const orxSTRING _zConfigID
             /* Restores display debug level state */
             orxDEBUG_ENABLE_LEVEL(orxDEBUG_LEVEL_DISPLAY, bDisplayLevelEnabled);
 
+            /* Found? */
+            if(pstTexture != orxNULL)
+            {
+              /* Renders to its own bitmap, outside of any atlas */
+              orxTexture_Unpack(pstTexture);
+            }
+
             /* Not found? */
             if(pstTexture == orxNULL)
             {
@@ -1412,6 +1419,13 @@ orxVIEWPORT *orxFASTCALL orxViewport_CreateFromConfig(const orxSTRING _zConfigID
           /* Restores display debug level state */
           orxDEBUG_ENABLE_LEVEL(orxDEBUG_LEVEL_DISPLAY, bDisplayLevelEnabled);
 
+          /* Found? */
+          if(pstTexture != orxNULL)
+          {
+            /* Renders to its own bitmap, outside of any atlas */
+            orxTexture_Unpack(pstTexture);
+          }
+
           /* Not found? */
           if(pstTexture == orxNULL)
           {
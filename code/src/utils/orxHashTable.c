@@ -31,10 +31,35 @@
 
 
 #include "utils/orxHashTable.h"
-#include "memory/orxBank.h"
 #include "debug/orxDebug.h"
 #include "debug/orxProfiler.h"
-#include "utils/orxString.h"
+#include "math/orxMath.h"
+
+#if defined(__orxX86_64__) || (defined(__orxX86__) && (defined(__SSE2__) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))))
+
+  #include <emmintrin.h>
+
+  #define __orxHASHTABLE_SSE2__
+
+#endif
+
+
+/** Defines
+ */
+#ifdef __orxHASHTABLE_SSE2__
+  #define orxHASHTABLE_KU32_GROUP_SIZE          16                /**< Number of control bytes probed at once */
+#else /* __orxHASHTABLE_SSE2__ */
+  #define orxHASHTABLE_KU32_GROUP_SIZE          8                 /**< Number of control bytes probed at once */
+#endif /* __orxHASHTABLE_SSE2__ */
+
+#define orxHASHTABLE_KU32_MIN_SIZE              16                /**< Minimum number of home cells */
+#define orxHASHTABLE_KU32_LOAD_NUMERATOR        3                 /**< Maximum load factor numerator */
+#define orxHASHTABLE_KU32_LOAD_DENOMINATOR      4                 /**< Maximum load factor denominator */
+#define orxHASHTABLE_KU32_OVERFLOW_SHIFT        3                 /**< Overflow area size shift (relative to home cell number) */
+
+#define orxHASHTABLE_KU8_CONTROL_EMPTY          0x80              /**< Control byte of an empty cell, used ones store 7 bits of their key's hash */
+
+#define orxHASHTABLE_KU64_HASH_MULTIPLIER       0x9E3779B97F4A7C15ULL
 
 
 /***************************************************************************
@@ -46,27 +71,24 @@ typedef struct __orxHASHTABLE_CELL_t
 {
   orxU64                        u64Key;                       /**< Key element of a hash table : 8 */
   void                         *pData;                        /**< Address of data : 12 / 16 */
-  struct __orxHASHTABLE_CELL_t *pstNext;                      /**< Next cell with the same index : 16 / 20 */
 
 } orxHASHTABLE_CELL;
 
-/** Hash Table */
-#ifdef __orxMSVC__
-  #pragma warning(disable : 4200)
-#endif /* __orxMSVC__ */
-
+/** Hash Table
+ * Open addressing with linear probing that never wraps around: a key lives between its home cell and the first empty cell after it,
+ * home cells are followed by an overflow area and by a group of empty control bytes that stops all probes.
+ */
 struct __orxHASHTABLE_t
 {
-  orxBANK            *pstBank;                                /**< Bank where are stored cells : 4 */
-  orxU32              u32Count;                               /**< Hashtable item count : 8 */
-  orxU32              u32Size;                                /**< Hashtable size : 12 */
-  orxHASHTABLE_CELL  *apstCell[0];                            /**< Hash table */
+  orxHASHTABLE_CELL  *astCell;                                /**< Cells (home + overflow) : 4 / 8 */
+  orxU8              *au8Control;                             /**< Control bytes (one per cell + one trailing empty group) : 8 / 16 */
+  orxU32              u32Count;                               /**< Hashtable item count : 12 / 20 */
+  orxU32              u32Size;                                /**< Number of home cells (power of two) : 16 / 24 */
+  orxU32              u32Capacity;                            /**< Total number of cells : 20 / 28 */
+  orxU32              u32Flags;                               /**< Flags : 24 / 32 */
+  orxMEMORY_TYPE      eMemType;                               /**< Memory type : 28 / 36 */
 };
 
-#ifdef __orxMSVC__
-  #pragma warning(default : 4200)
-#endif /* __orxMSVC__ */
-
 
 /***************************************************************************
  * Module global variable                                                  *
@@ -76,18 +98,383 @@ struct __orxHASHTABLE_t
  * Private functions                                                       *
  ***************************************************************************/
 
-/** Find a row in a hash table.
+/** Gets a key's hash
+ * @param[in] _u64Key       Concerned key
+ * @return Hash: high 32 bits are used for home cell, top 7 bits are stored in control bytes
+ */
+static orxINLINE orxU64 orxHashTable_GetHash(orxU64 _u64Key)
+{
+  /* Done! */
+  return _u64Key * orxHASHTABLE_KU64_HASH_MULTIPLIER;
+}
+
+/** Gets the home cell index of a hash
+ * @param[in] _pstHashTable Concerned hash table
+ * @param[in] _u64Hash      Concerned hash
+ * @return Home cell index
+ */
+static orxINLINE orxU32 orxHashTable_GetHome(const orxHASHTABLE *_pstHashTable, orxU64 _u64Hash)
+{
+  /* Done! */
+  return (orxU32)(_u64Hash >> 32) & (_pstHashTable->u32Size - 1);
+}
+
+/** Gets the control byte of a hash
+ * @param[in] _u64Hash      Concerned hash
+ * @return Control byte
+ */
+static orxINLINE orxU8 orxHashTable_GetTag(orxU64 _u64Hash)
+{
+  /* Done! */
+  return (orxU8)(_u64Hash >> 57);
+}
+
+#ifdef __orxHASHTABLE_SSE2__
+
+typedef orxU32 orxHASHTABLE_MASK;
+
+/** Gets the first cell offset of a group mask */
+#define orxHASHTABLE_GET_MASK_OFFSET(MASK)      orxMath_GetTrailingZeroCount(MASK)
+
+/** Probes a group of control bytes
+ * @param[in] _pu8Control   First control byte of the group
+ * @param[in] _u8Tag        Tag to match
+ * @param[out] _pstEmpty    Mask of empty cells
+ * @return Mask of cells matching the tag
+ */
+static orxINLINE orxHASHTABLE_MASK orxHashTable_ProbeGroup(const orxU8 *_pu8Control, orxU8 _u8Tag, orxHASHTABLE_MASK *_pstEmpty)
+{
+  __m128i vGroup;
+
+  /* Loads group */
+  vGroup = _mm_loadu_si128((const __m128i *)_pu8Control);
+
+  /* Gets empty cells (only they have their top bit set) */
+  *_pstEmpty = (orxHASHTABLE_MASK)_mm_movemask_epi8(vGroup);
+
+  /* Done! */
+  return (orxHASHTABLE_MASK)_mm_movemask_epi8(_mm_cmpeq_epi8(vGroup, _mm_set1_epi8((char)_u8Tag)));
+}
+
+/** Gets the empty cells of a group of control bytes
+ * @param[in] _pu8Control   First control byte of the group
+ * @return Mask of empty cells
+ */
+static orxINLINE orxHASHTABLE_MASK orxHashTable_GetEmptyMask(const orxU8 *_pu8Control)
+{
+  /* Done! */
+  return (orxHASHTABLE_MASK)_mm_movemask_epi8(_mm_loadu_si128((const __m128i *)_pu8Control));
+}
+
+#else /* __orxHASHTABLE_SSE2__ */
+
+typedef orxU64 orxHASHTABLE_MASK;
+
+/** Gets the first cell offset of a group mask */
+#define orxHASHTABLE_GET_MASK_OFFSET(MASK)      (orxMath_GetTrailingZeroCount64(MASK) >> 3)
+
+#define orxHASHTABLE_KU64_SWAR_LOW              0x0101010101010101ULL
+#define orxHASHTABLE_KU64_SWAR_HIGH             0x8080808080808080ULL
+
+/** Loads a group of control bytes (first byte in the lowest bits)
+ * @param[in] _pu8Control   First control byte of the group
+ * @return Group
+ */
+static orxINLINE orxU64 orxHashTable_LoadGroup(const orxU8 *_pu8Control)
+{
+  orxU64 u64Result;
+
+  /* Loads it */
+  orxMemory_Copy(&u64Result, _pu8Control, sizeof(orxU64));
+
+#ifdef __orxBIG_ENDIAN__
+
+  /* Swaps it */
+  u64Result = ((u64Result & 0x00000000FFFFFFFFULL) << 32) | ((u64Result & 0xFFFFFFFF00000000ULL) >> 32);
+  u64Result = ((u64Result & 0x0000FFFF0000FFFFULL) << 16) | ((u64Result & 0xFFFF0000FFFF0000ULL) >> 16);
+  u64Result = ((u64Result & 0x00FF00FF00FF00FFULL) << 8) | ((u64Result & 0xFF00FF00FF00FF00ULL) >> 8);
+
+#endif /* __orxBIG_ENDIAN__ */
+
+  /* Done! */
+  return u64Result;
+}
+
+/** Probes a group of control bytes
+ * @param[in] _pu8Control   First control byte of the group
+ * @param[in] _u8Tag        Tag to match
+ * @param[out] _pstEmpty    Mask of empty cells
+ * @return Mask of cells matching the tag (may contain false positives, after a real match)
+ */
+static orxINLINE orxHASHTABLE_MASK orxHashTable_ProbeGroup(const orxU8 *_pu8Control, orxU8 _u8Tag, orxHASHTABLE_MASK *_pstEmpty)
+{
+  orxU64 u64Group, u64Match;
+
+  /* Loads group */
+  u64Group = orxHashTable_LoadGroup(_pu8Control);
+
+  /* Gets empty cells (only they have their top bit set) */
+  *_pstEmpty = u64Group & orxHASHTABLE_KU64_SWAR_HIGH;
+
+  /* Gets matching bytes (as zero bytes) */
+  u64Match = u64Group ^ (orxHASHTABLE_KU64_SWAR_LOW * _u8Tag);
+
+  /* Done! */
+  return (u64Match - orxHASHTABLE_KU64_SWAR_LOW) & ~u64Match & orxHASHTABLE_KU64_SWAR_HIGH;
+}
+
+/** Gets the empty cells of a group of control bytes
+ * @param[in] _pu8Control   First control byte of the group
+ * @return Mask of empty cells
+ */
+static orxINLINE orxHASHTABLE_MASK orxHashTable_GetEmptyMask(const orxU8 *_pu8Control)
+{
+  /* Done! */
+  return orxHashTable_LoadGroup(_pu8Control) & orxHASHTABLE_KU64_SWAR_HIGH;
+}
+
+#endif /* __orxHASHTABLE_SSE2__ */
+
+/** Finds the cell of a key
  * @param[in] _pstHashTable The hash table where search.
- * @param[in] _u64Key Key to find.
- * @return index associated to the given key.
+ * @param[in] _u64Key       Key to find.
+ * @param[in] _u64Hash      Key's hash
+ * @return Index of the key's cell, orxU32_UNDEFINED if not found
  */
-static orxINLINE orxU32 orxHashTable_FindIndex(const orxHASHTABLE *_pstHashTable, orxU64 _u64Key)
+static orxINLINE orxU32 orxHashTable_Find(const orxHASHTABLE *_pstHashTable, orxU64 _u64Key, orxU64 _u64Hash)
 {
+  orxU32  u32Index;
+  orxU8   u8Tag;
+
   /* Checks */
   orxASSERT(_pstHashTable != orxNULL);
 
-  /* Computes the hash index */
-  return((orxU32)_u64Key & (_pstHashTable->u32Size - 1));
+  /* Gets tag */
+  u8Tag = orxHashTable_GetTag(_u64Hash);
+
+  /* For all groups from home cell */
+  for(u32Index = orxHashTable_GetHome(_pstHashTable, _u64Hash);; u32Index += orxHASHTABLE_KU32_GROUP_SIZE)
+  {
+    orxHASHTABLE_MASK stMatch, stEmpty;
+
+    /* Probes group */
+    stMatch = orxHashTable_ProbeGroup(_pstHashTable->au8Control + u32Index, u8Tag, &stEmpty);
+
+    /* For all matching cells */
+    for(; stMatch != 0; stMatch &= stMatch - 1)
+    {
+      orxU32 u32Cell;
+
+      /* Gets cell */
+      u32Cell = u32Index + (orxU32)orxHASHTABLE_GET_MASK_OFFSET(stMatch);
+
+      /* Found? */
+      if(_pstHashTable->astCell[u32Cell].u64Key == _u64Key)
+      {
+        /* Done! */
+        return u32Cell;
+      }
+    }
+
+    /* Reached an empty cell? */
+    if(stEmpty != 0)
+    {
+      /* Not found */
+      return orxU32_UNDEFINED;
+    }
+  }
+}
+
+/** Finds the first empty cell from a hash's home cell
+ * @param[in] _pstHashTable Concerned hash table
+ * @param[in] _u64Hash      Concerned hash
+ * @return Index of the empty cell, orxU32_UNDEFINED if the overflow area is full
+ */
+static orxINLINE orxU32 orxHashTable_FindEmpty(const orxHASHTABLE *_pstHashTable, orxU64 _u64Hash)
+{
+  orxU32 u32Index;
+
+  /* For all groups from home cell */
+  for(u32Index = orxHashTable_GetHome(_pstHashTable, _u64Hash);; u32Index += orxHASHTABLE_KU32_GROUP_SIZE)
+  {
+    orxHASHTABLE_MASK stEmpty;
+
+    /* Gets empty cells */
+    stEmpty = orxHashTable_GetEmptyMask(_pstHashTable->au8Control + u32Index);
+
+    /* Found? */
+    if(stEmpty != 0)
+    {
+      /* Gets its index */
+      u32Index += (orxU32)orxHASHTABLE_GET_MASK_OFFSET(stEmpty);
+
+      /* Done! */
+      return (u32Index < _pstHashTable->u32Capacity) ? u32Index : orxU32_UNDEFINED;
+    }
+  }
+}
+
+/** Resizes a hash table, re-inserting all its items
+ * @param[in] _pstHashTable Concerned hash table
+ * @param[in] _u32Size      New number of home cells (power of two)
+ * @return orxSTATUS_SUCCESS / orxSTATUS_FAILURE
+ */
+static orxSTATUS orxFASTCALL orxHashTable_Resize(orxHASHTABLE *_pstHashTable, orxU32 _u32Size)
+{
+  orxHASHTABLE        stNewTable;
+  orxSTATUS           eResult = orxSTATUS_SUCCESS;
+
+  /* Checks */
+  orxASSERT(orxMath_IsPowerOfTwo(_u32Size) != orxFALSE);
+  orxASSERT(_u32Size >= orxHASHTABLE_KU32_MIN_SIZE);
+
+  /* Inits new table */
+  orxMemory_Copy(&stNewTable, _pstHashTable, sizeof(orxHASHTABLE));
+  stNewTable.u32Size = _u32Size;
+
+  /* Until all items could be placed */
+  do
+  {
+    /* Computes capacity */
+    stNewTable.u32Capacity = stNewTable.u32Size + (stNewTable.u32Size >> orxHASHTABLE_KU32_OVERFLOW_SHIFT) + orxHASHTABLE_KU32_GROUP_SIZE;
+
+    /* Allocates cells & control bytes */
+    stNewTable.astCell = (orxHASHTABLE_CELL *)orxMemory_Allocate(stNewTable.u32Capacity * sizeof(orxHASHTABLE_CELL) + stNewTable.u32Capacity + orxHASHTABLE_KU32_GROUP_SIZE, _pstHashTable->eMemType);
+
+    /* Success? */
+    if(stNewTable.astCell != orxNULL)
+    {
+      orxU32 i;
+
+      /* Inits control bytes */
+      stNewTable.au8Control = (orxU8 *)(stNewTable.astCell + stNewTable.u32Capacity);
+      orxMemory_Set(stNewTable.au8Control, orxHASHTABLE_KU8_CONTROL_EMPTY, stNewTable.u32Capacity + orxHASHTABLE_KU32_GROUP_SIZE);
+
+      /* For all previous cells */
+      for(i = 0; i < _pstHashTable->u32Capacity; i++)
+      {
+        /* Used? */
+        if(_pstHashTable->au8Control[i] != orxHASHTABLE_KU8_CONTROL_EMPTY)
+        {
+          orxU64 u64Hash;
+          orxU32 u32Index;
+
+          /* Finds its new cell */
+          u64Hash   = orxHashTable_GetHash(_pstHashTable->astCell[i].u64Key);
+          u32Index  = orxHashTable_FindEmpty(&stNewTable, u64Hash);
+
+          /* Overflow? */
+          if(u32Index == orxU32_UNDEFINED)
+          {
+            break;
+          }
+
+          /* Stores it */
+          stNewTable.astCell[u32Index]    = _pstHashTable->astCell[i];
+          stNewTable.au8Control[u32Index] = orxHashTable_GetTag(u64Hash);
+        }
+      }
+
+      /* Overflow? */
+      if(i != _pstHashTable->u32Capacity)
+      {
+        /* Frees cells */
+        orxMemory_Free(stNewTable.astCell);
+
+        /* Not expandable? */
+        if(orxFLAG_TEST(_pstHashTable->u32Flags, orxHASHTABLE_KU32_FLAG_NOT_EXPANDABLE))
+        {
+          /* Updates result */
+          eResult = orxSTATUS_FAILURE;
+        }
+        else
+        {
+          /* Grows further */
+          stNewTable.u32Size <<= 1;
+          stNewTable.astCell = orxNULL;
+        }
+      }
+    }
+    else
+    {
+      /* Updates result */
+      eResult = orxSTATUS_FAILURE;
+    }
+  } while((stNewTable.astCell == orxNULL) && (eResult != orxSTATUS_FAILURE));
+
+  /* Success? */
+  if(eResult != orxSTATUS_FAILURE)
+  {
+    /* Frees previous cells */
+    if(_pstHashTable->astCell != orxNULL)
+    {
+      orxMemory_Free(_pstHashTable->astCell);
+    }
+
+    /* Stores new ones */
+    _pstHashTable->astCell      = stNewTable.astCell;
+    _pstHashTable->au8Control   = stNewTable.au8Control;
+    _pstHashTable->u32Size      = stNewTable.u32Size;
+    _pstHashTable->u32Capacity  = stNewTable.u32Capacity;
+  }
+
+  /* Done! */
+  return eResult;
+}
+
+/** Inserts a new key in a hash table (the key must not be present)
+ * @param[in] _pstHashTable Concerned hash table
+ * @param[in] _u64Key       Key to insert
+ * @param[in] _u64Hash      Key's hash
+ * @param[in] _pData        Data to assign
+ * @return The new cell if success, orxNULL otherwise
+ */
+static orxHASHTABLE_CELL *orxFASTCALL orxHashTable_Insert(orxHASHTABLE *_pstHashTable, orxU64 _u64Key, orxU64 _u64Hash, void *_pData)
+{
+  orxU32              u32Index;
+  orxHASHTABLE_CELL  *pstResult = orxNULL;
+
+  /* Above maximum load factor and expandable? */
+  if(((_pstHashTable->u32Count + 1) * orxHASHTABLE_KU32_LOAD_DENOMINATOR > _pstHashTable->u32Size * orxHASHTABLE_KU32_LOAD_NUMERATOR)
+  && (!orxFLAG_TEST(_pstHashTable->u32Flags, orxHASHTABLE_KU32_FLAG_NOT_EXPANDABLE)))
+  {
+    /* Grows */
+    if(orxHashTable_Resize(_pstHashTable, _pstHashTable->u32Size << 1) == orxSTATUS_FAILURE)
+    {
+      /* Done! */
+      return orxNULL;
+    }
+  }
+
+  /* Finds an empty cell */
+  u32Index = orxHashTable_FindEmpty(_pstHashTable, _u64Hash);
+
+  /* Overflow? */
+  while(u32Index == orxU32_UNDEFINED)
+  {
+    /* Can't grow? */
+    if(orxFLAG_TEST(_pstHashTable->u32Flags, orxHASHTABLE_KU32_FLAG_NOT_EXPANDABLE)
+    || (orxHashTable_Resize(_pstHashTable, _pstHashTable->u32Size << 1) == orxSTATUS_FAILURE))
+    {
+      /* Done! */
+      return orxNULL;
+    }
+
+    /* Finds an empty cell */
+    u32Index = orxHashTable_FindEmpty(_pstHashTable, _u64Hash);
+  }
+
+  /* Inits cell */
+  pstResult         = &(_pstHashTable->astCell[u32Index]);
+  pstResult->u64Key = _u64Key;
+  pstResult->pData  = _pData;
+  _pstHashTable->au8Control[u32Index] = orxHashTable_GetTag(_u64Hash);
+
+  /* Updates count */
+  _pstHashTable->u32Count++;
+
+  /* Done! */
+  return pstResult;
 }
 
 /***************************************************************************
@@ -111,40 +498,26 @@ orxHASHTABLE *orxFASTCALL orxHashTable_Create(orxU32 _u32NbKey, orxU32 _u32Flags
   orxASSERT(_eMemType < orxMEMORY_TYPE_NUMBER);
   orxASSERT(_u32NbKey > 0);
 
-  /* Gets Power of Two size */
-  u32Size = orxMath_GetNextPowerOfTwo(_u32NbKey);
+  /* Gets Power of Two size that can hold all keys under the maximum load factor */
+  u32Size = orxMath_GetNextPowerOfTwo((_u32NbKey * orxHASHTABLE_KU32_LOAD_DENOMINATOR + orxHASHTABLE_KU32_LOAD_NUMERATOR - 1) / orxHASHTABLE_KU32_LOAD_NUMERATOR);
+  if(u32Size < orxHASHTABLE_KU32_MIN_SIZE)
+  {
+    u32Size = orxHASHTABLE_KU32_MIN_SIZE;
+  }
 
   /* Allocate memory for a hash table */
-  pstHashTable = (orxHASHTABLE *)orxMemory_Allocate(sizeof(orxHASHTABLE) + (u32Size * sizeof(orxHASHTABLE_CELL *)), _eMemType);
+  pstHashTable = (orxHASHTABLE *)orxMemory_Allocate(sizeof(orxHASHTABLE), _eMemType);
 
   /* Enough memory ? */
   if(pstHashTable != orxNULL)
   {
-    orxU32 u32Flags;
-
-    /* Set flags */
-    if(_u32Flags == orxHASHTABLE_KU32_FLAG_NOT_EXPANDABLE)
-    {
-      u32Flags = orxBANK_KU32_FLAG_NOT_EXPANDABLE;
-    }
-    else
-    {
-      u32Flags = orxBANK_KU32_FLAG_NONE;
-    }
-
     /* Clean values */
-    orxMemory_Zero(pstHashTable, sizeof(orxHASHTABLE) + (u32Size * sizeof(orxHASHTABLE_CELL *)));
-
-    /* Allocate bank for cells */
-    pstHashTable->pstBank = orxBank_Create((orxU16)u32Size, sizeof(orxHASHTABLE_CELL), u32Flags, _eMemType);
+    orxMemory_Zero(pstHashTable, sizeof(orxHASHTABLE));
+    pstHashTable->u32Flags  = _u32Flags;
+    pstHashTable->eMemType  = _eMemType;
 
-    /* Correct bank allocation ? */
-    if(pstHashTable->pstBank != orxNULL)
-    {
-      /* Stores its size */
-      pstHashTable->u32Size = u32Size;
-    }
-    else
+    /* Allocates cells */
+    if(orxHashTable_Resize(pstHashTable, u32Size) == orxSTATUS_FAILURE)
     {
       /* Allocation problem, returns orxNULL */
       orxMemory_Free(pstHashTable);
@@ -164,11 +537,8 @@ orxSTATUS orxFASTCALL orxHashTable_Delete(orxHASHTABLE *_pstHashTable)
   /* Checks */
   orxASSERT(_pstHashTable != orxNULL);
 
-  /* Clear hash table (unallocate cells) */
-  orxHashTable_Clear(_pstHashTable);
-
-  /* Free bank */
-  orxBank_Delete(_pstHashTable->pstBank);
+  /* Frees cells */
+  orxMemory_Free(_pstHashTable->astCell);
 
   /* Unallocate memory */
   orxMemory_Free(_pstHashTable);
@@ -186,11 +556,8 @@ orxSTATUS orxFASTCALL orxHashTable_Clear(orxHASHTABLE *_pstHashTable)
   /* Checks */
   orxASSERT(_pstHashTable != orxNULL);
 
-  /* Clear the memory bank */
-  orxBank_Clear(_pstHashTable->pstBank);
-
-  /* Clear the hash */
-  orxMemory_Zero(_pstHashTable->apstCell, _pstHashTable->u32Size * sizeof(orxHASHTABLE_CELL *));
+  /* Clears control bytes */
+  orxMemory_Set(_pstHashTable->au8Control, orxHASHTABLE_KU8_CONTROL_EMPTY, _pstHashTable->u32Capacity);
 
   /* Clears count */
   _pstHashTable->u32Count = 0;
@@ -226,8 +593,8 @@ orxU32 orxFASTCALL orxHashTable_GetCount(const orxHASHTABLE *_pstHashTable)
  */
 void *orxFASTCALL orxHashTable_Get(const orxHASHTABLE *_pstHashTable, orxU64 _u64Key)
 {
-  orxU32              u32Index;
-  orxHASHTABLE_CELL  *pstCell = orxNULL;
+  orxU32  u32Index;
+  void   *pResult;
 
   /* Profiles */
   orxPROFILER_PUSH_MARKER("orxHashTable_Get");
@@ -235,20 +602,17 @@ void *orxFASTCALL orxHashTable_Get(const orxHASHTABLE *_pstHashTable, orxU64 _u6
   /* Checks */
   orxASSERT(_pstHashTable != orxNULL);
 
-  /* Gets the index from the key */
-  u32Index = orxHashTable_FindIndex(_pstHashTable, _u64Key);
-
   /* Finds the corresponding cell */
-  for(pstCell = _pstHashTable->apstCell[u32Index];
-      (pstCell != orxNULL) && (pstCell->u64Key != _u64Key);
-      pstCell = pstCell->pstNext)
-  ;
+  u32Index = orxHashTable_Find(_pstHashTable, _u64Key, orxHashTable_GetHash(_u64Key));
+
+  /* Updates result */
+  pResult = (u32Index != orxU32_UNDEFINED) ? _pstHashTable->astCell[u32Index].pData : orxNULL;
 
   /* Profiles */
   orxPROFILER_POP_MARKER();
 
   /* Done! */
-  return (pstCell != orxNULL) ? pstCell->pData : orxNULL;
+  return pResult;
 }
 
 /** Retrieves the bucket of an item in a hash table, if the item wasn't present, a new bucket will be created.
@@ -258,8 +622,8 @@ void *orxFASTCALL orxHashTable_Get(const orxHASHTABLE *_pstHashTable, orxU64 _u6
  */
 void **orxFASTCALL orxHashTable_Retrieve(orxHASHTABLE *_pstHashTable, orxU64 _u64Key)
 {
+  orxU64              u64Hash;
   orxU32              u32Index;
-  orxHASHTABLE_CELL  *pstCell;
   void              **ppResult;
 
   /* Profiles */
@@ -268,48 +632,25 @@ void **orxFASTCALL orxHashTable_Retrieve(orxHASHTABLE *_pstHashTable, orxU64 _u6
   /* Checks */
   orxASSERT(_pstHashTable != orxNULL);
 
-  /* Gets the index from the key */
-  u32Index = orxHashTable_FindIndex(_pstHashTable, _u64Key);
-
   /* Finds the corresponding cell */
-  for(pstCell = _pstHashTable->apstCell[u32Index];
-      (pstCell != orxNULL) && (pstCell->u64Key != _u64Key);
-      pstCell = pstCell->pstNext)
-  ;
+  u64Hash   = orxHashTable_GetHash(_u64Key);
+  u32Index  = orxHashTable_Find(_pstHashTable, _u64Key, u64Hash);
 
   /* Not found ? */
-  if(pstCell == orxNULL)
+  if(u32Index == orxU32_UNDEFINED)
   {
-    /* Creates a new cell */
-    pstCell = (orxHASHTABLE_CELL *)orxBank_Allocate(_pstHashTable->pstBank);
-
-    /* Success? */
-    if(pstCell != orxNULL)
-    {
-      /* Inits cell */
-      pstCell->u64Key   = _u64Key;
-      pstCell->pData    = orxNULL;
-      pstCell->pstNext  = _pstHashTable->apstCell[u32Index];
-
-      /* Updates count */
-      _pstHashTable->u32Count++;
+    orxHASHTABLE_CELL *pstCell;
 
-      /* Inserts it */
-      _pstHashTable->apstCell[u32Index] = pstCell;
+    /* Creates a new cell */
+    pstCell = orxHashTable_Insert(_pstHashTable, _u64Key, u64Hash, orxNULL);
 
-      /* Updates result */
-      ppResult = &(pstCell->pData);
-    }
-    else
-    {
-      /* Updates result */
-      ppResult = orxNULL;
-    }
+    /* Updates result */
+    ppResult = (pstCell != orxNULL) ? &(pstCell->pData) : orxNULL;
   }
   else
   {
     /* Updates result */
-    ppResult = &(pstCell->pData);
+    ppResult = &(_pstHashTable->astCell[u32Index].pData);
   }
 
   /* Profiles */
@@ -327,8 +668,8 @@ void **orxFASTCALL orxHashTable_Retrieve(orxHASHTABLE *_pstHashTable, orxU64 _u6
  */
 orxSTATUS orxFASTCALL orxHashTable_Set(orxHASHTABLE *_pstHashTable, orxU64 _u64Key, void *_pData)
 {
-  orxU32              u32Index;
-  orxHASHTABLE_CELL  *pstCell;
+  orxU64 u64Hash;
+  orxU32 u32Index;
 
   /* Profiles */
   orxPROFILER_PUSH_MARKER("orxHashTable_Set");
@@ -336,40 +677,20 @@ orxSTATUS orxFASTCALL orxHashTable_Set(orxHASHTABLE *_pstHashTable, orxU64 _u64K
   /* Checks */
   orxASSERT(_pstHashTable != orxNULL);
 
-  /* Gets the index from the key */
-  u32Index = orxHashTable_FindIndex(_pstHashTable, _u64Key);
-
   /* Finds the corresponding cell */
-  for(pstCell = _pstHashTable->apstCell[u32Index];
-      (pstCell != orxNULL) && (pstCell->u64Key != _u64Key);
-      pstCell = pstCell->pstNext)
-  ;
+  u64Hash   = orxHashTable_GetHash(_u64Key);
+  u32Index  = orxHashTable_Find(_pstHashTable, _u64Key, u64Hash);
 
   /* Found ? */
-  if(pstCell != orxNULL)
+  if(u32Index != orxU32_UNDEFINED)
   {
     /* Stores data */
-    pstCell->pData = _pData;
+    _pstHashTable->astCell[u32Index].pData = _pData;
   }
   else
   {
     /* Creates a new cell */
-    pstCell = (orxHASHTABLE_CELL *)orxBank_Allocate(_pstHashTable->pstBank);
-
-    /* Success? */
-    if(pstCell != orxNULL)
-    {
-      /* Inits cell */
-      pstCell->u64Key   = _u64Key;
-      pstCell->pData    = _pData;
-      pstCell->pstNext  = _pstHashTable->apstCell[u32Index];
-
-      /* Updates count */
-      _pstHashTable->u32Count++;
-
-      /* Inserts it */
-      _pstHashTable->apstCell[u32Index] = pstCell;
-    }
+    orxHashTable_Insert(_pstHashTable, _u64Key, u64Hash, _pData);
   }
 
   /* Profiles */
@@ -388,9 +709,8 @@ orxSTATUS orxFASTCALL orxHashTable_Set(orxHASHTABLE *_pstHashTable, orxU64 _u64K
  */
 orxSTATUS orxFASTCALL orxHashTable_Add(orxHASHTABLE *_pstHashTable, orxU64 _u64Key, void *_pData)
 {
-  orxU32              u32Index;
-  orxHASHTABLE_CELL  *pstCell;
-  orxSTATUS           eStatus = orxSTATUS_FAILURE;
+  orxU64    u64Hash;
+  orxSTATUS eStatus = orxSTATUS_FAILURE;
 
   /* Profiles */
   orxPROFILER_PUSH_MARKER("orxHashTable_Add");
@@ -399,35 +719,15 @@ orxSTATUS orxFASTCALL orxHashTable_Add(orxHASHTABLE *_pstHashTable, orxU64 _u64K
   orxASSERT(_pstHashTable != orxNULL);
   orxASSERT(_pData != orxNULL);
 
-  /* Gets the index from the key */
-  u32Index = orxHashTable_FindIndex(_pstHashTable, _u64Key);
-
-  /* Finds the corresponding cell */
-  for(pstCell = _pstHashTable->apstCell[u32Index];
-      (pstCell != orxNULL) && (pstCell->u64Key != _u64Key);
-      pstCell = pstCell->pstNext)
-  ;
+  /* Gets hash */
+  u64Hash = orxHashTable_GetHash(_u64Key);
 
   /* Not found? */
-  if(pstCell == orxNULL)
+  if(orxHashTable_Find(_pstHashTable, _u64Key, u64Hash) == orxU32_UNDEFINED)
   {
     /* Creates a new cell */
-    pstCell = (orxHASHTABLE_CELL *)orxBank_Allocate(_pstHashTable->pstBank);
-
-    /* Success? */
-    if(pstCell != orxNULL)
+    if(orxHashTable_Insert(_pstHashTable, _u64Key, u64Hash, _pData) != orxNULL)
     {
-      /* Inits cell */
-      pstCell->u64Key   = _u64Key;
-      pstCell->pData    = _pData;
-      pstCell->pstNext  = _pstHashTable->apstCell[u32Index];
-
-      /* Inserts it */
-      _pstHashTable->apstCell[u32Index] = pstCell;
-
-      /* Updates count */
-      _pstHashTable->u32Count++;
-
       /* Updates result */
       eStatus = orxSTATUS_SUCCESS;
     }
@@ -447,9 +747,8 @@ orxSTATUS orxFASTCALL orxHashTable_Add(orxHASHTABLE *_pstHashTable, orxU64 _u64K
  */
 orxSTATUS orxFASTCALL orxHashTable_Remove(orxHASHTABLE *_pstHashTable, orxU64 _u64Key)
 {
-  orxU32 u32Index;                        /* Hash table index */
-  orxHASHTABLE_CELL *pstCell;             /* Cell used to traverse */
-  orxSTATUS eStatus = orxSTATUS_FAILURE;  /* Status to return */
+  orxU32    u32Index;
+  orxSTATUS eStatus = orxSTATUS_FAILURE;
 
   /* Profiles */
   orxPROFILER_PUSH_MARKER("orxHashTable_Remove");
@@ -457,55 +756,37 @@ orxSTATUS orxFASTCALL orxHashTable_Remove(orxHASHTABLE *_pstHashTable, orxU64 _u
   /* Checks */
   orxASSERT(_pstHashTable != orxNULL);
 
-  /* Get the index from the key */
-  u32Index = orxHashTable_FindIndex(_pstHashTable, _u64Key);
-
-  pstCell = _pstHashTable->apstCell[u32Index];
+  /* Finds the corresponding cell */
+  u32Index = orxHashTable_Find(_pstHashTable, _u64Key, orxHashTable_GetHash(_u64Key));
 
-  /* Is the first key is the key to remove ? */
-  if(pstCell != orxNULL)
+  /* Found? */
+  if(u32Index != orxU32_UNDEFINED)
   {
-    if(pstCell->u64Key == _u64Key)
-    {
-      /* The first cell has to be removed */
-      _pstHashTable->apstCell[u32Index] = pstCell->pstNext;
-      orxBank_Free(_pstHashTable->pstBank, pstCell);
+    orxU32 u32Next;
 
-      /* Operation succeed */
-      eStatus = orxSTATUS_SUCCESS;
-    }
-    else
+    /* Shifts back all following cells of the run that are allowed to move (home at or before the hole): no tombstones needed */
+    for(u32Next = u32Index + 1; _pstHashTable->au8Control[u32Next] != orxHASHTABLE_KU8_CONTROL_EMPTY; u32Next++)
     {
-      /* Traverse to find the key */
-      while(pstCell->pstNext != orxNULL && pstCell->pstNext->u64Key != _u64Key)
+      /* Can move to the hole? */
+      if(orxHashTable_GetHome(_pstHashTable, orxHashTable_GetHash(_pstHashTable->astCell[u32Next].u64Key)) <= u32Index)
       {
-        /* Try with next cell */
-        pstCell = pstCell->pstNext;
-      }
-
-      /* Cell found ? (key should be on the next cell) */
-      if(pstCell->pstNext != orxNULL)
-      {
-        orxHASHTABLE_CELL *pstRemoveCell;
-
-        /* We found it, remove this cell */
-        pstRemoveCell = pstCell->pstNext;
-        pstCell->pstNext = pstRemoveCell->pstNext;
-
-        /* Free cell from bank */
-        orxBank_Free(_pstHashTable->pstBank, pstRemoveCell);
+        /* Moves it */
+        _pstHashTable->astCell[u32Index]    = _pstHashTable->astCell[u32Next];
+        _pstHashTable->au8Control[u32Index] = _pstHashTable->au8Control[u32Next];
 
-        /* Operation succeed */
-        eStatus = orxSTATUS_SUCCESS;
+        /* Updates hole */
+        u32Index = u32Next;
       }
     }
-  }
 
-  /* Successful? */
-  if(eStatus != orxSTATUS_FAILURE)
-  {
+    /* Clears hole */
+    _pstHashTable->au8Control[u32Index] = orxHASHTABLE_KU8_CONTROL_EMPTY;
+
     /* Updates count */
     _pstHashTable->u32Count--;
+
+    /* Updates result */
+    eStatus = orxSTATUS_SUCCESS;
   }
 
   /* Profiles */
@@ -528,60 +809,44 @@ orxSTATUS orxFASTCALL orxHashTable_Remove(orxHASHTABLE *_pstHashTable, orxU64 _u
  */
 orxHANDLE orxFASTCALL orxHashTable_GetNext(const orxHASHTABLE *_pstHashTable, orxHANDLE _hIterator, orxU64 *_pu64Key, void **_ppData)
 {
-  orxHASHTABLE_CELL  *pstCell;
-  orxU32              u32Index;
-  orxHANDLE           hResult;
+  orxU32    u32Index;
+  orxHANDLE hResult = orxHANDLE_UNDEFINED;
 
   /* Checks */
   orxASSERT(_pstHashTable != orxNULL);
 
-  /* Has iterator? */
-  if((_hIterator != orxNULL) && (_hIterator != orxHANDLE_UNDEFINED))
-  {
-    /* Gets current cell */
-    pstCell = (orxHASHTABLE_CELL *)_hIterator;
-
-    /* Gets start index */
-    u32Index = orxHashTable_FindIndex(_pstHashTable, pstCell->u64Key) + 1;
-
-    /* Updates temporary result */
-    pstCell = pstCell->pstNext;
-  }
-  else
+  /* Gets start index: iterates backward, as removals only move cells toward lower indices, removing the current item is safe */
+  u32Index = ((_hIterator != orxNULL) && (_hIterator != orxHANDLE_UNDEFINED)) ? (orxU32)(size_t)_hIterator - 1 : _pstHashTable->u32Capacity;
+  if(u32Index > _pstHashTable->u32Capacity)
   {
-    /* Starts a new search */
-    u32Index  = 0;
-    pstCell   = orxNULL;
+    u32Index = _pstHashTable->u32Capacity;
   }
 
-  /* Finds next head cell if needed */
-  for(; (pstCell == orxNULL) && (u32Index < _pstHashTable->u32Size); pstCell = _pstHashTable->apstCell[u32Index++])
-  ;
-
-  /* Found? */
-  if(pstCell != orxNULL)
+  /* Finds previous used cell */
+  while(u32Index > 0)
   {
-    /* Asked for key? */
-    if(_pu64Key != orxNULL)
+    /* Used? */
+    if(_pstHashTable->au8Control[--u32Index] != orxHASHTABLE_KU8_CONTROL_EMPTY)
     {
-      /* Updates it */
-      *_pu64Key = pstCell->u64Key;
-    }
+      /* Asked for key? */
+      if(_pu64Key != orxNULL)
+      {
+        /* Updates it */
+        *_pu64Key = _pstHashTable->astCell[u32Index].u64Key;
+      }
 
-    /* Asked for data? */
-    if(_ppData != orxNULL)
-    {
-      /* Updates it */
-      *_ppData = pstCell->pData;
-    }
+      /* Asked for data? */
+      if(_ppData != orxNULL)
+      {
+        /* Updates it */
+        *_ppData = _pstHashTable->astCell[u32Index].pData;
+      }
 
-    /* Updates result */
-    hResult = (orxHANDLE)pstCell;
-  }
-  else
-  {
-    /* Updates result */
-    hResult = orxHANDLE_UNDEFINED;
+      /* Updates result */
+      hResult = (orxHANDLE)(size_t)(u32Index + 1);
+
+      break;
+    }
   }
 
   /* Done! */
@@ -594,86 +859,29 @@ orxHANDLE orxFASTCALL orxHashTable_GetNext(const orxHASHTABLE *_pstHashTable, or
  */
 orxSTATUS orxFASTCALL orxHashTable_Optimize(orxHASHTABLE *_pstHashTable)
 {
-  orxSTATUS eResult = orxSTATUS_SUCCESS;
+  orxU32    u32Size;
+  orxSTATUS eResult;
 
   /* Checks */
   orxASSERT(_pstHashTable != orxNULL);
 
-  /* Has elements? */
-  if(_pstHashTable->u32Count > 0)
+  /* Gets size for a load factor of at most 1/2 (shortest runs) */
+  u32Size = orxMath_GetNextPowerOfTwo(_pstHashTable->u32Count << 1);
+  if(u32Size < orxHASHTABLE_KU32_MIN_SIZE)
   {
-    orxHASHTABLE_CELL *astWorkBuffer;
-
-    /* Allocates work buffer */
-    astWorkBuffer = (orxHASHTABLE_CELL *)orxMemory_Allocate(_pstHashTable->u32Count * sizeof(orxHASHTABLE_CELL), orxMEMORY_TYPE_TEMP);
-
-    /* Valid? */
-    if(astWorkBuffer != orxNULL)
-    {
-      orxU64              u64KeyIndex;
-      orxU32              u32BufferIndex, i;
-      orxHASHTABLE_CELL  *pstCell;
-
-      /* For all cells */
-      for(i = 0, u64KeyIndex = 0, u32BufferIndex = 0, pstCell = orxNULL; i < _pstHashTable->u32Count; i++, u32BufferIndex++)
-      {
-        /* Linked cell? */
-        if((pstCell != orxNULL) && (pstCell->pstNext != orxNULL))
-        {
-          /* Gets next in line */
-          pstCell = pstCell->pstNext;
-        }
-        else
-        {
-          /* Finds next head cell */
-          do{pstCell = _pstHashTable->apstCell[u64KeyIndex++];} while(pstCell == orxNULL);
-        }
-
-        /* Stores it */
-        orxMemory_Copy(&astWorkBuffer[u32BufferIndex], pstCell, sizeof(orxHASHTABLE_CELL));
-      }
-
-      /* Clears bank */
-      orxBank_Clear(_pstHashTable->pstBank);
-
-      /* For all ordered cells */
-      for(i = 0, pstCell = orxNULL; i < _pstHashTable->u32Count; i++)
-      {
-        orxHASHTABLE_CELL *pstPreviousCell;
-
-        /* Allocates new cell */
-        pstPreviousCell = pstCell;
-        pstCell         = (orxHASHTABLE_CELL *)orxBank_Allocate(_pstHashTable->pstBank);
-
-        /* Checks */
-        orxASSERT(pstCell != orxNULL);
-
-        /* Stores its data */
-        orxMemory_Copy(pstCell, &astWorkBuffer[i], sizeof(orxHASHTABLE_CELL));
-
-        /* Chained? */
-        if((pstPreviousCell != orxNULL) && (pstPreviousCell->pstNext != orxNULL))
-        {
-          /* Updates chaining */
-          pstPreviousCell->pstNext = pstCell;
-        }
-        else
-        {
-          /* Updates head pointer */
-          _pstHashTable->apstCell[orxHashTable_FindIndex(_pstHashTable, pstCell->u64Key)] = pstCell;
-        }
-      }
+    u32Size = orxHASHTABLE_KU32_MIN_SIZE;
+  }
 
-      /* Clears work buffer */
-      orxMemory_Free(astWorkBuffer);
-    }
-    else
-    {
-      /* Updates result */
-      eResult = orxSTATUS_FAILURE;
-    }
+  /* Not expandable? */
+  if(orxFLAG_TEST(_pstHashTable->u32Flags, orxHASHTABLE_KU32_FLAG_NOT_EXPANDABLE))
+  {
+    /* Keeps current size */
+    u32Size = _pstHashTable->u32Size;
   }
 
+  /* Rebuilds table */
+  eResult = orxHashTable_Resize(_pstHashTable, u32Size);
+
   /* Done! */
   return eResult;
 }
@@ -35,7 +35,29 @@
 #include "debug/orxDebug.h"
 #include "debug/orxProfiler.h"
 #include "memory/orxMemory.h"
-#include "utils/orxHashTable.h"
+
+#ifndef __orxSTRING_LEGACY_ID__
+
+  #if defined(__orxX86_64__) || (defined(__orxX86__) && (defined(__SSE2__) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))))
+
+    #ifdef __orxMSVC__
+      #include <intrin.h>
+    #else /* __orxMSVC__ */
+      #include <cpuid.h>
+    #endif /* __orxMSVC__ */
+    #include <nmmintrin.h>
+
+    #define __orxSTRING_SSE42__
+
+  #elif (defined(__orxARM__) || defined(__orxARM64__)) && defined(__ARM_FEATURE_CRC32) && defined(__orxLITTLE_ENDIAN__)
+
+    #include <arm_acle.h>
+
+    #define __orxSTRING_ARM_CRC__
+
+  #endif
+
+#endif /* !__orxSTRING_LEGACY_ID__ */
 
 
 /** Module flags
@@ -50,25 +72,70 @@
 
 /** Defines
  */
-#define orxSTRING_KU32_ID_TABLE_SIZE                      32768
+#define orxSTRING_KU32_ID_TABLE_SIZE                      32768       /**< Initial ID table size (power of two) */
+#define orxSTRING_KU32_PAGE_SIZE                          65536       /**< Interned string page size */
 
 
 /***************************************************************************
  * CRC Tables (slice-by-8)                                                 *
  ***************************************************************************/
-orxU32 saau32CRCTable[8][256];
+static orxU32 saau32CRCTable[8][256];
+
+static orxU32 orxFASTCALL orxString_UpdateCRCSoftware(orxU32 _u32CRC, const orxU8 *_pu8Data, orxU32 _u32Size);
+
+/** CRC function, software by default so as to be usable before setup
+ */
+orxSTRING_CRC_FUNCTION spfnCRCFunction = &orxString_UpdateCRCSoftware;
 
 
 /***************************************************************************
  * Structure declaration                                                   *
  ***************************************************************************/
 
+/** Interned string page: append-only storage, each string is prefixed with its length
+ */
+typedef struct __orxSTRING_PAGE_t
+{
+  struct __orxSTRING_PAGE_t  *pstPrevious;                /**< Previous page */
+  orxU32                      u32Size;                    /**< Storage size */
+  orxU32                      u32Used;                    /**< Used storage size */
+
+} orxSTRING_PAGE;
+
+/** ID table entry
+ */
+typedef struct __orxSTRING_ID_ENTRY_t
+{
+  orxSTRINGID                 stID;                       /**< String ID */
+  const orxCHAR              *zString;                    /**< Interned string, orxNULL if the entry is empty (published last) */
+
+} orxSTRING_ID_ENTRY;
+
+/** ID table: open addressing, only ever appended to, replaced (but kept alive) when growing so that readers never need to lock
+ */
+#ifdef __orxMSVC__
+  #pragma warning(disable : 4200)
+#endif /* __orxMSVC__ */
+typedef struct __orxSTRING_ID_TABLE_t
+{
+  struct __orxSTRING_ID_TABLE_t  *pstPrevious;            /**< Previous (smaller) table */
+  orxU32                          u32Size;                /**< Number of entries (power of two) */
+  orxSTRING_ID_ENTRY              astEntry[0];            /**< Entries */
+
+} orxSTRING_ID_TABLE;
+#ifdef __orxMSVC__
+  #pragma warning(default : 4200)
+#endif /* __orxMSVC__ */
+
 /** Static structure
  */
 typedef struct __orxSTRING_STATIC_t
 {
-  orxHASHTABLE *pstIDTable;                               /** String ID table */
-  orxU32        u32Flags;                                 /**< Control flags */
+  orxSTRING_ID_TABLE * volatile pstIDTable;               /**< String ID table */
+  orxSTRING_PAGE               *pstPage;                  /**< Current interned string page */
+  orxU32                        u32Count;                 /**< Interned string count */
+  volatile orxU32               u32Lock;                  /**< Writer lock */
+  orxU32                        u32Flags;                 /**< Control flags */
 
 } orxSTRING_STATIC;
 
@@ -86,6 +153,480 @@ static orxSTRING_STATIC sstString;
  * Private functions                                                       *
  ***************************************************************************/
 
+/** Updates a CRC, slice-by-8
+ */
+static orxU32 orxFASTCALL orxString_UpdateCRCSoftware(orxU32 _u32CRC, const orxU8 *_pu8Data, orxU32 _u32Size)
+{
+  orxU32 u32CRC;
+
+#ifdef __orxLITTLE_ENDIAN__
+
+#define orxCRC_GET_FIRST(VALUE) VALUE
+#define orxCRC_INDEX_0          0
+#define orxCRC_INDEX_1          1
+#define orxCRC_INDEX_2          2
+#define orxCRC_INDEX_3          3
+#define orxCRC_INDEX_4          4
+#define orxCRC_INDEX_5          5
+#define orxCRC_INDEX_6          6
+#define orxCRC_INDEX_7          7
+
+#else /* __orxLITTLE_ENDIAN__ */
+
+#define orxCRC_GET_FIRST(VALUE) (((VALUE) >> 24) | (((VALUE) >> 8) & 0x0000FF00) | (((VALUE) << 8) & 0x00FF0000) | ((VALUE) << 24))
+#define orxCRC_INDEX_0          3
+#define orxCRC_INDEX_1          2
+#define orxCRC_INDEX_2          1
+#define orxCRC_INDEX_3          0
+#define orxCRC_INDEX_4          7
+#define orxCRC_INDEX_5          6
+#define orxCRC_INDEX_6          5
+#define orxCRC_INDEX_7          4
+
+#endif /* __orxLITTLE_ENDIAN__ */
+
+  /* For all slices */
+  for(u32CRC = _u32CRC; _u32Size >= 8; _u32Size -= 8, _pu8Data += 8)
+  {
+    orxU32 u32First, u32Second;
+
+    /* Gets the slice's data */
+    orxMemory_Copy(&u32First, _pu8Data, sizeof(orxU32));
+    orxMemory_Copy(&u32Second, _pu8Data + 4, sizeof(orxU32));
+    u32First ^= orxCRC_GET_FIRST(u32CRC);
+
+    /* Updates the CRC */
+    u32CRC  = saau32CRCTable[orxCRC_INDEX_7][u32First & 0xFF]
+            ^ saau32CRCTable[orxCRC_INDEX_6][(u32First >> 8) & 0xFF]
+            ^ saau32CRCTable[orxCRC_INDEX_5][(u32First >> 16) & 0xFF]
+            ^ saau32CRCTable[orxCRC_INDEX_4][u32First >> 24]
+            ^ saau32CRCTable[orxCRC_INDEX_3][u32Second & 0xFF]
+            ^ saau32CRCTable[orxCRC_INDEX_2][(u32Second >> 8) & 0xFF]
+            ^ saau32CRCTable[orxCRC_INDEX_1][(u32Second >> 16) & 0xFF]
+            ^ saau32CRCTable[orxCRC_INDEX_0][u32Second >> 24];
+  }
+
+  /* For all remaining characters */
+  for(; _u32Size != 0; _u32Size--, _pu8Data++)
+  {
+    /* Updates the CRC */
+    u32CRC = saau32CRCTable[0][((orxU8)(u32CRC & 0xFF)) ^ *_pu8Data] ^ (u32CRC >> 8);
+  }
+
+#undef orxCRC_GET_FIRST
+#undef orxCRC_INDEX_0
+#undef orxCRC_INDEX_1
+#undef orxCRC_INDEX_2
+#undef orxCRC_INDEX_3
+#undef orxCRC_INDEX_4
+#undef orxCRC_INDEX_5
+#undef orxCRC_INDEX_6
+#undef orxCRC_INDEX_7
+
+  /* Done! */
+  return u32CRC;
+}
+
+#ifdef __orxSTRING_SSE42__
+
+/** Is SSE4.2 supported?
+ */
+static orxBOOL orxFASTCALL orxString_HasHardwareCRC()
+{
+  orxBOOL bResult;
+
+#ifdef __orxMSVC__
+
+  int ai32Info[4];
+
+  /* Gets CPU features */
+  __cpuid(ai32Info, 1);
+
+  /* Updates result */
+  bResult = (ai32Info[2] & (1 << 20)) ? orxTRUE : orxFALSE;
+
+#else /* __orxMSVC__ */
+
+  unsigned int u32EAX, u32EBX, u32ECX, u32EDX;
+
+  /* Updates result */
+  bResult = (__get_cpuid(1, &u32EAX, &u32EBX, &u32ECX, &u32EDX) && (u32ECX & bit_SSE4_2)) ? orxTRUE : orxFALSE;
+
+#endif /* __orxMSVC__ */
+
+  /* Done! */
+  return bResult;
+}
+
+/** Updates a CRC, SSE4.2
+ */
+#ifndef __orxMSVC__
+__attribute__((target("sse4.2")))
+#endif /* !__orxMSVC__ */
+static orxU32 orxFASTCALL orxString_UpdateCRCHardware(orxU32 _u32CRC, const orxU8 *_pu8Data, orxU32 _u32Size)
+{
+  orxU32 u32CRC;
+
+#ifdef __orxX86_64__
+
+  orxU64 u64CRC;
+
+  /* For all 16-byte blocks */
+  for(u64CRC = _u32CRC; _u32Size >= 16; _u32Size -= 16, _pu8Data += 16)
+  {
+    orxU64 u64First, u64Second;
+
+    /* Gets the block's data */
+    orxMemory_Copy(&u64First, _pu8Data, sizeof(orxU64));
+    orxMemory_Copy(&u64Second, _pu8Data + 8, sizeof(orxU64));
+
+    /* Updates the CRC */
+    u64CRC = _mm_crc32_u64(u64CRC, u64First);
+    u64CRC = _mm_crc32_u64(u64CRC, u64Second);
+  }
+
+  /* Has an 8-byte block left? */
+  if(_u32Size >= 8)
+  {
+    orxU64 u64Value;
+
+    /* Updates the CRC */
+    orxMemory_Copy(&u64Value, _pu8Data, sizeof(orxU64));
+    u64CRC    = _mm_crc32_u64(u64CRC, u64Value);
+    _u32Size -= 8;
+    _pu8Data += 8;
+  }
+  u32CRC = (orxU32)u64CRC;
+
+#else /* __orxX86_64__ */
+
+  /* For all 8-byte blocks */
+  for(u32CRC = _u32CRC; _u32Size >= 8; _u32Size -= 8, _pu8Data += 8)
+  {
+    orxU32 u32First, u32Second;
+
+    /* Gets the block's data */
+    orxMemory_Copy(&u32First, _pu8Data, sizeof(orxU32));
+    orxMemory_Copy(&u32Second, _pu8Data + 4, sizeof(orxU32));
+
+    /* Updates the CRC */
+    u32CRC = _mm_crc32_u32(u32CRC, u32First);
+    u32CRC = _mm_crc32_u32(u32CRC, u32Second);
+  }
+
+#endif /* __orxX86_64__ */
+
+  /* Has a 4-byte block left? */
+  if(_u32Size >= 4)
+  {
+    orxU32 u32Value;
+
+    /* Updates the CRC */
+    orxMemory_Copy(&u32Value, _pu8Data, sizeof(orxU32));
+    u32CRC    = _mm_crc32_u32(u32CRC, u32Value);
+    _u32Size -= 4;
+    _pu8Data += 4;
+  }
+
+  /* Has a 2-byte block left? */
+  if(_u32Size >= 2)
+  {
+    orxU16 u16Value;
+
+    /* Updates the CRC */
+    orxMemory_Copy(&u16Value, _pu8Data, sizeof(orxU16));
+    u32CRC    = _mm_crc32_u16(u32CRC, u16Value);
+    _u32Size -= 2;
+    _pu8Data += 2;
+  }
+
+  /* Has a character left? */
+  if(_u32Size != 0)
+  {
+    /* Updates the CRC */
+    u32CRC = _mm_crc32_u8(u32CRC, *_pu8Data);
+  }
+
+  /* Done! */
+  return u32CRC;
+}
+
+#elif defined(__orxSTRING_ARM_CRC__)
+
+/** Updates a CRC, ARMv8 CRC32 extension
+ */
+static orxU32 orxFASTCALL orxString_UpdateCRCHardware(orxU32 _u32CRC, const orxU8 *_pu8Data, orxU32 _u32Size)
+{
+  orxU32 u32CRC;
+
+  /* For all 8-byte blocks */
+  for(u32CRC = _u32CRC; _u32Size >= 8; _u32Size -= 8, _pu8Data += 8)
+  {
+    orxU64 u64Value;
+
+    /* Updates the CRC */
+    orxMemory_Copy(&u64Value, _pu8Data, sizeof(orxU64));
+    u32CRC = __crc32cd(u32CRC, u64Value);
+  }
+
+  /* For all remaining characters */
+  for(; _u32Size != 0; _u32Size--, _pu8Data++)
+  {
+    /* Updates the CRC */
+    u32CRC = __crc32cb(u32CRC, *_pu8Data);
+  }
+
+  /* Done! */
+  return u32CRC;
+}
+
+#endif /* __orxSTRING_ARM_CRC__ */
+
+/** Creates an ID table
+ * @param[in]   _u32Size        Number of entries (power of two)
+ * @return      orxSTRING_ID_TABLE / orxNULL
+ */
+static orxSTRING_ID_TABLE *orxFASTCALL orxString_CreateIDTable(orxU32 _u32Size)
+{
+  orxSTRING_ID_TABLE *pstResult;
+
+  /* Checks */
+  orxASSERT(orxMath_IsPowerOfTwo(_u32Size) != orxFALSE);
+
+  /* Allocates it */
+  pstResult = (orxSTRING_ID_TABLE *)orxMemory_Allocate(sizeof(orxSTRING_ID_TABLE) + _u32Size * sizeof(orxSTRING_ID_ENTRY), orxMEMORY_TYPE_STRING);
+
+  /* Success? */
+  if(pstResult != orxNULL)
+  {
+    /* Inits it */
+    orxMemory_Zero(pstResult, sizeof(orxSTRING_ID_TABLE) + _u32Size * sizeof(orxSTRING_ID_ENTRY));
+    pstResult->u32Size = _u32Size;
+  }
+
+  /* Done! */
+  return pstResult;
+}
+
+/** Finds an interned string (lock-free)
+ * @param[in]   _stID           Concerned string ID
+ * @return      Interned string if found, orxNULL otherwise
+ */
+static orxINLINE const orxCHAR *orxString_FindID(orxSTRINGID _stID)
+{
+  const orxSTRING_ID_TABLE *pstTable;
+  orxU32                    u32Index;
+  const orxCHAR            *zResult;
+
+  /* Gets current table */
+  pstTable = (const orxSTRING_ID_TABLE *)orxMEMORY_ATOMIC_LOAD_POINTER(&(sstString.pstIDTable));
+
+  /* Probes it till an empty entry is met (IDs are CRCs, their low bits are well distributed) */
+  for(u32Index = (orxU32)_stID & (pstTable->u32Size - 1);
+      ((zResult = (const orxCHAR *)orxMEMORY_ATOMIC_LOAD_POINTER(&(pstTable->astEntry[u32Index].zString))) != orxNULL) && (pstTable->astEntry[u32Index].stID != _stID);
+      u32Index = (u32Index + 1) & (pstTable->u32Size - 1))
+  ;
+
+  /* Done! */
+  return zResult;
+}
+
+/** Adds an entry to an ID table (writer lock needs to be held)
+ * @param[in]   _pstTable       Concerned table
+ * @param[in]   _stID           String ID
+ * @param[in]   _zString        Interned string
+ */
+static orxINLINE void orxString_AddIDEntry(orxSTRING_ID_TABLE *_pstTable, orxSTRINGID _stID, const orxCHAR *_zString)
+{
+  orxU32 u32Index;
+
+  /* Finds empty entry */
+  for(u32Index = (orxU32)_stID & (_pstTable->u32Size - 1);
+      _pstTable->astEntry[u32Index].zString != orxNULL;
+      u32Index = (u32Index + 1) & (_pstTable->u32Size - 1))
+  ;
+
+  /* Stores ID */
+  _pstTable->astEntry[u32Index].stID = _stID;
+
+  /* Publishes string (readers check it first) */
+  orxMEMORY_BARRIER();
+  _pstTable->astEntry[u32Index].zString = _zString;
+}
+
+/** Interns a string (writer lock needs to be held)
+ * @param[in]   _zString        String to intern
+ * @param[in]   _stID           String's ID
+ * @return      Interned string / orxNULL
+ */
+static const orxCHAR *orxFASTCALL orxString_Intern(const orxSTRING _zString, orxSTRINGID _stID)
+{
+  orxSTRING_ID_TABLE *pstTable;
+  orxU32              u32Length, u32Size;
+  orxCHAR            *zResult = orxNULL;
+
+  /* Gets current table */
+  pstTable = sstString.pstIDTable;
+
+  /* Above 3/4 load factor? */
+  if((sstString.u32Count + 1) * 4 > pstTable->u32Size * 3)
+  {
+    orxSTRING_ID_TABLE *pstNewTable;
+
+    /* Creates a bigger table */
+    pstNewTable = orxString_CreateIDTable(pstTable->u32Size << 1);
+
+    /* Success? */
+    if(pstNewTable != orxNULL)
+    {
+      orxU32 i;
+
+      /* Copies all entries */
+      for(i = 0; i < pstTable->u32Size; i++)
+      {
+        /* Used? */
+        if(pstTable->astEntry[i].zString != orxNULL)
+        {
+          /* Adds it */
+          orxString_AddIDEntry(pstNewTable, pstTable->astEntry[i].stID, pstTable->astEntry[i].zString);
+        }
+      }
+
+      /* Keeps previous table alive, as readers might still be using it */
+      pstNewTable->pstPrevious = pstTable;
+
+      /* Publishes it */
+      orxMEMORY_ATOMIC_EXCHANGE_POINTER(&(sstString.pstIDTable), pstNewTable);
+      pstTable = pstNewTable;
+    }
+    else
+    {
+      /* Logs message */
+      orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Couldn't grow StringID table to %u entries.", pstTable->u32Size << 1);
+
+      /* Full? */
+      if(sstString.u32Count + 1 >= pstTable->u32Size)
+      {
+        /* Done! */
+        return orxNULL;
+      }
+    }
+  }
+
+  /* Gets storage size: length prefix + characters + terminal null, aligned */
+  u32Length = orxString_GetLength(_zString);
+  u32Size   = orxALIGN(sizeof(orxU32) + u32Length + 1, sizeof(orxU32));
+
+  /* Not enough room in current page? */
+  if((sstString.pstPage == orxNULL) || (sstString.pstPage->u32Used + u32Size > sstString.pstPage->u32Size))
+  {
+    orxSTRING_PAGE *pstPage;
+    orxU32          u32PageSize;
+
+    /* Gets page size (oversized strings get their own page) */
+    u32PageSize = (u32Size > orxSTRING_KU32_PAGE_SIZE - sizeof(orxSTRING_PAGE)) ? u32Size : orxSTRING_KU32_PAGE_SIZE - sizeof(orxSTRING_PAGE);
+
+    /* Allocates new page */
+    pstPage = (orxSTRING_PAGE *)orxMemory_Allocate(sizeof(orxSTRING_PAGE) + u32PageSize, orxMEMORY_TYPE_STRING);
+
+    /* Success? */
+    if(pstPage != orxNULL)
+    {
+      /* Inits it */
+      pstPage->u32Size  = u32PageSize;
+      pstPage->u32Used  = 0;
+
+      /* Oversized and has a current page? */
+      if((u32PageSize != orxSTRING_KU32_PAGE_SIZE - sizeof(orxSTRING_PAGE)) && (sstString.pstPage != orxNULL))
+      {
+        /* Inserts it behind current page, keeping current one for further appends */
+        pstPage->pstPrevious              = sstString.pstPage->pstPrevious;
+        sstString.pstPage->pstPrevious    = pstPage;
+      }
+      else
+      {
+        /* Makes it current */
+        pstPage->pstPrevious              = sstString.pstPage;
+        sstString.pstPage                 = pstPage;
+      }
+
+      /* Stores string */
+      *(orxU32 *)((orxU8 *)(pstPage + 1) + pstPage->u32Used) = u32Length;
+      zResult = (orxCHAR *)(pstPage + 1) + pstPage->u32Used + sizeof(orxU32);
+      pstPage->u32Used += u32Size;
+    }
+  }
+  else
+  {
+    /* Stores string */
+    *(orxU32 *)((orxU8 *)(sstString.pstPage + 1) + sstString.pstPage->u32Used) = u32Length;
+    zResult = (orxCHAR *)(sstString.pstPage + 1) + sstString.pstPage->u32Used + sizeof(orxU32);
+    sstString.pstPage->u32Used += u32Size;
+  }
+
+  /* Success? */
+  if(zResult != orxNULL)
+  {
+    /* Copies characters */
+    orxMemory_Copy(zResult, _zString, u32Length + 1);
+
+    /* Adds it to table */
+    orxString_AddIDEntry(pstTable, _stID, zResult);
+
+    /* Updates count */
+    sstString.u32Count++;
+  }
+
+  /* Done! */
+  return zResult;
+}
+
+/** Gets an interned string, interning it if needed
+ * @param[in]   _zString        Concerned string
+ * @param[in]   _stID           String's ID
+ * @return      Interned string
+ */
+static orxINLINE const orxCHAR *orxString_GetInterned(const orxSTRING _zString, orxSTRINGID _stID)
+{
+  const orxCHAR *zResult;
+
+  /* Looks for it without locking */
+  zResult = orxString_FindID(_stID);
+
+  /* Not found? */
+  if(zResult == orxNULL)
+  {
+    /* Locks writers */
+    while(orxMEMORY_ATOMIC_CAS_U32(&(sstString.u32Lock), 0, 1) == orxFALSE)
+      ;
+
+    /* Still not found (another thread might have interned it meanwhile)? */
+    zResult = orxString_FindID(_stID);
+    if(zResult == orxNULL)
+    {
+      /* Interns it */
+      zResult = orxString_Intern(_zString, _stID);
+
+      /* Checks */
+      orxASSERT(zResult != orxNULL);
+    }
+
+    /* Unlocks writers */
+    orxMEMORY_ATOMIC_CAS_U32(&(sstString.u32Lock), 1, 0);
+  }
+#ifdef __orxDEBUG__
+  /* Different strings (compares stored lengths first)? */
+  if((zResult != orxNULL) && ((*((const orxU32 *)zResult - 1) != orxString_GetLength(_zString)) || (orxString_Compare(_zString, zResult) != 0)))
+  {
+    /* Logs message */
+    orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Error: string ID collision detected between <%s> and <%s>: please modify one of them or you might end up with undefined result.", zResult, _zString);
+  }
+#endif /* __orxDEBUG__ */
+
+  /* Done! */
+  return zResult;
+}
+
 
 /***************************************************************************
  * Public functions                                                        *
@@ -132,6 +673,18 @@ void orxFASTCALL orxString_Setup()
     }
   }
 
+#if defined(__orxSTRING_SSE42__)
+
+  /* Selects CRC function */
+  spfnCRCFunction = (orxString_HasHardwareCRC() != orxFALSE) ? &orxString_UpdateCRCHardware : &orxString_UpdateCRCSoftware;
+
+#elif defined(__orxSTRING_ARM_CRC__)
+
+  /* Selects CRC function */
+  spfnCRCFunction = &orxString_UpdateCRCHardware;
+
+#endif
+
   /* Adds module dependencies */
   orxModule_AddDependency(orxMODULE_ID_STRING, orxMODULE_ID_MEMORY);
   orxModule_AddDependency(orxMODULE_ID_STRING, orxMODULE_ID_BANK);
@@ -155,7 +708,7 @@ orxSTATUS orxFASTCALL orxString_Init()
     orxMemory_Zero(&sstString, sizeof(orxSTRING_STATIC));
 
     /* Creates ID table */
-    sstString.pstIDTable = orxHashTable_Create(orxSTRING_KU32_ID_TABLE_SIZE, orxHASHTABLE_KU32_FLAG_NONE, orxMEMORY_TYPE_MAIN);
+    sstString.pstIDTable = orxString_CreateIDTable(orxSTRING_KU32_ID_TABLE_SIZE);
 
     /* Success? */
     if(sstString.pstIDTable != orxNULL)
@@ -192,21 +745,30 @@ void orxFASTCALL orxString_Exit()
   /* Initialized? */
   if(sstString.u32Flags & orxSTRING_KU32_STATIC_FLAG_READY)
   {
-    orxU64    u64Key;
-    orxHANDLE hIterator;
-    orxSTRING zString;
-
-    /* For all string IDs */
-    for(hIterator = orxHashTable_GetNext(sstString.pstIDTable, orxHANDLE_UNDEFINED, &u64Key, (void **)&zString);
-        hIterator != orxHANDLE_UNDEFINED;
-        hIterator = orxHashTable_GetNext(sstString.pstIDTable, hIterator, &u64Key, (void **)&zString))
+    orxSTRING_ID_TABLE *pstTable;
+    orxSTRING_PAGE     *pstPage;
+
+    /* Deletes all ID tables */
+    for(pstTable = sstString.pstIDTable; pstTable != orxNULL;)
     {
-      /* Deletes its string */
-      orxString_Delete(zString);
+      orxSTRING_ID_TABLE *pstPrevious;
+
+      /* Deletes it */
+      pstPrevious = pstTable->pstPrevious;
+      orxMemory_Free(pstTable);
+      pstTable = pstPrevious;
     }
 
-    /* Deletes ID table */
-    orxHashTable_Delete(sstString.pstIDTable);
+    /* Deletes all pages */
+    for(pstPage = sstString.pstPage; pstPage != orxNULL;)
+    {
+      orxSTRING_PAGE *pstPrevious;
+
+      /* Deletes it */
+      pstPrevious = pstPage->pstPrevious;
+      orxMemory_Free(pstPage);
+      pstPage = pstPrevious;
+    }
 
     /* Updates flags */
     sstString.u32Flags &= ~orxSTRING_KU32_STATIC_FLAG_READY;
@@ -227,8 +789,7 @@ void orxFASTCALL orxString_Exit()
  */
 orxSTRINGID orxFASTCALL orxString_GetID(const orxSTRING _zString)
 {
-  const orxSTRING  *pzBucket;
-  orxSTRINGID       stResult = 0;
+  orxSTRINGID stResult = 0;
 
   /* Profiles */
   orxPROFILER_PUSH_MARKER("orxString_GetID");
@@ -240,29 +801,8 @@ orxSTRINGID orxFASTCALL orxString_GetID(const orxSTRING _zString)
   /* Gets its ID */
   stResult = orxString_ToCRC(_zString);
 
-  /* Gets stored string bucket */
-  pzBucket = (const orxSTRING *)orxHashTable_Retrieve(sstString.pstIDTable, stResult);
-
-  /* Checks */
-  orxASSERT(pzBucket != orxNULL);
-
-  /* Not already stored? */
-  if(*pzBucket == orxNULL)
-  {
-    /* Adds it */
-    *pzBucket = orxString_Duplicate(_zString);
-  }
-#ifdef __orxDEBUG__
-  else
-  {
-    /* Different strings? */
-    if(orxString_Compare(_zString, *pzBucket) != 0)
-    {
-      /* Logs message */
-      orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Error: string ID collision detected between <%s> and <%s>: please modify one of them or you might end up with undefined result.", *pzBucket, _zString);
-    }
-  }
-#endif /* __orxDEBUG__ */
+  /* Interns it */
+  orxString_GetInterned(_zString, stResult);
 
   /* Profiles */
   orxPROFILER_POP_MARKER();
@@ -282,8 +822,11 @@ const orxSTRING orxFASTCALL orxString_GetFromID(orxSTRINGID _stID)
   /* Profiles */
   orxPROFILER_PUSH_MARKER("orxString_GetFromID");
 
+  /* Checks */
+  orxASSERT(sstString.u32Flags & orxSTRING_KU32_STATIC_FLAG_READY);
+
   /* Gets string from table */
-  zResult = (const orxSTRING)orxHashTable_Get(sstString.pstIDTable, _stID);
+  zResult = (const orxSTRING)orxString_FindID(_stID);
 
   /* Invalid? */
   if(zResult == orxNULL)
@@ -305,9 +848,7 @@ const orxSTRING orxFASTCALL orxString_GetFromID(orxSTRINGID _stID)
  */
 const orxSTRING orxFASTCALL orxString_Store(const orxSTRING _zString)
 {
-  const orxSTRING  *pzBucket;
-  const orxSTRING   zResult;
-  orxSTRINGID       stID;
+  const orxSTRING zResult;
 
   /* Profiles */
   orxPROFILER_PUSH_MARKER("orxString_Store");
@@ -316,38 +857,8 @@ const orxSTRING orxFASTCALL orxString_Store(const orxSTRING _zString)
   orxASSERT(sstString.u32Flags & orxSTRING_KU32_STATIC_FLAG_READY);
   orxASSERT(_zString != orxNULL);
 
-  /* Gets its ID */
-  stID = orxString_ToCRC(_zString);
-
-  /* Gets stored string bucket */
-  pzBucket = (const orxSTRING *)orxHashTable_Retrieve(sstString.pstIDTable, stID);
-
-  /* Checks */
-  orxASSERT(pzBucket != orxNULL);
-
-  /* Not already stored? */
-  if(*pzBucket == orxNULL)
-  {
-    /* Updates result */
-    zResult = orxString_Duplicate(_zString);
-
-    /* Adds it to table */
-    *pzBucket = zResult;
-  }
-  else
-  {
-    /* Gets it */
-    zResult = *pzBucket;
-
-#ifdef __orxDEBUG__
-    /* Different strings? */
-    if(orxString_Compare(_zString, zResult) != 0)
-    {
-      /* Logs message */
-      orxDEBUG_PRINT(orxDEBUG_LEVEL_SYSTEM, "Error: string ID collision detected between <%s> and <%s>: please modify one of them or you might end up with undefined result.", zResult, _zString);
-    }
-#endif /* __orxDEBUG__ */
-  }
+  /* Gets its interned version */
+  zResult = (const orxSTRING)orxString_GetInterned(_zString, orxString_ToCRC(_zString));
 
   /* Profiles */
   orxPROFILER_POP_MARKER();
@@ -355,3 +866,12 @@ const orxSTRING orxFASTCALL orxString_Store(const orxSTRING _zString)
   /* Done! */
   return zResult;
 }
+
+/** Gets the ID format version the library was built with (IDs of different versions aren't compatible)
+ * @return      orxSTRING_KU32_ID_VERSION of the library
+ */
+orxU32 orxFASTCALL orxString_GetIDVersion()
+{
+  /* Done! */
+  return orxSTRING_KU32_ID_VERSION;
+}
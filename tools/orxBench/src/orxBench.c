@@ -0,0 +1,778 @@
+/* Orx - Portable Game Engine
+ *
+ * Copyright (c) 2008-2019 Orx-Project
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ *    1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ *
+ *    2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ *
+ *    3. This notice may not be removed or altered from any source
+ *    distribution.
+ */
+
+/**
+ * @file orxBench.c
+ *
+ */
+
+
+#include "orx.h"
+
+
+/** Module flags
+ */
+#define orxBENCH_KU32_STATIC_FLAG_NONE            0x00000000  /**< No flags */
+
+#define orxBENCH_KU32_STATIC_FLAG_HASHTABLE       0x00000001  /**< Hashtable suite flag */
+#define orxBENCH_KU32_STATIC_FLAG_CRC             0x00000002  /**< CRC suite flag */
+#define orxBENCH_KU32_STATIC_FLAG_EVENT           0x00000004  /**< Event suite flag */
+
+#define orxBENCH_KU32_STATIC_MASK_SUITE           0x0000FFFF  /**< Suite mask */
+#define orxBENCH_KU32_STATIC_MASK_ALL             0xFFFFFFFF  /**< All mask */
+
+
+/** Defines
+ */
+#define orxBENCH_KZ_LOG_TAG_LENGTH                "10"
+
+#define orxBENCH_KU32_HASHTABLE_SMALL_HINT        16          /**< Small hashtable creation hint, as used by most engine tables */
+
+#define orxBENCH_KU32_CRC_COUNT                   4000000     /**< Number of CRCs computed per key */
+#define orxBENCH_KU32_CRC_POLYNOMIAL              0xEDB88320U /**< Reference CRC polynomial (CRC32B, ID format version 1) */
+
+#define orxBENCH_KU32_EVENT_COUNT                 1000000     /**< Number of events sent/posted for timings */
+#define orxBENCH_KU32_EVENT_CHECK_COUNT           100         /**< Number of events posted per check */
+#define orxBENCH_KU32_EVENT_THREAD_NUMBER         4           /**< Number of posting threads */
+#define orxBENCH_KU32_EVENT_THREAD_COUNT          1000        /**< Number of events posted per thread */
+
+#if defined(__orxGCC__) || defined(__orxLLVM__)
+
+  #define orxBENCH_LOG(TAG, FORMAT, ...) orxLOG(orxANSI_KZ_COLOR_FG_YELLOW "%-" orxBENCH_KZ_LOG_TAG_LENGTH "s" orxANSI_KZ_COLOR_FG_DEFAULT FORMAT, "[" #TAG "]", ##__VA_ARGS__)
+
+#else // __orxGCC__ || __orxLLVM__
+
+  #define orxBENCH_LOG(TAG, FORMAT, ...) orxLOG(orxANSI_KZ_COLOR_FG_YELLOW "%-" orxBENCH_KZ_LOG_TAG_LENGTH "s" orxANSI_KZ_COLOR_FG_DEFAULT FORMAT, "[" #TAG "]", __VA_ARGS__)
+
+#endif //__orxGCC__ || __orxLLVM__
+
+
+/***************************************************************************
+ * Structure declaration                                                   *
+ ***************************************************************************/
+
+/** Chained hashtable cell (reference implementation: fixed bucket count, colliding cells chained through a bank)
+ */
+typedef struct __orxBENCH_CHAINED_CELL_t
+{
+  orxU64                                u64Key;
+  void                                 *pData;
+  struct __orxBENCH_CHAINED_CELL_t     *pstNext;
+
+} orxBENCH_CHAINED_CELL;
+
+/** Chained hashtable
+ */
+typedef struct __orxBENCH_CHAINED_TABLE_t
+{
+  orxBANK                *pstBank;
+  orxBENCH_CHAINED_CELL **apstCell;
+  orxU32                  u32Size;
+
+} orxBENCH_CHAINED_TABLE;
+
+/** Event payload
+ */
+typedef struct __orxBENCH_EVENT_PAYLOAD_t
+{
+  orxU32      u32Thread;
+  orxU32      u32Index;
+
+} orxBENCH_EVENT_PAYLOAD;
+
+/** Static structure
+ */
+typedef struct __orxBENCH_STATIC_t
+{
+  orxU32      aau32CRCTable[8][256];
+  orxU32      au32EventIndex[orxBENCH_KU32_EVENT_THREAD_NUMBER + 1];
+  orxU64      u64Seed;
+  orxU32      u32EventCount;
+  orxU32      u32BatchEventCount;
+  orxU32      u32BatchCount;
+  orxBOOL     bEventOrdered;
+  orxU32      u32Flags;
+
+} orxBENCH_STATIC;
+
+
+/***************************************************************************
+ * Static variables                                                        *
+ ***************************************************************************/
+
+/** static data
+ */
+static orxBENCH_STATIC sstBench;
+
+/** Result sink, prevents lookups from being optimized out
+ */
+static volatile orxU64 su64Sink;
+
+
+/***************************************************************************
+ * Private functions                                                       *
+ ***************************************************************************/
+
+static orxINLINE orxU64 GetRandomKey()
+{
+  // Updates seed (xorshift64*)
+  sstBench.u64Seed ^= sstBench.u64Seed >> 12;
+  sstBench.u64Seed ^= sstBench.u64Seed << 25;
+  sstBench.u64Seed ^= sstBench.u64Seed >> 27;
+
+  // Done!
+  return sstBench.u64Seed * 0x2545F4914F6CDD1DULL;
+}
+
+static orxBENCH_CHAINED_TABLE *ChainedTable_Create(orxU32 _u32NbKey)
+{
+  orxBENCH_CHAINED_TABLE *pstResult;
+
+  // Allocates table
+  pstResult = (orxBENCH_CHAINED_TABLE *)orxMemory_Allocate(sizeof(orxBENCH_CHAINED_TABLE), orxMEMORY_TYPE_TEMP);
+  orxASSERT(pstResult);
+
+  // Inits it
+  pstResult->u32Size  = orxMath_GetNextPowerOfTwo(_u32NbKey);
+  pstResult->apstCell = (orxBENCH_CHAINED_CELL **)orxMemory_Allocate(pstResult->u32Size * sizeof(orxBENCH_CHAINED_CELL *), orxMEMORY_TYPE_TEMP);
+  pstResult->pstBank  = orxBank_Create((orxU16)orxMIN(pstResult->u32Size, 4096), sizeof(orxBENCH_CHAINED_CELL), orxBANK_KU32_FLAG_NONE, orxMEMORY_TYPE_TEMP);
+  orxASSERT(pstResult->apstCell && pstResult->pstBank);
+  orxMemory_Zero(pstResult->apstCell, pstResult->u32Size * sizeof(orxBENCH_CHAINED_CELL *));
+
+  // Done!
+  return pstResult;
+}
+
+static void ChainedTable_Delete(orxBENCH_CHAINED_TABLE *_pstTable)
+{
+  // Frees all
+  orxBank_Delete(_pstTable->pstBank);
+  orxMemory_Free(_pstTable->apstCell);
+  orxMemory_Free(_pstTable);
+}
+
+static void *ChainedTable_Get(const orxBENCH_CHAINED_TABLE *_pstTable, orxU64 _u64Key)
+{
+  orxBENCH_CHAINED_CELL *pstCell;
+
+  // Finds cell
+  for(pstCell = _pstTable->apstCell[(orxU32)_u64Key & (_pstTable->u32Size - 1)];
+      (pstCell != orxNULL) && (pstCell->u64Key != _u64Key);
+      pstCell = pstCell->pstNext)
+  ;
+
+  // Done!
+  return (pstCell != orxNULL) ? pstCell->pData : orxNULL;
+}
+
+static void ChainedTable_Add(orxBENCH_CHAINED_TABLE *_pstTable, orxU64 _u64Key, void *_pData)
+{
+  orxBENCH_CHAINED_CELL *pstCell;
+  orxU32                 u32Index;
+
+  // Gets index
+  u32Index = (orxU32)_u64Key & (_pstTable->u32Size - 1);
+
+  // Creates cell
+  pstCell = (orxBENCH_CHAINED_CELL *)orxBank_Allocate(_pstTable->pstBank);
+  orxASSERT(pstCell);
+
+  // Inserts it
+  pstCell->u64Key               = _u64Key;
+  pstCell->pData                = _pData;
+  pstCell->pstNext              = _pstTable->apstCell[u32Index];
+  _pstTable->apstCell[u32Index] = pstCell;
+}
+
+static void ChainedTable_Remove(orxBENCH_CHAINED_TABLE *_pstTable, orxU64 _u64Key)
+{
+  orxBENCH_CHAINED_CELL **ppstCell;
+
+  // Finds cell link
+  for(ppstCell = &(_pstTable->apstCell[(orxU32)_u64Key & (_pstTable->u32Size - 1)]);
+      (*ppstCell != orxNULL) && ((*ppstCell)->u64Key != _u64Key);
+      ppstCell = &((*ppstCell)->pstNext))
+  ;
+
+  // Found?
+  if(*ppstCell != orxNULL)
+  {
+    orxBENCH_CHAINED_CELL *pstCell;
+
+    // Unlinks it
+    pstCell   = *ppstCell;
+    *ppstCell = pstCell->pstNext;
+
+    // Frees it
+    orxBank_Free(_pstTable->pstBank, pstCell);
+  }
+}
+
+static void LogResult(const orxSTRING _zOperation, orxU32 _u32Count, orxU32 _u32Hint, orxDOUBLE _dReference, orxDOUBLE _dCurrent)
+{
+  // Logs it
+  orxBENCH_LOG(HASHTABLE, "%8u keys (hint %8u) | %-7s | chained %10.2f ns/op | open %8.2f ns/op | x%.2f",
+               _u32Count,
+               _u32Hint,
+               _zOperation,
+               (_dReference * 1e9) / _u32Count,
+               (_dCurrent * 1e9) / _u32Count,
+               (_dCurrent > 0.0) ? _dReference / _dCurrent : 0.0);
+}
+
+static void RunHashTable()
+{
+  static const orxU32 sau32Count[] = {1000, 100000, 1000000};
+  orxU32              u32Test;
+
+  // For all tests: tables created with the exact key count, then with a small hint (skipped for the largest count, as chains would be too long to complete)
+  for(u32Test = 0; u32Test < 2 * (sizeof(sau32Count) / sizeof(sau32Count[0])) - 1; u32Test++)
+  {
+    orxBENCH_CHAINED_TABLE *pstChainedTable;
+    orxHASHTABLE           *pstTable;
+    orxU64                 *au64Key;
+    orxU64                  u64Sink = 0;
+    orxDOUBLE               adReference[4], adCurrent[4], dTime;
+    orxU32                  u32Count, u32Hint, i;
+
+    // Gets count & hint
+    u32Count  = sau32Count[u32Test % (sizeof(sau32Count) / sizeof(sau32Count[0]))];
+    u32Hint   = (u32Test < sizeof(sau32Count) / sizeof(sau32Count[0])) ? u32Count : orxBENCH_KU32_HASHTABLE_SMALL_HINT;
+
+    // Generates keys: first half is inserted, second half is only used for misses
+    au64Key = (orxU64 *)orxMemory_Allocate(2 * u32Count * sizeof(orxU64), orxMEMORY_TYPE_TEMP);
+    orxASSERT(au64Key);
+    for(i = 0; i < 2 * u32Count; i++)
+    {
+      au64Key[i] = GetRandomKey();
+    }
+
+    // Runs reference
+    pstChainedTable = ChainedTable_Create(u32Hint);
+    dTime = orxSystem_GetTime();
+    for(i = 0; i < u32Count; i++)
+    {
+      ChainedTable_Add(pstChainedTable, au64Key[i], (void *)&au64Key[i]);
+    }
+    adReference[0] = orxSystem_GetTime() - dTime;
+    dTime = orxSystem_GetTime();
+    for(i = 0; i < u32Count; i++)
+    {
+      u64Sink += (orxU64)(size_t)ChainedTable_Get(pstChainedTable, au64Key[i]);
+    }
+    adReference[1] = orxSystem_GetTime() - dTime;
+    dTime = orxSystem_GetTime();
+    for(i = u32Count; i < 2 * u32Count; i++)
+    {
+      u64Sink += (orxU64)(size_t)ChainedTable_Get(pstChainedTable, au64Key[i]);
+    }
+    adReference[2] = orxSystem_GetTime() - dTime;
+    dTime = orxSystem_GetTime();
+    for(i = 0; i < u32Count; i++)
+    {
+      ChainedTable_Remove(pstChainedTable, au64Key[i]);
+    }
+    adReference[3] = orxSystem_GetTime() - dTime;
+    ChainedTable_Delete(pstChainedTable);
+
+    // Runs current
+    pstTable = orxHashTable_Create(u32Hint, orxHASHTABLE_KU32_FLAG_NONE, orxMEMORY_TYPE_TEMP);
+    orxASSERT(pstTable);
+    dTime = orxSystem_GetTime();
+    for(i = 0; i < u32Count; i++)
+    {
+      orxHashTable_Add(pstTable, au64Key[i], (void *)&au64Key[i]);
+    }
+    adCurrent[0] = orxSystem_GetTime() - dTime;
+    dTime = orxSystem_GetTime();
+    for(i = 0; i < u32Count; i++)
+    {
+      u64Sink += (orxU64)(size_t)orxHashTable_Get(pstTable, au64Key[i]);
+    }
+    adCurrent[1] = orxSystem_GetTime() - dTime;
+    dTime = orxSystem_GetTime();
+    for(i = u32Count; i < 2 * u32Count; i++)
+    {
+      u64Sink += (orxU64)(size_t)orxHashTable_Get(pstTable, au64Key[i]);
+    }
+    adCurrent[2] = orxSystem_GetTime() - dTime;
+    dTime = orxSystem_GetTime();
+    for(i = 0; i < u32Count; i++)
+    {
+      orxHashTable_Remove(pstTable, au64Key[i]);
+    }
+    adCurrent[3] = orxSystem_GetTime() - dTime;
+    orxHashTable_Delete(pstTable);
+
+    // Logs results
+    LogResult("insert", u32Count, u32Hint, adReference[0], adCurrent[0]);
+    LogResult("hit", u32Count, u32Hint, adReference[1], adCurrent[1]);
+    LogResult("miss", u32Count, u32Hint, adReference[2], adCurrent[2]);
+    LogResult("remove", u32Count, u32Hint, adReference[3], adCurrent[3]);
+
+    // Updates sink
+    su64Sink += u64Sink;
+
+    // Frees keys
+    orxMemory_Free(au64Key);
+  }
+}
+
+static void InitReferenceCRC()
+{
+  orxU32 i, j;
+
+  // For all entries
+  for(i = 0; i < 256; i++)
+  {
+    orxU32 u32CRC;
+
+    // Computes it
+    for(u32CRC = i, j = 0; j < 8; j++)
+    {
+      u32CRC = (u32CRC >> 1) ^ ((u32CRC & 1) * orxBENCH_KU32_CRC_POLYNOMIAL);
+    }
+    sstBench.aau32CRCTable[0][i] = u32CRC;
+  }
+
+  // For all slices
+  for(i = 0; i < 256; i++)
+  {
+    for(j = 1; j < 8; j++)
+    {
+      sstBench.aau32CRCTable[j][i] = sstBench.aau32CRCTable[0][sstBench.aau32CRCTable[j - 1][i] & 0xFF] ^ (sstBench.aau32CRCTable[j - 1][i] >> 8);
+    }
+  }
+}
+
+static orxU32 GetReferenceCRC(const orxSTRING _zString, orxU32 _u32Length)
+{
+  const orxU8  *pu8;
+  orxU32        u32CRC = 0xFFFFFFFF;
+
+  // For all slices (reference: previous slice-by-8 kernel, little endian only)
+  for(pu8 = (const orxU8 *)_zString; _u32Length >= 8; _u32Length -= 8, pu8 += 8)
+  {
+    orxU32 u32First, u32Second;
+
+    orxMemory_Copy(&u32First, pu8, sizeof(orxU32));
+    orxMemory_Copy(&u32Second, pu8 + 4, sizeof(orxU32));
+    u32First ^= u32CRC;
+    u32CRC    = sstBench.aau32CRCTable[7][u32First & 0xFF]
+              ^ sstBench.aau32CRCTable[6][(u32First >> 8) & 0xFF]
+              ^ sstBench.aau32CRCTable[5][(u32First >> 16) & 0xFF]
+              ^ sstBench.aau32CRCTable[4][u32First >> 24]
+              ^ sstBench.aau32CRCTable[3][u32Second & 0xFF]
+              ^ sstBench.aau32CRCTable[2][(u32Second >> 8) & 0xFF]
+              ^ sstBench.aau32CRCTable[1][(u32Second >> 16) & 0xFF]
+              ^ sstBench.aau32CRCTable[0][u32Second >> 24];
+  }
+
+  // For all remaining characters
+  for(; _u32Length != 0; _u32Length--, pu8++)
+  {
+    u32CRC = sstBench.aau32CRCTable[0][((orxU8)(u32CRC & 0xFF)) ^ *pu8] ^ (u32CRC >> 8);
+  }
+
+  // Done!
+  return ~u32CRC;
+}
+
+static void RunCRC()
+{
+  static const orxSTRING sazKey[] =
+  {
+    "Pos",
+    "Scale",
+    "Graphic",
+    "ChildList",
+    "AnimationSet",
+    "KeepInCache",
+    "ParentCamera",
+    "MainViewport",
+    "BodyPartList",
+    "TextureOrigin",
+    "Object@Template",
+    "DefaultFrequency",
+    "ScrollObjectTemplate",
+    "Input.Set.KEY_ESCAPE",
+    "ShaderList@MyGame.Lighting",
+    "LevelSelectionScreen.ButtonHighlight",
+    "AnExtremelyLongConfigurationKeyNameAsGeneratedByTools.WithAFewSuffixes"
+  };
+  orxU32 u32Key;
+
+  // Logs kernel
+  orxBENCH_LOG(CRC, "ID format version %u", orxString_GetIDVersion());
+
+  // Inits reference
+  InitReferenceCRC();
+
+  // For all keys
+  for(u32Key = 0; u32Key < sizeof(sazKey) / sizeof(sazKey[0]); u32Key++)
+  {
+    orxDOUBLE dReference, dCurrent, dTime;
+    orxU64    u64Sink = 0;
+    orxU32    u32Length, i;
+
+    // Gets length
+    u32Length = orxString_GetLength(sazKey[u32Key]);
+
+    // Runs reference
+    dTime = orxSystem_GetTime();
+    for(i = 0; i < orxBENCH_KU32_CRC_COUNT; i++)
+    {
+      u64Sink += GetReferenceCRC(sazKey[u32Key], u32Length);
+    }
+    dReference = orxSystem_GetTime() - dTime;
+
+    // Runs current
+    dTime = orxSystem_GetTime();
+    for(i = 0; i < orxBENCH_KU32_CRC_COUNT; i++)
+    {
+      u64Sink += orxString_NToCRC(sazKey[u32Key], u32Length);
+    }
+    dCurrent = orxSystem_GetTime() - dTime;
+
+    // Logs result
+    orxBENCH_LOG(CRC, "%3u chars | slice-by-8 %6.2f ns/op | current %6.2f ns/op | x%.2f | %s",
+                 u32Length,
+                 (dReference * 1e9) / orxBENCH_KU32_CRC_COUNT,
+                 (dCurrent * 1e9) / orxBENCH_KU32_CRC_COUNT,
+                 (dCurrent > 0.0) ? dReference / dCurrent : 0.0,
+                 sazKey[u32Key]);
+
+    // Updates sink
+    su64Sink += u64Sink;
+  }
+}
+
+static orxSTATUS orxFASTCALL EventHandler(const orxEVENT *_pstEvent)
+{
+  const orxBENCH_EVENT_PAYLOAD *pstPayload;
+
+  // Gets payload
+  pstPayload = (const orxBENCH_EVENT_PAYLOAD *)_pstEvent->pstPayload;
+
+  // Valid?
+  if(pstPayload != orxNULL)
+  {
+    // Out of order?
+    if(pstPayload->u32Index != sstBench.au32EventIndex[pstPayload->u32Thread])
+    {
+      // Updates status
+      sstBench.bEventOrdered = orxFALSE;
+    }
+
+    // Updates expected index
+    sstBench.au32EventIndex[pstPayload->u32Thread] = pstPayload->u32Index + 1;
+  }
+
+  // Updates count
+  sstBench.u32EventCount++;
+
+  // Done!
+  return orxSTATUS_SUCCESS;
+}
+
+static orxSTATUS orxFASTCALL EventBatchHandler(const orxEVENT *_astEventList, orxU32 _u32EventNumber)
+{
+  // Updates counts
+  sstBench.u32BatchEventCount += _u32EventNumber;
+  sstBench.u32BatchCount++;
+
+  // Done!
+  return orxSTATUS_SUCCESS;
+}
+
+static orxSTATUS orxFASTCALL PostEvents(void *_pContext)
+{
+  orxBENCH_EVENT_PAYLOAD stPayload;
+
+  // Gets thread index
+  stPayload.u32Thread = (orxU32)(size_t)_pContext;
+
+  // For all events
+  for(stPayload.u32Index = 0; stPayload.u32Index < orxBENCH_KU32_EVENT_THREAD_COUNT; stPayload.u32Index++)
+  {
+    // Posts it, copying its payload
+    orxEVENT_POST(orxEVENT_TYPE_USER_DEFINED, 0, orxNULL, orxNULL, &stPayload, sizeof(orxBENCH_EVENT_PAYLOAD), orxFALSE);
+  }
+
+  // Done! (runs only once)
+  return orxSTATUS_FAILURE;
+}
+
+static void ResetEvents()
+{
+  // Clears counts & indices
+  orxMemory_Zero(sstBench.au32EventIndex, sizeof(sstBench.au32EventIndex));
+  sstBench.u32EventCount      = 0;
+  sstBench.u32BatchEventCount = 0;
+  sstBench.u32BatchCount      = 0;
+  sstBench.bEventOrdered      = orxTRUE;
+}
+
+static void LogEventCheck(const orxSTRING _zCheck, orxBOOL _bSuccess)
+{
+  // Logs it
+  orxBENCH_LOG(EVENT, "%-10s | %s", _zCheck, (_bSuccess != orxFALSE) ? "OK" : "FAILED");
+}
+
+static void RunEvent()
+{
+  orxBENCH_EVENT_PAYLOAD  stPayload;
+  orxU32                  au32ThreadID[orxBENCH_KU32_EVENT_THREAD_NUMBER];
+  orxDOUBLE               dSend, dPost, dTime;
+  orxBOOL                 bSuccess;
+  orxU32                  i;
+
+  // Adds handler
+  orxEvent_AddHandler(orxEVENT_TYPE_USER_DEFINED, EventHandler);
+
+  // Checks deferred delivery: nothing is received before dispatch, everything is received in order after
+  ResetEvents();
+  stPayload.u32Thread = 0;
+  for(stPayload.u32Index = 0; stPayload.u32Index < orxBENCH_KU32_EVENT_CHECK_COUNT; stPayload.u32Index++)
+  {
+    orxEVENT_POST(orxEVENT_TYPE_USER_DEFINED, 0, orxNULL, orxNULL, &stPayload, sizeof(orxBENCH_EVENT_PAYLOAD), orxFALSE);
+  }
+  bSuccess = (sstBench.u32EventCount == 0) ? orxTRUE : orxFALSE;
+  orxEvent_Dispatch();
+  LogEventCheck("deferred", ((bSuccess != orxFALSE) && (sstBench.u32EventCount == orxBENCH_KU32_EVENT_CHECK_COUNT) && (sstBench.bEventOrdered != orxFALSE)) ? orxTRUE : orxFALSE);
+
+  // Checks coalescing: identical coalescable events are received only once per dispatch
+  ResetEvents();
+  for(i = 0; i < orxBENCH_KU32_EVENT_CHECK_COUNT; i++)
+  {
+    orxEVENT_POST(orxEVENT_TYPE_USER_DEFINED, 1, orxNULL, orxNULL, orxNULL, 0, orxTRUE);
+  }
+  orxEvent_Dispatch();
+  LogEventCheck("coalesce", (sstBench.u32EventCount == 1) ? orxTRUE : orxFALSE);
+
+  // Checks batching: posted events are received as a single array, after regular handlers
+  ResetEvents();
+  orxEvent_AddBatchHandler(orxEVENT_TYPE_USER_DEFINED, EventBatchHandler, orxNULL);
+  for(stPayload.u32Index = 0; stPayload.u32Index < orxBENCH_KU32_EVENT_CHECK_COUNT; stPayload.u32Index++)
+  {
+    orxEVENT_POST(orxEVENT_TYPE_USER_DEFINED, 0, orxNULL, orxNULL, &stPayload, sizeof(orxBENCH_EVENT_PAYLOAD), orxFALSE);
+  }
+  orxEvent_Dispatch();
+  orxEvent_RemoveBatchHandler(orxEVENT_TYPE_USER_DEFINED, EventBatchHandler, orxNULL);
+  LogEventCheck("batch", ((sstBench.u32EventCount == orxBENCH_KU32_EVENT_CHECK_COUNT) && (sstBench.u32BatchEventCount == orxBENCH_KU32_EVENT_CHECK_COUNT) && (sstBench.u32BatchCount == 1)) ? orxTRUE : orxFALSE);
+
+  // Checks threads: events posted concurrently are all received, in order for each thread
+  ResetEvents();
+  for(i = 0; i < orxBENCH_KU32_EVENT_THREAD_NUMBER; i++)
+  {
+    au32ThreadID[i] = orxThread_Start(PostEvents, "Bench", (void *)(size_t)(i + 1));
+  }
+  for(i = 0, bSuccess = orxTRUE; i < orxBENCH_KU32_EVENT_THREAD_NUMBER; i++)
+  {
+    if(au32ThreadID[i] != orxU32_UNDEFINED)
+    {
+      orxThread_Join(au32ThreadID[i]);
+    }
+    else
+    {
+      bSuccess = orxFALSE;
+    }
+  }
+  orxEvent_Dispatch();
+  LogEventCheck("threads", ((bSuccess != orxFALSE) && (sstBench.u32EventCount == orxBENCH_KU32_EVENT_THREAD_NUMBER * orxBENCH_KU32_EVENT_THREAD_COUNT) && (sstBench.bEventOrdered != orxFALSE)) ? orxTRUE : orxFALSE);
+
+  // Times synchronous sends
+  ResetEvents();
+  dTime = orxSystem_GetTime();
+  for(stPayload.u32Index = 0; stPayload.u32Index < orxBENCH_KU32_EVENT_COUNT; stPayload.u32Index++)
+  {
+    orxEVENT_SEND(orxEVENT_TYPE_USER_DEFINED, 0, orxNULL, orxNULL, &stPayload);
+  }
+  dSend = orxSystem_GetTime() - dTime;
+
+  // Times posts + dispatch (full queues get dispatched from within orxEvent_Post())
+  ResetEvents();
+  dTime = orxSystem_GetTime();
+  for(stPayload.u32Index = 0; stPayload.u32Index < orxBENCH_KU32_EVENT_COUNT; stPayload.u32Index++)
+  {
+    orxEVENT_POST(orxEVENT_TYPE_USER_DEFINED, 0, orxNULL, orxNULL, &stPayload, sizeof(orxBENCH_EVENT_PAYLOAD), orxFALSE);
+  }
+  orxEvent_Dispatch();
+  dPost = orxSystem_GetTime() - dTime;
+
+  // Logs result
+  orxBENCH_LOG(EVENT, "%8u events | send %6.2f ns/op | post + dispatch %6.2f ns/op | %s",
+               orxBENCH_KU32_EVENT_COUNT,
+               (dSend * 1e9) / orxBENCH_KU32_EVENT_COUNT,
+               (dPost * 1e9) / orxBENCH_KU32_EVENT_COUNT,
+               ((sstBench.u32EventCount == orxBENCH_KU32_EVENT_COUNT) && (sstBench.bEventOrdered != orxFALSE)) ? "OK" : "FAILED");
+
+  // Removes handler
+  orxEvent_RemoveHandler(orxEVENT_TYPE_USER_DEFINED, EventHandler);
+}
+
+static orxSTATUS orxFASTCALL ProcessSuiteParams(orxU32 _u32ParamCount, const orxSTRING _azParams[])
+{
+  orxU32    i;
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  // For all suites
+  for(i = 1; i < _u32ParamCount; i++)
+  {
+    // Hashtable?
+    if(!orxString_ICompare(_azParams[i], "hashtable"))
+    {
+      // Updates status
+      orxFLAG_SET(sstBench.u32Flags, orxBENCH_KU32_STATIC_FLAG_HASHTABLE, orxBENCH_KU32_STATIC_FLAG_NONE);
+    }
+    // CRC?
+    else if(!orxString_ICompare(_azParams[i], "crc"))
+    {
+      // Updates status
+      orxFLAG_SET(sstBench.u32Flags, orxBENCH_KU32_STATIC_FLAG_CRC, orxBENCH_KU32_STATIC_FLAG_NONE);
+    }
+    // Event?
+    else if(!orxString_ICompare(_azParams[i], "event"))
+    {
+      // Updates status
+      orxFLAG_SET(sstBench.u32Flags, orxBENCH_KU32_STATIC_FLAG_EVENT, orxBENCH_KU32_STATIC_FLAG_NONE);
+    }
+    else
+    {
+      // Logs message
+      orxBENCH_LOG(SUITE, "Unknown suite <%s>, aborting.", _azParams[i]);
+
+      // Updates result
+      eResult = orxSTATUS_FAILURE;
+      break;
+    }
+  }
+
+  // Done!
+  return eResult;
+}
+
+static void orxFASTCALL Setup()
+{
+  // Adds module dependencies
+  orxModule_AddDependency(orxMODULE_ID_MAIN, orxMODULE_ID_PARAM);
+  orxModule_AddDependency(orxMODULE_ID_MAIN, orxMODULE_ID_SYSTEM);
+  orxModule_AddDependency(orxMODULE_ID_MAIN, orxMODULE_ID_BANK);
+  orxModule_AddDependency(orxMODULE_ID_MAIN, orxMODULE_ID_EVENT);
+}
+
+static orxSTATUS orxFASTCALL Init()
+{
+#define orxBENCH_DECLARE_PARAM(SN, LN, SD, LD, FN) {orxPARAM_KU32_FLAG_STOP_ON_ERROR, SN, LN, SD, LD, &FN},
+
+  orxU32    i;
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+  orxPARAM  astParamList[] =
+  {
+    orxBENCH_DECLARE_PARAM("s", "suite", "Suite list", "List of benchmark suites to run (hashtable, crc, event), all of them are run by default", ProcessSuiteParams)
+  };
+
+  // Clears static controller
+  orxMemory_Zero(&sstBench, sizeof(orxBENCH_STATIC));
+
+  // Inits seed
+  sstBench.u64Seed = 0x9E3779B97F4A7C15ULL;
+
+  // For all params
+  for(i = 0; (i < sizeof(astParamList) / sizeof(astParamList[0])) && (eResult != orxSTATUS_FAILURE); i++)
+  {
+    // Registers param
+    eResult = orxParam_Register(&astParamList[i]);
+  }
+
+  // Done!
+  return eResult;
+}
+
+static void orxFASTCALL Exit()
+{
+}
+
+static void Run()
+{
+  // No suite selected?
+  if(!orxFLAG_TEST(sstBench.u32Flags, orxBENCH_KU32_STATIC_MASK_SUITE))
+  {
+    // Selects all of them
+    orxFLAG_SET(sstBench.u32Flags, orxBENCH_KU32_STATIC_MASK_SUITE, orxBENCH_KU32_STATIC_FLAG_NONE);
+  }
+
+  // Hashtable?
+  if(orxFLAG_TEST(sstBench.u32Flags, orxBENCH_KU32_STATIC_FLAG_HASHTABLE))
+  {
+    // Runs it
+    RunHashTable();
+  }
+
+  // CRC?
+  if(orxFLAG_TEST(sstBench.u32Flags, orxBENCH_KU32_STATIC_FLAG_CRC))
+  {
+    // Runs it
+    RunCRC();
+  }
+
+  // Event?
+  if(orxFLAG_TEST(sstBench.u32Flags, orxBENCH_KU32_STATIC_FLAG_EVENT))
+  {
+    // Runs it
+    RunEvent();
+  }
+}
+
+int main(int argc, char **argv)
+{
+  // Inits the Debug System
+  orxDEBUG_INIT();
+
+  // Sets debug flags
+  orxDEBUG_SET_FLAGS(orxDEBUG_KU32_STATIC_FLAG_NONE, orxDEBUG_KU32_STATIC_FLAG_FULL_TIMESTAMP | orxDEBUG_KU32_STATIC_FLAG_TIMESTAMP | orxDEBUG_KU32_STATIC_FLAG_TYPE | orxDEBUG_KU32_STATIC_FLAG_TAGGED);
+
+  // Registers main module
+  orxModule_Register(orxMODULE_ID_MAIN, "MAIN", Setup, Init, Exit);
+
+  // Sends the command line arguments to orxParam module
+  if(orxParam_SetArgs(argc, argv) != orxSTATUS_FAILURE)
+  {
+    // Inits the engine
+    if(orxModule_Init(orxMODULE_ID_MAIN) != orxSTATUS_FAILURE)
+    {
+      // Runs
+      Run();
+
+      // Exits from engine
+      orxModule_Exit(orxMODULE_ID_MAIN);
+    }
+  }
+
+  // Exits from the Debug system
+  orxDEBUG_EXIT();
+
+  // Done!
+  return EXIT_SUCCESS;
+}
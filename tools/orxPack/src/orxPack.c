@@ -0,0 +1,794 @@
+/* Orx - Portable Game Engine
+ *
+ * Copyright (c) 2008-2019 Orx-Project
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ *    1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ *
+ *    2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ *
+ *    3. This notice may not be removed or altered from any source
+ *    distribution.
+ */
+
+/**
+ * @file orxPack.c
+ *
+ */
+
+
+#include "orx.h"
+
+
+/** Module flags
+ */
+#define orxPACK_KU32_STATIC_FLAG_NONE             0x00000000  /**< No flags */
+
+#define orxPACK_KU32_STATIC_FLAG_COMPRESS         0x00000001  /**< Compress flag */
+
+#define orxPACK_KU32_STATIC_MASK_ALL              0xFFFFFFFF  /**< All mask */
+
+
+/** Defines
+ */
+#define orxPACK_KZ_DEFAULT_OUTPUT                 "orxpack.pak"
+#define orxPACK_KU32_DEFAULT_BLOCK_SIZE           65536
+#define orxPACK_KU32_MIN_BLOCK_SIZE               1024
+#define orxPACK_KU32_MAX_BLOCK_SIZE               0x00400000
+
+#define orxPACK_KU32_ENTRY_BUFFER_SIZE            1024
+#define orxPACK_KU32_HASH_SIZE                    65536
+#define orxPACK_KU32_MIN_MATCH                    4
+#define orxPACK_KU32_MAX_OFFSET                   65535
+#define orxPACK_KU32_LAST_LITERALS                5
+#define orxPACK_KU32_MATCH_LIMIT                  12
+
+#define orxPACK_GET_MAX_STORED_SIZE(SIZE)         ((SIZE) + ((SIZE) / 255) + 16)
+
+#define orxPACK_KZ_LOG_TAG_LENGTH                 "10"
+
+#if defined(__orxGCC__) || defined(__orxLLVM__)
+
+  #define orxPACK_LOG(TAG, FORMAT, ...) orxLOG(orxANSI_KZ_COLOR_FG_YELLOW "%-" orxPACK_KZ_LOG_TAG_LENGTH "s" orxANSI_KZ_COLOR_FG_DEFAULT FORMAT, "[" #TAG "]", ##__VA_ARGS__)
+
+#else // __orxGCC__ || __orxLLVM__
+
+  #define orxPACK_LOG(TAG, FORMAT, ...) orxLOG(orxANSI_KZ_COLOR_FG_YELLOW "%-" orxPACK_KZ_LOG_TAG_LENGTH "s" orxANSI_KZ_COLOR_FG_DEFAULT FORMAT, "[" #TAG "]", __VA_ARGS__)
+
+#endif //__orxGCC__ || __orxLLVM__
+
+
+/***************************************************************************
+ * Structure declaration                                                   *
+ ***************************************************************************/
+
+/** Input file
+ */
+typedef struct __orxPACK_FILE_t
+{
+  orxSTRING               zName;
+  orxSTRING               zFullName;
+  orxS64                  s64Time;
+
+} orxPACK_FILE;
+
+/** Static structure
+ */
+typedef struct __orxPACK_STATIC_t
+{
+  orxSTRING               zInput;
+  orxSTRING               zOutputFile;
+  orxPACK_FILE           *astFileList;
+  orxU32                  u32FileNumber;
+  orxU32                  u32FileCapacity;
+  orxU32                  u32BlockSize;
+  orxU32                  u32Flags;
+
+} orxPACK_STATIC;
+
+
+/***************************************************************************
+ * Static variables                                                        *
+ ***************************************************************************/
+
+/** static data
+ */
+static orxPACK_STATIC sstPack;
+
+
+/***************************************************************************
+ * Private functions                                                       *
+ ***************************************************************************/
+
+static orxINLINE orxU32 ReadU32(const orxU8 *_pu8Data)
+{
+  orxU32 u32Result;
+
+  orxMemory_Copy(&u32Result, _pu8Data, sizeof(orxU32));
+
+  // Done!
+  return u32Result;
+}
+
+static orxINLINE orxU8 *WriteLength(orxU8 *_pu8Dst, orxU32 _u32Length)
+{
+  // Writes all 255 bytes
+  for(; _u32Length >= 255; _u32Length -= 255)
+  {
+    *_pu8Dst++ = 255;
+  }
+
+  // Writes remainder
+  *_pu8Dst++ = (orxU8)_u32Length;
+
+  // Done!
+  return _pu8Dst;
+}
+
+static orxU8 *WriteSequence(orxU8 *_pu8Dst, const orxU8 *_pu8Literals, orxU32 _u32LiteralLength, orxU32 _u32Offset, orxU32 _u32MatchLength)
+{
+  orxU8 *pu8Token;
+
+  // Writes token
+  pu8Token  = _pu8Dst++;
+  *pu8Token = (orxU8)(orxMIN(_u32LiteralLength, 15) << 4);
+
+  // Long literals?
+  if(_u32LiteralLength >= 15)
+  {
+    // Writes extra length
+    _pu8Dst = WriteLength(_pu8Dst, _u32LiteralLength - 15);
+  }
+
+  // Copies literals
+  orxMemory_Copy(_pu8Dst, _pu8Literals, _u32LiteralLength);
+  _pu8Dst += _u32LiteralLength;
+
+  // Has match?
+  if(_u32MatchLength != 0)
+  {
+    // Writes offset
+    *_pu8Dst++ = (orxU8)(_u32Offset & 0xFF);
+    *_pu8Dst++ = (orxU8)(_u32Offset >> 8);
+
+    // Writes match length
+    _u32MatchLength -= orxPACK_KU32_MIN_MATCH;
+    *pu8Token |= (orxU8)orxMIN(_u32MatchLength, 15);
+    if(_u32MatchLength >= 15)
+    {
+      _pu8Dst = WriteLength(_pu8Dst, _u32MatchLength - 15);
+    }
+  }
+
+  // Done!
+  return _pu8Dst;
+}
+
+// Compresses a block using the LZ4 block format, returns compressed size
+static orxU32 Compress(const orxU8 *_pu8Src, orxU32 _u32Size, orxU8 *_pu8Dst, orxU32 *_au32HashTable)
+{
+  orxU8  *pu8Dst;
+  orxU32  u32Anchor = 0, u32Index = 0;
+
+  // Clears hash table
+  orxMemory_Zero(_au32HashTable, orxPACK_KU32_HASH_SIZE * sizeof(orxU32));
+
+  // Inits output
+  pu8Dst = _pu8Dst;
+
+  // Large enough for matches?
+  if(_u32Size > orxPACK_KU32_MATCH_LIMIT)
+  {
+    // While a match can start
+    while(u32Index < _u32Size - orxPACK_KU32_MATCH_LIMIT)
+    {
+      orxU32 u32Sequence, u32Hash, u32Reference;
+
+      // Gets sequence
+      u32Sequence = ReadU32(_pu8Src + u32Index);
+
+      // Gets its hash & last reference
+      u32Hash                 = (u32Sequence * 2654435761U) >> 16;
+      u32Reference            = _au32HashTable[u32Hash];
+      _au32HashTable[u32Hash] = u32Index + 1;
+
+      // Match?
+      if((u32Reference != 0)
+      && (u32Index - (u32Reference - 1) <= orxPACK_KU32_MAX_OFFSET)
+      && (ReadU32(_pu8Src + u32Reference - 1) == u32Sequence))
+      {
+        orxU32 u32Length;
+
+        // Gets reference index
+        u32Reference--;
+
+        // Extends match, keeping the last literals out of it
+        for(u32Length = orxPACK_KU32_MIN_MATCH;
+            (u32Index + u32Length < _u32Size - orxPACK_KU32_LAST_LITERALS) && (_pu8Src[u32Reference + u32Length] == _pu8Src[u32Index + u32Length]);
+            u32Length++)
+        ;
+
+        // Writes sequence
+        pu8Dst = WriteSequence(pu8Dst, _pu8Src + u32Anchor, u32Index - u32Anchor, u32Index - u32Reference, u32Length);
+
+        // Updates indices
+        u32Index += u32Length;
+        u32Anchor = u32Index;
+      }
+      else
+      {
+        // Next byte
+        u32Index++;
+      }
+    }
+  }
+
+  // Writes last literals
+  pu8Dst = WriteSequence(pu8Dst, _pu8Src + u32Anchor, _u32Size - u32Anchor, 0, 0);
+
+  // Done!
+  return (orxU32)(pu8Dst - _pu8Dst);
+}
+
+static orxSTATUS AddFile(const orxSTRING _zName, const orxSTRING _zFullName, orxS64 _s64Time)
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  // Needs to grow?
+  if(sstPack.u32FileNumber == sstPack.u32FileCapacity)
+  {
+    orxPACK_FILE *astFileList;
+    orxU32        u32Capacity;
+
+    // Gets new capacity
+    u32Capacity = (sstPack.u32FileCapacity != 0) ? sstPack.u32FileCapacity << 1 : 256;
+
+    // Grows list
+    astFileList = (orxPACK_FILE *)orxMemory_Reallocate(sstPack.astFileList, u32Capacity * sizeof(orxPACK_FILE));
+
+    // Success?
+    if(astFileList != orxNULL)
+    {
+      // Stores it
+      sstPack.astFileList     = astFileList;
+      sstPack.u32FileCapacity = u32Capacity;
+    }
+    else
+    {
+      // Updates result
+      eResult = orxSTATUS_FAILURE;
+    }
+  }
+
+  // Success?
+  if(eResult != orxSTATUS_FAILURE)
+  {
+    orxPACK_FILE *pstFile;
+
+    // Stores file
+    pstFile             = &(sstPack.astFileList[sstPack.u32FileNumber++]);
+    pstFile->zName      = orxString_Duplicate(_zName);
+    pstFile->zFullName  = orxString_Duplicate(_zFullName);
+    pstFile->s64Time    = _s64Time;
+  }
+
+  // Done!
+  return eResult;
+}
+
+static orxSTATUS CollectFiles(const orxSTRING _zPath, const orxSTRING _zName)
+{
+  orxFILE_INFO  stFileInfo;
+  orxCHAR       acPattern[orxPACK_KU32_ENTRY_BUFFER_SIZE];
+  orxSTATUS     eResult = orxSTATUS_SUCCESS;
+
+  // Gets search pattern
+  orxString_NPrint(acPattern, sizeof(acPattern) - 1, "%s/*", _zPath);
+
+  // For all files
+  if(orxFile_FindFirst(acPattern, &stFileInfo) != orxSTATUS_FAILURE)
+  {
+    do
+    {
+      // Not a relative directory entry?
+      if((orxString_Compare(stFileInfo.zName, ".") != 0)
+      && (orxString_Compare(stFileInfo.zName, "..") != 0))
+      {
+        orxCHAR acName[orxPACK_KU32_ENTRY_BUFFER_SIZE];
+
+        // Gets entry name
+        if(*_zName != orxCHAR_NULL)
+        {
+          orxString_NPrint(acName, sizeof(acName) - 1, "%s/%s", _zName, stFileInfo.zName);
+        }
+        else
+        {
+          orxString_NPrint(acName, sizeof(acName) - 1, "%s", stFileInfo.zName);
+        }
+
+        // Directory?
+        if(orxFLAG_TEST(stFileInfo.u32Flags, orxFILE_KU32_FLAG_INFO_DIRECTORY))
+        {
+          // Collects its files
+          eResult = CollectFiles(stFileInfo.zFullName, acName);
+        }
+        // Not the output file?
+        else if((sstPack.zOutputFile == orxNULL) || (orxString_Compare(stFileInfo.zFullName, sstPack.zOutputFile) != 0))
+        {
+          // Adds it
+          eResult = AddFile(acName, stFileInfo.zFullName, stFileInfo.s64TimeStamp);
+        }
+      }
+    } while((eResult != orxSTATUS_FAILURE) && (orxFile_FindNext(&stFileInfo) != orxSTATUS_FAILURE));
+
+    // Ends search
+    orxFile_FindClose(&stFileInfo);
+  }
+  // Input directory?
+  else if(*_zName == orxCHAR_NULL)
+  {
+    // Updates result
+    eResult = orxSTATUS_FAILURE;
+  }
+
+  // Done!
+  return eResult;
+}
+
+static orxSTATUS WriteEntry(orxFILE *_pstPackFile, const orxPACK_FILE *_pstFile, orxRESOURCE_PACK_ENTRY *_pstEntry, orxU8 *_pu8Buffer, orxU8 *_pu8StoredBuffer, orxU32 *_au32HashTable)
+{
+  orxFILE  *pstFile;
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  // Opens file
+  pstFile = orxFile_Open(_pstFile->zFullName, orxFILE_KU32_FLAG_OPEN_READ | orxFILE_KU32_FLAG_OPEN_BINARY);
+
+  // Success?
+  if(pstFile != orxNULL)
+  {
+    orxS64 s64Size;
+
+    // Inits entry
+    _pstEntry->s64Offset      = orxFile_Tell(_pstPackFile);
+    _pstEntry->s64Size        = 0;
+    _pstEntry->s64StoredSize  = 0;
+    _pstEntry->s64Time        = _pstFile->s64Time;
+    _pstEntry->u32NameCRC     = (orxU32)orxString_ToCRC(_pstFile->zName);
+    _pstEntry->u32Flags       = orxFLAG_TEST(sstPack.u32Flags, orxPACK_KU32_STATIC_FLAG_COMPRESS) ? orxRESOURCE_KU32_PACK_ENTRY_FLAG_COMPRESSED : orxRESOURCE_KU32_PACK_ENTRY_FLAG_NONE;
+    _pstEntry->u32Padding     = 0;
+
+    // Updates result
+    eResult = orxSTATUS_SUCCESS;
+
+    // For all blocks
+    while((eResult != orxSTATUS_FAILURE) && ((s64Size = orxFile_Read(_pu8Buffer, sizeof(orxU8), sstPack.u32BlockSize, pstFile)) > 0))
+    {
+      // Compressed?
+      if(orxFLAG_TEST(_pstEntry->u32Flags, orxRESOURCE_KU32_PACK_ENTRY_FLAG_COMPRESSED))
+      {
+        orxU32 u32StoredSize;
+
+        // Compresses block
+        u32StoredSize = Compress(_pu8Buffer, (orxU32)s64Size, _pu8StoredBuffer + sizeof(orxU32), _au32HashTable);
+
+        // Not worth it?
+        if(u32StoredSize >= (orxU32)s64Size)
+        {
+          // Stores it raw
+          orxMemory_Copy(_pu8StoredBuffer + sizeof(orxU32), _pu8Buffer, (orxU32)s64Size);
+          u32StoredSize = (orxU32)s64Size | orxRESOURCE_KU32_PACK_BLOCK_FLAG_RAW;
+        }
+
+        // Writes block
+        orxMemory_Copy(_pu8StoredBuffer, &u32StoredSize, sizeof(orxU32));
+        u32StoredSize = (u32StoredSize & orxRESOURCE_KU32_PACK_BLOCK_MASK_SIZE) + sizeof(orxU32);
+        eResult = (orxFile_Write(_pu8StoredBuffer, sizeof(orxU8), u32StoredSize, _pstPackFile) == (orxS64)u32StoredSize) ? orxSTATUS_SUCCESS : orxSTATUS_FAILURE;
+
+        // Updates stored size
+        _pstEntry->s64StoredSize += u32StoredSize;
+      }
+      else
+      {
+        // Writes data
+        eResult = (orxFile_Write(_pu8Buffer, sizeof(orxU8), s64Size, _pstPackFile) == s64Size) ? orxSTATUS_SUCCESS : orxSTATUS_FAILURE;
+
+        // Updates stored size
+        _pstEntry->s64StoredSize += s64Size;
+      }
+
+      // Updates size
+      _pstEntry->s64Size += s64Size;
+    }
+
+    // Closes file
+    orxFile_Close(pstFile);
+  }
+
+  // Done!
+  return eResult;
+}
+
+static orxSTATUS orxFASTCALL ProcessInputParams(orxU32 _u32ParamCount, const orxSTRING _azParams[])
+{
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  // Has a valid input parameter?
+  if(_u32ParamCount > 1)
+  {
+    // Stores it
+    sstPack.zInput = orxString_Duplicate(_azParams[1]);
+
+    // Updates result
+    eResult = orxSTATUS_SUCCESS;
+  }
+  else
+  {
+    // Logs message
+    orxPACK_LOG(INPUT, "No valid input directory found, aborting");
+  }
+
+  // Done!
+  return eResult;
+}
+
+static orxSTATUS orxFASTCALL ProcessOutputParams(orxU32 _u32ParamCount, const orxSTRING _azParams[])
+{
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+
+  // Has a valid output parameter?
+  if(_u32ParamCount > 1)
+  {
+    // Stores it
+    sstPack.zOutputFile = orxString_Duplicate(_azParams[1]);
+  }
+  else
+  {
+    // Logs message
+    orxPACK_LOG(OUTPUT, "No valid output found, using default");
+  }
+
+  // Done!
+  return eResult;
+}
+
+static orxSTATUS orxFASTCALL ProcessCompressParams(orxU32 _u32ParamCount, const orxSTRING _azParams[])
+{
+  // Updates status
+  orxFLAG_SET(sstPack.u32Flags, orxPACK_KU32_STATIC_FLAG_COMPRESS, orxPACK_KU32_STATIC_FLAG_NONE);
+
+  // Done!
+  return orxSTATUS_SUCCESS;
+}
+
+static orxSTATUS orxFASTCALL ProcessBlockParams(orxU32 _u32ParamCount, const orxSTRING _azParams[])
+{
+  orxU32    u32BlockSize;
+  orxSTATUS eResult = orxSTATUS_FAILURE;
+
+  // Has a valid block size?
+  if((_u32ParamCount > 1)
+  && (orxString_ToU32(_azParams[1], &u32BlockSize, orxNULL) != orxSTATUS_FAILURE)
+  && (u32BlockSize * 1024 >= orxPACK_KU32_MIN_BLOCK_SIZE)
+  && (u32BlockSize * 1024 <= orxPACK_KU32_MAX_BLOCK_SIZE))
+  {
+    // Stores it
+    sstPack.u32BlockSize = u32BlockSize * 1024;
+
+    // Updates result
+    eResult = orxSTATUS_SUCCESS;
+  }
+  else
+  {
+    // Logs message
+    orxPACK_LOG(BLOCK, "Block size needs to be in [%u, %u] KB, aborting", orxPACK_KU32_MIN_BLOCK_SIZE / 1024, orxPACK_KU32_MAX_BLOCK_SIZE / 1024);
+  }
+
+  // Done!
+  return eResult;
+}
+
+static void orxFASTCALL Setup()
+{
+  // Adds module dependencies
+  orxModule_AddDependency(orxMODULE_ID_MAIN, orxMODULE_ID_PARAM);
+  orxModule_AddDependency(orxMODULE_ID_MAIN, orxMODULE_ID_FILE);
+}
+
+static orxSTATUS orxFASTCALL Init()
+{
+#define orxPACK_DECLARE_PARAM(SN, LN, SD, LD, FN) {orxPARAM_KU32_FLAG_STOP_ON_ERROR, SN, LN, SD, LD, &FN},
+
+  orxU32    i;
+  orxSTATUS eResult = orxSTATUS_SUCCESS;
+  orxPARAM  astParamList[] =
+  {
+    orxPACK_DECLARE_PARAM("i", "input", "Input directory", "Directory whose content (including sub-directories) will be packed, it can then be replaced by the pack in resource storages", ProcessInputParams)
+    orxPACK_DECLARE_PARAM("o", "output", "Output file", "Pack file that will be created", ProcessOutputParams)
+    orxPACK_DECLARE_PARAM("z", "compress", "Compress mode", "If this switch is provided, entries will be compressed (LZ4 block format, incompressible blocks are stored raw)", ProcessCompressParams)
+    orxPACK_DECLARE_PARAM("b", "block", "Block size", "Size of the compressed blocks, in KB, defaults to 64: larger blocks compress better but cost more to seek in", ProcessBlockParams)
+  };
+
+  // Clears static controller
+  orxMemory_Zero(&sstPack, sizeof(orxPACK_STATIC));
+
+  // Inits block size
+  sstPack.u32BlockSize = orxPACK_KU32_DEFAULT_BLOCK_SIZE;
+
+  // For all params
+  for(i = 0; (i < sizeof(astParamList) / sizeof(astParamList[0])) && (eResult != orxSTATUS_FAILURE); i++)
+  {
+    // Registers param
+    eResult = orxParam_Register(&astParamList[i]);
+  }
+
+  // Done!
+  return eResult;
+}
+
+static void orxFASTCALL Exit()
+{
+  orxU32 i;
+
+  // For all files
+  for(i = 0; i < sstPack.u32FileNumber; i++)
+  {
+    // Frees its strings
+    orxString_Delete(sstPack.astFileList[i].zName);
+    orxString_Delete(sstPack.astFileList[i].zFullName);
+  }
+
+  // Has file list?
+  if(sstPack.astFileList)
+  {
+    // Frees it
+    orxMemory_Free(sstPack.astFileList);
+  }
+
+  // Has input?
+  if(sstPack.zInput)
+  {
+    // Frees its string
+    orxString_Delete(sstPack.zInput);
+  }
+
+  // Has output file?
+  if(sstPack.zOutputFile)
+  {
+    // Frees its string
+    orxString_Delete(sstPack.zOutputFile);
+  }
+}
+
+static orxSTATUS Run()
+{
+  const orxSTRING zOutputFile;
+  orxSTATUS       eResult = orxSTATUS_FAILURE;
+
+  // Selects correct output file
+  zOutputFile = (sstPack.zOutputFile) ? sstPack.zOutputFile : orxPACK_KZ_DEFAULT_OUTPUT;
+
+  // Has input?
+  if(sstPack.zInput)
+  {
+    // Collects files
+    if(CollectFiles(sstPack.zInput, orxSTRING_EMPTY) != orxSTATUS_FAILURE)
+    {
+      orxRESOURCE_PACK_HEADER stHeader;
+      orxRESOURCE_PACK_ENTRY *astEntryList;
+      orxU32                 *au32SlotList, *au32HashTable;
+      orxCHAR                *acNameList;
+      orxU8                  *pu8Buffer, *pu8StoredBuffer;
+      orxFILE                *pstPackFile;
+      orxU32                  i;
+
+      // Inits header
+      orxMemory_Zero(&stHeader, sizeof(orxRESOURCE_PACK_HEADER));
+      stHeader.u32Magic       = orxRESOURCE_KU32_PACK_MAGIC;
+      stHeader.u32Version     = orxRESOURCE_KU32_PACK_VERSION;
+      stHeader.u32EntryCount  = sstPack.u32FileNumber;
+      stHeader.u32BlockSize   = sstPack.u32BlockSize;
+      stHeader.u32IDVersion   = orxString_GetIDVersion();
+
+      // Gets slot count (load factor <= 0.5)
+      for(stHeader.u32SlotCount = 2; stHeader.u32SlotCount < 2 * sstPack.u32FileNumber; stHeader.u32SlotCount <<= 1)
+      ;
+
+      // Gets name list size
+      for(i = 0, stHeader.u32NameSize = 1; i < sstPack.u32FileNumber; i++)
+      {
+        stHeader.u32NameSize += orxString_GetLength(sstPack.astFileList[i].zName) + 1;
+      }
+
+      // Allocates tables & buffers
+      au32SlotList    = (orxU32 *)orxMemory_Allocate(stHeader.u32SlotCount * sizeof(orxU32), orxMEMORY_TYPE_TEMP);
+      astEntryList    = (orxRESOURCE_PACK_ENTRY *)orxMemory_Allocate(orxMAX(stHeader.u32EntryCount, 1) * sizeof(orxRESOURCE_PACK_ENTRY), orxMEMORY_TYPE_TEMP);
+      acNameList      = (orxCHAR *)orxMemory_Allocate(stHeader.u32NameSize, orxMEMORY_TYPE_TEMP);
+      au32HashTable   = (orxU32 *)orxMemory_Allocate(orxPACK_KU32_HASH_SIZE * sizeof(orxU32), orxMEMORY_TYPE_TEMP);
+      pu8Buffer       = (orxU8 *)orxMemory_Allocate(sstPack.u32BlockSize, orxMEMORY_TYPE_TEMP);
+      pu8StoredBuffer = (orxU8 *)orxMemory_Allocate(orxPACK_GET_MAX_STORED_SIZE(sstPack.u32BlockSize) + sizeof(orxU32), orxMEMORY_TYPE_TEMP);
+
+      // Success?
+      if((au32SlotList != orxNULL)
+      && (astEntryList != orxNULL)
+      && (acNameList != orxNULL)
+      && (au32HashTable != orxNULL)
+      && (pu8Buffer != orxNULL)
+      && (pu8StoredBuffer != orxNULL))
+      {
+        // Clears tables
+        orxMemory_Zero(au32SlotList, stHeader.u32SlotCount * sizeof(orxU32));
+        orxMemory_Zero(astEntryList, orxMAX(stHeader.u32EntryCount, 1) * sizeof(orxRESOURCE_PACK_ENTRY));
+        orxMemory_Zero(acNameList, stHeader.u32NameSize);
+
+        // Opens pack
+        pstPackFile = orxFile_Open(zOutputFile, orxFILE_KU32_FLAG_OPEN_WRITE | orxFILE_KU32_FLAG_OPEN_BINARY);
+
+        // Success?
+        if(pstPackFile != orxNULL)
+        {
+          orxS64 s64Size = 0, s64StoredSize = 0;
+          orxU32 u32NameOffset;
+
+          // Writes placeholder header & table of contents
+          eResult = ((orxFile_Write(&stHeader, sizeof(orxRESOURCE_PACK_HEADER), 1, pstPackFile) == 1)
+                  && (orxFile_Write(au32SlotList, stHeader.u32SlotCount * sizeof(orxU32), 1, pstPackFile) == 1)
+                  && ((stHeader.u32EntryCount == 0) || (orxFile_Write(astEntryList, stHeader.u32EntryCount * sizeof(orxRESOURCE_PACK_ENTRY), 1, pstPackFile) == 1))
+                  && (orxFile_Write(acNameList, stHeader.u32NameSize, 1, pstPackFile) == 1)) ? orxSTATUS_SUCCESS : orxSTATUS_FAILURE;
+
+          // For all files
+          for(i = 0, u32NameOffset = 0; (i < sstPack.u32FileNumber) && (eResult != orxSTATUS_FAILURE); i++)
+          {
+            orxRESOURCE_PACK_ENTRY *pstEntry;
+            orxU32                  u32Index, u32Length;
+
+            // Gets entry
+            pstEntry = &(astEntryList[i]);
+
+            // Writes its data
+            eResult = WriteEntry(pstPackFile, &(sstPack.astFileList[i]), pstEntry, pu8Buffer, pu8StoredBuffer, au32HashTable);
+
+            // Success?
+            if(eResult != orxSTATUS_FAILURE)
+            {
+              // Stores its name
+              u32Length = orxString_GetLength(sstPack.astFileList[i].zName);
+              orxMemory_Copy(acNameList + u32NameOffset, sstPack.astFileList[i].zName, u32Length + 1);
+              pstEntry->u32NameOffset = u32NameOffset;
+              u32NameOffset          += u32Length + 1;
+
+              // Finds its slot
+              for(u32Index = pstEntry->u32NameCRC & (stHeader.u32SlotCount - 1);
+                  au32SlotList[u32Index] != 0;
+                  u32Index = (u32Index + 1) & (stHeader.u32SlotCount - 1))
+              ;
+
+              // Stores it
+              au32SlotList[u32Index] = i + 1;
+
+              // Updates sizes
+              s64Size       += pstEntry->s64Size;
+              s64StoredSize += pstEntry->s64StoredSize;
+
+              // Logs message
+              orxPACK_LOG(ADD, "%5u: %-48.48s %10lld -> %10lld", i + 1, sstPack.astFileList[i].zName, pstEntry->s64Size, pstEntry->s64StoredSize);
+            }
+            else
+            {
+              // Logs message
+              orxPACK_LOG(ADD, "%5u: %-48.48s FAILURE, aborting.", i + 1, sstPack.astFileList[i].zName);
+            }
+          }
+
+          // Success?
+          if(eResult != orxSTATUS_FAILURE)
+          {
+            // Writes final header & table of contents
+            eResult = ((orxFile_Seek(pstPackFile, 0, orxSEEK_OFFSET_WHENCE_START) >= 0)
+                    && (orxFile_Write(&stHeader, sizeof(orxRESOURCE_PACK_HEADER), 1, pstPackFile) == 1)
+                    && (orxFile_Write(au32SlotList, stHeader.u32SlotCount * sizeof(orxU32), 1, pstPackFile) == 1)
+                    && ((stHeader.u32EntryCount == 0) || (orxFile_Write(astEntryList, stHeader.u32EntryCount * sizeof(orxRESOURCE_PACK_ENTRY), 1, pstPackFile) == 1))
+                    && (orxFile_Write(acNameList, stHeader.u32NameSize, 1, pstPackFile) == 1)) ? orxSTATUS_SUCCESS : orxSTATUS_FAILURE;
+          }
+
+          // Closes pack
+          orxFile_Close(pstPackFile);
+
+          // Success?
+          if(eResult != orxSTATUS_FAILURE)
+          {
+            // Logs message
+            orxPACK_LOG(SAVE, "==== %-24.24s SUCCESS: %u entries, %lld -> %lld bytes%s", zOutputFile, sstPack.u32FileNumber, s64Size, s64StoredSize, orxFLAG_TEST(sstPack.u32Flags, orxPACK_KU32_STATIC_FLAG_COMPRESS) ? " (COMPRESSED)" : orxSTRING_EMPTY);
+          }
+          else
+          {
+            // Logs message
+            orxPACK_LOG(SAVE, "==== %-24.24s FAILURE, aborting.", zOutputFile);
+
+            // Deletes incomplete pack
+            orxFile_Delete(zOutputFile);
+          }
+        }
+        else
+        {
+          // Logs message
+          orxPACK_LOG(SAVE, "==== %-24.24s FAILURE, can't open file.", zOutputFile);
+        }
+      }
+      else
+      {
+        // Logs message
+        orxPACK_LOG(SAVE, "==== %-24.24s FAILURE, out of memory.", zOutputFile);
+      }
+
+      // Frees tables & buffers
+      orxMemory_Free(au32SlotList);
+      orxMemory_Free(astEntryList);
+      orxMemory_Free(acNameList);
+      orxMemory_Free(au32HashTable);
+      orxMemory_Free(pu8Buffer);
+      orxMemory_Free(pu8StoredBuffer);
+    }
+    else
+    {
+      // Logs message
+      orxPACK_LOG(INPUT, "Couldn't list content of <%s>, aborting.", sstPack.zInput);
+    }
+  }
+  else
+  {
+    // Logs message
+    orxPACK_LOG(PROCESS, "No input directory, can't process.");
+  }
+
+  // Done!
+  return eResult;
+}
+
+int main(int argc, char **argv)
+{
+  int iResult = EXIT_FAILURE;
+
+  // Inits the Debug System
+  orxDEBUG_INIT();
+
+  // Sets debug flags
+  orxDEBUG_SET_FLAGS(orxDEBUG_KU32_STATIC_FLAG_TIMESTAMP, orxDEBUG_KU32_STATIC_FLAG_FULL_TIMESTAMP | orxDEBUG_KU32_STATIC_FLAG_TYPE | orxDEBUG_KU32_STATIC_FLAG_TAGGED);
+
+  // Registers main module
+  orxModule_Register(orxMODULE_ID_MAIN, "MAIN", Setup, Init, Exit);
+
+  // Sends the command line arguments to orxParam module
+  if(orxParam_SetArgs(argc, argv) != orxSTATUS_FAILURE)
+  {
+    // Inits the engine
+    if(orxModule_Init(orxMODULE_ID_MAIN) != orxSTATUS_FAILURE)
+    {
+      // Runs
+      if(Run() != orxSTATUS_FAILURE)
+      {
+        // Updates result
+        iResult = EXIT_SUCCESS;
+      }
+
+      // Exits from engine
+      orxModule_Exit(orxMODULE_ID_MAIN);
+    }
+  }
+
+  // Exits from the Debug system
+  orxDEBUG_EXIT();
+
+  // Done!
+  return iResult;
+}